@@ -0,0 +1,146 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+
+#include "Benchmark.h"
+
+// iterations of one sample are never grown past this, whatever the timer says
+#define BENCHMARK_MAX_ITERATIONS (1ULL << 30)
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			struct Entry {
+				std::string FullName;
+				std::string Group;
+				std::string Name;
+				Benchmark::Setup Setup;
+			};
+
+			std::vector<Entry> &registry() {
+				static std::vector<Entry> entries;
+				return entries;
+			}
+
+			// benchmarks run one at a time on the main thread
+			std::chrono::steady_clock::time_point pausedAt;
+			std::chrono::duration<double, std::nano> paused;
+
+			double timeLoop(const Benchmark::Loop &loop, size_t iterations) {
+				paused = std::chrono::duration<double, std::nano>::zero();
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				loop(iterations);
+				std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+				return (elapsed - paused).count();
+			}
+
+			// smallest power of 10 of iterations that makes one sample last at least minSampleNs
+			size_t calibrate(const Benchmark::Loop &loop, double minSampleNs) {
+				size_t iterations = 1;
+				while (iterations < BENCHMARK_MAX_ITERATIONS && timeLoop(loop, iterations) < minSampleNs)
+					iterations *= 10;
+				return iterations;
+			}
+
+			std::string currentDate() {
+				char buf[32];
+				time_t now = time(nullptr);
+				strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+				return buf;
+			}
+		}
+
+		Benchmark::Registrar::Registrar(const char *group, const char *name, Setup setup) {
+			Entry entry;
+			entry.Group = group;
+			entry.Name = name;
+			entry.FullName = entry.Group + "/" + entry.Name;
+			entry.Setup = setup;
+			registry().push_back(entry);
+		}
+
+		void Benchmark::PauseTiming() {
+			pausedAt = std::chrono::steady_clock::now();
+		}
+
+		void Benchmark::ResumeTiming() {
+			paused += std::chrono::steady_clock::now() - pausedAt;
+		}
+
+		std::vector<std::string> Benchmark::List() {
+			std::vector<std::string> names;
+			for (size_t i = 0; i < registry().size(); ++i)
+				names.push_back(registry()[i].FullName);
+			std::sort(names.begin(), names.end());
+			return names;
+		}
+
+		nlohmann::json Benchmark::Run(const Options &options) {
+			std::vector<Entry> entries = registry();
+			std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+				return a.FullName < b.FullName;
+			});
+
+			nlohmann::json results = nlohmann::json::array();
+			for (size_t i = 0; i < entries.size(); ++i) {
+				const Entry &entry = entries[i];
+				if (!options.Filter.empty() && entry.FullName.find(options.Filter) == std::string::npos)
+					continue;
+
+				std::cerr << entry.FullName << " ... " << std::flush;
+				Loop loop = entry.Setup();
+				if (loop.empty()) {
+					std::cerr << "skipped" << std::endl;
+					continue;
+				}
+				size_t iterations = calibrate(loop, options.MinSampleMs * 1e6);
+
+				std::vector<double> nsPerOp;
+				for (size_t s = 0; s < std::max<size_t>(options.Samples, 1); ++s)
+					nsPerOp.push_back(timeLoop(loop, iterations) / iterations);
+				std::sort(nsPerOp.begin(), nsPerOp.end());
+
+				double sum = 0;
+				for (size_t s = 0; s < nsPerOp.size(); ++s)
+					sum += nsPerOp[s];
+				double median = nsPerOp.size() % 2 ? nsPerOp[nsPerOp.size() / 2] :
+								(nsPerOp[nsPerOp.size() / 2 - 1] + nsPerOp[nsPerOp.size() / 2]) / 2;
+
+				nlohmann::json result;
+				result["Name"] = entry.FullName;
+				result["Group"] = entry.Group;
+				result["Iterations"] = iterations;
+				result["Samples"] = nsPerOp.size();
+				result["MinNs"] = nsPerOp.front();
+				result["MedianNs"] = median;
+				result["MeanNs"] = sum / nsPerOp.size();
+				result["MaxNs"] = nsPerOp.back();
+				results.push_back(result);
+
+				std::cerr << median << " ns/op" << std::endl;
+			}
+
+			nlohmann::json report;
+			report["Date"] = currentDate();
+#if defined(__VERSION__)
+			report["Compiler"] = __VERSION__;
+#endif
+#if defined(NDEBUG)
+			report["Assertions"] = false;
+#else
+			report["Assertions"] = true;
+#endif
+			report["Samples"] = options.Samples;
+			report["MinSampleMs"] = options.MinSampleMs;
+			report["Benchmarks"] = results;
+			return report;
+		}
+
+	}
+}
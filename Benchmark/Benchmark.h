@@ -0,0 +1,77 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_BENCHMARK_H__
+#define __ELASTOS_SDK_BENCHMARK_H__
+
+#include <string>
+#include <vector>
+#include <boost/function.hpp>
+#include <nlohmann/json.hpp>
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Microbenchmarks of the sdk hot paths. A benchmark builds its fixture once and returns a loop, which the
+		 * runner calls with growing iteration counts until one sample takes long enough to time, then samples it
+		 * several times. Fixtures use a fixed random seed, so two builds measure the same work.
+		 */
+		class Benchmark {
+		public:
+			typedef boost::function<void(size_t iterations)> Loop;
+
+			typedef Loop (*Setup)();
+
+			struct Options {
+				Options() :
+						Samples(10),
+						MinSampleMs(20) {
+				}
+
+				// substring of "Group/Name", empty runs everything
+				std::string Filter;
+				size_t Samples;
+				size_t MinSampleMs;
+			};
+
+			class Registrar {
+			public:
+				Registrar(const char *group, const char *name, Setup setup);
+			};
+
+			static std::vector<std::string> List();
+
+			// runs the matching benchmarks, prints progress to stderr and returns the results
+			static nlohmann::json Run(const Options &options);
+
+			// time spent in a loop between PauseTiming() and ResumeTiming() is not counted, for per iteration setup
+			static void PauseTiming();
+
+			static void ResumeTiming();
+
+			// keeps the compiler from optimizing away a result that is never read
+			template<typename T>
+			static void DoNotOptimize(const T &value) {
+				asm volatile("" : : "g"(&value) : "memory");
+			}
+		};
+
+	}
+}
+
+/**
+ * Defines and registers a benchmark, the body is the setup and returns the loop, or an empty loop to skip the
+ * benchmark on this machine:
+ *
+ * SPV_BENCHMARK(ByteStream, PutVarUint) {
+ *     return [](size_t iterations) { ... };
+ * }
+ */
+#define SPV_BENCHMARK(group, name) \
+	static Elastos::ElaWallet::Benchmark::Loop group##_##name##_setup(); \
+	static Elastos::ElaWallet::Benchmark::Registrar group##_##name##_registrar(#group, #name, group##_##name##_setup); \
+	static Elastos::ElaWallet::Benchmark::Loop group##_##name##_setup()
+
+#endif //__ELASTOS_SDK_BENCHMARK_H__
@@ -0,0 +1,187 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+#include "BRBIP32Sequence.h"
+#include "BRBIP39Mnemonic.h"
+#include "BRCrypto.h"
+#include "BTCKey.h"
+#include "Key.h"
+#include "MasterPubKey.h"
+#include "PubKeyChain.h"
+
+using namespace Elastos::ElaWallet;
+
+namespace {
+	const char *phrase = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+
+	CMBlock phraseSeed() {
+		UInt512 seed;
+		BRBIP39DeriveKey(seed.u8, phrase, "");
+		CMBlock result;
+		result.SetMemFixed(seed.u8, sizeof(seed));
+		return result;
+	}
+
+	struct SignFixture {
+		SignFixture() :
+				Digest(sizeof(UInt256)) {
+			seedFixtures();
+			PrivateKey.reset(new Key(fixtureBytes(32)));
+			CMBlock message = fixtureBytes(256);
+			BRSHA256(Digest, message, message.GetSize());
+			Signature = PrivateKey->compactSign(Digest);
+		}
+
+		boost::shared_ptr<Key> PrivateKey;
+		CMBlock Digest;
+		CMBlock Signature;
+	};
+
+	bool sha256Supported(BRSHA256Impl impl) {
+		BRSHA256Impl selected = BRSHA256GetImpl();
+		bool supported = BRSHA256SetImpl(impl) != 0;
+		BRSHA256SetImpl(selected);
+		return supported;
+	}
+
+	// one merkle level per iteration, the nodes of a 128 transaction block
+	Benchmark::Loop merkleLevel(BRSHA256Impl impl) {
+		if (!sha256Supported(impl))
+			return Benchmark::Loop();
+
+		seedFixtures();
+		boost::shared_ptr<CMBlock> nodes(new CMBlock(fixtureBytes(64 * 64)));
+		return [impl, nodes](size_t iterations) {
+			BRSHA256Impl selected = BRSHA256GetImpl();
+			std::vector<UInt256> md(64);
+			BRSHA256SetImpl(impl);
+			for (size_t i = 0; i < iterations; ++i)
+				BRSHA256_2x64(md.data(), *nodes, md.size());
+			BRSHA256SetImpl(selected);
+			Benchmark::DoNotOptimize(md[0]);
+		};
+	}
+
+	// sha-256 of 4 KiB per iteration
+	Benchmark::Loop stream(BRSHA256Impl impl) {
+		if (!sha256Supported(impl))
+			return Benchmark::Loop();
+
+		seedFixtures();
+		boost::shared_ptr<CMBlock> data(new CMBlock(fixtureBytes(4096)));
+		return [impl, data](size_t iterations) {
+			BRSHA256Impl selected = BRSHA256GetImpl();
+			UInt256 md;
+			BRSHA256SetImpl(impl);
+			for (size_t i = 0; i < iterations; ++i)
+				BRSHA256(&md, *data, data->GetSize());
+			BRSHA256SetImpl(selected);
+			Benchmark::DoNotOptimize(md);
+		};
+	}
+}
+
+// sha-256 kernels are benchmarked one by one, those the cpu lacks are skipped
+SPV_BENCHMARK(SHA256, MerkleLevelPortable) {
+	return merkleLevel(BRSHA256ImplPortable);
+}
+
+SPV_BENCHMARK(SHA256, MerkleLevelAVX2) {
+	return merkleLevel(BRSHA256ImplAVX2);
+}
+
+SPV_BENCHMARK(SHA256, MerkleLevelSHANI) {
+	return merkleLevel(BRSHA256ImplSHANI);
+}
+
+SPV_BENCHMARK(SHA256, StreamPortable) {
+	return stream(BRSHA256ImplPortable);
+}
+
+SPV_BENCHMARK(SHA256, StreamAVX2) {
+	return stream(BRSHA256ImplAVX2);
+}
+
+SPV_BENCHMARK(SHA256, StreamSHANI) {
+	return stream(BRSHA256ImplSHANI);
+}
+
+SPV_BENCHMARK(Key, CompactSign) {
+	boost::shared_ptr<SignFixture> fixture(new SignFixture());
+
+	return [fixture](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(fixture->PrivateKey->compactSign(fixture->Digest));
+	};
+}
+
+SPV_BENCHMARK(Key, Verify) {
+	boost::shared_ptr<SignFixture> fixture(new SignFixture());
+
+	return [fixture](size_t iterations) {
+		bool valid = false;
+		for (size_t i = 0; i < iterations; ++i)
+			valid ^= fixture->PrivateKey->verify(*(UInt256 *) &fixture->Digest[0], fixture->Signature);
+		Benchmark::DoNotOptimize(valid);
+	};
+}
+
+SPV_BENCHMARK(BTCKey, DerivePrivKey) {
+	boost::shared_ptr<CMBlock> seed(new CMBlock(phraseSeed()));
+
+	return [seed](size_t iterations) {
+		UInt256 chainCode = UINT256_ZERO;
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(BTCKey::getDerivePrivKey(*seed, SEQUENCE_EXTERNAL_CHAIN, (uint32_t) i % 100,
+															  chainCode));
+	};
+}
+
+SPV_BENCHMARK(BTCKey, DerivePubKey) {
+	CMBlock privKey = BTCKey::getMasterPrivkey(phraseSeed());
+	boost::shared_ptr<CMBlock> pubKey(new CMBlock(BTCKey::getPubKeyFromPrivKey(privKey)));
+
+	return [pubKey](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(BTCKey::getDerivePubKey(*pubKey, SEQUENCE_EXTERNAL_CHAIN, (uint32_t) i % 100));
+	};
+}
+
+// one address per iteration, the way WalletUnusedAddrs() filled a gap before PubKeyChain
+SPV_BENCHMARK(MasterPubKey, BIP32Address) {
+	CMBlock privKey = BTCKey::getMasterPrivkey(phraseSeed());
+	CMBlock pubKey = BTCKey::getPubKeyFromPrivKey(privKey);
+	BRMasterPubKey mpk = BR_MASTER_PUBKEY_NONE;
+	memcpy(mpk.pubKey, pubKey, sizeof(mpk.pubKey));
+
+	return [mpk](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i) {
+			CMBlock childPubKey(33);
+			MasterPubKey::BIP32PubKey(childPubKey, childPubKey.GetSize(), mpk, SEQUENCE_EXTERNAL_CHAIN,
+									  (uint32_t) i % 100);
+			Key key;
+			key.setPubKey(childPubKey);
+			Benchmark::DoNotOptimize(key.address());
+		}
+	};
+}
+
+// one address per iteration, derived in batches of 100 from the cached chain node
+SPV_BENCHMARK(PubKeyChain, DeriveAddresses) {
+	CMBlock privKey = BTCKey::getMasterPrivkey(phraseSeed());
+	CMBlock pubKey = BTCKey::getPubKeyFromPrivKey(privKey);
+	BRMasterPubKey mpk = BR_MASTER_PUBKEY_NONE;
+	memcpy(mpk.pubKey, pubKey, sizeof(mpk.pubKey));
+	boost::shared_ptr<PubKeyChain> chain(new PubKeyChain(mpk, SEQUENCE_EXTERNAL_CHAIN));
+
+	return [chain](size_t iterations) {
+		for (size_t i = 0; i < iterations; i += 100)
+			Benchmark::DoNotOptimize(chain->DeriveAddresses(0, std::min<size_t>(iterations - i, 100)));
+	};
+}
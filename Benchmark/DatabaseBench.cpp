@@ -0,0 +1,108 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+#include "DatabaseManager.h"
+#include "SDK/Transaction/Transaction.h"
+#include "SDK/Plugin/Block/MerkleBlock.h"
+#include "Utils.h"
+
+using namespace Elastos::ElaWallet;
+
+#define BENCHMARK_ISO "ela"
+// merkle blocks saved together, as WalletManager::saveBlocks does after a sync batch
+#define BENCHMARK_BLOCK_BATCH 100
+#define BENCHMARK_STORED_ROWS 2000
+
+namespace {
+	boost::shared_ptr<DatabaseManager> freshDatabase(const std::string &name) {
+		boost::filesystem::path path = boost::filesystem::temp_directory_path() / ("spvsdk_bench_" + name + ".db");
+		boost::filesystem::remove(path);
+		return boost::shared_ptr<DatabaseManager>(new DatabaseManager(path));
+	}
+
+	std::vector<MerkleBlockEntity> blockEntities(size_t count) {
+		MerkleBlock block(fixtureMerkleBlock(), true);
+		ByteStream stream;
+		block.Serialize(stream);
+
+		std::vector<MerkleBlockEntity> entities;
+		MerkleBlockEntity entity;
+		entity.blockBytes = stream.getBuffer();
+		for (size_t i = 0; i < count; ++i) {
+			entity.blockHeight = (uint32_t) i;
+			entities.push_back(entity);
+		}
+		return entities;
+	}
+
+	TransactionEntity transactionEntity(uint32_t nonce) {
+		Transaction tx(fixtureTransaction());
+		tx.getRaw()->lockTime = nonce;
+		ByteStream stream;
+		tx.Serialize(stream);
+		return TransactionEntity(stream.getBuffer(), 1, 1536000000, "", Utils::UInt256ToString(tx.getHash()));
+	}
+}
+
+SPV_BENCHMARK(DatabaseManager, PutMerkleBlocks) {
+	seedFixtures();
+	boost::shared_ptr<DatabaseManager> db = freshDatabase("put_blocks");
+	boost::shared_ptr<std::vector<MerkleBlockEntity> > blocks(
+			new std::vector<MerkleBlockEntity>(blockEntities(BENCHMARK_BLOCK_BATCH)));
+
+	// one iteration saves a whole batch
+	return [db, blocks](size_t iterations) {
+		db->deleteAllBlocks(BENCHMARK_ISO);
+		for (size_t i = 0; i < iterations; ++i)
+			db->putMerkleBlocks(BENCHMARK_ISO, *blocks);
+	};
+}
+
+SPV_BENCHMARK(DatabaseManager, GetAllMerkleBlocks) {
+	seedFixtures();
+	boost::shared_ptr<DatabaseManager> db = freshDatabase("get_blocks");
+	db->putMerkleBlocks(BENCHMARK_ISO, blockEntities(BENCHMARK_STORED_ROWS));
+
+	return [db](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(db->getAllMerkleBlocks(BENCHMARK_ISO).size());
+	};
+}
+
+SPV_BENCHMARK(DatabaseManager, PutTransaction) {
+	seedFixtures();
+	boost::shared_ptr<DatabaseManager> db = freshDatabase("put_tx");
+	boost::shared_ptr<TransactionEntity> tx(new TransactionEntity(transactionEntity(0)));
+
+	// every iteration inserts a new row, a hash seen before would be an update
+	return [db, tx](size_t iterations) {
+		db->deleteAllTransactions(BENCHMARK_ISO);
+		for (size_t i = 0; i < iterations; ++i) {
+			Benchmark::PauseTiming();
+			UInt256 hash = UINT256_ZERO;
+			hash.u64[0] = i;
+			tx->txHash = Utils::UInt256ToString(hash);
+			Benchmark::ResumeTiming();
+
+			db->putTransaction(BENCHMARK_ISO, *tx);
+		}
+	};
+}
+
+SPV_BENCHMARK(DatabaseManager, GetAllTransactions) {
+	seedFixtures();
+	boost::shared_ptr<DatabaseManager> db = freshDatabase("get_tx");
+	for (uint32_t i = 0; i < BENCHMARK_STORED_ROWS; ++i)
+		db->putTransaction(BENCHMARK_ISO, transactionEntity(i));
+
+	return [db](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(db->getAllTransactions(BENCHMARK_ISO).size());
+	};
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_BENCHMARK_FIXTURES_H__
+#define __ELASTOS_SDK_BENCHMARK_FIXTURES_H__
+
+#include <cstdlib>
+
+#include "BRMerkleBlock.h"
+#include "BRTransaction.h"
+#include "CMemBlock.h"
+#include "AuxPow.h"
+#include "ELAMerkleBlock.h"
+#include "ELATransaction.h"
+#include "ELATxOutput.h"
+#include "SDK/Transaction/TransactionOutput.h"
+
+// every setup reseeds, so a benchmark sees the same data whatever ran before it
+#define BENCHMARK_SEED 20180901
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		static void seedFixtures() {
+			srand(BENCHMARK_SEED);
+		}
+
+		static UInt256 fixtureUInt256() {
+			UInt256 u;
+			for (size_t i = 0; i < sizeof(u.u32) / sizeof(u.u32[0]); ++i)
+				u.u32[i] = (uint32_t) rand();
+			return u;
+		}
+
+		static UInt168 fixtureUInt168() {
+			UInt168 u;
+			for (size_t i = 0; i < sizeof(u.u8); ++i)
+				u.u8[i] = (uint8_t) rand();
+			return u;
+		}
+
+		static CMBlock fixtureBytes(size_t size) {
+			CMBlock block(size);
+			for (size_t i = 0; i < size; ++i)
+				block[i] = (uint8_t) rand();
+			return block;
+		}
+
+		// a transfer with the shape of a typical wallet transaction: 2 inputs, 2 outputs, 1 attribute, 2 programs
+		static ELATransaction *fixtureTransaction(size_t inputs = 2, size_t outputs = 2) {
+			ELATransaction *tx = ELATransactionNew();
+
+			tx->raw.version = 0;
+			for (size_t i = 0; i < inputs; ++i) {
+				CMBlock script = fixtureBytes(25);
+				CMBlock signature = fixtureBytes(65);
+				BRTransactionAddInput(&tx->raw, fixtureUInt256(), (uint16_t) rand(), (uint64_t) rand(),
+									  script, script.GetSize(), signature, signature.GetSize(), (uint32_t) rand());
+			}
+
+			for (size_t i = 0; i < outputs; ++i) {
+				ELATxOutput *o = ELATxOutputNew();
+				o->assetId = fixtureUInt256();
+				o->programHash = fixtureUInt168();
+				o->raw.amount = (uint64_t) rand();
+				tx->outputs.push_back(new TransactionOutput(o));
+			}
+
+			tx->type = ELATransaction::TransferAsset;
+			delete tx->payload;
+			tx->payload = ELAPayloadNew(tx->type);
+
+			tx->attributes.push_back(new Attribute(Attribute::Nonce, fixtureBytes(10)));
+			for (size_t i = 0; i < inputs; ++i)
+				tx->programs.push_back(new Program(fixtureBytes(35), fixtureBytes(65)));
+
+			return tx;
+		}
+
+		static BRMerkleBlock *fixtureBtcHeader() {
+			BRMerkleBlock *block = BRMerkleBlockNew(nullptr);
+			block->blockHash = fixtureUInt256();
+			block->version = (uint32_t) rand();
+			block->prevBlock = fixtureUInt256();
+			block->merkleRoot = fixtureUInt256();
+			block->timestamp = (uint32_t) rand();
+			block->target = (uint32_t) rand();
+			block->nonce = (uint32_t) rand();
+			return block;
+		}
+
+		static AuxPow fixtureAuxPow() {
+			AuxPow auxPow;
+
+			std::vector<UInt256> hashes(6);
+			for (size_t i = 0; i < hashes.size(); ++i)
+				hashes[i] = fixtureUInt256();
+			auxPow.setAuxMerkleBranch(hashes);
+			for (size_t i = 0; i < hashes.size(); ++i)
+				hashes[i] = fixtureUInt256();
+			auxPow.setCoinBaseMerkle(hashes);
+			auxPow.setAuxMerkleIndex(3);
+			auxPow.setParMerkleIndex(5);
+			auxPow.setParentHash(fixtureUInt256());
+
+			BRTransaction *coinBase = BRTransactionNew();
+			coinBase->version = 1;
+			CMBlock script = fixtureBytes(80);
+			BRTransactionAddInput(coinBase, UINT256_ZERO, 0xffffffff, 0, script, script.GetSize(), nullptr, 0,
+								  0xffffffff);
+			for (size_t i = 0; i < 2; ++i) {
+				CMBlock outScript = fixtureBytes(25);
+				BRTransactionAddOutput(coinBase, (uint64_t) rand(), outScript, outScript.GetSize());
+			}
+			auxPow.setBTCTransaction(coinBase);
+			auxPow.setParBlockHeader(fixtureBtcHeader());
+
+			return auxPow;
+		}
+
+		// a filtered block with hashesCount matched hashes, as received during sync
+		static ELAMerkleBlock *fixtureMerkleBlock(size_t hashesCount = 16) {
+			ELAMerkleBlock *block = ELAMerkleBlockNew();
+
+			block->raw.version = 0;
+			block->raw.prevBlock = fixtureUInt256();
+			block->raw.timestamp = 1536000000;
+			block->raw.target = 0x1d00ffff;
+			block->raw.nonce = (uint32_t) rand();
+			block->raw.height = 100000;
+			block->raw.totalTx = (uint32_t) hashesCount;
+
+			UInt256 hashes[hashesCount];
+			for (size_t i = 0; i < hashesCount; ++i)
+				hashes[i] = fixtureUInt256();
+			CMBlock flags(hashesCount / 8 + 1);
+			for (size_t i = 0; i < flags.GetSize(); ++i)
+				flags[i] = 0xff;
+			BRMerkleBlockSetTxHashes(&block->raw, hashes, hashesCount, flags, flags.GetSize());
+			block->raw.merkleRoot = fixtureUInt256();
+
+			block->auxPow = fixtureAuxPow();
+			return block;
+		}
+
+	}
+}
+
+#endif //__ELASTOS_SDK_BENCHMARK_FIXTURES_H__
@@ -0,0 +1,61 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "Benchmark.h"
+#include "Log.h"
+
+using namespace Elastos::ElaWallet;
+
+static void usage(const char *name) {
+	std::cerr << "usage: " << name << " [--list] [--filter <substring>] [--samples <n>] [--min-time <ms>]"
+			  << " [--out <file.json>]" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+	Benchmark::Options options;
+	std::string out;
+
+	for (int i = 1; i < argc; ++i) {
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--list") == 0) {
+			std::vector<std::string> names = Benchmark::List();
+			for (size_t j = 0; j < names.size(); ++j)
+				std::cout << names[j] << std::endl;
+			return 0;
+		} else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+			options.Filter = argv[++i];
+		} else if (strcmp(argv[i], "--samples") == 0 && hasValue) {
+			options.Samples = strtoul(argv[++i], nullptr, 10);
+		} else if (strcmp(argv[i], "--min-time") == 0 && hasValue) {
+			options.MinSampleMs = strtoul(argv[++i], nullptr, 10);
+		} else if (strcmp(argv[i], "--out") == 0 && hasValue) {
+			out = argv[++i];
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	// wallet and database code logs on every call, which would be measured too
+	Log::setLevel(spdlog::level::off);
+
+	nlohmann::json report = Benchmark::Run(options);
+	if (out.empty()) {
+		std::cout << report.dump(4) << std::endl;
+	} else {
+		std::ofstream file(out.c_str());
+		file << report.dump(4) << std::endl;
+		if (!file) {
+			std::cerr << "Can not write " << out << std::endl;
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,364 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/shared_ptr.hpp>
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+#include "BRBase58.h"
+#include "BRHex.h"
+#include "ByteStream.h"
+#include "Utils.h"
+#include "JsonWriter.h"
+#include "SDK/Transaction/Transaction.h"
+#include "SDK/Wrapper/Program.h"
+#include "SDK/Plugin/Block/MerkleBlock.h"
+
+using namespace Elastos::ElaWallet;
+
+SPV_BENCHMARK(ByteStream, PutIntegers) {
+	return [](size_t iterations) {
+		ByteStream stream;
+		for (size_t i = 0; i < iterations; ++i) {
+			stream.setPosition(0);
+			for (uint32_t j = 0; j < 16; ++j) {
+				stream.putUint32(j);
+				stream.putUint64(j);
+				stream.putVarUint(j << 12);
+			}
+		}
+		Benchmark::DoNotOptimize(stream.position());
+	};
+}
+
+SPV_BENCHMARK(ByteStream, GetIntegers) {
+	boost::shared_ptr<ByteStream> stream(new ByteStream());
+	for (uint32_t j = 0; j < 16; ++j) {
+		stream->putUint32(j);
+		stream->putUint64(j);
+		stream->putVarUint(j << 12);
+	}
+
+	return [stream](size_t iterations) {
+		uint64_t sum = 0;
+		for (size_t i = 0; i < iterations; ++i) {
+			stream->setPosition(0);
+			for (uint32_t j = 0; j < 16; ++j) {
+				sum += stream->getUint32();
+				sum += stream->getUint64();
+				sum += stream->getVarUint();
+			}
+		}
+		Benchmark::DoNotOptimize(sum);
+	};
+}
+
+SPV_BENCHMARK(ByteStream, PutBytes) {
+	boost::shared_ptr<CMBlock> data(new CMBlock(fixtureBytes(1024)));
+
+	return [data](size_t iterations) {
+		ByteStream stream;
+		for (size_t i = 0; i < iterations; ++i) {
+			stream.setPosition(0);
+			stream.putVarUint(data->GetSize());
+			stream.putBytes(*data, data->GetSize());
+		}
+		Benchmark::DoNotOptimize(stream.position());
+	};
+}
+
+SPV_BENCHMARK(Transaction, Serialize) {
+	seedFixtures();
+	boost::shared_ptr<Transaction> tx(new Transaction(fixtureTransaction()));
+
+	return [tx](size_t iterations) {
+		ByteStream stream;
+		for (size_t i = 0; i < iterations; ++i) {
+			stream.setPosition(0);
+			tx->Serialize(stream);
+		}
+		Benchmark::DoNotOptimize(stream.position());
+	};
+}
+
+SPV_BENCHMARK(Transaction, Deserialize) {
+	seedFixtures();
+	Transaction tx(fixtureTransaction());
+	ByteStream stream;
+	tx.Serialize(stream);
+	boost::shared_ptr<CMBlock> bytes(new CMBlock(stream.getBuffer()));
+
+	return [bytes](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i) {
+			ByteStream in(*bytes, bytes->GetSize(), false);
+			Transaction decoded;
+			decoded.Deserialize(in);
+			Benchmark::DoNotOptimize(decoded.getRaw());
+		}
+	};
+}
+
+// transactions read back by one WalletManager::getTransactions() call
+#define BENCHMARK_LOAD_BATCH 1000
+
+SPV_BENCHMARK(Transaction, BulkLoad) {
+	seedFixtures();
+	boost::shared_ptr<std::vector<CMBlock> > rows(new std::vector<CMBlock>());
+	for (size_t i = 0; i < BENCHMARK_LOAD_BATCH; ++i) {
+		Transaction tx(fixtureTransaction());
+		ByteStream stream;
+		tx.Serialize(stream);
+		rows->push_back(stream.getBuffer());
+	}
+
+	// reserves the pools up front and trims them afterwards, keeping one transaction in ten as a filter would
+	return [rows](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i) {
+			ObjectPool<ELATransaction>::Instance().Reserve(rows->size());
+			ObjectPool<Transaction>::Instance().Reserve(rows->size());
+			ObjectPool<TransactionOutput>::Instance().Reserve(2 * rows->size());
+			ObjectPool<ELATxOutput>::Instance().Reserve(2 * rows->size());
+			ObjectPool<Program>::Instance().Reserve(rows->size());
+
+			std::vector<TransactionPtr> kept;
+			for (size_t j = 0; j < rows->size(); ++j) {
+				TransactionPtr tx(new Transaction());
+				ByteStream in((*rows)[j], (*rows)[j].GetSize(), false);
+				tx->Deserialize(in);
+				if (j % 10 == 0)
+					kept.push_back(tx);
+			}
+
+			ObjectPool<ELATransaction>::Instance().Trim();
+			ObjectPool<Transaction>::Instance().Trim();
+			ObjectPool<TransactionOutput>::Instance().Trim();
+			ObjectPool<ELATxOutput>::Instance().Trim();
+			ObjectPool<Program>::Instance().Trim();
+			Benchmark::DoNotOptimize(kept.size());
+		}
+	};
+}
+
+SPV_BENCHMARK(Transaction, GetHash) {
+	seedFixtures();
+	boost::shared_ptr<Transaction> tx(new Transaction(fixtureTransaction()));
+
+	return [tx](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i) {
+			// getHash() caches the hash in the raw transaction
+			tx->getRaw()->txHash = UINT256_ZERO;
+			Benchmark::DoNotOptimize(tx->getHash());
+		}
+	};
+}
+
+SPV_BENCHMARK(Transaction, ToJsonDump) {
+	seedFixtures();
+	boost::shared_ptr<Transaction> tx(new Transaction(fixtureTransaction()));
+
+	return [tx](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(tx->toJson().dump());
+	};
+}
+
+SPV_BENCHMARK(Transaction, WriteJson) {
+	seedFixtures();
+	boost::shared_ptr<Transaction> tx(new Transaction(fixtureTransaction()));
+
+	return [tx](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i) {
+			std::string out;
+			JsonWriter writer(out);
+			tx->writeJson(writer);
+			Benchmark::DoNotOptimize(out);
+		}
+	};
+}
+
+SPV_BENCHMARK(MerkleBlock, IsValid) {
+	seedFixtures();
+	boost::shared_ptr<MerkleBlock> block(new MerkleBlock(fixtureMerkleBlock(), true));
+
+	return [block](size_t iterations) {
+		bool valid = false;
+		for (size_t i = 0; i < iterations; ++i)
+			valid ^= block->isValid(1536000000);
+		Benchmark::DoNotOptimize(valid);
+	};
+}
+
+SPV_BENCHMARK(MerkleBlock, Deserialize) {
+	seedFixtures();
+	MerkleBlock block(fixtureMerkleBlock(), true);
+	ByteStream stream;
+	block.Serialize(stream);
+	boost::shared_ptr<CMBlock> bytes(new CMBlock(stream.getBuffer()));
+
+	return [bytes](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i) {
+			ByteStream in(*bytes, bytes->GetSize(), false);
+			MerkleBlock decoded;
+			decoded.Deserialize(in);
+			Benchmark::DoNotOptimize(decoded.getRaw());
+		}
+	};
+}
+
+SPV_BENCHMARK(AuxPow, Deserialize) {
+	seedFixtures();
+	AuxPow auxPow = fixtureAuxPow();
+	ByteStream stream;
+	auxPow.Serialize(stream);
+	boost::shared_ptr<CMBlock> bytes(new CMBlock(stream.getBuffer()));
+
+	return [bytes](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i) {
+			ByteStream in(*bytes, bytes->GetSize(), false);
+			AuxPow decoded;
+			decoded.Deserialize(in);
+			Benchmark::DoNotOptimize(decoded.getParentHash());
+		}
+	};
+}
+
+namespace {
+	// program hashes of standard addresses, as the ones formatted for every address and transaction listing
+	std::vector<UInt168> fixtureProgramHashes(size_t count) {
+		seedFixtures();
+		std::vector<UInt168> programHashes(count);
+		for (size_t i = 0; i < count; ++i) {
+			programHashes[i] = fixtureUInt168();
+			programHashes[i].u8[0] = ELA_STAND_ADDRESS;
+		}
+		return programHashes;
+	}
+}
+
+SPV_BENCHMARK(Base58, EncodeAddress) {
+	std::vector<UInt168> programHashes = fixtureProgramHashes(64);
+
+	return [programHashes](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(Utils::UInt168ToAddress(programHashes[i % programHashes.size()]));
+	};
+}
+
+SPV_BENCHMARK(Base58, DecodeAddress) {
+	std::vector<std::string> addresses = Utils::UInt168ToAddresses(fixtureProgramHashes(64));
+
+	return [addresses](size_t iterations) {
+		UInt168 programHash;
+		for (size_t i = 0; i < iterations; ++i)
+			Utils::UInt168FromAddress(programHash, addresses[i % addresses.size()]);
+		Benchmark::DoNotOptimize(programHash);
+	};
+}
+
+// iterations count addresses, converted 64 at a time
+SPV_BENCHMARK(Base58, EncodeAddressBatch) {
+	std::vector<UInt168> programHashes = fixtureProgramHashes(64);
+
+	return [programHashes](size_t iterations) {
+		for (size_t i = 0; i < iterations; i += programHashes.size())
+			Benchmark::DoNotOptimize(Utils::UInt168ToAddresses(programHashes));
+	};
+}
+
+SPV_BENCHMARK(Base58, DecodeAddressBatch) {
+	std::vector<std::string> addresses = Utils::UInt168ToAddresses(fixtureProgramHashes(64));
+
+	return [addresses](size_t iterations) {
+		for (size_t i = 0; i < iterations; i += addresses.size())
+			Benchmark::DoNotOptimize(Utils::UInt168FromAddresses(addresses));
+	};
+}
+
+SPV_BENCHMARK(Base58, EncodeKey) {
+	seedFixtures();
+	CMBlock key = fixtureBytes(64);
+
+	return [key](size_t iterations) {
+		char str[128];
+		for (size_t i = 0; i < iterations; ++i)
+			BRBase58Encode(str, sizeof(str), key, key.GetSize());
+		Benchmark::DoNotOptimize(str);
+	};
+}
+
+SPV_BENCHMARK(Hex, UInt256ToString) {
+	seedFixtures();
+	UInt256 hash = fixtureUInt256();
+
+	return [hash](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(Utils::UInt256ToString(hash, true));
+	};
+}
+
+SPV_BENCHMARK(Hex, EncodeUInt256) {
+	seedFixtures();
+	UInt256 hash = fixtureUInt256();
+
+	return [hash](size_t iterations) {
+		char hex[65];
+		for (size_t i = 0; i < iterations; ++i)
+			BRHexEncode(hex, sizeof(hex), hash.u8, sizeof(hash.u8), 1);
+		Benchmark::DoNotOptimize(hex);
+	};
+}
+
+// bytes per iteration of a serialized transaction, as written to the debug log and the database
+SPV_BENCHMARK(Hex, EncodeTransaction) {
+	seedFixtures();
+	CMBlock bytes = fixtureBytes(1024);
+
+	return [bytes](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(Utils::encodeHex(bytes));
+	};
+}
+
+SPV_BENCHMARK(Hex, DecodeTransaction) {
+	seedFixtures();
+	std::string hex = Utils::encodeHex(fixtureBytes(1024));
+
+	return [hex](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(Utils::decodeHex(hex));
+	};
+}
+
+// txid filter of SubWallet::GetAllTransaction(), one transaction hash checked per iteration
+SPV_BENCHMARK(Hex, MatchTxIdDecode) {
+	seedFixtures();
+	std::vector<UInt256> hashes(64);
+	for (size_t i = 0; i < hashes.size(); ++i)
+		hashes[i] = fixtureUInt256();
+	std::string txid = Utils::UInt256ToString(fixtureUInt256(), true);
+
+	return [hashes, txid](size_t iterations) {
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i) {
+			UInt256 hash = Utils::UInt256FromString(txid, true);
+			matches += UInt256Eq(&hash, &hashes[i % hashes.size()]);
+		}
+		Benchmark::DoNotOptimize(matches);
+	};
+}
+
+SPV_BENCHMARK(Hex, MatchTxId) {
+	seedFixtures();
+	std::vector<UInt256> hashes(64);
+	for (size_t i = 0; i < hashes.size(); ++i)
+		hashes[i] = fixtureUInt256();
+	std::string txid = Utils::UInt256ToString(fixtureUInt256(), true);
+
+	return [hashes, txid](size_t iterations) {
+		size_t matches = 0;
+		for (size_t i = 0; i < iterations; ++i)
+			matches += Utils::UInt256EqualsString(hashes[i % hashes.size()], txid, true);
+		Benchmark::DoNotOptimize(matches);
+	};
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <vector>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+#include "BRSet.h"
+#include "BRWallet.h"
+
+using namespace Elastos::ElaWallet;
+
+// about the transactions and spent outputs of a busy wallet, and the block headers of a long chain
+#define BENCHMARK_SET_ITEMS 1000000
+
+namespace {
+	// the same txids and outpoints for the callback set of BRSetNew() and the keyed ones, so their timings compare
+	struct SetFixture {
+		SetFixture() :
+				TxHashes(BENCHMARK_SET_ITEMS),
+				Outputs(BENCHMARK_SET_ITEMS),
+				Order(BENCHMARK_SET_ITEMS) {
+			seedFixtures();
+			for (size_t i = 0; i < BENCHMARK_SET_ITEMS; ++i) {
+				TxHashes[i] = fixtureUInt256();
+				// a few outputs per transaction
+				Outputs[i].hash = TxHashes[i / 4];
+				Outputs[i].n = (uint32_t) (i % 4);
+				Order[i] = i;
+			}
+			std::random_shuffle(Order.begin(), Order.end(), [](size_t n) { return (size_t) rand() % n; });
+		}
+
+		std::vector<UInt256> TxHashes;
+		std::vector<BRUTXO> Outputs;
+		// lookups in random order, as the hashes arrive from peers
+		std::vector<size_t> Order;
+	};
+
+	struct SetDeleter {
+		void operator()(BRSet *set) const {
+			BRSetFree(set);
+		}
+	};
+
+	BRSet *newUInt256Set(bool keyed, size_t capacity) {
+		return keyed ? BRSetNewUInt256(capacity) : BRSetNew(BRTransactionHash, BRTransactionEq, capacity);
+	}
+
+	BRSet *newUTXOSet(bool keyed, size_t capacity) {
+		return keyed ? BRSetNewUTXO(capacity) : BRSetNew(BRUTXOHash, BRUTXOEq, capacity);
+	}
+
+	template<class T>
+	Benchmark::Loop lookup(bool keyed, std::vector<T> SetFixture::*items, BRSet *(*newSet)(bool, size_t)) {
+		boost::shared_ptr<SetFixture> fixture(new SetFixture());
+		boost::shared_ptr<BRSet> set(newSet(keyed, BENCHMARK_SET_ITEMS), SetDeleter());
+		std::vector<T> &all = (*fixture).*items;
+		for (size_t i = 0; i < all.size(); ++i)
+			BRSetAdd(set.get(), &all[i]);
+
+		return [fixture, set, items](size_t iterations) {
+			const std::vector<T> &all = (*fixture).*items;
+			size_t found = 0;
+			for (size_t i = 0; i < iterations; ++i)
+				found += BRSetContains(set.get(), &all[fixture->Order[i % BENCHMARK_SET_ITEMS]]);
+			Benchmark::DoNotOptimize(found);
+		};
+	}
+
+	// one insert per iteration, starting over with a small set every BENCHMARK_SET_ITEMS so growth is included
+	template<class T>
+	Benchmark::Loop insert(bool keyed, std::vector<T> SetFixture::*items, BRSet *(*newSet)(bool, size_t)) {
+		boost::shared_ptr<SetFixture> fixture(new SetFixture());
+
+		return [fixture, keyed, items, newSet](size_t iterations) {
+			std::vector<T> &all = (*fixture).*items;
+			BRSet *set = newSet(keyed, 100);
+			for (size_t i = 0; i < iterations; ++i) {
+				if (i > 0 && i % BENCHMARK_SET_ITEMS == 0) {
+					BRSetFree(set);
+					set = newSet(keyed, 100);
+				}
+				BRSetAdd(set, &all[i % BENCHMARK_SET_ITEMS]);
+			}
+			Benchmark::DoNotOptimize(BRSetCount(set));
+			BRSetFree(set);
+		};
+	}
+}
+
+SPV_BENCHMARK(Set, LookupTxHash) {
+	return lookup(false, &SetFixture::TxHashes, newUInt256Set);
+}
+
+SPV_BENCHMARK(Set, LookupTxHashKeyed) {
+	return lookup(true, &SetFixture::TxHashes, newUInt256Set);
+}
+
+SPV_BENCHMARK(Set, LookupUTXO) {
+	return lookup(false, &SetFixture::Outputs, newUTXOSet);
+}
+
+SPV_BENCHMARK(Set, LookupUTXOKeyed) {
+	return lookup(true, &SetFixture::Outputs, newUTXOSet);
+}
+
+SPV_BENCHMARK(Set, InsertTxHash) {
+	return insert(false, &SetFixture::TxHashes, newUInt256Set);
+}
+
+SPV_BENCHMARK(Set, InsertTxHashKeyed) {
+	return insert(true, &SetFixture::TxHashes, newUInt256Set);
+}
+
+SPV_BENCHMARK(Set, InsertUTXO) {
+	return insert(false, &SetFixture::Outputs, newUTXOSet);
+}
+
+SPV_BENCHMARK(Set, InsertUTXOKeyed) {
+	return insert(true, &SetFixture::Outputs, newUTXOSet);
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/shared_ptr.hpp>
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+#include "BRBIP39Mnemonic.h"
+#include "Key.h"
+#include "MasterPubKey.h"
+#include "SingleAddressWallet.h"
+
+using namespace Elastos::ElaWallet;
+
+// UTXOs of the wallet spent by CreateTransaction
+#define BENCHMARK_WALLET_UTXOS 500
+// transactions registered into one wallet before it is rebuilt
+#define BENCHMARK_REGISTER_BATCH 50
+
+namespace {
+	class NullListener : public Wallet::Listener {
+	public:
+		virtual void balanceChanged(uint64_t balance) {
+		}
+
+		virtual void onTxAdded(const TransactionPtr &transaction) {
+		}
+
+		virtual void onTxUpdated(const std::string &hash, uint32_t blockHeight, uint32_t timeStamp) {
+		}
+
+		virtual void onTxDeleted(const std::string &hash, bool notifyUser, bool recommendRescan) {
+		}
+	};
+
+	MasterPubKeyPtr masterPubKey() {
+		UInt512 seed;
+		BRBIP39DeriveKey(seed.u8, "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon "
+			"abandon about", "");
+
+		UInt256 chainCode = UINT256_ZERO;
+		Key key;
+		key.deriveKeyAndChain(chainCode, &seed, sizeof(seed), 3, 44, 0, 0);
+		return MasterPubKeyPtr(new MasterPubKey(*key.getRaw(), chainCode));
+	}
+
+	boost::shared_ptr<Wallet> createWallet(const SharedWrapperList<Transaction, BRTransaction *> &transactions,
+										   const MasterPubKeyPtr &pubKey = masterPubKey()) {
+		return boost::shared_ptr<Wallet>(new SingleAddressWallet(transactions, pubKey,
+																 boost::shared_ptr<Wallet::Listener>(new NullListener)));
+	}
+
+	// a confirmed transaction paying amount to address, unique by nonce
+	ELATransaction *payment(const std::string &address, uint64_t amount, uint32_t nonce) {
+		ELATransaction *tx = ELATransactionNew();
+		TransactionOutput *output = new TransactionOutput();
+		output->setAmount(amount);
+		output->setAddress(address);
+		output->setAssetId(Key::getSystemAssetId());
+		tx->outputs.push_back(output);
+		tx->raw.lockTime = nonce;
+		tx->raw.blockHeight = 1;
+		tx->raw.timestamp = 1536000000;
+		tx->programs.push_back(new Program(fixtureBytes(35), fixtureBytes(65)));
+		return tx;
+	}
+
+	std::string walletAddress() {
+		SharedWrapperList<Transaction, BRTransaction *> none;
+		return createWallet(none)->getAllAddresses()[0];
+	}
+}
+
+SPV_BENCHMARK(Wallet, RegisterTransaction) {
+	seedFixtures();
+	std::string address = walletAddress();
+	MasterPubKeyPtr pubKey = masterPubKey();
+
+	// only registering is timed; the wallet is rebuilt with BENCHMARK_WALLET_UTXOS transactions every
+	// BENCHMARK_REGISTER_BATCH registrations, so samples of any iteration count see the same wallet sizes
+	return [address, pubKey](size_t iterations) {
+		boost::shared_ptr<Wallet> wallet;
+		Benchmark::PauseTiming();
+		for (size_t i = 0; i < iterations; ++i) {
+			if (i % BENCHMARK_REGISTER_BATCH == 0) {
+				SharedWrapperList<Transaction, BRTransaction *> transactions;
+				for (uint32_t n = 0; n < BENCHMARK_WALLET_UTXOS; ++n) {
+					TransactionPtr tx(new Transaction(payment(address, 100000000, n)));
+					tx->getHash();
+					transactions.push_back(tx);
+				}
+				wallet = createWallet(transactions, pubKey);
+			}
+
+			TransactionPtr tx(new Transaction(payment(address, 100000000, BENCHMARK_WALLET_UTXOS + (uint32_t) i)));
+			tx->getHash();
+
+			Benchmark::ResumeTiming();
+			Benchmark::DoNotOptimize(wallet->registerTransaction(tx));
+			Benchmark::PauseTiming();
+		}
+		wallet.reset();
+		Benchmark::ResumeTiming();
+	};
+}
+
+SPV_BENCHMARK(Wallet, CreateTxForOutputs) {
+	seedFixtures();
+	std::string address = walletAddress();
+
+	SharedWrapperList<Transaction, BRTransaction *> transactions;
+	for (uint32_t i = 0; i < BENCHMARK_WALLET_UTXOS; ++i) {
+		TransactionPtr tx(new Transaction(payment(address, 100000000, i)));
+		tx->getHash();
+		transactions.push_back(tx);
+	}
+	boost::shared_ptr<Wallet> wallet = createWallet(transactions);
+
+	// spends about half of the UTXOs, plus change
+	return [wallet, address](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(wallet->createTransaction("", 10000, 250ULL * 100000000, address, "", ""));
+	};
+}
+
+SPV_BENCHMARK(Wallet, GetBalanceWithAddress) {
+	seedFixtures();
+	std::string address = walletAddress();
+
+	SharedWrapperList<Transaction, BRTransaction *> transactions;
+	for (uint32_t i = 0; i < BENCHMARK_WALLET_UTXOS; ++i) {
+		TransactionPtr tx(new Transaction(payment(address, 100000000, i)));
+		tx->getHash();
+		transactions.push_back(tx);
+	}
+	boost::shared_ptr<Wallet> wallet = createWallet(transactions);
+
+	return [wallet, address](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(wallet->GetBalanceWithAddress(address));
+	};
+}
+
+SPV_BENCHMARK(Wallet, ContainsAddress) {
+	seedFixtures();
+	std::string address = walletAddress();
+	boost::shared_ptr<Wallet> wallet = createWallet(SharedWrapperList<Transaction, BRTransaction *>());
+
+	return [wallet, address](size_t iterations) {
+		for (size_t i = 0; i < iterations; ++i)
+			Benchmark::DoNotOptimize(wallet->containsAddress(address));
+	};
+}
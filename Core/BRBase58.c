@@ -32,112 +32,152 @@
 
 // base58 and base58check encoding: https://en.bitcoin.it/wiki/Base58Check_encoding
 
-// returns the number of characters written to str including NULL terminator, or total strLen needed if str is NULL
-size_t BRBase58Encode(char *str, size_t strLen, const uint8_t *data, size_t dataLen)
+// the big number conversions work on 32bit limbs instead of single digits, 4 bytes or 5 base58 digits at a time
+#define BASE58_LIMB 656356768 // 58^5, the largest power of 58 below 2^32
+
+static const char _base58Chars[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+// value of each base58 digit, or -1 for any other character
+static const int8_t _base58Values[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8, -1, -1, -1, -1, -1, -1,
+    -1,  9, 10, 11, 12, 13, 14, 15, 16, -1, 17, 18, 19, 20, 21, -1,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, -1, -1, -1, -1, -1,
+    -1, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, -1, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+// writes the base58 digits of the big endian number in data to digits, most significant first without leading zeroes,
+// and returns the number of digits written. digits must hold dataLen*138/100 + 5 bytes
+// inlined, so calls with a constant dataLen get loops of fixed length
+inline static size_t _BRBase58Digits(uint8_t *digits, const uint8_t *data, size_t dataLen)
 {
-    static const char chars[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-    size_t i, j, len, zcount = 0;
-    
-    assert(data != NULL);
-    while (zcount < dataLen && data && data[zcount] == 0) zcount++; // count leading zeroes
+    uint32_t limbs[dataLen*138/500 + 2]; // base 58^5, least significant first
+    uint64_t carry, t;
+    size_t i = 0, j, k, n = 0, len = 0;
 
-    uint8_t buf[(dataLen - zcount)*138/100 + 1]; // log(256)/log(58), rounded up
-    
-    memset(buf, 0, sizeof(buf));
-
-    for (i = zcount; data && i < dataLen; i++) {
-        uint32_t carry = data[i];
-        
-        for (j = sizeof(buf); j > 0; j--) {
-            carry += (uint32_t)buf[j - 1] << 8;
-            buf[j - 1] = carry % 58;
-            carry /= 58;
+    while (i < dataLen) {
+        k = (i == 0 && dataLen % 4 != 0) ? dataLen % 4 : 4; // bytes of this chunk, a partial chunk goes first
+        carry = 0;
+        for (j = 0; j < k; j++) carry = (carry << 8) | data[i++];
+
+        for (j = 0; j < n; j++) { // limbs = limbs*256^k + chunk
+            t = ((uint64_t)limbs[j] << (8*k)) + carry;
+            limbs[j] = (uint32_t)(t % BASE58_LIMB);
+            carry = t / BASE58_LIMB;
         }
 
-        var_clean(&carry);
+        while (carry > 0) {
+            limbs[n++] = (uint32_t)(carry % BASE58_LIMB);
+            carry /= BASE58_LIMB;
+        }
     }
 
-    i = 0;
-    while (i < sizeof(buf) && buf[i] == 0) i++; // skip leading zeroes
-    len = (zcount + sizeof(buf) - i) + 1;
+    while (n > 0) {
+        uint32_t limb = limbs[--n];
+
+        for (j = 5; j > 0; j--) {
+            digits[len + j - 1] = limb % 58;
+            limb /= 58;
+        }
+
+        len += 5;
+    }
+
+    for (i = 0; i < len && digits[i] == 0; i++); // skip leading zeroes
+    if (i > 0) memmove(digits, &digits[i], len - i);
+    mem_clean(limbs, sizeof(limbs));
+    var_clean(&carry, &t);
+    return len - i;
+}
+
+inline static size_t _BRBase58Encode(char *str, size_t strLen, const uint8_t *data, size_t dataLen)
+{
+    size_t i, n, len, zcount = 0;
+
+    assert(data != NULL);
+    while (zcount < dataLen && data && data[zcount] == 0) zcount++; // count leading zeroes
+
+    uint8_t digits[dataLen*138/100 + 5]; // log(256)/log(58), rounded up, and a partial limb
+
+    n = _BRBase58Digits(digits, data, dataLen);
+    len = zcount + n + 1;
 
     if (str && len <= strLen) {
-//        while (zcount-- > 0) *(str++) = chars[0]; bitcoin address string is 1 begin ,ela is not
-        while (i < sizeof(buf)) *(str++) = chars[buf[i++]];
+//        while (zcount-- > 0) *(str++) = _base58Chars[0]; bitcoin address string is 1 begin ,ela is not
+        for (i = 0; i < n; i++) *(str++) = _base58Chars[digits[i]];
         *str = '\0';
     }
-    
-    mem_clean(buf, sizeof(buf));
+
+    mem_clean(digits, sizeof(digits));
     return (! str || len <= strLen) ? len : 0;
 }
 
+// returns the number of characters written to str including NULL terminator, or total strLen needed if str is NULL
+size_t BRBase58Encode(char *str, size_t strLen, const uint8_t *data, size_t dataLen)
+{
+    return _BRBase58Encode(str, strLen, data, dataLen);
+}
+
 // returns the number of bytes written to data, or total dataLen needed if data is NULL
 size_t BRBase58Decode(uint8_t *data, size_t dataLen, const char *str)
 {
-    size_t i = 0, j, len, zcount = 0;
-    
+    size_t i = 0, j, k, n = 0, len, digitCount = 0, zcount = 0;
+    uint64_t carry, t, mul;
+
     assert(str != NULL);
     while (str && *str == '1') str++, zcount++; // count leading zeroes
-    
-    uint8_t buf[(str) ? strlen(str)*733/1000 + 1 : 0]; // log(58)/log(256), rounded up
-    
-    memset(buf, 0, sizeof(buf));
-    
-    while (str && *str) {
-        uint32_t carry = *(const uint8_t *)(str++);
-        
-        switch (carry) {
-            case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
-                carry -= '1';
-                break;
-                
-            case 'A': case 'B': case 'C': case 'D': case 'E': case 'F': case 'G': case 'H':
-                carry += 9 - 'A';
-                break;
-                
-            case 'J': case 'K': case 'L': case 'M': case 'N':
-                carry += 17 - 'J';
-                break;
-                
-            case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V': case 'W': case 'X': case 'Y':
-            case 'Z':
-                carry += 22 - 'P';
-                break;
-                
-            case 'a': case 'b': case 'c': case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j':
-            case 'k':
-                carry += 33 - 'a';
-                break;
-                
-            case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v':
-            case 'w': case 'x': case 'y': case 'z':
-                carry += 44 - 'm';
-                break;
-                
-            default:
-                carry = UINT32_MAX;
+    while (str && _base58Values[(uint8_t)str[digitCount]] >= 0) digitCount++; // decoding stops at an invalid digit
+
+    uint32_t limbs[digitCount*733/4000 + 2]; // log(58)/log(256), rounded up, base 2^32, least significant first
+
+    while (i < digitCount) {
+        k = (i == 0 && digitCount % 5 != 0) ? digitCount % 5 : 5; // digits of this chunk, a partial chunk goes first
+        carry = 0, mul = 1;
+
+        for (j = 0; j < k; j++) {
+            carry = carry*58 + (uint64_t)_base58Values[(uint8_t)str[i++]];
+            mul *= 58;
         }
-        
-        if (carry >= 58) break; // invalid base58 digit
-        
-        for (j = sizeof(buf); j > 0; j--) {
-            carry += (uint32_t)buf[j - 1]*58;
-            buf[j - 1] = carry & 0xff;
-            carry >>= 8;
+
+        for (j = 0; j < n; j++) { // limbs = limbs*58^k + chunk
+            t = (uint64_t)limbs[j]*mul + carry;
+            limbs[j] = (uint32_t)t;
+            carry = t >> 32;
+        }
+
+        while (carry > 0) {
+            limbs[n++] = (uint32_t)carry;
+            carry >>= 32;
         }
-        
-        var_clean(&carry);
     }
-    
-    while (i < sizeof(buf) && buf[i] == 0) i++; // skip leading zeroes
-    len = zcount + sizeof(buf) - i;
+
+    k = 0; // bytes of the most significant limb
+    if (n > 0) for (k = 4; ((limbs[n - 1] >> (8*(k - 1))) & 0xff) == 0; k--);
+    len = zcount + ((n > 0) ? (n - 1)*4 + k : 0);
 
     if (data && len <= dataLen) {
+        uint8_t *d = &data[zcount];
+
         if (zcount > 0) memset(data, 0, zcount);
-        memcpy(&data[zcount], &buf[i], sizeof(buf) - i);
+
+        for (i = n; i > 0; i--) {
+            for (j = (i == n) ? k : 4; j > 0; j--) *(d++) = (uint8_t)(limbs[i - 1] >> (8*(j - 1)));
+        }
     }
 
-    mem_clean(buf, sizeof(buf));
+    mem_clean(limbs, sizeof(limbs));
+    var_clean(&carry, &t);
     return (! data || len <= dataLen) ? len : 0;
 }
 
@@ -153,7 +193,8 @@ size_t BRBase58CheckEncode(char *str, size_t strLen, const uint8_t *data, size_t
     if (data || dataLen == 0) {
         memcpy(buf, data, dataLen);
         BRSHA256_2(&buf[dataLen], data, dataLen);
-        len = BRBase58Encode(str, strLen, buf, dataLen + 4);
+        // addresses and program hashes get the conversion specialized for their length
+        len = (dataLen == 21) ? _BRBase58Encode(str, strLen, buf, 21 + 4) : _BRBase58Encode(str, strLen, buf, dataLen + 4);
     }
     
     mem_clean(buf, bufLen);
@@ -183,3 +224,40 @@ size_t BRBase58CheckDecode(uint8_t *data, size_t dataLen, const char *str)
     if (buf != _buf) free(buf);
     return (! data || len <= dataLen) ? len : 0;
 }
+
+// base58check encodes count items of itemLen bytes each, stored back to back at data, into NULL terminated strings stored
+// strLen characters apart at str, and returns the number of items encoded, which is less than count if one did not fit
+size_t BRBase58CheckEncodeBatch(char *str, size_t strLen, const uint8_t *data, size_t itemLen, size_t count)
+{
+    size_t i;
+
+    assert(str != NULL);
+    assert(data != NULL || count == 0);
+
+    for (i = 0; i < count; i++) {
+        if (BRBase58CheckEncode(&str[i*strLen], strLen, &data[i*itemLen], itemLen) == 0) break;
+    }
+
+    return i;
+}
+
+// decodes count base58check strings into items of dataLen bytes each, stored back to back at data, and returns the
+// number of strings that decoded to exactly dataLen bytes. valid[i] is set to whether string i did, the items of the
+// other strings are zero filled. valid may be NULL
+size_t BRBase58CheckDecodeBatch(uint8_t *data, size_t dataLen, int valid[], const char *const strs[], size_t count)
+{
+    size_t i, r = 0;
+    int ok;
+
+    assert(data != NULL || count == 0);
+    assert(strs != NULL || count == 0);
+
+    for (i = 0; i < count; i++) {
+        ok = (BRBase58CheckDecode(&data[i*dataLen], dataLen, strs[i]) == dataLen);
+        if (! ok) memset(&data[i*dataLen], 0, dataLen);
+        if (valid) valid[i] = ok;
+        if (ok) r++;
+    }
+
+    return r;
+}
@@ -47,6 +47,15 @@ size_t BRBase58CheckEncode(char *str, size_t strLen, const uint8_t *data, size_t
 // returns the number of bytes written to data, or total dataLen needed if data is NULL
 size_t BRBase58CheckDecode(uint8_t *data, size_t dataLen, const char *str);
 
+// base58check encodes count items of itemLen bytes each, stored back to back at data, into NULL terminated strings stored
+// strLen characters apart at str, and returns the number of items encoded, which is less than count if one did not fit
+size_t BRBase58CheckEncodeBatch(char *str, size_t strLen, const uint8_t *data, size_t itemLen, size_t count);
+
+// decodes count base58check strings into items of dataLen bytes each, stored back to back at data, and returns the
+// number of strings that decoded to exactly dataLen bytes. valid[i] is set to whether string i did, the items of the
+// other strings are zero filled. valid may be NULL
+size_t BRBase58CheckDecodeBatch(uint8_t *data, size_t dataLen, int valid[], const char *const strs[], size_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define BR_SHA256_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 // endian swapping
 #if __BIG_ENDIAN__ || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
@@ -110,19 +117,24 @@ void BRSHA1(void *md20, const void *data, size_t len)
 #define s2(x) (ror32((x), 7) ^ ror32((x), 18) ^ ((x) >> 3))
 #define s3(x) (ror32((x), 17) ^ ror32((x), 19) ^ ((x) >> 10))
 
-static void _BRSHA256Compress(uint32_t *r, const uint32_t *x)
+static const uint32_t _sha256K[] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t _sha256IV[] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static void _BRSHA256CompressPortable(uint32_t *r, const uint32_t *x)
 {
-    static const uint32_t k[] = {
-        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-    };
-
+    const uint32_t *k = _sha256K;
     int i;
     uint32_t a = r[0], b = r[1], c = r[2], d = r[3], e = r[4], f = r[5], g = r[6], h = r[7], t1, t2, w[64];
 
@@ -140,10 +152,173 @@ static void _BRSHA256Compress(uint32_t *r, const uint32_t *x)
     mem_clean(w, sizeof(w));
 }
 
+#if BR_SHA256_X86
+
+// sha-256 compression using the x86 sha extensions (sha-ni)
+__attribute__((target("sha,sse4.1")))
+static void _BRSHA256CompressSHANI(uint32_t *r, const uint32_t *x)
+{
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1, abef, cdgh, msg, tmp, m[4];
+    int i;
+
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&r[0]), 0xb1); // cdab
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&r[4]), 0x1b); // efgh
+    state0 = _mm_alignr_epi8(tmp, state1, 8); // abef
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0); // cdgh
+    abef = state0, cdgh = state1;
+
+    for (i = 0; i < 16; i++) {
+        if (i < 4) m[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&x[i*4]), mask);
+        else {
+            tmp = _mm_add_epi32(_mm_sha256msg1_epu32(m[i & 3], m[(i + 1) & 3]),
+                                _mm_alignr_epi8(m[(i + 3) & 3], m[(i + 2) & 3], 4));
+            m[i & 3] = _mm_sha256msg2_epu32(tmp, m[(i + 3) & 3]);
+        }
+
+        msg = _mm_add_epi32(m[i & 3], _mm_loadu_si128((const __m128i *)&_sha256K[i*4]));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+    }
+
+    state0 = _mm_add_epi32(state0, abef);
+    state1 = _mm_add_epi32(state1, cdgh);
+    tmp = _mm_shuffle_epi32(state0, 0x1b); // feba
+    state1 = _mm_shuffle_epi32(state1, 0xb1); // dchg
+    _mm_storeu_si128((__m128i *)&r[0], _mm_blend_epi16(tmp, state1, 0xf0)); // dcba
+    _mm_storeu_si128((__m128i *)&r[4], _mm_alignr_epi8(state1, tmp, 8)); // hgfe
+}
+
+#define ror32x8(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define xor3x8(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+
+// eight independent sha-256 compressions, one per 32bit lane, w holds the big endian message words
+__attribute__((target("avx2")))
+static void _BRSHA256CompressAVX2x8(__m256i *r, __m256i *w)
+{
+    __m256i a = r[0], b = r[1], c = r[2], d = r[3], e = r[4], f = r[5], g = r[6], h = r[7], t1, t2;
+    int i;
+
+    for (i = 16; i < 64; i++) {
+        t1 = xor3x8(ror32x8(w[i - 2], 17), ror32x8(w[i - 2], 19), _mm256_srli_epi32(w[i - 2], 10));
+        t2 = xor3x8(ror32x8(w[i - 15], 7), ror32x8(w[i - 15], 18), _mm256_srli_epi32(w[i - 15], 3));
+        w[i] = _mm256_add_epi32(_mm256_add_epi32(t1, w[i - 7]), _mm256_add_epi32(t2, w[i - 16]));
+    }
+
+    for (i = 0; i < 64; i++) {
+        t1 = _mm256_add_epi32(h, xor3x8(ror32x8(e, 6), ror32x8(e, 11), ror32x8(e, 25)));
+        t1 = _mm256_add_epi32(t1, _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g)));
+        t1 = _mm256_add_epi32(t1, _mm256_add_epi32(_mm256_set1_epi32((int)_sha256K[i]), w[i]));
+        t2 = _mm256_add_epi32(xor3x8(ror32x8(a, 2), ror32x8(a, 13), ror32x8(a, 22)),
+                              xor3x8(_mm256_and_si256(a, b), _mm256_and_si256(a, c), _mm256_and_si256(b, c)));
+        h = g, g = f, f = e, e = _mm256_add_epi32(d, t1), d = c, c = b, b = a, a = _mm256_add_epi32(t1, t2);
+    }
+
+    r[0] = _mm256_add_epi32(r[0], a), r[1] = _mm256_add_epi32(r[1], b);
+    r[2] = _mm256_add_epi32(r[2], c), r[3] = _mm256_add_epi32(r[3], d);
+    r[4] = _mm256_add_epi32(r[4], e), r[5] = _mm256_add_epi32(r[5], f);
+    r[6] = _mm256_add_epi32(r[6], g), r[7] = _mm256_add_epi32(r[7], h);
+}
+
+// double-sha-256 of eight 64 byte messages read from data64 before any of the eight digests is written to md32
+__attribute__((target("avx2")))
+static void _BRSHA256_2x64AVX2x8(uint8_t *md32, const uint8_t *data64)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+                                            0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m256i r[8], h[8], w[64];
+    uint32_t out[8][8];
+    int i, j;
+
+    for (i = 0; i < 16; i++) {
+        uint32_t v[8];
+
+        for (j = 0; j < 8; j++) memcpy(&v[j], data64 + j*64 + i*4, sizeof(uint32_t));
+        w[i] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)v), bswap);
+    }
+
+    for (i = 0; i < 8; i++) r[i] = _mm256_set1_epi32((int)_sha256IV[i]);
+    _BRSHA256CompressAVX2x8(r, w); // message block
+    for (i = 0; i < 16; i++) w[i] = _mm256_set1_epi32((i == 0) ? (int)0x80000000 : (i == 15) ? 512 : 0);
+    _BRSHA256CompressAVX2x8(r, w); // padding block
+
+    for (i = 0; i < 8; i++) w[i] = r[i], h[i] = _mm256_set1_epi32((int)_sha256IV[i]);
+    for (i = 8; i < 16; i++) w[i] = _mm256_set1_epi32((i == 8) ? (int)0x80000000 : (i == 15) ? 256 : 0);
+    _BRSHA256CompressAVX2x8(h, w); // second hash over the 32 byte digest
+
+    for (i = 0; i < 8; i++) _mm256_storeu_si256((__m256i *)out[i], _mm256_shuffle_epi8(h[i], bswap));
+    for (j = 0; j < 8; j++) {
+        for (i = 0; i < 8; i++) memcpy(md32 + j*32 + i*4, &out[i][j], sizeof(uint32_t));
+    }
+}
+
+#endif // BR_SHA256_X86
+
+static BRSHA256Impl _sha256Impl = BRSHA256ImplPortable; // accessed atomically, BRSHA256SetImpl() may race a hash
+static pthread_once_t _sha256Once = PTHREAD_ONCE_INIT;
+
+static int _BRSHA256ImplSupported(BRSHA256Impl impl)
+{
+#if BR_SHA256_X86
+    unsigned a = 0, b = 0, c = 0, d = 0, c1 = 0, b7 = 0;
+    uint32_t xcr0 = 0;
+
+    if (__get_cpuid(1, &a, &b, &c1, &d) && __get_cpuid_count(7, 0, &a, &b7, &c, &d)) {
+        if (c1 & bit_OSXSAVE) {
+            __asm__ ("xgetbv" : "=a" (xcr0) : "c" (0) : "%edx");
+        }
+
+        switch (impl) {
+            case BRSHA256ImplSHANI: return (b7 & bit_SHA) && (c1 & bit_SSE4_1) && (c1 & bit_SSSE3);
+            case BRSHA256ImplAVX2: return (b7 & bit_AVX2) && (xcr0 & 0x6) == 0x6;
+            default: break;
+        }
+    }
+#endif
+    return (impl == BRSHA256ImplPortable);
+}
+
+static void _BRSHA256UseImpl(BRSHA256Impl impl)
+{
+    __atomic_store_n(&_sha256Impl, impl, __ATOMIC_RELAXED);
+}
+
+// a hash looks its kernel up once, so a concurrent BRSHA256SetImpl() never switches it halfway through
+static void (*_BRSHA256CompressOf(BRSHA256Impl impl))(uint32_t *r, const uint32_t *x)
+{
+#if BR_SHA256_X86
+    if (impl == BRSHA256ImplSHANI) return _BRSHA256CompressSHANI;
+#endif
+    return _BRSHA256CompressPortable;
+}
+
+static void _BRSHA256SelectImpl(void)
+{
+    if (_BRSHA256ImplSupported(BRSHA256ImplSHANI)) _BRSHA256UseImpl(BRSHA256ImplSHANI);
+    else if (_BRSHA256ImplSupported(BRSHA256ImplAVX2)) _BRSHA256UseImpl(BRSHA256ImplAVX2);
+}
+
+// returns the sha-256 kernel selected at runtime from the cpu features
+BRSHA256Impl BRSHA256GetImpl(void)
+{
+    pthread_once(&_sha256Once, _BRSHA256SelectImpl);
+    return __atomic_load_n(&_sha256Impl, __ATOMIC_RELAXED);
+}
+
+// overrides the runtime selection (for testing and benchmarking), returns false if the cpu lacks support
+int BRSHA256SetImpl(BRSHA256Impl impl)
+{
+    if (! _BRSHA256ImplSupported(impl)) return 0;
+    pthread_once(&_sha256Once, _BRSHA256SelectImpl);
+    _BRSHA256UseImpl(impl);
+    return 1;
+}
+
 void BRSHA224(void *md28, const void *data, size_t len) {
     size_t i;
     uint32_t x[16], buf[] = { 0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939, 0xffc00b31, 0x68581511,
                               0x64f98fa7, 0xbefa4fa4 }; // initial buffer values
+    void (*compress)(uint32_t *, const uint32_t *) = _BRSHA256CompressOf(BRSHA256GetImpl());
 
     assert(md28 != NULL);
     assert(data != NULL || len == 0);
@@ -151,14 +326,14 @@ void BRSHA224(void *md28, const void *data, size_t len) {
     for (i = 0; i < len; i += 64) { // process data in 64 byte blocks
         memcpy(x, (const uint8_t *)data + i, (i + 64 < len) ? 64 : len - i);
         if (i + 64 > len) break;
-        _BRSHA256Compress(buf, x);
+        compress(buf, x);
     }
 
     memset((uint8_t *)x + (len - i), 0, 64 - (len - i)); // clear remainder of x
     ((uint8_t *)x)[len - i] = 0x80; // append padding
-    if (len - i >= 56) _BRSHA256Compress(buf, x), memset(x, 0, 64); // length goes to next block
+    if (len - i >= 56) compress(buf, x), memset(x, 0, 64); // length goes to next block
     x[14] = be32((uint32_t)(len >> 29)), x[15] = be32((uint32_t)(len << 3)); // append length in bits
-    _BRSHA256Compress(buf, x); // finalize
+    compress(buf, x); // finalize
     for (i = 0; i < 7; i++) buf[i] = be32(buf[i]); // endian swap
     memcpy(md28, buf, 28); // write to md
     mem_clean(x, sizeof(x));
@@ -170,6 +345,7 @@ void BRSHA256(void *md32, const void *data, size_t len)
     size_t i;
     uint32_t x[16], buf[] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c,
                               0x1f83d9ab, 0x5be0cd19 }; // initial buffer values
+    void (*compress)(uint32_t *, const uint32_t *) = _BRSHA256CompressOf(BRSHA256GetImpl());
 
     assert(md32 != NULL);
     assert(data != NULL || len == 0);
@@ -177,14 +353,14 @@ void BRSHA256(void *md32, const void *data, size_t len)
     for (i = 0; i < len; i += 64) { // process data in 64 byte blocks
         memcpy(x, (const uint8_t *)data + i, (i + 64 < len) ? 64 : len - i);
         if (i + 64 > len) break;
-        _BRSHA256Compress(buf, x);
+        compress(buf, x);
     }
 
     memset((uint8_t *)x + (len - i), 0, 64 - (len - i)); // clear remainder of x
     ((uint8_t *)x)[len - i] = 0x80; // append padding
-    if (len - i >= 56) _BRSHA256Compress(buf, x), memset(x, 0, 64); // length goes to next block
+    if (len - i >= 56) compress(buf, x), memset(x, 0, 64); // length goes to next block
     x[14] = be32((uint32_t)(len >> 29)), x[15] = be32((uint32_t)(len << 3)); // append length in bits
-    _BRSHA256Compress(buf, x); // finalize
+    compress(buf, x); // finalize
     for (i = 0; i < 8; i++) buf[i] = be32(buf[i]); // endian swap
     memcpy(md32, buf, 32); // write to md
     mem_clean(x, sizeof(x));
@@ -202,6 +378,44 @@ void BRSHA256_2(void *md32, const void *data, size_t len)
     BRSHA256(md32, t, sizeof(t));
 }
 
+// double-sha-256 of count independent 64 byte messages, such as the concatenated child hashes of a merkle tree level
+// the digest of data64[i*64] is written to md32[i*32], and md32 may equal data64 to reduce a tree level in place
+void BRSHA256_2x64(void *md32, const void *data64, size_t count)
+{
+    static const uint8_t pad64[64] = { 0x80, [62] = 0x02 }, pad32[32] = { 0x80, [30] = 0x01 }; // padding and length
+    const uint8_t *in = data64;
+    uint8_t *out = md32;
+    uint32_t x[16], buf[8];
+    BRSHA256Impl impl = BRSHA256GetImpl();
+    void (*compress)(uint32_t *, const uint32_t *) = _BRSHA256CompressOf(impl);
+    size_t i = 0, j;
+
+    assert(md32 != NULL || count == 0);
+    assert(data64 != NULL || count == 0);
+#if BR_SHA256_X86
+    if (impl == BRSHA256ImplAVX2) {
+        for (; i + 8 <= count; i += 8) _BRSHA256_2x64AVX2x8(&out[i*32], &in[i*64]);
+    }
+#endif
+
+    for (; i < count; i++) {
+        memcpy(x, &in[i*64], sizeof(x));
+        memcpy(buf, _sha256IV, sizeof(buf));
+        compress(buf, x);
+        memcpy(x, pad64, sizeof(x));
+        compress(buf, x); // first digest
+        for (j = 0; j < 8; j++) x[j] = be32(buf[j]);
+        memcpy(&x[8], pad32, sizeof(pad32));
+        memcpy(buf, _sha256IV, sizeof(buf));
+        compress(buf, x); // second hash over the 32 byte digest
+        for (j = 0; j < 8; j++) buf[j] = be32(buf[j]);
+        memcpy(&out[i*32], buf, sizeof(buf));
+    }
+
+    mem_clean(x, sizeof(x));
+    mem_clean(buf, sizeof(buf));
+}
+
 // bitwise right rotation
 #define ror64(a, b) (((a) >> (b)) | ((a) << (64 - (b))))
 
@@ -44,6 +44,22 @@ void BRSHA224(void *md28, const void *data, size_t len);
 // double-sha-256 = sha-256(sha-256(x))
 void BRSHA256_2(void *md32, const void *data, size_t len);
 
+// double-sha-256 of count independent 64 byte messages (e.g. merkle tree nodes), md32 may equal data64
+void BRSHA256_2x64(void *md32, const void *data64, size_t count);
+
+// sha-256 kernels, the fastest one supported by the cpu is selected at runtime
+typedef enum {
+    BRSHA256ImplPortable = 0,
+    BRSHA256ImplAVX2, // 8-way multi-buffer, used by BRSHA256_2x64
+    BRSHA256ImplSHANI // x86 sha extensions
+} BRSHA256Impl;
+
+BRSHA256Impl BRSHA256GetImpl(void);
+
+// overrides the runtime selection (for testing and benchmarking), returns false if the cpu lacks support
+// hashes running on other threads finish with the kernel they started with
+int BRSHA256SetImpl(BRSHA256Impl impl);
+
 void BRSHA384(void *md48, const void *data, size_t len);
 
 void BRSHA512(void *md64, const void *data, size_t len);
@@ -0,0 +1,192 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "BRHex.h"
+#include <string.h>
+#include <assert.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define HEX_BLOCK 16 // bytes converted at a time, 2*HEX_BLOCK characters
+
+static const char _hexDigits[] = "0123456789abcdef";
+
+// value of a hex digit of either case, or -1
+static inline int _hexValue(uint8_t c)
+{
+    if ((uint8_t)(c - '0') < 10) return c - '0';
+    c |= 0x20;
+    if ((uint8_t)(c - 'a') < 6) return c - 'a' + 10;
+    return -1;
+}
+
+#if defined(__SSE2__)
+
+static inline __m128i _reverse16(__m128i x)
+{
+    x = _mm_shuffle_epi32(x, _MM_SHUFFLE(0, 1, 2, 3));
+    x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+// nibbles 0-15 to '0'-'9', 'a'-'f'
+static inline __m128i _digits16(__m128i n)
+{
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+
+    return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), letters);
+}
+
+// '0'-'9', 'a'-'f', 'A'-'F' to 0-15, clears *valid for any other character. bytes from 0x80 up compare negative
+static inline __m128i _values16(__m128i c, int *valid)
+{
+    __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                     _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+    if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff) *valid = 0;
+    return _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+                        _mm_and_si128(isLetter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+static inline void _BRHexEncodeBlock(char *str, const uint8_t *data, int reverse)
+{
+    __m128i x = _mm_loadu_si128((const __m128i *)data), mask = _mm_set1_epi8(0x0f), hi, lo;
+
+    if (reverse) x = _reverse16(x);
+    hi = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+    lo = _mm_and_si128(x, mask);
+    _mm_storeu_si128((__m128i *)str, _digits16(_mm_unpacklo_epi8(hi, lo)));
+    _mm_storeu_si128((__m128i *)(str + HEX_BLOCK), _digits16(_mm_unpackhi_epi8(hi, lo)));
+}
+
+static inline int _BRHexDecodeBlock(uint8_t *data, const char *str, int reverse)
+{
+    int valid = 1;
+    __m128i a = _values16(_mm_loadu_si128((const __m128i *)str), &valid),
+            b = _values16(_mm_loadu_si128((const __m128i *)(str + HEX_BLOCK)), &valid),
+            low = _mm_set1_epi16(0x00ff), x;
+
+    // each 16 bit lane holds the high nibble in its low byte and the low nibble in its high byte
+    a = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(a, low), 4), _mm_srli_epi16(a, 8));
+    b = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b, low), 4), _mm_srli_epi16(b, 8));
+    x = _mm_packus_epi16(a, b);
+    if (reverse) x = _reverse16(x);
+    if (valid) _mm_storeu_si128((__m128i *)data, x);
+    return valid;
+}
+
+#else
+
+static inline void _BRHexEncodeBlock(char *str, const uint8_t *data, int reverse)
+{
+    for (size_t i = 0; i < HEX_BLOCK; i++) {
+        uint8_t b = data[reverse ? HEX_BLOCK - 1 - i : i];
+
+        str[2*i] = _hexDigits[b >> 4];
+        str[2*i + 1] = _hexDigits[b & 0x0f];
+    }
+}
+
+static inline int _BRHexDecodeBlock(uint8_t *data, const char *str, int reverse)
+{
+    uint8_t block[HEX_BLOCK];
+    int hi, lo, bad = 0;
+
+    for (size_t i = 0; i < HEX_BLOCK; i++) {
+        hi = _hexValue((uint8_t)str[2*i]);
+        lo = _hexValue((uint8_t)str[2*i + 1]);
+        bad |= hi | lo; // negative if either is invalid
+        block[reverse ? HEX_BLOCK - 1 - i : i] = (uint8_t)(((hi & 0x0f) << 4) | (lo & 0x0f));
+    }
+
+    if (bad < 0) return 0;
+    memcpy(data, block, HEX_BLOCK);
+    return 1;
+}
+
+#endif
+
+size_t BRHexEncode(char *str, size_t strLen, const uint8_t *data, size_t dataLen, int reverse)
+{
+    size_t i = 0;
+
+    assert(data != NULL || dataLen == 0);
+    if (! str) return 2*dataLen + 1;
+    if (strLen < 2*dataLen + 1) return 0;
+
+    // the source of output byte i is data[i], or data[dataLen - 1 - i] when reversed
+    for (; i + HEX_BLOCK <= dataLen; i += HEX_BLOCK) {
+        _BRHexEncodeBlock(&str[2*i], reverse ? &data[dataLen - i - HEX_BLOCK] : &data[i], reverse);
+    }
+
+    for (; i < dataLen; i++) {
+        uint8_t b = data[reverse ? dataLen - 1 - i : i];
+
+        str[2*i] = _hexDigits[b >> 4];
+        str[2*i + 1] = _hexDigits[b & 0x0f];
+    }
+
+    str[2*dataLen] = '\0';
+    return 2*dataLen + 1;
+}
+
+const char *BRHexString(char *str, size_t strLen, const uint8_t *data, size_t dataLen, int reverse)
+{
+    assert(str != NULL);
+    assert(strLen >= 2*dataLen + 1);
+    BRHexEncode(str, strLen, data, dataLen, reverse);
+    return str;
+}
+
+int BRHexDecode(uint8_t *data, size_t dataLen, const char *str, size_t strLen, int reverse)
+{
+    size_t i = 0, len = strLen/2;
+    int hi, lo;
+
+    assert(str != NULL || strLen == 0);
+    if (strLen % 2 != 0 || len > dataLen) return 0;
+    assert(data != NULL || len == 0);
+
+    for (; i + HEX_BLOCK <= len; i += HEX_BLOCK) {
+        if (! _BRHexDecodeBlock(reverse ? &data[len - i - HEX_BLOCK] : &data[i], &str[2*i], reverse)) return 0;
+    }
+
+    for (; i < len; i++) {
+        hi = _hexValue((uint8_t)str[2*i]);
+        lo = _hexValue((uint8_t)str[2*i + 1]);
+        if (hi < 0 || lo < 0) return 0;
+        data[reverse ? len - 1 - i : i] = (uint8_t)((hi << 4) | lo);
+    }
+
+    return 1;
+}
+
+int BRHexEq(const char *str, size_t strLen, const uint8_t *data, size_t dataLen, int reverse)
+{
+    uint8_t block[HEX_BLOCK];
+    size_t i = 0;
+    int hi, lo;
+
+    assert(str != NULL || strLen == 0);
+    assert(data != NULL || dataLen == 0);
+    if (strLen != 2*dataLen) return 0;
+
+    for (; i + HEX_BLOCK <= dataLen; i += HEX_BLOCK) {
+        if (! _BRHexDecodeBlock(block, &str[2*i], reverse)) return 0;
+        if (memcmp(block, reverse ? &data[dataLen - i - HEX_BLOCK] : &data[i], HEX_BLOCK) != 0) return 0;
+    }
+
+    for (; i < dataLen; i++) {
+        hi = _hexValue((uint8_t)str[2*i]);
+        lo = _hexValue((uint8_t)str[2*i + 1]);
+        if (hi < 0 || lo < 0 || data[reverse ? dataLen - 1 - i : i] != (uint8_t)((hi << 4) | lo)) return 0;
+    }
+
+    return 1;
+}
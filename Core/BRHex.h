@@ -0,0 +1,36 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BRHex_h
+#define BRHex_h
+
+#include <stddef.h>
+#include <inttypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// hex encoding into caller buffers, 16 bytes at a time with SSE2. reverse takes the bytes of data from last to first,
+// the order txids and block hashes are shown in
+
+// writes lowercase hex of data to str, returns the number of characters written to str including NULL terminator, or
+// total strLen needed if str is NULL
+size_t BRHexEncode(char *str, size_t strLen, const uint8_t *data, size_t dataLen, int reverse);
+
+// BRHexEncode() returning str, for hex in an expression such as a log argument. str must have room for 2*dataLen + 1
+const char *BRHexString(char *str, size_t strLen, const uint8_t *data, size_t dataLen, int reverse);
+
+// decodes the strLen characters of hex at str, either case, to the first strLen/2 bytes of data. returns true on
+// success, false if strLen is odd, strLen/2 is more than dataLen or a character is not a hex digit
+int BRHexDecode(uint8_t *data, size_t dataLen, const char *str, size_t strLen, int reverse);
+
+// true if the strLen characters of hex at str, either case, are the dataLen bytes of data, nothing is allocated
+int BRHexEq(const char *str, size_t strLen, const uint8_t *data, size_t dataLen, int reverse);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BRHex_h
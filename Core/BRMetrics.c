@@ -0,0 +1,85 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "BRMetrics.h"
+#include <string.h>
+#include <assert.h>
+#include <sys/time.h>
+
+#define RATE_WINDOW_US 1000000
+
+static uint64_t _counters[BRMetricCounterCount];
+static uint64_t _gauges[BRMetricGaugeCount]; // double bit patterns
+static uint64_t _rateWindowStart, _rateWindowBlocks;
+
+static uint64_t _doubleBits(double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static double _bitsDouble(uint64_t bits)
+{
+    double value;
+
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static uint64_t _nowUs(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec*1000000 + tv.tv_usec;
+}
+
+void BRMetricAdd(BRMetricCounter counter, uint64_t delta)
+{
+    assert(counter < BRMetricCounterCount);
+    __atomic_fetch_add(&_counters[counter], delta, __ATOMIC_RELAXED);
+}
+
+uint64_t BRMetricGet(BRMetricCounter counter)
+{
+    assert(counter < BRMetricCounterCount);
+    return __atomic_load_n(&_counters[counter], __ATOMIC_RELAXED);
+}
+
+void BRMetricSet(BRMetricGauge gauge, double value)
+{
+    assert(gauge < BRMetricGaugeCount);
+    __atomic_store_n(&_gauges[gauge], _doubleBits(value), __ATOMIC_RELAXED);
+}
+
+double BRMetricGaugeGet(BRMetricGauge gauge)
+{
+    assert(gauge < BRMetricGaugeCount);
+
+    // no block closed the window for a while, the last rate is stale
+    if (gauge == BRMetricBlocksPerSecond &&
+        _nowUs() - __atomic_load_n(&_rateWindowStart, __ATOMIC_RELAXED) >= 2*RATE_WINDOW_US) return 0;
+
+    return _bitsDouble(__atomic_load_n(&_gauges[gauge], __ATOMIC_RELAXED));
+}
+
+void BRMetricBlockReceived(void)
+{
+    uint64_t now = _nowUs(), start = __atomic_load_n(&_rateWindowStart, __ATOMIC_RELAXED), blocks;
+
+    BRMetricAdd(BRMetricBlocksReceived, 1);
+    __atomic_fetch_add(&_rateWindowBlocks, 1, __ATOMIC_RELAXED);
+
+    if (start == 0) {
+        __atomic_compare_exchange_n(&_rateWindowStart, &start, now, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+    else if (now - start >= RATE_WINDOW_US &&
+             __atomic_compare_exchange_n(&_rateWindowStart, &start, now, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        // only the thread that closed the window publishes it
+        blocks = __atomic_exchange_n(&_rateWindowBlocks, 0, __ATOMIC_RELAXED);
+        BRMetricSet(BRMetricBlocksPerSecond, blocks*1000000.0/(now - start));
+    }
+}
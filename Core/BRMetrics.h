@@ -0,0 +1,45 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BRMetrics_h
+#define BRMetrics_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// process wide counters of the peer layer, updated lock free so they can be bumped from socket threads
+typedef enum {
+    BRMetricPeerConnects,
+    BRMetricPeerDisconnects,
+    BRMetricBytesReceived,
+    BRMetricBytesSent,
+    BRMetricBlocksReceived,
+    BRMetricCounterCount
+} BRMetricCounter;
+
+typedef enum {
+    BRMetricFalsePositiveRate,
+    BRMetricBlocksPerSecond,
+    BRMetricGaugeCount
+} BRMetricGauge;
+
+void BRMetricAdd(BRMetricCounter counter, uint64_t delta);
+
+uint64_t BRMetricGet(BRMetricCounter counter);
+
+void BRMetricSet(BRMetricGauge gauge, double value);
+
+double BRMetricGaugeGet(BRMetricGauge gauge);
+
+// counts a received block and refreshes BRMetricBlocksPerSecond about once a second
+void BRMetricBlockReceived(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BRMetrics_h
@@ -31,6 +31,7 @@
 #include "BRInt.h"
 #include "BRPeerMessages.h"
 #include "BRPeerManager.h"
+#include "BRMetrics.h"
 #include <stdlib.h>
 #include <float.h>
 #include <inttypes.h>
@@ -44,6 +45,12 @@
 #include <sys/time.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#if defined(__ANDROID__)
+#include <android/log.h>
+#endif
 
 #define HEADER_LENGTH      24
 #define MAX_MSG_LENGTH     0x02000000
@@ -226,7 +233,7 @@ static void *_peerThreadRoutine(void *arg)
 
             while (socket >= 0 && ! error && len < HEADER_LENGTH) {
                 n = read(socket, &header[len], sizeof(header) - len);
-                if (n > 0) len += n;
+                if (n > 0) len += n, BRMetricAdd(BRMetricBytesReceived, (uint64_t)n);
                 if (n == 0)
                     error = ECONNRESET;
                 if (n < 0 && errno != EWOULDBLOCK) {
@@ -283,7 +290,7 @@ static void *_peerThreadRoutine(void *arg)
                     while (socket >= 0 && ! error && len < msgLen) {
                         n = read(socket, &payload[len], msgLen - len);
                         //peer_log(peer, "read socket n %ld", n);
-                        if (n > 0) len += n;
+                        if (n > 0) len += n, BRMetricAdd(BRMetricBytesReceived, (uint64_t)n);
                         if (n == 0)
                             error = ECONNRESET;
                         if (n < 0 && errno != EWOULDBLOCK) {
@@ -374,7 +381,7 @@ BRPeer *BRPeerNew(uint32_t magicNumber)
     array_new(ctx->knownBlockHashes, 10);
     array_new(ctx->currentBlockTxHashes, 10);
     array_new(ctx->knownTxHashes, 10);
-    ctx->knownTxHashSet = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
+    ctx->knownTxHashSet = BRSetNewUInt256(10);
     array_new(ctx->pongInfo, 10);
     array_new(ctx->pongCallback, 10);
     ctx->pingTime = DBL_MAX;
@@ -531,6 +538,57 @@ const char *BRPeerHost(BRPeer *peer)
     return ctx->host;
 }
 
+static int _peerLogLevel = PEER_LOG_DEBUG;
+static void (*_peerLogHandler)(int level, const char *message) = NULL;
+
+int BRPeerLogEnabled(int level)
+{
+    return level >= __atomic_load_n(&_peerLogLevel, __ATOMIC_RELAXED);
+}
+
+void BRPeerSetLogLevel(int level)
+{
+    __atomic_store_n(&_peerLogLevel, level, __ATOMIC_RELAXED);
+}
+
+void BRPeerSetLogHandler(void (*handler)(int level, const char *message))
+{
+    __atomic_store_n(&_peerLogHandler, handler, __ATOMIC_RELEASE);
+}
+
+void BRPeerLog(int level, const char *format, ...)
+{
+    void (*handler)(int level, const char *message) = __atomic_load_n(&_peerLogHandler, __ATOMIC_ACQUIRE);
+    char buf[0x400], *message = buf;
+    va_list ap;
+    int len;
+
+    va_start(ap, format);
+    len = vsnprintf(buf, sizeof(buf), format, ap);
+    va_end(ap);
+
+    if (len >= (int)sizeof(buf)) { // long messages, like hex dumps, get a heap buffer
+        message = malloc((size_t)len + 1);
+        assert(message != NULL);
+        va_start(ap, format);
+        vsnprintf(message, (size_t)len + 1, format, ap);
+        va_end(ap);
+    }
+
+    if (len >= 0 && handler) {
+        handler(level, message);
+    }
+    else if (len >= 0) {
+#if defined(__ANDROID__)
+        __android_log_print(ANDROID_LOG_INFO, "spvsdk", "%s", message);
+#else
+        printf("%s\n", message);
+#endif
+    }
+
+    if (message != buf) free(message);
+}
+
 // connected peer version number
 uint32_t BRPeerVersion(BRPeer *peer)
 {
@@ -596,7 +654,7 @@ void BRPeerSendMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen, const ch
 
         while (socket >= 0 && ! error && msgLen < sizeof(buf)) {
             n = send(socket, &buf[msgLen], sizeof(buf) - msgLen, MSG_NOSIGNAL);
-            if (n >= 0) msgLen += n;
+            if (n >= 0) msgLen += n, BRMetricAdd(BRMetricBytesSent, (uint64_t)n);
             if (n < 0 && errno != EWOULDBLOCK) error = errno;
             gettimeofday(&tv, NULL);
 			if (! error && tv.tv_sec + (double)tv.tv_usec/1000000 >= ctx->disconnectTime) error = ETIMEDOUT;
@@ -32,28 +32,28 @@
 #include <stddef.h>
 #include <inttypes.h>
 
-#define peer_log(peer, ...) _peer_log("%s:%" PRIu16 " " _va_first(__VA_ARGS__, NULL) "\n", BRPeerHost(peer),\
-                                      (peer)->port _va_rest(__VA_ARGS__))
+// log levels of peer_log() and peer_dbg(), same values as the sdk log levels
+#define PEER_LOG_TRACE 0
+#define PEER_LOG_DEBUG 1
+#define PEER_LOG_INFO  2
+#define PEER_LOG_OFF   6
+
+#define peer_log(peer, ...) _peer_log_at(PEER_LOG_INFO, peer, __VA_ARGS__)
 #ifdef NDEBUG
 #define peer_dbg(...)
 #else
-#define peer_dbg(...) peer_log(__VA_ARGS__)
+#define peer_dbg(peer, ...) _peer_log_at(PEER_LOG_DEBUG, peer, __VA_ARGS__)
 #endif
 
+// arguments are only evaluated when the level is enabled, so hex dumps of filtered messages cost nothing
+#define _peer_log_at(level, peer, ...) do {\
+    if (BRPeerLogEnabled(level)) BRPeerLog(level, "%s:%" PRIu16 " " _va_first(__VA_ARGS__, NULL), BRPeerHost(peer),\
+                                           (peer)->port _va_rest(__VA_ARGS__));\
+} while (0)
+
 #define _va_first(first, ...) first
 #define _va_rest(first, ...) ,##__VA_ARGS__
 
-//#if defined(TARGET_OS_MAC)
-//#include <Foundation/Foundation.h>
-//#define _peer_log(...) NSLog(__VA_ARGS__)
-#if defined(__ANDROID__)
-#include <android/log.h>
-#define _peer_log(...) __android_log_print(ANDROID_LOG_INFO, "spvsdk", __VA_ARGS__)
-#else
-#include <stdio.h>
-#define _peer_log(...) printf(__VA_ARGS__)
-#endif
-
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -172,6 +172,20 @@ void BRPeerSetNeedsFilterUpdate(BRPeer *peer, int needsFilterUpdate);
 // display name of peer address
 const char *BRPeerHost(BRPeer *peer);
 
+// returns true if messages of the given level are logged, PEER_LOG_DEBUG by default
+int BRPeerLogEnabled(int level);
+
+void BRPeerSetLogLevel(int level);
+
+// handler receives every enabled message without trailing newline, NULL logs to stdout (logcat on android)
+void BRPeerSetLogHandler(void (*handler)(int level, const char *message));
+
+void BRPeerLog(int level, const char *format, ...)
+#if defined(__GNUC__)
+__attribute__((format(printf, 2, 3)))
+#endif
+;
+
 // connected peer version number
 uint32_t BRPeerVersion(BRPeer *peer);
 
@@ -30,6 +30,8 @@
 #include "BRPeerMessages.h"
 #include "BRMerkleBlock.h"
 #include "BRPeer.h"
+#include "BRMetrics.h"
+#include "BRTrace.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <inttypes.h>
@@ -159,6 +161,18 @@ int _BRBlockHeightEq(const void *block, const void *otherBlock)
     return (((const BRMerkleBlock *)block)->height == ((const BRMerkleBlock *)otherBlock)->height);
 }
 
+// returns the difficulty transition block BLOCK_DIFFICULTY_INTERVAL blocks before block, NULL if it isn't in blocks
+BRMerkleBlock *_BRPrevTransitionBlock(const BRSet *blocks, const BRMerkleBlock *block)
+{
+    const BRMerkleBlock *b = block;
+
+    for (uint32_t i = 0; b && i < BLOCK_DIFFICULTY_INTERVAL; i++) {
+        b = BRSetGet(blocks, &b->prevBlock);
+    }
+
+    return (BRMerkleBlock *)b;
+}
+
 static void _BRPeerManagerPeerMisbehavin(BRPeerManager *manager, BRPeer *peer)
 {
     for (size_t i = array_count(manager->peers); i > 0; i--) {
@@ -691,6 +705,7 @@ static void _peerConnected(void *info)
 {
     BRPeer *peer = ((BRPeerCallbackInfo *)info)->peer;
     peer_log(peer, "peerConnected");
+    BRMetricAdd(BRMetricPeerConnects, 1);
 
     BRPeerManager *manager = ((BRPeerCallbackInfo *)info)->manager;
     BRPeerCallbackInfo *peerInfo;
@@ -789,6 +804,7 @@ static void _peerDisconnected(void *info, int error)
     size_t txCount = 0;
 
     //free(info);
+    BRMetricAdd(BRMetricPeerDisconnects, 1);
     pthread_mutex_lock(&manager->lock);
 
     BRPublishedTx pubTx[array_count(manager->publishedTx)];
@@ -1078,13 +1094,9 @@ static int _BRPeerManagerVerifyBlock(BRPeerManager *manager, BRMerkleBlock *bloc
 
     // check if we hit a difficulty transition, and find previous transition time
     if (r && (block->height % BLOCK_DIFFICULTY_INTERVAL) == 0) {
-        BRMerkleBlock *b = block;
+        BRMerkleBlock *b = _BRPrevTransitionBlock(manager->blocks, block);
         UInt256 prevBlock;
 
-        for (uint32_t i = 0; b && i < BLOCK_DIFFICULTY_INTERVAL; i++) {
-            b = BRSetGet(manager->blocks, &b->prevBlock);
-        }
-
         if (! b) {
             peer_log(peer, "missing previous difficulty tansition, can't verify block: %s", u256hex(block->blockHash));
             r = 0;
@@ -1156,6 +1168,7 @@ static void _peerRelayedBlock(void *info, BRMerkleBlock *block)
         // 1% low pass filter, also weights each block by total transactions, compared to the avarage
         manager->fpRate = manager->fpRate*(1.0 - 0.01*block->totalTx/manager->averageTxPerBlock) +
                           0.01*fpCount/manager->averageTxPerBlock;
+        BRMetricSet(BRMetricFalsePositiveRate, manager->fpRate);
 
         // false positive rate sanity check
         if (BRPeerConnectStatus(peer) == BRPeerStatusConnected &&
@@ -1356,6 +1369,23 @@ static void _peerRelayedBlock(void *info, BRMerkleBlock *block)
     if (next) _peerRelayedBlock(info, next);
 }
 
+// counts and traces blocks as they arrive from peers, orphans connected later by _peerRelayedBlock() are not counted
+// twice
+static void _peerReceivedBlock(void *info, BRMerkleBlock *block)
+{
+    BRPeer *peer = ((BRPeerCallbackInfo *)info)->peer;
+    uint64_t traceStart = BRTraceBegin();
+    char peerName[INET6_ADDRSTRLEN + 7];
+
+    BRMetricBlockReceived();
+    _peerRelayedBlock(info, block);
+
+    if (traceStart) {
+        snprintf(peerName, sizeof(peerName), "%s:%"PRIu16, BRPeerHost(peer), peer->port);
+        BRTraceEnd("peer", "_peerRelayedBlock", "peer", peerName, traceStart);
+    }
+}
+
 static void _peerDataNotfound(void *info, const UInt256 txHashes[], size_t txCount,
                              const UInt256 blockHashes[], size_t blockCount)
 {
@@ -1472,7 +1502,7 @@ BRPeerManager *BRPeerManagerNew(const BRChainParams *params, BRWallet *wallet, u
     if (peers) array_add_array(manager->peers, peers, peersCount);
     qsort(manager->peers, array_count(manager->peers), sizeof(*manager->peers), _peerTimestampCompare);
     array_new(manager->connectedPeers, PEER_MAX_CONNECTIONS);
-    manager->blocks = BRSetNew(BRMerkleBlockHash, BRMerkleBlockEq, blocksCount);
+    manager->blocks = BRSetNewUInt256(blocksCount);
     manager->orphans = BRSetNew(_BRPrevBlockHash, _BRPrevBlockEq, blocksCount); // orphans are indexed by prevBlock
     manager->checkpoints = BRSetNew(_BRBlockHeightHash, _BRBlockHeightEq, 100); // checkpoints are indexed by height
 
@@ -1639,7 +1669,7 @@ void BRPeerManagerConnect(BRPeerManager *manager)
                 array_rm(peers, i);
                 array_add(manager->connectedPeers, info->peer);
                 BRPeerSetCallbacks(info->peer, info, _peerConnected, _peerDisconnected, _peerRelayedPeers,
-                                   _peerRelayedTx, _peerHasTx, _peerRejectedTx, _peerRelayedBlock, _peerDataNotfound,
+                                   _peerRelayedTx, _peerHasTx, _peerRejectedTx, _peerReceivedBlock, _peerDataNotfound,
                                    _peerSetFeePerKb, _peerRequestedTx, _peerNetworkIsReachable, _peerThreadCleanup);
                 BRPeerSetEarliestKeyTime(info->peer, manager->earliestKeyTime);
                 BRPeerConnect(info->peer);
@@ -1746,6 +1776,18 @@ uint32_t BRPeerManagerLastBlockHeight(BRPeerManager *manager)
     return height;
 }
 
+// hash of the current proof-of-work verified best block
+UInt256 BRPeerManagerLastBlockHash(BRPeerManager *manager)
+{
+    UInt256 hash;
+
+    assert(manager != NULL);
+    pthread_mutex_lock(&manager->lock);
+    hash = manager->lastBlock->blockHash;
+    pthread_mutex_unlock(&manager->lock);
+    return hash;
+}
+
 // current proof-of-work verified best block timestamp (time interval since unix epoch)
 uint32_t BRPeerManagerLastBlockTimestamp(BRPeerManager *manager)
 {
@@ -103,6 +103,8 @@ size_t _BRBlockHeightHash(const void *block);
 
 int _BRBlockHeightEq(const void *block, const void *otherBlock);
 
+BRMerkleBlock *_BRPrevTransitionBlock(const BRSet *blocks, const BRMerkleBlock *block);
+
 void dummyThreadCleanup(void *info);
 
 // returns a newly allocated BRPeerManager struct that must be freed by calling BRPeerManagerFree()
@@ -156,6 +158,9 @@ uint32_t BRPeerManagerEstimatedBlockHeight(BRPeerManager *manager);
 // current proof-of-work verified best block height
 uint32_t BRPeerManagerLastBlockHeight(BRPeerManager *manager);
 
+// hash of the current proof-of-work verified best block
+UInt256 BRPeerManagerLastBlockHash(BRPeerManager *manager);
+
 // current proof-of-work verified best block timestamp (time interval since unix epoch)
 uint32_t BRPeerManagerLastBlockTimestamp(BRPeerManager *manager);
 
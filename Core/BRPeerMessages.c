@@ -484,13 +484,17 @@ static void BRPeerSendTxMessage(BRPeer *peer, BRTransaction *tx)
 {
 	uint8_t buf[BRTransactionSerialize(tx, NULL, 0)];
 	size_t bufLen = BRTransactionSerialize(tx, buf, sizeof(buf));
-	char txHex[bufLen*2 + 1];
 
-	for (size_t j = 0; j < bufLen; j++) {
-		sprintf(&txHex[j*2], "%02x", buf[j]);
+	if (BRPeerLogEnabled(PEER_LOG_INFO)) {
+		char txHex[bufLen*2 + 1];
+
+		for (size_t j = 0; j < bufLen; j++) {
+			sprintf(&txHex[j*2], "%02x", buf[j]);
+		}
+
+		peer_log(peer, "publishing tx: %s", txHex);
 	}
 
-	peer_log(peer, "publishing tx: %s", txHex);
 	BRPeerSendMessage(peer, buf, bufLen, MSG_TX);
 }
 
@@ -27,6 +27,10 @@
 #include <string.h>
 #include <assert.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 // linear probed hashtable for good cache performance, maximum load factor is 2/3
 
 static const size_t tableSizes[] = { // starting with 1, multiply by 3/2, round up, then find next largest prime
@@ -38,12 +42,34 @@ static const size_t tableSizes[] = { // starting with 1, multiply by 3/2, round
 
 #define TABLE_SIZES_LEN (sizeof(tableSizes)/sizeof(*tableSizes))
 
+// sets created with BRSetNewUInt256() or BRSetNewUTXO() hash and compare the key at the start of each item inline,
+// without calling through hash/eq. next to the table they keep one control byte per bucket, 0 for an empty bucket and
+// 0x80 | 7 bits of the item hash for a full one, so probing scans a group of control bytes at once and only reads the
+// items with a matching fingerprint. table sizes are powers of two with maximum load factor 3/4, and removal shifts
+// the following items back instead of leaving tombstones
+
+#define SET_KEY_GENERIC 0
+#define SET_KEY_UINT256 1 // UInt256
+#define SET_KEY_UTXO    2 // UInt256 followed by uint32_t
+
+#if defined(__SSE2__)
+#define SET_GROUP_WIDTH 16
+#define SET_GROUP_SHIFT 0 // match masks have one bit per control byte
+#else
+#define SET_GROUP_WIDTH 8
+#define SET_GROUP_SHIFT 3 // match masks have the high bit of each control byte
+#endif
+
+#define SET_MIN_KEYED_SIZE 16
+
 struct BRSetStruct {
     void **table; // hashtable
     size_t size; // number of buckets in table
     size_t itemCount; // number of items in set
     size_t (*hash)(const void *); // hash function
     int (*eq)(const void *, const void *); // equality function
+    int keyType; // SET_KEY_GENERIC, or the key at the start of the items of a keyed set
+    uint8_t *ctrl; // control bytes of a keyed set, the first SET_GROUP_WIDTH are repeated after the last
 };
 
 static void _BRSetInit(BRSet *set, size_t (*hash)(const void *), int (*eq)(const void *, const void *), size_t capacity)
@@ -66,6 +92,217 @@ static void _BRSetInit(BRSet *set, size_t (*hash)(const void *), int (*eq)(const
     set->itemCount = 0;
     set->hash = hash;
     set->eq = eq;
+    set->keyType = SET_KEY_GENERIC;
+    set->ctrl = NULL;
+}
+
+static void _BRSetInitKeyed(BRSet *set, int keyType, size_t capacity)
+{
+    assert(set != NULL);
+
+    size_t size = SET_MIN_KEYED_SIZE;
+
+    while (size - size/4 < capacity) size *= 2; // keep load factor below 3/4 at capacity
+    set->table = calloc(size, sizeof(void *));
+    assert(set->table != NULL);
+    set->ctrl = calloc(size + SET_GROUP_WIDTH, sizeof(uint8_t));
+    assert(set->ctrl != NULL);
+    set->size = size;
+    set->itemCount = 0;
+    set->hash = NULL;
+    set->eq = NULL;
+    set->keyType = keyType;
+}
+
+static inline uint64_t _BRSetLoad64(const void *b8)
+{
+    uint64_t v;
+
+    memcpy(&v, b8, sizeof(v));
+    return v;
+}
+
+static inline uint32_t _BRSetLoad32(const void *b4)
+{
+    uint32_t v;
+
+    memcpy(&v, b4, sizeof(v));
+    return v;
+}
+
+// keys are hashes already, mixing the first 8 bytes (and the output index) is enough
+static inline uint64_t _BRSetKeyHash(const BRSet *set, const void *item)
+{
+    uint64_t h = _BRSetLoad64(item);
+
+    if (set->keyType == SET_KEY_UTXO) h ^= _BRSetLoad32((const uint8_t *)item + 32)*0xff51afd7ed558ccdULL;
+    h *= 0x9e3779b97f4a7c15ULL;
+    return h ^ (h >> 32);
+}
+
+static inline int _BRSetKeyEq(const BRSet *set, const void *a, const void *b)
+{
+    const uint8_t *x = a, *y = b;
+    uint64_t d = (_BRSetLoad64(x) ^ _BRSetLoad64(y)) | (_BRSetLoad64(x + 8) ^ _BRSetLoad64(y + 8)) |
+                 (_BRSetLoad64(x + 16) ^ _BRSetLoad64(y + 16)) | (_BRSetLoad64(x + 24) ^ _BRSetLoad64(y + 24));
+
+    if (set->keyType == SET_KEY_UTXO) d |= _BRSetLoad32(x + 32) ^ _BRSetLoad32(y + 32);
+    return (d == 0);
+}
+
+// fingerprint stored in the control byte of a full bucket
+static inline uint8_t _BRSetTag(uint64_t h)
+{
+    return (uint8_t)(0x80 | (h >> 57));
+}
+
+#if defined(__SSE2__)
+// bit i is set if control byte i of the group equals tag
+static inline uint64_t _BRSetGroupMatch(const uint8_t *group, uint8_t tag)
+{
+    __m128i g = _mm_loadu_si128((const __m128i *)group);
+
+    return (uint64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)tag)));
+}
+
+static inline uint64_t _BRSetGroupEmpty(const uint8_t *group)
+{
+    return _BRSetGroupMatch(group, 0);
+}
+#else
+static inline uint64_t _BRSetGroupLoad(const uint8_t *group) // little endian, so byte i is at bits 8*i
+{
+    return ((uint64_t)group[7] << 56) | ((uint64_t)group[6] << 48) | ((uint64_t)group[5] << 40) |
+           ((uint64_t)group[4] << 32) | ((uint64_t)group[3] << 24) | ((uint64_t)group[2] << 16) |
+           ((uint64_t)group[1] << 8) | (uint64_t)group[0];
+}
+
+// high bit of byte i is set if control byte i of the group equals tag, there may be false positives after a match,
+// which the key comparison rejects
+static inline uint64_t _BRSetGroupMatch(const uint8_t *group, uint8_t tag)
+{
+    uint64_t x = _BRSetGroupLoad(group) ^ (0x0101010101010101ULL*tag);
+
+    return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+}
+
+// control bytes of full buckets have the high bit set, so this one is exact
+static inline uint64_t _BRSetGroupEmpty(const uint8_t *group)
+{
+    return ~_BRSetGroupLoad(group) & 0x8080808080808080ULL;
+}
+#endif
+
+static inline size_t _BRSetLowestMatch(uint64_t mask)
+{
+    return (size_t)__builtin_ctzll(mask) >> SET_GROUP_SHIFT;
+}
+
+static inline void _BRSetSetCtrl(BRSet *set, size_t i, uint8_t c)
+{
+    set->ctrl[i] = c;
+    if (i < SET_GROUP_WIDTH) set->ctrl[set->size + i] = c;
+}
+
+// returns the bucket holding an item equivalent to the given item, or set->size if there is none
+static size_t _BRSetKeyedFind(const BRSet *set, const void *item, uint64_t h)
+{
+    size_t mask = set->size - 1, pos = h & mask;
+    uint8_t tag = _BRSetTag(h);
+    uint64_t m;
+
+    for (;;) {
+        const uint8_t *group = set->ctrl + pos;
+
+        for (m = _BRSetGroupMatch(group, tag); m; m &= m - 1) {
+            size_t i = (pos + _BRSetLowestMatch(m)) & mask;
+            const void *t = set->table[i];
+
+            if (t == item || _BRSetKeyEq(set, t, item)) return i;
+        }
+
+        if (_BRSetGroupEmpty(group)) return set->size; // an item is never stored past an empty bucket
+        pos = (pos + SET_GROUP_WIDTH) & mask;
+    }
+}
+
+// stores an item that is not in the set yet into the first empty bucket of its probe sequence
+static void _BRSetKeyedInsert(BRSet *set, void *item, uint64_t h)
+{
+    size_t mask = set->size - 1, pos = h & mask, i;
+    uint64_t m;
+
+    while (! (m = _BRSetGroupEmpty(set->ctrl + pos))) pos = (pos + SET_GROUP_WIDTH) & mask;
+    i = (pos + _BRSetLowestMatch(m)) & mask;
+    set->table[i] = item;
+    _BRSetSetCtrl(set, i, _BRSetTag(h));
+    set->itemCount++;
+}
+
+// rebuilds keyed hashtable at double size
+static void _BRSetKeyedGrow(BRSet *set)
+{
+    BRSet newSet;
+    size_t i;
+
+    _BRSetInitKeyed(&newSet, set->keyType, set->size);
+
+    for (i = 0; i < set->size; i++) {
+        if (set->table[i]) _BRSetKeyedInsert(&newSet, set->table[i], _BRSetKeyHash(&newSet, set->table[i]));
+    }
+
+    free(set->table);
+    free(set->ctrl);
+    set->table = newSet.table;
+    set->ctrl = newSet.ctrl;
+    set->size = newSet.size;
+}
+
+static void *_BRSetKeyedAdd(BRSet *set, void *item)
+{
+    uint64_t h = _BRSetKeyHash(set, item);
+    size_t i = _BRSetKeyedFind(set, item, h);
+    void *t;
+
+    if (i < set->size) { // replace equivalent item
+        t = set->table[i];
+        set->table[i] = item;
+        return t;
+    }
+
+    if (set->itemCount + 1 > set->size - set->size/4) { // limit load factor to 3/4
+        _BRSetKeyedGrow(set);
+    }
+
+    _BRSetKeyedInsert(set, item, h);
+    return NULL;
+}
+
+static void *_BRSetKeyedRemove(BRSet *set, const void *item)
+{
+    size_t mask = set->size - 1, i = _BRSetKeyedFind(set, item, _BRSetKeyHash(set, item)), j, home;
+    void *r;
+
+    if (i == set->size) return NULL;
+    r = set->table[i];
+    j = i;
+
+    for (;;) { // shift back the following items that may not be stored past the emptied bucket
+        j = (j + 1) & mask;
+        if (! set->ctrl[j]) break;
+        home = _BRSetKeyHash(set, set->table[j]) & mask;
+
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            set->table[i] = set->table[j];
+            _BRSetSetCtrl(set, i, set->ctrl[j]);
+            i = j;
+        }
+    }
+
+    set->table[i] = NULL;
+    _BRSetSetCtrl(set, i, 0);
+    set->itemCount--;
+    return r;
 }
 
 // retruns a newly allocated empty set that must be freed by calling BRSetFree()
@@ -83,6 +320,28 @@ BRSet *BRSetNew(size_t (*hash)(const void *), int (*eq)(const void *, const void
     return set;
 }
 
+// returns a newly allocated empty set of items that start with a UInt256 key, like BRTransaction, BRMerkleBlock or
+// UInt256 itself, which must be freed by calling BRSetFree()
+BRSet *BRSetNewUInt256(size_t capacity)
+{
+    BRSet *set = calloc(1, sizeof(*set));
+
+    assert(set != NULL);
+    _BRSetInitKeyed(set, SET_KEY_UINT256, capacity);
+    return set;
+}
+
+// returns a newly allocated empty set of items that start with a UInt256 hash followed by a uint32_t index, like
+// BRUTXO or BRTxInput, which must be freed by calling BRSetFree()
+BRSet *BRSetNewUTXO(size_t capacity)
+{
+    BRSet *set = calloc(1, sizeof(*set));
+
+    assert(set != NULL);
+    _BRSetInitKeyed(set, SET_KEY_UTXO, capacity);
+    return set;
+}
+
 // rebuilds hashtable to hold up to capacity items
 static void _BRSetGrow(BRSet *set, size_t capacity)
 {
@@ -102,6 +361,8 @@ void *BRSetAdd(BRSet *set, void *item)
     assert(set != NULL);
     assert(item != NULL);
     
+    if (set->keyType != SET_KEY_GENERIC) return _BRSetKeyedAdd(set, item);
+
     size_t size = set->size;
     size_t i = set->hash(item) % size;
     void *t = set->table[i];
@@ -123,6 +384,8 @@ void *BRSetRemove(BRSet *set, const void *item)
     assert(set != NULL);
     assert(item != NULL);
     
+    if (set->keyType != SET_KEY_GENERIC) return _BRSetKeyedRemove(set, item);
+
     size_t size = set->size;
     size_t i = set->hash(item) % size;
     void *r = set->table[i], *t;
@@ -156,6 +419,7 @@ void BRSetClear(BRSet *set)
     assert(set != NULL);
     
     memset(set->table, 0, set->size*sizeof(*set->table));
+    if (set->ctrl) memset(set->ctrl, 0, set->size + SET_GROUP_WIDTH);
     set->itemCount = 0;
 }
 
@@ -196,6 +460,12 @@ void *BRSetGet(const BRSet *set, const void *item)
     assert(set != NULL);
     assert(item != NULL);
     
+    if (set->keyType != SET_KEY_GENERIC) {
+        size_t i = _BRSetKeyedFind(set, item, _BRSetKeyHash(set, item));
+
+        return (i < set->size) ? set->table[i] : NULL;
+    }
+
     size_t size = set->size;
     size_t i = set->hash(item) % size;
     void *t = set->table[i];
@@ -217,7 +487,12 @@ void *BRSetIterate(const BRSet *set, const void *previous)
     size_t i = 0, size = set->size;
     void *t, *r = NULL;
     
-    if (previous != NULL) {
+    if (previous != NULL && set->keyType != SET_KEY_GENERIC) {
+        i = _BRSetKeyedFind(set, previous, _BRSetKeyHash(set, previous));
+        if (i == size) return NULL;
+        i++;
+    }
+    else if (previous != NULL) {
         i = set->hash(previous) % size;
         t = set->table[i];
         
@@ -321,5 +596,6 @@ void BRSetFree(BRSet *set)
     assert(set != NULL);
 
     free(set->table);
+    free(set->ctrl);
     free(set);
 }
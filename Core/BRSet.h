@@ -41,6 +41,16 @@ typedef struct BRSetStruct BRSet;
 // capacity is the initial number of items the set can hold, which will be auto-increased as needed
 BRSet *BRSetNew(size_t (*hash)(const void *), int (*eq)(const void *, const void *), size_t capacity);
 
+// returns a newly allocated empty set of items that start with a UInt256 key, like BRTransaction, BRMerkleBlock or
+// UInt256 itself, which must be freed by calling BRSetFree()
+// the key is hashed and compared inline and probing checks stored fingerprints first, which makes it much faster than
+// BRSetNew() with hash/eq callbacks on large sets
+BRSet *BRSetNewUInt256(size_t capacity);
+
+// returns a newly allocated empty set of items that start with a UInt256 hash followed by a uint32_t index, like
+// BRUTXO or BRTxInput, which must be freed by calling BRSetFree()
+BRSet *BRSetNewUTXO(size_t capacity);
+
 // adds given item to set or replaces an equivalent existing item and returns item replaced if any
 void *BRSetAdd(BRSet *set, void *item);
 
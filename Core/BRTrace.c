@@ -0,0 +1,33 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "BRTrace.h"
+#include <time.h>
+
+static BRTraceHandler _traceHandler = NULL;
+
+uint64_t BRTraceClock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000 + (uint64_t)ts.tv_nsec/1000 + 1;
+}
+
+void BRTraceSetHandler(BRTraceHandler handler)
+{
+    __atomic_store_n(&_traceHandler, handler, __ATOMIC_RELEASE);
+}
+
+uint64_t BRTraceBegin(void)
+{
+    return (__atomic_load_n(&_traceHandler, __ATOMIC_RELAXED)) ? BRTraceClock() : 0;
+}
+
+void BRTraceEnd(const char *category, const char *name, const char *argName, const char *argValue, uint64_t start)
+{
+    BRTraceHandler handler = __atomic_load_n(&_traceHandler, __ATOMIC_ACQUIRE);
+
+    if (start && handler) handler(category, name, argName, argValue, start, BRTraceClock());
+}
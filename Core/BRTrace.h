@@ -0,0 +1,34 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BRTrace_h
+#define BRTrace_h
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// receives every finished span while a trace is recorded, times are BRTraceClock() microseconds
+typedef void (*BRTraceHandler)(const char *category, const char *name, const char *argName, const char *argValue,
+                               uint64_t start, uint64_t end);
+
+// monotonic clock in microseconds, never 0
+uint64_t BRTraceClock(void);
+
+// NULL stops recording
+void BRTraceSetHandler(BRTraceHandler handler);
+
+// returns the start of a span, or 0 when no trace is recorded so the span costs a single load
+uint64_t BRTraceBegin(void);
+
+// records a span returned by BRTraceBegin(), argName and argValue may be NULL
+void BRTraceEnd(const char *category, const char *name, const char *argName, const char *argValue, uint64_t start);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BRTrace_h
@@ -268,10 +268,10 @@ BRWallet *BRWalletNew(BRTransaction *transactions[], size_t txCount, BRMasterPub
     array_new(wallet->internalChain, 100);
     array_new(wallet->externalChain, 100);
     array_new(wallet->balanceHist, txCount + 100);
-    wallet->allTx = BRSetNew(BRTransactionHash, BRTransactionEq, txCount + 100);
-    wallet->invalidTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-    wallet->pendingTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-    wallet->spentOutputs = BRSetNew(BRUTXOHash, BRUTXOEq, txCount + 100);
+    wallet->allTx = BRSetNewUInt256(txCount + 100);
+    wallet->invalidTx = BRSetNewUInt256(10);
+    wallet->pendingTx = BRSetNewUInt256(10);
+    wallet->spentOutputs = BRSetNewUTXO(txCount + 100);
     wallet->usedAddrs = BRSetNew(BRAddressHash, BRAddressEq, txCount + 100);
     wallet->allAddrs = BRSetNew(BRAddressHash, BRAddressEq, txCount + 100);
     pthread_mutex_init(&wallet->lock, NULL);
@@ -1014,6 +1014,7 @@ uint64_t BRWalletAmountReceivedFromTx(BRWallet *wallet, const BRTransaction *tx)
 
     assert(wallet != NULL);
     assert(tx != NULL);
+    if (wallet->WalletAmountReceivedFromTx) return wallet->WalletAmountReceivedFromTx(wallet, tx);
     pthread_mutex_lock(&wallet->lock);
 
     // TODO: don't include outputs below TX_MIN_OUTPUT_AMOUNT
@@ -1032,6 +1033,7 @@ uint64_t BRWalletAmountSentByTx(BRWallet *wallet, const BRTransaction *tx)
 
     assert(wallet != NULL);
     assert(tx != NULL);
+    if (wallet->WalletAmountSentByTx) return wallet->WalletAmountSentByTx(wallet, tx);
     pthread_mutex_lock(&wallet->lock);
 
     for (size_t i = 0; tx && i < tx->inCount; i++) {
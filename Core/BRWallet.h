@@ -85,6 +85,9 @@ typedef struct BRWalletStruct {
 	int (*TransactionIsSigned)(const BRTransaction *tx);
 	size_t (*KeyToAddress)(const BRKey *key, char *addr, size_t addrLen);
 	uint64_t (*balanceAfterTx)(BRWallet *wallet, const BRTransaction *tx);
+	// optional, set by wallets that don't keep allAddrs
+	uint64_t (*WalletAmountReceivedFromTx)(BRWallet *wallet, const BRTransaction *tx);
+	uint64_t (*WalletAmountSentByTx)(BRWallet *wallet, const BRTransaction *tx);
     pthread_mutex_t lock;
 } BRWallet;
 
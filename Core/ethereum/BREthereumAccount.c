@@ -326,6 +326,16 @@ addressRlpEncode (BREthereumAddress address, BRRlpCoder coder) {
     return rlpEncodeItemHexString(coder, address->string);
 }
 
+extern size_t
+addressRlpSize (BREthereumAddress address) {
+    return rlpSizeHexString(address->string);
+}
+
+extern void
+addressRlpWrite (BREthereumAddress address, BRRlpWriter *writer) {
+    rlpWriteHexString(writer, address->string);
+}
+
 //
 // Account
 //
@@ -108,6 +108,12 @@ addressPublicKeyAsString (BREthereumAddress address, int compressed);
 extern BRRlpItem
 addressRlpEncode (BREthereumAddress address, BRRlpCoder coder);
 
+extern size_t
+addressRlpSize (BREthereumAddress address);
+
+extern void
+addressRlpWrite (BREthereumAddress address, BRRlpWriter *writer);
+
 //
 // Account
 //
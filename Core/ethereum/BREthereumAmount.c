@@ -87,6 +87,31 @@ amountRlpEncode(BREthereumAmount amount, BRRlpCoder coder) {
     }
 }
 
+extern size_t
+amountRlpSize (BREthereumAmount amount) {
+    switch (amount.type) {
+        case AMOUNT_ETHER:
+            return etherRlpSize(amount.u.ether);
+
+        case AMOUNT_TOKEN:
+            return rlpSizeString("");
+    }
+}
+
+extern void
+amountRlpWrite (BREthereumAmount amount, BRRlpWriter *writer) {
+    switch (amount.type) {
+        case AMOUNT_ETHER:
+            etherRlpWrite(amount.u.ether, writer);
+            break;
+
+        case AMOUNT_TOKEN:
+            // As amountRlpEncode(), an empty string
+            rlpWriteString(writer, "");
+            break;
+    }
+}
+
 //
 // Parse
 //
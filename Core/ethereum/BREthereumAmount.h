@@ -85,6 +85,12 @@ amountGetGasEstimate (BREthereumAmount amount);
 extern BRRlpItem
 amountRlpEncode(BREthereumAmount amount, BRRlpCoder coder);
 
+extern size_t
+amountRlpSize (BREthereumAmount amount);
+
+extern void
+amountRlpWrite (BREthereumAmount amount, BRRlpWriter *writer);
+
 //
 // Parsing
 //
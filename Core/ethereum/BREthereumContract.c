@@ -152,6 +152,7 @@ static struct BREthereumContractRecord contractRecordERC20 = {
 };
 BREthereumContract contractERC20 = &contractRecordERC20;
 BREthereumFunction functionERC20Transfer = &contractRecordERC20.functions[2];
+BREthereumFunction functionERC20BalanceOf = &contractRecordERC20.functions[1];
 
 
 static int
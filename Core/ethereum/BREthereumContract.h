@@ -35,6 +35,7 @@ typedef struct BREthereumContractRecord *BREthereumContract;
 
 extern BREthereumContract contractERC20;
 extern BREthereumFunction functionERC20Transfer; // "transfer(address,uint256)"
+extern BREthereumFunction functionERC20BalanceOf; // "balanceOf(address)"
 
 /**
  * Encode an Ehtereum function with arguments.  The specific arguments and their types are
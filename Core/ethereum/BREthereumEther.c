@@ -123,6 +123,16 @@ etherRlpEncode (const BREthereumEther ether, BRRlpCoder coder) {
     return rlpEncodeItemUInt256(coder, ether.valueInWEI);
 }
 
+extern size_t
+etherRlpSize (const BREthereumEther ether) {
+    return rlpSizeUInt256(ether.valueInWEI);
+}
+
+extern void
+etherRlpWrite (const BREthereumEther ether, BRRlpWriter *writer) {
+    rlpWriteUInt256(writer, ether.valueInWEI);
+}
+
 extern BREthereumEther
 etherAdd (BREthereumEther e1, BREthereumEther e2, int *overflow) {
     BREthereumEther result;
@@ -109,6 +109,12 @@ etherGetValueString(const BREthereumEther ether, BREthereumEtherUnit unit);
 extern BRRlpItem
 etherRlpEncode (const BREthereumEther ether, BRRlpCoder coder);
 
+extern size_t
+etherRlpSize (const BREthereumEther ether);
+
+extern void
+etherRlpWrite (const BREthereumEther ether, BRRlpWriter *writer);
+
 extern BREthereumEther
 etherAdd (BREthereumEther e1, BREthereumEther e2, int *overflow);
 
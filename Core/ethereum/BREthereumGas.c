@@ -41,6 +41,16 @@ gasRlpEncode (BREthereumGas gas, BRRlpCoder coder) {
     return rlpEncodeItemUInt64(coder, gas.amountOfGas);
 }
 
+extern size_t
+gasRlpSize (BREthereumGas gas) {
+    return rlpSizeUInt64(gas.amountOfGas);
+}
+
+extern void
+gasRlpWrite (BREthereumGas gas, BRRlpWriter *writer) {
+    rlpWriteUInt64(writer, gas.amountOfGas);
+}
+
 //
 // Gas Price
 //
@@ -64,3 +74,13 @@ extern BRRlpItem
 gasPriceRlpEncode (BREthereumGasPrice price, BRRlpCoder coder) {
     return etherRlpEncode(price.etherPerGas, coder);
 }
+
+extern size_t
+gasPriceRlpSize (BREthereumGasPrice price) {
+    return etherRlpSize(price.etherPerGas);
+}
+
+extern void
+gasPriceRlpWrite (BREthereumGasPrice price, BRRlpWriter *writer) {
+    etherRlpWrite(price.etherPerGas, writer);
+}
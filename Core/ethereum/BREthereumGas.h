@@ -46,6 +46,12 @@ gasCreate(uint64_t gas);
 extern BRRlpItem
 gasRlpEncode (BREthereumGas gas, BRRlpCoder coder);
 
+extern size_t
+gasRlpSize (BREthereumGas gas);
+
+extern void
+gasRlpWrite (BREthereumGas gas, BRRlpWriter *writer);
+
 /**
  * Ethereum Gas Price is the amount of Ether for on Gas - aka Ether/Gas.  The total cost for
  * an Ethereum transaction is the Gas Price * Gas (used).
@@ -82,6 +88,12 @@ gasPriceGetGasCost(BREthereumGasPrice price, BREthereumGas gas, int *overflow);
 extern BRRlpItem
 gasPriceRlpEncode (BREthereumGasPrice price, BRRlpCoder coder);
 
+extern size_t
+gasPriceRlpSize (BREthereumGasPrice price);
+
+extern void
+gasPriceRlpWrite (BREthereumGasPrice price, BRRlpWriter *writer);
+
 #ifdef __cplusplus
 }
 #endif
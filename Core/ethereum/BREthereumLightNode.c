@@ -31,6 +31,7 @@
 #include <BRBIP39Mnemonic.h>
 #include <pthread.h>
 #include <unistd.h>
+#include <time.h>   // nanosleep
 #include "BREthereumPrivate.h"
 #include "BRArray.h"
 
@@ -53,6 +54,16 @@ typedef struct  {
     BREthereumLightNodeListenerTransactionEventHandler transactionEventHandler;
 } BREthereumLightNodeListener;
 
+//
+// Light Node Store
+//
+typedef struct {
+    BREthereumLightNodeStoreContext context;
+    BREthereumLightNodeStoreSaveTransaction funcSaveTransaction;
+    BREthereumLightNodeStoreSaveBlock funcSaveBlock;
+    BREthereumLightNodeStoreSaveBalance funcSaveBalance;
+} BREthereumLightNodeStore;
+
 
 //
 // Light Node Configuration
@@ -83,9 +94,27 @@ lightNodeConfigurationCreateJSON_RPC(BREthereumNetwork network,
     configuration.u.json_rpc.funcEstimateGas = funcEstimateGas;
     configuration.u.json_rpc.funcSubmitTransaction = funcSubmitTransaction;
     configuration.u.json_rpc.funcGetTransactions = funcGetTransactions;
+    configuration.u.json_rpc.funcSendBatch = NULL;
+    configuration.u.json_rpc.batchSize = 0;
+    configuration.u.json_rpc.batchesInFlight = 0;
+    configuration.u.json_rpc.batchFlushMilliseconds = 0;
     return configuration;
 }
 
+extern void
+lightNodeConfigurationSetJSON_RPCBatching (BREthereumLightNodeConfiguration *configuration,
+                                           JsonRpcSendBatch funcSendBatch,
+                                           unsigned int batchSize,
+                                           unsigned int batchesInFlight,
+                                           unsigned int batchFlushMilliseconds) {
+    assert (NODE_TYPE_JSON_RPC == configuration->type);
+    assert (NULL != funcSendBatch && batchSize > 0 && batchesInFlight > 0 && batchFlushMilliseconds > 0);
+    configuration->u.json_rpc.funcSendBatch = funcSendBatch;
+    configuration->u.json_rpc.batchSize = batchSize;
+    configuration->u.json_rpc.batchesInFlight = batchesInFlight;
+    configuration->u.json_rpc.batchFlushMilliseconds = batchFlushMilliseconds;
+}
+
 //
 // Light Node
 //
@@ -93,6 +122,29 @@ lightNodeConfigurationCreateJSON_RPC(BREthereumNetwork network,
 #define DEFAULT_WALLET_CAPACITY 10
 #define DEFAULT_BLOCK_CAPACITY 100
 #define DEFAULT_TRANSACTION_CAPACITY 1000
+#define DEFAULT_REQUEST_CAPACITY 100
+
+typedef enum {
+    JSON_RPC_BALANCE,
+    JSON_RPC_GAS_PRICE,
+    JSON_RPC_GAS_ESTIMATE,
+    JSON_RPC_SUBMIT_TRANSACTION
+} BREthereumJsonRpcQueryType;
+
+// A query awaiting the result of request `rid`; coalesced queries share a request.
+typedef struct {
+    int rid;
+    BREthereumJsonRpcQueryType type;
+    BREthereumLightNodeWalletId wid;
+    BREthereumLightNodeTransactionId tid;
+} BREthereumJsonRpcQuery;
+
+// A JSON_RPC request: its `method` and `params` members, queued (bid == 0) or in batch `bid`.
+typedef struct {
+    int rid;
+    int bid;
+    char *members;
+} BREthereumJsonRpcRequest;
 
 typedef enum {
     LIGHT_NODE_CREATED,
@@ -134,6 +186,16 @@ struct BREthereumLightNodeRecord {
      * The blocks seen/handled by this node.
      */
     BREthereumBlock *blocks; // BRSet
+
+    /**
+     * The number of the latest block in `blocks`
+     */
+    uint64_t blockNumber;
+
+    /**
+     * The client's store, if any; see lightNodeSetStore().
+     */
+    BREthereumLightNodeStore store;
     
     //
     unsigned int requestId;
@@ -142,10 +204,31 @@ struct BREthereumLightNodeRecord {
 
     BREthereumLightNodeListener *listeners; // BRArray
 
+    /**
+     * The JSON_RPC queries and requests of a batching node; see lightNodeFlushBatch().
+     */
+    BREthereumJsonRpcQuery *queries; // BRArray
+    BREthereumJsonRpcRequest *requests; // BRArray, queued then in flight
+    unsigned int requestsQueued;
+    unsigned int batchId;
+    unsigned int batchesInFlight;
+    int batchFlushing;
+
     pthread_t thread;
     pthread_mutex_t lock;
 };
 
+// JSON_RPC batching, below
+static char *
+lightNodeCreateRequestMembers (const char *method, ...);
+
+static void
+lightNodeQueueRequest (BREthereumLightNode node,
+                       BREthereumJsonRpcQueryType type,
+                       BREthereumLightNodeWalletId wid,
+                       BREthereumLightNodeTransactionId tid,
+                       char *members);
+
 static BREthereumLightNode
 createLightNodeInternal (BREthereumLightNodeConfiguration configuration,
                          BREthereumAccount account) {
@@ -157,6 +240,8 @@ createLightNodeInternal (BREthereumLightNodeConfiguration configuration,
     array_new(node->transactions, DEFAULT_TRANSACTION_CAPACITY);
     array_new(node->blocks, DEFAULT_BLOCK_CAPACITY);
     array_new(node->listeners, DEFAULT_LISTENER_CAPACITY);
+    array_new(node->queries, DEFAULT_REQUEST_CAPACITY);
+    array_new(node->requests, DEFAULT_REQUEST_CAPACITY);
 
     {
         pthread_mutexattr_t attr;
@@ -304,6 +389,33 @@ lightNodeListenerAnnounceTransactionEvent (BREthereumLightNode node,
     }
 }
 
+//
+// Store
+//
+extern void
+lightNodeSetStore (BREthereumLightNode node,
+                   BREthereumLightNodeStoreContext context,
+                   BREthereumLightNodeStoreSaveTransaction funcSaveTransaction,
+                   BREthereumLightNodeStoreSaveBlock funcSaveBlock,
+                   BREthereumLightNodeStoreSaveBalance funcSaveBalance) {
+    pthread_mutex_lock(&node->lock);
+    node->store.context = context;
+    node->store.funcSaveTransaction = funcSaveTransaction;
+    node->store.funcSaveBlock = funcSaveBlock;
+    node->store.funcSaveBalance = funcSaveBalance;
+    pthread_mutex_unlock(&node->lock);
+}
+
+extern uint64_t
+lightNodeGetBlockNumber (BREthereumLightNode node) {
+    uint64_t blockNumber;
+
+    pthread_mutex_lock(&node->lock);
+    blockNumber = node->blockNumber;
+    pthread_mutex_unlock(&node->lock);
+    return blockNumber;
+}
+
 //
 // Connect // Disconnect
 //
@@ -312,6 +424,12 @@ lightNodeListenerAnnounceTransactionEvent (BREthereumLightNode node,
 
 typedef void* (*ThreadRoutine) (void*);
 
+static int
+lightNodeIsBatching (BREthereumLightNode node) {
+    return (NODE_TYPE_JSON_RPC == node->configuration.type
+            && NULL != node->configuration.u.json_rpc.funcSendBatch);
+}
+
 static void *
 lightNodeThreadRoutine (BREthereumLightNode node) {
     node->state = LIGHT_NODE_CONNECTED;
@@ -330,7 +448,20 @@ lightNodeThreadRoutine (BREthereumLightNode node) {
             lightNodeUpdateWalletBalance (node, i);
 
         pthread_mutex_unlock(&node->lock);
-        if (1 == sleep (PTHREAD_SLEEP_SECONDS)) {
+
+        // A batching node sends the partial batch of the above queries, and of any others, at
+        // its flush interval while it waits.
+        if (lightNodeIsBatching(node)) {
+            unsigned int interval = node->configuration.u.json_rpc.batchFlushMilliseconds;
+            struct timespec delay = { interval / 1000, 1000000 * (long) (interval % 1000) };
+            for (unsigned int slept = 0;
+                 slept < 1000 * PTHREAD_SLEEP_SECONDS && LIGHT_NODE_DISCONNECTING != node->state;
+                 slept += interval) {
+                nanosleep (&delay, NULL);
+                lightNodeFlushBatch(node);
+            }
+        }
+        else if (1 == sleep (PTHREAD_SLEEP_SECONDS)) {
         }
     }
 
@@ -607,6 +738,8 @@ lightNodeInsertBlock (BREthereumLightNode node,
     pthread_mutex_lock(&node->lock);
     array_add(node->blocks, block);
     bid = (BREthereumLightNodeBlockId) (array_count(node->blocks) - 1);
+    if (blockGetNumber(block) > node->blockNumber)
+        node->blockNumber = blockGetNumber(block);
     pthread_mutex_unlock(&node->lock);
     lightNodeListenerAnnounceBlockEvent(node, bid, BLOCK_EVENT_CREATED);
 }
@@ -726,7 +859,12 @@ lightNodeWalletSubmitTransaction(BREthereumLightNode node,
         case NODE_TYPE_JSON_RPC: {
             char *rawTransaction = walletGetRawTransactionHexEncoded(wallet, transaction, "0x");
 
-            node->configuration.u.json_rpc.funcSubmitTransaction
+            if (lightNodeIsBatching(node))
+                lightNodeQueueRequest(node, JSON_RPC_SUBMIT_TRANSACTION, wid, tid,
+                                      lightNodeCreateRequestMembers
+                                      ("eth_sendRawTransaction", "\"", rawTransaction, "\"", NULL));
+            else
+                node->configuration.u.json_rpc.funcSubmitTransaction
                     (node->configuration.u.json_rpc.funcContext,
                      node,
                      wid,
@@ -823,7 +961,25 @@ lightNodeUpdateWalletBalance(BREthereumLightNode node,
         case NODE_TYPE_JSON_RPC: {
             char *address = addressAsString(walletGetAddress(wallet));
 
-            node->configuration.u.json_rpc.funcGetBalance
+            if (lightNodeIsBatching(node)) {
+                char *members;
+                if (AMOUNT_ETHER == walletGetAmountType(wallet))
+                    members = lightNodeCreateRequestMembers
+                    ("eth_getBalance", "\"", address, "\",\"latest\"", NULL);
+                else {
+                    // The token contract's balanceOf(address)
+                    char *data = (char *) contractEncode (contractERC20, functionERC20BalanceOf,
+                                                          (uint8_t *) &address[2], strlen(address) - 2,
+                                                          NULL);
+                    members = lightNodeCreateRequestMembers
+                    ("eth_call", "{\"to\":\"", tokenGetAddress(walletGetToken(wallet)),
+                     "\",\"data\":\"0x", data, "\"},\"latest\"", NULL);
+                    free (data);
+                }
+                lightNodeQueueRequest(node, JSON_RPC_BALANCE, wid, -1, members);
+            }
+            else
+                node->configuration.u.json_rpc.funcGetBalance
                     (node->configuration.u.json_rpc.funcContext,
                      node,
                      wid,
@@ -851,7 +1007,22 @@ lightNodeUpdateTransactionGasEstimate (BREthereumLightNode node,
             char *to = (char *) addressAsString (transactionGetTargetAddress(transaction));
             char *amount = coerceString(amountInEther.valueInWEI, 16);
             char *data = (char *) transactionGetData(transaction);
-            
+
+            if (lightNodeIsBatching(node)) {
+                char *from = (char *) addressAsString (transactionGetSourceAddress(transaction));
+                const char *value = amount;
+                while ('0' == value[0] && '\0' != value[1]) value++;  // a quantity, no leading zeros
+                int hasData = (NULL != data && '\0' != data[0]);
+
+                lightNodeQueueRequest(node, JSON_RPC_GAS_ESTIMATE, wid, tid,
+                                      lightNodeCreateRequestMembers
+                                      ("eth_estimateGas",
+                                       "{\"from\":\"", from, "\",\"to\":\"", to, "\",\"value\":\"0x", value,
+                                       (hasData ? "\",\"data\":\"0x" : ""), (hasData ? data : ""), "\"}", NULL));
+                free (from); free (to); free (amount);
+                break;
+            }
+
             node->configuration.u.json_rpc.funcEstimateGas
             (node->configuration.u.json_rpc.funcContext,
              node,
@@ -879,11 +1050,16 @@ lightNodeUpdateWalletDefaultGasPrice (BREthereumLightNode node,
                                       BREthereumLightNodeWalletId wid) {
     switch (node->configuration.type) {
         case NODE_TYPE_JSON_RPC: {
-            node->configuration.u.json_rpc.funcGetGasPrice
-            (node->configuration.u.json_rpc.funcContext,
-             node,
-             wid,
-             ++node->requestId);
+            if (lightNodeIsBatching(node))
+                // Identical for every wallet; coalesced into one request
+                lightNodeQueueRequest(node, JSON_RPC_GAS_PRICE, wid, -1,
+                                      lightNodeCreateRequestMembers ("eth_gasPrice", NULL));
+            else
+                node->configuration.u.json_rpc.funcGetGasPrice
+                (node->configuration.u.json_rpc.funcContext,
+                 node,
+                 wid,
+                 ++node->requestId);
             break;
         }
         case NODE_TYPE_LES:
@@ -891,6 +1067,303 @@ lightNodeUpdateWalletDefaultGasPrice (BREthereumLightNode node,
     }
 }
 
+//
+// JSON_RPC Batching
+//
+// A batching node queues a request for each query, coalescing identical queries that are not
+// yet sent, and sends the requests in order, as batches, with at most `batchesInFlight`
+// unannounced.  A full batch is sent when queued; a partial one on lightNodeFlushBatch().
+//
+
+// The members `"method":"<method>","params":[<params>]` where <params> is the concatenation of
+// the NULL-terminated strings following `method`.
+static char *
+lightNodeCreateRequestMembers (const char *method, ...) {
+    static const char *format = "\"method\":\"%s\",\"params\":[";
+    size_t length = strlen(format) + strlen(method) + 2;
+    const char *param;
+    va_list args;
+
+    va_start (args, method);
+    while (NULL != (param = va_arg (args, const char *)))
+        length += strlen (param);
+    va_end (args);
+
+    char *members = malloc (length);
+    size_t index = sprintf (members, format, method);
+
+    va_start (args, method);
+    while (NULL != (param = va_arg (args, const char *)))
+        index += sprintf (&members[index], "%s", param);
+    va_end (args);
+
+    strcpy (&members[index], "]");
+    return members;
+}
+
+static void
+lightNodeSendBatches (BREthereumLightNode node, int partial) {
+    unsigned int batchSize = node->configuration.u.json_rpc.batchSize;
+    unsigned int batchesInFlight = node->configuration.u.json_rpc.batchesInFlight;
+
+    pthread_mutex_lock(&node->lock);
+
+    // A client that announces a batch while it is being sent frees a slot for this same loop.
+    if (!node->batchFlushing) {
+        node->batchFlushing = 1;
+
+        while (node->batchesInFlight < batchesInFlight
+               && (node->requestsQueued >= batchSize || (partial && node->requestsQueued > 0))) {
+            int bid = (int) ++node->batchId;
+            size_t count = 0, length = 3, index = 0;
+
+            for (size_t i = 0; i < array_count(node->requests) && count < batchSize; i++)
+                if (0 == node->requests[i].bid) {
+                    length += strlen (node->requests[i].members) + 40;  // {"jsonrpc":"2.0","id":<int>,},
+                    count++;
+                }
+
+            char *batch = malloc (length);
+            batch[index++] = '[';
+            count = 0;
+            for (size_t i = 0; i < array_count(node->requests) && count < batchSize; i++)
+                if (0 == node->requests[i].bid) {
+                    node->requests[i].bid = bid;
+                    index += sprintf (&batch[index], "%s{\"jsonrpc\":\"2.0\",\"id\":%d,%s}",
+                                      (0 == count ? "" : ","),
+                                      node->requests[i].rid,
+                                      node->requests[i].members);
+                    count++;
+                }
+            strcpy (&batch[index], "]");
+
+            node->requestsQueued -= count;
+            node->batchesInFlight++;
+
+            node->configuration.u.json_rpc.funcSendBatch
+            (node->configuration.u.json_rpc.funcContext,
+             node,
+             batch,
+             bid);
+
+            free (batch);
+        }
+
+        node->batchFlushing = 0;
+    }
+
+    pthread_mutex_unlock(&node->lock);
+}
+
+static void
+lightNodeQueueRequest (BREthereumLightNode node,
+                       BREthereumJsonRpcQueryType type,
+                       BREthereumLightNodeWalletId wid,
+                       BREthereumLightNodeTransactionId tid,
+                       char *members) {
+    BREthereumJsonRpcQuery query = { 0, type, wid, tid };
+
+    pthread_mutex_lock(&node->lock);
+    for (size_t i = 0; i < array_count(node->requests); i++)
+        if (0 == node->requests[i].bid && 0 == strcmp (node->requests[i].members, members)) {
+            query.rid = node->requests[i].rid;
+            break;
+        }
+
+    if (0 == query.rid) {
+        BREthereumJsonRpcRequest request = { (int) ++node->requestId, 0, members };
+        array_add (node->requests, request);
+        node->requestsQueued++;
+        query.rid = request.rid;
+    }
+    else free (members);
+
+    array_add (node->queries, query);
+    int full = node->requestsQueued >= node->configuration.u.json_rpc.batchSize;
+    pthread_mutex_unlock(&node->lock);
+
+    if (full) lightNodeSendBatches(node, 0);
+}
+
+extern void
+lightNodeFlushBatch (BREthereumLightNode node) {
+    if (lightNodeIsBatching(node))
+        lightNodeSendBatches(node, 1);
+}
+
+static const char *
+jsonSkipSpace (const char *json) {
+    while (' ' == *json || '\t' == *json || '\n' == *json || '\r' == *json) json++;
+    return json;
+}
+
+// Skip the JSON value at `json`; return what follows it or NULL if it is unterminated.  Values
+// are checked only as far as needed to find their end.
+static const char *
+jsonSkipValue (const char *json) {
+    int depth = 0;
+
+    json = jsonSkipSpace(json);
+    do {
+        if ('\0' == *json) return NULL;
+        else if ('"' == *json) {
+            for (json++; '"' != *json; json++)
+                if ('\0' == *json || ('\\' == *json && '\0' == *++json)) return NULL;
+            json++;
+        }
+        else if ('{' == *json || '[' == *json) { depth++; json++; }
+        else if ('}' == *json || ']' == *json) { if (0 == depth--) return NULL; json++; }
+        else if (depth > 0) json++;
+        else while ('\0' != *json && NULL == strchr (",}] \t\n\r", *json)) json++;
+    } while (depth > 0);
+
+    return json;
+}
+
+// Fill `results` from the response array, as far as it is well formed: each response's string
+// `result` goes to the request of `requests` with its `id`.  Responses with an `error` or with
+// an unknown `id` are skipped.
+static void
+lightNodeParseBatch (const char *responses,
+                     BREthereumJsonRpcRequest *requests,
+                     char **results) {
+    const char *json = jsonSkipSpace(responses);
+    if ('[' != *json) return;
+
+    for (json = jsonSkipSpace(json + 1); '{' == *json; ) {
+        long id = -1;
+        const char *result = NULL;
+        size_t resultLength = 0;
+
+        // The object's members
+        for (json = jsonSkipSpace(json + 1); '"' == *json; ) {
+            const char *key = json;
+            if (NULL == (json = jsonSkipValue(key))) return;
+            size_t keyLength = json - key;
+
+            json = jsonSkipSpace(json);
+            if (':' != *json) return;
+
+            const char *value = jsonSkipSpace(json + 1);
+            if (NULL == (json = jsonSkipValue(value))) return;
+
+            if (4 == keyLength && 0 == strncmp (key, "\"id\"", 4))
+                id = strtol (value, NULL, 10);
+            else if (8 == keyLength && 0 == strncmp (key, "\"result\"", 8) && '"' == *value) {
+                result = value + 1;
+                resultLength = json - value - 2;
+            }
+
+            json = jsonSkipSpace(json);
+            if (',' == *json) json = jsonSkipSpace(json + 1);
+        }
+        if ('}' != *json) return;
+
+        for (size_t i = 0; NULL != result && i < array_count(requests); i++)
+            if (id == requests[i].rid && NULL == results[i]) {
+                results[i] = malloc (resultLength + 1);
+                memcpy (results[i], result, resultLength);
+                results[i][resultLength] = '\0';
+                break;
+            }
+
+        json = jsonSkipSpace(json + 1);
+        if (',' == *json) json = jsonSkipSpace(json + 1);
+    }
+}
+
+// Announce `result` (NULL on error) to each query of request `rid`.
+static void
+lightNodeAnnounceRequestResult (BREthereumLightNode node,
+                                int rid,
+                                const char *result) {
+    BREthereumJsonRpcQuery *queries;
+    array_new (queries, 1);
+
+    pthread_mutex_lock(&node->lock);
+    for (size_t i = 0; i < array_count(node->queries); )
+        if (rid == node->queries[i].rid) {
+            array_add (queries, node->queries[i]);
+            array_rm (node->queries, i);
+        }
+        else i++;
+    pthread_mutex_unlock(&node->lock);
+
+    if (NULL != result && 0 != strncmp (result, "0x", 2))
+        result = NULL;
+
+    // A quantity without its leading zeros; an eth_call result is a full 32 bytes.
+    char *quantity = NULL;
+    if (NULL != result) {
+        const char *digits = &result[2];
+        while ('0' == digits[0] && '\0' != digits[1]) digits++;
+        quantity = malloc (2 + strlen (digits) + 1);
+        sprintf (quantity, "0x%s", digits);
+    }
+
+    for (size_t i = 0; i < array_count(queries); i++) {
+        BREthereumJsonRpcQuery query = queries[i];
+
+        if (NULL == result) {
+            if (JSON_RPC_SUBMIT_TRANSACTION == query.type)
+                lightNodeListenerAnnounceTransactionEvent(node, query.tid, TRANSACTION_EVENT_ERRORED);
+            continue;
+        }
+
+        switch (query.type) {
+            case JSON_RPC_BALANCE:
+                lightNodeAnnounceBalance(node, query.wid, quantity, rid);
+                break;
+            case JSON_RPC_GAS_PRICE:
+                lightNodeAnnounceGasPrice(node, query.wid, quantity, rid);
+                break;
+            case JSON_RPC_GAS_ESTIMATE:
+                lightNodeAnnounceGasEstimate(node, query.tid, quantity, rid);
+                break;
+            case JSON_RPC_SUBMIT_TRANSACTION:
+                lightNodeAnnounceSubmitTransaction(node, query.wid, query.tid, result, rid);
+                break;
+        }
+    }
+
+    if (NULL != quantity) free (quantity);
+    array_free (queries);
+}
+
+extern void
+lightNodeAnnounceBatch (BREthereumLightNode node,
+                        int bid,
+                        const char *responses) {
+    BREthereumJsonRpcRequest *requests;
+    array_new (requests, node->configuration.u.json_rpc.batchSize);
+
+    // Take the batch's requests out of flight
+    pthread_mutex_lock(&node->lock);
+    for (size_t i = 0; i < array_count(node->requests); )
+        if (bid == node->requests[i].bid) {
+            array_add (requests, node->requests[i]);
+            array_rm (node->requests, i);
+        }
+        else i++;
+    if (array_count(requests) > 0) node->batchesInFlight--;
+    pthread_mutex_unlock(&node->lock);
+
+    char **results = calloc (array_count(requests) + 1, sizeof (char *));
+    if (NULL != responses)
+        lightNodeParseBatch(responses, requests, results);
+
+    for (size_t i = 0; i < array_count(requests); i++) {
+        lightNodeAnnounceRequestResult(node, requests[i].rid, results[i]);
+        if (NULL != results[i]) free (results[i]);
+        free (requests[i].members);
+    }
+
+    free (results);
+    array_free (requests);
+
+    lightNodeSendBatches(node, 0);
+}
+
 extern void
 lightNodeFillTransactionRawData(BREthereumLightNode node,
                                 BREthereumLightNodeWalletId wid,
@@ -926,7 +1399,8 @@ lightNodeAnnounceBlock(BREthereumLightNode node,
                        const char *strBlockNumber,
                        const char *strBlockHash,
                        const char *strBlockConfirmations,
-                       const char *strBlockTimestamp) {
+                       const char *strBlockTimestamp,
+                       int save) {
     // Build a block-ish
     BREthereumHash blockHash = hashCreate (strBlockHash);
     BREthereumBlock block = lightNodeLookupBlock(node, blockHash);
@@ -937,6 +1411,10 @@ lightNodeAnnounceBlock(BREthereumLightNode node,
 
         block = createBlock(blockHash, blockNumber, blockConfirmations, blockTimestamp);
         lightNodeInsertBlock(node, block);
+
+        if (save && NULL != node->store.funcSaveBlock)
+            node->store.funcSaveBlock (node->store.context, node,
+                                       strBlockHash, blockNumber, blockTimestamp);
     }
     else {
         // confirm
@@ -988,25 +1466,57 @@ lightNodeAnnounceWallet(BREthereumLightNode node,
     return lightNodeLookupWallet(node, wid);
 }
 
-extern void
-lightNodeAnnounceTransaction(BREthereumLightNode node,
-                             int id,
-                             const char *hashString,
-                             const char *from,
-                             const char *to,
-                             const char *contract,
-                             const char *amountString, // value
-                             const char *gasLimitString,
-                             const char *gasPriceString,
-                             const char *data,
-                             const char *nonce,
-                             const char *strGasUsed,
-                             const char *blockNumber,
-                             const char *blockHash,
-                             const char *blockConfirmations,
-                             const char *strBlockTransactionIndex,
-                             const char *blockTimestamp,
-                             const char *isError) {
+//
+// A transaction is saved as the RLP list of the strings it was announced with, in order.
+//
+#define LIGHT_NODE_TRANSACTION_FIELDS  (16)
+
+static void
+lightNodeSaveTransaction (BREthereumLightNode node,
+                          const char *fields[LIGHT_NODE_TRANSACTION_FIELDS],
+                          uint64_t blockNumber) {
+    size_t payloadCount = 0;
+    for (int i = 0; i < LIGHT_NODE_TRANSACTION_FIELDS; i++)
+        payloadCount += rlpSizeString(fields[i]);
+
+    size_t bytesCount = rlpSizeList(payloadCount);
+    uint8_t *bytes = malloc (bytesCount);
+
+    BRRlpWriter writer = rlpWriterCreate(bytes, bytesCount);
+    rlpWriteListHeader(&writer, payloadCount);
+    for (int i = 0; i < LIGHT_NODE_TRANSACTION_FIELDS; i++)
+        rlpWriteString(&writer, fields[i]);
+    assert (rlpWriterIsComplete(&writer));
+
+    node->store.funcSaveTransaction (node->store.context, node,
+                                     fields[0], blockNumber, bytes, bytesCount);
+    free (bytes);
+}
+
+static void
+lightNodeAnnounceTransactionInternal(BREthereumLightNode node,
+                                     const char *hashString,
+                                     const char *from,
+                                     const char *to,
+                                     const char *contract,
+                                     const char *amountString, // value
+                                     const char *gasLimitString,
+                                     const char *gasPriceString,
+                                     const char *data,
+                                     const char *nonce,
+                                     const char *strGasUsed,
+                                     const char *blockNumber,
+                                     const char *blockHash,
+                                     const char *blockConfirmations,
+                                     const char *strBlockTransactionIndex,
+                                     const char *blockTimestamp,
+                                     const char *isError,
+                                     int save) {
+    const char *fields[LIGHT_NODE_TRANSACTION_FIELDS] = {
+        hashString, from, to, contract, amountString, gasLimitString, gasPriceString, data,
+        nonce, strGasUsed, blockNumber, blockHash, blockConfirmations, strBlockTransactionIndex,
+        blockTimestamp, isError
+    };
     BREthereumTransaction transaction = NULL;
     BREthereumAddress primaryAddress = accountGetPrimaryAddress(node->account);
     int newTransaction = 0;
@@ -1043,7 +1553,7 @@ lightNodeAnnounceTransaction(BREthereumLightNode node,
     }
     
     // Find or create a block.  No point is doing this until we have a transaction of interest
-    BREthereumBlock block = lightNodeAnnounceBlock(node, blockNumber, blockHash, blockConfirmations, blockTimestamp);
+    BREthereumBlock block = lightNodeAnnounceBlock(node, blockNumber, blockHash, blockConfirmations, blockTimestamp, save);
     assert (NULL != block);
     
     // The transaction's index within the block.
@@ -1158,9 +1668,39 @@ lightNodeAnnounceTransaction(BREthereumLightNode node,
     if (TRANSACTION_BLOCKED != status) {
         BREthereumLightNodeTransactionId tid = lightNodeLookupTransactionId(node, transaction);
         lightNodeListenerAnnounceTransactionEvent(node, tid, TRANSACTION_EVENT_BLOCKED);
+
+        // Once blocked, a transaction is saved; a repeated announcement is not.
+        if (save && NULL != node->store.funcSaveTransaction)
+            lightNodeSaveTransaction(node, fields, blockGetNumber(block));
     }
 }
 
+extern void
+lightNodeAnnounceTransaction(BREthereumLightNode node,
+                             int id,
+                             const char *hashString,
+                             const char *from,
+                             const char *to,
+                             const char *contract,
+                             const char *amountString, // value
+                             const char *gasLimitString,
+                             const char *gasPriceString,
+                             const char *data,
+                             const char *nonce,
+                             const char *strGasUsed,
+                             const char *blockNumber,
+                             const char *blockHash,
+                             const char *blockConfirmations,
+                             const char *strBlockTransactionIndex,
+                             const char *blockTimestamp,
+                             const char *isError) {
+    lightNodeAnnounceTransactionInternal(node, hashString, from, to, contract, amountString,
+                                         gasLimitString, gasPriceString, data, nonce, strGasUsed,
+                                         blockNumber, blockHash, blockConfirmations,
+                                         strBlockTransactionIndex, blockTimestamp, isError,
+                                         1);
+}
+
 //  {
 //    "blockNumber":"1627184",
 //    "timeStamp":"1516477482",
@@ -1181,11 +1721,11 @@ lightNodeAnnounceTransaction(BREthereumLightNode node,
 //    "gasUsed":"21000",
 //    "confirmations":"339050"}
 
-extern void
-lightNodeAnnounceBalance (BREthereumLightNode node,
-                          BREthereumLightNodeWalletId wid,
-                          const char *balance,
-                          int rid) {
+static void
+lightNodeAnnounceBalanceInternal (BREthereumLightNode node,
+                                  BREthereumLightNodeWalletId wid,
+                                  const char *balance,
+                                  int save) {
     BRCoreParseStatus status;
 
     assert (0 == strncmp (balance, "0x", 2));
@@ -1198,10 +1738,25 @@ lightNodeAnnounceBalance (BREthereumLightNode node,
                                : amountCreateToken(createTokenQuantity(walletGetToken(wallet), value)));
 
     walletSetBalance (wallet, amount);
+
+    if (save && NULL != node->store.funcSaveBalance)
+        node->store.funcSaveBalance (node->store.context, node,
+                                     (AMOUNT_ETHER == walletGetAmountType(wallet)
+                                      ? NULL
+                                      : tokenGetAddress(walletGetToken(wallet))),
+                                     balance);
     pthread_mutex_unlock(&node->lock);
     lightNodeListenerAnnounceWalletEvent(node, wid, WALLET_EVENT_BALANCE_UPDATED);
 }
 
+extern void
+lightNodeAnnounceBalance (BREthereumLightNode node,
+                          BREthereumLightNodeWalletId wid,
+                          const char *balance,
+                          int rid) {
+    lightNodeAnnounceBalanceInternal(node, wid, balance, 1);
+}
+
 extern void
 lightNodeAnnounceGasPrice (BREthereumLightNode node,
                            BREthereumLightNodeWalletId wid,
@@ -1254,6 +1809,85 @@ lightNodeAnnounceSubmitTransaction(BREthereumLightNode node,
     lightNodeListenerAnnounceTransactionEvent(node, tid, TRANSACTION_EVENT_SUBMITTED);
 }
 
+//
+// Restore
+//
+extern void
+lightNodeRestoreBlock (BREthereumLightNode node,
+                       const char *hash,
+                       uint64_t blockNumber,
+                       uint64_t blockTimestamp) {
+    BREthereumHash blockHash = hashCreate (hash);
+
+    pthread_mutex_lock(&node->lock);
+    if (NULL == lightNodeLookupBlock(node, blockHash))
+        lightNodeInsertBlock(node, createBlock(blockHash, blockNumber, 0, blockTimestamp));
+    pthread_mutex_unlock(&node->lock);
+    free (blockHash);
+}
+
+extern BREthereumBoolean
+lightNodeRestoreTransaction (BREthereumLightNode node,
+                             const uint8_t *bytes,
+                             size_t bytesCount) {
+    const char *fields[LIGHT_NODE_TRANSACTION_FIELDS];
+    BRRlpView list, item;
+    size_t offset = 0;
+
+    if (bytesCount != rlpDecodeView(bytes, bytesCount, &list)
+        || RLP_VIEW_LIST != list.type
+        || LIGHT_NODE_TRANSACTION_FIELDS != rlpViewListCount(list))
+        return ETHEREUM_BOOLEAN_FALSE;
+
+    // The fields, each NUL-terminated, fit in the size of their encoding plus a byte each.
+    char *strings = malloc (bytesCount + LIGHT_NODE_TRANSACTION_FIELDS);
+    char *string = strings;
+
+    for (int i = 0; i < LIGHT_NODE_TRANSACTION_FIELDS; i++) {
+        rlpViewListNext(list, &offset, &item);
+        if (RLP_VIEW_ITEM != item.type) {
+            free (strings);
+            return ETHEREUM_BOOLEAN_FALSE;
+        }
+        memcpy (string, item.bytes, item.bytesCount);
+        string[item.bytesCount] = '\0';
+        fields[i] = string;
+        string += item.bytesCount + 1;
+    }
+
+    // Saved by another account's node?
+    BREthereumAddress primaryAddress = accountGetPrimaryAddress(node->account);
+    if (ETHEREUM_BOOLEAN_IS_FALSE(addressHasString(primaryAddress, fields[1]))
+        && ETHEREUM_BOOLEAN_IS_FALSE(addressHasString(primaryAddress, fields[2]))) {
+        free (strings);
+        return ETHEREUM_BOOLEAN_FALSE;
+    }
+
+    lightNodeAnnounceTransactionInternal(node, fields[0], fields[1], fields[2], fields[3],
+                                         fields[4], fields[5], fields[6], fields[7], fields[8],
+                                         fields[9], fields[10], fields[11], fields[12],
+                                         fields[13], fields[14], fields[15],
+                                         0);
+    free (strings);
+    return ETHEREUM_BOOLEAN_TRUE;
+}
+
+extern BREthereumBoolean
+lightNodeRestoreBalance (BREthereumLightNode node,
+                         const char *token,
+                         const char *balance) {
+    BREthereumToken holding = NULL;
+
+    if (NULL == balance || 0 != strncmp (balance, "0x", 2)) return ETHEREUM_BOOLEAN_FALSE;
+    if (NULL != token && NULL == (holding = tokenLookup(token))) return ETHEREUM_BOOLEAN_FALSE;
+
+    BREthereumLightNodeWalletId wid = (NULL == holding
+                                       ? lightNodeGetWallet(node)
+                                       : lightNodeCreateWalletHoldingToken(node, holding));
+    lightNodeAnnounceBalanceInternal(node, wid, balance, 0);
+    return ETHEREUM_BOOLEAN_TRUE;
+}
+
 #endif // ETHEREUM_LIGHT_NODE_USE_JSON_RPC
 
 extern char *
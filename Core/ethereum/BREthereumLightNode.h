@@ -120,6 +120,36 @@ typedef void (*BREthereumLightNodeListenerTransactionEventHandler) (BREthereumLi
                                                                     BREthereumLightNodeTransactionId tid,
                                                                     BREthereumLightNodeTransactionEvent event);
 
+//
+// Store
+//
+// Type definitions for the functions of a client's persistent store.  A node with a store hands
+// it each transaction it announces, each block it creates and each balance it is told; the client
+// saves them, keyed as given, and hands them back with lightNodeRestore{Block,Transaction,Balance}()
+// before lightNodeConnect().  A transaction is an opaque encoding, to be kept as bytes.
+//
+typedef void *BREthereumLightNodeStoreContext;
+
+typedef void (*BREthereumLightNodeStoreSaveTransaction) (BREthereumLightNodeStoreContext context,
+                                                         BREthereumLightNode node,
+                                                         const char *hash,
+                                                         uint64_t blockNumber,
+                                                         const uint8_t *bytes,
+                                                         size_t bytesCount);
+
+typedef void (*BREthereumLightNodeStoreSaveBlock) (BREthereumLightNodeStoreContext context,
+                                                   BREthereumLightNode node,
+                                                   const char *hash,
+                                                   uint64_t blockNumber,
+                                                   uint64_t blockTimestamp);
+
+// `token` is the token's contract address, or NULL for the wallet holding ETHER; `balance` is
+// '0x'-prefixed hex.
+typedef void (*BREthereumLightNodeStoreSaveBalance) (BREthereumLightNodeStoreContext context,
+                                                     BREthereumLightNode node,
+                                                     const char *token,
+                                                     const char *balance);
+
 
 //
 // JSON RPC Support
@@ -159,11 +189,26 @@ typedef void (*JsonRpcSubmitTransaction) (JsonRpcContext context,
                                           const char *transaction,
                                           int rid);
 
+// Only the transactions from block lightNodeGetBlockNumber() on need be announced; those of
+// earlier blocks are already known to the node, from the network or restored from a store.
 typedef void (*JsonRpcGetTransactions) (JsonRpcContext context,
                                         BREthereumLightNode node,
                                         const char *address,
                                         int rid);
 
+//
+// Type definition for the batch callback.  When batching is configured the balance, gas price,
+// gas estimate and submit queries are not made with the above functions; instead they are
+// collected, across wallets, into a JSON_RPC batch - a JSON array of request objects, each with
+// its `id` - which this function is to POST.  The response array, as returned by the server
+// and in any order, is handed back with lightNodeAnnounceBatch(..., bid, ...).  JsonRpcGetTransactions
+// is not a JSON_RPC method and is always called directly.
+//
+typedef void (*JsonRpcSendBatch) (JsonRpcContext context,
+                                  BREthereumLightNode node,
+                                  const char *batch,
+                                  int bid);
+
 
 //
 // Two types of LightNode - JSON_RPC or LES (Light Ethereum Subprotocol).
@@ -192,6 +237,12 @@ typedef struct {
       JsonRpcEstimateGas funcEstimateGas;
       JsonRpcSubmitTransaction funcSubmitTransaction;
       JsonRpcGetTransactions funcGetTransactions;
+
+      // Batching; used when funcSendBatch is not NULL
+      JsonRpcSendBatch funcSendBatch;
+      unsigned int batchSize;               // requests per batch
+      unsigned int batchesInFlight;         // batches sent and not yet announced
+      unsigned int batchFlushMilliseconds;  // to send a partial batch
     } json_rpc;
 
     //
@@ -221,6 +272,19 @@ lightNodeConfigurationCreateJSON_RPC(BREthereumNetwork network,
                                      JsonRpcSubmitTransaction funcSubmitTransaction,
                                      JsonRpcGetTransactions funcGetTransactions);
 
+/**
+ * Have a JSON_RPC configuration batch its queries: up to `batchSize` requests are sent, as one
+ * JSON_RPC batch, to `funcSendBatch`; at most `batchesInFlight` batches await their response.
+ * A partial batch is sent `batchFlushMilliseconds` after the connected node's queries are made.
+ * Identical queries that are not yet sent are coalesced into one request.
+ */
+extern void
+lightNodeConfigurationSetJSON_RPCBatching (BREthereumLightNodeConfiguration *configuration,
+                                           JsonRpcSendBatch funcSendBatch,
+                                           unsigned int batchSize,
+                                           unsigned int batchesInFlight,
+                                           unsigned int batchFlushMilliseconds);
+
 //
 // Light Node
 //
@@ -301,6 +365,22 @@ extern BREthereumBoolean
 lightNodeRemoveListener (BREthereumLightNode node,
                          BREthereumLightNodeListenerId lid);
 
+//
+// Store
+//
+extern void
+lightNodeSetStore (BREthereumLightNode node,
+                   BREthereumLightNodeStoreContext context,
+                   BREthereumLightNodeStoreSaveTransaction funcSaveTransaction,
+                   BREthereumLightNodeStoreSaveBlock funcSaveBlock,
+                   BREthereumLightNodeStoreSaveBalance funcSaveBalance);
+
+/**
+ * The number of the latest block known to the node, announced or restored; 0 if none.
+ */
+extern uint64_t
+lightNodeGetBlockNumber (BREthereumLightNode node);
+
 /**
  * Get the wallet for `account` holding ETHER.  This wallet is created, along with the account,
  * when a light node itself is created.
@@ -513,6 +593,13 @@ extern void
 lightNodeUpdateWalletDefaultGasPrice (BREthereumLightNode node,
                                       BREthereumLightNodeWalletId wid);
 
+/**
+ * Send the queued queries of a batching JSON_RPC light node now, including a partial batch,
+ * as the in-flight limit allows.
+ */
+extern void
+lightNodeFlushBatch (BREthereumLightNode node);
+
 
 /**
  * Return the serialized raw data for `transaction`.  The value `*bytesPtr` points to a byte array;
@@ -588,6 +675,44 @@ lightNodeAnnounceSubmitTransaction(BREthereumLightNode node,
                                    const char *hash,
                                    int rid);
 
+/**
+ * Announce the JSON_RPC response array for batch `bid`.  Each `result` is announced as by the
+ * functions above; a request with an `error`, or no response at all, is dropped (a submitted
+ * transaction is announced as TRANSACTION_EVENT_ERRORED).  A NULL `responses` fails the batch.
+ */
+extern void
+lightNodeAnnounceBatch (BREthereumLightNode node,
+                        int bid,
+                        const char *responses);
+
+//
+// Restore, from a store, what was saved by BREthereumLightNodeStoreSave{Block,Transaction,Balance}.
+// These announce as their lightNodeAnnounce*() counterparts but are not saved again.  Restore
+// blocks first, then transactions, then balances.
+//
+extern void
+lightNodeRestoreBlock (BREthereumLightNode node,
+                       const char *hash,
+                       uint64_t blockNumber,
+                       uint64_t blockTimestamp);
+
+/**
+ * Restore the transaction with `bytes` as saved; return FALSE if `bytes` is not such an encoding.
+ */
+extern BREthereumBoolean
+lightNodeRestoreTransaction (BREthereumLightNode node,
+                             const uint8_t *bytes,
+                             size_t bytesCount);
+
+/**
+ * Restore the balance of the wallet holding `token`, or ETHER if NULL; the wallet is created
+ * as needed.  Return FALSE for an unknown token.
+ */
+extern BREthereumBoolean
+lightNodeRestoreBalance (BREthereumLightNode node,
+                         const char *token,
+                         const char *balance);
+
 #endif // ETHEREUM_LIGHT_NODE_USE_JSON_RPC
 
 extern char * // receiver, target
@@ -381,38 +381,57 @@ transactionGetHash (BREthereumTransaction transaction) {
 //
 // RLP
 //
-static BRRlpItem
-transactionEncodeDataForHolding (BREthereumTransaction transaction,
-                                 BREthereumAmount holding,
-                                 BRRlpCoder coder) {
-    return (NULL == transaction->data || 0 == strlen(transaction->data)
-            ? rlpEncodeItemString(coder, "")
-            : rlpEncodeItemHexString(coder, transaction->data));
-}
-
-static BRRlpItem
-transactionEncodeAddressForHolding (BREthereumTransaction transaction,
-                                    BREthereumAmount holding,
-                                    BRRlpCoder coder) {
+// The transaction is encoded with the streaming encoder: every field is sized, the list is
+// allocated once and each field is then written straight into it.
+//
+static const char *
+transactionGetAddressStringForHolding (BREthereumTransaction transaction,
+                                       BREthereumAmount holding) {
     switch (amountGetType(holding)) {
         case AMOUNT_ETHER:
-            return addressRlpEncode(transaction->targetAddress, coder);
-        case AMOUNT_TOKEN: {
-            BREthereumToken token = tokenQuantityGetToken (amountGetTokenQuantity(holding));
-            BREthereumAddress contractAddress = createAddress(tokenGetAddress(token));
-            BRRlpItem result = addressRlpEncode(contractAddress, coder);
-            addressFree(contractAddress);
-            return result;
-        }
+            return NULL;
+        case AMOUNT_TOKEN:
+            // The contract's address, as a string; no need to create the BREthereumAddress
+            return tokenGetAddress (tokenQuantityGetToken (amountGetTokenQuantity(holding)));
     }
 }
 
-static BRRlpItem
-transactionEncodeHolding (BREthereumTransaction transaction,
-                          BREthereumAmount holding,
-                          BRRlpCoder coder) {
-    // Holding already handles ETHER vs TOKEN.
-    return amountRlpEncode(holding, coder);
+static size_t
+transactionSizeAddressForHolding (BREthereumTransaction transaction,
+                                  BREthereumAmount holding) {
+    const char *contractAddress = transactionGetAddressStringForHolding(transaction, holding);
+    return (NULL == contractAddress
+            ? addressRlpSize(transaction->targetAddress)
+            : rlpSizeHexString(contractAddress));
+}
+
+static void
+transactionWriteAddressForHolding (BREthereumTransaction transaction,
+                                   BREthereumAmount holding,
+                                   BRRlpWriter *writer) {
+    const char *contractAddress = transactionGetAddressStringForHolding(transaction, holding);
+    if (NULL == contractAddress)
+        addressRlpWrite(transaction->targetAddress, writer);
+    else
+        rlpWriteHexString(writer, contractAddress);
+}
+
+static size_t
+transactionSizeDataForHolding (BREthereumTransaction transaction,
+                               BREthereumAmount holding) {
+    return (NULL == transaction->data || 0 == strlen(transaction->data)
+            ? rlpSizeString("")
+            : rlpSizeHexString(transaction->data));
+}
+
+static void
+transactionWriteDataForHolding (BREthereumTransaction transaction,
+                                BREthereumAmount holding,
+                                BRRlpWriter *writer) {
+    if (NULL == transaction->data || 0 == strlen(transaction->data))
+        rlpWriteString(writer, "");
+    else
+        rlpWriteHexString(writer, transaction->data);
 }
 
 extern BRRlpData
@@ -420,19 +439,6 @@ transactionEncodeRLP (BREthereumTransaction transaction,
                       BREthereumNetwork network,
                       BREthereumTransactionRLPType type) {
 
-    BRRlpCoder coder = rlpCoderCreate();
-
-    BRRlpItem items[10];
-    size_t itemsCount = 0;
-
-    items[0] = rlpEncodeItemUInt64(coder, transaction->nonce);
-    items[1] = gasPriceRlpEncode(transaction->gasPrice, coder);
-    items[2] = gasRlpEncode(transaction->gasLimit, coder);
-    items[3] = transactionEncodeAddressForHolding(transaction, transaction->amount, coder);
-    items[4] = transactionEncodeHolding(transaction, transaction->amount, coder);
-    items[5] = transactionEncodeDataForHolding(transaction, transaction->amount, coder);
-    itemsCount = 6;
-
     // EIP-155:
     // If block.number >= FORK_BLKNUM and v = CHAIN_ID * 2 + 35 or v = CHAIN_ID * 2 + 36, then when
     // computing the hash of a transaction for purposes of signing or recovering, instead of hashing
@@ -443,35 +449,68 @@ transactionEncodeRLP (BREthereumTransaction transaction,
 
     transaction->chainId = networkGetChainId(network);
 
+    uint64_t v = 0;
     switch (type) {
         case TRANSACTION_RLP_UNSIGNED:
             // For EIP-155, encode { v, r, s } with v as the chainId and both r and s as empty.
-            items[6] = rlpEncodeItemUInt64(coder, transaction->chainId);
-            items[7] = rlpEncodeItemString(coder, "");
-            items[8] = rlpEncodeItemString(coder, "");
-            itemsCount += 3;
+            v = transaction->chainId;
             break;
 
         case TRANSACTION_RLP_SIGNED:
             // For EIP-155, encode v with the chainID.
-            items[6] = rlpEncodeItemUInt64(coder, transaction->signature.sig.recoverable.v + 8 + 2 * transaction->chainId);
+            v = transaction->signature.sig.recoverable.v + 8 + 2 * transaction->chainId;
+            break;
+    }
+
+    const uint8_t *r = transaction->signature.sig.recoverable.r;
+    const uint8_t *s = transaction->signature.sig.recoverable.s;
+    size_t rsCount = sizeof (transaction->signature.sig.recoverable.r);
+    assert (sizeof (transaction->signature.sig.recoverable.s) == rsCount);
 
-            items[7] = rlpEncodeItemBytes (coder,
-                                           transaction->signature.sig.recoverable.r,
-                                           sizeof (transaction->signature.sig.recoverable.r));
+    // Pass 1: the size of each item and so of the list.
+    size_t payloadCount = (rlpSizeUInt64(transaction->nonce) +
+                           gasPriceRlpSize(transaction->gasPrice) +
+                           gasRlpSize(transaction->gasLimit) +
+                           transactionSizeAddressForHolding(transaction, transaction->amount) +
+                           amountRlpSize(transaction->amount) +
+                           transactionSizeDataForHolding(transaction, transaction->amount) +
+                           rlpSizeUInt64(v));
 
-            items[8] = rlpEncodeItemBytes (coder,
-                                           transaction->signature.sig.recoverable.s,
-                                           sizeof (transaction->signature.sig.recoverable.s));
-            itemsCount += 3;
+    switch (type) {
+        case TRANSACTION_RLP_UNSIGNED:
+            payloadCount += 2 * rlpSizeString("");
+            break;
+        case TRANSACTION_RLP_SIGNED:
+            payloadCount += rlpSizeBytes(r, rsCount) + rlpSizeBytes(s, rsCount);
             break;
     }
 
-    BRRlpItem encoding = rlpEncodeListItems(coder, items, itemsCount);
+    // Pass 2: write the list into one allocation.
     BRRlpData result;
+    result.bytesCount = rlpSizeList(payloadCount);
+    result.bytes = malloc (result.bytesCount);
+
+    BRRlpWriter writer = rlpWriterCreate(result.bytes, result.bytesCount);
+    rlpWriteListHeader(&writer, payloadCount);
+    rlpWriteUInt64(&writer, transaction->nonce);
+    gasPriceRlpWrite(transaction->gasPrice, &writer);
+    gasRlpWrite(transaction->gasLimit, &writer);
+    transactionWriteAddressForHolding(transaction, transaction->amount, &writer);
+    amountRlpWrite(transaction->amount, &writer);
+    transactionWriteDataForHolding(transaction, transaction->amount, &writer);
+    rlpWriteUInt64(&writer, v);
 
-    rlpGetData(coder, encoding, &result.bytes, &result.bytesCount);
-    rlpCoderRelease(coder);
+    switch (type) {
+        case TRANSACTION_RLP_UNSIGNED:
+            rlpWriteString(&writer, "");
+            rlpWriteString(&writer, "");
+            break;
+        case TRANSACTION_RLP_SIGNED:
+            rlpWriteBytes(&writer, r, rsCount);
+            rlpWriteBytes(&writer, s, rsCount);
+            break;
+    }
+    assert (rlpWriterIsComplete(&writer));
 
     return result;
 }
@@ -0,0 +1,84 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <string.h>
+
+#include "EthereumLightNodeStore.h"
+#include "Log.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		EthereumLightNodeStore::EthereumLightNodeStore(DatabaseManager *databaseManager, const std::string &iso) :
+			_databaseManager(databaseManager),
+			_iso(iso) {
+		}
+
+		EthereumLightNodeStore::~EthereumLightNodeStore() {
+		}
+
+		void EthereumLightNodeStore::Attach(BREthereumLightNode node) {
+			// restored entities are not saved again, so the store may be set either side of this
+			restore(node);
+			lightNodeSetStore(node, this, saveTransaction, saveBlock, saveBalance);
+		}
+
+		void EthereumLightNodeStore::restore(BREthereumLightNode node) {
+			std::vector<EthereumBlockEntity> blocks = _databaseManager->getAllEthereumBlocks(_iso);
+			for (size_t i = 0; i < blocks.size(); ++i)
+				lightNodeRestoreBlock(node, blocks[i].blockHash.c_str(), blocks[i].blockNumber, blocks[i].timeStamp);
+
+			std::vector<EthereumTransactionEntity> transactions = _databaseManager->getAllEthereumTransactions(_iso);
+			for (size_t i = 0; i < transactions.size(); ++i) {
+				const CMBlock &buff = transactions[i].buff;
+				if (ETHEREUM_BOOLEAN_IS_FALSE(lightNodeRestoreTransaction(node, buff, buff.GetSize())))
+					Log::getLogger(Log::Database)->warn("skip unreadable ethereum transaction {}",
+														transactions[i].txHash);
+			}
+
+			std::vector<EthereumBalanceEntity> balances = _databaseManager->getAllEthereumBalances(_iso);
+			for (size_t i = 0; i < balances.size(); ++i) {
+				const char *token = balances[i].token.empty() ? NULL : balances[i].token.c_str();
+				if (ETHEREUM_BOOLEAN_IS_FALSE(lightNodeRestoreBalance(node, token, balances[i].balance.c_str())))
+					Log::getLogger(Log::Database)->warn("skip balance of unknown token {}", balances[i].token);
+			}
+		}
+
+		void EthereumLightNodeStore::saveTransaction(BREthereumLightNodeStoreContext context,
+													 BREthereumLightNode node,
+													 const char *hash,
+													 uint64_t blockNumber,
+													 const uint8_t *bytes,
+													 size_t bytesCount) {
+			EthereumLightNodeStore *store = (EthereumLightNodeStore *) context;
+
+			CMBlock buff;
+			buff.Resize(bytesCount);
+			memcpy(buff, bytes, bytesCount);
+
+			store->_databaseManager->putEthereumTransaction(store->_iso,
+															EthereumTransactionEntity(buff, blockNumber, hash));
+		}
+
+		void EthereumLightNodeStore::saveBlock(BREthereumLightNodeStoreContext context,
+											   BREthereumLightNode node,
+											   const char *hash,
+											   uint64_t blockNumber,
+											   uint64_t blockTimestamp) {
+			EthereumLightNodeStore *store = (EthereumLightNodeStore *) context;
+			store->_databaseManager->putEthereumBlock(store->_iso,
+													  EthereumBlockEntity(blockNumber, blockTimestamp, hash));
+		}
+
+		void EthereumLightNodeStore::saveBalance(BREthereumLightNodeStoreContext context,
+												 BREthereumLightNode node,
+												 const char *token,
+												 const char *balance) {
+			EthereumLightNodeStore *store = (EthereumLightNodeStore *) context;
+			store->_databaseManager->putEthereumBalance(store->_iso,
+														EthereumBalanceEntity(token == NULL ? "" : token, balance));
+		}
+
+	}
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_ETHEREUMLIGHTNODESTORE_H__
+#define __ELASTOS_SDK_ETHEREUMLIGHTNODESTORE_H__
+
+#include <string>
+
+#include "BREthereumLightNode.h"
+#include "DatabaseManager.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/*
+		 * Keeps what a light node saves in the DatabaseManager of the client, under iso, and gives it
+		 * back when the node is created again. Lives with the client, which links both the light node
+		 * and the SDK; the SDK library itself does not build Core/ethereum.
+		 */
+		class EthereumLightNodeStore {
+		public:
+			EthereumLightNodeStore(DatabaseManager *databaseManager, const std::string &iso = "ETH");
+			~EthereumLightNodeStore();
+
+			// Restores blocks, then transactions, then balances into node and makes this its store;
+			// call before lightNodeConnect(). Must outlive the node.
+			void Attach(BREthereumLightNode node);
+
+		private:
+			void restore(BREthereumLightNode node);
+
+			static void saveTransaction(BREthereumLightNodeStoreContext context,
+										BREthereumLightNode node,
+										const char *hash,
+										uint64_t blockNumber,
+										const uint8_t *bytes,
+										size_t bytesCount);
+
+			static void saveBlock(BREthereumLightNodeStoreContext context,
+								  BREthereumLightNode node,
+								  const char *hash,
+								  uint64_t blockNumber,
+								  uint64_t blockTimestamp);
+
+			static void saveBalance(BREthereumLightNodeStoreContext context,
+									BREthereumLightNode node,
+									const char *token,
+									const char *balance);
+
+		private:
+			DatabaseManager *_databaseManager;
+			std::string _iso;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_ETHEREUMLIGHTNODESTORE_H__
@@ -473,6 +473,298 @@ rlpDataRelease (BRRlpData data) {
     data.bytes = NULL;
 }
 
+//
+// Streaming Encoder
+//
+
+/**
+ * Return the bytes coderEncodeLength() produces for `length`: one, or one plus the big_endian
+ * bytes of `length` from 56 up.
+ */
+static size_t
+writerLengthSize (uint64_t length) {
+    size_t size = 1;
+    if (length >= 56)
+        for (; length > 0; length >>= 8) size++;
+    return size;
+}
+
+/**
+ * Return the bytes coderEncodeBytes() produces for `bytesCount` bytes starting with `firstByte`.
+ */
+static size_t
+writerBytesSize (uint8_t firstByte, size_t bytesCount) {
+    return (1 == bytesCount && firstByte < 0x80
+            ? 1
+            : writerLengthSize(bytesCount) + bytesCount);
+}
+
+/**
+ * Reserve `bytesCount` bytes of `writer` and return them; NULL, and nothing reserved, if they
+ * do not fit.
+ */
+static uint8_t *
+writerReserve (BRRlpWriter *writer, size_t bytesCount) {
+    if (writer->bytesIndex + bytesCount > writer->bytesCount) return NULL;
+
+    uint8_t *bytes = &writer->bytes[writer->bytesIndex];
+    writer->bytesIndex += bytesCount;
+    return bytes;
+}
+
+static void
+writerPutLength (BRRlpWriter *writer, uint64_t length, uint8_t baseline) {
+    size_t size = writerLengthSize(length);
+    uint8_t *target = writerReserve(writer, size);
+    if (NULL == target) return;
+
+    if (1 == size)
+        target[0] = baseline + length;
+    else {
+        target[0] = baseline + 55 + (size - 1);
+        for (size_t i = size - 1; i > 0; i--, length >>= 8)
+            target[i] = (uint8_t) length;
+    }
+}
+
+static void
+writerPutBytes (BRRlpWriter *writer, const uint8_t *bytes, size_t bytesCount) {
+    if (1 == bytesCount && bytes[0] < 0x80) {
+        uint8_t *target = writerReserve(writer, 1);
+        if (NULL != target) target[0] = bytes[0];
+    }
+    else {
+        size_t index = writer->bytesIndex;
+        writerPutLength(writer, bytesCount, 0x80);
+        uint8_t *target = writerReserve(writer, bytesCount);
+        if (NULL == target) { writer->bytesIndex = index; return; }
+        if (bytesCount > 0) memcpy (target, bytes, bytesCount);
+    }
+}
+
+extern BRRlpWriter
+rlpWriterCreate (uint8_t *bytes, size_t bytesCount) {
+    BRRlpWriter writer;
+    writer.bytes = bytes;
+    writer.bytesCount = bytesCount;
+    writer.bytesIndex = 0;
+    return writer;
+}
+
+extern int
+rlpWriterIsComplete (BRRlpWriter *writer) {
+    return writer->bytesIndex == writer->bytesCount;
+}
+
+extern size_t
+rlpSizeUInt64 (uint64_t value) {
+    if (0 == value) return 1;
+
+    uint8_t bytes [sizeof (uint64_t)];
+    size_t bytesIndex, bytesCount;
+    coderConvertToBigEndianAndNormalize (bytes, (uint8_t *) &value, sizeof (uint64_t), &bytesIndex, &bytesCount);
+    return writerBytesSize(bytes[bytesIndex], bytesCount);
+}
+
+extern size_t
+rlpSizeUInt256 (UInt256 value) {
+    uint8_t bytes [sizeof (UInt256)];
+    size_t bytesIndex, bytesCount;
+    coderConvertToBigEndianAndNormalize (bytes, (uint8_t *) &value, sizeof (UInt256), &bytesIndex, &bytesCount);
+    return writerBytesSize(bytes[bytesIndex], bytesCount);
+}
+
+extern size_t
+rlpSizeBytes (const uint8_t *bytes, size_t bytesCount) {
+    return writerBytesSize(bytesCount > 0 ? bytes[0] : 0, bytesCount);
+}
+
+extern size_t
+rlpSizeString (const char *string) {
+    if (NULL == string) string = "";
+    return rlpSizeBytes((const uint8_t *) string, strlen (string));
+}
+
+extern size_t
+rlpSizeHexString (const char *string) {
+    if (NULL == string) return rlpSizeString(string);
+    if (0 == strncmp (string, "0x", 2)) string = &string[2];
+
+    size_t bytesCount = decodeHexLength(strlen (string));
+    if (1 != bytesCount) return writerBytesSize(0, bytesCount);
+
+    uint8_t byte;
+    decodeHex (&byte, 1, (char *) string, 2);
+    return writerBytesSize(byte, 1);
+}
+
+extern size_t
+rlpSizeList (size_t payloadCount) {
+    return writerLengthSize(payloadCount) + payloadCount;
+}
+
+extern void
+rlpWriteUInt64 (BRRlpWriter *writer, uint64_t value) {
+    if (0 == value) {
+        writerPutLength(writer, 0, 0x80);
+        return;
+    }
+
+    uint8_t bytes [sizeof (uint64_t)];
+    size_t bytesIndex, bytesCount;
+    coderConvertToBigEndianAndNormalize (bytes, (uint8_t *) &value, sizeof (uint64_t), &bytesIndex, &bytesCount);
+    writerPutBytes(writer, &bytes[bytesIndex], bytesCount);
+}
+
+extern void
+rlpWriteUInt256 (BRRlpWriter *writer, UInt256 value) {
+    uint8_t bytes [sizeof (UInt256)];
+    size_t bytesIndex, bytesCount;
+    coderConvertToBigEndianAndNormalize (bytes, (uint8_t *) &value, sizeof (UInt256), &bytesIndex, &bytesCount);
+    writerPutBytes(writer, &bytes[bytesIndex], bytesCount);
+}
+
+extern void
+rlpWriteBytes (BRRlpWriter *writer, const uint8_t *bytes, size_t bytesCount) {
+    writerPutBytes(writer, bytes, bytesCount);
+}
+
+extern void
+rlpWriteString (BRRlpWriter *writer, const char *string) {
+    if (NULL == string) string = "";
+    writerPutBytes(writer, (const uint8_t *) string, strlen (string));
+}
+
+extern void
+rlpWriteHexString (BRRlpWriter *writer, const char *string) {
+    if (NULL == string) {
+        rlpWriteString(writer, string);
+        return;
+    }
+    if (0 == strncmp (string, "0x", 2)) string = &string[2];
+
+    size_t stringCount = strlen (string);
+    size_t bytesCount = decodeHexLength(stringCount);
+    if (1 == bytesCount) {
+        uint8_t byte;
+        decodeHex (&byte, 1, (char *) string, 2);
+        writerPutBytes(writer, &byte, 1);
+        return;
+    }
+
+    size_t index = writer->bytesIndex;
+    writerPutLength(writer, bytesCount, 0x80);
+    uint8_t *target = writerReserve(writer, bytesCount);
+    if (NULL == target) { writer->bytesIndex = index; return; }
+    decodeHex (target, bytesCount, (char *) string, stringCount);
+}
+
+extern void
+rlpWriteListHeader (BRRlpWriter *writer, size_t payloadCount) {
+    writerPutLength(writer, payloadCount, 0xc0);
+}
+
+//
+// Zero-Copy Decoder
+//
+
+/**
+ * Return the big_endian number in the `count` bytes at `bytes`; count is at most 8.
+ */
+static uint64_t
+viewBigEndianNumber (const uint8_t *bytes, size_t count) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < count; i++)
+        value = (value << 8) | bytes[i];
+    return value;
+}
+
+extern size_t
+rlpDecodeView (const uint8_t *bytes, size_t bytesCount, BRRlpView *view) {
+    assert (NULL != view);
+    if (0 == bytesCount) return 0;
+
+    uint8_t prefix = bytes[0];
+    size_t headerCount, payloadCount;
+
+    if (prefix < 0x80) {
+        // The byte is its own encoding
+        view->type = RLP_VIEW_ITEM;
+        view->bytes = bytes;
+        view->bytesCount = 1;
+        return 1;
+    }
+
+    view->type = (prefix < 0xc0 ? RLP_VIEW_ITEM : RLP_VIEW_LIST);
+    uint8_t base = (prefix < 0xc0 ? 0x80 : 0xc0);
+
+    if (prefix - base < 56) {
+        headerCount = 1;
+        payloadCount = prefix - base;
+        // A single byte below 0x80 is encoded as itself, never with a header
+        if (RLP_VIEW_ITEM == view->type && 1 == payloadCount && bytesCount > 1 && bytes[1] < 0x80)
+            return 0;
+    }
+    else {
+        size_t lengthCount = prefix - base - 55;
+        if (lengthCount > sizeof (uint64_t) || bytesCount < 1 + lengthCount) return 0;
+        // The long form is only for lengths from 56 up, without leading zero bytes
+        if (0 == bytes[1]) return 0;
+        uint64_t length = viewBigEndianNumber(&bytes[1], lengthCount);
+        if (length < 56) return 0;
+
+        headerCount = 1 + lengthCount;
+        if (length > bytesCount - headerCount) return 0;
+        payloadCount = (size_t) length;
+    }
+
+    if (payloadCount > bytesCount - headerCount) return 0;
+
+    view->bytes = &bytes[headerCount];
+    view->bytesCount = payloadCount;
+    return headerCount + payloadCount;
+}
+
+extern int
+rlpViewListNext (BRRlpView list, size_t *offset, BRRlpView *item) {
+    assert (RLP_VIEW_LIST == list.type);
+    if (*offset >= list.bytesCount) return 0;
+
+    size_t count = rlpDecodeView(&list.bytes[*offset], list.bytesCount - *offset, item);
+    if (0 == count) return 0;
+
+    *offset += count;
+    return 1;
+}
+
+extern long
+rlpViewListCount (BRRlpView list) {
+    BRRlpView item;
+    size_t offset = 0;
+    long count = 0;
+
+    while (rlpViewListNext(list, &offset, &item)) count++;
+    return (offset == list.bytesCount ? count : -1);
+}
+
+extern int
+rlpViewUInt64 (BRRlpView view, uint64_t *value) {
+    if (RLP_VIEW_ITEM != view.type || view.bytesCount > sizeof (uint64_t)) return 0;
+    *value = viewBigEndianNumber(view.bytes, view.bytesCount);
+    return 1;
+}
+
+extern int
+rlpViewUInt256 (BRRlpView view, UInt256 *value) {
+    if (RLP_VIEW_ITEM != view.type || view.bytesCount > sizeof (UInt256)) return 0;
+
+    // UInt256 is little endian, as with coderEncodeUInt256()
+    *value = UINT256_ZERO;
+    for (size_t i = 0; i < view.bytesCount; i++)
+        value->u8[i] = view.bytes[view.bytesCount - 1 - i];
+    return 1;
+}
+
 /*
 def rlp_decode(input):
   if len(input) == 0:
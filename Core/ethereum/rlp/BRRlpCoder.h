@@ -90,7 +90,106 @@ createRlpDataEmpty (void);
 
 extern void
 rlpDataRelease (BRRlpData data);
-  
+
+//
+// Streaming Encoder
+//
+// Encode in two passes over the same values: the rlpSize*() functions return the bytes each
+// encoding takes, so that a list's payload and the total are known before anything is written;
+// the rlpWrite*() functions then write the encodings, in order, into one buffer.  Nothing is
+// allocated per item and the output is the same bytes as the BRRlpItem functions above.
+//
+typedef struct {
+    uint8_t *bytes;
+    size_t bytesCount;  // capacity of bytes
+    size_t bytesIndex;  // bytes written so far
+} BRRlpWriter;
+
+extern BRRlpWriter
+rlpWriterCreate (uint8_t *bytes, size_t bytesCount);
+
+// True if exactly bytesCount bytes were written; a write that does not fit is dropped.
+extern int
+rlpWriterIsComplete (BRRlpWriter *writer);
+
+extern size_t
+rlpSizeUInt64 (uint64_t value);
+
+extern size_t
+rlpSizeUInt256 (UInt256 value);
+
+extern size_t
+rlpSizeBytes (const uint8_t *bytes, size_t bytesCount);
+
+extern size_t
+rlpSizeString (const char *string);
+
+extern size_t
+rlpSizeHexString (const char *string);
+
+// The header plus the payloadCount bytes of the list's already sized items.
+extern size_t
+rlpSizeList (size_t payloadCount);
+
+extern void
+rlpWriteUInt64 (BRRlpWriter *writer, uint64_t value);
+
+extern void
+rlpWriteUInt256 (BRRlpWriter *writer, UInt256 value);
+
+extern void
+rlpWriteBytes (BRRlpWriter *writer, const uint8_t *bytes, size_t bytesCount);
+
+extern void
+rlpWriteString (BRRlpWriter *writer, const char *string);
+
+// Hex is decoded straight into the writer's buffer.
+extern void
+rlpWriteHexString (BRRlpWriter *writer, const char *string);
+
+// Write the list header; the list's items follow with their own rlpWrite*() calls.
+extern void
+rlpWriteListHeader (BRRlpWriter *writer, size_t payloadCount);
+
+//
+// Zero-Copy Decoder
+//
+// A view is the payload of one encoding, pointing into the decoded bytes; those bytes must
+// outlive the view.  Views of lists are walked with rlpViewListNext().
+//
+typedef enum {
+    RLP_VIEW_ITEM,
+    RLP_VIEW_LIST
+} BRRlpViewType;
+
+typedef struct {
+    BRRlpViewType type;
+    const uint8_t *bytes;
+    size_t bytesCount;
+} BRRlpView;
+
+// Decode the encoding at the start of bytes into view.  Returns the bytes the encoding takes,
+// header included, or 0 if bytes does not start with a complete, canonical encoding.
+extern size_t
+rlpDecodeView (const uint8_t *bytes, size_t bytesCount, BRRlpView *view);
+
+// Decode the list element at *offset (start with 0) into item and advance *offset past it.
+// Returns false at the end of list or if the element is malformed.
+extern int
+rlpViewListNext (BRRlpView list, size_t *offset, BRRlpView *item);
+
+// The number of elements of list, or -1 if one is malformed.
+extern long
+rlpViewListCount (BRRlpView list);
+
+// An item of at most 8 big_endian bytes; an empty item is zero.
+extern int
+rlpViewUInt64 (BRRlpView view, uint64_t *value);
+
+// An item of at most 32 big_endian bytes; an empty item is zero.
+extern int
+rlpViewUInt256 (BRRlpView view, UInt256 *value);
+
 #ifdef __cplusplus
 }
 #endif
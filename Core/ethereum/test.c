@@ -373,6 +373,224 @@ runMathParseTests () {
 
 }
 
+//
+// Math Random Tests
+//
+// The 64-bit limb arithmetic and the chunked parse and format, checked against plain 32-bit
+// digit at a time references on random values of every length.
+#define MATH_RANDOM_COUNT        100000
+#define MATH_BENCHMARK_COUNT     1000000
+
+static uint64_t mathRandomState = 0x2545f4914f6cdd1du;
+
+static uint64_t
+mathRandom (void) {
+    mathRandomState ^= mathRandomState << 13;
+    mathRandomState ^= mathRandomState >> 7;
+    mathRandomState ^= mathRandomState << 17;
+    return mathRandomState;
+}
+
+// A random value of 0 to 4 nonzero limbs; some limbs are all ones, to exercise the carries.
+static UInt256
+mathRandomUInt256 (void) {
+    UInt256 x = UINT256_ZERO;
+    int limbs = (int) (mathRandom() % 5);
+    for (int i = 0; i < limbs; i++)
+        x.u64[i] = (0 == mathRandom() % 4 ? UINT64_MAX : mathRandom());
+    return x;
+}
+
+static UInt256
+mathReferenceAdd (UInt256 x, UInt256 y, int *overflow) {
+    UInt256 z = UINT256_ZERO;
+    uint64_t carry = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t sum = (uint64_t) x.u32[i] + y.u32[i] + carry;
+        z.u32[i] = (uint32_t) sum;
+        carry = sum >> 32;
+    }
+    *overflow = (int) carry;
+    return z;
+}
+
+static UInt512
+mathReferenceMul (UInt256 x, UInt256 y) {
+    UInt512 z = UINT512_ZERO;
+    for (int i = 0; i < 8; i++) {
+        uint64_t carry = 0;
+        for (int j = 0; j < 8; j++) {
+            uint64_t product = (uint64_t) x.u32[i] * y.u32[j] + z.u32[i + j] + carry;
+            z.u32[i + j] = (uint32_t) product;
+            carry = product >> 32;
+        }
+        z.u32[i + 8] = (uint32_t) carry;
+    }
+    return z;
+}
+
+static UInt256
+mathReferenceDivSmall (UInt256 x, uint32_t y, uint32_t *rem) {
+    UInt256 z = UINT256_ZERO;
+    uint64_t r = 0;
+    for (int i = 7; i >= 0; i--) {
+        r = (r << 32) | x.u32[i];
+        z.u32[i] = (uint32_t) (r / y);
+        r %= y;
+    }
+    *rem = (uint32_t) r;
+    return z;
+}
+
+// Format one decimal digit at a time, into string (at least 79 chars)
+static void
+mathReferenceFormat (UInt256 x, char *string) {
+    char digits[79];
+    int count = 0;
+    do {
+        uint32_t rem;
+        x = mathReferenceDivSmall(x, 10, &rem);
+        digits[count++] = '0' + rem;
+    } while (!eqUInt256(x, UINT256_ZERO));
+    for (int i = 0; i < count; i++)
+        string[i] = digits[count - 1 - i];
+    string[count] = '\0';
+}
+
+static void
+runMathRandomTests () {
+    char string[300], reference[79];
+
+    for (int n = 0; n < MATH_RANDOM_COUNT; n++) {
+        UInt256 x = mathRandomUInt256(), y = mathRandomUInt256(), z, r;
+        int overflow, referenceOverflow, negative;
+
+        z = addUInt256_Overflow(x, y, &overflow);
+        r = mathReferenceAdd(x, y, &referenceOverflow);
+        assert (overflow == referenceOverflow && eqUInt256(z, overflow ? UINT256_ZERO : r));
+
+        // x - y, checked as (x - y) + y == x
+        z = subUInt256_Negative(x, y, &negative);
+        assert (negative == (compareUInt256(x, y) < 0));
+        r = (negative ? mathReferenceAdd(x, z, &referenceOverflow) : mathReferenceAdd(z, y, &referenceOverflow));
+        assert (eqUInt256(r, negative ? y : x) && 0 == referenceOverflow);
+
+        UInt512 product = mulUInt256(x, y), referenceProduct = mathReferenceMul(x, y);
+        assert (0 == memcmp (&product, &referenceProduct, sizeof (UInt512)));
+
+        referenceProduct = mathReferenceMul(x, createUInt256(y.u64[0]));
+        z = mulUInt256_Small64(x, y.u64[0], &overflow);
+        referenceOverflow = (0 != (referenceProduct.u64[4] | referenceProduct.u64[5]
+                                   | referenceProduct.u64[6] | referenceProduct.u64[7]));
+        assert (overflow == referenceOverflow
+                && (referenceOverflow
+                    ? eqUInt256(z, UINT256_ZERO)
+                    : 0 == memcmp (z.u64, referenceProduct.u64, sizeof (UInt256))));
+
+        uint32_t divisor = (uint32_t) (1 + mathRandom() % UINT32_MAX), rem, referenceRem;
+        z = divUInt256_Small(x, divisor, &rem);
+        r = mathReferenceDivSmall(x, divisor, &referenceRem);
+        assert (eqUInt256(z, r) && rem == referenceRem);
+
+        // Format and parse: decimal
+        BRCoreParseStatus status;
+        char *s = coerceString(x, 10);
+        mathReferenceFormat(x, reference);
+        assert (0 == strcmp (s, reference));
+        free (s);
+
+        z = createUInt256Parse(reference, 10, &status);
+        assert (CORE_PARSE_OK == status && eqUInt256(z, x));
+
+        // Hex, without leading zeros and then with "0x" (if it fits in 64 characters)
+        sprintf (string + 2, "%016" PRIx64 "%016" PRIx64 "%016" PRIx64 "%016" PRIx64,
+                 x.u64[3], x.u64[2], x.u64[1], x.u64[0]);
+        char *hex = string + 2;
+        while ('0' == hex[0] && '\0' != hex[1]) hex++;
+        z = createUInt256Parse(hex, 16, &status);
+        assert (CORE_PARSE_OK == status && eqUInt256(z, x));
+
+        if (strlen (hex) <= 62) {
+            hex[-2] = '0';
+            hex[-1] = (n % 2 ? 'x' : 'X');
+            z = createUInt256Parse(hex - 2, 16, &status);
+            assert (CORE_PARSE_OK == status && eqUInt256(z, x));
+        }
+
+        // Binary
+        for (int i = 0; i < 256; i++)
+            string[i] = '0' + ((x.u64[(255 - i) / 64] >> ((255 - i) % 64)) & 1);
+        string[256] = '\0';
+        z = createUInt256Parse(string, 2, &status);
+        assert (CORE_PARSE_OK == status && eqUInt256(z, x));
+    }
+
+    // 2^256 and the unchanged fallback for digits strtoull() skips or stops at
+    BRCoreParseStatus status;
+    createUInt256Parse("115792089237316195423570985008687907853269984665640564039457584007913129639936", 10, &status);
+    assert (CORE_PARSE_OVERFLOW == status);
+    UInt256 z = createUInt256Parse(" 12", 10, &status);
+    assert (CORE_PARSE_OK == status && 12 == z.u64[0]);
+}
+
+static void
+runMathBenchmark () {
+    printf ("     MATH BENCHMARK\n");
+
+    UInt256 values[16], sum = UINT256_ZERO;
+    for (int i = 0; i < 16; i++) values[i] = mathRandomUInt256();
+
+    clock_t start = clock();
+    for (int i = 0; i < MATH_BENCHMARK_COUNT; i++) {
+        UInt512 product = mathReferenceMul(values[i % 16], values[(i + 1) % 16]);
+        sum.u64[0] += product.u64[i % 8];
+    }
+    double referenceSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < MATH_BENCHMARK_COUNT; i++) {
+        UInt512 product = mulUInt256(values[i % 16], values[(i + 1) % 16]);
+        sum.u64[0] += product.u64[i % 8];
+    }
+    double limbSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf ("       Multiply (32-bit):   %.0f/s\n", MATH_BENCHMARK_COUNT / referenceSeconds);
+    printf ("       Multiply (64-bit):   %.0f/s\n", MATH_BENCHMARK_COUNT / limbSeconds);
+
+    char reference[79];
+    start = clock();
+    for (int i = 0; i < MATH_BENCHMARK_COUNT / 10; i++) {
+        mathReferenceFormat(values[i % 16], reference);
+        sum.u64[1] += reference[0];
+    }
+    referenceSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < MATH_BENCHMARK_COUNT / 10; i++) {
+        char *s = coerceString(values[i % 16], 10);
+        sum.u64[1] += s[0];
+        free (s);
+    }
+    limbSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf ("       Format (by 10):      %.0f/s\n", MATH_BENCHMARK_COUNT / 10 / referenceSeconds);
+    printf ("       Format (by 10^9):    %.0f/s\n", MATH_BENCHMARK_COUNT / 10 / limbSeconds);
+
+    mathReferenceFormat(values[0], reference);
+    start = clock();
+    for (int i = 0; i < MATH_BENCHMARK_COUNT / 10; i++) {
+        BRCoreParseStatus status;
+        sum.u64[2] += createUInt256Parse(reference, 10, &status).u64[0];
+    }
+    limbSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf ("       Parse (decimal):     %.0f/s  (%d digits)\n", MATH_BENCHMARK_COUNT / 10 / limbSeconds,
+            (int) strlen (reference));
+
+    // Keep the loops
+    if (eqUInt256(sum, UINT256_ZERO)) printf ("\n");
+}
+
 static void
 runMathTests() {
     runMathParseTests ();
@@ -382,6 +600,8 @@ runMathTests() {
     runMathMulTests();
     runMathMulDoubleTests();
     runMathDivTests();
+    runMathRandomTests();
+    runMathBenchmark();
 }
 
 //
@@ -575,6 +795,163 @@ void runRlpTest () {
     printf ("\n");
 }
 
+//
+// RLP Streaming Tests
+//
+// The streaming encoder must produce the same bytes as the BRRlpItem coder, and its sizes must
+// be the bytes it then writes.
+void rlpCheckWriter (BRRlpCoder coder, BRRlpItem item, uint8_t *bytes, size_t bytesCount, size_t size) {
+    BRRlpData data;
+
+    rlpGetData(coder, item, &data.bytes, &data.bytesCount);
+    assert (size == bytesCount);
+    assert (equalBytes(data.bytes, data.bytesCount, bytes, bytesCount));
+    free (data.bytes);
+}
+
+void rlpCheckWriterUInt64 (BRRlpCoder coder, uint64_t value) {
+    uint8_t bytes[16];
+    BRRlpWriter writer = rlpWriterCreate(bytes, sizeof (bytes));
+    rlpWriteUInt64(&writer, value);
+    rlpCheckWriter(coder, rlpEncodeItemUInt64(coder, value), bytes, writer.bytesIndex, rlpSizeUInt64(value));
+}
+
+void rlpCheckWriterUInt256 (BRRlpCoder coder, UInt256 value) {
+    uint8_t bytes[40];
+    BRRlpWriter writer = rlpWriterCreate(bytes, sizeof (bytes));
+    rlpWriteUInt256(&writer, value);
+    rlpCheckWriter(coder, rlpEncodeItemUInt256(coder, value), bytes, writer.bytesIndex, rlpSizeUInt256(value));
+
+    BRRlpView view;
+    UInt256 decoded;
+    assert (writer.bytesIndex == rlpDecodeView(bytes, writer.bytesIndex, &view));
+    assert (rlpViewUInt256(view, &decoded) && eqUInt256(value, decoded));
+}
+
+void rlpCheckWriterBytes (BRRlpCoder coder, uint8_t *source, size_t sourceCount) {
+    uint8_t bytes[sourceCount + 9];
+    BRRlpWriter writer = rlpWriterCreate(bytes, sizeof (bytes));
+    rlpWriteBytes(&writer, source, sourceCount);
+    rlpCheckWriter(coder, rlpEncodeItemBytes(coder, source, sourceCount), bytes, writer.bytesIndex,
+                   rlpSizeBytes(source, sourceCount));
+
+    // The view is the payload, in place
+    BRRlpView view;
+    assert (writer.bytesIndex == rlpDecodeView(bytes, writer.bytesIndex, &view));
+    assert (RLP_VIEW_ITEM == view.type);
+    assert (view.bytes >= bytes && view.bytes + view.bytesCount == bytes + writer.bytesIndex);
+    assert (equalBytes((uint8_t *) view.bytes, view.bytesCount, source, sourceCount));
+}
+
+void rlpCheckWriterHexString (BRRlpCoder coder, char *string) {
+    uint8_t bytes[strlen (string) / 2 + 9];
+    BRRlpWriter writer = rlpWriterCreate(bytes, sizeof (bytes));
+    rlpWriteHexString(&writer, string);
+    rlpCheckWriter(coder, rlpEncodeItemHexString(coder, string), bytes, writer.bytesIndex, rlpSizeHexString(string));
+}
+
+void rlpCheckDecodeFails (uint8_t *bytes, size_t bytesCount) {
+    BRRlpView view;
+    assert (0 == rlpDecodeView(bytes, bytesCount, &view));
+}
+
+void runRlpStreamTest () {
+    printf ("==== RLP Stream\n");
+
+    BRRlpCoder coder = rlpCoderCreate();
+
+    uint64_t values[] = { 0, 1, 0x7f, 0x80, 0xff, 0x100, 1024, 0xffffffff, UINT64_MAX };
+    for (int i = 0; i < sizeof (values) / sizeof (values[0]); i++)
+        rlpCheckWriterUInt64(coder, values[i]);
+
+    BRCoreParseStatus status = CORE_PARSE_OK;
+    rlpCheckWriterUInt256(coder, UINT256_ZERO);
+    rlpCheckWriterUInt256(coder, createUInt256(0x7f));
+    rlpCheckWriterUInt256(coder, createUInt256Parse("5968770000000000000000", 10, &status));
+    rlpCheckWriterUInt256(coder, createUInt256Parse("ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", 16, &status));
+
+    uint8_t source[1024];
+    for (int i = 0; i < sizeof (source); i++) source[i] = (uint8_t) (i * 7 + 1);
+    size_t sourceCounts[] = { 0, 1, 2, 55, 56, 255, 256, 1024 };
+    for (int i = 0; i < sizeof (sourceCounts) / sizeof (sourceCounts[0]); i++)
+        rlpCheckWriterBytes(coder, source, sourceCounts[i]);
+    source[0] = 0x00; rlpCheckWriterBytes(coder, source, 1);
+    source[0] = 0x80; rlpCheckWriterBytes(coder, source, 1);
+
+    rlpCheckWriterHexString(coder, "0x");
+    rlpCheckWriterHexString(coder, "0x7f");
+    rlpCheckWriterHexString(coder, "80");
+    rlpCheckWriterHexString(coder, "0x3535353535353535353535353535353535353535");
+
+    // [ [ "cat", "dog" ], 1024, "", <60 bytes> ], with a long list header
+    BRRlpItem listItem = rlpEncodeList(coder, 4,
+                                       rlpEncodeList2(coder,
+                                                      rlpEncodeItemString(coder, "cat"),
+                                                      rlpEncodeItemString(coder, "dog")),
+                                       rlpEncodeItemUInt64(coder, 1024),
+                                       rlpEncodeItemString(coder, ""),
+                                       rlpEncodeItemBytes(coder, source, 60));
+
+    size_t innerCount = rlpSizeString("cat") + rlpSizeString("dog");
+    size_t payloadCount = (rlpSizeList(innerCount) + rlpSizeUInt64(1024) +
+                           rlpSizeString("") + rlpSizeBytes(source, 60));
+    uint8_t list[rlpSizeList(payloadCount)];
+    BRRlpWriter writer = rlpWriterCreate(list, sizeof (list));
+    rlpWriteListHeader(&writer, payloadCount);
+    rlpWriteListHeader(&writer, innerCount);
+    rlpWriteString(&writer, "cat");
+    rlpWriteString(&writer, "dog");
+    rlpWriteUInt64(&writer, 1024);
+    rlpWriteString(&writer, "");
+    rlpWriteBytes(&writer, source, 60);
+    assert (rlpWriterIsComplete(&writer));
+    rlpCheckWriter(coder, listItem, list, writer.bytesIndex, sizeof (list));
+    printf ("  list => "); showHex (list, sizeof (list));
+
+    // A write that does not fit is dropped
+    rlpWriteUInt64(&writer, 1);
+    assert (sizeof (list) == writer.bytesIndex);
+
+    // Walk the list with views
+    BRRlpView view, item, inner;
+    size_t offset = 0, innerOffset = 0;
+    uint64_t value;
+    assert (sizeof (list) == rlpDecodeView(list, sizeof (list), &view));
+    assert (RLP_VIEW_LIST == view.type && 4 == rlpViewListCount(view));
+
+    assert (rlpViewListNext(view, &offset, &item) && RLP_VIEW_LIST == item.type);
+    assert (2 == rlpViewListCount(item));
+    assert (rlpViewListNext(item, &innerOffset, &inner) && equalBytes((uint8_t *) inner.bytes, inner.bytesCount, (uint8_t *) "cat", 3));
+    assert (rlpViewListNext(item, &innerOffset, &inner) && equalBytes((uint8_t *) inner.bytes, inner.bytesCount, (uint8_t *) "dog", 3));
+    assert (!rlpViewListNext(item, &innerOffset, &inner));
+
+    assert (rlpViewListNext(view, &offset, &item) && rlpViewUInt64(item, &value) && 1024 == value);
+    assert (rlpViewListNext(view, &offset, &item) && 0 == item.bytesCount && rlpViewUInt64(item, &value) && 0 == value);
+    assert (rlpViewListNext(view, &offset, &item) && equalBytes((uint8_t *) item.bytes, item.bytesCount, source, 60));
+    assert (!rlpViewUInt64(item, &value));
+    assert (!rlpViewListNext(view, &offset, &item) && sizeof (list) - 2 == offset);
+
+    // Truncated, and not canonical, encodings
+    rlpCheckDecodeFails(list, sizeof (list) - 1);
+    rlpCheckDecodeFails(list, 0);
+    uint8_t singleByte[] = { 0x81, 0x05 };
+    rlpCheckDecodeFails(singleByte, sizeof (singleByte));
+    uint8_t longShort[] = { 0xb8, 0x05, 1, 2, 3, 4, 5 };
+    rlpCheckDecodeFails(longShort, sizeof (longShort));
+    uint8_t leadingZero[] = { 0xb9, 0x00, 0x38 };
+    rlpCheckDecodeFails(leadingZero, sizeof (leadingZero));
+    uint8_t hugeLength[] = { 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+    rlpCheckDecodeFails(hugeLength, sizeof (hugeLength));
+
+    // An element that runs past the end of its list
+    uint8_t badList[] = { 0xc3, 0x83, 'c', 'a' };
+    assert (sizeof (badList) == rlpDecodeView(badList, sizeof (badList), &view));
+    assert (-1 == rlpViewListCount(view));
+
+    rlpCoderRelease(coder);
+    printf ("\n");
+}
+
 //
 // Account Test
 //
@@ -801,6 +1178,32 @@ void runTransactionTests2 (BREthereumAccount account, BREthereumNetwork network)
     encodeHex(result, 2 * dataUnsignedTransaction.bytesCount + 1, dataUnsignedTransaction.bytes, dataUnsignedTransaction.bytesCount);
     printf ("       Tx2 Raw (unsigned): %s\n", result);
     assert (0 == strcmp (result, TEST_TRANS2_RESULT_UNSIGNED));
+
+    // Decode the signed transaction in place
+    size_t signedCount = 0;
+    uint8_t *signedBytes = decodeHexCreate(&signedCount, TEST_TRANS2_RESULT_SIGNED, strlen (TEST_TRANS2_RESULT_SIGNED));
+    BRRlpView view, item;
+    size_t offset = 0;
+    uint64_t value;
+    UInt256 amount;
+    BRCoreParseStatus status = CORE_PARSE_OK;
+
+    assert (signedCount == rlpDecodeView(signedBytes, signedCount, &view));
+    assert (9 == rlpViewListCount(view));
+    assert (rlpViewListNext(view, &offset, &item) && rlpViewUInt64(item, &value) && TEST_TRANS2_NONCE == value);
+    assert (rlpViewListNext(view, &offset, &item) && rlpViewUInt64(item, &value) && TEST_TRANS2_GAS_PRICE_VALUE == value);
+    assert (rlpViewListNext(view, &offset, &item) && rlpViewUInt64(item, &value) && TEST_TRANS2_GAS_LIMIT == value);
+    assert (rlpViewListNext(view, &offset, &item) && 20 == item.bytesCount);
+    char *target = encodeHexCreate(NULL, (uint8_t *) item.bytes, item.bytesCount);
+    assert (0 == strcmp (target, &TEST_TRANS2_TARGET_ADDRESS[2]));
+    free (target);
+    assert (rlpViewListNext(view, &offset, &item) && rlpViewUInt256(item, &amount));
+    assert (eqUInt256(amount, createUInt256Parse("500000000000000000", 10, &status)));
+    assert (rlpViewListNext(view, &offset, &item) && 0 == item.bytesCount);
+    assert (rlpViewListNext(view, &offset, &item) && rlpViewUInt64(item, &value) && 0x26 == value);
+    assert (rlpViewListNext(view, &offset, &item) && 32 == item.bytesCount);
+    assert (rlpViewListNext(view, &offset, &item) && 32 == item.bytesCount);
+    free (signedBytes);
 }
 
 /*
@@ -865,12 +1268,88 @@ void runTransactionTests3 (BREthereumAccount account, BREthereumNetwork network)
     free (rawTx);
 }
 
+// The unsigned encoding of transaction with the BRRlpItem coder, as transactionEncodeRLP() was.
+BRRlpData transactionEncodeRLPWithItems (BREthereumTransaction transaction, BREthereumNetwork network) {
+    BRRlpCoder coder = rlpCoderCreate();
+    BRRlpItem items[9];
+
+    items[0] = rlpEncodeItemUInt64(coder, transactionGetNonce(transaction));
+    items[1] = gasPriceRlpEncode(transactionGetGasPrice(transaction), coder);
+    items[2] = gasRlpEncode(transactionGetGasLimit(transaction), coder);
+    items[3] = addressRlpEncode(transactionGetTargetAddress(transaction), coder);
+    items[4] = amountRlpEncode(transactionGetAmount(transaction), coder);
+    items[5] = rlpEncodeItemString(coder, "");
+    items[6] = rlpEncodeItemUInt64(coder, networkGetChainId(network));
+    items[7] = rlpEncodeItemString(coder, "");
+    items[8] = rlpEncodeItemString(coder, "");
+
+    BRRlpData data;
+    rlpGetData(coder, rlpEncodeListItems(coder, items, 9), &data.bytes, &data.bytesCount);
+    rlpCoderRelease(coder);
+    return data;
+}
+
+#define TRANSACTION_BENCHMARK_HASHES   100000
+#define TRANSACTION_BENCHMARK_SIGNS    1000
+
+void runTransactionBenchmark (BREthereumAccount account, BREthereumNetwork network) {
+    printf ("     BENCHMARK\n");
+
+    BREthereumWallet  wallet = walletCreate(account, network);
+    BREthereumTransaction transaction = walletCreateTransactionDetailed
+    (wallet,
+     createAddress(TEST_TRANS2_TARGET_ADDRESS),
+     amountCreateEther(etherCreateNumber(TEST_TRANS2_ETHER_AMOUNT, TEST_TRANS2_ETHER_AMOUNT_UNIT)),
+     gasPriceCreate(etherCreateNumber(TEST_TRANS2_GAS_PRICE_VALUE, TEST_TRANS2_GAS_PRICE_UNIT)),
+     gasCreate(TEST_TRANS2_GAS_LIMIT),
+     TEST_TRANS2_NONCE);
+
+    UInt256 digest;
+    BRRlpData data = transactionEncodeRLP(transaction, network, TRANSACTION_RLP_UNSIGNED);
+    BRRlpData itemsData = transactionEncodeRLPWithItems(transaction, network);
+    assert (equalBytes(data.bytes, data.bytesCount, itemsData.bytes, itemsData.bytesCount));
+    rlpDataRelease(data);
+    rlpDataRelease(itemsData);
+
+    // The signing hash: the unsigned encoding and its Keccak-256
+    clock_t start = clock();
+    for (int i = 0; i < TRANSACTION_BENCHMARK_HASHES; i++) {
+        data = transactionEncodeRLPWithItems(transaction, network);
+        BRKeccak256(&digest, data.bytes, data.bytesCount);
+        rlpDataRelease(data);
+    }
+    double itemsSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < TRANSACTION_BENCHMARK_HASHES; i++) {
+        data = transactionEncodeRLP(transaction, network, TRANSACTION_RLP_UNSIGNED);
+        BRKeccak256(&digest, data.bytes, data.bytesCount);
+        rlpDataRelease(data);
+    }
+    double streamSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf ("       Signing hash (items):  %.0f/s\n", TRANSACTION_BENCHMARK_HASHES / itemsSeconds);
+    printf ("       Signing hash (stream): %.0f/s\n", TRANSACTION_BENCHMARK_HASHES / streamSeconds);
+
+    // Signing: the above, the signature and the signed encoding
+    BRKey privateKey = accountGetPrimaryAddressPrivateKey(account, TEST_PAPER_KEY);
+    start = clock();
+    for (int i = 0; i < TRANSACTION_BENCHMARK_SIGNS; i++) {
+        walletSignTransactionWithPrivateKey(wallet, transaction, privateKey);
+        data = transactionEncodeRLP(transaction, network, TRANSACTION_RLP_SIGNED);
+        rlpDataRelease(data);
+    }
+    double signSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf ("       Sign:                  %.0f/s\n", TRANSACTION_BENCHMARK_SIGNS / signSeconds);
+}
+
 void runTransactionTests (BREthereumAccount account, BREthereumNetwork network) {
     printf ("\n== Transaction\n");
     
     runTransactionTests1 (account, network);
     runTransactionTests2 (account, network);
     runTransactionTests3 (account, network);
+    runTransactionBenchmark (account, network);
 }
 
 //
@@ -1066,6 +1545,283 @@ runLightNode_JSON_RPC_test (const char *paperKey) {
     lightNodeDisconnect(node);
 }
 
+//
+// JSON_RPC Batching
+//
+// A mock JSON_RPC server: it holds the batches it is sent and answers the oldest one, with its
+// responses reversed, when served.  A balance is 0x123f (as 32 bytes for an eth_call), a gas price
+// 0xffc0 and a gas estimate 21000 plus the transaction's value.
+#define MOCK_RPC_MAX_BATCHES      100
+#define MOCK_RPC_BATCH_SIZE       100
+#define MOCK_RPC_IN_FLIGHT        2
+#define MOCK_RPC_TRANSACTIONS     1000
+
+typedef struct MockRpcServerRecord {
+    char *batches[MOCK_RPC_MAX_BATCHES];
+    int bids[MOCK_RPC_MAX_BATCHES];
+    int received;
+    int served;
+    int requests;
+} *MockRpcServer;
+
+static void
+mockRpcSendBatch (JsonRpcContext context,
+                  BREthereumLightNode node,
+                  const char *batch,
+                  int bid) {
+    MockRpcServer server = (MockRpcServer) context;
+    assert (server->received < MOCK_RPC_MAX_BATCHES);
+    server->batches[server->received] = strdup (batch);
+    server->bids[server->received] = bid;
+    server->received++;
+}
+
+// Answer the oldest batch; false if there is none.
+static int
+mockRpcServe (MockRpcServer server, BREthereumLightNode node) {
+    if (server->served == server->received) return 0;
+
+    char *batch = server->batches[server->served];
+    int bid = server->bids[server->served];
+    server->served++;
+
+    char *responses = malloc (200 * MOCK_RPC_BATCH_SIZE + 3);
+    size_t index = 0;
+    responses[index++] = '[';
+
+    // Each request, from the last
+    char *request = batch + strlen (batch);
+    while (request > batch) {
+        while (request > batch && 0 != strncmp (request, "{\"jsonrpc\"", 10)) request--;
+        if (request == batch) break;
+
+        int id = atoi (strstr (request, "\"id\":") + 5);
+        const char *method = strstr (request, "\"method\":\"") + 10;
+        char result[80];
+
+        if (0 == strncmp (method, "eth_getBalance", 14))
+            strcpy (result, "0x123f");
+        else if (0 == strncmp (method, "eth_call", 8))
+            sprintf (result, "0x%064x", 0x123f);
+        else if (0 == strncmp (method, "eth_gasPrice", 12))
+            strcpy (result, "0xffc0");
+        else if (0 == strncmp (method, "eth_estimateGas", 15))
+            sprintf (result, "0x%llx", 21000 + strtoull (strstr (request, "\"value\":\"0x") + 11, NULL, 16));
+        else
+            strcpy (result, "0x123abc456def");
+
+        index += sprintf (&responses[index], "%s{\"jsonrpc\": \"2.0\", \"id\": %d, \"result\": \"%s\"}",
+                          (1 == index ? "" : ", "), id, result);
+        server->requests++;
+        *request = '\0';
+    }
+    strcpy (&responses[index], "]");
+
+    lightNodeAnnounceBatch(node, bid, responses);
+    free (responses);
+    free (batch);
+    return 1;
+}
+
+static void
+runLightNode_JSON_RPC_BATCH_test (const char *paperKey) {
+    printf ("     JSON_RCP BATCH\n");
+
+    BRCoreParseStatus status;
+    MockRpcServer server = (MockRpcServer) calloc (1, sizeof (struct MockRpcServerRecord));
+
+    BREthereumLightNodeConfiguration configuration =
+    lightNodeConfigurationCreateJSON_RPC(ethereumMainnet,
+                                         server,
+                                         jsonRpcGetBalance,
+                                         jsonRpcGetGasPrice,
+                                         jsonRpcEstimateGas,
+                                         jsonRpcSubmitTransaction,
+                                         jsonRpcGetTransactions);
+    lightNodeConfigurationSetJSON_RPCBatching(&configuration, mockRpcSendBatch,
+                                              MOCK_RPC_BATCH_SIZE, MOCK_RPC_IN_FLIGHT, 50);
+
+    BREthereumLightNode node = createLightNode(configuration, paperKey);
+    BREthereumLightNodeWalletId wallet = lightNodeGetWallet(node);
+    BREthereumLightNodeWalletId tokenWallet = lightNodeCreateWalletHoldingToken(node, tokenBRD);
+
+    // Balances for both wallets and one gas price for both: one partial batch, when flushed.
+    lightNodeUpdateWalletBalance (node, wallet);
+    lightNodeUpdateWalletBalance (node, tokenWallet);
+    lightNodeUpdateWalletDefaultGasPrice (node, wallet);
+    lightNodeUpdateWalletDefaultGasPrice (node, tokenWallet);
+    assert (0 == server->received);
+
+    lightNodeFlushBatch(node);
+    assert (1 == server->received);
+    while (mockRpcServe(server, node));
+    assert (3 == server->requests);
+
+    UInt256 expectedBalance = createUInt256Parse("0x123f", 16, &status);
+    BREthereumAmount balance = lightNodeWalletGetBalance (node, wallet);
+    assert (AMOUNT_ETHER == amountGetType(balance)
+            && ETHEREUM_BOOLEAN_TRUE == etherIsEQ (etherCreate(expectedBalance), amountGetEther(balance)));
+
+    balance = lightNodeWalletGetBalance (node, tokenWallet);
+    assert (AMOUNT_TOKEN == amountGetType(balance)
+            && eqUInt256(expectedBalance, amountGetTokenQuantity(balance).valueAsInteger));
+
+    assert (0xffc0 == lightNodeWalletGetDefaultGasPrice(node, wallet)
+            && 0xffc0 == lightNodeWalletGetDefaultGasPrice(node, tokenWallet));
+
+    // Distinct gas estimates: full batches are sent as queued, as the in-flight limit allows.
+    BREthereumLightNodeTransactionId transactions[MOCK_RPC_TRANSACTIONS];
+    for (int i = 0; i < MOCK_RPC_TRANSACTIONS; i++) {
+        transactions[i] = lightNodeWalletCreateTransaction
+        (node, wallet, NODE_RECV_ADDR, lightNodeCreateEtherAmountUnit(node, 1 + i, WEI));
+        lightNodeUpdateTransactionGasEstimate(node, wallet, transactions[i]);
+    }
+    assert (1 + MOCK_RPC_IN_FLIGHT == server->received);
+
+    while (mockRpcServe(server, node));
+    assert (1 + MOCK_RPC_TRANSACTIONS / MOCK_RPC_BATCH_SIZE == server->received
+            && 3 + MOCK_RPC_TRANSACTIONS == server->requests);
+
+    for (int i = 0; i < MOCK_RPC_TRANSACTIONS; i++)
+        assert (21000 + 1 + i == lightNodeWalletGetGasEstimate(node, wallet, transactions[i]));
+
+    // Nothing queued, nothing sent; a failed batch announces nothing.
+    lightNodeFlushBatch(node);
+    assert (server->served == server->received);
+
+    lightNodeUpdateWalletBalance (node, wallet);
+    lightNodeFlushBatch(node);
+    lightNodeAnnounceBatch(node, server->bids[server->received - 1], NULL);
+    free (server->batches[server->served++]);
+    balance = lightNodeWalletGetBalance (node, wallet);
+    assert (ETHEREUM_BOOLEAN_TRUE == etherIsEQ (etherCreate(expectedBalance), amountGetEther(balance)));
+
+    printf ("        %d requests in %d batches\n", server->requests, server->received);
+    free (server);
+}
+
+//
+// Store
+//
+// A mock store: it keeps what the node saves, in memory, as a client's database would.
+#define MOCK_STORE_MAX     10
+
+typedef struct MockStoreRecord {
+    uint8_t *transactions[MOCK_STORE_MAX];
+    size_t transactionsCount[MOCK_STORE_MAX];
+    int transactionCount;
+    char *blockHashes[MOCK_STORE_MAX];
+    uint64_t blockNumbers[MOCK_STORE_MAX];
+    uint64_t blockTimestamps[MOCK_STORE_MAX];
+    int blockCount;
+    char *balance;
+    int balanceCount;
+} *MockStore;
+
+static void
+mockStoreSaveTransaction (BREthereumLightNodeStoreContext context,
+                          BREthereumLightNode node,
+                          const char *hash,
+                          uint64_t blockNumber,
+                          const uint8_t *bytes,
+                          size_t bytesCount) {
+    MockStore store = (MockStore) context;
+    assert (store->transactionCount < MOCK_STORE_MAX);
+    store->transactions[store->transactionCount] = malloc (bytesCount);
+    memcpy (store->transactions[store->transactionCount], bytes, bytesCount);
+    store->transactionsCount[store->transactionCount++] = bytesCount;
+}
+
+static void
+mockStoreSaveBlock (BREthereumLightNodeStoreContext context,
+                    BREthereumLightNode node,
+                    const char *hash,
+                    uint64_t blockNumber,
+                    uint64_t blockTimestamp) {
+    MockStore store = (MockStore) context;
+    assert (store->blockCount < MOCK_STORE_MAX);
+    store->blockHashes[store->blockCount] = strdup (hash);
+    store->blockNumbers[store->blockCount] = blockNumber;
+    store->blockTimestamps[store->blockCount++] = blockTimestamp;
+}
+
+static void
+mockStoreSaveBalance (BREthereumLightNodeStoreContext context,
+                      BREthereumLightNode node,
+                      const char *token,
+                      const char *balance) {
+    MockStore store = (MockStore) context;
+    assert (NULL == token);
+    if (NULL != store->balance) free (store->balance);
+    store->balance = strdup (balance);
+    store->balanceCount++;
+}
+
+static void
+runLightNode_STORE_test (const char *paperKey) {
+    printf ("     STORE\n");
+
+    BRCoreParseStatus status;
+    MockStore store = (MockStore) calloc (1, sizeof (struct MockStoreRecord));
+    JsonRpcTestContext context = (JsonRpcTestContext) calloc (1, sizeof (struct JsonRpcTestContextRecord));
+
+    BREthereumLightNodeConfiguration configuration =
+    lightNodeConfigurationCreateJSON_RPC(ethereumMainnet,
+                                         context,
+                                         jsonRpcGetBalance,
+                                         jsonRpcGetGasPrice,
+                                         jsonRpcEstimateGas,
+                                         jsonRpcSubmitTransaction,
+                                         jsonRpcGetTransactions);
+
+    // Announced to one node, saved once...
+    BREthereumLightNode node1 = createLightNode(configuration, paperKey);
+    lightNodeSetStore(node1, store, mockStoreSaveTransaction, mockStoreSaveBlock, mockStoreSaveBalance);
+    assert (0 == lightNodeGetBlockNumber(node1));
+
+    jsonRpcGetTransactions(context, node1, NULL, 1);
+    jsonRpcGetTransactions(context, node1, NULL, 2);
+    jsonRpcGetBalance(context, node1, lightNodeGetWallet(node1), NULL, 3);
+
+    assert (1627184 == lightNodeGetBlockNumber(node1));
+    assert (1 == store->transactionCount && 1 == store->blockCount && 1 == store->balanceCount);
+    assert (1627184 == store->blockNumbers[0] && 1516477482 == store->blockTimestamps[0]);
+    assert (0 == strcmp ("0x123f", store->balance));
+
+    // ... restored to another, not saved again.
+    BREthereumLightNode node2 = createLightNode(configuration, paperKey);
+    lightNodeSetStore(node2, store, mockStoreSaveTransaction, mockStoreSaveBlock, mockStoreSaveBalance);
+    BREthereumLightNodeWalletId wallet = lightNodeGetWallet(node2);
+
+    lightNodeRestoreBlock(node2, store->blockHashes[0], store->blockNumbers[0], store->blockTimestamps[0]);
+    assert (ETHEREUM_BOOLEAN_TRUE == lightNodeRestoreTransaction(node2, store->transactions[0], store->transactionsCount[0]));
+    assert (ETHEREUM_BOOLEAN_TRUE == lightNodeRestoreBalance(node2, NULL, store->balance));
+
+    assert (1 == store->transactionCount && 1 == store->blockCount && 1 == store->balanceCount);
+    assert (1627184 == lightNodeGetBlockNumber(node2));
+    assert (1 == lightNodeWalletGetTransactionCount(node2, wallet));
+
+    BREthereumLightNodeTransactionId *tids = lightNodeWalletGetTransactions(node2, wallet);
+    assert (ETHEREUM_BOOLEAN_TRUE == lightNodeTransactionIsConfirmed(node2, tids[0]));
+    assert (1627184 == lightNodeTransactionGetBlockNumber(node2, tids[0]));
+    free (tids);
+
+    BREthereumAmount balance = lightNodeWalletGetBalance (node2, wallet);
+    BREthereumEther expectedBalance = etherCreate(createUInt256Parse("0x123f", 16, &status));
+    assert (CORE_PARSE_OK == status
+            && AMOUNT_ETHER == amountGetType(balance)
+            && ETHEREUM_BOOLEAN_TRUE == etherIsEQ (expectedBalance, amountGetEther(balance)));
+
+    // Not a saved transaction; a saved token balance for an unknown token.
+    assert (ETHEREUM_BOOLEAN_FALSE == lightNodeRestoreTransaction(node2, store->transactions[0], store->transactionsCount[0] - 1));
+    assert (ETHEREUM_BOOLEAN_FALSE == lightNodeRestoreBalance(node2, "0x0000000000000000000000000000000000000001", "0x1"));
+
+    for (int i = 0; i < store->transactionCount; i++) free (store->transactions[i]);
+    for (int i = 0; i < store->blockCount; i++) free (store->blockHashes[i]);
+    free (store->balance);
+    free (store);
+}
+
 //
 // Listener
 //
@@ -1189,6 +1945,8 @@ void runLightNodeTests () {
     printf ("==== Light Node\n");
     prepareTransaction(NODE_PAPER_KEY, NODE_RECV_ADDR, TEST_TRANS2_GAS_PRICE_VALUE, GAS_LIMIT_DEFAULT, NODE_ETHER_AMOUNT);
     runLightNode_JSON_RPC_test(NODE_PAPER_KEY);
+    runLightNode_JSON_RPC_BATCH_test(NODE_PAPER_KEY);
+    runLightNode_STORE_test(NODE_PAPER_KEY);
     runLightNode_TOKEN_test (NODE_PAPER_KEY);
     runLightNode_LISTENER_test (NODE_PAPER_KEY);
     runLightNode_PUBLIC_KEY_test (NODE_PAPER_KEY);
@@ -1226,6 +1984,7 @@ runTests (void) {
     runEtherParseTests();
     runTokenParseTests();
     runRlpTest();
+    runRlpStreamTest();
     runAccountTests();
     runLightNodeTests();
     //    reallySend();
@@ -33,6 +33,44 @@
 
 #define AS_UINT64(x)  ((uint64_t) (x))
 
+// Arithmetic is on the four 64-bit limbs of a UInt256.  Products of two limbs need 128 bits;
+// with a compiler that has `unsigned __int128` that is a single instruction (`mul`, or `mulx`
+// with BMI2), otherwise the 32-bit halves of the limbs are multiplied as 'grade school' digits.
+#if defined (__SIZEOF_INT128__)
+#define UINT256_MATH_INT128
+typedef unsigned __int128 uint128_t;
+#endif
+
+#define UINT256_LIMBS   (sizeof (UInt256) / sizeof (uint64_t))
+
+/**
+ * Return `x * y + add + *carry` split into the low 64 bits (returned) and the high 64 bits (in
+ * *carry).  Never overflows: (2^64-1)^2 + 2*(2^64-1) = 2^128-1.
+ */
+static inline uint64_t
+mulAddLimb (uint64_t x, uint64_t y, uint64_t add, uint64_t *carry) {
+#if defined (UINT256_MATH_INT128)
+    uint128_t total = (uint128_t) x * y + add + *carry;
+    *carry = (uint64_t) (total >> 64);
+    return (uint64_t) total;
+#else
+    uint64_t xl = (uint32_t) x, xh = x >> 32;
+    uint64_t yl = (uint32_t) y, yh = y >> 32;
+
+    uint64_t ll = xl * yl, lh = xl * yh, hl = xh * yl, hh = xh * yh;
+
+    // The middle 64 bits: at most 3 * (2^32-1), no overflow
+    uint64_t middle = (ll >> 32) + (uint32_t) lh + (uint32_t) hl;
+    uint64_t low    = (middle << 32) | (uint32_t) ll;
+    uint64_t high   = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+
+    low += add;    high += (low < add);
+    low += *carry; high += (low < *carry);
+    *carry = high;
+    return low;
+#endif
+}
+
 extern UInt256
 createUInt256 (uint64_t value) {
     UInt256 result = { .u64 = { value, 0, 0, 0}};
@@ -59,16 +97,16 @@ addUInt256_Overflow (const UInt256 y, const UInt256 x, int *overflow) {
     assert (overflow != NULL);
     
     UInt256 z = UINT256_ZERO;
-    unsigned int count = sizeof (UInt256) / sizeof(uint32_t);
     
-    // x = xa*2^0 + xb*2^32 + ...
-    // y = ya*2^0 + yb*2^32 + ...
-    // z = (xa + ya)*2^0 + (xb + yb)*2^32 + ...
+    // x = xa*2^0 + xb*2^64 + ...
+    // y = ya*2^0 + yb*2^64 + ...
+    // z = (xa + ya)*2^0 + (xb + yb)*2^64 + ...
     uint64_t carry = 0;
-    for (int i = 0; i < count; i++) {
-        uint64_t sum = AS_UINT64(x.u32[i]) + AS_UINT64(y.u32[i]) + carry;
-        carry = sum >> 32;
-        z.u32[i] = (uint32_t) sum;
+    for (int i = 0; i < UINT256_LIMBS; i++) {
+        uint64_t sum = x.u64[i] + carry;
+        carry = (sum < carry);
+        z.u64[i] = sum + y.u64[i];
+        carry += (z.u64[i] < sum);
     }
     
     *overflow = (int) carry;
@@ -80,38 +118,28 @@ addUInt256_Overflow (const UInt256 y, const UInt256 x, int *overflow) {
 extern UInt512
 addUInt256 (UInt256 x, UInt256 y) {
     UInt512 z = UINT512_ZERO;
-    unsigned int count = sizeof (UInt256) / sizeof(uint32_t);
     
-    // x = xa*2^0 + xb*2^32 + ...
-    // y = ya*2^0 + yb*2^32 + ...
-    // z = (xa + ya)*2^0 + (xb + yb)*2^32 + ...
     uint64_t carry = 0;
-    for (int i = 0; i < count; i++) {
-        uint64_t sum = AS_UINT64(x.u32[i]) + AS_UINT64(y.u32[i]) + carry;
-        carry = sum >> 32;
-        z.u32[i] = (uint32_t) sum;
+    for (int i = 0; i < UINT256_LIMBS; i++) {
+        uint64_t sum = x.u64[i] + carry;
+        carry = (sum < carry);
+        z.u64[i] = sum + y.u64[i];
+        carry += (z.u64[i] < sum);
     }
-    z.u32[count] = (uint32_t) carry;
+    z.u64[UINT256_LIMBS] = carry;
     return z;
 }
 
 static UInt256
 subUInt256_x_gt_y (UInt256 x, UInt256 y) {
     UInt256 z = UINT256_ZERO;
-    unsigned int count = sizeof (UInt256) / sizeof(uint32_t);
     
     uint64_t borrow = 0;
-    for (int i = 0; i < count; i++) {
-        uint64_t diff;
-        if (AS_UINT64(x.u32[i]) >= (AS_UINT64(y.u32[i]) + borrow)) {
-            diff = AS_UINT64(x.u32[i]) - (AS_UINT64(y.u32[i]) + borrow);
-            borrow = 0;
-        }
-        else {
-            diff = ((AS_UINT64(1) << 32) + AS_UINT64(x.u32[i])) - (AS_UINT64(y.u32[i]) + borrow);
-            borrow = 1;
-        }
-        z.u32[i] = (uint32_t) diff;
+    for (int i = 0; i < UINT256_LIMBS; i++) {
+        uint64_t subtrahend = y.u64[i] + borrow;
+        // y + borrow wraps only for y = 2^64-1, borrow = 1; then the limb borrows regardless
+        borrow = (subtrahend < borrow) || (x.u64[i] < subtrahend);
+        z.u64[i] = x.u64[i] - subtrahend;
     }
     return z;
 }
@@ -139,21 +167,15 @@ mulUInt256 (const UInt256 x, const UInt256 y) {
     //  assert (__LITTLE_ENDIAN__ == BYTE_ORDER);
     UInt512 z = UINT512_ZERO;
     
-    unsigned int count = sizeof (UInt256) / sizeof(uint32_t);
-    
-    // Use 'grade school' long multiplication in base 32.  For UInt256 we'll have 8 32-bit value
-    // and perform 64 32-bit multiplications.  A more sophisticated algorith, e.g. Katasuba, can
-    // perform just 27 32-bit multiplications.  For our application, not a big enough savings for
-    // the added complexity.
-    for (int xi = 0; xi < count; xi++) {
+    // Use 'grade school' long multiplication in base 2^64.  For UInt256 we'll have 4 64-bit
+    // limbs and perform 16 64-bit multiplications.  A more sophisticated algorithm, e.g.
+    // Karatsuba, saves little at this size.
+    for (int xi = 0; xi < UINT256_LIMBS; xi++) {
         uint64_t carry = 0;
-        if (x.u32[xi] == 0) continue;
-        for (int yi = 0; yi < count; yi++) {
-            uint64_t total = z.u32[yi + xi] + carry + AS_UINT64 (y.u32[yi]) * AS_UINT64 (x.u32[xi]);
-            carry = total >> 32;
-            z.u32[yi + xi] = (uint32_t) total;
-        }
-        z.u32[xi + count] += carry;
+        if (x.u64[xi] == 0) continue;
+        for (int yi = 0; yi < UINT256_LIMBS; yi++)
+            z.u64[yi + xi] = mulAddLimb (x.u64[xi], y.u64[yi], z.u64[yi + xi], &carry);
+        z.u64[xi + UINT256_LIMBS] = carry;
     }
     return z;
 }
@@ -165,7 +187,22 @@ mulUInt256_Overflow (UInt256 x, UInt256 y, int *overflow) {
 
 extern UInt256
 mulUInt256_Small (UInt256 x, uint32_t y, int *overflow) {
-    return mulUInt256_Overflow(x, createUInt256 (y), overflow);
+    return mulUInt256_Small64 (x, y, overflow);
+}
+
+extern UInt256
+mulUInt256_Small64 (UInt256 x, uint64_t y, int *overflow) {
+    assert (NULL != overflow);
+    UInt256 z;
+    
+    uint64_t carry = 0;
+    for (int i = 0; i < UINT256_LIMBS; i++)
+        z.u64[i] = mulAddLimb (x.u64[i], y, 0, &carry);
+    
+    *overflow = (0 != carry);
+    return (*overflow
+            ? UINT256_ZERO
+            : z);
 }
 
 extern UInt256
@@ -231,7 +268,12 @@ divUInt256_Small (UInt256 x, uint32_t y, uint32_t *rem) {
     assert (NULL != rem);
     UInt256 z = UINT256_ZERO;
     uint64_t remainder = 0;
-    for (int i = 7; i >= 0; i--) {
+    
+    // 32-bit digits keep each step a native 64-by-32 bit division; a 128-by-64 bit division is
+    // a library call.  Leading zero digits are skipped.
+    int i = 7;
+    while (i > 0 && 0 == x.u32[i]) i--;
+    for (; i >= 0; i--) {
         uint64_t value = AS_UINT64(x.u32[i]) + remainder * (AS_UINT64(1) << 32);
         z.u32[i] = (uint32_t) (value / y);
         remainder = value % y;
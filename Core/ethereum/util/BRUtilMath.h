@@ -128,6 +128,13 @@ mulUInt256_Overflow (UInt256 x, UInt256 y, int *overflow);
 extern UInt256
 mulUInt256_Small (UInt256 x, uint32_t y, int *overflow);
 
+/**
+ * Multiply as `x * y` where `y` is a uint64 number.  If the result is too big then overflow is
+ * set to 1 and zero is returned
+ */
+extern UInt256
+mulUInt256_Small64 (UInt256 x, uint64_t y, int *overflow);
+
 /**
  * Multiply as `x * y` where `y` is a postive double.  If `y` is negative, then this function
  * sets *negative to 1 and performs `x * -y`.  If the result is too big then overflow is set to 1
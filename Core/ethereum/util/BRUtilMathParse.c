@@ -27,44 +27,41 @@
 #include <stdio.h>
 #include <assert.h>
 #include <string.h>
-#include <regex.h>
 #include "BRUtil.h"
 
 //
 // Parsing
 //
 
-#define INTEGER_REGEX "^[0-9]+$"
-#define DECIMAL_REGEX "^[0-9]+\\.[0-9]*$"
+// The number of leading decimal digits of `number`.
+static size_t
+parseDigitsCount (const char *number) {
+    size_t count = 0;
+    while ((unsigned) (number[count] - '0') < 10) count++;
+    return count;
+}
 
+// As the regular expression "^[0-9]+$"
 extern BRCoreParseStatus
 parseIsInteger (const char *number) {
-    static regex_t regex;
-    static int regexInitialized = 0;
-    
-    if (!regexInitialized) {
-        regcomp(&regex, INTEGER_REGEX, REG_EXTENDED);
-        regexInitialized = 1;
-    }
-    
-    return (0 == regexec (&regex, number, 0, NULL, 0)
+    size_t count = parseDigitsCount(number);
+    return (count > 0 && '\0' == number[count]
             ? CORE_PARSE_OK
             : CORE_PARSE_STRANGE_DIGITS);
 }
 
+// As the regular expression "^[0-9]+\.[0-9]*$", or an integer
 extern BRCoreParseStatus
 parseIsDecimal (const char *number) {
-    static regex_t regex;
-    static int regexInitialized = 0;
-    
-    if (!regexInitialized) {
-        regcomp(&regex, DECIMAL_REGEX, REG_EXTENDED);
-        regexInitialized = 1;
-    }
-    
-    return (0 == regexec (&regex, number, 0, NULL, 0)
+    size_t count = parseDigitsCount(number);
+    if (0 == count) return CORE_PARSE_STRANGE_DIGITS;
+    if ('\0' == number[count]) return CORE_PARSE_OK;
+    if ('.' != number[count]) return CORE_PARSE_STRANGE_DIGITS;
+
+    number = &number[count + 1];
+    return ('\0' == number[parseDigitsCount(number)]
             ? CORE_PARSE_OK
-            : parseIsInteger (number));
+            : CORE_PARSE_STRANGE_DIGITS);
 }
 
 
@@ -214,6 +211,66 @@ parseUInt64 (const char *string, int digits, int base) {
     return createUInt256 (value);
 }
 
+// The value of the digit `c` in `base`, or -1
+static int
+parseDigitValue (char c, int base) {
+    int value = ((unsigned) (c - '0') < 10 ? c - '0'
+                 : ((unsigned) ((c | 0x20) - 'a') < 6 ? (c | 0x20) - 'a' + 10
+                    : -1));
+    return value < base ? value : -1;
+}
+
+/**
+ * Parse `length` digits, all valid in `base`, on 64-bit limbs: hex and binary digits are
+ * placed directly; decimal digits are taken 19 at a time as `value * 10^n + chunk`.
+ */
+static UInt256
+parseUInt256Digits (const char *string, long length, int base, BRCoreParseStatus *status) {
+    UInt256 value = UINT256_ZERO;
+    *status = CORE_PARSE_OK;
+
+    switch (base) {
+        case 16:
+        case 2: {
+            int bits = (16 == base ? 4 : 1);
+            for (long i = 0; i < length; i++) {
+                long shift = (length - 1 - i) * bits;
+                value.u64[shift / 64] |= ((uint64_t) parseDigitValue(string[i], base)) << (shift % 64);
+            }
+            return value;
+        }
+
+        case 10: {
+            static const uint64_t powersOf10[20] = {
+                1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u,
+                1000000000u, 10000000000u, 100000000000u, 1000000000000u, 10000000000000u,
+                100000000000000u, 1000000000000000u, 10000000000000000u, 100000000000000000u,
+                1000000000000000000u, 10000000000000000000u
+            };
+            for (long index = 0; index < length; ) {
+                int digits = (int) (length - index < 19 ? length - index : 19);
+                uint64_t chunk = 0;
+                for (int i = 0; i < digits; i++)
+                    chunk = 10 * chunk + (string[index + i] - '0');
+                index += digits;
+
+                int mulOverflow = 0, addOverflow = 0;
+                value = mulUInt256_Small64(value, powersOf10[digits], &mulOverflow);
+                value = addUInt256_Overflow(value, createUInt256(chunk), &addOverflow);
+                if (mulOverflow || addOverflow) {
+                    *status = CORE_PARSE_OVERFLOW;
+                    return UINT256_ZERO;
+                }
+            }
+            return value;
+        }
+
+        default:
+            assert (0);
+            return UINT256_ZERO;
+    }
+}
+
 extern UInt256
 createUInt256Parse (const char *string, int base, BRCoreParseStatus *status) {
     assert (NULL != status);
@@ -227,6 +284,16 @@ createUInt256Parse (const char *string, int base, BRCoreParseStatus *status) {
         return UINT256_ZERO;
     }
     
+    // A string of only `base` digits, possibly after the "0x" that strtoull() would skip, takes
+    // the fast path; anything else keeps the strtoull() chunks below, and their leniency.
+    const char *digits = string;
+    if (16 == base && '0' == digits[0] && 'x' == (digits[1] | 0x20)) digits = &digits[2];
+
+    long digitsCount = 0;
+    while (digitsCount < length && parseDigitValue(digits[digitsCount], base) >= 0) digitsCount++;
+    if ('\0' == digits[digitsCount])
+        return parseUInt256Digits(digits, digitsCount, base, status);
+
     // We'll process this many digits in `string`.
     int stringChunks = parseMaximumDigitsForUInt64InBase(base);
     
@@ -264,15 +331,6 @@ createUInt256Parse (const char *string, int base, BRCoreParseStatus *status) {
 //
 //
 //
-static char *
-coerceReverseString (const char *s) {
-    long len = strlen(s);
-    char *t = calloc (1 + len, 1);
-    for (int i = 0; i < len; i++)
-        t[len - i - 1] = s[i];
-    return t;
-}
-
 extern char *
 coerceString (UInt256 x, int base) {
     // Handle 0 explicitly, rather than in each case
@@ -296,16 +354,19 @@ coerceString (UInt256 x, int base) {
             return encodeHexCreate (NULL, &xr.u8[xrIndex], sizeof (xr.u8) - xrIndex);
         }
             
-            // Repeatedly divide by 10; append the result with the remainder.
+            // Repeatedly divide by 10^9; fill the result from the end, nine digits per remainder.
         case 10: {
-            char r[257];
-            memset (r, 0, 257);
-            for (int i = 0; i < 256 && !eqUInt256(x, UINT256_ZERO); i++) {
+            char r[9 * 9 + 1];  // 78 digits, padded to nine per remainder
+            int index = sizeof (r) - 1;
+            r[index] = '\0';
+            while (!eqUInt256(x, UINT256_ZERO)) {
                 uint32_t rem;
-                x = divUInt256_Small(x, base, &rem);
-                r[i] = '0' + rem;
+                x = divUInt256_Small(x, 1000000000, &rem);
+                for (int i = 0; i < 9; i++, rem /= 10)
+                    r[--index] = '0' + rem % 10;
             }
-            return coerceReverseString(r);
+            while ('0' == r[index]) index++;
+            return strdup (&r[index]);
         }
             
             // Get the base 16 result and then swap hex values for binary strings.
@@ -33,6 +33,12 @@ namespace Elastos {
 			 */
 			virtual nlohmann::json GetBalanceInfo() = 0;
 
+			/**
+			 * Get balances of all addresses as serialized json, the same string as GetBalanceInfo().dump() but written directly, for callers that only pass the result on.
+			 * @return balances of all addresses as a json string.
+			 */
+			virtual std::string GetBalanceInfoString() = 0;
+
 			/**
 			 * Get sum of balances of all addresses.
 			 * @return sum of balances.
@@ -55,6 +61,16 @@ namespace Elastos {
 					uint32_t start,
 					uint32_t count) = 0;
 
+			/**
+			 * Get all created addresses as serialized json, the same string as GetAllAddress(start, count).dump() but written directly.
+			 * @param start specify start index of all addresses list.
+			 * @param count specify count of addresses we need.
+			 * @return addresses as a json string.
+			 */
+			virtual std::string GetAllAddressString(
+					uint32_t start,
+					uint32_t count) = 0;
+
 			/**
 			 * Get balance of only the specified address.
 			 * @param address is one of addresses created by current sub wallet.
@@ -68,6 +84,15 @@ namespace Elastos {
 			 */
 			virtual void AddCallback(ISubWalletCallback *subCallback) = 0;
 
+			/**
+			 * Add a sub wallet callback object that receives coalesced events, so that listeners such as UI are not notified for every block during synchronization. Transaction status changes and balance changes are delivered together once per \p batchWindowMs, repeated "Updated" status of one transaction collapse into the latest one, and block height increased is fired at most once per \p progressIntervalMs. Sync started, sync stopped and destroy are fired right away, after every pending event.
+			 * @param subCallback is a pointer who want to listen events of current sub wallet.
+			 * @param batchWindowMs how long transaction and balance events are held before delivery, in milliseconds.
+			 * @param progressIntervalMs minimum interval between two block height increased events, in milliseconds.
+			 */
+			virtual void AddBatchedCallback(ISubWalletCallback *subCallback, uint32_t batchWindowMs,
+											uint32_t progressIntervalMs) = 0;
+
 			/**
 			 * Remove a sub wallet callback object listened to current sub wallet.
 			 * @param subCallback is a pointer who want to listen events of current sub wallet.
@@ -150,6 +175,18 @@ namespace Elastos {
 					uint32_t count,
 					const std::string &addressOrTxid) = 0;
 
+			/**
+			 * Get all qualified transactions as serialized json, the same string as GetAllTransaction(start, count, addressOrTxid).dump() but written directly, without a json document per transaction.
+			 * @param start specify start index of all transactions list.
+			 * @param count specify count of transactions we need.
+			 * @param addressOrTxid filter word which can be an address or a transaction id, if empty all transactions shall be qualified.
+			 * @return All qualified transactions as a json string.
+			 */
+			virtual std::string GetAllTransactionString(
+					uint32_t start,
+					uint32_t count,
+					const std::string &addressOrTxid) = 0;
+
 			/**
 			 * Sign message through root private key of the master wallet.
 			 * @param message need to signed, it should not be empty.
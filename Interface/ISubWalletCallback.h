@@ -29,6 +29,12 @@ namespace Elastos {
 					const nlohmann::json &desc,
 					uint32_t confirms) = 0;
 
+			/**
+			 * Callback method fired when balance of the sub wallet changed.
+			 * @param balance is the current balance.
+			 */
+			virtual void OnBalanceChanged(uint64_t balance) {}
+
 			/**
 			 * Callback method fired when block begin synchronizing with a peer. This callback could be used to show progress.
 			 */
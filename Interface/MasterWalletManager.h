@@ -15,7 +15,7 @@ namespace Elastos {
 		class MasterWalletManager : public IMasterWalletManager {
 		public:
 			/**
-			 * Constructor
+			 * Constructor. Existing master wallets under \p rootPath are only discovered here, each one is loaded the first time it is touched (see GetWallet(), GetAllMasterWallets()) or by LoadAllMasterWallets().
 			 * @param rootPath specify directory for all config files, including mnemonic config files and peer connection config files. Root should not be empty, otherwise will throw invalid argument exception.
 			 */
 			explicit MasterWalletManager(const std::string &rootPath);
@@ -60,6 +60,101 @@ namespace Elastos {
 			 */
 			virtual std::vector<IMasterWallet *> GetAllMasterWallets() const;
 
+			/**
+			 * Get ids of all master wallets, including those not loaded yet. Does not load any wallet.
+			 * @return master wallet id array.
+			 */
+			std::vector<std::string> GetAllMasterWalletIds() const;
+
+			/**
+			 * Get a master wallet by id, loading it from local storage if it is not loaded yet.
+			 * @param masterWalletId is the unique identification of a master wallet object.
+			 * @return a pointer of master wallet interface, or nullptr if there is no such wallet or it failed to load.
+			 */
+			IMasterWallet *GetWallet(const std::string &masterWalletId) const;
+
+			/**
+			 * Give back a master wallet returned by GetWallet(), GetAllMasterWallets(), CreateMasterWallet() or an Import function. Every wallet returned is leased to the caller, and host mode never evicts a wallet with a lease left, so each returned pointer is released once it is not used any more.
+			 * @param masterWalletId is the unique identification of a master wallet object.
+			 */
+			void ReleaseWallet(const std::string &masterWalletId) const;
+
+			/**
+			 * Start loading every master wallet that is not loaded yet in the background and return immediately. Wallets touched meanwhile are loaded on demand as usual.
+			 * @param threadCount maximum number of wallets loaded concurrently, 0 means one per hardware thread.
+			 */
+			void LoadAllMasterWallets(uint32_t threadCount = 0);
+
+			/**
+			 * Get loading progress of the master wallets found on startup.
+			 * @return progress in json format: "Total" wallets found, "Loaded", "Failed", "Pending" and whether background "Loading" is still running.
+			 */
+			nlohmann::json GetLoadingProgress() const;
+
+			/**
+			 * Get metrics of the spv internals (peers, sync, database, signing) in prometheus text format, to serve from a local scrape endpoint.
+			 * @return metrics in prometheus text exposition format.
+			 */
+			std::string GetMetrics() const;
+
+			/**
+			 * Write the metrics of GetMetrics() to a file. The file is replaced atomically, so it can be read by a textfile collector at any time.
+			 * @param path of the metrics file.
+			 */
+			void DumpMetrics(const std::string &path) const;
+
+			/**
+			 * Set the log level of one subsystem of the sdk, or of all of them.
+			 * @param subsystem "peer", "wallet", "db", "keystore", "spvsdk" for everything else, or empty for all subsystems.
+			 * @param level "trace", "debug", "info", "warning", "error", "critical" or "off".
+			 */
+			void SetLogLevel(const std::string &subsystem, const std::string &level);
+
+			/**
+			 * Also write the logs to spvsdk.log in the root path. The file is rotated when it grows over maxFileSize bytes and maxFiles old files are kept.
+			 * @param maxFileSize in bytes.
+			 * @param maxFiles rotated files kept besides the current one.
+			 */
+			void EnableFileLogging(uint32_t maxFileSize, uint32_t maxFiles);
+
+			/**
+			 * Start recording trace spans of the sync pipeline (peer messages, wallet and database calls) in memory. A previous recording is discarded.
+			 * @param maxEvents spans kept at most, later ones are only counted.
+			 */
+			void StartTracing(uint32_t maxEvents);
+
+			/**
+			 * Stop recording and write the spans as a Chrome trace file, which can be opened offline in chrome://tracing or the Perfetto UI.
+			 * @param path of the trace file.
+			 */
+			void StopTracing(const std::string &path);
+
+			/**
+			 * Host many master wallets in one process. A loaded master wallet is evicted (saved and unloaded, its sub wallets stopped) once it is not touched through GetWallet() for \p idleSeconds, or when more than \p maxLoadedWallets are loaded, least recently used first. Wallets leased to the host (see ReleaseWallet()) and wallets with a sub wallet callback registered are never evicted. An evicted wallet stays known and is loaded again on next use, so hosts must not keep wallet pointers past ReleaseWallet() but get them from GetWallet() again. In host mode GetAllMasterWallets() only returns the wallets that are loaded. Each loaded wallet still keeps its own peer connections, database file and block headers, host mode only bounds how many are loaded.
+			 * @param maxLoadedWallets loaded master wallets at most, 0 for no limit.
+			 * @param idleSeconds time after the last use a master wallet is evicted, 0 to keep idle wallets loaded.
+			 */
+			void EnableHostMode(uint32_t maxLoadedWallets, uint32_t idleSeconds);
+
+			/**
+			 * Evict the master wallets idle for longer than host mode allows. Loading a wallet evicts too, hosts call this periodically to also release wallets while no wallet is loaded.
+			 * @return number of master wallets evicted.
+			 */
+			uint32_t EvictIdleWallets();
+
+			/**
+			 * Get resources used by the loaded master wallets.
+			 * @return usage in json format: "Loaded" and "Evicted" wallet counts, and "Wallets" with "MasterWalletID", "IdleSeconds", "SubWallets", approximate "MemoryBytes", and "ListenerBusyMs" and "ListenerQueueDepth" of the callbacks (database writes included) of each loaded wallet.
+			 */
+			nlohmann::json GetHostUsage() const;
+
+			/**
+			 * Load checkpoints newer than the built-in ones from a bundle of block headers signed by its publisher, so sub wallets created or loaded afterwards start syncing from close to the tip. A bundle that disagrees with the built-in checkpoints is ignored.
+			 * @param path of the checkpoint bundle file.
+			 * @param publicKey hex public key of the publisher the bundle must be signed by.
+			 */
+			void LoadCheckPointBundle(const std::string &path, const std::string &publicKey);
+
 			/**
 			 * Destroy a master wallet.
 			 * @param masterWallet A pointer of master wallet interface create or imported by wallet factory object.
@@ -121,6 +216,18 @@ namespace Elastos {
 					IMasterWallet *masterWallet,
 					const std::string &payPassword);
 
+			/**
+			 * Keep keys derived from pay passwords in locked memory so repeated signing does not run the key derivation every time. A cached key is wiped once it is unused for \p seconds, when its master wallet changes password or is destroyed.
+			 * @param seconds how long a derived key is kept after its last use, 0 (default) disables the cache and wipes cached keys.
+			 */
+			void SetPayPasswordCacheTimeout(uint32_t seconds);
+
+			/**
+			 * Protect exported key store files with the memory-hard scrypt key derivation instead of PBKDF2. Such files can only be imported by versions of this SDK that support the scrypt extension.
+			 * @param enable true to use scrypt for subsequent exports.
+			 */
+			void SetKeystoreMemoryHardKdf(bool enable);
+
 		protected:
 			typedef std::map<std::string, IMasterWallet *> MasterWalletMap;
 
@@ -130,10 +237,20 @@ namespace Elastos {
 
 			void removeWallet(const std::string &masterWalletId, bool saveMaster = true);
 
+			IMasterWallet *findWallet(const std::string &masterWalletId, bool lease = false) const;
+
+			void loadInBackground(const std::string &masterWalletId);
+
+			uint32_t evictWallets(const std::string &keepId) const;
+
 		protected:
+			struct LoadingState;
+
 			std::string _rootPath;
 			bool _p2pEnable;
-			MasterWalletMap _masterWalletMap;
+			bool _keystoreMemoryHard;
+			mutable MasterWalletMap _masterWalletMap;
+			LoadingState *_loading;
 		};
 	}
 }
@@ -4,6 +4,7 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <openssl/evp.h>
+#include "BRCrypto.h"
 #include "Utils.h"
 
 #include "AES_256_CCM.h"
@@ -170,35 +171,23 @@ namespace Elastos {
 			return true;
 		}
 
+		size_t AES_256_CCM::KeyLength() {
+			Init();
+			const EVP_CIPHER *cipher = EVP_get_cipherbyname("aes-256-ccm");
+			return nullptr == cipher ? 0 : (size_t) EVP_CIPHER_key_length(cipher);
+		}
+
 		CMBlock
 		AES_256_CCM::encrypt(unsigned char *plainText, size_t szPlainText, unsigned char *password, size_t szPassword,
 							 unsigned char *salt, size_t szSalt, unsigned char *iv, size_t szIv, bool bAes128,
-							 unsigned char *aad, size_t szAad) {
+							 unsigned char *aad, size_t szAad, const KdfParams &kdf) {
 			CMBlock _ret;
 
-			Init();
-			const EVP_CIPHER *cipher = EVP_get_cipherbyname("aes-256-ccm");
-			const EVP_MD *dgst = EVP_sha256();
-			if (nullptr != cipher && nullptr != dgst) {
-				unsigned char key[EVP_MAX_KEY_LENGTH];
-				int iklen = EVP_CIPHER_key_length(cipher);
-				if (PKCS5_PBKDF2_HMAC((char *) password, szPassword, salt, szSalt, 10000, dgst, iklen, key)) {
-					unsigned char ciphertext[CIPHERTEXTMAXLENGTH] = {0};
-					static unsigned char tag[8] = {0};
-					int ret = 0;
-					try {
-						ret = _encryptccm(plainText, szPlainText, nullptr == aad ? (unsigned char *) "" : aad, szAad,
-										  key, iv, ciphertext, tag, bAes128);
-					}
-					catch (...) {
-						return _ret;
-					}
-					if (0 < ret) {
-						_ret.Resize(ret + 8);
-						memcpy(_ret, ciphertext, ret);
-						memcpy((unsigned char *) _ret + ret, tag, 8);
-					}
-				}
+			unsigned char key[EVP_MAX_KEY_LENGTH];
+			size_t iklen = KeyLength();
+			if (0 < iklen && kdf.Derive(key, iklen, password, szPassword, salt, szSalt)) {
+				_ret = encryptWithKey(plainText, szPlainText, key, iklen, iv, szIv, bAes128, aad, szAad);
+				mem_clean(key, sizeof(key));
 			}
 
 			return _ret;
@@ -207,37 +196,76 @@ namespace Elastos {
 		CMBlock
 		AES_256_CCM::decrypt(unsigned char *cipherText, size_t szCipherText, unsigned char *password, size_t szPassword,
 							 unsigned char *salt, size_t szSalt, unsigned char *iv, size_t szIv, bool bAes128,
-							 unsigned char *aad, size_t szAad) {
+							 unsigned char *aad, size_t szAad, const KdfParams &kdf) {
 			CMBlock _ret;
 
 			if (nullptr == cipherText || 8 >= szCipherText) {
 				return _ret;
 			}
 
-			Init();
-			const EVP_CIPHER *cipher = EVP_get_cipherbyname("aes-256-ccm");
-			const EVP_MD *dgst = EVP_sha256();
-			if (nullptr != cipher && nullptr != dgst) {
-				unsigned char key[EVP_MAX_KEY_LENGTH];
-				int iklen = EVP_CIPHER_key_length(cipher);
-				if (PKCS5_PBKDF2_HMAC((char *) password, szPassword, salt, szSalt, 10000, dgst, iklen, key)) {
-					unsigned char plaintext[CIPHERTEXTMAXLENGTH] = {0};
-					int ret = 0;
-					try {
-						ret = _decryptccm(cipherText, szCipherText - 8, nullptr == aad ? (unsigned char *) "" : aad,
-										  szAad, &cipherText[szCipherText - 8], key, iv, plaintext, bAes128);
-					}
-					catch (...) {
-						return _ret;
-					}
-					if (0 < ret) {
-						_ret.Resize(ret);
-						memcpy(_ret, plaintext, ret);
-					}
-				}
+			unsigned char key[EVP_MAX_KEY_LENGTH];
+			size_t iklen = KeyLength();
+			if (0 < iklen && kdf.Derive(key, iklen, password, szPassword, salt, szSalt)) {
+				_ret = decryptWithKey(cipherText, szCipherText, key, iklen, iv, szIv, bAes128, aad, szAad);
+				mem_clean(key, sizeof(key));
+			}
+
+			return _ret;
+		}
+
+		CMBlock
+		AES_256_CCM::encryptWithKey(unsigned char *plainText, size_t szPlainText, unsigned char *key, size_t szKey,
+									unsigned char *iv, size_t szIv, bool bAes128, unsigned char *aad, size_t szAad) {
+			CMBlock _ret;
+
+			if (nullptr == key || KeyLength() != szKey) {
+				return _ret;
+			}
+
+			unsigned char ciphertext[CIPHERTEXTMAXLENGTH] = {0};
+			unsigned char tag[8] = {0};
+			int ret = 0;
+			try {
+				ret = _encryptccm(plainText, szPlainText, nullptr == aad ? (unsigned char *) "" : aad, szAad,
+								  key, iv, ciphertext, tag, bAes128);
+			}
+			catch (...) {
+				return _ret;
+			}
+			if (0 < ret) {
+				_ret.Resize(ret + 8);
+				memcpy(_ret, ciphertext, ret);
+				memcpy((unsigned char *) _ret + ret, tag, 8);
+			}
+
+			return _ret;
+		}
+
+		CMBlock
+		AES_256_CCM::decryptWithKey(unsigned char *cipherText, size_t szCipherText, unsigned char *key, size_t szKey,
+									unsigned char *iv, size_t szIv, bool bAes128, unsigned char *aad, size_t szAad) {
+			CMBlock _ret;
+
+			if (nullptr == cipherText || 8 >= szCipherText || nullptr == key || KeyLength() != szKey) {
+				return _ret;
+			}
+
+			unsigned char plaintext[CIPHERTEXTMAXLENGTH] = {0};
+			int ret = 0;
+			try {
+				ret = _decryptccm(cipherText, szCipherText - 8, nullptr == aad ? (unsigned char *) "" : aad,
+								  szAad, &cipherText[szCipherText - 8], key, iv, plaintext, bAes128);
+			}
+			catch (...) {
+				return _ret;
+			}
+			if (0 < ret) {
+				_ret.Resize(ret);
+				memcpy(_ret, plaintext, ret);
 			}
+			mem_clean(plaintext, sizeof(plaintext));
 
 			return _ret;
 		}
 	}
-}
\ No newline at end of file
+}
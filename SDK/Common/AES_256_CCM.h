@@ -9,6 +9,7 @@
 #include <cstdint>
 
 #include "CMemBlock.h"
+#include "KeyDerivation.h"
 
 #define CIPHERTEXTMAXLENGTH 1024 * 3
 
@@ -22,15 +23,28 @@ namespace Elastos {
 
 			static bool GenerateSaltAndIV(CMemBlock<unsigned char> &salt, CMemBlock<unsigned char> &iv);
 
+			// length of the key expected by encryptWithKey() and decryptWithKey()
+			static size_t KeyLength();
+
 			static CMBlock
 			encrypt(unsigned char *plainText, size_t szPlainText, unsigned char *password, size_t szPassword,
 					unsigned char *salt, size_t szSalt, unsigned char *iv, size_t szIv, bool bAes128 = false,
-					unsigned char *aad = nullptr, size_t szAad = 0);
+					unsigned char *aad = nullptr, size_t szAad = 0, const KdfParams &kdf = KdfParams());
 
 			static CMBlock
 			decrypt(unsigned char *cipherText, size_t szCipherText, unsigned char *password, size_t szPassword,
 					unsigned char *salt, size_t szSalt, unsigned char *iv, size_t szIv, bool bAes128 = false,
-					unsigned char *aad = nullptr, size_t szAad = 0);
+					unsigned char *aad = nullptr, size_t szAad = 0, const KdfParams &kdf = KdfParams());
+
+			static CMBlock
+			encryptWithKey(unsigned char *plainText, size_t szPlainText, unsigned char *key, size_t szKey,
+						   unsigned char *iv, size_t szIv, bool bAes128 = false, unsigned char *aad = nullptr,
+						   size_t szAad = 0);
+
+			static CMBlock
+			decryptWithKey(unsigned char *cipherText, size_t szCipherText, unsigned char *key, size_t szKey,
+						   unsigned char *iv, size_t szIv, bool bAes128 = false, unsigned char *aad = nullptr,
+						   size_t szAad = 0);
 		};
 	}
 }
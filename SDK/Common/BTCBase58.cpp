@@ -2,12 +2,15 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
-// reference to https://github.com/bitcoin/bitcoin/blob/0fea960ca917b73aff853fe88476174c8a313863/src/base58.cpp
+// same results as https://github.com/bitcoin/bitcoin/blob/0fea960ca917b73aff853fe88476174c8a313863/src/base58.cpp,
+// the conversion itself is the one of BRBase58
 
-#include <assert.h>
+#include <ctype.h>
 #include <string.h>
 #include <vector>
 
+#include "BRBase58.h"
+
 #include "BTCBase58.h"
 
 namespace Elastos {
@@ -16,92 +19,43 @@ namespace Elastos {
 		static const char *pszBase58 = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
 		static std::string _EncodeBase58(const unsigned char *pbegin, const unsigned char *pend) {
-			// Skip & count leading zeroes.
-			int zeroes = 0;
-			int length = 0;
-			while (pbegin != pend && *pbegin == 0) {
-				pbegin++;
+			if (pbegin == pend)
+				return "";
+
+			// BRBase58Encode() counts leading zeroes in its length but, unlike bitcoin, does not write them as '1's
+			size_t zeroes = 0;
+			while (pbegin + zeroes != pend && pbegin[zeroes] == 0)
 				zeroes++;
-			}
-			// Allocate enough space in big-endian base58 representation.
-			int size = (pend - pbegin) * 138 / 100 + 1; // log(256) / log(58), rounded up.
-			std::vector<unsigned char> b58(size);
-			// Process the bytes.
-			while (pbegin != pend) {
-				int carry = *pbegin;
-				int i = 0;
-				// Apply "b58 = b58 * 256 + ch".
-				for (std::vector<unsigned char>::reverse_iterator it = b58.rbegin();
-					 (carry != 0 || i < length) && (it != b58.rend()); it++, i++) {
-					carry += 256 * (*it);
-					*it = carry % 58;
-					carry /= 58;
-				}
 
-				assert(carry == 0);
-				length = i;
-				pbegin++;
-			}
-			// Skip leading zeroes in base58 result.
-			std::vector<unsigned char>::iterator it = b58.begin() + (size - length);
-			while (it != b58.end() && *it == 0)
-				it++;
-			// Translate the result into a string.
-			std::string str;
-			str.reserve(zeroes + (b58.end() - it));
-			str.assign(zeroes, '1');
-			while (it != b58.end())
-				str += pszBase58[*(it++)];
+			size_t len = BRBase58Encode(nullptr, 0, pbegin, pend - pbegin);
+			std::string str(len, '1');
+			// the length check includes the zeroes, only len - zeroes characters are written
+			BRBase58Encode(&str[zeroes], len, pbegin, pend - pbegin);
+			str.resize(len - 1);
 			return str;
 		}
 
 		static bool _DecodeBase58(const char *psz, std::vector<unsigned char> &vch) {
 			// Skip leading spaces.
-			while (*psz && isspace(*psz))
-				psz++;
-			// Skip and count leading '1's.
-			int zeroes = 0;
-			int length = 0;
-			while (*psz == '1') {
-				zeroes++;
+			while (*psz && isspace((unsigned char) *psz))
 				psz++;
+			// Every character up to the trailing spaces must be a base58 digit.
+			const char *pend = psz;
+			while (*pend && !isspace((unsigned char) *pend)) {
+				if (strchr(pszBase58, *pend) == NULL)
+					return false;
+				pend++;
 			}
-			// Allocate enough space in big-endian base256 representation.
-			int size = strlen(psz) * 733 / 1000 + 1; // log(58) / log(256), rounded up.
-			std::vector<unsigned char> b256(size);
-			// Process the characters.
-			while (*psz && !isspace(*psz)) {
-				// Decode base58 character
-				const char *ch = strchr(pszBase58, *psz);
-				if (ch == NULL)
+			for (const char *p = pend; *p; ++p) {
+				if (!isspace((unsigned char) *p))
 					return false;
-				// Apply "b256 = b256 * 58 + ch".
-				int carry = ch - pszBase58;
-				int i = 0;
-				for (std::vector<unsigned char>::reverse_iterator it = b256.rbegin();
-					 (carry != 0 || i < length) && (it != b256.rend()); ++it, ++i) {
-					carry += 58 * (*it);
-					*it = carry % 256;
-					carry /= 256;
-				}
-				assert(carry == 0);
-				length = i;
-				psz++;
 			}
-			// Skip trailing spaces.
-			while (isspace(*psz))
-				psz++;
-			if (*psz != 0)
-				return false;
-			// Skip leading zeroes in b256.
-			std::vector<unsigned char>::iterator it = b256.begin() + (size - length);
-			while (it != b256.end() && *it == 0)
-				it++;
-			// Copy result into output vector.
-			vch.reserve(zeroes + (b256.end() - it));
-			vch.assign(zeroes, 0x00);
-			while (it != b256.end())
-				vch.push_back(*(it++));
+
+			std::string digits(psz, pend);
+			size_t len = BRBase58Decode(nullptr, 0, digits.c_str());
+			vch.resize(len);
+			if (len > 0)
+				BRBase58Decode(vch.data(), len, digits.c_str());
 			return true;
 		}
 
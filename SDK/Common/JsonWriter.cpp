@@ -0,0 +1,166 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <string.h>
+#include <nlohmann/json.hpp>
+
+#include "BRHex.h"
+#include "JsonWriter.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		JsonWriter::JsonWriter(std::string &out) :
+				_out(out),
+				_needComma(false) {
+		}
+
+		JsonWriter &JsonWriter::BeginObject() {
+			beginValue();
+			_out += '{';
+			_needComma = false;
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::EndObject() {
+			_out += '}';
+			_needComma = true;
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::BeginArray() {
+			beginValue();
+			_out += '[';
+			_needComma = false;
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::EndArray() {
+			_out += ']';
+			_needComma = true;
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::Key(const char *key) {
+			if (_needComma)
+				_out += ',';
+			_out += '"';
+			_out += key;
+			_out += "\":";
+			_needComma = false;
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::String(const std::string &value) {
+			beginValue();
+			writeString(value.data(), value.size());
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::String(const char *value) {
+			beginValue();
+			writeString(value, strlen(value));
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::Hex(const uint8_t *data, size_t len, bool reverse) {
+			beginValue();
+			size_t start = _out.size();
+			// the quotes and the terminator written by BRHexEncode(), which the closing quote replaces
+			_out.resize(start + 2 * len + 2);
+			_out[start] = '"';
+			BRHexEncode(&_out[start + 1], 2 * len + 1, data, len, reverse);
+			_out[start + 2 * len + 1] = '"';
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::UInt(uint64_t value) {
+			char digits[20];
+			size_t n = 0;
+
+			beginValue();
+			do {
+				digits[n++] = (char) ('0' + value % 10);
+				value /= 10;
+			} while (value != 0);
+			while (n > 0)
+				_out += digits[--n];
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::Int(int64_t value) {
+			if (value >= 0)
+				return UInt((uint64_t) value);
+
+			beginValue();
+			_out += '-';
+			_needComma = false;
+			// negated as unsigned, so INT64_MIN does not overflow
+			return UInt(0 - (uint64_t) value);
+		}
+
+		JsonWriter &JsonWriter::Bool(bool value) {
+			beginValue();
+			_out += value ? "true" : "false";
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::Null() {
+			beginValue();
+			_out += "null";
+			return *this;
+		}
+
+		JsonWriter &JsonWriter::Raw(const std::string &json) {
+			beginValue();
+			_out += json;
+			return *this;
+		}
+
+		void JsonWriter::beginValue() {
+			if (_needComma)
+				_out += ',';
+			_needComma = true;
+		}
+
+		void JsonWriter::writeString(const char *value, size_t len) {
+			static const char hexDigits[] = "0123456789abcdef";
+
+			for (size_t i = 0; i < len; ++i) {
+				if ((uint8_t) value[i] >= 0x80) {
+					_out += nlohmann::json(std::string(value, len)).dump();
+					return;
+				}
+			}
+
+			_out += '"';
+			size_t plain = 0;
+			for (size_t i = 0; i < len; ++i) {
+				uint8_t c = (uint8_t) value[i];
+				if (c >= 0x20 && c != '"' && c != '\\')
+					continue;
+
+				_out.append(value + plain, i - plain);
+				plain = i + 1;
+				switch (c) {
+					case '"': _out += "\\\""; break;
+					case '\\': _out += "\\\\"; break;
+					case '\b': _out += "\\b"; break;
+					case '\t': _out += "\\t"; break;
+					case '\n': _out += "\\n"; break;
+					case '\f': _out += "\\f"; break;
+					case '\r': _out += "\\r"; break;
+					default:
+						_out += "\\u00";
+						_out += hexDigits[c >> 4];
+						_out += hexDigits[c & 0x0f];
+						break;
+				}
+			}
+			_out.append(value + plain, len - plain);
+			_out += '"';
+		}
+
+	}
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_JSONWRITER_H__
+#define __ELASTOS_SDK_JSONWRITER_H__
+
+#include <string>
+#include <stdint.h>
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Appends json straight to a string, without building a nlohmann::json document first. The output is the
+		 * same bytes as nlohmann::json::dump() of the equivalent document as long as the keys of every object are
+		 * written in the order nlohmann::json keeps them, which is std::string order ("Script" before "ScriptLen",
+		 * uppercase before lowercase). Strings with bytes from 0x80 up are escaped by nlohmann::json itself, so
+		 * invalid UTF-8 throws the same exception as dump().
+		 */
+		class JsonWriter {
+		public:
+			explicit JsonWriter(std::string &out);
+
+			JsonWriter &BeginObject();
+
+			JsonWriter &EndObject();
+
+			JsonWriter &BeginArray();
+
+			JsonWriter &EndArray();
+
+			// key of the next value, a literal that needs no escaping
+			JsonWriter &Key(const char *key);
+
+			JsonWriter &String(const std::string &value);
+
+			JsonWriter &String(const char *value);
+
+			// a string of the hex of data, the same as String(Utils::encodeHex()) or String(Utils::UInt256ToString())
+			JsonWriter &Hex(const uint8_t *data, size_t len, bool reverse = false);
+
+			JsonWriter &UInt(uint64_t value);
+
+			JsonWriter &Int(int64_t value);
+
+			JsonWriter &Bool(bool value);
+
+			JsonWriter &Null();
+
+			// an already serialized value, such as the dump() of a document
+			JsonWriter &Raw(const std::string &json);
+
+		private:
+			void beginValue();
+
+			void writeString(const char *value, size_t len);
+
+		private:
+			std::string &_out;
+			bool _needComma;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_JSONWRITER_H__
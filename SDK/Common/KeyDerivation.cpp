@@ -0,0 +1,285 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <boost/thread.hpp>
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+
+#include "BRCrypto.h"
+#include "Log.h"
+#include "Utils.h"
+#include "KeyDerivation.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		KdfParams::KdfParams(uint32_t iterations) :
+				_algorithm(PBKDF2),
+				_iterations(iterations),
+				_blockSize(0),
+				_parallelism(0) {
+		}
+
+		KdfParams KdfParams::MemoryHard(uint32_t n, uint32_t r, uint32_t p) {
+			KdfParams params(n);
+			params._algorithm = Scrypt;
+			params._blockSize = r;
+			params._parallelism = p;
+			return params;
+		}
+
+		KdfParams::Algorithm KdfParams::GetAlgorithm() const {
+			return _algorithm;
+		}
+
+		uint32_t KdfParams::GetIterations() const {
+			return _iterations;
+		}
+
+		uint32_t KdfParams::GetBlockSize() const {
+			return _blockSize;
+		}
+
+		uint32_t KdfParams::GetParallelism() const {
+			return _parallelism;
+		}
+
+		bool KdfParams::IsValid() const {
+			if (_algorithm == PBKDF2)
+				return _iterations > 0 && _iterations <= MAX_PBKDF2_ITERATIONS;
+
+			// scrypt needs N a power of two, N * r * 128 bytes of heap and r, p bounded for the stack
+			return _iterations > 1 && (_iterations & (_iterations - 1)) == 0 &&
+				   _blockSize > 0 && _blockSize <= MAX_SCRYPT_R && _parallelism > 0 && _parallelism <= MAX_SCRYPT_P &&
+				   uint64_t(_blockSize) * _parallelism <= MAX_SCRYPT_R_P &&
+				   uint64_t(_iterations) * _blockSize <= MAX_SCRYPT_N_R;
+		}
+
+		bool KdfParams::Derive(unsigned char *key, size_t keyLen, const unsigned char *password, size_t passwordLen,
+							   const unsigned char *salt, size_t saltLen) const {
+			if (!IsValid())
+				return false;
+
+			if (_algorithm == Scrypt) {
+				BRScrypt(key, keyLen, password, passwordLen, salt, saltLen, _iterations, _blockSize, _parallelism);
+				return true;
+			}
+
+			return 1 == PKCS5_PBKDF2_HMAC((const char *) password, (int) passwordLen, salt, (int) saltLen,
+										  (int) _iterations, EVP_sha256(), (int) keyLen, key);
+		}
+
+		bool KdfParams::operator==(const KdfParams &other) const {
+			return _algorithm == other._algorithm && _iterations == other._iterations &&
+				   _blockSize == other._blockSize && _parallelism == other._parallelism;
+		}
+
+		DerivedKeyCache &DerivedKeyCache::Instance() {
+			// intentionally leaked: the sweeper thread is detached and may outlive static destruction
+			static DerivedKeyCache *cache = new DerivedKeyCache();
+			return *cache;
+		}
+
+		DerivedKeyCache::DerivedKeyCache() :
+				_sweeperStarted(false),
+				_timeout(0),
+				_slots(nullptr),
+				_slotCount(0) {
+			for (size_t i = 0; i < sizeof(_secret); ++i)
+				_secret.u8[i] = Utils::getRandomByte();
+		}
+
+		DerivedKeyCache::~DerivedKeyCache() {
+			Clear();
+			if (_slots != nullptr)
+				munmap(_slots, _slotCount * sizeof(Slot));
+		}
+
+		bool DerivedKeyCache::lockMemory() {
+			if (_slots != nullptr)
+				return true;
+
+			size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+			void *page = mmap(nullptr, pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (page == MAP_FAILED)
+				return false;
+
+			if (mlock(page, pageSize) != 0) {
+				Log::getLogger()->warn("Derived key cache disabled: unable to lock memory.");
+				munmap(page, pageSize);
+				return false;
+			}
+#ifdef MADV_DONTDUMP
+			madvise(page, pageSize, MADV_DONTDUMP);
+#endif
+
+			_slots = static_cast<Slot *>(page);
+			_slotCount = pageSize / sizeof(Slot);
+			return true;
+		}
+
+		void DerivedKeyCache::SetTimeout(uint32_t seconds) {
+			boost::mutex::scoped_lock lock(_lock);
+			_timeout = seconds;
+			if (_timeout == 0) {
+				while (!_entries.empty())
+					erase(_entries.begin());
+			}
+			_wakeUp.notify_all();
+		}
+
+		uint32_t DerivedKeyCache::GetTimeout() const {
+			boost::mutex::scoped_lock lock(_lock);
+			return _timeout;
+		}
+
+		bool DerivedKeyCache::Derive(const std::string &walletID, const KdfParams &params, unsigned char *key,
+									 size_t keyLen, const unsigned char *password, size_t passwordLen,
+									 const unsigned char *salt, size_t saltLen) {
+			if (walletID.empty() || keyLen > sizeof(Slot::key) || GetTimeout() == 0)
+				return params.Derive(key, keyLen, password, passwordLen, salt, saltLen);
+
+			UInt256 print = fingerprint(params, password, passwordLen, salt, saltLen);
+			boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+
+			{
+				boost::mutex::scoped_lock lock(_lock);
+				EntryMap::iterator it = _entries.find(walletID);
+				if (it != _entries.end() && it->second.keyLen == keyLen && it->second.expires > now &&
+					0 == CRYPTO_memcmp(&it->second.slot->fingerprint, &print, sizeof(print))) {
+					memcpy(key, it->second.slot->key, keyLen);
+					it->second.expires = now + boost::posix_time::seconds(_timeout);
+					return true;
+				}
+			}
+
+			// run the KDF unlocked, other wallets keep using the cache meanwhile
+			return params.Derive(key, keyLen, password, passwordLen, salt, saltLen);
+		}
+
+		void DerivedKeyCache::Store(const std::string &walletID, const KdfParams &params, const unsigned char *key,
+									size_t keyLen, const unsigned char *password, size_t passwordLen,
+									const unsigned char *salt, size_t saltLen) {
+			if (walletID.empty() || keyLen > sizeof(Slot::key) || GetTimeout() == 0)
+				return;
+
+			UInt256 print = fingerprint(params, password, passwordLen, salt, saltLen);
+			boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+
+			boost::mutex::scoped_lock lock(_lock);
+			if (_timeout == 0 || !lockMemory())
+				return;
+
+			EntryMap::iterator it = _entries.find(walletID);
+			if (it != _entries.end())
+				erase(it);
+
+			Slot *slot = allocSlot();
+			slot->fingerprint = print;
+			memcpy(slot->key, key, keyLen);
+
+			Entry &entry = _entries[walletID];
+			entry.slot = slot;
+			entry.keyLen = keyLen;
+			entry.expires = now + boost::posix_time::seconds(_timeout);
+
+			if (!_sweeperStarted) {
+				_sweeperStarted = true;
+				boost::thread(boost::bind(&DerivedKeyCache::sweepLoop, this)).detach();
+			}
+			_wakeUp.notify_all();
+		}
+
+		void DerivedKeyCache::Clear(const std::string &walletID) {
+			boost::mutex::scoped_lock lock(_lock);
+			EntryMap::iterator it = _entries.find(walletID);
+			if (it != _entries.end())
+				erase(it);
+		}
+
+		void DerivedKeyCache::Clear() {
+			boost::mutex::scoped_lock lock(_lock);
+			while (!_entries.empty())
+				erase(_entries.begin());
+		}
+
+		size_t DerivedKeyCache::Size() const {
+			boost::mutex::scoped_lock lock(_lock);
+			return _entries.size();
+		}
+
+		UInt256 DerivedKeyCache::fingerprint(const KdfParams &params, const unsigned char *password,
+											 size_t passwordLen, const unsigned char *salt, size_t saltLen) const {
+			// keyed with a per process secret, so a fingerprint is useless for guessing passwords offline
+			uint32_t settings[] = {(uint32_t) params.GetAlgorithm(), params.GetIterations(), params.GetBlockSize(),
+								   params.GetParallelism()};
+			CMBlock macKey(sizeof(_secret) + sizeof(settings) + saltLen);
+			memcpy(macKey, &_secret, sizeof(_secret));
+			memcpy(&macKey[sizeof(_secret)], settings, sizeof(settings));
+			if (saltLen > 0)
+				memcpy(&macKey[sizeof(_secret) + sizeof(settings)], salt, saltLen);
+
+			UInt256 mac;
+			BRHMAC(&mac, BRSHA256, sizeof(UInt256), macKey, macKey.GetSize(), password, passwordLen);
+			mem_clean(macKey, macKey.GetSize());
+			return mac;
+		}
+
+		DerivedKeyCache::Slot *DerivedKeyCache::allocSlot() {
+			for (size_t i = 0; i < _slotCount; ++i) {
+				bool used = false;
+				for (EntryMap::iterator it = _entries.begin(); it != _entries.end() && !used; ++it)
+					used = it->second.slot == &_slots[i];
+				if (!used)
+					return &_slots[i];
+			}
+
+			// locked page is full, evict the entry closest to expiry
+			EntryMap::iterator victim = _entries.begin();
+			for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+				if (it->second.expires < victim->second.expires)
+					victim = it;
+			}
+			Slot *slot = victim->second.slot;
+			erase(victim);
+			return slot;
+		}
+
+		void DerivedKeyCache::erase(EntryMap::iterator it) {
+			mem_clean(it->second.slot, sizeof(Slot));
+			_entries.erase(it);
+		}
+
+		void DerivedKeyCache::sweep() {
+			boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+			for (EntryMap::iterator it = _entries.begin(); it != _entries.end();) {
+				if (it->second.expires <= now)
+					erase(it++);
+				else
+					++it;
+			}
+		}
+
+		void DerivedKeyCache::sweepLoop() {
+			boost::mutex::scoped_lock lock(_lock);
+			for (;;) {
+				sweep();
+				if (_entries.empty()) {
+					_wakeUp.wait(lock);
+					continue;
+				}
+
+				boost::posix_time::ptime next = _entries.begin()->second.expires;
+				for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+					if (it->second.expires < next)
+						next = it->second.expires;
+				}
+				_wakeUp.timed_wait(lock, next);
+			}
+		}
+
+	}
+}
@@ -0,0 +1,146 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_KEYDERIVATION_H__
+#define __ELASTOS_SDK_KEYDERIVATION_H__
+
+#include <map>
+#include <string>
+#include <cstdint>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include "BRInt.h"
+
+#define DEFAULT_PBKDF2_ITERATIONS 10000
+#define DEFAULT_SCRYPT_N 16384
+#define DEFAULT_SCRYPT_R 8
+#define DEFAULT_SCRYPT_P 1
+
+// upper bounds for settings read from keystores: BRScrypt takes 256 * r + 128 * r * p bytes of stack
+#define MAX_PBKDF2_ITERATIONS 1000000
+#define MAX_SCRYPT_N_R (1 << 20)
+#define MAX_SCRYPT_R 32
+#define MAX_SCRYPT_P 16
+#define MAX_SCRYPT_R_P 64
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Password based key derivation settings. The default is the PBKDF2-HMAC-SHA256 derivation every existing
+		 * ciphertext was produced with; MemoryHard() selects scrypt.
+		 */
+		class KdfParams {
+		public:
+			enum Algorithm {
+				PBKDF2 = 0,
+				Scrypt
+			};
+
+			explicit KdfParams(uint32_t iterations = DEFAULT_PBKDF2_ITERATIONS);
+
+			static KdfParams MemoryHard(uint32_t n = DEFAULT_SCRYPT_N, uint32_t r = DEFAULT_SCRYPT_R,
+										uint32_t p = DEFAULT_SCRYPT_P);
+
+			Algorithm GetAlgorithm() const;
+
+			// PBKDF2 rounds, or the scrypt cost parameter N
+			uint32_t GetIterations() const;
+
+			uint32_t GetBlockSize() const;
+
+			uint32_t GetParallelism() const;
+
+			bool IsValid() const;
+
+			bool Derive(unsigned char *key, size_t keyLen, const unsigned char *password, size_t passwordLen,
+						const unsigned char *salt, size_t saltLen) const;
+
+			bool operator==(const KdfParams &other) const;
+
+		private:
+			Algorithm _algorithm;
+			uint32_t _iterations;
+			uint32_t _blockSize;
+			uint32_t _parallelism;
+		};
+
+		/**
+		 * Keeps keys derived from pay passwords for a limited time so repeated signing with the same wallet does
+		 * not run the KDF every time. Entries are keyed by wallet id and only hit when password, salt and KDF
+		 * settings match. Keys live in a single mlock'd page excluded from core dumps and are wiped by a sweeper
+		 * thread as soon as they expire, or when a wallet changes password or is destroyed.
+		 * The cache is disabled until a timeout is set.
+		 */
+		class DerivedKeyCache {
+		public:
+			static DerivedKeyCache &Instance();
+
+			// seconds a derived key stays usable after its last use, 0 disables caching and wipes every entry
+			void SetTimeout(uint32_t seconds);
+
+			uint32_t GetTimeout() const;
+
+			// the cached key if there is one, otherwise run the KDF; an empty wallet id always runs the KDF
+			bool Derive(const std::string &walletID, const KdfParams &params, unsigned char *key, size_t keyLen,
+						const unsigned char *password, size_t passwordLen, const unsigned char *salt, size_t saltLen);
+
+			// cache a key from Derive() once it proved right, so a wrong password never replaces a good entry
+			void Store(const std::string &walletID, const KdfParams &params, const unsigned char *key, size_t keyLen,
+					   const unsigned char *password, size_t passwordLen, const unsigned char *salt, size_t saltLen);
+
+			void Clear(const std::string &walletID);
+
+			void Clear();
+
+			size_t Size() const;
+
+		private:
+			struct Slot {
+				UInt256 fingerprint;
+				unsigned char key[64];
+			};
+
+			struct Entry {
+				Slot *slot;
+				size_t keyLen;
+				boost::posix_time::ptime expires;
+			};
+
+			typedef std::map<std::string, Entry> EntryMap;
+
+			DerivedKeyCache();
+
+			~DerivedKeyCache();
+
+			bool lockMemory();
+
+			UInt256 fingerprint(const KdfParams &params, const unsigned char *password, size_t passwordLen,
+								const unsigned char *salt, size_t saltLen) const;
+
+			Slot *allocSlot();
+
+			void erase(EntryMap::iterator it);
+
+			void sweep();
+
+			void sweepLoop();
+
+		private:
+			mutable boost::mutex _lock;
+			boost::condition_variable _wakeUp;
+			bool _sweeperStarted;
+			uint32_t _timeout;
+			UInt256 _secret;
+			Slot *_slots;
+			size_t _slotCount;
+			EntryMap _entries;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_KEYDERIVATION_H__
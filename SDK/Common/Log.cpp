@@ -2,20 +2,131 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/dist_sink.h>
+#if defined(SPDLOG_VER_MAJOR)
+#include <spdlog/async.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+#if defined(__ANDROID__)
+#include <spdlog/sinks/android_sink.h>
+#else
+#include <spdlog/sinks/stdout_color_sinks.h>
+#endif
+#endif
+
+#include "BRPeer.h"
+
 #include "Log.h"
 
+// messages waiting for the writer thread, must be a power of 2 for spdlog 0.x
+#define LOG_QUEUE_SIZE 8192
+
 namespace Elastos {
 	namespace ElaWallet {
 
+		namespace {
+			const char *subsystemNames[Log::SubsystemCount] = {"spvsdk", "peer", "wallet", "db", "keystore"};
+
+			spdlog::sink_ptr consoleSink() {
+#if defined(SPDLOG_VER_MAJOR)
 #if defined(__ANDROID__)
-		std::shared_ptr<spdlog::logger> Log::_consoleLog = spdlog::android_logger("Elastos", "spvsdk");
+				return std::make_shared<spdlog::sinks::android_sink_mt>("spvsdk");
+#else
+				return std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+#endif
+#else
+				// spdlog 0.x only hands out its console sinks through the logger factories
+#if defined(__ANDROID__)
+				std::shared_ptr<spdlog::logger> console = spdlog::android_logger("Elastos", "spvsdk");
+#else
+				std::shared_ptr<spdlog::logger> console = spdlog::stdout_color_mt("console");
+#endif
+				spdlog::drop(console->name());
+				return console->sinks().front();
+#endif
+			}
+
+			void peerLog(int level, const char *message);
+
+			struct Backend {
+				Backend() :
+						Sink(std::make_shared<spdlog::sinks::dist_sink_mt>()) {
+					Sink->add_sink(consoleSink());
+
+#if defined(SPDLOG_VER_MAJOR)
+					ThreadPool = std::make_shared<spdlog::details::thread_pool>(LOG_QUEUE_SIZE, 1);
+#endif
+					for (int i = 0; i < Log::SubsystemCount; ++i) {
+#if defined(SPDLOG_VER_MAJOR)
+						Loggers[i] = std::make_shared<spdlog::async_logger>(subsystemNames[i], Sink, ThreadPool,
+																			spdlog::async_overflow_policy::overrun_oldest);
 #else
-		std::shared_ptr<spdlog::logger> Log::_consoleLog = spdlog::stdout_color_mt("console");
+						Loggers[i] = std::make_shared<spdlog::async_logger>(subsystemNames[i], Sink, LOG_QUEUE_SIZE,
+																			spdlog::async_overflow_policy::discard_log_msg);
 #endif
+					}
+
+					BRPeerSetLogHandler(peerLog);
+				}
+
+				~Backend() {
+					// peer threads still running at exit fall back to stdout
+					BRPeerSetLogHandler(nullptr);
+				}
+
+				std::shared_ptr<spdlog::sinks::dist_sink_mt> Sink;
+#if defined(SPDLOG_VER_MAJOR)
+				// declared before the loggers, so it is destroyed after them and drains the queue first
+				std::shared_ptr<spdlog::details::thread_pool> ThreadPool;
+#endif
+				std::shared_ptr<spdlog::logger> Loggers[Log::SubsystemCount];
+			};
+
+			Backend &backend() {
+				static Backend instance;
+				return instance;
+			}
+
+			void peerLog(int level, const char *message) {
+				backend().Loggers[Log::Peer]->log((spdlog::level::level_enum) level, "{}", message);
+			}
+		}
+
 		Elastos::ElaWallet::SetLogLevel g_setLogLevel;
 
-		const std::shared_ptr<spdlog::logger> &Log::getLogger() {
-			return _consoleLog;
+		void Log::setLevel(spdlog::level::level_enum lvl) {
+			for (int i = 0; i < SubsystemCount; ++i)
+				setLevel((Subsystem) i, lvl);
+		}
+
+		void Log::setLevel(Subsystem subsystem, spdlog::level::level_enum lvl) {
+			getLogger(subsystem)->set_level(lvl);
+			if (subsystem == Peer)
+				BRPeerSetLogLevel(lvl);
+		}
+
+		const std::shared_ptr<spdlog::logger> &Log::getLogger(Subsystem subsystem) {
+			return backend().Loggers[subsystem];
+		}
+
+		bool Log::findSubsystem(const std::string &name, Subsystem &subsystem) {
+			for (int i = 0; i < SubsystemCount; ++i) {
+				if (name == subsystemNames[i]) {
+					subsystem = (Subsystem) i;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void Log::enableFileLogging(const std::string &fileName, size_t maxFileSize, size_t maxFiles) {
+			backend().Sink->add_sink(std::make_shared<spdlog::sinks::rotating_file_sink_mt>(fileName, maxFileSize,
+																							 maxFiles));
+		}
+
+		void Log::flush() {
+			for (int i = 0; i < SubsystemCount; ++i)
+				backend().Loggers[i]->flush();
 		}
 
 	}
@@ -11,63 +11,92 @@
 namespace Elastos {
 	namespace ElaWallet {
 
+		/**
+		 * Loggers of the sdk, one per subsystem with its own level. Every logger is asynchronous: callers only format
+		 * the message and push it to a bounded queue, a background thread writes it to the console and, when enabled,
+		 * to rotating log files. When the queue is full messages are dropped rather than blocking a peer thread.
+		 * peer_log() and peer_dbg() of Core go to the Peer logger.
+		 */
 		class Log {
 		public:
+			enum Subsystem {
+				Default,
+				Peer,
+				Wallet,
+				Database,
+				KeyStore,
+				SubsystemCount
+			};
 
 			template<typename T>
 			static void log(spdlog::level::level_enum lvl, const T &msg) {
-				_consoleLog->log(lvl, msg);
+				getLogger()->log(lvl, msg);
 			}
 
-			static void setLevel(spdlog::level::level_enum lvl) {
-				spdlog::set_level(lvl);
+			// sets the level of every subsystem
+			static void setLevel(spdlog::level::level_enum lvl);
+
+			static void setLevel(Subsystem subsystem, spdlog::level::level_enum lvl);
+
+			// check before building expensive arguments, the logger itself only skips the formatting
+			static bool shouldLog(Subsystem subsystem, spdlog::level::level_enum lvl) {
+				return getLogger(subsystem)->should_log(lvl);
 			}
 
 			template<typename T>
 			static void trace(const T &msg) {
-				_consoleLog->trace(msg);
+				getLogger()->trace(msg);
 			}
 
 			template<typename T>
 			static void debug(const T &msg) {
-				_consoleLog->debug(msg);
+				getLogger()->debug(msg);
 			}
 
 			template<typename T>
 			static void info(const T &msg) {
-				_consoleLog->info(msg);
+				getLogger()->info(msg);
 			}
 
 			template<typename T>
 			static void warn(const T &msg){
-				_consoleLog->warn(msg);
+				getLogger()->warn(msg);
 			}
 
 			template<typename T>
 			static void error(const T &msg){
-				_consoleLog->error(msg);
+				getLogger()->error(msg);
 			}
 
 			template<typename T>
 			static void critical(const T &msg) {
-				_consoleLog->critical(msg);
+				getLogger()->critical(msg);
 			}
 
 			template<typename... Args>
 			static void log(spdlog::level::level_enum lvl, const char *msg){
-				_consoleLog->log(lvl, msg);
+				getLogger()->log(lvl, msg);
 			}
 
-			static const std::shared_ptr<spdlog::logger>& getLogger();
+			static const std::shared_ptr<spdlog::logger>& getLogger(Subsystem subsystem = Default);
+
+			// names are "spvsdk", "peer", "wallet", "db" and "keystore", as printed in the log lines
+			static bool findSubsystem(const std::string &name, Subsystem &subsystem);
+
+			/**
+			 * Also write every logger to fileName, rotated when it grows over maxFileSize bytes, keeping maxFiles old
+			 * files. Console output is kept.
+			 */
+			static void enableFileLogging(const std::string &fileName, size_t maxFileSize, size_t maxFiles);
 
-		private:
-			static std::shared_ptr<spdlog::logger> _consoleLog;
+			// ask the background thread to flush the sinks, returns before it is done
+			static void flush();
 		};
 
 		class SetLogLevel {
 		public:
 			SetLogLevel() {
-				spdlog::set_level(spdlog::level::from_str(SPVSDK_SPDLOG_LEVEL));
+				Log::setLevel(spdlog::level::from_str(SPVSDK_SPDLOG_LEVEL));
 			}
 		};
 
@@ -0,0 +1,130 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "BRCrypto.h"
+#include "MerkleTree.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			inline static int _ceil_log2(uint32_t x) {
+				int r = (x & (x - 1)) ? 1 : 0;
+
+				while ((x >>= 1) != 0) r++;
+				return r;
+			}
+		}
+
+		UInt256 MerkleTree::PartialRoot(const BRMerkleBlock &raw) {
+			const int maxDepth = _ceil_log2(raw.totalTx);
+			std::vector<std::vector<UInt256> > levels(maxDepth + 1);
+			std::vector<std::vector<bool> > internal(maxDepth + 1);
+			std::vector<int> stack(1, 0);
+			size_t hashIdx = 0, flagIdx = 0;
+
+			// depth first pass consumes flags and hashes in the same order as the recursive walk, and records every
+			// visited node on its level, left to right; the children of the k-th internal node of a level are then
+			// nodes 2k and 2k + 1 of the next level
+			while (!stack.empty()) {
+				int depth = stack.back();
+				UInt256 md = UINT256_ZERO;
+				bool isInternal = false;
+
+				stack.pop_back();
+				if (flagIdx / 8 < raw.flagsLen && hashIdx < raw.hashesCount) {
+					uint8_t flag = (raw.flags[flagIdx / 8] & (1 << (flagIdx % 8)));
+					flagIdx++;
+
+					if (flag && depth != maxDepth) {
+						isInternal = true;
+						stack.push_back(depth + 1); // right branch
+						stack.push_back(depth + 1); // left branch
+					} else md = raw.hashes[hashIdx++]; // leaf
+				}
+
+				levels[depth].push_back(md);
+				internal[depth].push_back(isInternal);
+			}
+
+			// bottom up, one batched double-sha per level
+			std::vector<UInt256> pairs;
+			for (int depth = maxDepth - 1; depth >= 0; --depth) {
+				const std::vector<UInt256> &children = levels[depth + 1];
+				size_t child = 0;
+
+				pairs.clear();
+				for (size_t i = 0; i < levels[depth].size(); ++i) {
+					if (!internal[depth][i])
+						continue;
+
+					UInt256 left = children[child++], right = children[child++];
+					// a missing left branch or duplicate hashes (CVE-2012-2459) abort the recursive walk and change
+					// what the rest of the tree evaluates to, leave those trees to the reference implementation
+					if (UInt256IsZero(&left) || UInt256Eq(&left, &right)) {
+						hashIdx = flagIdx = 0;
+						return PartialRootRecursive(&hashIdx, &flagIdx, 0, raw);
+					}
+
+					if (UInt256IsZero(&right)) right = left; // if right branch is missing, dup left branch
+					pairs.push_back(left);
+					pairs.push_back(right);
+				}
+
+				BRSHA256_2x64(pairs.data(), pairs.data(), pairs.size() / 2);
+
+				for (size_t i = 0, k = 0; i < levels[depth].size(); ++i) {
+					if (internal[depth][i])
+						levels[depth][i] = pairs[k++];
+				}
+			}
+
+			return levels[0][0];
+		}
+
+		// recursively walks the merkle tree to calculate the merkle root
+		// NOTE: this merkle tree design has a security vulnerability (CVE-2012-2459), which can be defended against by
+		// considering the merkle root invalid if there are duplicate hashes in any rows with an even number of elements
+		UInt256 MerkleTree::PartialRootRecursive(size_t *hashIdx, size_t *flagIdx, int depth, const BRMerkleBlock &raw) {
+			uint8_t flag;
+			UInt256 hashes[2], md = UINT256_ZERO;
+
+			if (*flagIdx/8 < raw.flagsLen && *hashIdx < raw.hashesCount) {
+				flag = (raw.flags[*flagIdx/8] & (1 << (*flagIdx % 8)));
+				(*flagIdx)++;
+
+				if (flag && depth != _ceil_log2(raw.totalTx)) {
+					hashes[0] = PartialRootRecursive(hashIdx, flagIdx, depth + 1, raw); // left branch
+					hashes[1] = PartialRootRecursive(hashIdx, flagIdx, depth + 1, raw); // right branch
+
+					if (! UInt256IsZero(&hashes[0]) && ! UInt256Eq(&(hashes[0]), &(hashes[1]))) {
+						if (UInt256IsZero(&hashes[1])) hashes[1] = hashes[0]; // if right branch is missing, dup left branch
+						BRSHA256_2(&md, hashes, sizeof(hashes));
+					}
+					else *hashIdx = SIZE_MAX; // defend against (CVE-2012-2459)
+				}
+				else md = raw.hashes[(*hashIdx)++]; // leaf
+			}
+
+			return md;
+		}
+
+		UInt256 MerkleTree::Root(const std::vector<UInt256> &leaves) {
+			if (leaves.empty())
+				return UINT256_ZERO;
+
+			std::vector<UInt256> level(leaves);
+			while (level.size() > 1) {
+				if (level.size() % 2)
+					level.push_back(level.back());
+
+				BRSHA256_2x64(level.data(), level.data(), level.size() / 2);
+				level.resize(level.size() / 2);
+			}
+
+			return level[0];
+		}
+
+	}
+}
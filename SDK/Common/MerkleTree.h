@@ -0,0 +1,42 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_MERKLETREE_H__
+#define __ELASTOS_SDK_MERKLETREE_H__
+
+#include <vector>
+
+#include "BRInt.h"
+#include "BRMerkleBlock.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Merkle root computations shared by the mainchain block, the sidechain blocks and AuxPow proofs.
+		 * Trees are reduced one level at a time and every level is hashed with a single BRSHA256_2x64 call.
+		 */
+		class MerkleTree {
+		public:
+			/**
+			 * Root of the partial merkle tree carried by a merkle block (hashes + flags, depth first).
+			 * Returns exactly what PartialRootRecursive() returns, including the CVE-2012-2459 handling.
+			 */
+			static UInt256 PartialRoot(const BRMerkleBlock &raw);
+
+			/**
+			 * Reference recursive walk of the partial merkle tree, kept as the slow path for malformed trees.
+			 */
+			static UInt256 PartialRootRecursive(size_t *hashIdx, size_t *flagIdx, int depth, const BRMerkleBlock &raw);
+
+			/**
+			 * Root of the full merkle tree over leaves, duplicating the last hash of odd sized levels.
+			 */
+			static UInt256 Root(const std::vector<UInt256> &leaves);
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_MERKLETREE_H__
@@ -0,0 +1,223 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <algorithm>
+#include <sstream>
+#include <boost/filesystem/fstream.hpp>
+
+#include "BRMetrics.h"
+
+#include "Metrics.h"
+#include "Log.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			std::string formatNumber(double value) {
+				char buf[32];
+				snprintf(buf, sizeof(buf), "%.15g", value);
+				return buf;
+			}
+
+			std::string escapeHelp(const std::string &help) {
+				std::string escaped;
+				for (size_t i = 0; i < help.size(); ++i) {
+					if (help[i] == '\\')
+						escaped += "\\\\";
+					else if (help[i] == '\n')
+						escaped += "\\n";
+					else
+						escaped += help[i];
+				}
+				return escaped;
+			}
+
+			std::string series(const std::string &name, const std::string &labels) {
+				return labels.empty() ? name : name + "{" + labels + "}";
+			}
+
+			void writeHeader(std::ostream &out, const std::string &name, const std::string &help,
+							 const std::string &type) {
+				out << "# HELP " << name << " " << escapeHelp(help) << "\n";
+				out << "# TYPE " << name << " " << type << "\n";
+			}
+
+			void writeCoreCounter(std::ostream &out, const std::string &name, const std::string &help,
+								  BRMetricCounter counter) {
+				writeHeader(out, name, help, "counter");
+				out << name << " " << BRMetricGet(counter) << "\n";
+			}
+
+			void writeCoreGauge(std::ostream &out, const std::string &name, const std::string &help,
+								BRMetricGauge gauge) {
+				writeHeader(out, name, help, "gauge");
+				out << name << " " << formatNumber(BRMetricGaugeGet(gauge)) << "\n";
+			}
+		}
+
+		MetricHistogram::MetricHistogram(const std::vector<double> &bounds) :
+				_bounds(bounds),
+				_buckets(new std::atomic<uint64_t>[bounds.size() + 1]),
+				_count(0),
+				_sum(0) {
+			std::sort(_bounds.begin(), _bounds.end());
+			for (size_t i = 0; i <= _bounds.size(); ++i)
+				_buckets[i].store(0, std::memory_order_relaxed);
+		}
+
+		MetricHistogram::~MetricHistogram() {
+			delete[] _buckets;
+		}
+
+		void MetricHistogram::Observe(double value) {
+			size_t bucket = std::lower_bound(_bounds.begin(), _bounds.end(), value) - _bounds.begin();
+			_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+			_count.fetch_add(1, std::memory_order_relaxed);
+
+			double sum = _sum.load(std::memory_order_relaxed);
+			while (!_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed));
+		}
+
+		const std::vector<double> &MetricHistogram::GetBounds() const {
+			return _bounds;
+		}
+
+		std::vector<uint64_t> MetricHistogram::GetBucketCounts() const {
+			std::vector<uint64_t> counts(_bounds.size() + 1);
+			for (size_t i = 0; i < counts.size(); ++i)
+				counts[i] = _buckets[i].load(std::memory_order_relaxed);
+			return counts;
+		}
+
+		uint64_t MetricHistogram::GetCount() const {
+			return _count.load(std::memory_order_relaxed);
+		}
+
+		double MetricHistogram::GetSum() const {
+			return _sum.load(std::memory_order_relaxed);
+		}
+
+		Metrics::Metrics() {
+		}
+
+		Metrics &Metrics::Instance() {
+			// intentionally leaked, instrumented code may still run during static destruction
+			static Metrics *metrics = new Metrics();
+			return *metrics;
+		}
+
+		Metrics::Family &Metrics::family(const std::string &name, const std::string &help, const std::string &type) {
+			Family &f = _families[name];
+			if (f.Type.empty()) {
+				f.Help = help;
+				f.Type = type;
+			} else if (f.Type != type) {
+				throw std::logic_error("metric " + name + " is already registered as a " + f.Type);
+			}
+			return f;
+		}
+
+		MetricCounter &Metrics::Counter(const std::string &name, const std::string &help, const std::string &labels) {
+			boost::mutex::scoped_lock lock(_lock);
+			Family &f = family(name, help, "counter");
+			MetricCounter *&counter = f.Counters[labels];
+			if (counter == nullptr)
+				counter = new MetricCounter();
+			return *counter;
+		}
+
+		MetricHistogram &Metrics::Histogram(const std::string &name, const std::string &help,
+											const std::vector<double> &bounds, const std::string &labels) {
+			boost::mutex::scoped_lock lock(_lock);
+			Family &f = family(name, help, "histogram");
+			MetricHistogram *&histogram = f.Histograms[labels];
+			if (histogram == nullptr)
+				histogram = new MetricHistogram(bounds);
+			return *histogram;
+		}
+
+		std::string Metrics::RenderPrometheus() const {
+			std::stringstream out;
+
+			writeCoreCounter(out, "spv_peer_connects_total", "Peers that completed the handshake.",
+							 BRMetricPeerConnects);
+			writeCoreCounter(out, "spv_peer_disconnects_total", "Peer disconnects, including failed connects.",
+							 BRMetricPeerDisconnects);
+			writeCoreCounter(out, "spv_peer_received_bytes_total", "Bytes read from peer sockets.",
+							 BRMetricBytesReceived);
+			writeCoreCounter(out, "spv_peer_sent_bytes_total", "Bytes written to peer sockets.", BRMetricBytesSent);
+			writeCoreCounter(out, "spv_blocks_received_total", "Merkle blocks and headers relayed by peers.",
+							 BRMetricBlocksReceived);
+			writeCoreGauge(out, "spv_blocks_per_second", "Blocks received per second over the last second.",
+						   BRMetricBlocksPerSecond);
+			writeCoreGauge(out, "spv_bloom_false_positive_rate", "Observed bloom filter false positive rate.",
+						   BRMetricFalsePositiveRate);
+
+			boost::mutex::scoped_lock lock(_lock);
+			for (std::map<std::string, Family>::const_iterator it = _families.begin(); it != _families.end(); ++it) {
+				const std::string &name = it->first;
+				const Family &f = it->second;
+				writeHeader(out, name, f.Help, f.Type);
+
+				for (std::map<std::string, MetricCounter *>::const_iterator c = f.Counters.begin();
+					 c != f.Counters.end(); ++c)
+					out << series(name, c->first) << " " << c->second->Value() << "\n";
+
+				for (std::map<std::string, MetricHistogram *>::const_iterator h = f.Histograms.begin();
+					 h != f.Histograms.end(); ++h) {
+					const std::string separator = h->first.empty() ? "" : ",";
+					const std::vector<double> &bounds = h->second->GetBounds();
+					std::vector<uint64_t> counts = h->second->GetBucketCounts();
+
+					uint64_t cumulative = 0;
+					for (size_t i = 0; i < counts.size(); ++i) {
+						cumulative += counts[i];
+						std::string le = i < bounds.size() ? formatNumber(bounds[i]) : "+Inf";
+						out << name << "_bucket{" << h->first << separator << "le=\"" << le << "\"} " << cumulative
+							<< "\n";
+					}
+					out << series(name + "_sum", h->first) << " " << formatNumber(h->second->GetSum()) << "\n";
+					out << series(name + "_count", h->first) << " " << cumulative << "\n";
+				}
+			}
+
+			return out.str();
+		}
+
+		bool Metrics::DumpToFile(const boost::filesystem::path &path) const {
+			boost::filesystem::path temp = path;
+			temp += ".tmp";
+
+			{
+				boost::filesystem::ofstream out(temp, std::ios::out | std::ios::trunc);
+				if (!out) {
+					Log::getLogger()->error("Can not write metrics to {}", temp.string());
+					return false;
+				}
+				out << RenderPrometheus();
+				if (!out.flush()) {
+					Log::getLogger()->error("Can not write metrics to {}", temp.string());
+					return false;
+				}
+			}
+
+			boost::system::error_code ec;
+			boost::filesystem::rename(temp, path, ec);
+			if (ec) {
+				Log::getLogger()->error("Can not move metrics to {}: {}", path.string(), ec.message());
+				return false;
+			}
+			return true;
+		}
+
+		const std::vector<double> &Metrics::LatencyBuckets() {
+			static const double bounds[] = {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5,
+											1, 5, 10};
+			static const std::vector<double> buckets(bounds, bounds + sizeof(bounds) / sizeof(bounds[0]));
+			return buckets;
+		}
+
+	}
+}
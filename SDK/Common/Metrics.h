@@ -0,0 +1,123 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_METRICS_H__
+#define __ELASTOS_SDK_METRICS_H__
+
+#include <map>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <boost/filesystem.hpp>
+#include <boost/thread/mutex.hpp>
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		class MetricCounter {
+		public:
+			MetricCounter() : _value(0) {
+			}
+
+			void Increment(uint64_t delta = 1) {
+				_value.fetch_add(delta, std::memory_order_relaxed);
+			}
+
+			uint64_t Value() const {
+				return _value.load(std::memory_order_relaxed);
+			}
+
+		private:
+			std::atomic<uint64_t> _value;
+		};
+
+		/**
+		 * Histogram over fixed upper bounds given at creation, an observation only bumps one bucket and the sum.
+		 */
+		class MetricHistogram {
+		public:
+			explicit MetricHistogram(const std::vector<double> &bounds);
+
+			~MetricHistogram();
+
+			void Observe(double value);
+
+			const std::vector<double> &GetBounds() const;
+
+			// observations per bucket, not cumulative, the last one is +Inf
+			std::vector<uint64_t> GetBucketCounts() const;
+
+			uint64_t GetCount() const;
+
+			double GetSum() const;
+
+		private:
+			std::vector<double> _bounds;
+			std::atomic<uint64_t> *_buckets;
+			std::atomic<uint64_t> _count;
+			std::atomic<double> _sum;
+		};
+
+		// observes the seconds spent in its scope
+		class MetricTimer {
+		public:
+			explicit MetricTimer(MetricHistogram &histogram) :
+					_histogram(histogram),
+					_start(std::chrono::steady_clock::now()) {
+			}
+
+			~MetricTimer() {
+				_histogram.Observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count());
+			}
+
+		private:
+			MetricHistogram &_histogram;
+			std::chrono::steady_clock::time_point _start;
+		};
+
+		/**
+		 * Process wide metrics registry. Counters and histograms are created on first use and live as long as the
+		 * process, so hot paths look them up once and keep the reference. Labels are passed preformatted, e.g.
+		 * "type=\"tx\"", and every label set of a name is one series of the same family.
+		 */
+		class Metrics {
+		public:
+			static Metrics &Instance();
+
+			MetricCounter &Counter(const std::string &name, const std::string &help, const std::string &labels = "");
+
+			MetricHistogram &Histogram(const std::string &name, const std::string &help,
+									   const std::vector<double> &bounds, const std::string &labels = "");
+
+			// text exposition format 0.0.4, including the counters kept by the peer layer in Core
+			std::string RenderPrometheus() const;
+
+			// writes next to path and renames, so a textfile collector never reads a partial file
+			bool DumpToFile(const boost::filesystem::path &path) const;
+
+			// upper bounds in seconds for latencies from 10us to 10s
+			static const std::vector<double> &LatencyBuckets();
+
+		private:
+			struct Family {
+				std::string Help;
+				std::string Type;
+				std::map<std::string, MetricCounter *> Counters;
+				std::map<std::string, MetricHistogram *> Histograms;
+			};
+
+			Metrics();
+
+			Family &family(const std::string &name, const std::string &help, const std::string &type);
+
+		private:
+			mutable boost::mutex _lock;
+			std::map<std::string, Family> _families;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_METRICS_H__
@@ -0,0 +1,197 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_OBJECTPOOL_H__
+#define __ELASTOS_SDK_OBJECTPOOL_H__
+
+#include <new>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <boost/thread/mutex.hpp>
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Slab backed fixed size allocator. Memory is carved from slabs of SlabCount objects and
+		 * released blocks are kept on a free list for reuse, so bulk decoding (database load,
+		 * merkle block tx relay) costs a handful of allocations instead of one per object.
+		 * Slabs stay with the pool until Trim() hands the wholly free ones back to the heap.
+		 */
+		template<class T, size_t SlabCount = 256>
+		class ObjectPool {
+		public:
+			static ObjectPool &Instance() {
+				// intentionally leaked: objects may still be released during static destruction
+				static ObjectPool *pool = new ObjectPool();
+				return *pool;
+			}
+
+			void *Allocate(size_t size) {
+				if (size != sizeof(T))
+					return ::operator new(size);
+
+				boost::mutex::scoped_lock lock(_lock);
+				if (_freeList == nullptr)
+					addSlab(SlabCount);
+
+				Block *block = _freeList;
+				_freeList = block->next;
+				_freeCount--;
+				return block;
+			}
+
+			void Deallocate(void *p, size_t size) {
+				if (p == nullptr)
+					return;
+
+				if (size != sizeof(T)) {
+					::operator delete(p);
+					return;
+				}
+
+				boost::mutex::scoped_lock lock(_lock);
+				Block *block = static_cast<Block *>(p);
+				block->next = _freeList;
+				_freeList = block;
+				_freeCount++;
+			}
+
+			// make sure at least count objects can be allocated without touching the heap
+			void Reserve(size_t count) {
+				boost::mutex::scoped_lock lock(_lock);
+				// SlabCount sized slabs, so the part of a reservation that goes unused can be trimmed
+				while (count > _freeCount)
+					addSlab(SlabCount);
+			}
+
+			// free the slabs none of whose objects are allocated, returns the number of objects released
+			size_t Trim() {
+				boost::mutex::scoped_lock lock(_lock);
+				if (_freeCount == 0)
+					return 0;
+
+				std::vector<size_t> freeInSlab(_slabs.size(), 0);
+				for (Block *block = _freeList; block != nullptr; block = block->next)
+					freeInSlab[findSlab(block)]++;
+
+				size_t released = 0;
+				std::vector<Slab> kept;
+				for (size_t i = 0; i < _slabs.size(); ++i) {
+					if (freeInSlab[i] == _slabs[i].count)
+						released += _slabs[i].count;
+					else
+						kept.push_back(_slabs[i]);
+				}
+				if (released == 0)
+					return 0;
+
+				// unlink the blocks of the released slabs before freeing them
+				Block **link = &_freeList;
+				while (*link != nullptr) {
+					size_t i = findSlab(*link);
+					if (freeInSlab[i] == _slabs[i].count)
+						*link = (*link)->next;
+					else
+						link = &(*link)->next;
+				}
+
+				for (size_t i = 0; i < _slabs.size(); ++i) {
+					if (freeInSlab[i] == _slabs[i].count)
+						free(_slabs[i].blocks);
+				}
+
+				_slabs.swap(kept);
+				_freeCount -= released;
+				_capacity -= released;
+#ifdef __GLIBC__
+				// slabs are small enough to come from the main heap, which glibc only shrinks from the top
+				malloc_trim(0);
+#endif
+				return released;
+			}
+
+			size_t Capacity() const {
+				boost::mutex::scoped_lock lock(_lock);
+				return _capacity;
+			}
+
+			size_t Available() const {
+				boost::mutex::scoped_lock lock(_lock);
+				return _freeCount;
+			}
+
+		private:
+			union Block {
+				Block *next;
+				typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+			};
+
+			struct Slab {
+				Block *blocks;
+				size_t count;
+
+				bool operator<(const Slab &other) const {
+					return std::less<Block *>()(blocks, other.blocks);
+				}
+			};
+
+			ObjectPool() :
+					_freeList(nullptr),
+					_freeCount(0),
+					_capacity(0) {
+			}
+
+			~ObjectPool() {
+				for (size_t i = 0; i < _slabs.size(); ++i)
+					free(_slabs[i].blocks);
+			}
+
+			// index of the slab holding block, _slabs is sorted by address
+			size_t findSlab(const Block *block) const {
+				Slab key = {const_cast<Block *>(block), 0};
+				return std::upper_bound(_slabs.begin(), _slabs.end(), key) - _slabs.begin() - 1;
+			}
+
+			void addSlab(size_t count) {
+				Block *slab = static_cast<Block *>(malloc(count * sizeof(Block)));
+				if (slab == nullptr)
+					throw std::bad_alloc();
+
+				Slab entry = {slab, count};
+				_slabs.insert(std::upper_bound(_slabs.begin(), _slabs.end(), entry), entry);
+				for (size_t i = count; i > 0; --i) {
+					slab[i - 1].next = _freeList;
+					_freeList = &slab[i - 1];
+				}
+				_freeCount += count;
+				_capacity += count;
+			}
+
+		private:
+			mutable boost::mutex _lock;
+			std::vector<Slab> _slabs;
+			Block *_freeList;
+			size_t _freeCount;
+			size_t _capacity;
+		};
+
+#define DECLARE_POOLED_ALLOCATION(T) \
+		static void *operator new(size_t size) { \
+			return ObjectPool<T>::Instance().Allocate(size); \
+		} \
+		static void operator delete(void *p, size_t size) { \
+			ObjectPool<T>::Instance().Deallocate(p, size); \
+		}
+
+	}
+}
+
+#endif //__ELASTOS_SDK_OBJECTPOOL_H__
@@ -0,0 +1,159 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <map>
+#include <unistd.h>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/thread.hpp>
+#include <nlohmann/json.hpp>
+
+#include "Trace.h"
+#include "Log.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			struct TraceEvent {
+				const char *Category;
+				const char *Name;
+				TraceArgs Args;
+				uint64_t Start;
+				uint64_t End;
+				int Thread;
+			};
+
+			struct Recorder {
+				Recorder() :
+						Recording(false),
+						MaxEvents(0),
+						Dropped(0),
+						Origin(0) {
+				}
+
+				boost::mutex Lock;
+				bool Recording;
+				size_t MaxEvents;
+				uint64_t Dropped;
+				uint64_t Origin;
+				std::vector<TraceEvent> Events;
+				// chrome wants small integer thread ids
+				std::map<boost::thread::id, int> Threads;
+			};
+
+			Recorder &recorder() {
+				// intentionally leaked, peer threads may still end spans during static destruction
+				static Recorder *r = new Recorder();
+				return *r;
+			}
+
+			void recordCoreSpan(const char *category, const char *name, const char *argName, const char *argValue,
+								uint64_t start, uint64_t end) {
+				TraceArgs args;
+				if (argName != nullptr && argValue != nullptr)
+					args.push_back(std::make_pair(argName, std::string(argValue)));
+				Trace::Record(category, name, args, start, end);
+			}
+
+			std::string quote(const std::string &s) {
+				return nlohmann::json(s).dump();
+			}
+		}
+
+		void Trace::Start(size_t maxEvents) {
+			Recorder &r = recorder();
+			{
+				boost::mutex::scoped_lock lock(r.Lock);
+				r.Recording = true;
+				r.MaxEvents = maxEvents;
+				r.Dropped = 0;
+				r.Origin = BRTraceClock();
+				r.Events.clear();
+				r.Threads.clear();
+			}
+			BRTraceSetHandler(recordCoreSpan);
+		}
+
+		bool Trace::Stop(const boost::filesystem::path &path) {
+			BRTraceSetHandler(nullptr);
+
+			Recorder &r = recorder();
+			std::vector<TraceEvent> events;
+			uint64_t dropped, origin;
+			{
+				boost::mutex::scoped_lock lock(r.Lock);
+				r.Recording = false;
+				events.swap(r.Events);
+				dropped = r.Dropped;
+				origin = r.Origin;
+			}
+
+			boost::filesystem::ofstream out(path, std::ios::out | std::ios::trunc);
+			if (!out) {
+				Log::getLogger()->error("Can not write trace to {}", path.string());
+				return false;
+			}
+
+			int pid = (int) getpid();
+			out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+			out << "{\"ph\":\"M\",\"pid\":" << pid << ",\"name\":\"process_name\",\"args\":{\"name\":\"spvsdk\"}}";
+			for (size_t i = 0; i < events.size(); ++i) {
+				const TraceEvent &e = events[i];
+				out << ",\n{\"ph\":\"X\",\"cat\":" << quote(e.Category) << ",\"name\":" << quote(e.Name)
+					<< ",\"pid\":" << pid << ",\"tid\":" << e.Thread
+					<< ",\"ts\":" << (e.Start > origin ? e.Start - origin : 0)
+					<< ",\"dur\":" << (e.End > e.Start ? e.End - e.Start : 0) << ",\"args\":{";
+				for (size_t j = 0; j < e.Args.size(); ++j)
+					out << (j > 0 ? "," : "") << quote(e.Args[j].first) << ":" << quote(e.Args[j].second);
+				out << "}}";
+			}
+			out << "\n],\"otherData\":{\"droppedEvents\":" << dropped << "}}\n";
+
+			if (!out.flush()) {
+				Log::getLogger()->error("Can not write trace to {}", path.string());
+				return false;
+			}
+			return true;
+		}
+
+		bool Trace::IsRecording() {
+			return BRTraceBegin() != 0;
+		}
+
+		void Trace::Record(const char *category, const char *name, const TraceArgs &args, uint64_t start,
+						   uint64_t end) {
+			Recorder &r = recorder();
+			boost::mutex::scoped_lock lock(r.Lock);
+			if (!r.Recording)
+				return;
+
+			if (r.Events.size() >= r.MaxEvents) {
+				r.Dropped++;
+				return;
+			}
+
+			std::map<boost::thread::id, int>::iterator thread = r.Threads.find(boost::this_thread::get_id());
+			if (thread == r.Threads.end())
+				thread = r.Threads.insert(std::make_pair(boost::this_thread::get_id(), (int) r.Threads.size() + 1)).first;
+
+			TraceEvent event;
+			event.Category = category;
+			event.Name = name;
+			event.Args = args;
+			event.Start = start;
+			event.End = end;
+			event.Thread = thread->second;
+			r.Events.push_back(event);
+		}
+
+		std::string Trace::WalletIdFromDbPath(const boost::filesystem::path &dbPath) {
+			return dbPath.parent_path().filename().string() + "/" + dbPath.stem().string();
+		}
+
+		std::string Trace::PeerName(const BRPeer *peer) {
+			return std::string(BRPeerHost((BRPeer *) peer)) + ":" + std::to_string(peer->port);
+		}
+
+	}
+}
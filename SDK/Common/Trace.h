@@ -0,0 +1,83 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_TRACE_H__
+#define __ELASTOS_SDK_TRACE_H__
+
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+
+#include "BRTrace.h"
+#include "BRPeer.h"
+
+#define TRACE_DEFAULT_MAX_EVENTS 1000000
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		typedef std::vector<std::pair<const char *, std::string> > TraceArgs;
+
+		/**
+		 * Records spans of the sync pipeline in memory and writes them as a Chrome trace (JSON object format), which
+		 * chrome://tracing and the Perfetto UI open offline. While no trace is recorded a span costs one atomic load.
+		 */
+		class Trace {
+		public:
+			// discards any previous recording, spans over maxEvents are counted but not kept
+			static void Start(size_t maxEvents = TRACE_DEFAULT_MAX_EVENTS);
+
+			// stops recording and writes the spans to path, returns false if path can not be written
+			static bool Stop(const boost::filesystem::path &path);
+
+			static bool IsRecording();
+
+			// category and name must be string literals, they are kept by pointer
+			static void Record(const char *category, const char *name, const TraceArgs &args, uint64_t start,
+							   uint64_t end);
+
+			// "master wallet id/chain id" of a sub wallet database path
+			static std::string WalletIdFromDbPath(const boost::filesystem::path &dbPath);
+
+			static std::string PeerName(const BRPeer *peer);
+		};
+
+		class TraceSpan {
+		public:
+			TraceSpan(const char *category, const char *name) :
+					_category(category),
+					_name(name),
+					_start(BRTraceBegin()) {
+			}
+
+			~TraceSpan() {
+				if (_start != 0)
+					Trace::Record(_category, _name, _args, _start, BRTraceClock());
+			}
+
+			bool IsRecording() const {
+				return _start != 0;
+			}
+
+			void SetArg(const char *name, const std::string &value) {
+				if (_start != 0)
+					_args.push_back(std::make_pair(name, value));
+			}
+
+			void SetPeer(const BRPeer *peer) {
+				if (_start != 0)
+					_args.push_back(std::make_pair("peer", Trace::PeerName(peer)));
+			}
+
+		private:
+			const char *_category;
+			const char *_name;
+			uint64_t _start;
+			TraceArgs _args;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_TRACE_H__
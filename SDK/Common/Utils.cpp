@@ -11,28 +11,22 @@
 #include "assert.h"
 #include "Utils.h"
 #include "AES_256_CCM.h"
+#include "KeyDerivation.h"
 #include "BTCBase58.h"
 #include "Base64.h"
 #include "BRAddress.h"
+#include "BRBase58.h"
+#include "BRHex.h"
 #include "Log.h"
 
 namespace Elastos {
 	namespace ElaWallet {
 
 		std::string Utils::UInt256ToString(const UInt256 &u256, bool reverse) {
-			std::stringstream ss;
+			char hex[2 * sizeof(u256.u8) + 1];
 
-			if(!reverse) {
-				for (int i = 0; i < sizeof(u256.u8); ++i) {
-					ss << (char) _hexc(u256.u8[i] >> 4) << (char) _hexc(u256.u8[i]);
-				}
-			} else {
-				for (int i = sizeof(u256.u8) - 1; i >= 0; --i) {
-					ss << (char) _hexc(u256.u8[i] >> 4) << (char) _hexc(u256.u8[i]);
-				}
-			}
-
-			return ss.str();
+			BRHexEncode(hex, sizeof(hex), u256.u8, sizeof(u256.u8), reverse);
+			return std::string(hex, sizeof(hex) - 1);
 		}
 
 		UInt256 Utils::UInt256FromString(const std::string &s, bool reverse) {
@@ -43,27 +37,23 @@ namespace Elastos {
 				return result;
 			}
 
-			if(!reverse) {
-				for (int i = 0; i < sizeof(result.u8); ++i) {
-					result.u8[i] = (_hexu((s)[2 * i]) << 4) | _hexu((s)[2 * i + 1]);
-				}
-			} else {
-				for (int i = sizeof(result.u8) - 1; i >= 0; --i) {
-					result.u8[sizeof(result.u8) - 1 - i] = (_hexu((s)[2 * i]) << 4) | _hexu((s)[2 * i + 1]);
-				}
+			if (!BRHexDecode(result.u8, sizeof(result.u8), s.c_str(), 2 * sizeof(result.u8), reverse)) {
+				Log::getLogger()->error("UInt256 convert from string=\"{}\" error", s);
+				return UINT256_ZERO;
 			}
 
 			return result;
 		}
 
-		std::string Utils::UInt168ToString(const UInt168 &u168) {
-			std::stringstream ss;
+		bool Utils::UInt256EqualsString(const UInt256 &u256, const std::string &s, bool reverse) {
+			return 0 != BRHexEq(s.c_str(), s.length(), u256.u8, sizeof(u256.u8), reverse);
+		}
 
-			for (int i = 0; i < sizeof(u168.u8); ++i) {
-				ss << (char) _hexc(u168.u8[i] >> 4) << (char) _hexc(u168.u8[i]);
-			}
+		std::string Utils::UInt168ToString(const UInt168 &u168) {
+			char hex[2 * sizeof(u168.u8) + 1];
 
-			return ss.str();
+			BRHexEncode(hex, sizeof(hex), u168.u8, sizeof(u168.u8), 0);
+			return std::string(hex, sizeof(hex) - 1);
 		}
 
 		UInt168 Utils::UInt168FromString(const std::string &str) {
@@ -74,21 +64,19 @@ namespace Elastos {
 				return result;
 			}
 
-			for (int i = 0; i < sizeof(result.u8); ++i) {
-				result.u8[i] = (_hexu((str)[2 * i]) << 4) | _hexu((str)[2 * i + 1]);
+			if (!BRHexDecode(result.u8, sizeof(result.u8), str.c_str(), 2 * sizeof(result.u8), 0)) {
+				Log::getLogger()->error("UInt168 convert from string=\"{}\" error", str);
+				return UINT168_ZERO;
 			}
 
 			return result;
 		}
 
 		std::string Utils::UInt128ToString(const UInt128 &u128) {
-			std::stringstream ss;
-
-			for (int i = 0; i < sizeof(u128.u8); ++i) {
-				ss << (char) _hexc(u128.u8[i] >> 4) << (char) _hexc(u128.u8[i]);
-			}
+			char hex[2 * sizeof(u128.u8) + 1];
 
-			return ss.str();
+			BRHexEncode(hex, sizeof(hex), u128.u8, sizeof(u128.u8), 0);
+			return std::string(hex, sizeof(hex) - 1);
 		}
 
 		UInt128 Utils::UInt128FromString(const std::string &str) {
@@ -99,8 +87,9 @@ namespace Elastos {
 				return result;
 			}
 
-			for (int i = 0; i < sizeof(result.u8); ++i) {
-				result.u8[i] = (_hexu((str)[2 * i]) << 4) | _hexu((str)[2 * i + 1]);
+			if (!BRHexDecode(result.u8, sizeof(result.u8), str.c_str(), 2 * sizeof(result.u8), 0)) {
+				Log::getLogger()->error("UInt128 From String error: str=\"{}\" ", str);
+				return UINT128_ZERO;
 			}
 
 			return result;
@@ -112,8 +101,9 @@ namespace Elastos {
 				return;
 			}
 
-			for (int i = 0; i < targetLen; i++) {
-				target[i] = (uint8_t) ((_hexu(source[2 * i]) << 4) | _hexu(source[(2 * i) + 1]));
+			if (!BRHexDecode(target, targetLen, source, sourceLen, 0)) {
+				Log::getLogger()->error("decodeHex error: invalid hex digit in \"{}\"", std::string(source, sourceLen));
+				memset(target, 0, sourceLen / 2);
 			}
 		}
 
@@ -134,11 +124,7 @@ namespace Elastos {
 		void Utils::encodeHex(char *target, size_t targetLen, const uint8_t *source, size_t sourceLen) {
 			assert (targetLen >= 2 * sourceLen + 1);
 
-			for (int i = 0; i < sourceLen; i++) {
-				target[2 * i] = (uint8_t) _hexc (source[i] >> 4);
-				target[2 * i + 1] = (uint8_t) _hexc (source[i]);
-			}
-			target[2 * sourceLen] = '\0';
+			BRHexEncode(target, targetLen, source, sourceLen, 0);
 		}
 
 		std::string Utils::encodeHex(const uint8_t *hex, size_t hexLen) {
@@ -146,9 +132,10 @@ namespace Elastos {
 				return std::string();
 			}
 
-			char buf[hexLen * 2 + 1];
-			encodeHex(buf, hexLen * 2 + 1, hex, hexLen);
-			std::string str(buf);
+			// room for the terminator, cut off after
+			std::string str(2 * hexLen + 1, '\0');
+			BRHexEncode(&str[0], str.size(), hex, hexLen, 0);
+			str.resize(2 * hexLen);
 
 			return str;
 		}
@@ -160,9 +147,10 @@ namespace Elastos {
 		std::string Utils::encodeHexCreate(size_t *targetLen, uint8_t *source, size_t sourceLen) {
 			size_t length = encodeHexLength(sourceLen);
 			if (nullptr != targetLen) *targetLen = length;
-			char target[length];
-			encodeHex(target, length, source, sourceLen);
-			return std::string(target, length - 1);
+			std::string str(length, '\0');
+			BRHexEncode(&str[0], length, source, sourceLen, 0);
+			str.resize(length - 1);
+			return str;
 		}
 
 		UInt128 Utils::generateRandomSeed() {
@@ -173,7 +161,7 @@ namespace Elastos {
 			return result;
 		}
 
-		CMBlock Utils::encrypt(const CMBlock &data, const std::string &password) {
+		CMBlock Utils::encrypt(const CMBlock &data, const std::string &password, const std::string &walletID) {
 			static unsigned char iv[] = {0x9F, 0x62, 0x54, 0x4C, 0x9D, 0x3F, 0xCA, 0xB2, 0xDD, 0x08, 0x33, 0xDF, 0x21,
 										 0xCA, 0x80,
 										 0xCF};
@@ -181,10 +169,10 @@ namespace Elastos {
 			CMBlock _iv, _salt;
 			_iv.SetMemFixed(iv, sizeof(iv));
 			_salt.SetMemFixed(salt, sizeof(salt));
-			return encrypt(data, password, _salt, _iv, true);
+			return encrypt(data, password, _salt, _iv, true, walletID);
 		}
 
-		CMBlock Utils::decrypt(const CMBlock &encryptedData, const std::string &password) {
+		CMBlock Utils::decrypt(const CMBlock &encryptedData, const std::string &password, const std::string &walletID) {
 			static unsigned char iv[] = {0x9F, 0x62, 0x54, 0x4C, 0x9D, 0x3F, 0xCA, 0xB2, 0xDD, 0x08, 0x33, 0xDF, 0x21,
 										 0xCA, 0x80,
 										 0xCF};
@@ -192,15 +180,26 @@ namespace Elastos {
 			CMBlock _iv, _salt;
 			_iv.SetMemFixed(iv, sizeof(iv));
 			_salt.SetMemFixed(salt, sizeof(salt));
-			return decrypt(encryptedData, password, _salt, _iv, true);
+			return decrypt(encryptedData, password, _salt, _iv, true, walletID);
 		}
 
 		CMBlock
-		Utils::encrypt(const CMBlock &data, const std::string &password, CMBlock &salt, CMBlock &iv, bool bAes128) {
+		Utils::encrypt(const CMBlock &data, const std::string &password, CMBlock &salt, CMBlock &iv, bool bAes128,
+					   const std::string &walletID) {
 			CMBlock ret;
-			CMBlock enc = AES_256_CCM::encrypt(data, data.GetSize(),
-											   (unsigned char *) password.c_str(), password.size(), salt,
-											   salt.GetSize(), iv, iv.GetSize(), bAes128);
+			CMBlock key(AES_256_CCM::KeyLength());
+			if (!DerivedKeyCache::Instance().Derive(walletID, KdfParams(), key, key.GetSize(),
+													(const unsigned char *) password.c_str(), password.size(),
+													salt, salt.GetSize()))
+				return ret;
+
+			CMBlock enc = AES_256_CCM::encryptWithKey(data, data.GetSize(), key, key.GetSize(), iv, iv.GetSize(),
+													  bAes128);
+			if (true == enc)
+				DerivedKeyCache::Instance().Store(walletID, KdfParams(), key, key.GetSize(),
+												  (const unsigned char *) password.c_str(), password.size(),
+												  salt, salt.GetSize());
+			mem_clean(key, key.GetSize());
 			if (true == enc) {
 				std::string enc_bs64 = Base64::fromBits(enc, enc.GetSize());
 				ret.Resize(enc_bs64.size() + 1);
@@ -212,36 +211,88 @@ namespace Elastos {
 
 		CMBlock
 		Utils::decrypt(const CMBlock &encryptedData, const std::string &password, CMBlock &salt, CMBlock &iv,
-					   bool bAes128) {
+					   bool bAes128, const std::string &walletID) {
 			CMBlock ret;
 			if (false == encryptedData) {
 				return ret;
 			}
 			std::string enc_str = (const char *) (void *) encryptedData;
 			std::vector<unsigned char> enc = Base64::toBits(enc_str);
-			ret = AES_256_CCM::decrypt(enc.data(), enc.size(), (unsigned char *) password.c_str(), password.size(),
-									   salt, salt.GetSize(), iv, iv.GetSize(), bAes128);
+
+			CMBlock key(AES_256_CCM::KeyLength());
+			if (!DerivedKeyCache::Instance().Derive(walletID, KdfParams(), key, key.GetSize(),
+													(const unsigned char *) password.c_str(), password.size(),
+													salt, salt.GetSize()))
+				return ret;
+
+			ret = AES_256_CCM::decryptWithKey(enc.data(), enc.size(), key, key.GetSize(), iv, iv.GetSize(), bAes128);
+			// CCM authenticates, so only the right password decrypts
+			if (true == ret)
+				DerivedKeyCache::Instance().Store(walletID, KdfParams(), key, key.GetSize(),
+												  (const unsigned char *) password.c_str(), password.size(),
+												  salt, salt.GetSize());
+			mem_clean(key, key.GetSize());
 			return ret;
 		}
 
 		std::string Utils::UInt168ToAddress(const UInt168 &u) {
-			UInt256 hash = UINT256_ZERO;
-			size_t uSize = sizeof(UInt168);
-
-			BRSHA256_2(&hash, u.u8, uSize);
-
-			size_t dataLen = uSize + 4;
-			uint8_t data[sizeof(UInt168) + 4] = {0};
-			memcpy(data, u.u8, uSize);
-			memcpy(data + uSize, hash.u8, 4);
+			BRAddress address = BR_ADDRESS_NONE;
+			if (u.u8[0] != 0) {
+				BRBase58CheckEncode(address.s, sizeof(address.s), u.u8, sizeof(u.u8));
+				return address.s;
+			}
 
-			return BTCBase58::EncodeBase58(data, dataLen);
+			// BRBase58 drops leading zeroes, bitcoin style base58 keeps them as '1's
+			UInt256 hash;
+			uint8_t data[sizeof(UInt168) + 4];
+			BRSHA256_2(&hash, u.u8, sizeof(UInt168));
+			memcpy(data, u.u8, sizeof(UInt168));
+			memcpy(data + sizeof(UInt168), hash.u8, 4);
+			return BTCBase58::EncodeBase58(data, sizeof(data));
 		}
 
 		bool Utils::UInt168FromAddress(UInt168 &u, const std::string &address) {
 			return 0 != BRAddressHash168(&u, address.c_str());
 		}
 
+		std::vector<std::string> Utils::UInt168ToAddresses(const std::vector<UInt168> &programHashes) {
+			std::vector<BRAddress> encoded(programHashes.size(), BR_ADDRESS_NONE);
+			if (!programHashes.empty())
+				BRBase58CheckEncodeBatch(encoded[0].s, sizeof(BRAddress), programHashes[0].u8, sizeof(UInt168),
+										 programHashes.size());
+
+			std::vector<std::string> addresses;
+			addresses.reserve(programHashes.size());
+			for (size_t i = 0; i < programHashes.size(); ++i) {
+				if (programHashes[i].u8[0] == 0)
+					addresses.push_back(UInt168ToAddress(programHashes[i]));
+				else
+					addresses.push_back(encoded[i].s);
+			}
+			return addresses;
+		}
+
+		std::vector<UInt168> Utils::UInt168FromAddresses(const std::vector<std::string> &addresses) {
+			std::vector<const char *> strs(addresses.size());
+			for (size_t i = 0; i < addresses.size(); ++i)
+				strs[i] = addresses[i].c_str();
+
+			std::vector<UInt168> programHashes(addresses.size());
+			std::vector<int> valid(addresses.size());
+			size_t count = 0;
+			if (!addresses.empty())
+				count = BRBase58CheckDecodeBatch(programHashes[0].u8, sizeof(UInt168), valid.data(), strs.data(),
+												 strs.size());
+
+			std::vector<UInt168> result;
+			result.reserve(count);
+			for (size_t i = 0; i < programHashes.size(); ++i) {
+				if (valid[i])
+					result.push_back(programHashes[i]);
+			}
+			return result;
+		}
+
 		uint32_t Utils::getAddressTypeBySignType(const int signType) {
 			if (signType == ELA_STANDARD) {
 				return ELA_STAND_ADDRESS;
@@ -285,12 +336,12 @@ namespace Elastos {
 		}
 
 		CMBlock Utils::decodeHex(const std::string &s) {
-			size_t dataLen = 0;
-			char *str = const_cast<char *>(s.c_str());
-			uint8_t *data = decodeHexCreate(&dataLen, str, strlen(str));
+			size_t sourceLen = strlen(s.c_str());
+			size_t dataLen = decodeHexLength(sourceLen);
 
-			CMBlock ret;
-			ret.SetMem(data, dataLen);
+			CMBlock ret(dataLen);
+			if (dataLen > 0)
+				decodeHex(ret, dataLen, s.c_str(), sourceLen);
 
 			return ret;
 		}
@@ -24,6 +24,9 @@ namespace Elastos {
 
 			static UInt256 UInt256FromString(const std::string &u256, bool reverse = false);
 
+			// UInt256ToString(u256, reverse) == s, either case, without building the string
+			static bool UInt256EqualsString(const UInt256 &u256, const std::string &s, bool reverse = false);
+
 			static std::string UInt168ToString(const UInt168 &u168);
 
 			static UInt168 UInt168FromString(const std::string &str);
@@ -42,18 +45,23 @@ namespace Elastos {
 				return dice();
 			}
 
+			/**
+			 * Encrypt or decrypt with a key derived from \p password. When \p walletID is given, the derived key
+			 * is looked up in the DerivedKeyCache entry of that wallet, and stored to it once it worked.
+			 */
 			static CMBlock
-			encrypt(const CMBlock &data, const std::string &password);
+			encrypt(const CMBlock &data, const std::string &password, const std::string &walletID = "");
 
 			static CMBlock
-			decrypt(const CMBlock &encryptedData, const std::string &password);
+			decrypt(const CMBlock &encryptedData, const std::string &password, const std::string &walletID = "");
 
 			static CMBlock
-			encrypt(const CMBlock &data, const std::string &password, CMBlock &salt, CMBlock &iv, bool bAes128 = false);
+			encrypt(const CMBlock &data, const std::string &password, CMBlock &salt, CMBlock &iv, bool bAes128 = false,
+					const std::string &walletID = "");
 
 			static CMBlock
 			decrypt(const CMBlock &encryptedData, const std::string &password, CMBlock &salt, CMBlock &iv,
-					bool bAes128 = false);
+					bool bAes128 = false, const std::string &walletID = "");
 
 			static std::string encodeHex(const CMBlock &in);
 
@@ -90,6 +98,12 @@ namespace Elastos {
 
 			static bool UInt168FromAddress(UInt168 &u, const std::string &address);
 
+			// UInt168ToAddress() of every program hash, in one pass
+			static std::vector<std::string> UInt168ToAddresses(const std::vector<UInt168> &programHashes);
+
+			// program hashes of the valid addresses, in one pass, invalid ones are skipped
+			static std::vector<UInt168> UInt168FromAddresses(const std::vector<std::string> &addresses);
+
 			static uint32_t getAddressTypeBySignType(const int signType);
 
 			static UInt168 codeToProgramHash(const std::string &redeemScript);
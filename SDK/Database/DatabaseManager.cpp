@@ -3,18 +3,21 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "DatabaseManager.h"
+#include "Trace.h"
 
 namespace Elastos {
 	namespace ElaWallet {
 
 		DatabaseManager::DatabaseManager(const boost::filesystem::path &path) :
 			_path(path),
+			_walletId(Trace::WalletIdFromDbPath(path)),
 			_sqlite(path),
+			_externalAddresses(&_sqlite),
+			_internalAddresses(&_sqlite),
 			_peerDataSource(&_sqlite),
 			_transactionDataStore(&_sqlite),
 			_merkleBlockDataSource(&_sqlite),
-			_externalAddresses(&_sqlite),
-			_internalAddresses(&_sqlite) {
+			_ethereumDataStore(&_sqlite) {
 
 		}
 
@@ -28,63 +31,93 @@ namespace Elastos {
 		}
 
 		bool DatabaseManager::putTransaction(const std::string &iso, const TransactionEntity &tx) {
+			TraceSpan span("db", "DatabaseManager::putTransaction");
+			span.SetArg("wallet", _walletId);
 			return _transactionDataStore.putTransaction(iso, tx);
 		}
 
 		bool DatabaseManager::deleteAllTransactions(const std::string &iso) {
+			TraceSpan span("db", "DatabaseManager::deleteAllTransactions");
+			span.SetArg("wallet", _walletId);
 			return _transactionDataStore.deleteAllTransactions(iso);
 		}
 
 		std::vector<TransactionEntity> DatabaseManager::getAllTransactions(const std::string &iso) const {
+			TraceSpan span("db", "DatabaseManager::getAllTransactions");
+			span.SetArg("wallet", _walletId);
 			return _transactionDataStore.getAllTransactions(iso);
 		}
 
 		bool DatabaseManager::updateTransaction(const std::string &iso, const TransactionEntity &txEntity) {
+			TraceSpan span("db", "DatabaseManager::updateTransaction");
+			span.SetArg("wallet", _walletId);
 			return _transactionDataStore.updateTransaction(iso, txEntity);
 		}
 
 		bool DatabaseManager::deleteTxByHash(const std::string &iso, const std::string &hash) {
+			TraceSpan span("db", "DatabaseManager::deleteTxByHash");
+			span.SetArg("wallet", _walletId);
 			return _transactionDataStore.deleteTxByHash(iso, hash);
 		}
 
 
 		bool DatabaseManager::putPeer(const std::string &iso, const PeerEntity &peerEntity) {
+			TraceSpan span("db", "DatabaseManager::putPeer");
+			span.SetArg("wallet", _walletId);
 			return _peerDataSource.putPeer(iso, peerEntity);
 		}
 
 		bool DatabaseManager::putPeers(const std::string &iso, const std::vector<PeerEntity> &peerEntities) {
+			TraceSpan span("db", "DatabaseManager::putPeers");
+			span.SetArg("wallet", _walletId);
 			return _peerDataSource.putPeers(iso, peerEntities);
 		}
 
 		bool DatabaseManager::deletePeer(const std::string &iso, const PeerEntity &peerEntity) {
+			TraceSpan span("db", "DatabaseManager::deletePeer");
+			span.SetArg("wallet", _walletId);
 			return _peerDataSource.deletePeer(iso, peerEntity);
 		}
 
 		bool DatabaseManager::deleteAllPeers(const std::string &iso) {
+			TraceSpan span("db", "DatabaseManager::deleteAllPeers");
+			span.SetArg("wallet", _walletId);
 			return _peerDataSource.deleteAllPeers(iso);
 		}
 
 		std::vector<PeerEntity> DatabaseManager::getAllPeers(const std::string &iso) const {
+			TraceSpan span("db", "DatabaseManager::getAllPeers");
+			span.SetArg("wallet", _walletId);
 			return _peerDataSource.getAllPeers(iso);
 		}
 
 		bool DatabaseManager::putMerkleBlock(const std::string &iso, const MerkleBlockEntity &blockEntity) {
+			TraceSpan span("db", "DatabaseManager::putMerkleBlock");
+			span.SetArg("wallet", _walletId);
 			return _merkleBlockDataSource.putMerkleBlock(iso, blockEntity);
 		}
 
 		bool DatabaseManager::putMerkleBlocks(const std::string &iso, const std::vector<MerkleBlockEntity> &blockEntities) {
+			TraceSpan span("db", "DatabaseManager::putMerkleBlocks");
+			span.SetArg("wallet", _walletId);
 			return _merkleBlockDataSource.putMerkleBlocks(iso, blockEntities);
 		}
 
 		bool DatabaseManager::deleteMerkleBlock(const std::string &iso, const MerkleBlockEntity &blockEntity) {
+			TraceSpan span("db", "DatabaseManager::deleteMerkleBlock");
+			span.SetArg("wallet", _walletId);
 			return _merkleBlockDataSource.deleteMerkleBlock(iso, blockEntity);
 		}
 
 		bool DatabaseManager::deleteAllBlocks(const std::string &iso) {
+			TraceSpan span("db", "DatabaseManager::deleteAllBlocks");
+			span.SetArg("wallet", _walletId);
 			return _merkleBlockDataSource.deleteAllBlocks(iso);
 		}
 
 		std::vector<MerkleBlockEntity> DatabaseManager::getAllMerkleBlocks(const std::string &iso) const {
+			TraceSpan span("db", "DatabaseManager::getAllMerkleBlocks");
+			span.SetArg("wallet", _walletId);
 			return _merkleBlockDataSource.getAllMerkleBlocks(iso);
 		}
 
@@ -92,45 +125,117 @@ namespace Elastos {
 			return _path;
 		}
 
+		const std::string &DatabaseManager::getWalletId() const {
+			return _walletId;
+		}
+
 		bool DatabaseManager::putInternalAddress(uint32_t startIndex, const std::string &address) {
+			TraceSpan span("db", "DatabaseManager::putInternalAddress");
+			span.SetArg("wallet", _walletId);
 			return _internalAddresses.putAddress(startIndex, address);
 		}
 
 		bool DatabaseManager::putInternalAddresses(uint32_t startIndex, const std::vector<std::string> &addresses) {
+			TraceSpan span("db", "DatabaseManager::putInternalAddresses");
+			span.SetArg("wallet", _walletId);
 			return _internalAddresses.putAddresses(startIndex, addresses);
 		}
 
 		bool DatabaseManager::clearInternalAddresses() {
+			TraceSpan span("db", "DatabaseManager::clearInternalAddresses");
+			span.SetArg("wallet", _walletId);
 			return _internalAddresses.clearAddresses();
 		}
 
 		std::vector<std::string> DatabaseManager::getInternalAddresses(uint32_t startIndex, uint32_t count) {
+			TraceSpan span("db", "DatabaseManager::getInternalAddresses");
+			span.SetArg("wallet", _walletId);
 			return _internalAddresses.getAddresses(startIndex, count);
 		}
 
 		uint32_t DatabaseManager::getInternalAvailableAddresses(uint32_t startIndex) {
+			TraceSpan span("db", "DatabaseManager::getInternalAvailableAddresses");
+			span.SetArg("wallet", _walletId);
 			return _internalAddresses.getAvailableAddresses(startIndex);
 		}
 
 		bool DatabaseManager::putExternalAddress(uint32_t startIndex, const std::string &address) {
+			TraceSpan span("db", "DatabaseManager::putExternalAddress");
+			span.SetArg("wallet", _walletId);
 			return _externalAddresses.putAddress(startIndex, address);
 		}
 
 		bool DatabaseManager::putExternalAddresses(uint32_t startIndex, const std::vector<std::string> &addresses) {
+			TraceSpan span("db", "DatabaseManager::putExternalAddresses");
+			span.SetArg("wallet", _walletId);
 			return _externalAddresses.putAddresses(startIndex, addresses);
 		}
 
 		bool DatabaseManager::clearExternalAddresses() {
+			TraceSpan span("db", "DatabaseManager::clearExternalAddresses");
+			span.SetArg("wallet", _walletId);
 			return _externalAddresses.clearAddresses();
 		}
 
 		std::vector<std::string> DatabaseManager::getExternalAddresses(uint32_t startIndex, uint32_t count) {
+			TraceSpan span("db", "DatabaseManager::getExternalAddresses");
+			span.SetArg("wallet", _walletId);
 			return _externalAddresses.getAddresses(startIndex, count);
 		}
 
 		uint32_t DatabaseManager::getExternalAvailableAddresses(uint32_t startIndex) {
+			TraceSpan span("db", "DatabaseManager::getExternalAvailableAddresses");
+			span.SetArg("wallet", _walletId);
 			return _externalAddresses.getAvailableAddresses(startIndex);
 		}
 
+		bool DatabaseManager::putEthereumTransaction(const std::string &iso, const EthereumTransactionEntity &txEntity) {
+			TraceSpan span("db", "DatabaseManager::putEthereumTransaction");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.putTransaction(iso, txEntity);
+		}
+
+		std::vector<EthereumTransactionEntity> DatabaseManager::getAllEthereumTransactions(const std::string &iso) const {
+			TraceSpan span("db", "DatabaseManager::getAllEthereumTransactions");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.getAllTransactions(iso);
+		}
+
+		bool DatabaseManager::putEthereumBlock(const std::string &iso, const EthereumBlockEntity &blockEntity) {
+			TraceSpan span("db", "DatabaseManager::putEthereumBlock");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.putBlock(iso, blockEntity);
+		}
+
+		std::vector<EthereumBlockEntity> DatabaseManager::getAllEthereumBlocks(const std::string &iso) const {
+			TraceSpan span("db", "DatabaseManager::getAllEthereumBlocks");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.getAllBlocks(iso);
+		}
+
+		uint64_t DatabaseManager::getLastEthereumBlockNumber(const std::string &iso) const {
+			TraceSpan span("db", "DatabaseManager::getLastEthereumBlockNumber");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.getLastBlockNumber(iso);
+		}
+
+		bool DatabaseManager::putEthereumBalance(const std::string &iso, const EthereumBalanceEntity &balanceEntity) {
+			TraceSpan span("db", "DatabaseManager::putEthereumBalance");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.putBalance(iso, balanceEntity);
+		}
+
+		std::vector<EthereumBalanceEntity> DatabaseManager::getAllEthereumBalances(const std::string &iso) const {
+			TraceSpan span("db", "DatabaseManager::getAllEthereumBalances");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.getAllBalances(iso);
+		}
+
+		bool DatabaseManager::deleteAllEthereum(const std::string &iso) {
+			TraceSpan span("db", "DatabaseManager::deleteAllEthereum");
+			span.SetArg("wallet", _walletId);
+			return _ethereumDataStore.deleteAll(iso);
+		}
+
 	}
 }
@@ -10,6 +10,7 @@
 #include "PeerDataSource.h"
 #include "ExternalAddresses.h"
 #include "InternalAddresses.h"
+#include "EthereumDataStore.h"
 #include "Sqlite.h"
 
 namespace Elastos {
@@ -56,16 +57,31 @@ namespace Elastos {
 			std::vector<std::string> getExternalAddresses(uint32_t startIndex, uint32_t count);
 			uint32_t getExternalAvailableAddresses(uint32_t startIndex);
 
+			// Ethereum light node's database interface
+			bool putEthereumTransaction(const std::string &iso, const EthereumTransactionEntity &txEntity);
+			std::vector<EthereumTransactionEntity> getAllEthereumTransactions(const std::string &iso) const;
+			bool putEthereumBlock(const std::string &iso, const EthereumBlockEntity &blockEntity);
+			std::vector<EthereumBlockEntity> getAllEthereumBlocks(const std::string &iso) const;
+			uint64_t getLastEthereumBlockNumber(const std::string &iso) const;
+			bool putEthereumBalance(const std::string &iso, const EthereumBalanceEntity &balanceEntity);
+			std::vector<EthereumBalanceEntity> getAllEthereumBalances(const std::string &iso) const;
+			bool deleteAllEthereum(const std::string &iso);
+
 			const boost::filesystem::path &getPath() const;
 
+			// "master wallet id/chain id", tags the trace spans of this database
+			const std::string &getWalletId() const;
+
 		private:
 			boost::filesystem::path _path;
+			std::string _walletId;
 			Sqlite                	_sqlite;
 			ExternalAddresses		_externalAddresses;
 			InternalAddresses		_internalAddresses;
 			PeerDataSource        	_peerDataSource;
 			TransactionDataStore  	_transactionDataStore;
 			MerkleBlockDataSource 	_merkleBlockDataSource;
+			EthereumDataStore		_ethereumDataStore;
 		};
 
 	}
@@ -0,0 +1,276 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <string.h>
+#include <sstream>
+#include <SDK/Common/Log.h>
+
+#include "EthereumDataStore.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		EthereumDataStore::EthereumDataStore(Sqlite *sqlite) :
+			TableBase(sqlite) {
+			initializeTable(ETH_DATABASE_CREATE);
+		}
+
+		EthereumDataStore::EthereumDataStore(SqliteTransactionType type, Sqlite *sqlite) :
+			TableBase(type, sqlite) {
+			initializeTable(ETH_DATABASE_CREATE);
+		}
+
+		EthereumDataStore::~EthereumDataStore() {
+		}
+
+		bool EthereumDataStore::putTransaction(const std::string &iso, const EthereumTransactionEntity &transactionEntity) {
+			return doTransaction([&iso, &transactionEntity, this]() {
+				std::stringstream ss;
+
+				ss << "INSERT OR REPLACE INTO " << ETH_TX_TABLE_NAME << "(" <<
+				   ETH_TX_COLUMN_ID    << "," <<
+				   ETH_TX_BUFF         << "," <<
+				   ETH_TX_BLOCK_NUMBER << "," <<
+				   ETH_TX_ISO          <<
+				   ") VALUES (?, ?, ?, ?);";
+
+				sqlite3_stmt *stmt;
+				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
+					std::stringstream ess;
+					ess << "prepare sql " << ss.str() << " fail";
+					Log::getLogger(Log::Database)->error(ess.str());
+					throw std::logic_error(ess.str());
+				}
+
+				_sqlite->bindText(stmt, 1, transactionEntity.txHash, nullptr);
+				_sqlite->bindBlob(stmt, 2, transactionEntity.buff, nullptr);
+				_sqlite->bindInt64(stmt, 3, (int64_t)transactionEntity.blockNumber);
+				_sqlite->bindText(stmt, 4, iso, nullptr);
+
+				_sqlite->step(stmt);
+
+				_sqlite->finalize(stmt);
+			});
+		}
+
+		std::vector<EthereumTransactionEntity> EthereumDataStore::getAllTransactions(const std::string &iso) const {
+			std::vector<EthereumTransactionEntity> transactions;
+
+			doTransaction([&iso, &transactions, this]() {
+				std::stringstream ss;
+
+				ss << "SELECT "        <<
+				   ETH_TX_COLUMN_ID    << ", " <<
+				   ETH_TX_BUFF         << ", " <<
+				   ETH_TX_BLOCK_NUMBER <<
+				   " FROM "            << ETH_TX_TABLE_NAME <<
+				   " WHERE "           << ETH_TX_ISO << " = '" << iso << "'" <<
+				   " ORDER BY "        << ETH_TX_BLOCK_NUMBER << ";";
+
+				sqlite3_stmt *stmt;
+				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
+					std::stringstream ess;
+					ess << "prepare sql " << ss.str() << " fail";
+					throw std::logic_error(ess.str());
+				}
+
+				EthereumTransactionEntity tx;
+				while (SQLITE_ROW == _sqlite->step(stmt)) {
+					tx.txHash = _sqlite->columnText(stmt, 0);
+
+					const uint8_t *pdata = (const uint8_t *)_sqlite->columnBlob(stmt, 1);
+					size_t len = (size_t)_sqlite->columnBytes(stmt, 1);
+
+					CMBlock buff;
+					buff.Resize(len);
+					memcpy(buff, pdata, len);
+					tx.buff = buff;
+
+					tx.blockNumber = (uint64_t)_sqlite->columnInt64(stmt, 2);
+
+					transactions.push_back(tx);
+				}
+
+				_sqlite->finalize(stmt);
+			});
+
+			return transactions;
+		}
+
+		bool EthereumDataStore::putBlock(const std::string &iso, const EthereumBlockEntity &blockEntity) {
+			return doTransaction([&iso, &blockEntity, this]() {
+				std::stringstream ss;
+
+				ss << "INSERT OR REPLACE INTO " << ETH_BLOCK_TABLE_NAME << "(" <<
+				   ETH_BLOCK_COLUMN_ID  << "," <<
+				   ETH_BLOCK_NUMBER     << "," <<
+				   ETH_BLOCK_TIME_STAMP << "," <<
+				   ETH_BLOCK_ISO        <<
+				   ") VALUES (?, ?, ?, ?);";
+
+				sqlite3_stmt *stmt;
+				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
+					std::stringstream ess;
+					ess << "prepare sql " << ss.str() << " fail";
+					Log::getLogger(Log::Database)->error(ess.str());
+					throw std::logic_error(ess.str());
+				}
+
+				_sqlite->bindText(stmt, 1, blockEntity.blockHash, nullptr);
+				_sqlite->bindInt64(stmt, 2, (int64_t)blockEntity.blockNumber);
+				_sqlite->bindInt64(stmt, 3, (int64_t)blockEntity.timeStamp);
+				_sqlite->bindText(stmt, 4, iso, nullptr);
+
+				_sqlite->step(stmt);
+
+				_sqlite->finalize(stmt);
+			});
+		}
+
+		std::vector<EthereumBlockEntity> EthereumDataStore::getAllBlocks(const std::string &iso) const {
+			std::vector<EthereumBlockEntity> blocks;
+
+			doTransaction([&iso, &blocks, this]() {
+				std::stringstream ss;
+
+				ss << "SELECT "         <<
+				   ETH_BLOCK_COLUMN_ID  << ", " <<
+				   ETH_BLOCK_NUMBER     << ", " <<
+				   ETH_BLOCK_TIME_STAMP <<
+				   " FROM "             << ETH_BLOCK_TABLE_NAME <<
+				   " WHERE "            << ETH_BLOCK_ISO << " = '" << iso << "'" <<
+				   " ORDER BY "         << ETH_BLOCK_NUMBER << ";";
+
+				sqlite3_stmt *stmt;
+				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
+					std::stringstream ess;
+					ess << "prepare sql " << ss.str() << " fail";
+					throw std::logic_error(ess.str());
+				}
+
+				EthereumBlockEntity block;
+				while (SQLITE_ROW == _sqlite->step(stmt)) {
+					block.blockHash = _sqlite->columnText(stmt, 0);
+					block.blockNumber = (uint64_t)_sqlite->columnInt64(stmt, 1);
+					block.timeStamp = (uint64_t)_sqlite->columnInt64(stmt, 2);
+
+					blocks.push_back(block);
+				}
+
+				_sqlite->finalize(stmt);
+			});
+
+			return blocks;
+		}
+
+		uint64_t EthereumDataStore::getLastBlockNumber(const std::string &iso) const {
+			uint64_t blockNumber = 0;
+
+			doTransaction([&iso, &blockNumber, this]() {
+				std::stringstream ss;
+
+				// MAX() of no rows is NULL, read as 0
+				ss << "SELECT MAX(" << ETH_BLOCK_NUMBER << ")" <<
+				   " FROM "         << ETH_BLOCK_TABLE_NAME <<
+				   " WHERE "        << ETH_BLOCK_ISO << " = '" << iso << "';";
+
+				sqlite3_stmt *stmt;
+				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
+					std::stringstream ess;
+					ess << "prepare sql " << ss.str() << " fail";
+					throw std::logic_error(ess.str());
+				}
+
+				if (SQLITE_ROW == _sqlite->step(stmt)) {
+					blockNumber = (uint64_t)_sqlite->columnInt64(stmt, 0);
+				}
+
+				_sqlite->finalize(stmt);
+			});
+
+			return blockNumber;
+		}
+
+		bool EthereumDataStore::putBalance(const std::string &iso, const EthereumBalanceEntity &balanceEntity) {
+			return doTransaction([&iso, &balanceEntity, this]() {
+				std::stringstream ss;
+
+				ss << "INSERT OR REPLACE INTO " << ETH_BALANCE_TABLE_NAME << "(" <<
+				   ETH_BALANCE_COLUMN_ID << "," <<
+				   ETH_BALANCE           << "," <<
+				   ETH_BALANCE_ISO       <<
+				   ") VALUES (?, ?, ?);";
+
+				sqlite3_stmt *stmt;
+				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
+					std::stringstream ess;
+					ess << "prepare sql " << ss.str() << " fail";
+					Log::getLogger(Log::Database)->error(ess.str());
+					throw std::logic_error(ess.str());
+				}
+
+				_sqlite->bindText(stmt, 1, balanceEntity.token, nullptr);
+				_sqlite->bindText(stmt, 2, balanceEntity.balance, nullptr);
+				_sqlite->bindText(stmt, 3, iso, nullptr);
+
+				_sqlite->step(stmt);
+
+				_sqlite->finalize(stmt);
+			});
+		}
+
+		std::vector<EthereumBalanceEntity> EthereumDataStore::getAllBalances(const std::string &iso) const {
+			std::vector<EthereumBalanceEntity> balances;
+
+			doTransaction([&iso, &balances, this]() {
+				std::stringstream ss;
+
+				ss << "SELECT "          <<
+				   ETH_BALANCE_COLUMN_ID << ", " <<
+				   ETH_BALANCE           <<
+				   " FROM "              << ETH_BALANCE_TABLE_NAME <<
+				   " WHERE "             << ETH_BALANCE_ISO << " = '" << iso << "';";
+
+				sqlite3_stmt *stmt;
+				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
+					std::stringstream ess;
+					ess << "prepare sql " << ss.str() << " fail";
+					throw std::logic_error(ess.str());
+				}
+
+				EthereumBalanceEntity balance;
+				while (SQLITE_ROW == _sqlite->step(stmt)) {
+					balance.token = _sqlite->columnText(stmt, 0);
+					balance.balance = _sqlite->columnText(stmt, 1);
+
+					balances.push_back(balance);
+				}
+
+				_sqlite->finalize(stmt);
+			});
+
+			return balances;
+		}
+
+		bool EthereumDataStore::deleteAll(const std::string &iso) {
+			return doTransaction([&iso, this]() {
+				std::stringstream ss;
+
+				ss << "DELETE FROM " << ETH_TX_TABLE_NAME <<
+				   " WHERE " << ETH_TX_ISO << " = '" << iso << "';" <<
+				   "DELETE FROM " << ETH_BLOCK_TABLE_NAME <<
+				   " WHERE " << ETH_BLOCK_ISO << " = '" << iso << "';" <<
+				   "DELETE FROM " << ETH_BALANCE_TABLE_NAME <<
+				   " WHERE " << ETH_BALANCE_ISO << " = '" << iso << "';";
+
+				if (!_sqlite->exec(ss.str(), nullptr, nullptr)) {
+					std::stringstream ess;
+					ess << "exec sql " << ss.str() << " fail";
+					throw std::logic_error(ess.str());
+				}
+			});
+		}
+
+	}
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_ETHEREUMDATASTORE_H__
+#define __ELASTOS_SDK_ETHEREUMDATASTORE_H__
+
+#include <vector>
+#include "Sqlite.h"
+#include "CMemBlock.h"
+#include "TableBase.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		// A transaction as saved by the Ethereum light node: opaque bytes, keyed by hash
+		struct EthereumTransactionEntity {
+			EthereumTransactionEntity() :
+				blockNumber(0),
+				txHash("")
+			{
+			}
+
+			EthereumTransactionEntity(CMBlock buff, uint64_t blockNumber, const std::string &txHash) :
+				buff(buff),
+				blockNumber(blockNumber),
+				txHash(txHash)
+			{
+			}
+
+			CMBlock buff;
+			uint64_t blockNumber;
+			std::string txHash;
+		};
+
+		struct EthereumBlockEntity {
+			EthereumBlockEntity() :
+				blockNumber(0),
+				timeStamp(0),
+				blockHash("")
+			{
+			}
+
+			EthereumBlockEntity(uint64_t blockNumber, uint64_t timeStamp, const std::string &blockHash) :
+				blockNumber(blockNumber),
+				timeStamp(timeStamp),
+				blockHash(blockHash)
+			{
+			}
+
+			uint64_t blockNumber;
+			uint64_t timeStamp;
+			std::string blockHash;
+		};
+
+		// The balance, as 0x-prefixed hex, of the wallet holding token; an empty token is ETHER
+		struct EthereumBalanceEntity {
+			EthereumBalanceEntity() :
+				token(""),
+				balance("")
+			{
+			}
+
+			EthereumBalanceEntity(const std::string &token, const std::string &balance) :
+				token(token),
+				balance(balance)
+			{
+			}
+
+			std::string token;
+			std::string balance;
+		};
+
+		/*
+		 * The transactions, blocks seen and balances of an Ethereum light node, restored before it
+		 * connects so that it asks the network only for what is newer than getLastBlockNumber().
+		 */
+		class EthereumDataStore : public TableBase {
+		public:
+			EthereumDataStore(Sqlite *sqlite);
+			EthereumDataStore(SqliteTransactionType type, Sqlite *sqlite);
+			~EthereumDataStore();
+
+			// put*() replace an entity already saved with the same hash or token
+			bool putTransaction(const std::string &iso, const EthereumTransactionEntity &transactionEntity);
+			std::vector<EthereumTransactionEntity> getAllTransactions(const std::string &iso) const;
+
+			bool putBlock(const std::string &iso, const EthereumBlockEntity &blockEntity);
+			std::vector<EthereumBlockEntity> getAllBlocks(const std::string &iso) const;
+			uint64_t getLastBlockNumber(const std::string &iso) const;
+
+			bool putBalance(const std::string &iso, const EthereumBalanceEntity &balanceEntity);
+			std::vector<EthereumBalanceEntity> getAllBalances(const std::string &iso) const;
+
+			bool deleteAll(const std::string &iso);
+
+		private:
+			/*
+			 * ethereum transaction table
+			 */
+			const std::string ETH_TX_TABLE_NAME = "ethereumTransactionTable";
+			const std::string ETH_TX_COLUMN_ID = "_id";
+			const std::string ETH_TX_BUFF = "ethereumTransactionBuff";
+			const std::string ETH_TX_BLOCK_NUMBER = "ethereumTransactionBlockNumber";
+			const std::string ETH_TX_ISO = "ethereumTransactionISO";
+
+			/*
+			 * ethereum block table
+			 */
+			const std::string ETH_BLOCK_TABLE_NAME = "ethereumBlockTable";
+			const std::string ETH_BLOCK_COLUMN_ID = "_id";
+			const std::string ETH_BLOCK_NUMBER = "ethereumBlockNumber";
+			const std::string ETH_BLOCK_TIME_STAMP = "ethereumBlockTimeStamp";
+			const std::string ETH_BLOCK_ISO = "ethereumBlockISO";
+
+			/*
+			 * ethereum balance table
+			 */
+			const std::string ETH_BALANCE_TABLE_NAME = "ethereumBalanceTable";
+			const std::string ETH_BALANCE_COLUMN_ID = "_id";
+			const std::string ETH_BALANCE = "ethereumBalance";
+			const std::string ETH_BALANCE_ISO = "ethereumBalanceISO";
+
+			const std::string ETH_DATABASE_CREATE =
+				"create table if not exists " + ETH_TX_TABLE_NAME + " (" +
+				ETH_TX_COLUMN_ID + " text not null, " +
+				ETH_TX_BUFF + " blob, " +
+				ETH_TX_BLOCK_NUMBER + " integer, " +
+				ETH_TX_ISO + " text DEFAULT 'ETH', " +
+				"primary key (" + ETH_TX_ISO + ", " + ETH_TX_COLUMN_ID + "));" +
+				"create table if not exists " + ETH_BLOCK_TABLE_NAME + " (" +
+				ETH_BLOCK_COLUMN_ID + " text not null, " +
+				ETH_BLOCK_NUMBER + " integer, " +
+				ETH_BLOCK_TIME_STAMP + " integer, " +
+				ETH_BLOCK_ISO + " text DEFAULT 'ETH', " +
+				"primary key (" + ETH_BLOCK_ISO + ", " + ETH_BLOCK_COLUMN_ID + "));" +
+				"create table if not exists " + ETH_BALANCE_TABLE_NAME + " (" +
+				ETH_BALANCE_COLUMN_ID + " text not null, " +
+				ETH_BALANCE + " text DEFAULT '', " +
+				ETH_BALANCE_ISO + " text DEFAULT 'ETH', " +
+				"primary key (" + ETH_BALANCE_ISO + ", " + ETH_BALANCE_COLUMN_ID + "));";
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_ETHEREUMDATASTORE_H__
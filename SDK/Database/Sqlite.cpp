@@ -7,10 +7,18 @@
 
 #include "Sqlite.h"
 #include "Log.h"
+#include "Metrics.h"
 
 namespace Elastos {
 	namespace ElaWallet {
 
+		namespace {
+			MetricHistogram &statementLatency(const std::string &op) {
+				return Metrics::Instance().Histogram("spv_db_statement_seconds", "Sqlite statement latency.",
+													 Metrics::LatencyBuckets(), "op=\"" + op + "\"");
+			}
+		}
+
 		Sqlite::Sqlite(const boost::filesystem::path &path) {
 			open(path);
 		}
@@ -27,14 +35,19 @@ namespace Elastos {
 			char *errmsg;
 
 			if (!isValid()) {
-				Log::error("sqlite is invalid");
+				Log::getLogger(Log::Database)->error("sqlite is invalid");
 				return false;
 			}
 
-			int r = sqlite3_exec(_dataBasePtr, sql.c_str(), callBack, arg, &errmsg);
+			static MetricHistogram &latency = statementLatency("exec");
+			int r;
+			{
+				MetricTimer timer(latency);
+				r = sqlite3_exec(_dataBasePtr, sql.c_str(), callBack, arg, &errmsg);
+			}
 			if (r != SQLITE_OK) {
 				if (errmsg) {
-					Log::getLogger()->error("sqlite exec \"{}\" error: {}", sql, errmsg);
+					Log::getLogger(Log::Database)->error("sqlite exec \"{}\" error: {}", sql, errmsg);
 					sqlite3_free(errmsg);
 				}
 				return false;
@@ -55,18 +68,18 @@ namespace Elastos {
 //			std::string typeStr;
 //
 //			if (true != beginTransaction(type)) {
-//				Log::getLogger()->error("sqlite beginTransaction error", typeStr);
+//				Log::getLogger(Log::Database)->error("sqlite beginTransaction error", typeStr);
 //				return false;
 //			}
 //
 //			if (true != exec(sql.c_str(), callBack, arg)) {
-//				Log::getLogger()->error("sqlite exec \"{}\"", sql);
+//				Log::getLogger(Log::Database)->error("sqlite exec \"{}\"", sql);
 //				endTransaction();
 //				return false;
 //			}
 //
 //			if (true != endTransaction()) {
-//				Log::getLogger()->error("sqlite endTransaction error");
+//				Log::getLogger(Log::Database)->error("sqlite endTransaction error");
 //				return false;
 //			}
 //
@@ -77,13 +90,17 @@ namespace Elastos {
 			int r = 0;
 
 			if (!isValid()) {
-				Log::error("sqlite is invalid");
+				Log::getLogger(Log::Database)->error("sqlite is invalid");
 				return false;
 			}
 
-			r = sqlite3_prepare_v2(_dataBasePtr, sql.c_str(), sql.length(), ppStmt, pzTail);
+			static MetricHistogram &latency = statementLatency("prepare");
+			{
+				MetricTimer timer(latency);
+				r = sqlite3_prepare_v2(_dataBasePtr, sql.c_str(), sql.length(), ppStmt, pzTail);
+			}
 			if (r != SQLITE_OK) {
-				Log::error("sqlite prepare error");
+				Log::getLogger(Log::Database)->error("sqlite prepare error");
 				if (ppStmt && *ppStmt) {
 					sqlite3_finalize(*ppStmt);
 				}
@@ -94,6 +111,8 @@ namespace Elastos {
 		}
 
 		int Sqlite::step(sqlite3_stmt *pStmt) {
+			static MetricHistogram &latency = statementLatency("step");
+			MetricTimer timer(latency);
 			return sqlite3_step(pStmt);
 		}
 
@@ -169,9 +188,9 @@ namespace Elastos {
 
 			boost::filesystem::path parentPath = path.parent_path();
 			if (!parentPath.empty() && !boost::filesystem::exists(parentPath)) {
-				SPDLOG_TRACE(Log::getLogger(), "directory \"{}\" do not exist", parentPath.string());
+				SPDLOG_TRACE(Log::getLogger(Log::Database), "directory \"{}\" do not exist", parentPath.string());
 				if (!boost::filesystem::create_directories(parentPath)) {
-					Log::getLogger()->error("create directory \"{}\" error", parentPath.string());
+					Log::getLogger(Log::Database)->error("create directory \"{}\" error", parentPath.string());
 					return false;
 				}
 			}
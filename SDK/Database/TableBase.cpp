@@ -33,11 +33,11 @@ namespace Elastos {
 			}
 			catch (std::exception ex) {
 				result = false;
-				Log::getLogger()->error("Data base error: ", ex.what());
+				Log::getLogger(Log::Database)->error("Data base error: ", ex.what());
 			}
 			catch (...) {
 				result = false;
-				Log::error("Unknown data base error.");
+				Log::getLogger(Log::Database)->error("Unknown data base error.");
 			}
 			_sqlite->endTransaction();
 
@@ -82,7 +82,7 @@ namespace Elastos {
 				if (!_sqlite->prepare(ss.str(), &stmt, nullptr)) {
 					std::stringstream ess;
 					ess << "prepare sql " << ss.str() << " fail";
-					Log::getLogger()->error(ess.str());
+					Log::getLogger(Log::Database)->error(ess.str());
 					throw std::logic_error(ess.str());
 				}
 
@@ -73,6 +73,13 @@ namespace Elastos {
 			return jsonData;
 		}
 
+		void Attribute::writeJson(JsonWriter &writer) const {
+			writer.BeginObject();
+			writer.Key("Data").Hex(_data, _data.GetSize());
+			writer.Key("Usage").UInt(_usage);
+			writer.EndObject();
+		}
+
 		void Attribute::fromJson(const nlohmann::json &jsonData) {
 			_usage = jsonData["Usage"].get<Usage>();
 			_data = Utils::decodeHex(jsonData["Data"].get<std::string>());
@@ -9,6 +9,8 @@
 
 #include "SDK/Plugin/Interface/ELAMessageSerializable.h"
 #include "CMemBlock.h"
+#include "ObjectPool.h"
+#include "JsonWriter.h"
 
 namespace Elastos {
 	namespace ElaWallet {
@@ -34,6 +36,8 @@ namespace Elastos {
 
 			~Attribute();
 
+			DECLARE_POOLED_ALLOCATION(Attribute)
+
 			Usage GetUsage() const;
 
 			const CMBlock &GetData() const;
@@ -46,6 +50,9 @@ namespace Elastos {
 
 			virtual nlohmann::json toJson() const;
 
+			// toJson().dump() written to writer
+			void writeJson(JsonWriter &writer) const;
+
 			virtual void fromJson(const nlohmann::json &jsonData);
 
 		private:
@@ -11,6 +11,7 @@
 #include "BRMerkleBlock.h"
 #include "BRAddress.h"
 #include "Utils.h"
+#include "MerkleTree.h"
 #include "AuxPow.h"
 
 namespace Elastos {
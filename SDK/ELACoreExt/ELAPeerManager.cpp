@@ -43,7 +43,7 @@ namespace Elastos {
 			if (peers) array_add_array(manager->Raw.peers, peers, peersCount);
 			qsort(manager->Raw.peers, array_count(manager->Raw.peers), sizeof(*manager->Raw.peers), _peerTimestampCompare);
 			array_new(manager->Raw.connectedPeers, PEER_MAX_CONNECTIONS);
-			manager->Raw.blocks = BRSetNew(BRMerkleBlockHash, BRMerkleBlockEq, blocksCount);
+			manager->Raw.blocks = BRSetNewUInt256(blocksCount);
 			manager->Raw.orphans = BRSetNew(_BRPrevBlockHash, _BRPrevBlockEq, blocksCount); // orphans are indexed by prevBlock
 			manager->Raw.checkpoints = BRSetNew(_BRBlockHeightHash, _BRBlockHeightEq, 100); // checkpoints are indexed by height
 
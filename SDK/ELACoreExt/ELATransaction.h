@@ -21,6 +21,7 @@
 #include "ELATxOutput.h"
 #include "ELACoreExt/Payload/IPayload.h"
 #include "BRArray.h"
+#include "ObjectPool.h"
 
 namespace Elastos {
 	namespace ElaWallet {
@@ -54,21 +55,14 @@ namespace Elastos {
 				fee = 0;
 				payload = nullptr;
 
-				BRTransaction *txRaw = BRTransactionNew();
-				raw = *txRaw;
-				BRTransactionFree(txRaw);
-
-				raw.inputs = nullptr;
-				raw.outputs = nullptr;
-				raw.inCount = 0;
-				raw.outCount = 0;
-
 				array_new(raw.inputs, 1);
 
 				type = DEFAULT_PAYLOAD_TYPE;
 				payload = DEFAULT_PAYLOAD_NEW();
 			}
 
+			DECLARE_POOLED_ALLOCATION(ELATransaction)
+
 			BRTransaction raw;
 			Type type;
 			uint8_t payloadVersion;
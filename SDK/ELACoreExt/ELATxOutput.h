@@ -7,6 +7,7 @@
 
 #include "BRAddress.h"
 #include "BRTransaction.h"
+#include "ObjectPool.h"
 
 namespace Elastos {
 	namespace ElaWallet {
@@ -39,6 +40,8 @@ namespace Elastos {
 				ELATxOutputSetScript((ELATxOutput *)output, output->raw.script, output->raw.scriptLen, signType);
 			}
 
+			DECLARE_POOLED_ALLOCATION(ELATxOutput)
+
 			BRTxOutput raw;
 			UInt256 assetId;
 			uint32_t outputLock;
@@ -21,5 +21,9 @@ namespace Elastos {
 		bool IPayload::isValid() const {
 			return true;
 		}
+
+		void IPayload::writeJson(JsonWriter &writer) const {
+			writer.Raw(toJson().dump());
+		}
 	}
 }
\ No newline at end of file
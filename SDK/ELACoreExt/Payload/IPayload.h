@@ -9,6 +9,7 @@
 
 #include "SDK/Plugin/Interface/ELAMessageSerializable.h"
 #include "CMemBlock.h"
+#include "JsonWriter.h"
 
 namespace Elastos {
 	namespace ElaWallet {
@@ -21,6 +22,9 @@ namespace Elastos {
 			virtual CMBlock getData() const;
 
 			virtual bool isValid() const;
+
+			// toJson().dump() written to writer, payloads common in wallet listings write it without the document
+			virtual void writeJson(JsonWriter &writer) const;
 		};
 
 		typedef boost::shared_ptr<IPayload> PayloadPtr;
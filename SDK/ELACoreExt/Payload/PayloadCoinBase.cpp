@@ -43,6 +43,12 @@ namespace Elastos {
 			return j;
 		}
 
+		void PayloadCoinBase::writeJson(JsonWriter &writer) const {
+			writer.BeginObject();
+			writer.Key("CoinBaseData").Hex(_coinBaseData, _coinBaseData.GetSize());
+			writer.EndObject();
+		}
+
 		void PayloadCoinBase::fromJson(const nlohmann::json &j) {
 			_coinBaseData = Utils::decodeHex(j["CoinBaseData"].get<std::string>());
 
@@ -28,6 +28,8 @@ namespace Elastos {
 
 			virtual nlohmann::json toJson() const;
 
+			virtual void writeJson(JsonWriter &writer) const;
+
 			virtual void fromJson(const nlohmann::json &jsonData);
 
 		private:
@@ -33,6 +33,10 @@ namespace Elastos {
 			return jsonData;
 		}
 
+		void PayloadTransferAsset::writeJson(JsonWriter &writer) const {
+			writer.Null();
+		}
+
 		void PayloadTransferAsset::fromJson(const nlohmann::json &jsonData) {
 
 		}
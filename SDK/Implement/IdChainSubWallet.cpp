@@ -109,19 +109,14 @@ namespace Elastos {
 		void IdChainSubWallet::onTxAdded(const TransactionPtr &transaction) {
 			if (transaction != nullptr && transaction->getTransactionType() == ELATransaction::RegisterIdentification) {
 				std::string txHash = Utils::UInt256ToString(transaction->getHash());
-				Log::getLogger()->info("Tx callback (onTxAdded): Tx hash={}", txHash);
-
-				std::for_each(_callbacks.begin(), _callbacks.end(),
-							  [transaction](ISubWalletCallback *callback) {
-								  const PayloadRegisterIdentification *payload = static_cast<const PayloadRegisterIdentification *>(
-										  transaction->getPayload());
-								  callback->OnTransactionStatusChanged(
-										  Utils::UInt256ToString(transaction->getHash(), true),
-										  SubWalletCallback::convertToString(
-												  SubWalletCallback::Added),
-										  payload->toJson(), transaction->getBlockHeight());
-							  });
-				Log::getLogger()->info("Tx callback (onTxAdded) finished. Details: txHash={}, confirm count={}.",
+				Log::getLogger(Log::Wallet)->info("Tx callback (onTxAdded): Tx hash={}", txHash);
+
+				const PayloadRegisterIdentification *payload = static_cast<const PayloadRegisterIdentification *>(
+						transaction->getPayload());
+				_eventBus.TransactionStatusChanged(Utils::UInt256ToString(transaction->getHash(), true),
+												   SubWalletCallback::convertToString(SubWalletCallback::Added),
+												   payload->toJson(), transaction->getBlockHeight());
+				Log::getLogger(Log::Wallet)->info("Tx callback (onTxAdded) finished. Details: txHash={}, confirm count={}.",
 									   txHash, 0);
 			} else {
 				SubWallet::onTxAdded(transaction);
@@ -132,18 +127,15 @@ namespace Elastos {
 			TransactionPtr transaction = _walletManager->getWallet()->transactionForHash(
 					Utils::UInt256FromString(hash));
 			if (transaction != nullptr && transaction->getTransactionType() == ELATransaction::RegisterIdentification) {
-				Log::getLogger()->info("Tx callback (onTxUpdated): Tx hash={}", hash);
+				Log::getLogger(Log::Wallet)->info("Tx callback (onTxUpdated): Tx hash={}", hash);
 
 				std::string reversedId(hash.rbegin(), hash.rend());
-				std::for_each(_callbacks.begin(), _callbacks.end(),
-							  [&reversedId, blockHeight, timeStamp, &transaction, this](ISubWalletCallback *callback) {
-
-								  const PayloadRegisterIdentification *payload = static_cast<const PayloadRegisterIdentification *>(
-										  transaction->getPayload());
-								  callback->OnTransactionStatusChanged(reversedId, SubWalletCallback::convertToString(
-										  SubWalletCallback::Updated), payload->toJson(), blockHeight);
-							  });
-				Log::getLogger()->info("Tx callback (onTxUpdated) finished. Details: txHash={}.", hash);
+				const PayloadRegisterIdentification *payload = static_cast<const PayloadRegisterIdentification *>(
+						transaction->getPayload());
+				_eventBus.TransactionStatusChanged(reversedId,
+												   SubWalletCallback::convertToString(SubWalletCallback::Updated),
+												   payload->toJson(), blockHeight);
+				Log::getLogger(Log::Wallet)->info("Tx callback (onTxUpdated) finished. Details: txHash={}.", hash);
 			} else {
 				SubWallet::onTxUpdated(hash, blockHeight, timeStamp);
 			}
@@ -153,18 +145,14 @@ namespace Elastos {
 			TransactionPtr transaction = _walletManager->getWallet()->transactionForHash(
 					Utils::UInt256FromString(hash));
 			if (transaction != nullptr && transaction->getTransactionType() == ELATransaction::RegisterIdentification) {
-				Log::getLogger()->info("Tx callback (onTxDeleted) begin");
+				Log::getLogger(Log::Wallet)->info("Tx callback (onTxDeleted) begin");
 				std::string reversedId(hash.rbegin(), hash.rend());
-				std::for_each(_callbacks.begin(), _callbacks.end(),
-							  [&reversedId, notifyUser, recommendRescan, &transaction, this](
-									  ISubWalletCallback *callback) {
-
-								  const PayloadRegisterIdentification *payload = static_cast<const PayloadRegisterIdentification *>(
-										  transaction->getPayload());
-								  callback->OnTransactionStatusChanged(reversedId, SubWalletCallback::convertToString(
-										  SubWalletCallback::Deleted), payload->toJson(), 0);
-							  });
-				Log::getLogger()->info("Tx callback (onTxDeleted) finished.");
+				const PayloadRegisterIdentification *payload = static_cast<const PayloadRegisterIdentification *>(
+						transaction->getPayload());
+				_eventBus.TransactionStatusChanged(reversedId,
+												   SubWalletCallback::convertToString(SubWalletCallback::Deleted),
+												   payload->toJson(), 0);
+				Log::getLogger(Log::Wallet)->info("Tx callback (onTxDeleted) finished.");
 			} else {
 				SubWallet::onTxDeleted(hash, notifyUser, recommendRescan);
 			}
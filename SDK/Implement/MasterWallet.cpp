@@ -21,6 +21,8 @@
 #include "ParamChecker.h"
 #include "BigIntFormat.h"
 #include "WalletTool.h"
+#include "KeyDerivation.h"
+#include "KeyStore/BIP39WordList.h"
 #include "BTCBase58.h"
 #include "ErrorCode.h"
 #include "Payload/PayloadRegisterIdentification.h"
@@ -89,6 +91,7 @@ namespace Elastos {
 		}
 
 		MasterWallet::~MasterWallet() {
+			DerivedKeyCache::Instance().Clear(_id);
 		}
 
 		std::string MasterWallet::GenerateMnemonic(const std::string &language, const std::string &rootPath) {
@@ -258,17 +261,18 @@ namespace Elastos {
 			ParamChecker::checkPassword(payPassword, "Pay");
 			ParamChecker::checkPasswordWithNullLegal(phrasePassword, "Phrase");
 
-			bool result = initFromPhrase(mnemonic, phrasePassword, payPassword);
+			bool result = initFromPhrase(BIP39WordList::Normalize(mnemonic), phrasePassword, payPassword);
 			CreateSubWallet("ELA", payPassword, false); //we create ela sub wallet by default
 			return result;
 		}
 
-		nlohmann::json MasterWallet::exportKeyStore(const std::string &backupPassword, const std::string &payPassword) {
+		nlohmann::json MasterWallet::exportKeyStore(const std::string &backupPassword, const std::string &payPassword,
+													const KdfParams &kdf) {
 			KeyStore keyStore;
 			restoreKeyStore(keyStore, payPassword);
 
 			nlohmann::json result;
-			if (!keyStore.save(result, backupPassword)) {
+			if (!keyStore.save(result, backupPassword, kdf)) {
 				throw std::logic_error("Export key error.");
 			}
 
@@ -306,16 +310,20 @@ namespace Elastos {
 #ifdef MNEMONIC_SOURCE_H
 			if (!WalletTool::PhraseIsValid(phraseData, language)) {
 				if (!WalletTool::PhraseIsValid(phraseData, "chinese")) {
-					Log::error("Phrase is unvalid.");
+					Log::getLogger(Log::KeyStore)->error("Phrase is unvalid.");
 					return false;
 				} else {
 					_localStore.json().setMnemonicLanguage("chinese");
 				}
 			}
 #else
-			if (!WalletTool::PhraseIsValid(phraseData, _mnemonic->words())) {
-				resetMnemonic("chinese");
-				if (!WalletTool::PhraseIsValid(phraseData, _mnemonic->words())) {
+			if (!_mnemonic->phraseIsValid(phrase)) {
+				std::string language = BIP39WordList::DetectLanguage(phrase);
+				if (language.empty())
+					throw std::logic_error("Import key error.");
+
+				resetMnemonic(language);
+				if (!_mnemonic->phraseIsValid(phrase)) {
 					throw std::logic_error("Import key error.");
 				}
 			}
@@ -369,7 +377,7 @@ namespace Elastos {
 		}
 
 		Key MasterWallet::deriveKey(const std::string &payPassword) {
-			CMBlock keyData = Utils::decrypt(_localStore.GetEncrpytedKey(), payPassword);
+			CMBlock keyData = Utils::decrypt(_localStore.GetEncrpytedKey(), payPassword, _id);
 			ParamChecker::checkDataNotEmpty(keyData);
 
 			Key key;
@@ -415,7 +423,7 @@ namespace Elastos {
 
 		UInt512 MasterWallet::deriveSeed(const std::string &payPassword) {
 			UInt512 result;
-			CMBlock entropyData = Utils::decrypt(_localStore.GetEncryptedMnemonic(), payPassword);
+			CMBlock entropyData = Utils::decrypt(_localStore.GetEncryptedMnemonic(), payPassword, _id);
 			if (entropyData.GetSize() == 0)
 				ErrorCode::StandardLogicError(ErrorCode::PasswordError, "Invalid password.");
 
@@ -426,7 +434,7 @@ namespace Elastos {
 			std::string phrasePassword = _localStore.GetEncrptedPhrasePassword().GetSize() == 0
 										 ? ""
 										 : Utils::convertToString(
-							Utils::decrypt(_localStore.GetEncrptedPhrasePassword(), payPassword));
+							Utils::decrypt(_localStore.GetEncrptedPhrasePassword(), payPassword, _id));
 
 			std::string prikey_base58 = WalletTool::getDeriveKey_base58(mnemonic, phrasePassword);
 			CMBlock prikey = BTCBase58::DecodeBase58(prikey_base58);
@@ -517,6 +525,7 @@ namespace Elastos {
 			ParamChecker::checkPassword(oldPassword, "Old");
 			ParamChecker::checkPassword(newPassword, "New");
 
+			DerivedKeyCache::Instance().Clear(_id);
 			CMBlock key = Utils::decrypt(_localStore.GetEncrpytedKey(), oldPassword);
 			ParamChecker::checkDataNotEmpty(key, false);
 			CMBlock phrasePass = Utils::decrypt(_localStore.GetEncrptedPhrasePassword(), oldPassword);
@@ -143,7 +143,7 @@ namespace Elastos {
 									const std::string &payPassword);
 
 			nlohmann::json exportKeyStore(const std::string &backupPassword,
-								const std::string &payPassword);
+								const std::string &payPassword, const KdfParams &kdf = KdfParams());
 
 			bool exportMnemonic(const std::string &payPassword,
 								std::string &mnemonic);
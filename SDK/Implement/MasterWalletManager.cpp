@@ -2,35 +2,95 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <set>
 #include <boost/function.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
 
 #include "MasterWalletManager.h"
 #include "Log.h"
 #include "MasterWallet.h"
+#include "SubWallet.h"
 #include "ParamChecker.h"
 #include "Config.h"
+#include "KeyDerivation.h"
+#include "BackgroundExecutor.h"
+#include "Metrics.h"
+#include "Trace.h"
+#include "CheckPointBundle.h"
 
 using namespace boost::filesystem;
 
 #define MASTER_WALLET_STORE_FILE "MasterWalletStore.json"
+#define MAX_LOADING_THREADS 64
 
 namespace Elastos {
 	namespace ElaWallet {
 
+		// master wallets found on startup stay as a store path until first use
+		struct MasterWalletManager::LoadingState {
+			LoadingState() :
+					found(0),
+					loaded(0),
+					failed(0),
+					background(0),
+					hostMode(false),
+					maxLoaded(0),
+					evicted(0) {
+			}
+
+			boost::mutex lock;
+			boost::condition_variable walletLoaded;
+			std::map<std::string, path> pending;
+			std::set<std::string> loading;
+			size_t found;
+			size_t loaded;
+			size_t failed;
+			size_t background;
+			boost::scoped_ptr<BackgroundExecutor> executor;
+
+			// host mode: loaded wallets over maxLoaded or idle for idleTimeout go back to pending
+			bool hostMode;
+			size_t maxLoaded;
+			boost::posix_time::time_duration idleTimeout;
+			std::map<std::string, boost::posix_time::ptime> lastUsed;
+			size_t evicted;
+
+			// wallets handed out and not released yet, they are never evicted
+			std::map<std::string, size_t> leases;
+		};
+
+		static bool hasCallbacks(IMasterWallet *masterWallet) {
+			std::vector<ISubWallet *> subWallets = masterWallet->GetAllSubWallets();
+			for (size_t i = 0; i < subWallets.size(); ++i) {
+				SubWallet *subWallet = dynamic_cast<SubWallet *>(subWallets[i]);
+				if (subWallet != nullptr && subWallet->HasCallbacks())
+					return true;
+			}
+			return false;
+		}
+
 		MasterWalletManager::MasterWalletManager(const std::string &rootPath) :
 				_rootPath(rootPath),
-				_p2pEnable(true) {
+				_p2pEnable(true),
+				_keystoreMemoryHard(false),
+				_loading(new LoadingState()) {
 			initMasterWallets();
 		}
 
 		MasterWalletManager::MasterWalletManager(const MasterWalletMap &walletMap, const std::string &rootPath) :
 				_masterWalletMap(walletMap),
 				_rootPath(rootPath),
-				_p2pEnable(true) {
+				_p2pEnable(true),
+				_keystoreMemoryHard(false),
+				_loading(new LoadingState()) {
 		}
 
 		MasterWalletManager::~MasterWalletManager() {
+			// queued loads are dropped, loads already running are waited for
+			_loading->executor.reset();
+
 			std::vector<std::string> masterWalletIds;
 			std::for_each(_masterWalletMap.begin(), _masterWalletMap.end(),
 						  [&masterWalletIds](const MasterWalletMap::value_type &item) {
@@ -39,10 +99,18 @@ namespace Elastos {
 			std::for_each(masterWalletIds.begin(), masterWalletIds.end(), [this](const std::string &id) {
 				this->removeWallet(id);
 			});
+
+			delete _loading;
 		}
 
 		void MasterWalletManager::SaveConfigs() {
-			std::for_each(_masterWalletMap.begin(), _masterWalletMap.end(),
+			MasterWalletMap masterWallets;
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				masterWallets = _masterWalletMap;
+			}
+
+			std::for_each(masterWallets.begin(), masterWallets.end(),
 						  [](const MasterWalletMap::value_type &item) {
 							  MasterWallet *masterWallet = static_cast<MasterWallet *>(item.second);
 							  masterWallet->Save();
@@ -61,31 +129,159 @@ namespace Elastos {
 				const std::string &language) {
 
 			ParamChecker::checkNotEmpty(masterWalletId);
-			if (_masterWalletMap.find(masterWalletId) != _masterWalletMap.end())
-				return _masterWalletMap[masterWalletId];
+			IMasterWallet *existing = findWallet(masterWalletId, true);
+			if (existing != nullptr)
+				return existing;
 
 			MasterWallet *masterWallet = new MasterWallet(masterWalletId, mnemonic, phrasePassword, payPassword,
 														  language, _p2pEnable, _rootPath);
-			_masterWalletMap[masterWalletId] = masterWallet;
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				_masterWalletMap[masterWalletId] = masterWallet;
+				_loading->lastUsed[masterWalletId] = boost::posix_time::second_clock::universal_time();
+				_loading->leases[masterWalletId]++;
+			}
+			evictWallets(masterWalletId);
 
 			return masterWallet;
 		}
 
 		std::vector<IMasterWallet *> MasterWalletManager::GetAllMasterWallets() const {
+			bool hostMode;
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				hostMode = _loading->hostMode;
+			}
+
+			// loading them all would evict most of them again
+			if (!hostMode) {
+				std::vector<std::string> masterWalletIds = GetAllMasterWalletIds();
+				for (size_t i = 0; i < masterWalletIds.size(); ++i) {
+					findWallet(masterWalletIds[i]);
+				}
+			}
+
+			boost::mutex::scoped_lock lock(_loading->lock);
 			std::vector<IMasterWallet *> result;
 			for (MasterWalletMap::const_iterator it = _masterWalletMap.cbegin(); it != _masterWalletMap.cend(); ++it) {
 				result.push_back(it->second);
+				_loading->leases[it->first]++;
 			}
 			return result;
 		};
 
-		void MasterWalletManager::removeWallet(const std::string &masterWalletId, bool saveMaster) {
+		std::vector<std::string> MasterWalletManager::GetAllMasterWalletIds() const {
+			boost::mutex::scoped_lock lock(_loading->lock);
+			std::set<std::string> ids(_loading->loading);
+			for (MasterWalletMap::const_iterator it = _masterWalletMap.cbegin(); it != _masterWalletMap.cend(); ++it) {
+				ids.insert(it->first);
+			}
+			for (std::map<std::string, path>::const_iterator it = _loading->pending.cbegin();
+				 it != _loading->pending.cend(); ++it) {
+				ids.insert(it->first);
+			}
+			return std::vector<std::string>(ids.begin(), ids.end());
+		}
+
+		IMasterWallet *MasterWalletManager::GetWallet(const std::string &masterWalletId) const {
 			ParamChecker::checkNotEmpty(masterWalletId);
+			return findWallet(masterWalletId, true);
+		}
 
-			if (_masterWalletMap.find(masterWalletId) == _masterWalletMap.end())
+		void MasterWalletManager::ReleaseWallet(const std::string &masterWalletId) const {
+			boost::mutex::scoped_lock lock(_loading->lock);
+			std::map<std::string, size_t>::iterator it = _loading->leases.find(masterWalletId);
+			if (it != _loading->leases.end() && --it->second == 0)
+				_loading->leases.erase(it);
+		}
+
+		void MasterWalletManager::LoadAllMasterWallets(uint32_t threadCount) {
+			if (threadCount == 0)
+				threadCount = std::max(boost::thread::hardware_concurrency(), 1u);
+			threadCount = std::min(threadCount, (uint32_t) MAX_LOADING_THREADS);
+
+			boost::mutex::scoped_lock lock(_loading->lock);
+			if (_loading->pending.empty())
+				return;
+
+			if (_loading->executor == nullptr) {
+				threadCount = std::min(threadCount, (uint32_t) _loading->pending.size());
+				Log::getLogger()->info("Loading {} master wallets with {} threads.", _loading->pending.size(),
+									   threadCount);
+				_loading->executor.reset(new BackgroundExecutor((uint8_t) threadCount));
+			}
+
+			size_t room = _loading->pending.size();
+			if (_loading->hostMode && _loading->maxLoaded > 0)
+				room = _loading->maxLoaded > _masterWalletMap.size() ? _loading->maxLoaded - _masterWalletMap.size() : 0;
+
+			for (std::map<std::string, path>::const_iterator it = _loading->pending.cbegin();
+				 it != _loading->pending.cend() && room > 0; ++it, --room) {
+				_loading->background++;
+				_loading->executor->execute(
+						Runnable(boost::bind(&MasterWalletManager::loadInBackground, this, it->first)));
+			}
+		}
+
+		nlohmann::json MasterWalletManager::GetLoadingProgress() const {
+			boost::mutex::scoped_lock lock(_loading->lock);
+			nlohmann::json j;
+			j["Total"] = _loading->found;
+			j["Loaded"] = _loading->loaded;
+			j["Failed"] = _loading->failed;
+			j["Pending"] = _loading->pending.size() + _loading->loading.size();
+			j["Loading"] = _loading->background > 0;
+			return j;
+		}
+
+		std::string MasterWalletManager::GetMetrics() const {
+			return Metrics::Instance().RenderPrometheus();
+		}
+
+		void MasterWalletManager::DumpMetrics(const std::string &path) const {
+			ParamChecker::checkNotEmpty(path);
+			if (!Metrics::Instance().DumpToFile(path))
+				throw std::logic_error("Write metrics to " + path + " failed.");
+		}
+
+		void MasterWalletManager::SetLogLevel(const std::string &subsystem, const std::string &level) {
+			spdlog::level::level_enum lvl = spdlog::level::from_str(level);
+			if (lvl == spdlog::level::off && level != "off")
+				throw std::invalid_argument("Unknown log level " + level + ".");
+
+			if (subsystem.empty()) {
+				Log::setLevel(lvl);
 				return;
+			}
+
+			Log::Subsystem s;
+			if (!Log::findSubsystem(subsystem, s))
+				throw std::invalid_argument("Unknown log subsystem " + subsystem + ".");
+			Log::setLevel(s, lvl);
+		}
+
+		void MasterWalletManager::EnableFileLogging(uint32_t maxFileSize, uint32_t maxFiles) {
+			boost::filesystem::path path = _rootPath;
+			path /= "spvsdk.log";
+			Log::enableFileLogging(path.string(), maxFileSize, maxFiles);
+		}
+
+		void MasterWalletManager::StartTracing(uint32_t maxEvents) {
+			Trace::Start(maxEvents);
+		}
+
+		void MasterWalletManager::StopTracing(const std::string &path) {
+			ParamChecker::checkNotEmpty(path);
+			if (!Trace::Stop(path))
+				throw std::logic_error("Can not write trace to " + path);
+		}
 
-			IMasterWallet *masterWallet = _masterWalletMap[masterWalletId];
+		void MasterWalletManager::removeWallet(const std::string &masterWalletId, bool saveMaster) {
+			ParamChecker::checkNotEmpty(masterWalletId);
+
+			IMasterWallet *masterWallet = findWallet(masterWalletId);
+			if (masterWallet == nullptr)
+				return;
 
 			MasterWallet *masterWalletInner = static_cast<MasterWallet *>(masterWallet);
 			if (saveMaster) {
@@ -109,7 +305,12 @@ namespace Elastos {
 
 			SPDLOG_DEBUG(Log::getLogger(),"[MasterWalletManager::removeWallet] Removing master wallet from map ({}).",
 								   masterWalletId);
-			_masterWalletMap.erase(masterWalletId);
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				_masterWalletMap.erase(masterWalletId);
+				_loading->lastUsed.erase(masterWalletId);
+				_loading->leases.erase(masterWalletId);
+			}
 
 			SPDLOG_DEBUG(Log::getLogger(),"[MasterWalletManager::removeWallet] Deleting master wallet ({}).", masterWalletId);
 			delete masterWallet;
@@ -129,13 +330,20 @@ namespace Elastos {
 			ParamChecker::checkPassword(payPassword, "Pay");
 			ParamChecker::checkNotEmpty(masterWalletId);
 
-			if (_masterWalletMap.find(masterWalletId) != _masterWalletMap.end())
-				return _masterWalletMap[masterWalletId];
+			IMasterWallet *existing = findWallet(masterWalletId, true);
+			if (existing != nullptr)
+				return existing;
 
 
 			MasterWallet *masterWallet = new MasterWallet(masterWalletId, keystoreContent, backupPassword,
 														  payPassword, phrasePassword, _rootPath, _p2pEnable);
-			_masterWalletMap[masterWalletId] = masterWallet;
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				_masterWalletMap[masterWalletId] = masterWallet;
+				_loading->lastUsed[masterWalletId] = boost::posix_time::second_clock::universal_time();
+				_loading->leases[masterWalletId]++;
+			}
+			evictWallets(masterWalletId);
 			return masterWallet;
 		}
 
@@ -146,12 +354,19 @@ namespace Elastos {
 			ParamChecker::checkPasswordWithNullLegal(phrasePassword, "Phrase");
 			ParamChecker::checkPassword(payPassword, "Pay");
 			ParamChecker::checkNotEmpty(masterWalletId);
-			if (_masterWalletMap.find(masterWalletId) != _masterWalletMap.end())
-				return _masterWalletMap[masterWalletId];
+			IMasterWallet *existing = findWallet(masterWalletId, true);
+			if (existing != nullptr)
+				return existing;
 
 			MasterWallet *masterWallet = new MasterWallet(masterWalletId, mnemonic, phrasePassword, payPassword,
 														  language, _p2pEnable, _rootPath);
-			_masterWalletMap[masterWalletId] = masterWallet;
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				_masterWalletMap[masterWalletId] = masterWallet;
+				_loading->lastUsed[masterWalletId] = boost::posix_time::second_clock::universal_time();
+				_loading->leases[masterWalletId]++;
+			}
+			evictWallets(masterWalletId);
 			return masterWallet;
 		}
 
@@ -163,7 +378,8 @@ namespace Elastos {
 			ParamChecker::checkPassword(payPassword, "Pay");
 
 			MasterWallet *wallet = static_cast<MasterWallet *>(masterWallet);
-			return wallet->exportKeyStore(backupPassword, payPassword);
+			return wallet->exportKeyStore(backupPassword, payPassword,
+										  _keystoreMemoryHard ? KdfParams::MemoryHard() : KdfParams());
 		}
 
 		std::string
@@ -198,12 +414,221 @@ namespace Elastos {
 				std::string masterWalletId = temp.filename().string();
 				temp /= MASTER_WALLET_STORE_FILE;
 				if (exists(temp)) {
-					MasterWallet *masterWallet = new MasterWallet(temp, _rootPath, _p2pEnable);
-					_masterWalletMap[masterWalletId] = masterWallet;
+					_loading->pending[masterWalletId] = temp;
+					_loading->found++;
 				}
 				++it;
 			}
 		}
 
+		IMasterWallet *MasterWalletManager::findWallet(const std::string &masterWalletId, bool lease) const {
+			boost::mutex::scoped_lock lock(_loading->lock);
+			while (_loading->loading.find(masterWalletId) != _loading->loading.end())
+				_loading->walletLoaded.wait(lock);
+
+			// the lease is taken under the lock, so the wallet can not be evicted before it is returned
+			MasterWalletMap::const_iterator it = _masterWalletMap.find(masterWalletId);
+			if (it != _masterWalletMap.end()) {
+				_loading->lastUsed[masterWalletId] = boost::posix_time::second_clock::universal_time();
+				if (lease)
+					_loading->leases[masterWalletId]++;
+				return it->second;
+			}
+
+			std::map<std::string, path>::iterator pending = _loading->pending.find(masterWalletId);
+			if (pending == _loading->pending.end())
+				return nullptr;
+
+			path localStore = pending->second;
+			_loading->pending.erase(pending);
+			_loading->loading.insert(masterWalletId);
+			lock.unlock();
+
+			MasterWallet *masterWallet = nullptr;
+			try {
+				masterWallet = new MasterWallet(localStore, _rootPath, _p2pEnable);
+			} catch (const std::exception &e) {
+				Log::getLogger()->error("Load master wallet {} failed: {}", masterWalletId, e.what());
+			}
+
+			lock.lock();
+			_loading->loading.erase(masterWalletId);
+			if (masterWallet != nullptr) {
+				_masterWalletMap[masterWalletId] = masterWallet;
+				_loading->lastUsed[masterWalletId] = boost::posix_time::second_clock::universal_time();
+				if (lease)
+					_loading->leases[masterWalletId]++;
+				_loading->loaded++;
+			} else {
+				_loading->failed++;
+			}
+			_loading->walletLoaded.notify_all();
+			lock.unlock();
+
+			if (masterWallet != nullptr)
+				evictWallets(masterWalletId);
+			return masterWallet;
+		}
+
+		void MasterWalletManager::loadInBackground(const std::string &masterWalletId) {
+			findWallet(masterWalletId);
+
+			boost::mutex::scoped_lock lock(_loading->lock);
+			_loading->background--;
+		}
+
+		void MasterWalletManager::EnableHostMode(uint32_t maxLoadedWallets, uint32_t idleSeconds) {
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				_loading->hostMode = true;
+				_loading->maxLoaded = maxLoadedWallets;
+				_loading->idleTimeout = boost::posix_time::seconds(idleSeconds);
+			}
+			evictWallets("");
+		}
+
+		uint32_t MasterWalletManager::EvictIdleWallets() {
+			return evictWallets("");
+		}
+
+		nlohmann::json MasterWalletManager::GetHostUsage() const {
+			boost::posix_time::ptime now = boost::posix_time::second_clock::universal_time();
+
+			// the lock keeps the wallets from being evicted while they are measured
+			boost::mutex::scoped_lock lock(_loading->lock);
+			nlohmann::json wallets = nlohmann::json::array();
+			for (MasterWalletMap::const_iterator it = _masterWalletMap.cbegin(); it != _masterWalletMap.cend(); ++it) {
+				std::vector<ISubWallet *> subWallets = it->second->GetAllSubWallets();
+				size_t memory = 0;
+				bool hasCallbacks = false;
+				ExecutorMetrics listener;
+				for (size_t i = 0; i < subWallets.size(); ++i) {
+					SubWallet *subWallet = dynamic_cast<SubWallet *>(subWallets[i]);
+					if (subWallet == nullptr)
+						continue;
+					hasCallbacks = hasCallbacks || subWallet->HasCallbacks();
+					const SubWallet::WalletManagerPtr &walletManager = subWallet->GetWalletManager();
+					memory += walletManager->getWallet()->getMemoryUsage();
+					ExecutorMetrics metrics = walletManager->getListenerQueueMetrics();
+					listener.QueueDepth += metrics.QueueDepth;
+					listener.TotalRunUs += metrics.TotalRunUs;
+				}
+
+				std::map<std::string, boost::posix_time::ptime>::const_iterator used = _loading->lastUsed.find(it->first);
+				nlohmann::json j;
+				j["MasterWalletID"] = it->first;
+				j["IdleSeconds"] = used != _loading->lastUsed.cend() ? (now - used->second).total_seconds() : 0;
+				j["Leases"] = _loading->leases.count(it->first) ? _loading->leases[it->first] : 0;
+				j["HasCallbacks"] = hasCallbacks;
+				j["SubWallets"] = subWallets.size();
+				j["MemoryBytes"] = memory;
+				j["ListenerBusyMs"] = listener.TotalRunUs / 1000;
+				j["ListenerQueueDepth"] = listener.QueueDepth;
+				wallets.push_back(j);
+			}
+
+			nlohmann::json j;
+			j["Loaded"] = _masterWalletMap.size();
+			j["Evicted"] = _loading->evicted;
+			j["Wallets"] = wallets;
+			return j;
+		}
+
+		void MasterWalletManager::LoadCheckPointBundle(const std::string &path, const std::string &publicKey) {
+			ParamChecker::checkNotEmpty(path);
+			ParamChecker::checkNotEmpty(publicKey);
+
+			CheckPointBundle bundle = CheckPointBundle::Read(path, publicKey);
+			CheckPointBundle::Register(bundle);
+			Log::getLogger()->info("Loaded {} checkpoints up to height {} for network {}",
+								   bundle.GetCheckPoints().size(),
+								   bundle.GetCheckPoints().empty() ? 0 : bundle.GetCheckPoints().back().height,
+								   bundle.GetMagicNumber());
+		}
+
+		uint32_t MasterWalletManager::evictWallets(const std::string &keepId) const {
+			typedef std::pair<boost::posix_time::ptime, std::string> LastUse;
+			boost::posix_time::ptime now = boost::posix_time::second_clock::universal_time();
+			std::vector<std::pair<std::string, IMasterWallet *> > victims;
+
+			{
+				boost::mutex::scoped_lock lock(_loading->lock);
+				if (!_loading->hostMode)
+					return 0;
+
+				std::vector<LastUse> loaded;
+				for (MasterWalletMap::const_iterator it = _masterWalletMap.cbegin(); it != _masterWalletMap.cend(); ++it) {
+					if (it->first == keepId)
+						continue;
+					std::map<std::string, boost::posix_time::ptime>::iterator used =
+						_loading->lastUsed.insert(std::make_pair(it->first, now)).first;
+					loaded.push_back(LastUse(used->second, it->first));
+				}
+				std::sort(loaded.begin(), loaded.end());
+
+				size_t excess = 0;
+				if (_loading->maxLoaded > 0 && _masterWalletMap.size() > _loading->maxLoaded)
+					excess = _masterWalletMap.size() - _loading->maxLoaded;
+
+				for (size_t i = 0; i < loaded.size(); ++i) {
+					bool idle = _loading->idleTimeout.total_seconds() > 0 &&
+								now - loaded[i].first >= _loading->idleTimeout;
+					if (excess == 0 && !idle)
+						break;
+
+					// a leased wallet is in use by the host, and the callbacks of a wallet would be lost with it
+					if (_loading->leases.find(loaded[i].second) != _loading->leases.end() ||
+						hasCallbacks(_masterWalletMap[loaded[i].second]))
+						continue;
+					if (excess > 0)
+						excess--;
+
+					// lookups wait for the wallet while it is evicted, as they do while it is loaded
+					victims.push_back(std::make_pair(loaded[i].second, _masterWalletMap[loaded[i].second]));
+					_masterWalletMap.erase(loaded[i].second);
+					_loading->lastUsed.erase(loaded[i].second);
+					_loading->loading.insert(loaded[i].second);
+				}
+			}
+
+			for (size_t i = 0; i < victims.size(); ++i) {
+				const std::string &masterWalletId = victims[i].first;
+				MasterWallet *masterWallet = static_cast<MasterWallet *>(victims[i].second);
+				Log::getLogger()->info("Evict master wallet {}.", masterWalletId);
+
+				try {
+					masterWallet->Save();
+					std::vector<ISubWallet *> subWallets = masterWallet->GetAllSubWallets();
+					for (size_t j = 0; j < subWallets.size(); ++j) {
+						masterWallet->DestroyWallet(subWallets[j]);
+					}
+				} catch (const std::exception &e) {
+					Log::getLogger()->error("Evict master wallet {} failed: {}", masterWalletId, e.what());
+				}
+				delete masterWallet;
+
+				path localStore = _rootPath;
+				localStore /= masterWalletId;
+				localStore /= MASTER_WALLET_STORE_FILE;
+
+				boost::mutex::scoped_lock lock(_loading->lock);
+				_loading->loading.erase(masterWalletId);
+				if (exists(localStore))
+					_loading->pending[masterWalletId] = localStore;
+				_loading->evicted++;
+				_loading->walletLoaded.notify_all();
+			}
+
+			return (uint32_t) victims.size();
+		}
+
+		void MasterWalletManager::SetPayPasswordCacheTimeout(uint32_t seconds) {
+			DerivedKeyCache::Instance().SetTimeout(seconds);
+		}
+
+		void MasterWalletManager::SetKeystoreMemoryHardKdf(bool enable) {
+			_keystoreMemoryHard = enable;
+		}
+
 	}
 }
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "Transaction/TransactionChecker.h"
 #include "Transaction/TransactionCompleter.h"
 #include "TimeUtils.h"
+#include "JsonWriter.h"
 
 namespace fs = boost::filesystem;
 
@@ -79,9 +80,12 @@ namespace Elastos {
 				masterPubKey.reset(new MasterPubKey(pubKey, Utils::UInt256FromString(_info.getChainCode())));
 			}
 
+			ChainParams params(chainParams);
+			params.extendCheckPoints();
+
 			_walletManager = WalletManagerPtr(
 					new WalletManager(masterPubKey, subWalletDbPath, _info.getEarliestPeerTime(),
-									  _info.getSingleAddress(), _info.getForkId(), pluginTypes, chainParams));
+									  _info.getSingleAddress(), _info.getForkId(), pluginTypes, params));
 
 			_walletManager->registerWalletListener(this);
 			_walletManager->registerPeerManagerListener(this);
@@ -107,8 +111,12 @@ namespace Elastos {
 			return _walletManager->getWallet()->GetBalanceInfo();
 		}
 
+		std::string SubWallet::GetBalanceInfoString() {
+			return _walletManager->getWallet()->GetBalanceInfoString();
+		}
+
 		uint64_t SubWallet::GetBalance() {
-			Log::getLogger()->info("chain = {}, balance = {}", _info.getChainId(),
+			Log::getLogger(Log::Wallet)->info("chain = {}, balance = {}", _info.getChainId(),
 								   _walletManager->getWallet()->getBalance());
 			return _walletManager->getWallet()->getBalance();
 		}
@@ -117,28 +125,56 @@ namespace Elastos {
 			return _walletManager->getWallet()->getReceiveAddress();
 		}
 
+		std::vector<std::string> SubWallet::addressPage(uint32_t start, uint32_t count) {
+			std::vector<std::string> addresses = _walletManager->getWallet()->getAllAddresses();
+			if (start >= addresses.size())
+				return std::vector<std::string>();
+
+			size_t end = start + std::min((size_t) count, addresses.size() - start);
+			return std::vector<std::string>(addresses.begin() + start, addresses.begin() + end);
+		}
+
 		nlohmann::json SubWallet::GetAllAddress(uint32_t start,
 												uint32_t count) {
-			std::vector<std::string> addresses = _walletManager->getWallet()->getAllAddresses();
-			uint32_t end = std::min(start + count, (uint32_t) addresses.size());
-			std::vector<std::string> results(addresses.begin() + start, addresses.begin() + end);
+			std::vector<std::string> addresses = addressPage(start, count);
 			nlohmann::json j;
 			j["Addresses"] = addresses;
 			return j;
 		}
 
+		std::string SubWallet::GetAllAddressString(uint32_t start,
+												   uint32_t count) {
+			std::vector<std::string> addresses = addressPage(start, count);
+
+			std::string result;
+			result.reserve(16 + addresses.size() * 37);
+			JsonWriter writer(result);
+			writer.BeginObject().Key("Addresses").BeginArray();
+			for (size_t i = 0; i < addresses.size(); ++i)
+				writer.String(addresses[i]);
+			writer.EndArray().EndObject();
+			return result;
+		}
+
 		uint64_t SubWallet::GetBalanceWithAddress(const std::string &address) {
 			return _walletManager->getWallet()->GetBalanceWithAddress(address);
 		}
 
 		void SubWallet::AddCallback(ISubWalletCallback *subCallback) {
-			if (std::find(_callbacks.begin(), _callbacks.end(), subCallback) != _callbacks.end())
-				return;
-			_callbacks.push_back(subCallback);
+			_eventBus.Subscribe(subCallback);
+		}
+
+		void SubWallet::AddBatchedCallback(ISubWalletCallback *subCallback, uint32_t batchWindowMs,
+										   uint32_t progressIntervalMs) {
+			_eventBus.Subscribe(subCallback, batchWindowMs, progressIntervalMs);
 		}
 
 		void SubWallet::RemoveCallback(ISubWalletCallback *subCallback) {
-			_callbacks.erase(std::remove(_callbacks.begin(), _callbacks.end(), subCallback), _callbacks.end());
+			_eventBus.Unsubscribe(subCallback);
+		}
+
+		bool SubWallet::HasCallbacks() const {
+			return _eventBus.HasSubscribers();
 		}
 
 		nlohmann::json SubWallet::CreateTransaction(const std::string &fromAddress, const std::string &toAddress,
@@ -152,30 +188,37 @@ namespace Elastos {
 			return transaction->toJson();
 		}
 
-		nlohmann::json SubWallet::GetAllTransaction(uint32_t start, uint32_t count, const std::string &addressOrTxid) {
+		std::vector<BRTransaction *> SubWallet::transactionPage(uint32_t start, uint32_t count,
+																const std::string &addressOrTxid) {
 			BRWallet *wallet = _walletManager->getWallet()->getRaw();
 			assert(wallet != nullptr);
 
-			Log::getLogger()->info("GetAllTransaction: start = {}, count = {}, addressOrTxid = {}", start, count,
-								   addressOrTxid);
-
 			size_t fullTxCount = array_count(wallet->transactions);
 			size_t pageCount = count;
 			pthread_mutex_lock(&wallet->lock);
 			if (fullTxCount < start + count)
 				pageCount = fullTxCount - start;
 
-			BRTransaction *transactions[pageCount];
-			uint32_t realCount = 0;
-			for (int i = fullTxCount - 1 - start; i >= 0 && realCount < pageCount; --i) {
+			std::vector<BRTransaction *> transactions;
+			transactions.reserve(pageCount);
+			for (int i = fullTxCount - 1 - start; i >= 0 && transactions.size() < pageCount; --i) {
 				if (!filterByAddressOrTxId(wallet->transactions[i], addressOrTxid))
 					continue;
-				transactions[realCount++] = wallet->transactions[i];
+				transactions.push_back(wallet->transactions[i]);
 			}
 			pthread_mutex_unlock(&wallet->lock);
 
-			std::vector<nlohmann::json> jsonList(realCount);
-			for (size_t i = 0; i < realCount; ++i) {
+			return transactions;
+		}
+
+		nlohmann::json SubWallet::GetAllTransaction(uint32_t start, uint32_t count, const std::string &addressOrTxid) {
+			Log::getLogger(Log::Wallet)->info("GetAllTransaction: start = {}, count = {}, addressOrTxid = {}", start, count,
+								   addressOrTxid);
+
+			std::vector<BRTransaction *> transactions = transactionPage(start, count, addressOrTxid);
+
+			std::vector<nlohmann::json> jsonList(transactions.size());
+			for (size_t i = 0; i < transactions.size(); ++i) {
 				TransactionPtr transactionPtr(new Transaction((ELATransaction *) transactions[i], false));
 				nlohmann::json txJson = transactionPtr->toJson();
 				transactionPtr->generateExtraTransactionInfo(txJson, _walletManager->getWallet(),
@@ -187,6 +230,26 @@ namespace Elastos {
 			return j;
 		}
 
+		std::string SubWallet::GetAllTransactionString(uint32_t start, uint32_t count,
+													   const std::string &addressOrTxid) {
+			Log::getLogger(Log::Wallet)->info("GetAllTransaction: start = {}, count = {}, addressOrTxid = {}", start, count,
+								   addressOrTxid);
+
+			std::vector<BRTransaction *> transactions = transactionPage(start, count, addressOrTxid);
+			const WalletPtr &wallet = _walletManager->getWallet();
+			uint32_t blockHeight = _walletManager->getPeerManager()->getLastBlockHeight();
+
+			std::string result;
+			JsonWriter writer(result);
+			writer.BeginObject().Key("Transactions").BeginArray();
+			for (size_t i = 0; i < transactions.size(); ++i) {
+				Transaction transaction((ELATransaction *) transactions[i], false);
+				transaction.writeJson(writer, wallet, blockHeight);
+			}
+			writer.EndArray().EndObject();
+			return result;
+		}
+
 		boost::shared_ptr<Transaction>
 		SubWallet::createTransaction(TxParam *param) const {
 			//todo consider the situation of from address and fee not null
@@ -241,7 +304,8 @@ namespace Elastos {
 		}
 
 		void SubWallet::balanceChanged(uint64_t balance) {
-			Log::getLogger()->info("Tx callback (balanceChanged): balance={}", balance);
+			Log::getLogger(Log::Wallet)->info("Tx callback (balanceChanged): balance={}", balance);
+			_eventBus.BalanceChanged(balance);
 		}
 
 		void SubWallet::onTxAdded(const TransactionPtr &transaction) {
@@ -250,35 +314,35 @@ namespace Elastos {
 
 
 			std::string txHash = Utils::UInt256ToString(transaction->getHash());
-			Log::getLogger()->info("Tx callback (onTxAdded): Tx hash={}", txHash);
+			Log::getLogger(Log::Wallet)->info("Tx callback (onTxAdded): Tx hash={}", txHash);
 			_confirmingTxs[txHash] = transaction;
 
 			fireTransactionStatusChanged(txHash, SubWalletCallback::convertToString(SubWalletCallback::Added),
 										 transaction->toJson(), 0);
-			Log::getLogger()->info(
+			Log::getLogger(Log::Wallet)->info(
 					"Tx callback (onTxAdded) finished. Details: txHash={}, tx height = {}, confirm count={}.",
 					txHash, transaction->getBlockHeight(), 0);
 		}
 
 		void SubWallet::onTxUpdated(const std::string &hash, uint32_t blockHeight, uint32_t timeStamp) {
-			Log::getLogger()->info("Tx callback (onTxUpdated)");
+			Log::getLogger(Log::Wallet)->info("Tx callback (onTxUpdated)");
 			if (_confirmingTxs.find(hash) == _confirmingTxs.end()) {
 				_confirmingTxs[hash] = _walletManager->getWallet()->transactionForHash(Utils::UInt256FromString(hash));
 			}
 
-			Log::getLogger()->info("Tx callback (onTxUpdated): Tx hash={}", hash);
+			Log::getLogger(Log::Wallet)->info("Tx callback (onTxUpdated): Tx hash={}", hash);
 			uint32_t confirm = blockHeight - _confirmingTxs[hash]->getBlockHeight() + 1;
 			fireTransactionStatusChanged(hash, SubWalletCallback::convertToString(SubWalletCallback::Updated),
 										 _confirmingTxs[hash]->toJson(), confirm);
-			Log::getLogger()->info("Tx callback (onTxUpdated) finished. Details: txHash={}, confirm count={}.",
+			Log::getLogger(Log::Wallet)->info("Tx callback (onTxUpdated) finished. Details: txHash={}, confirm count={}.",
 								   hash, confirm);
 		}
 
 		void SubWallet::onTxDeleted(const std::string &hash, bool notifyUser, bool recommendRescan) {
-			Log::getLogger()->info("Tx callback (onTxDeleted) begin");
+			Log::getLogger(Log::Wallet)->info("Tx callback (onTxDeleted) begin");
 			fireTransactionStatusChanged(hash, SubWalletCallback::convertToString(SubWalletCallback::Deleted),
 										 nlohmann::json(), 0);
-			Log::getLogger()->info("Tx callback (onTxDeleted hash={}) finished.", hash);
+			Log::getLogger(Log::Wallet)->info("Tx callback (onTxDeleted hash={}) finished.", hash);
 		}
 
 		void SubWallet::recover(int limitGap) {
@@ -287,7 +351,7 @@ namespace Elastos {
 
 		Key SubWallet::deriveKey(const std::string &payPassword) {
 			CMBlock raw = Utils::decodeHex(_info.getEncryptedKey());
-			CMBlock keyData = Utils::decrypt(raw, payPassword);
+			CMBlock keyData = Utils::decrypt(raw, payPassword, _parent->GetId());
 			if (keyData.GetSize() == 0)
 				ErrorCode::StandardLogicError(ErrorCode::PasswordError, "Invalid password.");
 
@@ -314,7 +378,7 @@ namespace Elastos {
 
 		void SubWallet::signTransaction(const boost::shared_ptr<Transaction> &transaction, int forkId,
 										const std::string &payPassword) {
-			Log::getLogger()->info("SubWallet signTransaction method begin.");
+			Log::getLogger(Log::Wallet)->info("SubWallet signTransaction method begin.");
 
 			ParamChecker::checkNullPointer(transaction.get());
 			BRKey masterKey;
@@ -322,14 +386,14 @@ namespace Elastos {
 			deriveKeyAndChain(&masterKey, chainCode, payPassword);
 			BRWallet *wallet = _walletManager->getWallet()->getRaw();
 			ParamChecker::checkNullPointer(wallet);
-			Log::getLogger()->info("SubWallet signTransaction derive key down.");
+			Log::getLogger(Log::Wallet)->info("SubWallet signTransaction derive key down.");
 
 			BRTransaction *tx = transaction->getRaw();
 			uint32_t j, internalIdx[tx->inCount], externalIdx[tx->inCount];
 			size_t i, internalCount = 0, externalCount = 0;
 
 
-			Log::getLogger()->info("SubWallet signTransaction begin get indices.");
+			Log::getLogger(Log::Wallet)->info("SubWallet signTransaction begin get indices.");
 			pthread_mutex_lock(&wallet->lock);
 			for (i = 0; i < tx->inCount; i++) {
 				if (wallet->internalChain) {
@@ -348,17 +412,17 @@ namespace Elastos {
 				}
 			}
 			pthread_mutex_unlock(&wallet->lock);
-			Log::getLogger()->info("SubWallet signTransaction end get indices.");
+			Log::getLogger(Log::Wallet)->info("SubWallet signTransaction end get indices.");
 
 			BRKey keys[internalCount + externalCount];
 			Key::calculatePrivateKeyList(keys, internalCount, &masterKey.secret, &chainCode,
 										 SEQUENCE_INTERNAL_CHAIN, internalIdx);
 			Key::calculatePrivateKeyList(&keys[internalCount], externalCount, &masterKey.secret, &chainCode,
 										 SEQUENCE_EXTERNAL_CHAIN, externalIdx);
-			Log::getLogger()->info("SubWallet signTransaction calculate private key list done.");
+			Log::getLogger(Log::Wallet)->info("SubWallet signTransaction calculate private key list done.");
 
 			if (tx) {
-				Log::getLogger()->info("SubWallet signTransaction begin sign method.");
+				Log::getLogger(Log::Wallet)->info("SubWallet signTransaction begin sign method.");
 				WrapperList<Key, BRKey> keyList;
 				for (i = 0; i < internalCount + externalCount; ++i) {
 					Key key(keys[i].secret, keys[i].compressed);
@@ -367,7 +431,7 @@ namespace Elastos {
 				if (!transaction->sign(keyList, forkId)) {
 					throw std::logic_error("Transaction Sign error!");
 				}
-				Log::getLogger()->info("SubWallet signTransaction end sign method.");
+				Log::getLogger(Log::Wallet)->info("SubWallet signTransaction end sign method.");
 			}
 
 			for (i = 0; i < internalCount + externalCount; i++) BRKeyClean(&keys[i]);
@@ -417,8 +481,7 @@ namespace Elastos {
 
 			for (size_t i = 0; i < tx->raw.inCount; ++i) {
 				BRTxInput *input = &tx->raw.inputs[i];
-				std::string addr(input->address);
-				if (addr == addressOrTxid) {
+				if (addressOrTxid == input->address) {
 					return true;
 				}
 			}
@@ -429,12 +492,9 @@ namespace Elastos {
 				}
 			}
 
-			if (addressOrTxid.length() == sizeof(UInt256) * 2) {
-				Transaction txn(tx, false);
-				UInt256 Txid = Utils::UInt256FromString(addressOrTxid, true);
-				if (UInt256Eq(&Txid, &tx->raw.txHash)) {
-					return true;
-				}
+			if (addressOrTxid.length() == sizeof(UInt256) * 2 &&
+				Utils::UInt256EqualsString(tx->raw.txHash, addressOrTxid, true)) {
+				return true;
 			}
 
 			return false;
@@ -446,33 +506,27 @@ namespace Elastos {
 				_info.setEaliestPeerTime(TimeUtils::getCurrentTime());
 			}
 
-			std::for_each(_callbacks.begin(), _callbacks.end(),
-						  [](ISubWalletCallback *callback) {
-							  callback->OnBlockSyncStarted();
-						  });
+			_eventBus.BlockSyncStarted();
 		}
 
 		void SubWallet::syncStopped(const std::string &error) {
 			_syncStartHeight = 0;
 
 			if (!error.empty()) {
-				Log::error(error);
+				Log::getLogger(Log::Wallet)->error(error);
 			}
 
-			std::for_each(_callbacks.begin(), _callbacks.end(),
-						  [](ISubWalletCallback *callback) {
-							  callback->OnBlockSyncStopped();
-						  });
+			_eventBus.BlockSyncStopped();
 		}
 
 		void SubWallet::saveBlocks(bool replace, const SharedWrapperList<IMerkleBlock, BRMerkleBlock *> &blocks) {
-			Log::getLogger()->info("Saving blocks: block count = {}, chain id = {}", blocks.size(),
+			Log::getLogger(Log::Wallet)->info("Saving blocks: block count = {}, chain id = {}", blocks.size(),
 								   _info.getChainId());
 		}
 
 		void SubWallet::blockHeightIncreased(uint32_t blockHeight) {
 			for (TransactionMap::iterator it = _confirmingTxs.begin(); it != _confirmingTxs.end(); ++it) {
-				Log::getLogger()->info(
+				Log::getLogger(Log::Wallet)->info(
 						"Transaction height increased: txHash = {}, confirms = {}, tx height = {}, last block height = {}",
 						it->first, blockHeight - it->second->getBlockHeight() + 1, it->second->getBlockHeight(),
 						blockHeight);
@@ -494,20 +548,14 @@ namespace Elastos {
 					++it;
 			}
 
-			std::for_each(_callbacks.begin(), _callbacks.end(),
-						  [blockHeight, this](ISubWalletCallback *callback) {
-							  callback->OnBlockHeightIncreased(
-									  blockHeight, _walletManager->getPeerManager()->getSyncProgress(_syncStartHeight));
-						  });
+			_eventBus.BlockHeightIncreased(blockHeight,
+										   _walletManager->getPeerManager()->getSyncProgress(_syncStartHeight));
 		}
 
 		void SubWallet::fireTransactionStatusChanged(const std::string &txid, const std::string &status,
 													 const nlohmann::json &desc, uint32_t confirms) {
 			std::string reversedId(txid.rbegin(), txid.rend());
-			std::for_each(_callbacks.begin(), _callbacks.end(),
-						  [&reversedId, &status, &desc, confirms](ISubWalletCallback *callback) {
-							  callback->OnTransactionStatusChanged(reversedId, status, desc, confirms);
-						  });
+			_eventBus.TransactionStatusChanged(reversedId, status, desc, confirms);
 		}
 
 		void SubWallet::ChangePassword(const std::string &oldPassword, const std::string &newPassword) {
@@ -526,10 +574,7 @@ namespace Elastos {
 		}
 
 		void SubWallet::fireDestroyWallet() {
-			std::for_each(_callbacks.begin(), _callbacks.end(),
-						  [](ISubWalletCallback *callback) {
-							  callback->OnDestroyWallet();
-						  });
+			_eventBus.DestroyWallet();
 		}
 
 	}
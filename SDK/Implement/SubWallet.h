@@ -14,6 +14,7 @@
 #include "KeyStore/CoinInfo.h"
 #include "ChainParams.h"
 #include "WalletManager.h"
+#include "SubWalletEventBus.h"
 
 namespace Elastos {
 	namespace ElaWallet {
@@ -40,6 +41,8 @@ namespace Elastos {
 
 			virtual nlohmann::json GetBalanceInfo();
 
+			virtual std::string GetBalanceInfoString();
+
 			virtual uint64_t GetBalance();
 
 			virtual std::string CreateAddress();
@@ -47,12 +50,20 @@ namespace Elastos {
 			virtual nlohmann::json GetAllAddress(uint32_t start,
 												 uint32_t count);
 
+			virtual std::string GetAllAddressString(uint32_t start,
+													uint32_t count);
+
 			virtual uint64_t GetBalanceWithAddress(const std::string &address);
 
 			virtual void AddCallback(ISubWalletCallback *subCallback);
 
+			virtual void AddBatchedCallback(ISubWalletCallback *subCallback, uint32_t batchWindowMs,
+											uint32_t progressIntervalMs);
+
 			virtual void RemoveCallback(ISubWalletCallback *subCallback);
 
+			bool HasCallbacks() const;
+
 			virtual nlohmann::json CreateTransaction(
 					const std::string &fromAddress,
 					const std::string &toAddress,
@@ -81,6 +92,11 @@ namespace Elastos {
 					uint32_t count,
 					const std::string &addressOrTxid);
 
+			virtual std::string GetAllTransactionString(
+					uint32_t start,
+					uint32_t count,
+					const std::string &addressOrTxid);
+
 			virtual std::string Sign(
 					const std::string &message,
 					const std::string &payPassword);
@@ -157,6 +173,13 @@ namespace Elastos {
 
 			bool filterByAddressOrTxId(BRTransaction *transaction, const std::string &addressOrTxid);
 
+			// the page of GetAllAddress(), empty when start is past the end
+			std::vector<std::string> addressPage(uint32_t start, uint32_t count);
+
+			// the page of GetAllTransaction(), newest first
+			std::vector<BRTransaction *> transactionPage(uint32_t start, uint32_t count,
+														const std::string &addressOrTxid);
+
 			virtual void fireTransactionStatusChanged(const std::string &txid,
 													  const std::string &status,
 													  const nlohmann::json &desc,
@@ -165,7 +188,7 @@ namespace Elastos {
 			virtual void fireDestroyWallet();
 		protected:
 			WalletManagerPtr _walletManager;
-			std::vector<ISubWalletCallback *> _callbacks;
+			SubWalletEventBus _eventBus;
 			MasterWallet *_parent;
 			CoinInfo _info;
 
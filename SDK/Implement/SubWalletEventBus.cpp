@@ -0,0 +1,331 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <map>
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+
+#include "SubWalletEventBus.h"
+#include "SubWalletCallback.h"
+#include "Log.h"
+
+using namespace boost::posix_time;
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			// one thread runs the coalescing timers of every sub wallet
+			boost::asio::io_service &timerService() {
+				static boost::asio::io_service *service = [] {
+					// intentionally leaked, like the thread running it
+					boost::asio::io_service *s = new boost::asio::io_service();
+					new boost::asio::io_service::work(*s);
+					boost::thread(boost::bind(&boost::asio::io_service::run, s)).detach();
+					return s;
+				}();
+				return *service;
+			}
+		}
+
+		struct SubWalletEventBus::Subscriber {
+			struct TxEvent {
+				std::string Txid;
+				std::string Status;
+				nlohmann::json Desc;
+				uint32_t Confirms;
+			};
+
+			Subscriber(ISubWalletCallback *callback, uint32_t batchWindowMs, uint32_t progressIntervalMs) :
+					Callback(callback),
+					BatchWindow(milliseconds(batchWindowMs)),
+					ProgressInterval(milliseconds(progressIntervalMs)),
+					Removed(false),
+					HasBalance(false),
+					Balance(0),
+					HasProgress(false),
+					BlockHeight(0),
+					Progress(0),
+					Timer(timerService()),
+					Armed(false) {
+			}
+
+			ISubWalletCallback *Callback;
+			time_duration BatchWindow;
+			time_duration ProgressInterval;
+
+			// held while calling Callback, so a timer flush and an event thread flush never interleave
+			boost::mutex DeliverLock;
+
+			boost::mutex Lock;
+			bool Removed;
+			// the thread holding DeliverLock, if any
+			boost::thread::id Deliverer;
+			std::vector<TxEvent> Txs;
+			std::map<std::string, size_t> LastTx;
+			bool HasBalance;
+			uint64_t Balance;
+			ptime FirstPending;
+			bool HasProgress;
+			uint32_t BlockHeight;
+			double Progress;
+			ptime LastProgress;
+			boost::asio::deadline_timer Timer;
+			bool Armed;
+		};
+
+		// Held by a thread calling a subscriber's callback: owns its DeliverLock and records the thread, so that
+		// Unsubscribe() waits for the delivery to end unless called from within it.
+		struct SubWalletEventBus::Delivery {
+			explicit Delivery(const SubscriberPtr &subscriber) :
+					_subscriber(subscriber),
+					_deliver(subscriber->DeliverLock) {
+				boost::mutex::scoped_lock lock(_subscriber->Lock);
+				_subscriber->Deliverer = boost::this_thread::get_id();
+			}
+
+			~Delivery() {
+				boost::mutex::scoped_lock lock(_subscriber->Lock);
+				_subscriber->Deliverer = boost::thread::id();
+			}
+
+			// checked before each call, a callback may unsubscribe itself or another one of the wallet
+			bool Active() const {
+				boost::mutex::scoped_lock lock(_subscriber->Lock);
+				return !_subscriber->Removed;
+			}
+
+		private:
+			SubscriberPtr _subscriber;
+			boost::mutex::scoped_lock _deliver;
+		};
+
+		SubWalletEventBus::SubWalletEventBus() {
+		}
+
+		SubWalletEventBus::~SubWalletEventBus() {
+			std::vector<SubscriberPtr> all = subscribers();
+			for (size_t i = 0; i < all.size(); ++i)
+				Unsubscribe(all[i]->Callback);
+		}
+
+		void SubWalletEventBus::Subscribe(ISubWalletCallback *callback, uint32_t batchWindowMs,
+										  uint32_t progressIntervalMs) {
+			boost::mutex::scoped_lock lock(_lock);
+			for (size_t i = 0; i < _subscribers.size(); ++i) {
+				if (_subscribers[i]->Callback == callback)
+					return;
+			}
+			_subscribers.push_back(SubscriberPtr(new Subscriber(callback, batchWindowMs, progressIntervalMs)));
+		}
+
+		void SubWalletEventBus::Unsubscribe(ISubWalletCallback *callback) {
+			SubscriberPtr removed;
+			{
+				boost::mutex::scoped_lock lock(_lock);
+				for (size_t i = 0; i < _subscribers.size(); ++i) {
+					if (_subscribers[i]->Callback == callback) {
+						removed = _subscribers[i];
+						_subscribers.erase(_subscribers.begin() + i);
+						break;
+					}
+				}
+			}
+
+			if (removed) {
+				bool inCallback;
+				{
+					boost::mutex::scoped_lock lock(removed->Lock);
+					removed->Removed = true;
+					removed->Timer.cancel();
+					inCallback = removed->Deliverer == boost::this_thread::get_id();
+				}
+
+				// the callback may be destroyed as soon as this returns
+				if (!inCallback) {
+					boost::mutex::scoped_lock deliver(removed->DeliverLock);
+				}
+			}
+		}
+
+		bool SubWalletEventBus::HasSubscribers() const {
+			boost::mutex::scoped_lock lock(_lock);
+			return !_subscribers.empty();
+		}
+
+		void SubWalletEventBus::TransactionStatusChanged(const std::string &txid, const std::string &status,
+														 const nlohmann::json &desc, uint32_t confirms) {
+			std::vector<SubscriberPtr> all = subscribers();
+			bool updated = SubWalletCallback::convertToStatus(status) == SubWalletCallback::Updated;
+
+			for (size_t i = 0; i < all.size(); ++i) {
+				{
+					boost::mutex::scoped_lock lock(all[i]->Lock);
+					Subscriber &s = *all[i];
+					if (s.Txs.empty() && !s.HasBalance)
+						s.FirstPending = microsec_clock::universal_time();
+
+					std::map<std::string, size_t>::iterator last = s.LastTx.find(txid);
+					if (updated && last != s.LastTx.end() &&
+						SubWalletCallback::convertToStatus(s.Txs[last->second].Status) == SubWalletCallback::Updated) {
+						s.Txs[last->second].Desc = desc;
+						s.Txs[last->second].Confirms = confirms;
+					} else {
+						Subscriber::TxEvent event;
+						event.Txid = txid;
+						event.Status = status;
+						event.Desc = desc;
+						event.Confirms = confirms;
+						s.LastTx[txid] = s.Txs.size();
+						s.Txs.push_back(event);
+					}
+				}
+				flush(all[i], false);
+			}
+		}
+
+		void SubWalletEventBus::BalanceChanged(uint64_t balance) {
+			std::vector<SubscriberPtr> all = subscribers();
+			for (size_t i = 0; i < all.size(); ++i) {
+				{
+					boost::mutex::scoped_lock lock(all[i]->Lock);
+					if (all[i]->Txs.empty() && !all[i]->HasBalance)
+						all[i]->FirstPending = microsec_clock::universal_time();
+					all[i]->HasBalance = true;
+					all[i]->Balance = balance;
+				}
+				flush(all[i], false);
+			}
+		}
+
+		void SubWalletEventBus::BlockSyncStarted() {
+			std::vector<SubscriberPtr> all = subscribers();
+			for (size_t i = 0; i < all.size(); ++i) {
+				flush(all[i], true);
+				Delivery delivery(all[i]);
+				if (delivery.Active())
+					all[i]->Callback->OnBlockSyncStarted();
+			}
+		}
+
+		void SubWalletEventBus::BlockHeightIncreased(uint32_t blockHeight, double progress) {
+			std::vector<SubscriberPtr> all = subscribers();
+			for (size_t i = 0; i < all.size(); ++i) {
+				{
+					boost::mutex::scoped_lock lock(all[i]->Lock);
+					all[i]->HasProgress = true;
+					all[i]->BlockHeight = blockHeight;
+					all[i]->Progress = progress;
+				}
+				flush(all[i], false);
+			}
+		}
+
+		void SubWalletEventBus::BlockSyncStopped() {
+			std::vector<SubscriberPtr> all = subscribers();
+			for (size_t i = 0; i < all.size(); ++i) {
+				flush(all[i], true);
+				Delivery delivery(all[i]);
+				if (delivery.Active())
+					all[i]->Callback->OnBlockSyncStopped();
+			}
+		}
+
+		void SubWalletEventBus::DestroyWallet() {
+			std::vector<SubscriberPtr> all = subscribers();
+			for (size_t i = 0; i < all.size(); ++i) {
+				flush(all[i], true);
+				Delivery delivery(all[i]);
+				if (delivery.Active())
+					all[i]->Callback->OnDestroyWallet();
+			}
+		}
+
+		void SubWalletEventBus::Flush() {
+			std::vector<SubscriberPtr> all = subscribers();
+			for (size_t i = 0; i < all.size(); ++i)
+				flush(all[i], true);
+		}
+
+		std::vector<SubWalletEventBus::SubscriberPtr> SubWalletEventBus::subscribers() const {
+			boost::mutex::scoped_lock lock(_lock);
+			return _subscribers;
+		}
+
+		void SubWalletEventBus::flush(const SubscriberPtr &subscriber, bool force) {
+			Delivery delivery(subscriber);
+
+			std::vector<Subscriber::TxEvent> txs;
+			bool hasBalance = false, hasProgress = false;
+			uint64_t balance = 0;
+			uint32_t blockHeight = 0;
+			double progress = 0;
+			{
+				boost::mutex::scoped_lock lock(subscriber->Lock);
+				Subscriber &s = *subscriber;
+				if (s.Removed)
+					return;
+
+				ptime now = microsec_clock::universal_time();
+				ptime next(boost::date_time::pos_infin);
+
+				if (!s.Txs.empty() || s.HasBalance) {
+					if (force || now - s.FirstPending >= s.BatchWindow) {
+						txs.swap(s.Txs);
+						s.LastTx.clear();
+						hasBalance = s.HasBalance;
+						balance = s.Balance;
+						s.HasBalance = false;
+					} else {
+						next = s.FirstPending + s.BatchWindow;
+					}
+				}
+
+				if (s.HasProgress) {
+					if (force || s.LastProgress.is_not_a_date_time() || now - s.LastProgress >= s.ProgressInterval) {
+						hasProgress = true;
+						blockHeight = s.BlockHeight;
+						progress = s.Progress;
+						s.HasProgress = false;
+						s.LastProgress = now;
+					} else {
+						next = std::min(next, s.LastProgress + s.ProgressInterval);
+					}
+				}
+
+				if (!next.is_pos_infinity() && !s.Armed) {
+					s.Armed = true;
+					s.Timer.expires_at(next);
+					SubscriberPtr self = subscriber;
+					s.Timer.async_wait([self](const boost::system::error_code &error) {
+						onTimer(self, error == boost::asio::error::operation_aborted);
+					});
+				}
+			}
+
+			try {
+				for (size_t i = 0; i < txs.size() && delivery.Active(); ++i)
+					subscriber->Callback->OnTransactionStatusChanged(txs[i].Txid, txs[i].Status, txs[i].Desc,
+																	 txs[i].Confirms);
+				if (hasBalance && delivery.Active())
+					subscriber->Callback->OnBalanceChanged(balance);
+				if (hasProgress && delivery.Active())
+					subscriber->Callback->OnBlockHeightIncreased(blockHeight, progress);
+			} catch (const std::exception &e) {
+				Log::getLogger(Log::Wallet)->error("Sub wallet callback error: {}", e.what());
+			}
+		}
+
+		void SubWalletEventBus::onTimer(const SubscriberPtr &subscriber, bool cancelled) {
+			{
+				boost::mutex::scoped_lock lock(subscriber->Lock);
+				subscriber->Armed = false;
+			}
+
+			if (!cancelled)
+				flush(subscriber, false);
+		}
+
+	}
+}
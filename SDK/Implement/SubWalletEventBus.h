@@ -0,0 +1,80 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_SUBWALLETEVENTBUS_H__
+#define __ELASTOS_SDK_SUBWALLETEVENTBUS_H__
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "ISubWalletCallback.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Delivers sub wallet events to the callbacks subscribed to a sub wallet. A subscriber either gets every
+		 * event as it happens, or gets them coalesced:
+		 *  - transaction status changes and balance changes are held for batchWindowMs and then delivered together,
+		 *    consecutive "Updated" events of one transaction collapse into the latest one and only the last balance
+		 *    is kept;
+		 *  - block height / progress events are delivered at most once every progressIntervalMs, with the latest
+		 *    height.
+		 * Sync started/stopped and wallet destroyed are never delayed, pending events are flushed before them.
+		 * Delayed events are delivered from a timer thread shared by all sub wallets.
+		 */
+		class SubWalletEventBus {
+		public:
+			SubWalletEventBus();
+
+			~SubWalletEventBus();
+
+			// batchWindowMs and progressIntervalMs 0 means immediate delivery
+			void Subscribe(ISubWalletCallback *callback, uint32_t batchWindowMs = 0, uint32_t progressIntervalMs = 0);
+
+			// once this returns the callback is not called any more, a delivery in flight on another thread is
+			// waited for; a callback may unsubscribe itself
+			void Unsubscribe(ISubWalletCallback *callback);
+
+			bool HasSubscribers() const;
+
+			void TransactionStatusChanged(const std::string &txid, const std::string &status,
+										  const nlohmann::json &desc, uint32_t confirms);
+
+			void BalanceChanged(uint64_t balance);
+
+			void BlockSyncStarted();
+
+			void BlockHeightIncreased(uint32_t blockHeight, double progress);
+
+			void BlockSyncStopped();
+
+			void DestroyWallet();
+
+			// deliver every pending event now
+			void Flush();
+
+		private:
+			struct Subscriber;
+
+			struct Delivery;
+
+			typedef boost::shared_ptr<Subscriber> SubscriberPtr;
+
+			std::vector<SubscriberPtr> subscribers() const;
+
+			static void flush(const SubscriberPtr &subscriber, bool force);
+
+			static void onTimer(const SubscriberPtr &subscriber, bool cancelled);
+
+		private:
+			mutable boost::mutex _lock;
+			std::vector<SubscriberPtr> _subscribers;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_SUBWALLETEVENTBUS_H__
@@ -0,0 +1,251 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+#include "BRCrypto.h"
+#include "BIP39WordList.h"
+#include "BIP39WordListData.h"
+
+#define BIP39_HASH_BUCKETS (BIP39_WORDLIST_COUNT / 4)
+#define BIP39_MAX_PHRASE_WORDS 24
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			struct BuiltInList {
+				const char *language;
+				const char *pool;
+				const uint16_t *offsets;
+			};
+
+			const BuiltInList builtInLists[] = {
+					{"english",  BIP39PoolEnglish,  BIP39OffsetsEnglish},
+					{"chinese",  BIP39PoolChinese,  BIP39OffsetsChinese},
+					{"french",   BIP39PoolFrench,   BIP39OffsetsFrench},
+					{"italian",  BIP39PoolItalian,  BIP39OffsetsItalian},
+					{"japanese", BIP39PoolJapanese, BIP39OffsetsJapanese},
+					{"spanish",  BIP39PoolSpanish,  BIP39OffsetsSpanish},
+			};
+		}
+
+		BIP39WordList::BIP39WordList(const std::string &language, const char *pool, const uint16_t *offsets) :
+				_language(language) {
+			for (size_t i = 0; i < BIP39_WORDLIST_COUNT; ++i) {
+				_words[i] = pool + offsets[i];
+				_lengths[i] = (uint8_t) strlen(_words[i]);
+			}
+			buildIndex();
+		}
+
+		const BIP39WordList *BIP39WordList::Get(const std::string &language) {
+			// built on first use, every list and its index is immutable afterwards
+			static const std::vector<BIP39WordList> lists = [] {
+				std::vector<BIP39WordList> result;
+				for (size_t i = 0; i < sizeof(builtInLists) / sizeof(builtInLists[0]); ++i)
+					result.push_back(BIP39WordList(builtInLists[i].language, builtInLists[i].pool,
+												   builtInLists[i].offsets));
+				return result;
+			}();
+
+			for (size_t i = 0; i < lists.size(); ++i) {
+				if (lists[i]._language == language)
+					return &lists[i];
+			}
+			return nullptr;
+		}
+
+		std::vector<std::string> BIP39WordList::Languages() {
+			std::vector<std::string> languages;
+			for (size_t i = 0; i < sizeof(builtInLists) / sizeof(builtInLists[0]); ++i)
+				languages.push_back(builtInLists[i].language);
+			return languages;
+		}
+
+		std::string BIP39WordList::Normalize(const std::string &phrase) {
+			static const char ideographicSpace[] = "\xE3\x80\x80";
+			std::string result;
+			bool pendingSpace = false;
+
+			result.reserve(phrase.size());
+			for (size_t i = 0; i < phrase.size();) {
+				unsigned char c = (unsigned char) phrase[i];
+				if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v') {
+					pendingSpace = true;
+					i++;
+				} else if (phrase.compare(i, 3, ideographicSpace) == 0) {
+					pendingSpace = true;
+					i += 3;
+				} else {
+					if (pendingSpace && !result.empty())
+						result += ' ';
+					pendingSpace = false;
+					result += (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : char(c);
+					i++;
+				}
+			}
+
+			return result;
+		}
+
+		std::string BIP39WordList::DetectLanguage(const std::string &phrase) {
+			std::vector<std::string> languages = Languages();
+
+			for (size_t i = 0; i < languages.size(); ++i) {
+				const BIP39WordList *list = Get(languages[i]);
+				bool found = !phrase.empty();
+
+				for (size_t begin = 0; found && begin <= phrase.size();) {
+					size_t end = phrase.find(' ', begin);
+					if (end == std::string::npos) end = phrase.size();
+					found = list->IndexOf(&phrase[begin], end - begin) >= 0;
+					begin = end + 1;
+				}
+
+				if (found)
+					return languages[i];
+			}
+
+			return "";
+		}
+
+		const std::string &BIP39WordList::GetLanguage() const {
+			return _language;
+		}
+
+		const char *BIP39WordList::Word(uint32_t index) const {
+			return index < BIP39_WORDLIST_COUNT ? _words[index] : nullptr;
+		}
+
+		const char **BIP39WordList::Words() const {
+			return const_cast<const char **>(_words);
+		}
+
+		std::vector<std::string> BIP39WordList::WordVector() const {
+			return std::vector<std::string>(_words, _words + BIP39_WORDLIST_COUNT);
+		}
+
+		int BIP39WordList::IndexOf(const char *word, size_t len) const {
+			if (len == 0)
+				return -1;
+
+			uint16_t displacement = _displacements[hash(word, len, 0) % BIP39_HASH_BUCKETS];
+			uint16_t index = _slots[hash(word, len, displacement) % BIP39_WORDLIST_COUNT];
+
+			if (_lengths[index] != len || memcmp(_words[index], word, len) != 0)
+				return -1;
+			return index;
+		}
+
+		size_t BIP39WordList::Decode(uint8_t *entropy, size_t entropyLen, const std::string &phrase) const {
+			uint16_t indexes[BIP39_MAX_PHRASE_WORDS];
+			uint8_t buf[BIP39_MAX_PHRASE_WORDS * 11 / 8] = {0}, md[32];
+			size_t count = 0, begin = 0, r = 0;
+
+			while (begin < phrase.size() && count < BIP39_MAX_PHRASE_WORDS) {
+				size_t end = phrase.find(' ', begin);
+				if (end == std::string::npos) end = phrase.size();
+
+				int index = IndexOf(&phrase[begin], end - begin);
+				if (index < 0) break; // phrase contains unknown word
+				indexes[count++] = (uint16_t) index;
+				begin = end == phrase.size() ? end : end + 1;
+			}
+
+			if (count % 3 == 0 && begin == phrase.size()) { // check that phrase has correct number of words
+				for (size_t i = 0; i < count * 11; ++i) {
+					if (indexes[i / 11] & (1 << (10 - i % 11)))
+						buf[i / 8] |= 0x80 >> (i % 8);
+				}
+
+				size_t len = count * 4 / 3, checksumBits = count / 3;
+				BRSHA256(md, buf, len);
+				if ((buf[len] >> (8 - checksumBits)) == (md[0] >> (8 - checksumBits))) { // verify checksum
+					r = len;
+					if (entropy && r <= entropyLen) memcpy(entropy, buf, r);
+				}
+			}
+
+			mem_clean(buf, sizeof(buf));
+			mem_clean(indexes, sizeof(indexes));
+			return (!entropy || r <= entropyLen) ? r : 0;
+		}
+
+		bool BIP39WordList::PhraseIsValid(const std::string &phrase) const {
+			return Decode(nullptr, 0, phrase) > 0;
+		}
+
+		uint32_t BIP39WordList::hash(const char *word, size_t len, uint32_t seed) {
+			uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+
+			for (size_t i = 0; i < len; ++i) {
+				h ^= (uint8_t) word[i];
+				h *= 16777619u;
+			}
+
+			h ^= h >> 16;
+			h *= 0x85EBCA6Bu;
+			h ^= h >> 13;
+			h *= 0xC2B2AE35u;
+			h ^= h >> 16;
+			return h;
+		}
+
+		void BIP39WordList::buildIndex() {
+			// hash and displace: words are grouped into buckets, then the largest buckets first get the smallest
+			// displacement that sends all their words to free slots
+			std::vector<std::vector<uint16_t> > buckets(BIP39_HASH_BUCKETS);
+			for (uint16_t i = 0; i < BIP39_WORDLIST_COUNT; ++i)
+				buckets[hash(_words[i], _lengths[i], 0) % BIP39_HASH_BUCKETS].push_back(i);
+
+			std::vector<uint16_t> order(BIP39_HASH_BUCKETS);
+			for (uint16_t b = 0; b < BIP39_HASH_BUCKETS; ++b)
+				order[b] = b;
+			std::stable_sort(order.begin(), order.end(), [&buckets](uint16_t a, uint16_t b) {
+				return buckets[a].size() > buckets[b].size();
+			});
+
+			std::vector<bool> used(BIP39_WORDLIST_COUNT, false);
+			std::vector<uint32_t> slots;
+			_displacements.assign(BIP39_HASH_BUCKETS, 0);
+			_slots.assign(BIP39_WORDLIST_COUNT, 0);
+
+			for (size_t n = 0; n < order.size(); ++n) {
+				const std::vector<uint16_t> &bucket = buckets[order[n]];
+				if (bucket.empty())
+					break;
+
+				bool placed = false;
+				for (uint32_t displacement = 1; displacement <= UINT16_MAX && !placed; ++displacement) {
+					bool ok = true;
+
+					slots.clear();
+					for (size_t i = 0; i < bucket.size() && ok; ++i) {
+						uint32_t slot = hash(_words[bucket[i]], _lengths[bucket[i]], displacement) %
+										BIP39_WORDLIST_COUNT;
+						ok = !used[slot] && std::find(slots.begin(), slots.end(), slot) == slots.end();
+						slots.push_back(slot);
+					}
+
+					if (ok) {
+						_displacements[order[n]] = (uint16_t) displacement;
+						for (size_t i = 0; i < bucket.size(); ++i) {
+							used[slots[i]] = true;
+							_slots[slots[i]] = bucket[i];
+						}
+						placed = true;
+					}
+				}
+
+				// the words of this bucket would silently be missing from IndexOf()
+				if (!placed)
+					throw std::logic_error("no displacement places every word of the " + _language + " wordlist");
+			}
+		}
+
+	}
+}
@@ -0,0 +1,78 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_BIP39WORDLIST_H__
+#define __ELASTOS_SDK_BIP39WORDLIST_H__
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "BRBIP39Mnemonic.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * BIP39 wordlists compiled into the library (english, chinese, french, italian, japanese, spanish), so
+		 * mnemonics are generated and checked without touching the filesystem. Words are found through a minimal
+		 * perfect hash built once per process: one hash probe and one string comparison per word.
+		 */
+		class BIP39WordList {
+		public:
+			// nullptr if language is not built in
+			static const BIP39WordList *Get(const std::string &language);
+
+			static std::vector<std::string> Languages();
+
+			/**
+			 * Collapse runs of ASCII whitespace and ideographic spaces (U+3000) into single ASCII spaces, trim both
+			 * ends and lower case ASCII letters.
+			 */
+			static std::string Normalize(const std::string &phrase);
+
+			// first built in language containing every word of phrase, empty if there is none
+			static std::string DetectLanguage(const std::string &phrase);
+
+			const std::string &GetLanguage() const;
+
+			const char *Word(uint32_t index) const;
+
+			// the list in the layout BRBIP39Encode() and BRBIP39Decode() expect
+			const char **Words() const;
+
+			std::vector<std::string> WordVector() const;
+
+			// index of word, -1 if it is not in the list
+			int IndexOf(const char *word, size_t len) const;
+
+			/**
+			 * Same result as BRBIP39Decode(): phrase words are separated by single spaces, the word count must be
+			 * a multiple of three up to 24 and the checksum must match.
+			 * @return entropy bytes written, or needed when entropy is nullptr; 0 if the phrase is invalid.
+			 */
+			size_t Decode(uint8_t *entropy, size_t entropyLen, const std::string &phrase) const;
+
+			bool PhraseIsValid(const std::string &phrase) const;
+
+		private:
+			BIP39WordList(const std::string &language, const char *pool, const uint16_t *offsets);
+
+			static uint32_t hash(const char *word, size_t len, uint32_t seed);
+
+			// throws std::logic_error if some bucket of words cannot be placed
+			void buildIndex();
+
+		private:
+			std::string _language;
+			const char *_words[BIP39_WORDLIST_COUNT];
+			uint8_t _lengths[BIP39_WORDLIST_COUNT];
+			std::vector<uint16_t> _displacements;
+			std::vector<uint16_t> _slots;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_BIP39WORDLIST_H__
@@ -0,0 +1,13365 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+// BIP39 wordlists of Core/BRBIP39WordsEn.h and Data/mnemonic_*.txt, laid out as one string pool of NUL terminated
+// words per language plus the offset of every word in its pool. Only included by BIP39WordList.cpp.
+
+#ifndef __ELASTOS_SDK_BIP39WORDLISTDATA_H__
+#define __ELASTOS_SDK_BIP39WORDLISTDATA_H__
+
+#include <cstdint>
+
+#include "BRBIP39Mnemonic.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+		namespace {
+			constexpr char BIP39PoolEnglish[] =
+					"abandon\0"
+					"ability\0"
+					"able\0"
+					"about\0"
+					"above\0"
+					"absent\0"
+					"absorb\0"
+					"abstract\0"
+					"absurd\0"
+					"abuse\0"
+					"access\0"
+					"accident\0"
+					"account\0"
+					"accuse\0"
+					"achieve\0"
+					"acid\0"
+					"acoustic\0"
+					"acquire\0"
+					"across\0"
+					"act\0"
+					"action\0"
+					"actor\0"
+					"actress\0"
+					"actual\0"
+					"adapt\0"
+					"add\0"
+					"addict\0"
+					"address\0"
+					"adjust\0"
+					"admit\0"
+					"adult\0"
+					"advance\0"
+					"advice\0"
+					"aerobic\0"
+					"affair\0"
+					"afford\0"
+					"afraid\0"
+					"again\0"
+					"age\0"
+					"agent\0"
+					"agree\0"
+					"ahead\0"
+					"aim\0"
+					"air\0"
+					"airport\0"
+					"aisle\0"
+					"alarm\0"
+					"album\0"
+					"alcohol\0"
+					"alert\0"
+					"alien\0"
+					"all\0"
+					"alley\0"
+					"allow\0"
+					"almost\0"
+					"alone\0"
+					"alpha\0"
+					"already\0"
+					"also\0"
+					"alter\0"
+					"always\0"
+					"amateur\0"
+					"amazing\0"
+					"among\0"
+					"amount\0"
+					"amused\0"
+					"analyst\0"
+					"anchor\0"
+					"ancient\0"
+					"anger\0"
+					"angle\0"
+					"angry\0"
+					"animal\0"
+					"ankle\0"
+					"announce\0"
+					"annual\0"
+					"another\0"
+					"answer\0"
+					"antenna\0"
+					"antique\0"
+					"anxiety\0"
+					"any\0"
+					"apart\0"
+					"apology\0"
+					"appear\0"
+					"apple\0"
+					"approve\0"
+					"april\0"
+					"arch\0"
+					"arctic\0"
+					"area\0"
+					"arena\0"
+					"argue\0"
+					"arm\0"
+					"armed\0"
+					"armor\0"
+					"army\0"
+					"around\0"
+					"arrange\0"
+					"arrest\0"
+					"arrive\0"
+					"arrow\0"
+					"art\0"
+					"artefact\0"
+					"artist\0"
+					"artwork\0"
+					"ask\0"
+					"aspect\0"
+					"assault\0"
+					"asset\0"
+					"assist\0"
+					"assume\0"
+					"asthma\0"
+					"athlete\0"
+					"atom\0"
+					"attack\0"
+					"attend\0"
+					"attitude\0"
+					"attract\0"
+					"auction\0"
+					"audit\0"
+					"august\0"
+					"aunt\0"
+					"author\0"
+					"auto\0"
+					"autumn\0"
+					"average\0"
+					"avocado\0"
+					"avoid\0"
+					"awake\0"
+					"aware\0"
+					"away\0"
+					"awesome\0"
+					"awful\0"
+					"awkward\0"
+					"axis\0"
+					"baby\0"
+					"bachelor\0"
+					"bacon\0"
+					"badge\0"
+					"bag\0"
+					"balance\0"
+					"balcony\0"
+					"ball\0"
+					"bamboo\0"
+					"banana\0"
+					"banner\0"
+					"bar\0"
+					"barely\0"
+					"bargain\0"
+					"barrel\0"
+					"base\0"
+					"basic\0"
+					"basket\0"
+					"battle\0"
+					"beach\0"
+					"bean\0"
+					"beauty\0"
+					"because\0"
+					"become\0"
+					"beef\0"
+					"before\0"
+					"begin\0"
+					"behave\0"
+					"behind\0"
+					"believe\0"
+					"below\0"
+					"belt\0"
+					"bench\0"
+					"benefit\0"
+					"best\0"
+					"betray\0"
+					"better\0"
+					"between\0"
+					"beyond\0"
+					"bicycle\0"
+					"bid\0"
+					"bike\0"
+					"bind\0"
+					"biology\0"
+					"bird\0"
+					"birth\0"
+					"bitter\0"
+					"black\0"
+					"blade\0"
+					"blame\0"
+					"blanket\0"
+					"blast\0"
+					"bleak\0"
+					"bless\0"
+					"blind\0"
+					"blood\0"
+					"blossom\0"
+					"blouse\0"
+					"blue\0"
+					"blur\0"
+					"blush\0"
+					"board\0"
+					"boat\0"
+					"body\0"
+					"boil\0"
+					"bomb\0"
+					"bone\0"
+					"bonus\0"
+					"book\0"
+					"boost\0"
+					"border\0"
+					"boring\0"
+					"borrow\0"
+					"boss\0"
+					"bottom\0"
+					"bounce\0"
+					"box\0"
+					"boy\0"
+					"bracket\0"
+					"brain\0"
+					"brand\0"
+					"brass\0"
+					"brave\0"
+					"bread\0"
+					"breeze\0"
+					"brick\0"
+					"bridge\0"
+					"brief\0"
+					"bright\0"
+					"bring\0"
+					"brisk\0"
+					"broccoli\0"
+					"broken\0"
+					"bronze\0"
+					"broom\0"
+					"brother\0"
+					"brown\0"
+					"brush\0"
+					"bubble\0"
+					"buddy\0"
+					"budget\0"
+					"buffalo\0"
+					"build\0"
+					"bulb\0"
+					"bulk\0"
+					"bullet\0"
+					"bundle\0"
+					"bunker\0"
+					"burden\0"
+					"burger\0"
+					"burst\0"
+					"bus\0"
+					"business\0"
+					"busy\0"
+					"butter\0"
+					"buyer\0"
+					"buzz\0"
+					"cabbage\0"
+					"cabin\0"
+					"cable\0"
+					"cactus\0"
+					"cage\0"
+					"cake\0"
+					"call\0"
+					"calm\0"
+					"camera\0"
+					"camp\0"
+					"can\0"
+					"canal\0"
+					"cancel\0"
+					"candy\0"
+					"cannon\0"
+					"canoe\0"
+					"canvas\0"
+					"canyon\0"
+					"capable\0"
+					"capital\0"
+					"captain\0"
+					"car\0"
+					"carbon\0"
+					"card\0"
+					"cargo\0"
+					"carpet\0"
+					"carry\0"
+					"cart\0"
+					"case\0"
+					"cash\0"
+					"casino\0"
+					"castle\0"
+					"casual\0"
+					"cat\0"
+					"catalog\0"
+					"catch\0"
+					"category\0"
+					"cattle\0"
+					"caught\0"
+					"cause\0"
+					"caution\0"
+					"cave\0"
+					"ceiling\0"
+					"celery\0"
+					"cement\0"
+					"census\0"
+					"century\0"
+					"cereal\0"
+					"certain\0"
+					"chair\0"
+					"chalk\0"
+					"champion\0"
+					"change\0"
+					"chaos\0"
+					"chapter\0"
+					"charge\0"
+					"chase\0"
+					"chat\0"
+					"cheap\0"
+					"check\0"
+					"cheese\0"
+					"chef\0"
+					"cherry\0"
+					"chest\0"
+					"chicken\0"
+					"chief\0"
+					"child\0"
+					"chimney\0"
+					"choice\0"
+					"choose\0"
+					"chronic\0"
+					"chuckle\0"
+					"chunk\0"
+					"churn\0"
+					"cigar\0"
+					"cinnamon\0"
+					"circle\0"
+					"citizen\0"
+					"city\0"
+					"civil\0"
+					"claim\0"
+					"clap\0"
+					"clarify\0"
+					"claw\0"
+					"clay\0"
+					"clean\0"
+					"clerk\0"
+					"clever\0"
+					"click\0"
+					"client\0"
+					"cliff\0"
+					"climb\0"
+					"clinic\0"
+					"clip\0"
+					"clock\0"
+					"clog\0"
+					"close\0"
+					"cloth\0"
+					"cloud\0"
+					"clown\0"
+					"club\0"
+					"clump\0"
+					"cluster\0"
+					"clutch\0"
+					"coach\0"
+					"coast\0"
+					"coconut\0"
+					"code\0"
+					"coffee\0"
+					"coil\0"
+					"coin\0"
+					"collect\0"
+					"color\0"
+					"column\0"
+					"combine\0"
+					"come\0"
+					"comfort\0"
+					"comic\0"
+					"common\0"
+					"company\0"
+					"concert\0"
+					"conduct\0"
+					"confirm\0"
+					"congress\0"
+					"connect\0"
+					"consider\0"
+					"control\0"
+					"convince\0"
+					"cook\0"
+					"cool\0"
+					"copper\0"
+					"copy\0"
+					"coral\0"
+					"core\0"
+					"corn\0"
+					"correct\0"
+					"cost\0"
+					"cotton\0"
+					"couch\0"
+					"country\0"
+					"couple\0"
+					"course\0"
+					"cousin\0"
+					"cover\0"
+					"coyote\0"
+					"crack\0"
+					"cradle\0"
+					"craft\0"
+					"cram\0"
+					"crane\0"
+					"crash\0"
+					"crater\0"
+					"crawl\0"
+					"crazy\0"
+					"cream\0"
+					"credit\0"
+					"creek\0"
+					"crew\0"
+					"cricket\0"
+					"crime\0"
+					"crisp\0"
+					"critic\0"
+					"crop\0"
+					"cross\0"
+					"crouch\0"
+					"crowd\0"
+					"crucial\0"
+					"cruel\0"
+					"cruise\0"
+					"crumble\0"
+					"crunch\0"
+					"crush\0"
+					"cry\0"
+					"crystal\0"
+					"cube\0"
+					"culture\0"
+					"cup\0"
+					"cupboard\0"
+					"curious\0"
+					"current\0"
+					"curtain\0"
+					"curve\0"
+					"cushion\0"
+					"custom\0"
+					"cute\0"
+					"cycle\0"
+					"dad\0"
+					"damage\0"
+					"damp\0"
+					"dance\0"
+					"danger\0"
+					"daring\0"
+					"dash\0"
+					"daughter\0"
+					"dawn\0"
+					"day\0"
+					"deal\0"
+					"debate\0"
+					"debris\0"
+					"decade\0"
+					"december\0"
+					"decide\0"
+					"decline\0"
+					"decorate\0"
+					"decrease\0"
+					"deer\0"
+					"defense\0"
+					"define\0"
+					"defy\0"
+					"degree\0"
+					"delay\0"
+					"deliver\0"
+					"demand\0"
+					"demise\0"
+					"denial\0"
+					"dentist\0"
+					"deny\0"
+					"depart\0"
+					"depend\0"
+					"deposit\0"
+					"depth\0"
+					"deputy\0"
+					"derive\0"
+					"describe\0"
+					"desert\0"
+					"design\0"
+					"desk\0"
+					"despair\0"
+					"destroy\0"
+					"detail\0"
+					"detect\0"
+					"develop\0"
+					"device\0"
+					"devote\0"
+					"diagram\0"
+					"dial\0"
+					"diamond\0"
+					"diary\0"
+					"dice\0"
+					"diesel\0"
+					"diet\0"
+					"differ\0"
+					"digital\0"
+					"dignity\0"
+					"dilemma\0"
+					"dinner\0"
+					"dinosaur\0"
+					"direct\0"
+					"dirt\0"
+					"disagree\0"
+					"discover\0"
+					"disease\0"
+					"dish\0"
+					"dismiss\0"
+					"disorder\0"
+					"display\0"
+					"distance\0"
+					"divert\0"
+					"divide\0"
+					"divorce\0"
+					"dizzy\0"
+					"doctor\0"
+					"document\0"
+					"dog\0"
+					"doll\0"
+					"dolphin\0"
+					"domain\0"
+					"donate\0"
+					"donkey\0"
+					"donor\0"
+					"door\0"
+					"dose\0"
+					"double\0"
+					"dove\0"
+					"draft\0"
+					"dragon\0"
+					"drama\0"
+					"drastic\0"
+					"draw\0"
+					"dream\0"
+					"dress\0"
+					"drift\0"
+					"drill\0"
+					"drink\0"
+					"drip\0"
+					"drive\0"
+					"drop\0"
+					"drum\0"
+					"dry\0"
+					"duck\0"
+					"dumb\0"
+					"dune\0"
+					"during\0"
+					"dust\0"
+					"dutch\0"
+					"duty\0"
+					"dwarf\0"
+					"dynamic\0"
+					"eager\0"
+					"eagle\0"
+					"early\0"
+					"earn\0"
+					"earth\0"
+					"easily\0"
+					"east\0"
+					"easy\0"
+					"echo\0"
+					"ecology\0"
+					"economy\0"
+					"edge\0"
+					"edit\0"
+					"educate\0"
+					"effort\0"
+					"egg\0"
+					"eight\0"
+					"either\0"
+					"elbow\0"
+					"elder\0"
+					"electric\0"
+					"elegant\0"
+					"element\0"
+					"elephant\0"
+					"elevator\0"
+					"elite\0"
+					"else\0"
+					"embark\0"
+					"embody\0"
+					"embrace\0"
+					"emerge\0"
+					"emotion\0"
+					"employ\0"
+					"empower\0"
+					"empty\0"
+					"enable\0"
+					"enact\0"
+					"end\0"
+					"endless\0"
+					"endorse\0"
+					"enemy\0"
+					"energy\0"
+					"enforce\0"
+					"engage\0"
+					"engine\0"
+					"enhance\0"
+					"enjoy\0"
+					"enlist\0"
+					"enough\0"
+					"enrich\0"
+					"enroll\0"
+					"ensure\0"
+					"enter\0"
+					"entire\0"
+					"entry\0"
+					"envelope\0"
+					"episode\0"
+					"equal\0"
+					"equip\0"
+					"era\0"
+					"erase\0"
+					"erode\0"
+					"erosion\0"
+					"error\0"
+					"erupt\0"
+					"escape\0"
+					"essay\0"
+					"essence\0"
+					"estate\0"
+					"eternal\0"
+					"ethics\0"
+					"evidence\0"
+					"evil\0"
+					"evoke\0"
+					"evolve\0"
+					"exact\0"
+					"example\0"
+					"excess\0"
+					"exchange\0"
+					"excite\0"
+					"exclude\0"
+					"excuse\0"
+					"execute\0"
+					"exercise\0"
+					"exhaust\0"
+					"exhibit\0"
+					"exile\0"
+					"exist\0"
+					"exit\0"
+					"exotic\0"
+					"expand\0"
+					"expect\0"
+					"expire\0"
+					"explain\0"
+					"expose\0"
+					"express\0"
+					"extend\0"
+					"extra\0"
+					"eye\0"
+					"eyebrow\0"
+					"fabric\0"
+					"face\0"
+					"faculty\0"
+					"fade\0"
+					"faint\0"
+					"faith\0"
+					"fall\0"
+					"false\0"
+					"fame\0"
+					"family\0"
+					"famous\0"
+					"fan\0"
+					"fancy\0"
+					"fantasy\0"
+					"farm\0"
+					"fashion\0"
+					"fat\0"
+					"fatal\0"
+					"father\0"
+					"fatigue\0"
+					"fault\0"
+					"favorite\0"
+					"feature\0"
+					"february\0"
+					"federal\0"
+					"fee\0"
+					"feed\0"
+					"feel\0"
+					"female\0"
+					"fence\0"
+					"festival\0"
+					"fetch\0"
+					"fever\0"
+					"few\0"
+					"fiber\0"
+					"fiction\0"
+					"field\0"
+					"figure\0"
+					"file\0"
+					"film\0"
+					"filter\0"
+					"final\0"
+					"find\0"
+					"fine\0"
+					"finger\0"
+					"finish\0"
+					"fire\0"
+					"firm\0"
+					"first\0"
+					"fiscal\0"
+					"fish\0"
+					"fit\0"
+					"fitness\0"
+					"fix\0"
+					"flag\0"
+					"flame\0"
+					"flash\0"
+					"flat\0"
+					"flavor\0"
+					"flee\0"
+					"flight\0"
+					"flip\0"
+					"float\0"
+					"flock\0"
+					"floor\0"
+					"flower\0"
+					"fluid\0"
+					"flush\0"
+					"fly\0"
+					"foam\0"
+					"focus\0"
+					"fog\0"
+					"foil\0"
+					"fold\0"
+					"follow\0"
+					"food\0"
+					"foot\0"
+					"force\0"
+					"forest\0"
+					"forget\0"
+					"fork\0"
+					"fortune\0"
+					"forum\0"
+					"forward\0"
+					"fossil\0"
+					"foster\0"
+					"found\0"
+					"fox\0"
+					"fragile\0"
+					"frame\0"
+					"frequent\0"
+					"fresh\0"
+					"friend\0"
+					"fringe\0"
+					"frog\0"
+					"front\0"
+					"frost\0"
+					"frown\0"
+					"frozen\0"
+					"fruit\0"
+					"fuel\0"
+					"fun\0"
+					"funny\0"
+					"furnace\0"
+					"fury\0"
+					"future\0"
+					"gadget\0"
+					"gain\0"
+					"galaxy\0"
+					"gallery\0"
+					"game\0"
+					"gap\0"
+					"garage\0"
+					"garbage\0"
+					"garden\0"
+					"garlic\0"
+					"garment\0"
+					"gas\0"
+					"gasp\0"
+					"gate\0"
+					"gather\0"
+					"gauge\0"
+					"gaze\0"
+					"general\0"
+					"genius\0"
+					"genre\0"
+					"gentle\0"
+					"genuine\0"
+					"gesture\0"
+					"ghost\0"
+					"giant\0"
+					"gift\0"
+					"giggle\0"
+					"ginger\0"
+					"giraffe\0"
+					"girl\0"
+					"give\0"
+					"glad\0"
+					"glance\0"
+					"glare\0"
+					"glass\0"
+					"glide\0"
+					"glimpse\0"
+					"globe\0"
+					"gloom\0"
+					"glory\0"
+					"glove\0"
+					"glow\0"
+					"glue\0"
+					"goat\0"
+					"goddess\0"
+					"gold\0"
+					"good\0"
+					"goose\0"
+					"gorilla\0"
+					"gospel\0"
+					"gossip\0"
+					"govern\0"
+					"gown\0"
+					"grab\0"
+					"grace\0"
+					"grain\0"
+					"grant\0"
+					"grape\0"
+					"grass\0"
+					"gravity\0"
+					"great\0"
+					"green\0"
+					"grid\0"
+					"grief\0"
+					"grit\0"
+					"grocery\0"
+					"group\0"
+					"grow\0"
+					"grunt\0"
+					"guard\0"
+					"guess\0"
+					"guide\0"
+					"guilt\0"
+					"guitar\0"
+					"gun\0"
+					"gym\0"
+					"habit\0"
+					"hair\0"
+					"half\0"
+					"hammer\0"
+					"hamster\0"
+					"hand\0"
+					"happy\0"
+					"harbor\0"
+					"hard\0"
+					"harsh\0"
+					"harvest\0"
+					"hat\0"
+					"have\0"
+					"hawk\0"
+					"hazard\0"
+					"head\0"
+					"health\0"
+					"heart\0"
+					"heavy\0"
+					"hedgehog\0"
+					"height\0"
+					"hello\0"
+					"helmet\0"
+					"help\0"
+					"hen\0"
+					"hero\0"
+					"hidden\0"
+					"high\0"
+					"hill\0"
+					"hint\0"
+					"hip\0"
+					"hire\0"
+					"history\0"
+					"hobby\0"
+					"hockey\0"
+					"hold\0"
+					"hole\0"
+					"holiday\0"
+					"hollow\0"
+					"home\0"
+					"honey\0"
+					"hood\0"
+					"hope\0"
+					"horn\0"
+					"horror\0"
+					"horse\0"
+					"hospital\0"
+					"host\0"
+					"hotel\0"
+					"hour\0"
+					"hover\0"
+					"hub\0"
+					"huge\0"
+					"human\0"
+					"humble\0"
+					"humor\0"
+					"hundred\0"
+					"hungry\0"
+					"hunt\0"
+					"hurdle\0"
+					"hurry\0"
+					"hurt\0"
+					"husband\0"
+					"hybrid\0"
+					"ice\0"
+					"icon\0"
+					"idea\0"
+					"identify\0"
+					"idle\0"
+					"ignore\0"
+					"ill\0"
+					"illegal\0"
+					"illness\0"
+					"image\0"
+					"imitate\0"
+					"immense\0"
+					"immune\0"
+					"impact\0"
+					"impose\0"
+					"improve\0"
+					"impulse\0"
+					"inch\0"
+					"include\0"
+					"income\0"
+					"increase\0"
+					"index\0"
+					"indicate\0"
+					"indoor\0"
+					"industry\0"
+					"infant\0"
+					"inflict\0"
+					"inform\0"
+					"inhale\0"
+					"inherit\0"
+					"initial\0"
+					"inject\0"
+					"injury\0"
+					"inmate\0"
+					"inner\0"
+					"innocent\0"
+					"input\0"
+					"inquiry\0"
+					"insane\0"
+					"insect\0"
+					"inside\0"
+					"inspire\0"
+					"install\0"
+					"intact\0"
+					"interest\0"
+					"into\0"
+					"invest\0"
+					"invite\0"
+					"involve\0"
+					"iron\0"
+					"island\0"
+					"isolate\0"
+					"issue\0"
+					"item\0"
+					"ivory\0"
+					"jacket\0"
+					"jaguar\0"
+					"jar\0"
+					"jazz\0"
+					"jealous\0"
+					"jeans\0"
+					"jelly\0"
+					"jewel\0"
+					"job\0"
+					"join\0"
+					"joke\0"
+					"journey\0"
+					"joy\0"
+					"judge\0"
+					"juice\0"
+					"jump\0"
+					"jungle\0"
+					"junior\0"
+					"junk\0"
+					"just\0"
+					"kangaroo\0"
+					"keen\0"
+					"keep\0"
+					"ketchup\0"
+					"key\0"
+					"kick\0"
+					"kid\0"
+					"kidney\0"
+					"kind\0"
+					"kingdom\0"
+					"kiss\0"
+					"kit\0"
+					"kitchen\0"
+					"kite\0"
+					"kitten\0"
+					"kiwi\0"
+					"knee\0"
+					"knife\0"
+					"knock\0"
+					"know\0"
+					"lab\0"
+					"label\0"
+					"labor\0"
+					"ladder\0"
+					"lady\0"
+					"lake\0"
+					"lamp\0"
+					"language\0"
+					"laptop\0"
+					"large\0"
+					"later\0"
+					"latin\0"
+					"laugh\0"
+					"laundry\0"
+					"lava\0"
+					"law\0"
+					"lawn\0"
+					"lawsuit\0"
+					"layer\0"
+					"lazy\0"
+					"leader\0"
+					"leaf\0"
+					"learn\0"
+					"leave\0"
+					"lecture\0"
+					"left\0"
+					"leg\0"
+					"legal\0"
+					"legend\0"
+					"leisure\0"
+					"lemon\0"
+					"lend\0"
+					"length\0"
+					"lens\0"
+					"leopard\0"
+					"lesson\0"
+					"letter\0"
+					"level\0"
+					"liar\0"
+					"liberty\0"
+					"library\0"
+					"license\0"
+					"life\0"
+					"lift\0"
+					"light\0"
+					"like\0"
+					"limb\0"
+					"limit\0"
+					"link\0"
+					"lion\0"
+					"liquid\0"
+					"list\0"
+					"little\0"
+					"live\0"
+					"lizard\0"
+					"load\0"
+					"loan\0"
+					"lobster\0"
+					"local\0"
+					"lock\0"
+					"logic\0"
+					"lonely\0"
+					"long\0"
+					"loop\0"
+					"lottery\0"
+					"loud\0"
+					"lounge\0"
+					"love\0"
+					"loyal\0"
+					"lucky\0"
+					"luggage\0"
+					"lumber\0"
+					"lunar\0"
+					"lunch\0"
+					"luxury\0"
+					"lyrics\0"
+					"machine\0"
+					"mad\0"
+					"magic\0"
+					"magnet\0"
+					"maid\0"
+					"mail\0"
+					"main\0"
+					"major\0"
+					"make\0"
+					"mammal\0"
+					"man\0"
+					"manage\0"
+					"mandate\0"
+					"mango\0"
+					"mansion\0"
+					"manual\0"
+					"maple\0"
+					"marble\0"
+					"march\0"
+					"margin\0"
+					"marine\0"
+					"market\0"
+					"marriage\0"
+					"mask\0"
+					"mass\0"
+					"master\0"
+					"match\0"
+					"material\0"
+					"math\0"
+					"matrix\0"
+					"matter\0"
+					"maximum\0"
+					"maze\0"
+					"meadow\0"
+					"mean\0"
+					"measure\0"
+					"meat\0"
+					"mechanic\0"
+					"medal\0"
+					"media\0"
+					"melody\0"
+					"melt\0"
+					"member\0"
+					"memory\0"
+					"mention\0"
+					"menu\0"
+					"mercy\0"
+					"merge\0"
+					"merit\0"
+					"merry\0"
+					"mesh\0"
+					"message\0"
+					"metal\0"
+					"method\0"
+					"middle\0"
+					"midnight\0"
+					"milk\0"
+					"million\0"
+					"mimic\0"
+					"mind\0"
+					"minimum\0"
+					"minor\0"
+					"minute\0"
+					"miracle\0"
+					"mirror\0"
+					"misery\0"
+					"miss\0"
+					"mistake\0"
+					"mix\0"
+					"mixed\0"
+					"mixture\0"
+					"mobile\0"
+					"model\0"
+					"modify\0"
+					"mom\0"
+					"moment\0"
+					"monitor\0"
+					"monkey\0"
+					"monster\0"
+					"month\0"
+					"moon\0"
+					"moral\0"
+					"more\0"
+					"morning\0"
+					"mosquito\0"
+					"mother\0"
+					"motion\0"
+					"motor\0"
+					"mountain\0"
+					"mouse\0"
+					"move\0"
+					"movie\0"
+					"much\0"
+					"muffin\0"
+					"mule\0"
+					"multiply\0"
+					"muscle\0"
+					"museum\0"
+					"mushroom\0"
+					"music\0"
+					"must\0"
+					"mutual\0"
+					"myself\0"
+					"mystery\0"
+					"myth\0"
+					"naive\0"
+					"name\0"
+					"napkin\0"
+					"narrow\0"
+					"nasty\0"
+					"nation\0"
+					"nature\0"
+					"near\0"
+					"neck\0"
+					"need\0"
+					"negative\0"
+					"neglect\0"
+					"neither\0"
+					"nephew\0"
+					"nerve\0"
+					"nest\0"
+					"net\0"
+					"network\0"
+					"neutral\0"
+					"never\0"
+					"news\0"
+					"next\0"
+					"nice\0"
+					"night\0"
+					"noble\0"
+					"noise\0"
+					"nominee\0"
+					"noodle\0"
+					"normal\0"
+					"north\0"
+					"nose\0"
+					"notable\0"
+					"note\0"
+					"nothing\0"
+					"notice\0"
+					"novel\0"
+					"now\0"
+					"nuclear\0"
+					"number\0"
+					"nurse\0"
+					"nut\0"
+					"oak\0"
+					"obey\0"
+					"object\0"
+					"oblige\0"
+					"obscure\0"
+					"observe\0"
+					"obtain\0"
+					"obvious\0"
+					"occur\0"
+					"ocean\0"
+					"october\0"
+					"odor\0"
+					"off\0"
+					"offer\0"
+					"office\0"
+					"often\0"
+					"oil\0"
+					"okay\0"
+					"old\0"
+					"olive\0"
+					"olympic\0"
+					"omit\0"
+					"once\0"
+					"one\0"
+					"onion\0"
+					"online\0"
+					"only\0"
+					"open\0"
+					"opera\0"
+					"opinion\0"
+					"oppose\0"
+					"option\0"
+					"orange\0"
+					"orbit\0"
+					"orchard\0"
+					"order\0"
+					"ordinary\0"
+					"organ\0"
+					"orient\0"
+					"original\0"
+					"orphan\0"
+					"ostrich\0"
+					"other\0"
+					"outdoor\0"
+					"outer\0"
+					"output\0"
+					"outside\0"
+					"oval\0"
+					"oven\0"
+					"over\0"
+					"own\0"
+					"owner\0"
+					"oxygen\0"
+					"oyster\0"
+					"ozone\0"
+					"pact\0"
+					"paddle\0"
+					"page\0"
+					"pair\0"
+					"palace\0"
+					"palm\0"
+					"panda\0"
+					"panel\0"
+					"panic\0"
+					"panther\0"
+					"paper\0"
+					"parade\0"
+					"parent\0"
+					"park\0"
+					"parrot\0"
+					"party\0"
+					"pass\0"
+					"patch\0"
+					"path\0"
+					"patient\0"
+					"patrol\0"
+					"pattern\0"
+					"pause\0"
+					"pave\0"
+					"payment\0"
+					"peace\0"
+					"peanut\0"
+					"pear\0"
+					"peasant\0"
+					"pelican\0"
+					"pen\0"
+					"penalty\0"
+					"pencil\0"
+					"people\0"
+					"pepper\0"
+					"perfect\0"
+					"permit\0"
+					"person\0"
+					"pet\0"
+					"phone\0"
+					"photo\0"
+					"phrase\0"
+					"physical\0"
+					"piano\0"
+					"picnic\0"
+					"picture\0"
+					"piece\0"
+					"pig\0"
+					"pigeon\0"
+					"pill\0"
+					"pilot\0"
+					"pink\0"
+					"pioneer\0"
+					"pipe\0"
+					"pistol\0"
+					"pitch\0"
+					"pizza\0"
+					"place\0"
+					"planet\0"
+					"plastic\0"
+					"plate\0"
+					"play\0"
+					"please\0"
+					"pledge\0"
+					"pluck\0"
+					"plug\0"
+					"plunge\0"
+					"poem\0"
+					"poet\0"
+					"point\0"
+					"polar\0"
+					"pole\0"
+					"police\0"
+					"pond\0"
+					"pony\0"
+					"pool\0"
+					"popular\0"
+					"portion\0"
+					"position\0"
+					"possible\0"
+					"post\0"
+					"potato\0"
+					"pottery\0"
+					"poverty\0"
+					"powder\0"
+					"power\0"
+					"practice\0"
+					"praise\0"
+					"predict\0"
+					"prefer\0"
+					"prepare\0"
+					"present\0"
+					"pretty\0"
+					"prevent\0"
+					"price\0"
+					"pride\0"
+					"primary\0"
+					"print\0"
+					"priority\0"
+					"prison\0"
+					"private\0"
+					"prize\0"
+					"problem\0"
+					"process\0"
+					"produce\0"
+					"profit\0"
+					"program\0"
+					"project\0"
+					"promote\0"
+					"proof\0"
+					"property\0"
+					"prosper\0"
+					"protect\0"
+					"proud\0"
+					"provide\0"
+					"public\0"
+					"pudding\0"
+					"pull\0"
+					"pulp\0"
+					"pulse\0"
+					"pumpkin\0"
+					"punch\0"
+					"pupil\0"
+					"puppy\0"
+					"purchase\0"
+					"purity\0"
+					"purpose\0"
+					"purse\0"
+					"push\0"
+					"put\0"
+					"puzzle\0"
+					"pyramid\0"
+					"quality\0"
+					"quantum\0"
+					"quarter\0"
+					"question\0"
+					"quick\0"
+					"quit\0"
+					"quiz\0"
+					"quote\0"
+					"rabbit\0"
+					"raccoon\0"
+					"race\0"
+					"rack\0"
+					"radar\0"
+					"radio\0"
+					"rail\0"
+					"rain\0"
+					"raise\0"
+					"rally\0"
+					"ramp\0"
+					"ranch\0"
+					"random\0"
+					"range\0"
+					"rapid\0"
+					"rare\0"
+					"rate\0"
+					"rather\0"
+					"raven\0"
+					"raw\0"
+					"razor\0"
+					"ready\0"
+					"real\0"
+					"reason\0"
+					"rebel\0"
+					"rebuild\0"
+					"recall\0"
+					"receive\0"
+					"recipe\0"
+					"record\0"
+					"recycle\0"
+					"reduce\0"
+					"reflect\0"
+					"reform\0"
+					"refuse\0"
+					"region\0"
+					"regret\0"
+					"regular\0"
+					"reject\0"
+					"relax\0"
+					"release\0"
+					"relief\0"
+					"rely\0"
+					"remain\0"
+					"remember\0"
+					"remind\0"
+					"remove\0"
+					"render\0"
+					"renew\0"
+					"rent\0"
+					"reopen\0"
+					"repair\0"
+					"repeat\0"
+					"replace\0"
+					"report\0"
+					"require\0"
+					"rescue\0"
+					"resemble\0"
+					"resist\0"
+					"resource\0"
+					"response\0"
+					"result\0"
+					"retire\0"
+					"retreat\0"
+					"return\0"
+					"reunion\0"
+					"reveal\0"
+					"review\0"
+					"reward\0"
+					"rhythm\0"
+					"rib\0"
+					"ribbon\0"
+					"rice\0"
+					"rich\0"
+					"ride\0"
+					"ridge\0"
+					"rifle\0"
+					"right\0"
+					"rigid\0"
+					"ring\0"
+					"riot\0"
+					"ripple\0"
+					"risk\0"
+					"ritual\0"
+					"rival\0"
+					"river\0"
+					"road\0"
+					"roast\0"
+					"robot\0"
+					"robust\0"
+					"rocket\0"
+					"romance\0"
+					"roof\0"
+					"rookie\0"
+					"room\0"
+					"rose\0"
+					"rotate\0"
+					"rough\0"
+					"round\0"
+					"route\0"
+					"royal\0"
+					"rubber\0"
+					"rude\0"
+					"rug\0"
+					"rule\0"
+					"run\0"
+					"runway\0"
+					"rural\0"
+					"sad\0"
+					"saddle\0"
+					"sadness\0"
+					"safe\0"
+					"sail\0"
+					"salad\0"
+					"salmon\0"
+					"salon\0"
+					"salt\0"
+					"salute\0"
+					"same\0"
+					"sample\0"
+					"sand\0"
+					"satisfy\0"
+					"satoshi\0"
+					"sauce\0"
+					"sausage\0"
+					"save\0"
+					"say\0"
+					"scale\0"
+					"scan\0"
+					"scare\0"
+					"scatter\0"
+					"scene\0"
+					"scheme\0"
+					"school\0"
+					"science\0"
+					"scissors\0"
+					"scorpion\0"
+					"scout\0"
+					"scrap\0"
+					"screen\0"
+					"script\0"
+					"scrub\0"
+					"sea\0"
+					"search\0"
+					"season\0"
+					"seat\0"
+					"second\0"
+					"secret\0"
+					"section\0"
+					"security\0"
+					"seed\0"
+					"seek\0"
+					"segment\0"
+					"select\0"
+					"sell\0"
+					"seminar\0"
+					"senior\0"
+					"sense\0"
+					"sentence\0"
+					"series\0"
+					"service\0"
+					"session\0"
+					"settle\0"
+					"setup\0"
+					"seven\0"
+					"shadow\0"
+					"shaft\0"
+					"shallow\0"
+					"share\0"
+					"shed\0"
+					"shell\0"
+					"sheriff\0"
+					"shield\0"
+					"shift\0"
+					"shine\0"
+					"ship\0"
+					"shiver\0"
+					"shock\0"
+					"shoe\0"
+					"shoot\0"
+					"shop\0"
+					"short\0"
+					"shoulder\0"
+					"shove\0"
+					"shrimp\0"
+					"shrug\0"
+					"shuffle\0"
+					"shy\0"
+					"sibling\0"
+					"sick\0"
+					"side\0"
+					"siege\0"
+					"sight\0"
+					"sign\0"
+					"silent\0"
+					"silk\0"
+					"silly\0"
+					"silver\0"
+					"similar\0"
+					"simple\0"
+					"since\0"
+					"sing\0"
+					"siren\0"
+					"sister\0"
+					"situate\0"
+					"six\0"
+					"size\0"
+					"skate\0"
+					"sketch\0"
+					"ski\0"
+					"skill\0"
+					"skin\0"
+					"skirt\0"
+					"skull\0"
+					"slab\0"
+					"slam\0"
+					"sleep\0"
+					"slender\0"
+					"slice\0"
+					"slide\0"
+					"slight\0"
+					"slim\0"
+					"slogan\0"
+					"slot\0"
+					"slow\0"
+					"slush\0"
+					"small\0"
+					"smart\0"
+					"smile\0"
+					"smoke\0"
+					"smooth\0"
+					"snack\0"
+					"snake\0"
+					"snap\0"
+					"sniff\0"
+					"snow\0"
+					"soap\0"
+					"soccer\0"
+					"social\0"
+					"sock\0"
+					"soda\0"
+					"soft\0"
+					"solar\0"
+					"soldier\0"
+					"solid\0"
+					"solution\0"
+					"solve\0"
+					"someone\0"
+					"song\0"
+					"soon\0"
+					"sorry\0"
+					"sort\0"
+					"soul\0"
+					"sound\0"
+					"soup\0"
+					"source\0"
+					"south\0"
+					"space\0"
+					"spare\0"
+					"spatial\0"
+					"spawn\0"
+					"speak\0"
+					"special\0"
+					"speed\0"
+					"spell\0"
+					"spend\0"
+					"sphere\0"
+					"spice\0"
+					"spider\0"
+					"spike\0"
+					"spin\0"
+					"spirit\0"
+					"split\0"
+					"spoil\0"
+					"sponsor\0"
+					"spoon\0"
+					"sport\0"
+					"spot\0"
+					"spray\0"
+					"spread\0"
+					"spring\0"
+					"spy\0"
+					"square\0"
+					"squeeze\0"
+					"squirrel\0"
+					"stable\0"
+					"stadium\0"
+					"staff\0"
+					"stage\0"
+					"stairs\0"
+					"stamp\0"
+					"stand\0"
+					"start\0"
+					"state\0"
+					"stay\0"
+					"steak\0"
+					"steel\0"
+					"stem\0"
+					"step\0"
+					"stereo\0"
+					"stick\0"
+					"still\0"
+					"sting\0"
+					"stock\0"
+					"stomach\0"
+					"stone\0"
+					"stool\0"
+					"story\0"
+					"stove\0"
+					"strategy\0"
+					"street\0"
+					"strike\0"
+					"strong\0"
+					"struggle\0"
+					"student\0"
+					"stuff\0"
+					"stumble\0"
+					"style\0"
+					"subject\0"
+					"submit\0"
+					"subway\0"
+					"success\0"
+					"such\0"
+					"sudden\0"
+					"suffer\0"
+					"sugar\0"
+					"suggest\0"
+					"suit\0"
+					"summer\0"
+					"sun\0"
+					"sunny\0"
+					"sunset\0"
+					"super\0"
+					"supply\0"
+					"supreme\0"
+					"sure\0"
+					"surface\0"
+					"surge\0"
+					"surprise\0"
+					"surround\0"
+					"survey\0"
+					"suspect\0"
+					"sustain\0"
+					"swallow\0"
+					"swamp\0"
+					"swap\0"
+					"swarm\0"
+					"swear\0"
+					"sweet\0"
+					"swift\0"
+					"swim\0"
+					"swing\0"
+					"switch\0"
+					"sword\0"
+					"symbol\0"
+					"symptom\0"
+					"syrup\0"
+					"system\0"
+					"table\0"
+					"tackle\0"
+					"tag\0"
+					"tail\0"
+					"talent\0"
+					"talk\0"
+					"tank\0"
+					"tape\0"
+					"target\0"
+					"task\0"
+					"taste\0"
+					"tattoo\0"
+					"taxi\0"
+					"teach\0"
+					"team\0"
+					"tell\0"
+					"ten\0"
+					"tenant\0"
+					"tennis\0"
+					"tent\0"
+					"term\0"
+					"test\0"
+					"text\0"
+					"thank\0"
+					"that\0"
+					"theme\0"
+					"then\0"
+					"theory\0"
+					"there\0"
+					"they\0"
+					"thing\0"
+					"this\0"
+					"thought\0"
+					"three\0"
+					"thrive\0"
+					"throw\0"
+					"thumb\0"
+					"thunder\0"
+					"ticket\0"
+					"tide\0"
+					"tiger\0"
+					"tilt\0"
+					"timber\0"
+					"time\0"
+					"tiny\0"
+					"tip\0"
+					"tired\0"
+					"tissue\0"
+					"title\0"
+					"toast\0"
+					"tobacco\0"
+					"today\0"
+					"toddler\0"
+					"toe\0"
+					"together\0"
+					"toilet\0"
+					"token\0"
+					"tomato\0"
+					"tomorrow\0"
+					"tone\0"
+					"tongue\0"
+					"tonight\0"
+					"tool\0"
+					"tooth\0"
+					"top\0"
+					"topic\0"
+					"topple\0"
+					"torch\0"
+					"tornado\0"
+					"tortoise\0"
+					"toss\0"
+					"total\0"
+					"tourist\0"
+					"toward\0"
+					"tower\0"
+					"town\0"
+					"toy\0"
+					"track\0"
+					"trade\0"
+					"traffic\0"
+					"tragic\0"
+					"train\0"
+					"transfer\0"
+					"trap\0"
+					"trash\0"
+					"travel\0"
+					"tray\0"
+					"treat\0"
+					"tree\0"
+					"trend\0"
+					"trial\0"
+					"tribe\0"
+					"trick\0"
+					"trigger\0"
+					"trim\0"
+					"trip\0"
+					"trophy\0"
+					"trouble\0"
+					"truck\0"
+					"true\0"
+					"truly\0"
+					"trumpet\0"
+					"trust\0"
+					"truth\0"
+					"try\0"
+					"tube\0"
+					"tuition\0"
+					"tumble\0"
+					"tuna\0"
+					"tunnel\0"
+					"turkey\0"
+					"turn\0"
+					"turtle\0"
+					"twelve\0"
+					"twenty\0"
+					"twice\0"
+					"twin\0"
+					"twist\0"
+					"two\0"
+					"type\0"
+					"typical\0"
+					"ugly\0"
+					"umbrella\0"
+					"unable\0"
+					"unaware\0"
+					"uncle\0"
+					"uncover\0"
+					"under\0"
+					"undo\0"
+					"unfair\0"
+					"unfold\0"
+					"unhappy\0"
+					"uniform\0"
+					"unique\0"
+					"unit\0"
+					"universe\0"
+					"unknown\0"
+					"unlock\0"
+					"until\0"
+					"unusual\0"
+					"unveil\0"
+					"update\0"
+					"upgrade\0"
+					"uphold\0"
+					"upon\0"
+					"upper\0"
+					"upset\0"
+					"urban\0"
+					"urge\0"
+					"usage\0"
+					"use\0"
+					"used\0"
+					"useful\0"
+					"useless\0"
+					"usual\0"
+					"utility\0"
+					"vacant\0"
+					"vacuum\0"
+					"vague\0"
+					"valid\0"
+					"valley\0"
+					"valve\0"
+					"van\0"
+					"vanish\0"
+					"vapor\0"
+					"various\0"
+					"vast\0"
+					"vault\0"
+					"vehicle\0"
+					"velvet\0"
+					"vendor\0"
+					"venture\0"
+					"venue\0"
+					"verb\0"
+					"verify\0"
+					"version\0"
+					"very\0"
+					"vessel\0"
+					"veteran\0"
+					"viable\0"
+					"vibrant\0"
+					"vicious\0"
+					"victory\0"
+					"video\0"
+					"view\0"
+					"village\0"
+					"vintage\0"
+					"violin\0"
+					"virtual\0"
+					"virus\0"
+					"visa\0"
+					"visit\0"
+					"visual\0"
+					"vital\0"
+					"vivid\0"
+					"vocal\0"
+					"voice\0"
+					"void\0"
+					"volcano\0"
+					"volume\0"
+					"vote\0"
+					"voyage\0"
+					"wage\0"
+					"wagon\0"
+					"wait\0"
+					"walk\0"
+					"wall\0"
+					"walnut\0"
+					"want\0"
+					"warfare\0"
+					"warm\0"
+					"warrior\0"
+					"wash\0"
+					"wasp\0"
+					"waste\0"
+					"water\0"
+					"wave\0"
+					"way\0"
+					"wealth\0"
+					"weapon\0"
+					"wear\0"
+					"weasel\0"
+					"weather\0"
+					"web\0"
+					"wedding\0"
+					"weekend\0"
+					"weird\0"
+					"welcome\0"
+					"west\0"
+					"wet\0"
+					"whale\0"
+					"what\0"
+					"wheat\0"
+					"wheel\0"
+					"when\0"
+					"where\0"
+					"whip\0"
+					"whisper\0"
+					"wide\0"
+					"width\0"
+					"wife\0"
+					"wild\0"
+					"will\0"
+					"win\0"
+					"window\0"
+					"wine\0"
+					"wing\0"
+					"wink\0"
+					"winner\0"
+					"winter\0"
+					"wire\0"
+					"wisdom\0"
+					"wise\0"
+					"wish\0"
+					"witness\0"
+					"wolf\0"
+					"woman\0"
+					"wonder\0"
+					"wood\0"
+					"wool\0"
+					"word\0"
+					"work\0"
+					"world\0"
+					"worry\0"
+					"worth\0"
+					"wrap\0"
+					"wreck\0"
+					"wrestle\0"
+					"wrist\0"
+					"write\0"
+					"wrong\0"
+					"yard\0"
+					"year\0"
+					"yellow\0"
+					"you\0"
+					"young\0"
+					"youth\0"
+					"zebra\0"
+					"zero\0"
+					"zone\0"
+					"zoo\0";
+
+			constexpr uint16_t BIP39OffsetsEnglish[BIP39_WORDLIST_COUNT] = {
+					0, 8, 16, 21, 27, 33, 40, 47, 56, 63, 69, 76,
+					85, 93, 100, 108, 113, 122, 130, 137, 141, 148, 154, 162,
+					169, 175, 179, 186, 194, 201, 207, 213, 221, 228, 236, 243,
+					250, 257, 263, 267, 273, 279, 285, 289, 293, 301, 307, 313,
+					319, 327, 333, 339, 343, 349, 355, 362, 368, 374, 382, 387,
+					393, 400, 408, 416, 422, 429, 436, 444, 451, 459, 465, 471,
+					477, 484, 490, 499, 506, 514, 521, 529, 537, 545, 549, 555,
+					563, 570, 576, 584, 590, 595, 602, 607, 613, 619, 623, 629,
+					635, 640, 647, 655, 662, 669, 675, 679, 688, 695, 703, 707,
+					714, 722, 728, 735, 742, 749, 757, 762, 769, 776, 785, 793,
+					801, 807, 814, 819, 826, 831, 838, 846, 854, 860, 866, 872,
+					877, 885, 891, 899, 904, 909, 918, 924, 930, 934, 942, 950,
+					955, 962, 969, 976, 980, 987, 995, 1002, 1007, 1013, 1020, 1027,
+					1033, 1038, 1045, 1053, 1060, 1065, 1072, 1078, 1085, 1092, 1100, 1106,
+					1111, 1117, 1125, 1130, 1137, 1144, 1152, 1159, 1167, 1171, 1176, 1181,
+					1189, 1194, 1200, 1207, 1213, 1219, 1225, 1233, 1239, 1245, 1251, 1257,
+					1263, 1271, 1278, 1283, 1288, 1294, 1300, 1305, 1310, 1315, 1320, 1325,
+					1331, 1336, 1342, 1349, 1356, 1363, 1368, 1375, 1382, 1386, 1390, 1398,
+					1404, 1410, 1416, 1422, 1428, 1435, 1441, 1448, 1454, 1461, 1467, 1473,
+					1482, 1489, 1496, 1502, 1510, 1516, 1522, 1529, 1535, 1542, 1550, 1556,
+					1561, 1566, 1573, 1580, 1587, 1594, 1601, 1607, 1611, 1620, 1625, 1632,
+					1638, 1643, 1651, 1657, 1663, 1670, 1675, 1680, 1685, 1690, 1697, 1702,
+					1706, 1712, 1719, 1725, 1732, 1738, 1745, 1752, 1760, 1768, 1776, 1780,
+					1787, 1792, 1798, 1805, 1811, 1816, 1821, 1826, 1833, 1840, 1847, 1851,
+					1859, 1865, 1874, 1881, 1888, 1894, 1902, 1907, 1915, 1922, 1929, 1936,
+					1944, 1951, 1959, 1965, 1971, 1980, 1987, 1993, 2001, 2008, 2014, 2019,
+					2025, 2031, 2038, 2043, 2050, 2056, 2064, 2070, 2076, 2084, 2091, 2098,
+					2106, 2114, 2120, 2126, 2132, 2141, 2148, 2156, 2161, 2167, 2173, 2178,
+					2186, 2191, 2196, 2202, 2208, 2215, 2221, 2228, 2234, 2240, 2247, 2252,
+					2258, 2263, 2269, 2275, 2281, 2287, 2292, 2298, 2306, 2313, 2319, 2325,
+					2333, 2338, 2345, 2350, 2355, 2363, 2369, 2376, 2384, 2389, 2397, 2403,
+					2410, 2418, 2426, 2434, 2442, 2451, 2459, 2468, 2476, 2485, 2490, 2495,
+					2502, 2507, 2513, 2518, 2523, 2531, 2536, 2543, 2549, 2557, 2564, 2571,
+					2578, 2584, 2591, 2597, 2604, 2610, 2615, 2621, 2627, 2634, 2640, 2646,
+					2652, 2659, 2665, 2670, 2678, 2684, 2690, 2697, 2702, 2708, 2715, 2721,
+					2729, 2735, 2742, 2750, 2757, 2763, 2767, 2775, 2780, 2788, 2792, 2801,
+					2809, 2817, 2825, 2831, 2839, 2846, 2851, 2857, 2861, 2868, 2873, 2879,
+					2886, 2893, 2898, 2907, 2912, 2916, 2921, 2928, 2935, 2942, 2951, 2958,
+					2966, 2975, 2984, 2989, 2997, 3004, 3009, 3016, 3022, 3030, 3037, 3044,
+					3051, 3059, 3064, 3071, 3078, 3086, 3092, 3099, 3106, 3115, 3122, 3129,
+					3134, 3142, 3150, 3157, 3164, 3172, 3179, 3186, 3194, 3199, 3207, 3213,
+					3218, 3225, 3230, 3237, 3245, 3253, 3261, 3268, 3277, 3284, 3289, 3298,
+					3307, 3315, 3320, 3328, 3337, 3345, 3354, 3361, 3368, 3376, 3382, 3389,
+					3398, 3402, 3407, 3415, 3422, 3429, 3436, 3442, 3447, 3452, 3459, 3464,
+					3470, 3477, 3483, 3491, 3496, 3502, 3508, 3514, 3520, 3526, 3531, 3537,
+					3542, 3547, 3551, 3556, 3561, 3566, 3573, 3578, 3584, 3589, 3595, 3603,
+					3609, 3615, 3621, 3626, 3632, 3639, 3644, 3649, 3654, 3662, 3670, 3675,
+					3680, 3688, 3695, 3699, 3705, 3712, 3718, 3724, 3733, 3741, 3749, 3758,
+					3767, 3773, 3778, 3785, 3792, 3800, 3807, 3815, 3822, 3830, 3836, 3843,
+					3849, 3853, 3861, 3869, 3875, 3882, 3890, 3897, 3904, 3912, 3918, 3925,
+					3932, 3939, 3946, 3953, 3959, 3966, 3972, 3981, 3989, 3995, 4001, 4005,
+					4011, 4017, 4025, 4031, 4037, 4044, 4050, 4058, 4065, 4073, 4080, 4089,
+					4094, 4100, 4107, 4113, 4121, 4128, 4137, 4144, 4152, 4159, 4167, 4176,
+					4184, 4192, 4198, 4204, 4209, 4216, 4223, 4230, 4237, 4245, 4252, 4260,
+					4267, 4273, 4277, 4285, 4292, 4297, 4305, 4310, 4316, 4322, 4327, 4333,
+					4338, 4345, 4352, 4356, 4362, 4370, 4375, 4383, 4387, 4393, 4400, 4408,
+					4414, 4423, 4431, 4440, 4448, 4452, 4457, 4462, 4469, 4475, 4484, 4490,
+					4496, 4500, 4506, 4514, 4520, 4527, 4532, 4537, 4544, 4550, 4555, 4560,
+					4567, 4574, 4579, 4584, 4590, 4597, 4602, 4606, 4614, 4618, 4623, 4629,
+					4635, 4640, 4647, 4652, 4659, 4664, 4670, 4676, 4682, 4689, 4695, 4701,
+					4705, 4710, 4716, 4720, 4725, 4730, 4737, 4742, 4747, 4753, 4760, 4767,
+					4772, 4780, 4786, 4794, 4801, 4808, 4814, 4818, 4826, 4832, 4841, 4847,
+					4854, 4861, 4866, 4872, 4878, 4884, 4891, 4897, 4902, 4906, 4912, 4920,
+					4925, 4932, 4939, 4944, 4951, 4959, 4964, 4968, 4975, 4983, 4990, 4997,
+					5005, 5009, 5014, 5019, 5026, 5032, 5037, 5045, 5052, 5058, 5065, 5073,
+					5081, 5087, 5093, 5098, 5105, 5112, 5120, 5125, 5130, 5135, 5142, 5148,
+					5154, 5160, 5168, 5174, 5180, 5186, 5192, 5197, 5202, 5207, 5215, 5220,
+					5225, 5231, 5239, 5246, 5253, 5260, 5265, 5270, 5276, 5282, 5288, 5294,
+					5300, 5308, 5314, 5320, 5325, 5331, 5336, 5344, 5350, 5355, 5361, 5367,
+					5373, 5379, 5385, 5392, 5396, 5400, 5406, 5411, 5416, 5423, 5431, 5436,
+					5442, 5449, 5454, 5460, 5468, 5472, 5477, 5482, 5489, 5494, 5501, 5507,
+					5513, 5522, 5529, 5535, 5542, 5547, 5551, 5556, 5563, 5568, 5573, 5578,
+					5582, 5587, 5595, 5601, 5608, 5613, 5618, 5626, 5633, 5638, 5644, 5649,
+					5654, 5659, 5666, 5672, 5681, 5686, 5692, 5697, 5703, 5707, 5712, 5718,
+					5725, 5731, 5739, 5746, 5751, 5758, 5764, 5769, 5777, 5784, 5788, 5793,
+					5798, 5807, 5812, 5819, 5823, 5831, 5839, 5845, 5853, 5861, 5868, 5875,
+					5882, 5890, 5898, 5903, 5911, 5918, 5927, 5933, 5942, 5949, 5958, 5965,
+					5973, 5980, 5987, 5995, 6003, 6010, 6017, 6024, 6030, 6039, 6045, 6053,
+					6060, 6067, 6074, 6082, 6090, 6097, 6106, 6111, 6118, 6125, 6133, 6138,
+					6145, 6153, 6159, 6164, 6170, 6177, 6184, 6188, 6193, 6201, 6207, 6213,
+					6219, 6223, 6228, 6233, 6241, 6245, 6251, 6257, 6262, 6269, 6276, 6281,
+					6286, 6295, 6300, 6305, 6313, 6317, 6322, 6326, 6333, 6338, 6346, 6351,
+					6355, 6363, 6368, 6375, 6380, 6385, 6391, 6397, 6402, 6406, 6412, 6418,
+					6425, 6430, 6435, 6440, 6449, 6456, 6462, 6468, 6474, 6480, 6488, 6493,
+					6497, 6502, 6510, 6516, 6521, 6528, 6533, 6539, 6545, 6553, 6558, 6562,
+					6568, 6575, 6583, 6589, 6594, 6601, 6606, 6614, 6621, 6628, 6634, 6639,
+					6647, 6655, 6663, 6668, 6673, 6679, 6684, 6689, 6695, 6700, 6705, 6712,
+					6717, 6724, 6729, 6736, 6741, 6746, 6754, 6760, 6765, 6771, 6778, 6783,
+					6788, 6796, 6801, 6808, 6813, 6819, 6825, 6833, 6840, 6846, 6852, 6859,
+					6866, 6874, 6878, 6884, 6891, 6896, 6901, 6906, 6912, 6917, 6924, 6928,
+					6935, 6943, 6949, 6957, 6964, 6970, 6977, 6983, 6990, 6997, 7004, 7013,
+					7018, 7023, 7030, 7036, 7045, 7050, 7057, 7064, 7072, 7077, 7084, 7089,
+					7097, 7102, 7111, 7117, 7123, 7130, 7135, 7142, 7149, 7157, 7162, 7168,
+					7174, 7180, 7186, 7191, 7199, 7205, 7212, 7219, 7228, 7233, 7241, 7247,
+					7252, 7260, 7266, 7273, 7281, 7288, 7295, 7300, 7308, 7312, 7318, 7326,
+					7333, 7339, 7346, 7350, 7357, 7365, 7372, 7380, 7386, 7391, 7397, 7402,
+					7410, 7419, 7426, 7433, 7439, 7448, 7454, 7459, 7465, 7470, 7477, 7482,
+					7491, 7498, 7505, 7514, 7520, 7525, 7532, 7539, 7547, 7552, 7558, 7563,
+					7570, 7577, 7583, 7590, 7597, 7602, 7607, 7612, 7621, 7629, 7637, 7644,
+					7650, 7655, 7659, 7667, 7675, 7681, 7686, 7691, 7696, 7702, 7708, 7714,
+					7722, 7729, 7736, 7742, 7747, 7755, 7760, 7768, 7775, 7781, 7785, 7793,
+					7800, 7806, 7810, 7814, 7819, 7826, 7833, 7841, 7849, 7856, 7864, 7870,
+					7876, 7884, 7889, 7893, 7899, 7906, 7912, 7916, 7921, 7925, 7931, 7939,
+					7944, 7949, 7953, 7959, 7966, 7971, 7976, 7982, 7990, 7997, 8004, 8011,
+					8017, 8025, 8031, 8040, 8046, 8053, 8062, 8069, 8077, 8083, 8091, 8097,
+					8104, 8112, 8117, 8122, 8127, 8131, 8137, 8144, 8151, 8157, 8162, 8169,
+					8174, 8179, 8186, 8191, 8197, 8203, 8209, 8217, 8223, 8230, 8237, 8242,
+					8249, 8255, 8260, 8266, 8271, 8279, 8286, 8294, 8300, 8305, 8313, 8319,
+					8326, 8331, 8339, 8347, 8351, 8359, 8366, 8373, 8380, 8388, 8395, 8402,
+					8406, 8412, 8418, 8425, 8434, 8440, 8447, 8455, 8461, 8465, 8472, 8477,
+					8483, 8488, 8496, 8501, 8508, 8514, 8520, 8526, 8533, 8541, 8547, 8552,
+					8559, 8566, 8572, 8577, 8584, 8589, 8594, 8600, 8606, 8611, 8618, 8623,
+					8628, 8633, 8641, 8649, 8658, 8667, 8672, 8679, 8687, 8695, 8702, 8708,
+					8717, 8724, 8732, 8739, 8747, 8755, 8762, 8770, 8776, 8782, 8790, 8796,
+					8805, 8812, 8820, 8826, 8834, 8842, 8850, 8857, 8865, 8873, 8881, 8887,
+					8896, 8904, 8912, 8918, 8926, 8933, 8941, 8946, 8951, 8957, 8965, 8971,
+					8977, 8983, 8992, 8999, 9007, 9013, 9018, 9022, 9029, 9037, 9045, 9053,
+					9061, 9070, 9076, 9081, 9086, 9092, 9099, 9107, 9112, 9117, 9123, 9129,
+					9134, 9139, 9145, 9151, 9156, 9162, 9169, 9175, 9181, 9186, 9191, 9198,
+					9204, 9208, 9214, 9220, 9225, 9232, 9238, 9246, 9253, 9261, 9268, 9275,
+					9283, 9290, 9298, 9305, 9312, 9319, 9326, 9334, 9341, 9347, 9355, 9362,
+					9367, 9374, 9383, 9390, 9397, 9404, 9410, 9415, 9422, 9429, 9436, 9444,
+					9451, 9459, 9466, 9475, 9482, 9491, 9500, 9507, 9514, 9522, 9529, 9537,
+					9544, 9551, 9558, 9565, 9569, 9576, 9581, 9586, 9591, 9597, 9603, 9609,
+					9615, 9620, 9625, 9632, 9637, 9644, 9650, 9656, 9661, 9667, 9673, 9680,
+					9687, 9695, 9700, 9707, 9712, 9717, 9724, 9730, 9736, 9742, 9748, 9755,
+					9760, 9764, 9769, 9773, 9780, 9786, 9790, 9797, 9805, 9810, 9815, 9821,
+					9828, 9834, 9839, 9846, 9851, 9858, 9863, 9871, 9879, 9885, 9893, 9898,
+					9902, 9908, 9913, 9919, 9927, 9933, 9940, 9947, 9955, 9964, 9973, 9979,
+					9985, 9992, 9999, 10005, 10009, 10016, 10023, 10028, 10035, 10042, 10050, 10059,
+					10064, 10069, 10077, 10084, 10089, 10097, 10104, 10110, 10119, 10126, 10134, 10142,
+					10149, 10155, 10161, 10168, 10174, 10182, 10188, 10193, 10199, 10207, 10214, 10220,
+					10226, 10231, 10238, 10244, 10249, 10255, 10260, 10266, 10275, 10281, 10288, 10294,
+					10302, 10306, 10314, 10319, 10324, 10330, 10336, 10341, 10348, 10353, 10359, 10366,
+					10374, 10381, 10387, 10392, 10398, 10405, 10413, 10417, 10422, 10428, 10435, 10439,
+					10445, 10450, 10456, 10462, 10467, 10472, 10478, 10486, 10492, 10498, 10505, 10510,
+					10517, 10522, 10527, 10533, 10539, 10545, 10551, 10557, 10564, 10570, 10576, 10581,
+					10587, 10592, 10597, 10604, 10611, 10616, 10621, 10626, 10632, 10640, 10646, 10655,
+					10661, 10669, 10674, 10679, 10685, 10690, 10695, 10701, 10706, 10713, 10719, 10725,
+					10731, 10739, 10745, 10751, 10759, 10765, 10771, 10777, 10784, 10790, 10797, 10803,
+					10808, 10815, 10821, 10827, 10835, 10841, 10847, 10852, 10858, 10865, 10872, 10876,
+					10883, 10891, 10900, 10907, 10915, 10921, 10927, 10934, 10940, 10946, 10952, 10958,
+					10963, 10969, 10975, 10980, 10985, 10992, 10998, 11004, 11010, 11016, 11024, 11030,
+					11036, 11042, 11048, 11057, 11064, 11071, 11078, 11087, 11095, 11101, 11109, 11115,
+					11123, 11130, 11137, 11145, 11150, 11157, 11164, 11170, 11178, 11183, 11190, 11194,
+					11200, 11207, 11213, 11220, 11228, 11233, 11241, 11247, 11256, 11265, 11272, 11280,
+					11288, 11296, 11302, 11307, 11313, 11319, 11325, 11331, 11336, 11342, 11349, 11355,
+					11362, 11370, 11376, 11383, 11389, 11396, 11400, 11405, 11412, 11417, 11422, 11427,
+					11434, 11439, 11445, 11452, 11457, 11463, 11468, 11473, 11477, 11484, 11491, 11496,
+					11501, 11506, 11511, 11517, 11522, 11528, 11533, 11540, 11546, 11551, 11557, 11562,
+					11570, 11576, 11583, 11589, 11595, 11603, 11610, 11615, 11621, 11626, 11633, 11638,
+					11643, 11647, 11653, 11660, 11666, 11672, 11680, 11686, 11694, 11698, 11707, 11714,
+					11720, 11727, 11736, 11741, 11748, 11756, 11761, 11767, 11771, 11777, 11784, 11790,
+					11798, 11807, 11812, 11818, 11826, 11833, 11839, 11844, 11848, 11854, 11860, 11868,
+					11875, 11881, 11890, 11895, 11901, 11908, 11913, 11919, 11924, 11930, 11936, 11942,
+					11948, 11956, 11961, 11966, 11973, 11981, 11987, 11992, 11998, 12006, 12012, 12018,
+					12022, 12027, 12035, 12042, 12047, 12054, 12061, 12066, 12073, 12080, 12087, 12093,
+					12098, 12104, 12108, 12113, 12121, 12126, 12135, 12142, 12150, 12156, 12164, 12170,
+					12175, 12182, 12189, 12197, 12205, 12212, 12217, 12226, 12234, 12241, 12247, 12255,
+					12262, 12269, 12277, 12284, 12289, 12295, 12301, 12307, 12312, 12318, 12322, 12327,
+					12334, 12342, 12348, 12356, 12363, 12370, 12376, 12382, 12389, 12395, 12399, 12406,
+					12412, 12420, 12425, 12431, 12439, 12446, 12453, 12461, 12467, 12472, 12479, 12487,
+					12492, 12499, 12507, 12514, 12522, 12530, 12538, 12544, 12549, 12557, 12565, 12572,
+					12580, 12586, 12591, 12597, 12604, 12610, 12616, 12622, 12628, 12633, 12641, 12648,
+					12653, 12660, 12665, 12671, 12676, 12681, 12686, 12693, 12698, 12706, 12711, 12719,
+					12724, 12729, 12735, 12741, 12746, 12750, 12757, 12764, 12769, 12776, 12784, 12788,
+					12796, 12804, 12810, 12818, 12823, 12827, 12833, 12838, 12844, 12850, 12855, 12861,
+					12866, 12874, 12879, 12885, 12890, 12895, 12900, 12904, 12911, 12916, 12921, 12926,
+					12933, 12940, 12945, 12952, 12957, 12962, 12970, 12975, 12981, 12988, 12993, 12998,
+					13003, 13008, 13014, 13020, 13026, 13031, 13037, 13045, 13051, 13057, 13063, 13068,
+					13073, 13080, 13084, 13090, 13096, 13102, 13107, 13112,
+			};
+
+			constexpr char BIP39PoolChinese[] =
+					"的\0"
+					"一\0"
+					"是\0"
+					"在\0"
+					"不\0"
+					"了\0"
+					"有\0"
+					"和\0"
+					"人\0"
+					"这\0"
+					"中\0"
+					"大\0"
+					"为\0"
+					"上\0"
+					"个\0"
+					"国\0"
+					"我\0"
+					"以\0"
+					"要\0"
+					"他\0"
+					"时\0"
+					"来\0"
+					"用\0"
+					"们\0"
+					"生\0"
+					"到\0"
+					"作\0"
+					"地\0"
+					"于\0"
+					"出\0"
+					"就\0"
+					"分\0"
+					"对\0"
+					"成\0"
+					"会\0"
+					"可\0"
+					"主\0"
+					"发\0"
+					"年\0"
+					"动\0"
+					"同\0"
+					"工\0"
+					"也\0"
+					"能\0"
+					"下\0"
+					"过\0"
+					"子\0"
+					"说\0"
+					"产\0"
+					"种\0"
+					"面\0"
+					"而\0"
+					"方\0"
+					"后\0"
+					"多\0"
+					"定\0"
+					"行\0"
+					"学\0"
+					"法\0"
+					"所\0"
+					"民\0"
+					"得\0"
+					"经\0"
+					"十\0"
+					"三\0"
+					"之\0"
+					"进\0"
+					"着\0"
+					"等\0"
+					"部\0"
+					"度\0"
+					"家\0"
+					"电\0"
+					"力\0"
+					"里\0"
+					"如\0"
+					"水\0"
+					"化\0"
+					"高\0"
+					"自\0"
+					"二\0"
+					"理\0"
+					"起\0"
+					"小\0"
+					"物\0"
+					"现\0"
+					"实\0"
+					"加\0"
+					"量\0"
+					"都\0"
+					"两\0"
+					"体\0"
+					"制\0"
+					"机\0"
+					"当\0"
+					"使\0"
+					"点\0"
+					"从\0"
+					"业\0"
+					"本\0"
+					"去\0"
+					"把\0"
+					"性\0"
+					"好\0"
+					"应\0"
+					"开\0"
+					"它\0"
+					"合\0"
+					"还\0"
+					"因\0"
+					"由\0"
+					"其\0"
+					"些\0"
+					"然\0"
+					"前\0"
+					"外\0"
+					"天\0"
+					"政\0"
+					"四\0"
+					"日\0"
+					"那\0"
+					"社\0"
+					"义\0"
+					"事\0"
+					"平\0"
+					"形\0"
+					"相\0"
+					"全\0"
+					"表\0"
+					"间\0"
+					"样\0"
+					"与\0"
+					"关\0"
+					"各\0"
+					"重\0"
+					"新\0"
+					"线\0"
+					"内\0"
+					"数\0"
+					"正\0"
+					"心\0"
+					"反\0"
+					"你\0"
+					"明\0"
+					"看\0"
+					"原\0"
+					"又\0"
+					"么\0"
+					"利\0"
+					"比\0"
+					"或\0"
+					"但\0"
+					"质\0"
+					"气\0"
+					"第\0"
+					"向\0"
+					"道\0"
+					"命\0"
+					"此\0"
+					"变\0"
+					"条\0"
+					"只\0"
+					"没\0"
+					"结\0"
+					"解\0"
+					"问\0"
+					"意\0"
+					"建\0"
+					"月\0"
+					"公\0"
+					"无\0"
+					"系\0"
+					"军\0"
+					"很\0"
+					"情\0"
+					"者\0"
+					"最\0"
+					"立\0"
+					"代\0"
+					"想\0"
+					"已\0"
+					"通\0"
+					"并\0"
+					"提\0"
+					"直\0"
+					"题\0"
+					"党\0"
+					"程\0"
+					"展\0"
+					"五\0"
+					"果\0"
+					"料\0"
+					"象\0"
+					"员\0"
+					"革\0"
+					"位\0"
+					"入\0"
+					"常\0"
+					"文\0"
+					"总\0"
+					"次\0"
+					"品\0"
+					"式\0"
+					"活\0"
+					"设\0"
+					"及\0"
+					"管\0"
+					"特\0"
+					"件\0"
+					"长\0"
+					"求\0"
+					"老\0"
+					"头\0"
+					"基\0"
+					"资\0"
+					"边\0"
+					"流\0"
+					"路\0"
+					"级\0"
+					"少\0"
+					"图\0"
+					"山\0"
+					"统\0"
+					"接\0"
+					"知\0"
+					"较\0"
+					"将\0"
+					"组\0"
+					"见\0"
+					"计\0"
+					"别\0"
+					"她\0"
+					"手\0"
+					"角\0"
+					"期\0"
+					"根\0"
+					"论\0"
+					"运\0"
+					"农\0"
+					"指\0"
+					"几\0"
+					"九\0"
+					"区\0"
+					"强\0"
+					"放\0"
+					"决\0"
+					"西\0"
+					"被\0"
+					"干\0"
+					"做\0"
+					"必\0"
+					"战\0"
+					"先\0"
+					"回\0"
+					"则\0"
+					"任\0"
+					"取\0"
+					"据\0"
+					"处\0"
+					"队\0"
+					"南\0"
+					"给\0"
+					"色\0"
+					"光\0"
+					"门\0"
+					"即\0"
+					"保\0"
+					"治\0"
+					"北\0"
+					"造\0"
+					"百\0"
+					"规\0"
+					"热\0"
+					"领\0"
+					"七\0"
+					"海\0"
+					"口\0"
+					"东\0"
+					"导\0"
+					"器\0"
+					"压\0"
+					"志\0"
+					"世\0"
+					"金\0"
+					"增\0"
+					"争\0"
+					"济\0"
+					"阶\0"
+					"油\0"
+					"思\0"
+					"术\0"
+					"极\0"
+					"交\0"
+					"受\0"
+					"联\0"
+					"什\0"
+					"认\0"
+					"六\0"
+					"共\0"
+					"权\0"
+					"收\0"
+					"证\0"
+					"改\0"
+					"清\0"
+					"美\0"
+					"再\0"
+					"采\0"
+					"转\0"
+					"更\0"
+					"单\0"
+					"风\0"
+					"切\0"
+					"打\0"
+					"白\0"
+					"教\0"
+					"速\0"
+					"花\0"
+					"带\0"
+					"安\0"
+					"场\0"
+					"身\0"
+					"车\0"
+					"例\0"
+					"真\0"
+					"务\0"
+					"具\0"
+					"万\0"
+					"每\0"
+					"目\0"
+					"至\0"
+					"达\0"
+					"走\0"
+					"积\0"
+					"示\0"
+					"议\0"
+					"声\0"
+					"报\0"
+					"斗\0"
+					"完\0"
+					"类\0"
+					"八\0"
+					"离\0"
+					"华\0"
+					"名\0"
+					"确\0"
+					"才\0"
+					"科\0"
+					"张\0"
+					"信\0"
+					"马\0"
+					"节\0"
+					"话\0"
+					"米\0"
+					"整\0"
+					"空\0"
+					"元\0"
+					"况\0"
+					"今\0"
+					"集\0"
+					"温\0"
+					"传\0"
+					"土\0"
+					"许\0"
+					"步\0"
+					"群\0"
+					"广\0"
+					"石\0"
+					"记\0"
+					"需\0"
+					"段\0"
+					"研\0"
+					"界\0"
+					"拉\0"
+					"林\0"
+					"律\0"
+					"叫\0"
+					"且\0"
+					"究\0"
+					"观\0"
+					"越\0"
+					"织\0"
+					"装\0"
+					"影\0"
+					"算\0"
+					"低\0"
+					"持\0"
+					"音\0"
+					"众\0"
+					"书\0"
+					"布\0"
+					"复\0"
+					"容\0"
+					"儿\0"
+					"须\0"
+					"际\0"
+					"商\0"
+					"非\0"
+					"验\0"
+					"连\0"
+					"断\0"
+					"深\0"
+					"难\0"
+					"近\0"
+					"矿\0"
+					"千\0"
+					"周\0"
+					"委\0"
+					"素\0"
+					"技\0"
+					"备\0"
+					"半\0"
+					"办\0"
+					"青\0"
+					"省\0"
+					"列\0"
+					"习\0"
+					"响\0"
+					"约\0"
+					"支\0"
+					"般\0"
+					"史\0"
+					"感\0"
+					"劳\0"
+					"便\0"
+					"团\0"
+					"往\0"
+					"酸\0"
+					"历\0"
+					"市\0"
+					"克\0"
+					"何\0"
+					"除\0"
+					"消\0"
+					"构\0"
+					"府\0"
+					"称\0"
+					"太\0"
+					"准\0"
+					"精\0"
+					"值\0"
+					"号\0"
+					"率\0"
+					"族\0"
+					"维\0"
+					"划\0"
+					"选\0"
+					"标\0"
+					"写\0"
+					"存\0"
+					"候\0"
+					"毛\0"
+					"亲\0"
+					"快\0"
+					"效\0"
+					"斯\0"
+					"院\0"
+					"查\0"
+					"江\0"
+					"型\0"
+					"眼\0"
+					"王\0"
+					"按\0"
+					"格\0"
+					"养\0"
+					"易\0"
+					"置\0"
+					"派\0"
+					"层\0"
+					"片\0"
+					"始\0"
+					"却\0"
+					"专\0"
+					"状\0"
+					"育\0"
+					"厂\0"
+					"京\0"
+					"识\0"
+					"适\0"
+					"属\0"
+					"圆\0"
+					"包\0"
+					"火\0"
+					"住\0"
+					"调\0"
+					"满\0"
+					"县\0"
+					"局\0"
+					"照\0"
+					"参\0"
+					"红\0"
+					"细\0"
+					"引\0"
+					"听\0"
+					"该\0"
+					"铁\0"
+					"价\0"
+					"严\0"
+					"首\0"
+					"底\0"
+					"液\0"
+					"官\0"
+					"德\0"
+					"随\0"
+					"病\0"
+					"苏\0"
+					"失\0"
+					"尔\0"
+					"死\0"
+					"讲\0"
+					"配\0"
+					"女\0"
+					"黄\0"
+					"推\0"
+					"显\0"
+					"谈\0"
+					"罪\0"
+					"神\0"
+					"艺\0"
+					"呢\0"
+					"席\0"
+					"含\0"
+					"企\0"
+					"望\0"
+					"密\0"
+					"批\0"
+					"营\0"
+					"项\0"
+					"防\0"
+					"举\0"
+					"球\0"
+					"英\0"
+					"氧\0"
+					"势\0"
+					"告\0"
+					"李\0"
+					"台\0"
+					"落\0"
+					"木\0"
+					"帮\0"
+					"轮\0"
+					"破\0"
+					"亚\0"
+					"师\0"
+					"围\0"
+					"注\0"
+					"远\0"
+					"字\0"
+					"材\0"
+					"排\0"
+					"供\0"
+					"河\0"
+					"态\0"
+					"封\0"
+					"另\0"
+					"施\0"
+					"减\0"
+					"树\0"
+					"溶\0"
+					"怎\0"
+					"止\0"
+					"案\0"
+					"言\0"
+					"士\0"
+					"均\0"
+					"武\0"
+					"固\0"
+					"叶\0"
+					"鱼\0"
+					"波\0"
+					"视\0"
+					"仅\0"
+					"费\0"
+					"紧\0"
+					"爱\0"
+					"左\0"
+					"章\0"
+					"早\0"
+					"朝\0"
+					"害\0"
+					"续\0"
+					"轻\0"
+					"服\0"
+					"试\0"
+					"食\0"
+					"充\0"
+					"兵\0"
+					"源\0"
+					"判\0"
+					"护\0"
+					"司\0"
+					"足\0"
+					"某\0"
+					"练\0"
+					"差\0"
+					"致\0"
+					"板\0"
+					"田\0"
+					"降\0"
+					"黑\0"
+					"犯\0"
+					"负\0"
+					"击\0"
+					"范\0"
+					"继\0"
+					"兴\0"
+					"似\0"
+					"余\0"
+					"坚\0"
+					"曲\0"
+					"输\0"
+					"修\0"
+					"故\0"
+					"城\0"
+					"夫\0"
+					"够\0"
+					"送\0"
+					"笔\0"
+					"船\0"
+					"占\0"
+					"右\0"
+					"财\0"
+					"吃\0"
+					"富\0"
+					"春\0"
+					"职\0"
+					"觉\0"
+					"汉\0"
+					"画\0"
+					"功\0"
+					"巴\0"
+					"跟\0"
+					"虽\0"
+					"杂\0"
+					"飞\0"
+					"检\0"
+					"吸\0"
+					"助\0"
+					"升\0"
+					"阳\0"
+					"互\0"
+					"初\0"
+					"创\0"
+					"抗\0"
+					"考\0"
+					"投\0"
+					"坏\0"
+					"策\0"
+					"古\0"
+					"径\0"
+					"换\0"
+					"未\0"
+					"跑\0"
+					"留\0"
+					"钢\0"
+					"曾\0"
+					"端\0"
+					"责\0"
+					"站\0"
+					"简\0"
+					"述\0"
+					"钱\0"
+					"副\0"
+					"尽\0"
+					"帝\0"
+					"射\0"
+					"草\0"
+					"冲\0"
+					"承\0"
+					"独\0"
+					"令\0"
+					"限\0"
+					"阿\0"
+					"宣\0"
+					"环\0"
+					"双\0"
+					"请\0"
+					"超\0"
+					"微\0"
+					"让\0"
+					"控\0"
+					"州\0"
+					"良\0"
+					"轴\0"
+					"找\0"
+					"否\0"
+					"纪\0"
+					"益\0"
+					"依\0"
+					"优\0"
+					"顶\0"
+					"础\0"
+					"载\0"
+					"倒\0"
+					"房\0"
+					"突\0"
+					"坐\0"
+					"粉\0"
+					"敌\0"
+					"略\0"
+					"客\0"
+					"袁\0"
+					"冷\0"
+					"胜\0"
+					"绝\0"
+					"析\0"
+					"块\0"
+					"剂\0"
+					"测\0"
+					"丝\0"
+					"协\0"
+					"诉\0"
+					"念\0"
+					"陈\0"
+					"仍\0"
+					"罗\0"
+					"盐\0"
+					"友\0"
+					"洋\0"
+					"错\0"
+					"苦\0"
+					"夜\0"
+					"刑\0"
+					"移\0"
+					"频\0"
+					"逐\0"
+					"靠\0"
+					"混\0"
+					"母\0"
+					"短\0"
+					"皮\0"
+					"终\0"
+					"聚\0"
+					"汽\0"
+					"村\0"
+					"云\0"
+					"哪\0"
+					"既\0"
+					"距\0"
+					"卫\0"
+					"停\0"
+					"烈\0"
+					"央\0"
+					"察\0"
+					"烧\0"
+					"迅\0"
+					"境\0"
+					"若\0"
+					"印\0"
+					"洲\0"
+					"刻\0"
+					"括\0"
+					"激\0"
+					"孔\0"
+					"搞\0"
+					"甚\0"
+					"室\0"
+					"待\0"
+					"核\0"
+					"校\0"
+					"散\0"
+					"侵\0"
+					"吧\0"
+					"甲\0"
+					"游\0"
+					"久\0"
+					"菜\0"
+					"味\0"
+					"旧\0"
+					"模\0"
+					"湖\0"
+					"货\0"
+					"损\0"
+					"预\0"
+					"阻\0"
+					"毫\0"
+					"普\0"
+					"稳\0"
+					"乙\0"
+					"妈\0"
+					"植\0"
+					"息\0"
+					"扩\0"
+					"银\0"
+					"语\0"
+					"挥\0"
+					"酒\0"
+					"守\0"
+					"拿\0"
+					"序\0"
+					"纸\0"
+					"医\0"
+					"缺\0"
+					"雨\0"
+					"吗\0"
+					"针\0"
+					"刘\0"
+					"啊\0"
+					"急\0"
+					"唱\0"
+					"误\0"
+					"训\0"
+					"愿\0"
+					"审\0"
+					"附\0"
+					"获\0"
+					"茶\0"
+					"鲜\0"
+					"粮\0"
+					"斤\0"
+					"孩\0"
+					"脱\0"
+					"硫\0"
+					"肥\0"
+					"善\0"
+					"龙\0"
+					"演\0"
+					"父\0"
+					"渐\0"
+					"血\0"
+					"欢\0"
+					"械\0"
+					"掌\0"
+					"歌\0"
+					"沙\0"
+					"刚\0"
+					"攻\0"
+					"谓\0"
+					"盾\0"
+					"讨\0"
+					"晚\0"
+					"粒\0"
+					"乱\0"
+					"燃\0"
+					"矛\0"
+					"乎\0"
+					"杀\0"
+					"药\0"
+					"宁\0"
+					"鲁\0"
+					"贵\0"
+					"钟\0"
+					"煤\0"
+					"读\0"
+					"班\0"
+					"伯\0"
+					"香\0"
+					"介\0"
+					"迫\0"
+					"句\0"
+					"丰\0"
+					"培\0"
+					"握\0"
+					"兰\0"
+					"担\0"
+					"弦\0"
+					"蛋\0"
+					"沉\0"
+					"假\0"
+					"穿\0"
+					"执\0"
+					"答\0"
+					"乐\0"
+					"谁\0"
+					"顺\0"
+					"烟\0"
+					"缩\0"
+					"征\0"
+					"脸\0"
+					"喜\0"
+					"松\0"
+					"脚\0"
+					"困\0"
+					"异\0"
+					"免\0"
+					"背\0"
+					"星\0"
+					"福\0"
+					"买\0"
+					"染\0"
+					"井\0"
+					"概\0"
+					"慢\0"
+					"怕\0"
+					"磁\0"
+					"倍\0"
+					"祖\0"
+					"皇\0"
+					"促\0"
+					"静\0"
+					"补\0"
+					"评\0"
+					"翻\0"
+					"肉\0"
+					"践\0"
+					"尼\0"
+					"衣\0"
+					"宽\0"
+					"扬\0"
+					"棉\0"
+					"希\0"
+					"伤\0"
+					"操\0"
+					"垂\0"
+					"秋\0"
+					"宜\0"
+					"氢\0"
+					"套\0"
+					"督\0"
+					"振\0"
+					"架\0"
+					"亮\0"
+					"末\0"
+					"宪\0"
+					"庆\0"
+					"编\0"
+					"牛\0"
+					"触\0"
+					"映\0"
+					"雷\0"
+					"销\0"
+					"诗\0"
+					"座\0"
+					"居\0"
+					"抓\0"
+					"裂\0"
+					"胞\0"
+					"呼\0"
+					"娘\0"
+					"景\0"
+					"威\0"
+					"绿\0"
+					"晶\0"
+					"厚\0"
+					"盟\0"
+					"衡\0"
+					"鸡\0"
+					"孙\0"
+					"延\0"
+					"危\0"
+					"胶\0"
+					"屋\0"
+					"乡\0"
+					"临\0"
+					"陆\0"
+					"顾\0"
+					"掉\0"
+					"呀\0"
+					"灯\0"
+					"岁\0"
+					"措\0"
+					"束\0"
+					"耐\0"
+					"剧\0"
+					"玉\0"
+					"赵\0"
+					"跳\0"
+					"哥\0"
+					"季\0"
+					"课\0"
+					"凯\0"
+					"胡\0"
+					"额\0"
+					"款\0"
+					"绍\0"
+					"卷\0"
+					"齐\0"
+					"伟\0"
+					"蒸\0"
+					"殖\0"
+					"永\0"
+					"宗\0"
+					"苗\0"
+					"川\0"
+					"炉\0"
+					"岩\0"
+					"弱\0"
+					"零\0"
+					"杨\0"
+					"奏\0"
+					"沿\0"
+					"露\0"
+					"杆\0"
+					"探\0"
+					"滑\0"
+					"镇\0"
+					"饭\0"
+					"浓\0"
+					"航\0"
+					"怀\0"
+					"赶\0"
+					"库\0"
+					"夺\0"
+					"伊\0"
+					"灵\0"
+					"税\0"
+					"途\0"
+					"灭\0"
+					"赛\0"
+					"归\0"
+					"召\0"
+					"鼓\0"
+					"播\0"
+					"盘\0"
+					"裁\0"
+					"险\0"
+					"康\0"
+					"唯\0"
+					"录\0"
+					"菌\0"
+					"纯\0"
+					"借\0"
+					"糖\0"
+					"盖\0"
+					"横\0"
+					"符\0"
+					"私\0"
+					"努\0"
+					"堂\0"
+					"域\0"
+					"枪\0"
+					"润\0"
+					"幅\0"
+					"哈\0"
+					"竟\0"
+					"熟\0"
+					"虫\0"
+					"泽\0"
+					"脑\0"
+					"壤\0"
+					"碳\0"
+					"欧\0"
+					"遍\0"
+					"侧\0"
+					"寨\0"
+					"敢\0"
+					"彻\0"
+					"虑\0"
+					"斜\0"
+					"薄\0"
+					"庭\0"
+					"纳\0"
+					"弹\0"
+					"饲\0"
+					"伸\0"
+					"折\0"
+					"麦\0"
+					"湿\0"
+					"暗\0"
+					"荷\0"
+					"瓦\0"
+					"塞\0"
+					"床\0"
+					"筑\0"
+					"恶\0"
+					"户\0"
+					"访\0"
+					"塔\0"
+					"奇\0"
+					"透\0"
+					"梁\0"
+					"刀\0"
+					"旋\0"
+					"迹\0"
+					"卡\0"
+					"氯\0"
+					"遇\0"
+					"份\0"
+					"毒\0"
+					"泥\0"
+					"退\0"
+					"洗\0"
+					"摆\0"
+					"灰\0"
+					"彩\0"
+					"卖\0"
+					"耗\0"
+					"夏\0"
+					"择\0"
+					"忙\0"
+					"铜\0"
+					"献\0"
+					"硬\0"
+					"予\0"
+					"繁\0"
+					"圈\0"
+					"雪\0"
+					"函\0"
+					"亦\0"
+					"抽\0"
+					"篇\0"
+					"阵\0"
+					"阴\0"
+					"丁\0"
+					"尺\0"
+					"追\0"
+					"堆\0"
+					"雄\0"
+					"迎\0"
+					"泛\0"
+					"爸\0"
+					"楼\0"
+					"避\0"
+					"谋\0"
+					"吨\0"
+					"野\0"
+					"猪\0"
+					"旗\0"
+					"累\0"
+					"偏\0"
+					"典\0"
+					"馆\0"
+					"索\0"
+					"秦\0"
+					"脂\0"
+					"潮\0"
+					"爷\0"
+					"豆\0"
+					"忽\0"
+					"托\0"
+					"惊\0"
+					"塑\0"
+					"遗\0"
+					"愈\0"
+					"朱\0"
+					"替\0"
+					"纤\0"
+					"粗\0"
+					"倾\0"
+					"尚\0"
+					"痛\0"
+					"楚\0"
+					"谢\0"
+					"奋\0"
+					"购\0"
+					"磨\0"
+					"君\0"
+					"池\0"
+					"旁\0"
+					"碎\0"
+					"骨\0"
+					"监\0"
+					"捕\0"
+					"弟\0"
+					"暴\0"
+					"割\0"
+					"贯\0"
+					"殊\0"
+					"释\0"
+					"词\0"
+					"亡\0"
+					"壁\0"
+					"顿\0"
+					"宝\0"
+					"午\0"
+					"尘\0"
+					"闻\0"
+					"揭\0"
+					"炮\0"
+					"残\0"
+					"冬\0"
+					"桥\0"
+					"妇\0"
+					"警\0"
+					"综\0"
+					"招\0"
+					"吴\0"
+					"付\0"
+					"浮\0"
+					"遭\0"
+					"徐\0"
+					"您\0"
+					"摇\0"
+					"谷\0"
+					"赞\0"
+					"箱\0"
+					"隔\0"
+					"订\0"
+					"男\0"
+					"吹\0"
+					"园\0"
+					"纷\0"
+					"唐\0"
+					"败\0"
+					"宋\0"
+					"玻\0"
+					"巨\0"
+					"耕\0"
+					"坦\0"
+					"荣\0"
+					"闭\0"
+					"湾\0"
+					"键\0"
+					"凡\0"
+					"驻\0"
+					"锅\0"
+					"救\0"
+					"恩\0"
+					"剥\0"
+					"凝\0"
+					"碱\0"
+					"齿\0"
+					"截\0"
+					"炼\0"
+					"麻\0"
+					"纺\0"
+					"禁\0"
+					"废\0"
+					"盛\0"
+					"版\0"
+					"缓\0"
+					"净\0"
+					"睛\0"
+					"昌\0"
+					"婚\0"
+					"涉\0"
+					"筒\0"
+					"嘴\0"
+					"插\0"
+					"岸\0"
+					"朗\0"
+					"庄\0"
+					"街\0"
+					"藏\0"
+					"姑\0"
+					"贸\0"
+					"腐\0"
+					"奴\0"
+					"啦\0"
+					"惯\0"
+					"乘\0"
+					"伙\0"
+					"恢\0"
+					"匀\0"
+					"纱\0"
+					"扎\0"
+					"辩\0"
+					"耳\0"
+					"彪\0"
+					"臣\0"
+					"亿\0"
+					"璃\0"
+					"抵\0"
+					"脉\0"
+					"秀\0"
+					"萨\0"
+					"俄\0"
+					"网\0"
+					"舞\0"
+					"店\0"
+					"喷\0"
+					"纵\0"
+					"寸\0"
+					"汗\0"
+					"挂\0"
+					"洪\0"
+					"贺\0"
+					"闪\0"
+					"柬\0"
+					"爆\0"
+					"烯\0"
+					"津\0"
+					"稻\0"
+					"墙\0"
+					"软\0"
+					"勇\0"
+					"像\0"
+					"滚\0"
+					"厘\0"
+					"蒙\0"
+					"芳\0"
+					"肯\0"
+					"坡\0"
+					"柱\0"
+					"荡\0"
+					"腿\0"
+					"仪\0"
+					"旅\0"
+					"尾\0"
+					"轧\0"
+					"冰\0"
+					"贡\0"
+					"登\0"
+					"黎\0"
+					"削\0"
+					"钻\0"
+					"勒\0"
+					"逃\0"
+					"障\0"
+					"氨\0"
+					"郭\0"
+					"峰\0"
+					"币\0"
+					"港\0"
+					"伏\0"
+					"轨\0"
+					"亩\0"
+					"毕\0"
+					"擦\0"
+					"莫\0"
+					"刺\0"
+					"浪\0"
+					"秘\0"
+					"援\0"
+					"株\0"
+					"健\0"
+					"售\0"
+					"股\0"
+					"岛\0"
+					"甘\0"
+					"泡\0"
+					"睡\0"
+					"童\0"
+					"铸\0"
+					"汤\0"
+					"阀\0"
+					"休\0"
+					"汇\0"
+					"舍\0"
+					"牧\0"
+					"绕\0"
+					"炸\0"
+					"哲\0"
+					"磷\0"
+					"绩\0"
+					"朋\0"
+					"淡\0"
+					"尖\0"
+					"启\0"
+					"陷\0"
+					"柴\0"
+					"呈\0"
+					"徒\0"
+					"颜\0"
+					"泪\0"
+					"稍\0"
+					"忘\0"
+					"泵\0"
+					"蓝\0"
+					"拖\0"
+					"洞\0"
+					"授\0"
+					"镜\0"
+					"辛\0"
+					"壮\0"
+					"锋\0"
+					"贫\0"
+					"虚\0"
+					"弯\0"
+					"摩\0"
+					"泰\0"
+					"幼\0"
+					"廷\0"
+					"尊\0"
+					"窗\0"
+					"纲\0"
+					"弄\0"
+					"隶\0"
+					"疑\0"
+					"氏\0"
+					"宫\0"
+					"姐\0"
+					"震\0"
+					"瑞\0"
+					"怪\0"
+					"尤\0"
+					"琴\0"
+					"循\0"
+					"描\0"
+					"膜\0"
+					"违\0"
+					"夹\0"
+					"腰\0"
+					"缘\0"
+					"珠\0"
+					"穷\0"
+					"森\0"
+					"枝\0"
+					"竹\0"
+					"沟\0"
+					"催\0"
+					"绳\0"
+					"忆\0"
+					"邦\0"
+					"剩\0"
+					"幸\0"
+					"浆\0"
+					"栏\0"
+					"拥\0"
+					"牙\0"
+					"贮\0"
+					"礼\0"
+					"滤\0"
+					"钠\0"
+					"纹\0"
+					"罢\0"
+					"拍\0"
+					"咱\0"
+					"喊\0"
+					"袖\0"
+					"埃\0"
+					"勤\0"
+					"罚\0"
+					"焦\0"
+					"潜\0"
+					"伍\0"
+					"墨\0"
+					"欲\0"
+					"缝\0"
+					"姓\0"
+					"刊\0"
+					"饱\0"
+					"仿\0"
+					"奖\0"
+					"铝\0"
+					"鬼\0"
+					"丽\0"
+					"跨\0"
+					"默\0"
+					"挖\0"
+					"链\0"
+					"扫\0"
+					"喝\0"
+					"袋\0"
+					"炭\0"
+					"污\0"
+					"幕\0"
+					"诸\0"
+					"弧\0"
+					"励\0"
+					"梅\0"
+					"奶\0"
+					"洁\0"
+					"灾\0"
+					"舟\0"
+					"鉴\0"
+					"苯\0"
+					"讼\0"
+					"抱\0"
+					"毁\0"
+					"懂\0"
+					"寒\0"
+					"智\0"
+					"埔\0"
+					"寄\0"
+					"届\0"
+					"跃\0"
+					"渡\0"
+					"挑\0"
+					"丹\0"
+					"艰\0"
+					"贝\0"
+					"碰\0"
+					"拔\0"
+					"爹\0"
+					"戴\0"
+					"码\0"
+					"梦\0"
+					"芽\0"
+					"熔\0"
+					"赤\0"
+					"渔\0"
+					"哭\0"
+					"敬\0"
+					"颗\0"
+					"奔\0"
+					"铅\0"
+					"仲\0"
+					"虎\0"
+					"稀\0"
+					"妹\0"
+					"乏\0"
+					"珍\0"
+					"申\0"
+					"桌\0"
+					"遵\0"
+					"允\0"
+					"隆\0"
+					"螺\0"
+					"仓\0"
+					"魏\0"
+					"锐\0"
+					"晓\0"
+					"氮\0"
+					"兼\0"
+					"隐\0"
+					"碍\0"
+					"赫\0"
+					"拨\0"
+					"忠\0"
+					"肃\0"
+					"缸\0"
+					"牵\0"
+					"抢\0"
+					"博\0"
+					"巧\0"
+					"壳\0"
+					"兄\0"
+					"杜\0"
+					"讯\0"
+					"诚\0"
+					"碧\0"
+					"祥\0"
+					"柯\0"
+					"页\0"
+					"巡\0"
+					"矩\0"
+					"悲\0"
+					"灌\0"
+					"龄\0"
+					"伦\0"
+					"票\0"
+					"寻\0"
+					"桂\0"
+					"铺\0"
+					"圣\0"
+					"恐\0"
+					"恰\0"
+					"郑\0"
+					"趣\0"
+					"抬\0"
+					"荒\0"
+					"腾\0"
+					"贴\0"
+					"柔\0"
+					"滴\0"
+					"猛\0"
+					"阔\0"
+					"辆\0"
+					"妻\0"
+					"填\0"
+					"撤\0"
+					"储\0"
+					"签\0"
+					"闹\0"
+					"扰\0"
+					"紫\0"
+					"砂\0"
+					"递\0"
+					"戏\0"
+					"吊\0"
+					"陶\0"
+					"伐\0"
+					"喂\0"
+					"疗\0"
+					"瓶\0"
+					"婆\0"
+					"抚\0"
+					"臂\0"
+					"摸\0"
+					"忍\0"
+					"虾\0"
+					"蜡\0"
+					"邻\0"
+					"胸\0"
+					"巩\0"
+					"挤\0"
+					"偶\0"
+					"弃\0"
+					"槽\0"
+					"劲\0"
+					"乳\0"
+					"邓\0"
+					"吉\0"
+					"仁\0"
+					"烂\0"
+					"砖\0"
+					"租\0"
+					"乌\0"
+					"舰\0"
+					"伴\0"
+					"瓜\0"
+					"浅\0"
+					"丙\0"
+					"暂\0"
+					"燥\0"
+					"橡\0"
+					"柳\0"
+					"迷\0"
+					"暖\0"
+					"牌\0"
+					"秧\0"
+					"胆\0"
+					"详\0"
+					"簧\0"
+					"踏\0"
+					"瓷\0"
+					"谱\0"
+					"呆\0"
+					"宾\0"
+					"糊\0"
+					"洛\0"
+					"辉\0"
+					"愤\0"
+					"竞\0"
+					"隙\0"
+					"怒\0"
+					"粘\0"
+					"乃\0"
+					"绪\0"
+					"肩\0"
+					"籍\0"
+					"敏\0"
+					"涂\0"
+					"熙\0"
+					"皆\0"
+					"侦\0"
+					"悬\0"
+					"掘\0"
+					"享\0"
+					"纠\0"
+					"醒\0"
+					"狂\0"
+					"锁\0"
+					"淀\0"
+					"恨\0"
+					"牲\0"
+					"霸\0"
+					"爬\0"
+					"赏\0"
+					"逆\0"
+					"玩\0"
+					"陵\0"
+					"祝\0"
+					"秒\0"
+					"浙\0"
+					"貌\0"
+					"役\0"
+					"彼\0"
+					"悉\0"
+					"鸭\0"
+					"趋\0"
+					"凤\0"
+					"晨\0"
+					"畜\0"
+					"辈\0"
+					"秩\0"
+					"卵\0"
+					"署\0"
+					"梯\0"
+					"炎\0"
+					"滩\0"
+					"棋\0"
+					"驱\0"
+					"筛\0"
+					"峡\0"
+					"冒\0"
+					"啥\0"
+					"寿\0"
+					"译\0"
+					"浸\0"
+					"泉\0"
+					"帽\0"
+					"迟\0"
+					"硅\0"
+					"疆\0"
+					"贷\0"
+					"漏\0"
+					"稿\0"
+					"冠\0"
+					"嫩\0"
+					"胁\0"
+					"芯\0"
+					"牢\0"
+					"叛\0"
+					"蚀\0"
+					"奥\0"
+					"鸣\0"
+					"岭\0"
+					"羊\0"
+					"凭\0"
+					"串\0"
+					"塘\0"
+					"绘\0"
+					"酵\0"
+					"融\0"
+					"盆\0"
+					"锡\0"
+					"庙\0"
+					"筹\0"
+					"冻\0"
+					"辅\0"
+					"摄\0"
+					"袭\0"
+					"筋\0"
+					"拒\0"
+					"僚\0"
+					"旱\0"
+					"钾\0"
+					"鸟\0"
+					"漆\0"
+					"沈\0"
+					"眉\0"
+					"疏\0"
+					"添\0"
+					"棒\0"
+					"穗\0"
+					"硝\0"
+					"韩\0"
+					"逼\0"
+					"扭\0"
+					"侨\0"
+					"凉\0"
+					"挺\0"
+					"碗\0"
+					"栽\0"
+					"炒\0"
+					"杯\0"
+					"患\0"
+					"馏\0"
+					"劝\0"
+					"豪\0"
+					"辽\0"
+					"勃\0"
+					"鸿\0"
+					"旦\0"
+					"吏\0"
+					"拜\0"
+					"狗\0"
+					"埋\0"
+					"辊\0"
+					"掩\0"
+					"饮\0"
+					"搬\0"
+					"骂\0"
+					"辞\0"
+					"勾\0"
+					"扣\0"
+					"估\0"
+					"蒋\0"
+					"绒\0"
+					"雾\0"
+					"丈\0"
+					"朵\0"
+					"姆\0"
+					"拟\0"
+					"宇\0"
+					"辑\0"
+					"陕\0"
+					"雕\0"
+					"偿\0"
+					"蓄\0"
+					"崇\0"
+					"剪\0"
+					"倡\0"
+					"厅\0"
+					"咬\0"
+					"驶\0"
+					"薯\0"
+					"刷\0"
+					"斥\0"
+					"番\0"
+					"赋\0"
+					"奉\0"
+					"佛\0"
+					"浇\0"
+					"漫\0"
+					"曼\0"
+					"扇\0"
+					"钙\0"
+					"桃\0"
+					"扶\0"
+					"仔\0"
+					"返\0"
+					"俗\0"
+					"亏\0"
+					"腔\0"
+					"鞋\0"
+					"棱\0"
+					"覆\0"
+					"框\0"
+					"悄\0"
+					"叔\0"
+					"撞\0"
+					"骗\0"
+					"勘\0"
+					"旺\0"
+					"沸\0"
+					"孤\0"
+					"吐\0"
+					"孟\0"
+					"渠\0"
+					"屈\0"
+					"疾\0"
+					"妙\0"
+					"惜\0"
+					"仰\0"
+					"狠\0"
+					"胀\0"
+					"谐\0"
+					"抛\0"
+					"霉\0"
+					"桑\0"
+					"岗\0"
+					"嘛\0"
+					"衰\0"
+					"盗\0"
+					"渗\0"
+					"脏\0"
+					"赖\0"
+					"涌\0"
+					"甜\0"
+					"曹\0"
+					"阅\0"
+					"肌\0"
+					"哩\0"
+					"厉\0"
+					"烃\0"
+					"纬\0"
+					"毅\0"
+					"昨\0"
+					"伪\0"
+					"症\0"
+					"煮\0"
+					"叹\0"
+					"钉\0"
+					"搭\0"
+					"茎\0"
+					"笼\0"
+					"酷\0"
+					"偷\0"
+					"弓\0"
+					"锥\0"
+					"恒\0"
+					"杰\0"
+					"坑\0"
+					"鼻\0"
+					"翼\0"
+					"纶\0"
+					"叙\0"
+					"狱\0"
+					"逮\0"
+					"罐\0"
+					"络\0"
+					"棚\0"
+					"抑\0"
+					"膨\0"
+					"蔬\0"
+					"寺\0"
+					"骤\0"
+					"穆\0"
+					"冶\0"
+					"枯\0"
+					"册\0"
+					"尸\0"
+					"凸\0"
+					"绅\0"
+					"坯\0"
+					"牺\0"
+					"焰\0"
+					"轰\0"
+					"欣\0"
+					"晋\0"
+					"瘦\0"
+					"御\0"
+					"锭\0"
+					"锦\0"
+					"丧\0"
+					"旬\0"
+					"锻\0"
+					"垄\0"
+					"搜\0"
+					"扑\0"
+					"邀\0"
+					"亭\0"
+					"酯\0"
+					"迈\0"
+					"舒\0"
+					"脆\0"
+					"酶\0"
+					"闲\0"
+					"忧\0"
+					"酚\0"
+					"顽\0"
+					"羽\0"
+					"涨\0"
+					"卸\0"
+					"仗\0"
+					"陪\0"
+					"辟\0"
+					"惩\0"
+					"杭\0"
+					"姚\0"
+					"肚\0"
+					"捉\0"
+					"飘\0"
+					"漂\0"
+					"昆\0"
+					"欺\0"
+					"吾\0"
+					"郎\0"
+					"烷\0"
+					"汁\0"
+					"呵\0"
+					"饰\0"
+					"萧\0"
+					"雅\0"
+					"邮\0"
+					"迁\0"
+					"燕\0"
+					"撒\0"
+					"姻\0"
+					"赴\0"
+					"宴\0"
+					"烦\0"
+					"债\0"
+					"帐\0"
+					"斑\0"
+					"铃\0"
+					"旨\0"
+					"醇\0"
+					"董\0"
+					"饼\0"
+					"雏\0"
+					"姿\0"
+					"拌\0"
+					"傅\0"
+					"腹\0"
+					"妥\0"
+					"揉\0"
+					"贤\0"
+					"拆\0"
+					"歪\0"
+					"葡\0"
+					"胺\0"
+					"丢\0"
+					"浩\0"
+					"徽\0"
+					"昂\0"
+					"垫\0"
+					"挡\0"
+					"览\0"
+					"贪\0"
+					"慰\0"
+					"缴\0"
+					"汪\0"
+					"慌\0"
+					"冯\0"
+					"诺\0"
+					"姜\0"
+					"谊\0"
+					"凶\0"
+					"劣\0"
+					"诬\0"
+					"耀\0"
+					"昏\0"
+					"躺\0"
+					"盈\0"
+					"骑\0"
+					"乔\0"
+					"溪\0"
+					"丛\0"
+					"卢\0"
+					"抹\0"
+					"闷\0"
+					"咨\0"
+					"刮\0"
+					"驾\0"
+					"缆\0"
+					"悟\0"
+					"摘\0"
+					"铒\0"
+					"掷\0"
+					"颇\0"
+					"幻\0"
+					"柄\0"
+					"惠\0"
+					"惨\0"
+					"佳\0"
+					"仇\0"
+					"腊\0"
+					"窝\0"
+					"涤\0"
+					"剑\0"
+					"瞧\0"
+					"堡\0"
+					"泼\0"
+					"葱\0"
+					"罩\0"
+					"霍\0"
+					"捞\0"
+					"胎\0"
+					"苍\0"
+					"滨\0"
+					"俩\0"
+					"捅\0"
+					"湘\0"
+					"砍\0"
+					"霞\0"
+					"邵\0"
+					"萄\0"
+					"疯\0"
+					"淮\0"
+					"遂\0"
+					"熊\0"
+					"粪\0"
+					"烘\0"
+					"宿\0"
+					"档\0"
+					"戈\0"
+					"驳\0"
+					"嫂\0"
+					"裕\0"
+					"徙\0"
+					"箭\0"
+					"捐\0"
+					"肠\0"
+					"撑\0"
+					"晒\0"
+					"辨\0"
+					"殿\0"
+					"莲\0"
+					"摊\0"
+					"搅\0"
+					"酱\0"
+					"屏\0"
+					"疫\0"
+					"哀\0"
+					"蔡\0"
+					"堵\0"
+					"沫\0"
+					"皱\0"
+					"畅\0"
+					"叠\0"
+					"阁\0"
+					"莱\0"
+					"敲\0"
+					"辖\0"
+					"钩\0"
+					"痕\0"
+					"坝\0"
+					"巷\0"
+					"饿\0"
+					"祸\0"
+					"丘\0"
+					"玄\0"
+					"溜\0"
+					"曰\0"
+					"逻\0"
+					"彭\0"
+					"尝\0"
+					"卿\0"
+					"妨\0"
+					"艇\0"
+					"吞\0"
+					"韦\0"
+					"怨\0"
+					"矮\0"
+					"歇\0";
+
+			constexpr uint16_t BIP39OffsetsChinese[BIP39_WORDLIST_COUNT] = {
+					0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44,
+					48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92,
+					96, 100, 104, 108, 112, 116, 120, 124, 128, 132, 136, 140,
+					144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+					192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236,
+					240, 244, 248, 252, 256, 260, 264, 268, 272, 276, 280, 284,
+					288, 292, 296, 300, 304, 308, 312, 316, 320, 324, 328, 332,
+					336, 340, 344, 348, 352, 356, 360, 364, 368, 372, 376, 380,
+					384, 388, 392, 396, 400, 404, 408, 412, 416, 420, 424, 428,
+					432, 436, 440, 444, 448, 452, 456, 460, 464, 468, 472, 476,
+					480, 484, 488, 492, 496, 500, 504, 508, 512, 516, 520, 524,
+					528, 532, 536, 540, 544, 548, 552, 556, 560, 564, 568, 572,
+					576, 580, 584, 588, 592, 596, 600, 604, 608, 612, 616, 620,
+					624, 628, 632, 636, 640, 644, 648, 652, 656, 660, 664, 668,
+					672, 676, 680, 684, 688, 692, 696, 700, 704, 708, 712, 716,
+					720, 724, 728, 732, 736, 740, 744, 748, 752, 756, 760, 764,
+					768, 772, 776, 780, 784, 788, 792, 796, 800, 804, 808, 812,
+					816, 820, 824, 828, 832, 836, 840, 844, 848, 852, 856, 860,
+					864, 868, 872, 876, 880, 884, 888, 892, 896, 900, 904, 908,
+					912, 916, 920, 924, 928, 932, 936, 940, 944, 948, 952, 956,
+					960, 964, 968, 972, 976, 980, 984, 988, 992, 996, 1000, 1004,
+					1008, 1012, 1016, 1020, 1024, 1028, 1032, 1036, 1040, 1044, 1048, 1052,
+					1056, 1060, 1064, 1068, 1072, 1076, 1080, 1084, 1088, 1092, 1096, 1100,
+					1104, 1108, 1112, 1116, 1120, 1124, 1128, 1132, 1136, 1140, 1144, 1148,
+					1152, 1156, 1160, 1164, 1168, 1172, 1176, 1180, 1184, 1188, 1192, 1196,
+					1200, 1204, 1208, 1212, 1216, 1220, 1224, 1228, 1232, 1236, 1240, 1244,
+					1248, 1252, 1256, 1260, 1264, 1268, 1272, 1276, 1280, 1284, 1288, 1292,
+					1296, 1300, 1304, 1308, 1312, 1316, 1320, 1324, 1328, 1332, 1336, 1340,
+					1344, 1348, 1352, 1356, 1360, 1364, 1368, 1372, 1376, 1380, 1384, 1388,
+					1392, 1396, 1400, 1404, 1408, 1412, 1416, 1420, 1424, 1428, 1432, 1436,
+					1440, 1444, 1448, 1452, 1456, 1460, 1464, 1468, 1472, 1476, 1480, 1484,
+					1488, 1492, 1496, 1500, 1504, 1508, 1512, 1516, 1520, 1524, 1528, 1532,
+					1536, 1540, 1544, 1548, 1552, 1556, 1560, 1564, 1568, 1572, 1576, 1580,
+					1584, 1588, 1592, 1596, 1600, 1604, 1608, 1612, 1616, 1620, 1624, 1628,
+					1632, 1636, 1640, 1644, 1648, 1652, 1656, 1660, 1664, 1668, 1672, 1676,
+					1680, 1684, 1688, 1692, 1696, 1700, 1704, 1708, 1712, 1716, 1720, 1724,
+					1728, 1732, 1736, 1740, 1744, 1748, 1752, 1756, 1760, 1764, 1768, 1772,
+					1776, 1780, 1784, 1788, 1792, 1796, 1800, 1804, 1808, 1812, 1816, 1820,
+					1824, 1828, 1832, 1836, 1840, 1844, 1848, 1852, 1856, 1860, 1864, 1868,
+					1872, 1876, 1880, 1884, 1888, 1892, 1896, 1900, 1904, 1908, 1912, 1916,
+					1920, 1924, 1928, 1932, 1936, 1940, 1944, 1948, 1952, 1956, 1960, 1964,
+					1968, 1972, 1976, 1980, 1984, 1988, 1992, 1996, 2000, 2004, 2008, 2012,
+					2016, 2020, 2024, 2028, 2032, 2036, 2040, 2044, 2048, 2052, 2056, 2060,
+					2064, 2068, 2072, 2076, 2080, 2084, 2088, 2092, 2096, 2100, 2104, 2108,
+					2112, 2116, 2120, 2124, 2128, 2132, 2136, 2140, 2144, 2148, 2152, 2156,
+					2160, 2164, 2168, 2172, 2176, 2180, 2184, 2188, 2192, 2196, 2200, 2204,
+					2208, 2212, 2216, 2220, 2224, 2228, 2232, 2236, 2240, 2244, 2248, 2252,
+					2256, 2260, 2264, 2268, 2272, 2276, 2280, 2284, 2288, 2292, 2296, 2300,
+					2304, 2308, 2312, 2316, 2320, 2324, 2328, 2332, 2336, 2340, 2344, 2348,
+					2352, 2356, 2360, 2364, 2368, 2372, 2376, 2380, 2384, 2388, 2392, 2396,
+					2400, 2404, 2408, 2412, 2416, 2420, 2424, 2428, 2432, 2436, 2440, 2444,
+					2448, 2452, 2456, 2460, 2464, 2468, 2472, 2476, 2480, 2484, 2488, 2492,
+					2496, 2500, 2504, 2508, 2512, 2516, 2520, 2524, 2528, 2532, 2536, 2540,
+					2544, 2548, 2552, 2556, 2560, 2564, 2568, 2572, 2576, 2580, 2584, 2588,
+					2592, 2596, 2600, 2604, 2608, 2612, 2616, 2620, 2624, 2628, 2632, 2636,
+					2640, 2644, 2648, 2652, 2656, 2660, 2664, 2668, 2672, 2676, 2680, 2684,
+					2688, 2692, 2696, 2700, 2704, 2708, 2712, 2716, 2720, 2724, 2728, 2732,
+					2736, 2740, 2744, 2748, 2752, 2756, 2760, 2764, 2768, 2772, 2776, 2780,
+					2784, 2788, 2792, 2796, 2800, 2804, 2808, 2812, 2816, 2820, 2824, 2828,
+					2832, 2836, 2840, 2844, 2848, 2852, 2856, 2860, 2864, 2868, 2872, 2876,
+					2880, 2884, 2888, 2892, 2896, 2900, 2904, 2908, 2912, 2916, 2920, 2924,
+					2928, 2932, 2936, 2940, 2944, 2948, 2952, 2956, 2960, 2964, 2968, 2972,
+					2976, 2980, 2984, 2988, 2992, 2996, 3000, 3004, 3008, 3012, 3016, 3020,
+					3024, 3028, 3032, 3036, 3040, 3044, 3048, 3052, 3056, 3060, 3064, 3068,
+					3072, 3076, 3080, 3084, 3088, 3092, 3096, 3100, 3104, 3108, 3112, 3116,
+					3120, 3124, 3128, 3132, 3136, 3140, 3144, 3148, 3152, 3156, 3160, 3164,
+					3168, 3172, 3176, 3180, 3184, 3188, 3192, 3196, 3200, 3204, 3208, 3212,
+					3216, 3220, 3224, 3228, 3232, 3236, 3240, 3244, 3248, 3252, 3256, 3260,
+					3264, 3268, 3272, 3276, 3280, 3284, 3288, 3292, 3296, 3300, 3304, 3308,
+					3312, 3316, 3320, 3324, 3328, 3332, 3336, 3340, 3344, 3348, 3352, 3356,
+					3360, 3364, 3368, 3372, 3376, 3380, 3384, 3388, 3392, 3396, 3400, 3404,
+					3408, 3412, 3416, 3420, 3424, 3428, 3432, 3436, 3440, 3444, 3448, 3452,
+					3456, 3460, 3464, 3468, 3472, 3476, 3480, 3484, 3488, 3492, 3496, 3500,
+					3504, 3508, 3512, 3516, 3520, 3524, 3528, 3532, 3536, 3540, 3544, 3548,
+					3552, 3556, 3560, 3564, 3568, 3572, 3576, 3580, 3584, 3588, 3592, 3596,
+					3600, 3604, 3608, 3612, 3616, 3620, 3624, 3628, 3632, 3636, 3640, 3644,
+					3648, 3652, 3656, 3660, 3664, 3668, 3672, 3676, 3680, 3684, 3688, 3692,
+					3696, 3700, 3704, 3708, 3712, 3716, 3720, 3724, 3728, 3732, 3736, 3740,
+					3744, 3748, 3752, 3756, 3760, 3764, 3768, 3772, 3776, 3780, 3784, 3788,
+					3792, 3796, 3800, 3804, 3808, 3812, 3816, 3820, 3824, 3828, 3832, 3836,
+					3840, 3844, 3848, 3852, 3856, 3860, 3864, 3868, 3872, 3876, 3880, 3884,
+					3888, 3892, 3896, 3900, 3904, 3908, 3912, 3916, 3920, 3924, 3928, 3932,
+					3936, 3940, 3944, 3948, 3952, 3956, 3960, 3964, 3968, 3972, 3976, 3980,
+					3984, 3988, 3992, 3996, 4000, 4004, 4008, 4012, 4016, 4020, 4024, 4028,
+					4032, 4036, 4040, 4044, 4048, 4052, 4056, 4060, 4064, 4068, 4072, 4076,
+					4080, 4084, 4088, 4092, 4096, 4100, 4104, 4108, 4112, 4116, 4120, 4124,
+					4128, 4132, 4136, 4140, 4144, 4148, 4152, 4156, 4160, 4164, 4168, 4172,
+					4176, 4180, 4184, 4188, 4192, 4196, 4200, 4204, 4208, 4212, 4216, 4220,
+					4224, 4228, 4232, 4236, 4240, 4244, 4248, 4252, 4256, 4260, 4264, 4268,
+					4272, 4276, 4280, 4284, 4288, 4292, 4296, 4300, 4304, 4308, 4312, 4316,
+					4320, 4324, 4328, 4332, 4336, 4340, 4344, 4348, 4352, 4356, 4360, 4364,
+					4368, 4372, 4376, 4380, 4384, 4388, 4392, 4396, 4400, 4404, 4408, 4412,
+					4416, 4420, 4424, 4428, 4432, 4436, 4440, 4444, 4448, 4452, 4456, 4460,
+					4464, 4468, 4472, 4476, 4480, 4484, 4488, 4492, 4496, 4500, 4504, 4508,
+					4512, 4516, 4520, 4524, 4528, 4532, 4536, 4540, 4544, 4548, 4552, 4556,
+					4560, 4564, 4568, 4572, 4576, 4580, 4584, 4588, 4592, 4596, 4600, 4604,
+					4608, 4612, 4616, 4620, 4624, 4628, 4632, 4636, 4640, 4644, 4648, 4652,
+					4656, 4660, 4664, 4668, 4672, 4676, 4680, 4684, 4688, 4692, 4696, 4700,
+					4704, 4708, 4712, 4716, 4720, 4724, 4728, 4732, 4736, 4740, 4744, 4748,
+					4752, 4756, 4760, 4764, 4768, 4772, 4776, 4780, 4784, 4788, 4792, 4796,
+					4800, 4804, 4808, 4812, 4816, 4820, 4824, 4828, 4832, 4836, 4840, 4844,
+					4848, 4852, 4856, 4860, 4864, 4868, 4872, 4876, 4880, 4884, 4888, 4892,
+					4896, 4900, 4904, 4908, 4912, 4916, 4920, 4924, 4928, 4932, 4936, 4940,
+					4944, 4948, 4952, 4956, 4960, 4964, 4968, 4972, 4976, 4980, 4984, 4988,
+					4992, 4996, 5000, 5004, 5008, 5012, 5016, 5020, 5024, 5028, 5032, 5036,
+					5040, 5044, 5048, 5052, 5056, 5060, 5064, 5068, 5072, 5076, 5080, 5084,
+					5088, 5092, 5096, 5100, 5104, 5108, 5112, 5116, 5120, 5124, 5128, 5132,
+					5136, 5140, 5144, 5148, 5152, 5156, 5160, 5164, 5168, 5172, 5176, 5180,
+					5184, 5188, 5192, 5196, 5200, 5204, 5208, 5212, 5216, 5220, 5224, 5228,
+					5232, 5236, 5240, 5244, 5248, 5252, 5256, 5260, 5264, 5268, 5272, 5276,
+					5280, 5284, 5288, 5292, 5296, 5300, 5304, 5308, 5312, 5316, 5320, 5324,
+					5328, 5332, 5336, 5340, 5344, 5348, 5352, 5356, 5360, 5364, 5368, 5372,
+					5376, 5380, 5384, 5388, 5392, 5396, 5400, 5404, 5408, 5412, 5416, 5420,
+					5424, 5428, 5432, 5436, 5440, 5444, 5448, 5452, 5456, 5460, 5464, 5468,
+					5472, 5476, 5480, 5484, 5488, 5492, 5496, 5500, 5504, 5508, 5512, 5516,
+					5520, 5524, 5528, 5532, 5536, 5540, 5544, 5548, 5552, 5556, 5560, 5564,
+					5568, 5572, 5576, 5580, 5584, 5588, 5592, 5596, 5600, 5604, 5608, 5612,
+					5616, 5620, 5624, 5628, 5632, 5636, 5640, 5644, 5648, 5652, 5656, 5660,
+					5664, 5668, 5672, 5676, 5680, 5684, 5688, 5692, 5696, 5700, 5704, 5708,
+					5712, 5716, 5720, 5724, 5728, 5732, 5736, 5740, 5744, 5748, 5752, 5756,
+					5760, 5764, 5768, 5772, 5776, 5780, 5784, 5788, 5792, 5796, 5800, 5804,
+					5808, 5812, 5816, 5820, 5824, 5828, 5832, 5836, 5840, 5844, 5848, 5852,
+					5856, 5860, 5864, 5868, 5872, 5876, 5880, 5884, 5888, 5892, 5896, 5900,
+					5904, 5908, 5912, 5916, 5920, 5924, 5928, 5932, 5936, 5940, 5944, 5948,
+					5952, 5956, 5960, 5964, 5968, 5972, 5976, 5980, 5984, 5988, 5992, 5996,
+					6000, 6004, 6008, 6012, 6016, 6020, 6024, 6028, 6032, 6036, 6040, 6044,
+					6048, 6052, 6056, 6060, 6064, 6068, 6072, 6076, 6080, 6084, 6088, 6092,
+					6096, 6100, 6104, 6108, 6112, 6116, 6120, 6124, 6128, 6132, 6136, 6140,
+					6144, 6148, 6152, 6156, 6160, 6164, 6168, 6172, 6176, 6180, 6184, 6188,
+					6192, 6196, 6200, 6204, 6208, 6212, 6216, 6220, 6224, 6228, 6232, 6236,
+					6240, 6244, 6248, 6252, 6256, 6260, 6264, 6268, 6272, 6276, 6280, 6284,
+					6288, 6292, 6296, 6300, 6304, 6308, 6312, 6316, 6320, 6324, 6328, 6332,
+					6336, 6340, 6344, 6348, 6352, 6356, 6360, 6364, 6368, 6372, 6376, 6380,
+					6384, 6388, 6392, 6396, 6400, 6404, 6408, 6412, 6416, 6420, 6424, 6428,
+					6432, 6436, 6440, 6444, 6448, 6452, 6456, 6460, 6464, 6468, 6472, 6476,
+					6480, 6484, 6488, 6492, 6496, 6500, 6504, 6508, 6512, 6516, 6520, 6524,
+					6528, 6532, 6536, 6540, 6544, 6548, 6552, 6556, 6560, 6564, 6568, 6572,
+					6576, 6580, 6584, 6588, 6592, 6596, 6600, 6604, 6608, 6612, 6616, 6620,
+					6624, 6628, 6632, 6636, 6640, 6644, 6648, 6652, 6656, 6660, 6664, 6668,
+					6672, 6676, 6680, 6684, 6688, 6692, 6696, 6700, 6704, 6708, 6712, 6716,
+					6720, 6724, 6728, 6732, 6736, 6740, 6744, 6748, 6752, 6756, 6760, 6764,
+					6768, 6772, 6776, 6780, 6784, 6788, 6792, 6796, 6800, 6804, 6808, 6812,
+					6816, 6820, 6824, 6828, 6832, 6836, 6840, 6844, 6848, 6852, 6856, 6860,
+					6864, 6868, 6872, 6876, 6880, 6884, 6888, 6892, 6896, 6900, 6904, 6908,
+					6912, 6916, 6920, 6924, 6928, 6932, 6936, 6940, 6944, 6948, 6952, 6956,
+					6960, 6964, 6968, 6972, 6976, 6980, 6984, 6988, 6992, 6996, 7000, 7004,
+					7008, 7012, 7016, 7020, 7024, 7028, 7032, 7036, 7040, 7044, 7048, 7052,
+					7056, 7060, 7064, 7068, 7072, 7076, 7080, 7084, 7088, 7092, 7096, 7100,
+					7104, 7108, 7112, 7116, 7120, 7124, 7128, 7132, 7136, 7140, 7144, 7148,
+					7152, 7156, 7160, 7164, 7168, 7172, 7176, 7180, 7184, 7188, 7192, 7196,
+					7200, 7204, 7208, 7212, 7216, 7220, 7224, 7228, 7232, 7236, 7240, 7244,
+					7248, 7252, 7256, 7260, 7264, 7268, 7272, 7276, 7280, 7284, 7288, 7292,
+					7296, 7300, 7304, 7308, 7312, 7316, 7320, 7324, 7328, 7332, 7336, 7340,
+					7344, 7348, 7352, 7356, 7360, 7364, 7368, 7372, 7376, 7380, 7384, 7388,
+					7392, 7396, 7400, 7404, 7408, 7412, 7416, 7420, 7424, 7428, 7432, 7436,
+					7440, 7444, 7448, 7452, 7456, 7460, 7464, 7468, 7472, 7476, 7480, 7484,
+					7488, 7492, 7496, 7500, 7504, 7508, 7512, 7516, 7520, 7524, 7528, 7532,
+					7536, 7540, 7544, 7548, 7552, 7556, 7560, 7564, 7568, 7572, 7576, 7580,
+					7584, 7588, 7592, 7596, 7600, 7604, 7608, 7612, 7616, 7620, 7624, 7628,
+					7632, 7636, 7640, 7644, 7648, 7652, 7656, 7660, 7664, 7668, 7672, 7676,
+					7680, 7684, 7688, 7692, 7696, 7700, 7704, 7708, 7712, 7716, 7720, 7724,
+					7728, 7732, 7736, 7740, 7744, 7748, 7752, 7756, 7760, 7764, 7768, 7772,
+					7776, 7780, 7784, 7788, 7792, 7796, 7800, 7804, 7808, 7812, 7816, 7820,
+					7824, 7828, 7832, 7836, 7840, 7844, 7848, 7852, 7856, 7860, 7864, 7868,
+					7872, 7876, 7880, 7884, 7888, 7892, 7896, 7900, 7904, 7908, 7912, 7916,
+					7920, 7924, 7928, 7932, 7936, 7940, 7944, 7948, 7952, 7956, 7960, 7964,
+					7968, 7972, 7976, 7980, 7984, 7988, 7992, 7996, 8000, 8004, 8008, 8012,
+					8016, 8020, 8024, 8028, 8032, 8036, 8040, 8044, 8048, 8052, 8056, 8060,
+					8064, 8068, 8072, 8076, 8080, 8084, 8088, 8092, 8096, 8100, 8104, 8108,
+					8112, 8116, 8120, 8124, 8128, 8132, 8136, 8140, 8144, 8148, 8152, 8156,
+					8160, 8164, 8168, 8172, 8176, 8180, 8184, 8188,
+			};
+
+			constexpr char BIP39PoolFrench[] =
+					"abaisser\0"
+					"abandon\0"
+					"abdiquer\0"
+					"abeille\0"
+					"abolir\0"
+					"aborder\0"
+					"aboutir\0"
+					"aboyer\0"
+					"abrasif\0"
+					"abreuver\0"
+					"abriter\0"
+					"abroger\0"
+					"abrupt\0"
+					"absence\0"
+					"absolu\0"
+					"absurde\0"
+					"abusif\0"
+					"abyssal\0"
+					"académie\0"
+					"acajou\0"
+					"acarien\0"
+					"accabler\0"
+					"accepter\0"
+					"acclamer\0"
+					"accolade\0"
+					"accroche\0"
+					"accuser\0"
+					"acerbe\0"
+					"achat\0"
+					"acheter\0"
+					"aciduler\0"
+					"acier\0"
+					"acompte\0"
+					"acquérir\0"
+					"acronyme\0"
+					"acteur\0"
+					"actif\0"
+					"actuel\0"
+					"adepte\0"
+					"adéquat\0"
+					"adhésif\0"
+					"adjectif\0"
+					"adjuger\0"
+					"admettre\0"
+					"admirer\0"
+					"adopter\0"
+					"adorer\0"
+					"adoucir\0"
+					"adresse\0"
+					"adroit\0"
+					"adulte\0"
+					"adverbe\0"
+					"aérer\0"
+					"aéronef\0"
+					"affaire\0"
+					"affecter\0"
+					"affiche\0"
+					"affreux\0"
+					"affubler\0"
+					"agacer\0"
+					"agencer\0"
+					"agile\0"
+					"agiter\0"
+					"agrafer\0"
+					"agréable\0"
+					"agrume\0"
+					"aider\0"
+					"aiguille\0"
+					"ailier\0"
+					"aimable\0"
+					"aisance\0"
+					"ajouter\0"
+					"ajuster\0"
+					"alarmer\0"
+					"alchimie\0"
+					"alerte\0"
+					"algèbre\0"
+					"algue\0"
+					"aliéner\0"
+					"aliment\0"
+					"alléger\0"
+					"alliage\0"
+					"allouer\0"
+					"allumer\0"
+					"alourdir\0"
+					"alpaga\0"
+					"altesse\0"
+					"alvéole\0"
+					"amateur\0"
+					"ambigu\0"
+					"ambre\0"
+					"aménager\0"
+					"amertume\0"
+					"amidon\0"
+					"amiral\0"
+					"amorcer\0"
+					"amour\0"
+					"amovible\0"
+					"amphibie\0"
+					"ampleur\0"
+					"amusant\0"
+					"analyse\0"
+					"anaphore\0"
+					"anarchie\0"
+					"anatomie\0"
+					"ancien\0"
+					"anéantir\0"
+					"angle\0"
+					"angoisse\0"
+					"anguleux\0"
+					"animal\0"
+					"annexer\0"
+					"annonce\0"
+					"annuel\0"
+					"anodin\0"
+					"anomalie\0"
+					"anonyme\0"
+					"anormal\0"
+					"antenne\0"
+					"antidote\0"
+					"anxieux\0"
+					"apaiser\0"
+					"apéritif\0"
+					"aplanir\0"
+					"apologie\0"
+					"appareil\0"
+					"appeler\0"
+					"apporter\0"
+					"appuyer\0"
+					"aquarium\0"
+					"aqueduc\0"
+					"arbitre\0"
+					"arbuste\0"
+					"ardeur\0"
+					"ardoise\0"
+					"argent\0"
+					"arlequin\0"
+					"armature\0"
+					"armement\0"
+					"armoire\0"
+					"armure\0"
+					"arpenter\0"
+					"arracher\0"
+					"arriver\0"
+					"arroser\0"
+					"arsenic\0"
+					"artériel\0"
+					"article\0"
+					"aspect\0"
+					"asphalte\0"
+					"aspirer\0"
+					"assaut\0"
+					"asservir\0"
+					"assiette\0"
+					"associer\0"
+					"assurer\0"
+					"asticot\0"
+					"astre\0"
+					"astuce\0"
+					"atelier\0"
+					"atome\0"
+					"atrium\0"
+					"atroce\0"
+					"attaque\0"
+					"attentif\0"
+					"attirer\0"
+					"attraper\0"
+					"aubaine\0"
+					"auberge\0"
+					"audace\0"
+					"audible\0"
+					"augurer\0"
+					"aurore\0"
+					"automne\0"
+					"autruche\0"
+					"avaler\0"
+					"avancer\0"
+					"avarice\0"
+					"avenir\0"
+					"averse\0"
+					"aveugle\0"
+					"aviateur\0"
+					"avide\0"
+					"avion\0"
+					"aviser\0"
+					"avoine\0"
+					"avouer\0"
+					"avril\0"
+					"axial\0"
+					"axiome\0"
+					"badge\0"
+					"bafouer\0"
+					"bagage\0"
+					"baguette\0"
+					"baignade\0"
+					"balancer\0"
+					"balcon\0"
+					"baleine\0"
+					"balisage\0"
+					"bambin\0"
+					"bancaire\0"
+					"bandage\0"
+					"banlieue\0"
+					"bannière\0"
+					"banquier\0"
+					"barbier\0"
+					"baril\0"
+					"baron\0"
+					"barque\0"
+					"barrage\0"
+					"bassin\0"
+					"bastion\0"
+					"bataille\0"
+					"bateau\0"
+					"batterie\0"
+					"baudrier\0"
+					"bavarder\0"
+					"belette\0"
+					"bélier\0"
+					"belote\0"
+					"bénéfice\0"
+					"berceau\0"
+					"berger\0"
+					"berline\0"
+					"bermuda\0"
+					"besace\0"
+					"besogne\0"
+					"bétail\0"
+					"beurre\0"
+					"biberon\0"
+					"bicycle\0"
+					"bidule\0"
+					"bijou\0"
+					"bilan\0"
+					"bilingue\0"
+					"billard\0"
+					"binaire\0"
+					"biologie\0"
+					"biopsie\0"
+					"biotype\0"
+					"biscuit\0"
+					"bison\0"
+					"bistouri\0"
+					"bitume\0"
+					"bizarre\0"
+					"blafard\0"
+					"blague\0"
+					"blanchir\0"
+					"blessant\0"
+					"blinder\0"
+					"blond\0"
+					"bloquer\0"
+					"blouson\0"
+					"bobard\0"
+					"bobine\0"
+					"boire\0"
+					"boiser\0"
+					"bolide\0"
+					"bonbon\0"
+					"bondir\0"
+					"bonheur\0"
+					"bonifier\0"
+					"bonus\0"
+					"bordure\0"
+					"borne\0"
+					"botte\0"
+					"boucle\0"
+					"boueux\0"
+					"bougie\0"
+					"boulon\0"
+					"bouquin\0"
+					"bourse\0"
+					"boussole\0"
+					"boutique\0"
+					"boxeur\0"
+					"branche\0"
+					"brasier\0"
+					"brave\0"
+					"brebis\0"
+					"brèche\0"
+					"breuvage\0"
+					"bricoler\0"
+					"brigade\0"
+					"brillant\0"
+					"brioche\0"
+					"brique\0"
+					"brochure\0"
+					"broder\0"
+					"bronzer\0"
+					"brousse\0"
+					"broyeur\0"
+					"brume\0"
+					"brusque\0"
+					"brutal\0"
+					"bruyant\0"
+					"buffle\0"
+					"buisson\0"
+					"bulletin\0"
+					"bureau\0"
+					"burin\0"
+					"bustier\0"
+					"butiner\0"
+					"butoir\0"
+					"buvable\0"
+					"buvette\0"
+					"cabanon\0"
+					"cabine\0"
+					"cachette\0"
+					"cadeau\0"
+					"cadre\0"
+					"caféine\0"
+					"caillou\0"
+					"caisson\0"
+					"calculer\0"
+					"calepin\0"
+					"calibre\0"
+					"calmer\0"
+					"calomnie\0"
+					"calvaire\0"
+					"camarade\0"
+					"caméra\0"
+					"camion\0"
+					"campagne\0"
+					"canal\0"
+					"caneton\0"
+					"canon\0"
+					"cantine\0"
+					"canular\0"
+					"capable\0"
+					"caporal\0"
+					"caprice\0"
+					"capsule\0"
+					"capter\0"
+					"capuche\0"
+					"carabine\0"
+					"carbone\0"
+					"caresser\0"
+					"caribou\0"
+					"carnage\0"
+					"carotte\0"
+					"carreau\0"
+					"carton\0"
+					"cascade\0"
+					"casier\0"
+					"casque\0"
+					"cassure\0"
+					"causer\0"
+					"caution\0"
+					"cavalier\0"
+					"caverne\0"
+					"caviar\0"
+					"cédille\0"
+					"ceinture\0"
+					"céleste\0"
+					"cellule\0"
+					"cendrier\0"
+					"censurer\0"
+					"central\0"
+					"cercle\0"
+					"cérébral\0"
+					"cerise\0"
+					"cerner\0"
+					"cerveau\0"
+					"cesser\0"
+					"chagrin\0"
+					"chaise\0"
+					"chaleur\0"
+					"chambre\0"
+					"chance\0"
+					"chapitre\0"
+					"charbon\0"
+					"chasseur\0"
+					"chaton\0"
+					"chausson\0"
+					"chavirer\0"
+					"chemise\0"
+					"chenille\0"
+					"chéquier\0"
+					"chercher\0"
+					"cheval\0"
+					"chien\0"
+					"chiffre\0"
+					"chignon\0"
+					"chimère\0"
+					"chiot\0"
+					"chlorure\0"
+					"chocolat\0"
+					"choisir\0"
+					"chose\0"
+					"chouette\0"
+					"chrome\0"
+					"chute\0"
+					"cigare\0"
+					"cigogne\0"
+					"cimenter\0"
+					"cinéma\0"
+					"cintrer\0"
+					"circuler\0"
+					"cirer\0"
+					"cirque\0"
+					"citerne\0"
+					"citoyen\0"
+					"citron\0"
+					"civil\0"
+					"clairon\0"
+					"clameur\0"
+					"claquer\0"
+					"classe\0"
+					"clavier\0"
+					"client\0"
+					"cligner\0"
+					"climat\0"
+					"clivage\0"
+					"cloche\0"
+					"clonage\0"
+					"cloporte\0"
+					"cobalt\0"
+					"cobra\0"
+					"cocasse\0"
+					"cocotier\0"
+					"coder\0"
+					"codifier\0"
+					"coffre\0"
+					"cogner\0"
+					"cohésion\0"
+					"coiffer\0"
+					"coincer\0"
+					"colère\0"
+					"colibri\0"
+					"colline\0"
+					"colmater\0"
+					"colonel\0"
+					"combat\0"
+					"comédie\0"
+					"commande\0"
+					"compact\0"
+					"concert\0"
+					"conduire\0"
+					"confier\0"
+					"congeler\0"
+					"connoter\0"
+					"consonne\0"
+					"contact\0"
+					"convexe\0"
+					"copain\0"
+					"copie\0"
+					"corail\0"
+					"corbeau\0"
+					"cordage\0"
+					"corniche\0"
+					"corpus\0"
+					"correct\0"
+					"cortège\0"
+					"cosmique\0"
+					"costume\0"
+					"coton\0"
+					"coude\0"
+					"coupure\0"
+					"courage\0"
+					"couteau\0"
+					"couvrir\0"
+					"coyote\0"
+					"crabe\0"
+					"crainte\0"
+					"cravate\0"
+					"crayon\0"
+					"créature\0"
+					"créditer\0"
+					"crémeux\0"
+					"creuser\0"
+					"crevette\0"
+					"cribler\0"
+					"crier\0"
+					"cristal\0"
+					"critère\0"
+					"croire\0"
+					"croquer\0"
+					"crotale\0"
+					"crucial\0"
+					"cruel\0"
+					"crypter\0"
+					"cubique\0"
+					"cueillir\0"
+					"cuillère\0"
+					"cuisine\0"
+					"cuivre\0"
+					"culminer\0"
+					"cultiver\0"
+					"cumuler\0"
+					"cupide\0"
+					"curatif\0"
+					"curseur\0"
+					"cyanure\0"
+					"cycle\0"
+					"cylindre\0"
+					"cynique\0"
+					"daigner\0"
+					"damier\0"
+					"danger\0"
+					"danseur\0"
+					"dauphin\0"
+					"débattre\0"
+					"débiter\0"
+					"déborder\0"
+					"débrider\0"
+					"débutant\0"
+					"décaler\0"
+					"décembre\0"
+					"déchirer\0"
+					"décider\0"
+					"déclarer\0"
+					"décorer\0"
+					"décrire\0"
+					"décupler\0"
+					"dédale\0"
+					"déductif\0"
+					"déesse\0"
+					"défensif\0"
+					"défiler\0"
+					"défrayer\0"
+					"dégager\0"
+					"dégivrer\0"
+					"déglutir\0"
+					"dégrafer\0"
+					"déjeuner\0"
+					"délice\0"
+					"déloger\0"
+					"demander\0"
+					"demeurer\0"
+					"démolir\0"
+					"dénicher\0"
+					"dénouer\0"
+					"dentelle\0"
+					"dénuder\0"
+					"départ\0"
+					"dépenser\0"
+					"déphaser\0"
+					"déplacer\0"
+					"déposer\0"
+					"déranger\0"
+					"dérober\0"
+					"désastre\0"
+					"descente\0"
+					"désert\0"
+					"désigner\0"
+					"désobéir\0"
+					"dessiner\0"
+					"destrier\0"
+					"détacher\0"
+					"détester\0"
+					"détourer\0"
+					"détresse\0"
+					"devancer\0"
+					"devenir\0"
+					"deviner\0"
+					"devoir\0"
+					"diable\0"
+					"dialogue\0"
+					"diamant\0"
+					"dicter\0"
+					"différer\0"
+					"digérer\0"
+					"digital\0"
+					"digne\0"
+					"diluer\0"
+					"dimanche\0"
+					"diminuer\0"
+					"dioxyde\0"
+					"directif\0"
+					"diriger\0"
+					"discuter\0"
+					"disposer\0"
+					"dissiper\0"
+					"distance\0"
+					"divertir\0"
+					"diviser\0"
+					"docile\0"
+					"docteur\0"
+					"dogme\0"
+					"doigt\0"
+					"domaine\0"
+					"domicile\0"
+					"dompter\0"
+					"donateur\0"
+					"donjon\0"
+					"donner\0"
+					"dopamine\0"
+					"dortoir\0"
+					"dorure\0"
+					"dosage\0"
+					"doseur\0"
+					"dossier\0"
+					"dotation\0"
+					"douanier\0"
+					"double\0"
+					"douceur\0"
+					"douter\0"
+					"doyen\0"
+					"dragon\0"
+					"draper\0"
+					"dresser\0"
+					"dribbler\0"
+					"droiture\0"
+					"duperie\0"
+					"duplexe\0"
+					"durable\0"
+					"durcir\0"
+					"dynastie\0"
+					"éblouir\0"
+					"écarter\0"
+					"écharpe\0"
+					"échelle\0"
+					"éclairer\0"
+					"éclipse\0"
+					"éclore\0"
+					"écluse\0"
+					"école\0"
+					"économie\0"
+					"écorce\0"
+					"écouter\0"
+					"écraser\0"
+					"écrémer\0"
+					"écrivain\0"
+					"écrou\0"
+					"écume\0"
+					"écureuil\0"
+					"édifier\0"
+					"éduquer\0"
+					"effacer\0"
+					"effectif\0"
+					"effigie\0"
+					"effort\0"
+					"effrayer\0"
+					"effusion\0"
+					"égaliser\0"
+					"égarer\0"
+					"éjecter\0"
+					"élaborer\0"
+					"élargir\0"
+					"électron\0"
+					"élégant\0"
+					"éléphant\0"
+					"élève\0"
+					"éligible\0"
+					"élitisme\0"
+					"éloge\0"
+					"élucider\0"
+					"éluder\0"
+					"emballer\0"
+					"embellir\0"
+					"embryon\0"
+					"émeraude\0"
+					"émission\0"
+					"emmener\0"
+					"émotion\0"
+					"émouvoir\0"
+					"empereur\0"
+					"employer\0"
+					"emporter\0"
+					"emprise\0"
+					"émulsion\0"
+					"encadrer\0"
+					"enchère\0"
+					"enclave\0"
+					"encoche\0"
+					"endiguer\0"
+					"endosser\0"
+					"endroit\0"
+					"enduire\0"
+					"énergie\0"
+					"enfance\0"
+					"enfermer\0"
+					"enfouir\0"
+					"engager\0"
+					"engin\0"
+					"englober\0"
+					"énigme\0"
+					"enjamber\0"
+					"enjeu\0"
+					"enlever\0"
+					"ennemi\0"
+					"ennuyeux\0"
+					"enrichir\0"
+					"enrobage\0"
+					"enseigne\0"
+					"entasser\0"
+					"entendre\0"
+					"entier\0"
+					"entourer\0"
+					"entraver\0"
+					"énumérer\0"
+					"envahir\0"
+					"enviable\0"
+					"envoyer\0"
+					"enzyme\0"
+					"éolien\0"
+					"épaissir\0"
+					"épargne\0"
+					"épatant\0"
+					"épaule\0"
+					"épicerie\0"
+					"épidémie\0"
+					"épier\0"
+					"épilogue\0"
+					"épine\0"
+					"épisode\0"
+					"épitaphe\0"
+					"époque\0"
+					"épreuve\0"
+					"éprouver\0"
+					"épuisant\0"
+					"équerre\0"
+					"équipe\0"
+					"ériger\0"
+					"érosion\0"
+					"erreur\0"
+					"éruption\0"
+					"escalier\0"
+					"espadon\0"
+					"espèce\0"
+					"espiègle\0"
+					"espoir\0"
+					"esprit\0"
+					"esquiver\0"
+					"essayer\0"
+					"essence\0"
+					"essieu\0"
+					"essorer\0"
+					"estime\0"
+					"estomac\0"
+					"estrade\0"
+					"étagère\0"
+					"étaler\0"
+					"étanche\0"
+					"étatique\0"
+					"éteindre\0"
+					"étendoir\0"
+					"éternel\0"
+					"éthanol\0"
+					"éthique\0"
+					"ethnie\0"
+					"étirer\0"
+					"étoffer\0"
+					"étoile\0"
+					"étonnant\0"
+					"étourdir\0"
+					"étrange\0"
+					"étroit\0"
+					"étude\0"
+					"euphorie\0"
+					"évaluer\0"
+					"évasion\0"
+					"éventail\0"
+					"évidence\0"
+					"éviter\0"
+					"évolutif\0"
+					"évoquer\0"
+					"exact\0"
+					"exagérer\0"
+					"exaucer\0"
+					"exceller\0"
+					"excitant\0"
+					"exclusif\0"
+					"excuse\0"
+					"exécuter\0"
+					"exemple\0"
+					"exercer\0"
+					"exhaler\0"
+					"exhorter\0"
+					"exigence\0"
+					"exiler\0"
+					"exister\0"
+					"exotique\0"
+					"expédier\0"
+					"explorer\0"
+					"exposer\0"
+					"exprimer\0"
+					"exquis\0"
+					"extensif\0"
+					"extraire\0"
+					"exulter\0"
+					"fable\0"
+					"fabuleux\0"
+					"facette\0"
+					"facile\0"
+					"facture\0"
+					"faiblir\0"
+					"falaise\0"
+					"fameux\0"
+					"famille\0"
+					"farceur\0"
+					"farfelu\0"
+					"farine\0"
+					"farouche\0"
+					"fasciner\0"
+					"fatal\0"
+					"fatigue\0"
+					"faucon\0"
+					"fautif\0"
+					"faveur\0"
+					"favori\0"
+					"fébrile\0"
+					"féconder\0"
+					"fédérer\0"
+					"félin\0"
+					"femme\0"
+					"fémur\0"
+					"fendoir\0"
+					"féodal\0"
+					"fermer\0"
+					"féroce\0"
+					"ferveur\0"
+					"festival\0"
+					"feuille\0"
+					"feutre\0"
+					"février\0"
+					"fiasco\0"
+					"ficeler\0"
+					"fictif\0"
+					"fidèle\0"
+					"figure\0"
+					"filature\0"
+					"filetage\0"
+					"filière\0"
+					"filleul\0"
+					"filmer\0"
+					"filou\0"
+					"filtrer\0"
+					"financer\0"
+					"finir\0"
+					"fiole\0"
+					"firme\0"
+					"fissure\0"
+					"fixer\0"
+					"flairer\0"
+					"flamme\0"
+					"flasque\0"
+					"flatteur\0"
+					"fléau\0"
+					"flèche\0"
+					"fleur\0"
+					"flexion\0"
+					"flocon\0"
+					"flore\0"
+					"fluctuer\0"
+					"fluide\0"
+					"fluvial\0"
+					"folie\0"
+					"fonderie\0"
+					"fongible\0"
+					"fontaine\0"
+					"forcer\0"
+					"forgeron\0"
+					"formuler\0"
+					"fortune\0"
+					"fossile\0"
+					"foudre\0"
+					"fougère\0"
+					"fouiller\0"
+					"foulure\0"
+					"fourmi\0"
+					"fragile\0"
+					"fraise\0"
+					"franchir\0"
+					"frapper\0"
+					"frayeur\0"
+					"frégate\0"
+					"freiner\0"
+					"frelon\0"
+					"frémir\0"
+					"frénésie\0"
+					"frère\0"
+					"friable\0"
+					"friction\0"
+					"frisson\0"
+					"frivole\0"
+					"froid\0"
+					"fromage\0"
+					"frontal\0"
+					"frotter\0"
+					"fruit\0"
+					"fugitif\0"
+					"fuite\0"
+					"fureur\0"
+					"furieux\0"
+					"furtif\0"
+					"fusion\0"
+					"futur\0"
+					"gagner\0"
+					"galaxie\0"
+					"galerie\0"
+					"gambader\0"
+					"garantir\0"
+					"gardien\0"
+					"garnir\0"
+					"garrigue\0"
+					"gazelle\0"
+					"gazon\0"
+					"géant\0"
+					"gélatine\0"
+					"gélule\0"
+					"gendarme\0"
+					"général\0"
+					"génie\0"
+					"genou\0"
+					"gentil\0"
+					"géologie\0"
+					"géomètre\0"
+					"géranium\0"
+					"germe\0"
+					"gestuel\0"
+					"geyser\0"
+					"gibier\0"
+					"gicler\0"
+					"girafe\0"
+					"givre\0"
+					"glace\0"
+					"glaive\0"
+					"glisser\0"
+					"globe\0"
+					"gloire\0"
+					"glorieux\0"
+					"golfeur\0"
+					"gomme\0"
+					"gonfler\0"
+					"gorge\0"
+					"gorille\0"
+					"goudron\0"
+					"gouffre\0"
+					"goulot\0"
+					"goupille\0"
+					"gourmand\0"
+					"goutte\0"
+					"graduel\0"
+					"graffiti\0"
+					"graine\0"
+					"grand\0"
+					"grappin\0"
+					"gratuit\0"
+					"gravir\0"
+					"grenat\0"
+					"griffure\0"
+					"griller\0"
+					"grimper\0"
+					"grogner\0"
+					"gronder\0"
+					"grotte\0"
+					"groupe\0"
+					"gruger\0"
+					"grutier\0"
+					"gruyère\0"
+					"guépard\0"
+					"guerrier\0"
+					"guide\0"
+					"guimauve\0"
+					"guitare\0"
+					"gustatif\0"
+					"gymnaste\0"
+					"gyrostat\0"
+					"habitude\0"
+					"hachoir\0"
+					"halte\0"
+					"hameau\0"
+					"hangar\0"
+					"hanneton\0"
+					"haricot\0"
+					"harmonie\0"
+					"harpon\0"
+					"hasard\0"
+					"hélium\0"
+					"hématome\0"
+					"herbe\0"
+					"hérisson\0"
+					"hermine\0"
+					"héron\0"
+					"hésiter\0"
+					"heureux\0"
+					"hiberner\0"
+					"hibou\0"
+					"hilarant\0"
+					"histoire\0"
+					"hiver\0"
+					"homard\0"
+					"hommage\0"
+					"homogène\0"
+					"honneur\0"
+					"honorer\0"
+					"honteux\0"
+					"horde\0"
+					"horizon\0"
+					"horloge\0"
+					"hormone\0"
+					"horrible\0"
+					"houleux\0"
+					"housse\0"
+					"hublot\0"
+					"huileux\0"
+					"humain\0"
+					"humble\0"
+					"humide\0"
+					"humour\0"
+					"hurler\0"
+					"hydromel\0"
+					"hygiène\0"
+					"hymne\0"
+					"hypnose\0"
+					"idylle\0"
+					"ignorer\0"
+					"iguane\0"
+					"illicite\0"
+					"illusion\0"
+					"image\0"
+					"imbiber\0"
+					"imiter\0"
+					"immense\0"
+					"immobile\0"
+					"immuable\0"
+					"impact\0"
+					"impérial\0"
+					"implorer\0"
+					"imposer\0"
+					"imprimer\0"
+					"imputer\0"
+					"incarner\0"
+					"incendie\0"
+					"incident\0"
+					"incliner\0"
+					"incolore\0"
+					"indexer\0"
+					"indice\0"
+					"inductif\0"
+					"inédit\0"
+					"ineptie\0"
+					"inexact\0"
+					"infini\0"
+					"infliger\0"
+					"informer\0"
+					"infusion\0"
+					"ingérer\0"
+					"inhaler\0"
+					"inhiber\0"
+					"injecter\0"
+					"injure\0"
+					"innocent\0"
+					"inoculer\0"
+					"inonder\0"
+					"inscrire\0"
+					"insecte\0"
+					"insigne\0"
+					"insolite\0"
+					"inspirer\0"
+					"instinct\0"
+					"insulter\0"
+					"intact\0"
+					"intense\0"
+					"intime\0"
+					"intrigue\0"
+					"intuitif\0"
+					"inutile\0"
+					"invasion\0"
+					"inventer\0"
+					"inviter\0"
+					"invoquer\0"
+					"ironique\0"
+					"irradier\0"
+					"irréel\0"
+					"irriter\0"
+					"isoler\0"
+					"ivoire\0"
+					"ivresse\0"
+					"jaguar\0"
+					"jaillir\0"
+					"jambe\0"
+					"janvier\0"
+					"jardin\0"
+					"jauger\0"
+					"jaune\0"
+					"javelot\0"
+					"jetable\0"
+					"jeton\0"
+					"jeudi\0"
+					"jeunesse\0"
+					"joindre\0"
+					"joncher\0"
+					"jongler\0"
+					"joueur\0"
+					"jouissif\0"
+					"journal\0"
+					"jovial\0"
+					"joyau\0"
+					"joyeux\0"
+					"jubiler\0"
+					"jugement\0"
+					"junior\0"
+					"jupon\0"
+					"juriste\0"
+					"justice\0"
+					"juteux\0"
+					"juvénile\0"
+					"kayak\0"
+					"kimono\0"
+					"kiosque\0"
+					"label\0"
+					"labial\0"
+					"labourer\0"
+					"lacérer\0"
+					"lactose\0"
+					"lagune\0"
+					"laine\0"
+					"laisser\0"
+					"laitier\0"
+					"lambeau\0"
+					"lamelle\0"
+					"lampe\0"
+					"lanceur\0"
+					"langage\0"
+					"lanterne\0"
+					"lapin\0"
+					"largeur\0"
+					"larme\0"
+					"laurier\0"
+					"lavabo\0"
+					"lavoir\0"
+					"lecture\0"
+					"légal\0"
+					"léger\0"
+					"légume\0"
+					"lessive\0"
+					"lettre\0"
+					"levier\0"
+					"lexique\0"
+					"lézard\0"
+					"liasse\0"
+					"libérer\0"
+					"libre\0"
+					"licence\0"
+					"licorne\0"
+					"liège\0"
+					"lièvre\0"
+					"ligature\0"
+					"ligoter\0"
+					"ligue\0"
+					"limer\0"
+					"limite\0"
+					"limonade\0"
+					"limpide\0"
+					"linéaire\0"
+					"lingot\0"
+					"lionceau\0"
+					"liquide\0"
+					"lisière\0"
+					"lister\0"
+					"lithium\0"
+					"litige\0"
+					"littoral\0"
+					"livreur\0"
+					"logique\0"
+					"lointain\0"
+					"loisir\0"
+					"lombric\0"
+					"loterie\0"
+					"louer\0"
+					"lourd\0"
+					"loutre\0"
+					"louve\0"
+					"loyal\0"
+					"lubie\0"
+					"lucide\0"
+					"lucratif\0"
+					"lueur\0"
+					"lugubre\0"
+					"luisant\0"
+					"lumière\0"
+					"lunaire\0"
+					"lundi\0"
+					"luron\0"
+					"lutter\0"
+					"luxueux\0"
+					"machine\0"
+					"magasin\0"
+					"magenta\0"
+					"magique\0"
+					"maigre\0"
+					"maillon\0"
+					"maintien\0"
+					"mairie\0"
+					"maison\0"
+					"majorer\0"
+					"malaxer\0"
+					"maléfice\0"
+					"malheur\0"
+					"malice\0"
+					"mallette\0"
+					"mammouth\0"
+					"mandater\0"
+					"maniable\0"
+					"manquant\0"
+					"manteau\0"
+					"manuel\0"
+					"marathon\0"
+					"marbre\0"
+					"marchand\0"
+					"mardi\0"
+					"maritime\0"
+					"marqueur\0"
+					"marron\0"
+					"marteler\0"
+					"mascotte\0"
+					"massif\0"
+					"matériel\0"
+					"matière\0"
+					"matraque\0"
+					"maudire\0"
+					"maussade\0"
+					"mauve\0"
+					"maximal\0"
+					"méchant\0"
+					"méconnu\0"
+					"médaille\0"
+					"médecin\0"
+					"méditer\0"
+					"méduse\0"
+					"meilleur\0"
+					"mélange\0"
+					"mélodie\0"
+					"membre\0"
+					"mémoire\0"
+					"menacer\0"
+					"mener\0"
+					"menhir\0"
+					"mensonge\0"
+					"mentor\0"
+					"mercredi\0"
+					"mérite\0"
+					"merle\0"
+					"messager\0"
+					"mesure\0"
+					"métal\0"
+					"météore\0"
+					"méthode\0"
+					"métier\0"
+					"meuble\0"
+					"miauler\0"
+					"microbe\0"
+					"miette\0"
+					"mignon\0"
+					"migrer\0"
+					"milieu\0"
+					"million\0"
+					"mimique\0"
+					"mince\0"
+					"minéral\0"
+					"minimal\0"
+					"minorer\0"
+					"minute\0"
+					"miracle\0"
+					"miroiter\0"
+					"missile\0"
+					"mixte\0"
+					"mobile\0"
+					"moderne\0"
+					"moelleux\0"
+					"mondial\0"
+					"moniteur\0"
+					"monnaie\0"
+					"monotone\0"
+					"monstre\0"
+					"montagne\0"
+					"monument\0"
+					"moqueur\0"
+					"morceau\0"
+					"morsure\0"
+					"mortier\0"
+					"moteur\0"
+					"motif\0"
+					"mouche\0"
+					"moufle\0"
+					"moulin\0"
+					"mousson\0"
+					"mouton\0"
+					"mouvant\0"
+					"multiple\0"
+					"munition\0"
+					"muraille\0"
+					"murène\0"
+					"murmure\0"
+					"muscle\0"
+					"muséum\0"
+					"musicien\0"
+					"mutation\0"
+					"muter\0"
+					"mutuel\0"
+					"myriade\0"
+					"myrtille\0"
+					"mystère\0"
+					"mythique\0"
+					"nageur\0"
+					"nappe\0"
+					"narquois\0"
+					"narrer\0"
+					"natation\0"
+					"nation\0"
+					"nature\0"
+					"naufrage\0"
+					"nautique\0"
+					"navire\0"
+					"nébuleux\0"
+					"nectar\0"
+					"néfaste\0"
+					"négation\0"
+					"négliger\0"
+					"négocier\0"
+					"neige\0"
+					"nerveux\0"
+					"nettoyer\0"
+					"neurone\0"
+					"neutron\0"
+					"neveu\0"
+					"niche\0"
+					"nickel\0"
+					"nitrate\0"
+					"niveau\0"
+					"noble\0"
+					"nocif\0"
+					"nocturne\0"
+					"noirceur\0"
+					"noisette\0"
+					"nomade\0"
+					"nombreux\0"
+					"nommer\0"
+					"normatif\0"
+					"notable\0"
+					"notifier\0"
+					"notoire\0"
+					"nourrir\0"
+					"nouveau\0"
+					"novateur\0"
+					"novembre\0"
+					"novice\0"
+					"nuage\0"
+					"nuancer\0"
+					"nuire\0"
+					"nuisible\0"
+					"numéro\0"
+					"nuptial\0"
+					"nuque\0"
+					"nutritif\0"
+					"obéir\0"
+					"objectif\0"
+					"obliger\0"
+					"obscur\0"
+					"observer\0"
+					"obstacle\0"
+					"obtenir\0"
+					"obturer\0"
+					"occasion\0"
+					"occuper\0"
+					"océan\0"
+					"octobre\0"
+					"octroyer\0"
+					"octupler\0"
+					"oculaire\0"
+					"odeur\0"
+					"odorant\0"
+					"offenser\0"
+					"officier\0"
+					"offrir\0"
+					"ogive\0"
+					"oiseau\0"
+					"oisillon\0"
+					"olfactif\0"
+					"olivier\0"
+					"ombrage\0"
+					"omettre\0"
+					"onctueux\0"
+					"onduler\0"
+					"onéreux\0"
+					"onirique\0"
+					"opale\0"
+					"opaque\0"
+					"opérer\0"
+					"opinion\0"
+					"opportun\0"
+					"opprimer\0"
+					"opter\0"
+					"optique\0"
+					"orageux\0"
+					"orange\0"
+					"orbite\0"
+					"ordonner\0"
+					"oreille\0"
+					"organe\0"
+					"orgueil\0"
+					"orifice\0"
+					"ornement\0"
+					"orque\0"
+					"ortie\0"
+					"osciller\0"
+					"osmose\0"
+					"ossature\0"
+					"otarie\0"
+					"ouragan\0"
+					"ourson\0"
+					"outil\0"
+					"outrager\0"
+					"ouvrage\0"
+					"ovation\0"
+					"oxyde\0"
+					"oxygène\0"
+					"ozone\0"
+					"paisible\0"
+					"palace\0"
+					"palmarès\0"
+					"palourde\0"
+					"palper\0"
+					"panache\0"
+					"panda\0"
+					"pangolin\0"
+					"paniquer\0"
+					"panneau\0"
+					"panorama\0"
+					"pantalon\0"
+					"papaye\0"
+					"papier\0"
+					"papoter\0"
+					"papyrus\0"
+					"paradoxe\0"
+					"parcelle\0"
+					"paresse\0"
+					"parfumer\0"
+					"parler\0"
+					"parole\0"
+					"parrain\0"
+					"parsemer\0"
+					"partager\0"
+					"parure\0"
+					"parvenir\0"
+					"passion\0"
+					"pastèque\0"
+					"paternel\0"
+					"patience\0"
+					"patron\0"
+					"pavillon\0"
+					"pavoiser\0"
+					"payer\0"
+					"paysage\0"
+					"peigne\0"
+					"peintre\0"
+					"pelage\0"
+					"pélican\0"
+					"pelle\0"
+					"pelouse\0"
+					"peluche\0"
+					"pendule\0"
+					"pénétrer\0"
+					"pénible\0"
+					"pensif\0"
+					"pénurie\0"
+					"pépite\0"
+					"péplum\0"
+					"perdrix\0"
+					"perforer\0"
+					"période\0"
+					"permuter\0"
+					"perplexe\0"
+					"persil\0"
+					"perte\0"
+					"peser\0"
+					"pétale\0"
+					"petit\0"
+					"pétrir\0"
+					"peuple\0"
+					"pharaon\0"
+					"phobie\0"
+					"phoque\0"
+					"photon\0"
+					"phrase\0"
+					"physique\0"
+					"piano\0"
+					"pictural\0"
+					"pièce\0"
+					"pierre\0"
+					"pieuvre\0"
+					"pilote\0"
+					"pinceau\0"
+					"pipette\0"
+					"piquer\0"
+					"pirogue\0"
+					"piscine\0"
+					"piston\0"
+					"pivoter\0"
+					"pixel\0"
+					"pizza\0"
+					"placard\0"
+					"plafond\0"
+					"plaisir\0"
+					"planer\0"
+					"plaque\0"
+					"plastron\0"
+					"plateau\0"
+					"pleurer\0"
+					"plexus\0"
+					"pliage\0"
+					"plomb\0"
+					"plonger\0"
+					"pluie\0"
+					"plumage\0"
+					"pochette\0"
+					"poésie\0"
+					"poète\0"
+					"pointe\0"
+					"poirier\0"
+					"poisson\0"
+					"poivre\0"
+					"polaire\0"
+					"policier\0"
+					"pollen\0"
+					"polygone\0"
+					"pommade\0"
+					"pompier\0"
+					"ponctuel\0"
+					"pondérer\0"
+					"poney\0"
+					"portique\0"
+					"position\0"
+					"posséder\0"
+					"posture\0"
+					"potager\0"
+					"poteau\0"
+					"potion\0"
+					"pouce\0"
+					"poulain\0"
+					"poumon\0"
+					"pourpre\0"
+					"poussin\0"
+					"pouvoir\0"
+					"prairie\0"
+					"pratique\0"
+					"précieux\0"
+					"prédire\0"
+					"préfixe\0"
+					"prélude\0"
+					"prénom\0"
+					"présence\0"
+					"prétexte\0"
+					"prévoir\0"
+					"primitif\0"
+					"prince\0"
+					"prison\0"
+					"priver\0"
+					"problème\0"
+					"procéder\0"
+					"prodige\0"
+					"profond\0"
+					"progrès\0"
+					"proie\0"
+					"projeter\0"
+					"prologue\0"
+					"promener\0"
+					"propre\0"
+					"prospère\0"
+					"protéger\0"
+					"prouesse\0"
+					"proverbe\0"
+					"prudence\0"
+					"pruneau\0"
+					"psychose\0"
+					"public\0"
+					"puceron\0"
+					"puiser\0"
+					"pulpe\0"
+					"pulsar\0"
+					"punaise\0"
+					"punitif\0"
+					"pupitre\0"
+					"purifier\0"
+					"puzzle\0"
+					"pyramide\0"
+					"quasar\0"
+					"querelle\0"
+					"question\0"
+					"quiétude\0"
+					"quitter\0"
+					"quotient\0"
+					"racine\0"
+					"raconter\0"
+					"radieux\0"
+					"ragondin\0"
+					"raideur\0"
+					"raisin\0"
+					"ralentir\0"
+					"rallonge\0"
+					"ramasser\0"
+					"rapide\0"
+					"rasage\0"
+					"ratisser\0"
+					"ravager\0"
+					"ravin\0"
+					"rayonner\0"
+					"réactif\0"
+					"réagir\0"
+					"réaliser\0"
+					"réanimer\0"
+					"recevoir\0"
+					"réciter\0"
+					"réclamer\0"
+					"récolter\0"
+					"recruter\0"
+					"reculer\0"
+					"recycler\0"
+					"rédiger\0"
+					"redouter\0"
+					"refaire\0"
+					"réflexe\0"
+					"réformer\0"
+					"refrain\0"
+					"refuge\0"
+					"régalien\0"
+					"région\0"
+					"réglage\0"
+					"régulier\0"
+					"réitérer\0"
+					"rejeter\0"
+					"rejouer\0"
+					"relatif\0"
+					"relever\0"
+					"relief\0"
+					"remarque\0"
+					"remède\0"
+					"remise\0"
+					"remonter\0"
+					"remplir\0"
+					"remuer\0"
+					"renard\0"
+					"renfort\0"
+					"renifler\0"
+					"renoncer\0"
+					"rentrer\0"
+					"renvoi\0"
+					"replier\0"
+					"reporter\0"
+					"reprise\0"
+					"reptile\0"
+					"requin\0"
+					"réserve\0"
+					"résineux\0"
+					"résoudre\0"
+					"respect\0"
+					"rester\0"
+					"résultat\0"
+					"rétablir\0"
+					"retenir\0"
+					"réticule\0"
+					"retomber\0"
+					"retracer\0"
+					"réunion\0"
+					"réussir\0"
+					"revanche\0"
+					"revivre\0"
+					"révolte\0"
+					"révulsif\0"
+					"richesse\0"
+					"rideau\0"
+					"rieur\0"
+					"rigide\0"
+					"rigoler\0"
+					"rincer\0"
+					"riposter\0"
+					"risible\0"
+					"risque\0"
+					"rituel\0"
+					"rival\0"
+					"rivière\0"
+					"rocheux\0"
+					"romance\0"
+					"rompre\0"
+					"ronce\0"
+					"rondin\0"
+					"roseau\0"
+					"rosier\0"
+					"rotatif\0"
+					"rotor\0"
+					"rotule\0"
+					"rouge\0"
+					"rouille\0"
+					"rouleau\0"
+					"routine\0"
+					"royaume\0"
+					"ruban\0"
+					"rubis\0"
+					"ruche\0"
+					"ruelle\0"
+					"rugueux\0"
+					"ruiner\0"
+					"ruisseau\0"
+					"ruser\0"
+					"rustique\0"
+					"rythme\0"
+					"sabler\0"
+					"saboter\0"
+					"sabre\0"
+					"sacoche\0"
+					"safari\0"
+					"sagesse\0"
+					"saisir\0"
+					"salade\0"
+					"salive\0"
+					"salon\0"
+					"saluer\0"
+					"samedi\0"
+					"sanction\0"
+					"sanglier\0"
+					"sarcasme\0"
+					"sardine\0"
+					"saturer\0"
+					"saugrenu\0"
+					"saumon\0"
+					"sauter\0"
+					"sauvage\0"
+					"savant\0"
+					"savonner\0"
+					"scalpel\0"
+					"scandale\0"
+					"scélérat\0"
+					"scénario\0"
+					"sceptre\0"
+					"schéma\0"
+					"science\0"
+					"scinder\0"
+					"score\0"
+					"scrutin\0"
+					"sculpter\0"
+					"séance\0"
+					"sécable\0"
+					"sécher\0"
+					"secouer\0"
+					"sécréter\0"
+					"sédatif\0"
+					"séduire\0"
+					"seigneur\0"
+					"séjour\0"
+					"sélectif\0"
+					"semaine\0"
+					"sembler\0"
+					"semence\0"
+					"séminal\0"
+					"sénateur\0"
+					"sensible\0"
+					"sentence\0"
+					"séparer\0"
+					"séquence\0"
+					"serein\0"
+					"sergent\0"
+					"sérieux\0"
+					"serrure\0"
+					"sérum\0"
+					"service\0"
+					"sésame\0"
+					"sévir\0"
+					"sevrage\0"
+					"sextuple\0"
+					"sidéral\0"
+					"siècle\0"
+					"siéger\0"
+					"siffler\0"
+					"sigle\0"
+					"signal\0"
+					"silence\0"
+					"silicium\0"
+					"simple\0"
+					"sincère\0"
+					"sinistre\0"
+					"siphon\0"
+					"sirop\0"
+					"sismique\0"
+					"situer\0"
+					"skier\0"
+					"social\0"
+					"socle\0"
+					"sodium\0"
+					"soigneux\0"
+					"soldat\0"
+					"soleil\0"
+					"solitude\0"
+					"soluble\0"
+					"sombre\0"
+					"sommeil\0"
+					"somnoler\0"
+					"sonde\0"
+					"songeur\0"
+					"sonnette\0"
+					"sonore\0"
+					"sorcier\0"
+					"sortir\0"
+					"sosie\0"
+					"sottise\0"
+					"soucieux\0"
+					"soudure\0"
+					"souffle\0"
+					"soulever\0"
+					"soupape\0"
+					"source\0"
+					"soutirer\0"
+					"souvenir\0"
+					"spacieux\0"
+					"spatial\0"
+					"spécial\0"
+					"sphère\0"
+					"spiral\0"
+					"stable\0"
+					"station\0"
+					"sternum\0"
+					"stimulus\0"
+					"stipuler\0"
+					"strict\0"
+					"studieux\0"
+					"stupeur\0"
+					"styliste\0"
+					"sublime\0"
+					"substrat\0"
+					"subtil\0"
+					"subvenir\0"
+					"succès\0"
+					"sucre\0"
+					"suffixe\0"
+					"suggérer\0"
+					"suiveur\0"
+					"sulfate\0"
+					"superbe\0"
+					"supplier\0"
+					"surface\0"
+					"suricate\0"
+					"surmener\0"
+					"surprise\0"
+					"sursaut\0"
+					"survie\0"
+					"suspect\0"
+					"syllabe\0"
+					"symbole\0"
+					"symétrie\0"
+					"synapse\0"
+					"syntaxe\0"
+					"système\0"
+					"tabac\0"
+					"tablier\0"
+					"tactile\0"
+					"tailler\0"
+					"talent\0"
+					"talisman\0"
+					"talonner\0"
+					"tambour\0"
+					"tamiser\0"
+					"tangible\0"
+					"tapis\0"
+					"taquiner\0"
+					"tarder\0"
+					"tarif\0"
+					"tartine\0"
+					"tasse\0"
+					"tatami\0"
+					"tatouage\0"
+					"taupe\0"
+					"taureau\0"
+					"taxer\0"
+					"témoin\0"
+					"temporel\0"
+					"tenaille\0"
+					"tendre\0"
+					"teneur\0"
+					"tenir\0"
+					"tension\0"
+					"terminer\0"
+					"terne\0"
+					"terrible\0"
+					"tétine\0"
+					"texte\0"
+					"thème\0"
+					"théorie\0"
+					"thérapie\0"
+					"thorax\0"
+					"tibia\0"
+					"tiède\0"
+					"timide\0"
+					"tirelire\0"
+					"tiroir\0"
+					"tissu\0"
+					"titane\0"
+					"titre\0"
+					"tituber\0"
+					"toboggan\0"
+					"tolérant\0"
+					"tomate\0"
+					"tonique\0"
+					"tonneau\0"
+					"toponyme\0"
+					"torche\0"
+					"tordre\0"
+					"tornade\0"
+					"torpille\0"
+					"torrent\0"
+					"torse\0"
+					"tortue\0"
+					"totem\0"
+					"toucher\0"
+					"tournage\0"
+					"tousser\0"
+					"toxine\0"
+					"traction\0"
+					"trafic\0"
+					"tragique\0"
+					"trahir\0"
+					"train\0"
+					"trancher\0"
+					"travail\0"
+					"trèfle\0"
+					"tremper\0"
+					"trésor\0"
+					"treuil\0"
+					"triage\0"
+					"tribunal\0"
+					"tricoter\0"
+					"trilogie\0"
+					"triomphe\0"
+					"tripler\0"
+					"triturer\0"
+					"trivial\0"
+					"trombone\0"
+					"tronc\0"
+					"tropical\0"
+					"troupeau\0"
+					"tuile\0"
+					"tulipe\0"
+					"tumulte\0"
+					"tunnel\0"
+					"turbine\0"
+					"tuteur\0"
+					"tutoyer\0"
+					"tuyau\0"
+					"tympan\0"
+					"typhon\0"
+					"typique\0"
+					"tyran\0"
+					"ubuesque\0"
+					"ultime\0"
+					"ultrason\0"
+					"unanime\0"
+					"unifier\0"
+					"union\0"
+					"unique\0"
+					"unitaire\0"
+					"univers\0"
+					"uranium\0"
+					"urbain\0"
+					"urticant\0"
+					"usage\0"
+					"usine\0"
+					"usuel\0"
+					"usure\0"
+					"utile\0"
+					"utopie\0"
+					"vacarme\0"
+					"vaccin\0"
+					"vagabond\0"
+					"vague\0"
+					"vaillant\0"
+					"vaincre\0"
+					"vaisseau\0"
+					"valable\0"
+					"valise\0"
+					"vallon\0"
+					"valve\0"
+					"vampire\0"
+					"vanille\0"
+					"vapeur\0"
+					"varier\0"
+					"vaseux\0"
+					"vassal\0"
+					"vaste\0"
+					"vecteur\0"
+					"vedette\0"
+					"végétal\0"
+					"véhicule\0"
+					"veinard\0"
+					"véloce\0"
+					"vendredi\0"
+					"vénérer\0"
+					"venger\0"
+					"venimeux\0"
+					"ventouse\0"
+					"verdure\0"
+					"vérin\0"
+					"vernir\0"
+					"verrou\0"
+					"verser\0"
+					"vertu\0"
+					"veston\0"
+					"vétéran\0"
+					"vétuste\0"
+					"vexant\0"
+					"vexer\0"
+					"viaduc\0"
+					"viande\0"
+					"victoire\0"
+					"vidange\0"
+					"vidéo\0"
+					"vignette\0"
+					"vigueur\0"
+					"vilain\0"
+					"village\0"
+					"vinaigre\0"
+					"violon\0"
+					"vipère\0"
+					"virement\0"
+					"virtuose\0"
+					"virus\0"
+					"visage\0"
+					"viseur\0"
+					"vision\0"
+					"visqueux\0"
+					"visuel\0"
+					"vital\0"
+					"vitesse\0"
+					"viticole\0"
+					"vitrine\0"
+					"vivace\0"
+					"vivipare\0"
+					"vocation\0"
+					"voguer\0"
+					"voile\0"
+					"voisin\0"
+					"voiture\0"
+					"volaille\0"
+					"volcan\0"
+					"voltiger\0"
+					"volume\0"
+					"vorace\0"
+					"vortex\0"
+					"voter\0"
+					"vouloir\0"
+					"voyage\0"
+					"voyelle\0"
+					"wagon\0"
+					"xénon\0"
+					"yacht\0"
+					"zèbre\0"
+					"zénith\0"
+					"zeste\0"
+					"zoologie\0";
+
+			constexpr uint16_t BIP39OffsetsFrench[BIP39_WORDLIST_COUNT] = {
+					0, 9, 17, 26, 34, 41, 49, 57, 64, 72, 81, 89,
+					97, 104, 112, 119, 127, 134, 142, 153, 160, 168, 177, 186,
+					195, 204, 213, 221, 228, 234, 242, 251, 257, 265, 276, 285,
+					292, 298, 305, 312, 322, 332, 341, 349, 358, 366, 374, 381,
+					389, 397, 404, 411, 419, 427, 437, 445, 454, 462, 470, 479,
+					486, 494, 500, 507, 515, 526, 533, 539, 548, 555, 563, 571,
+					579, 587, 595, 604, 611, 621, 627, 637, 645, 655, 663, 671,
+					679, 688, 695, 703, 713, 721, 728, 734, 745, 754, 761, 768,
+					776, 782, 791, 800, 808, 816, 824, 833, 842, 851, 858, 869,
+					875, 884, 893, 900, 908, 916, 923, 930, 939, 947, 955, 963,
+					972, 980, 988, 999, 1007, 1016, 1025, 1033, 1042, 1050, 1059, 1067,
+					1075, 1083, 1090, 1098, 1105, 1114, 1123, 1132, 1140, 1147, 1156, 1165,
+					1173, 1181, 1189, 1200, 1208, 1215, 1224, 1232, 1239, 1248, 1257, 1266,
+					1274, 1282, 1288, 1295, 1303, 1309, 1316, 1323, 1331, 1340, 1348, 1357,
+					1365, 1373, 1380, 1388, 1396, 1403, 1411, 1420, 1427, 1435, 1443, 1450,
+					1457, 1465, 1474, 1480, 1486, 1493, 1500, 1507, 1513, 1519, 1526, 1532,
+					1540, 1547, 1556, 1565, 1574, 1581, 1589, 1598, 1605, 1614, 1622, 1631,
+					1642, 1651, 1659, 1665, 1671, 1678, 1686, 1693, 1701, 1710, 1717, 1726,
+					1735, 1744, 1752, 1761, 1768, 1781, 1789, 1796, 1804, 1812, 1819, 1827,
+					1836, 1843, 1851, 1859, 1866, 1872, 1878, 1887, 1895, 1903, 1912, 1920,
+					1928, 1936, 1942, 1951, 1958, 1966, 1974, 1981, 1990, 1999, 2007, 2013,
+					2021, 2029, 2036, 2043, 2049, 2056, 2063, 2070, 2077, 2085, 2094, 2100,
+					2108, 2114, 2120, 2127, 2134, 2141, 2148, 2156, 2163, 2172, 2181, 2188,
+					2196, 2204, 2210, 2217, 2226, 2235, 2244, 2252, 2261, 2269, 2276, 2285,
+					2292, 2300, 2308, 2316, 2322, 2330, 2337, 2345, 2352, 2360, 2369, 2376,
+					2382, 2390, 2398, 2405, 2413, 2421, 2429, 2436, 2445, 2452, 2458, 2468,
+					2476, 2484, 2493, 2501, 2509, 2516, 2525, 2534, 2543, 2552, 2559, 2568,
+					2574, 2582, 2588, 2596, 2604, 2612, 2620, 2628, 2636, 2643, 2651, 2660,
+					2668, 2677, 2685, 2693, 2701, 2709, 2716, 2724, 2731, 2738, 2746, 2753,
+					2761, 2770, 2778, 2785, 2795, 2804, 2814, 2822, 2831, 2840, 2848, 2855,
+					2868, 2875, 2882, 2890, 2897, 2905, 2912, 2920, 2928, 2935, 2944, 2952,
+					2961, 2968, 2977, 2986, 2994, 3003, 3014, 3023, 3030, 3036, 3044, 3052,
+					3062, 3068, 3077, 3086, 3094, 3100, 3109, 3116, 3122, 3129, 3137, 3146,
+					3155, 3163, 3172, 3178, 3185, 3193, 3201, 3208, 3214, 3222, 3230, 3238,
+					3245, 3253, 3260, 3268, 3275, 3283, 3290, 3298, 3307, 3314, 3320, 3328,
+					3337, 3343, 3352, 3359, 3366, 3377, 3385, 3393, 3402, 3410, 3418, 3427,
+					3435, 3442, 3452, 3461, 3469, 3477, 3486, 3494, 3503, 3512, 3521, 3529,
+					3537, 3544, 3550, 3557, 3565, 3573, 3582, 3589, 3597, 3607, 3616, 3624,
+					3630, 3636, 3644, 3652, 3660, 3668, 3675, 3681, 3689, 3697, 3704, 3715,
+					3726, 3736, 3744, 3753, 3761, 3767, 3775, 3785, 3792, 3800, 3808, 3816,
+					3822, 3830, 3838, 3847, 3858, 3866, 3873, 3882, 3891, 3899, 3906, 3914,
+					3922, 3930, 3936, 3945, 3953, 3961, 3968, 3975, 3983, 3991, 4002, 4012,
+					4023, 4034, 4045, 4055, 4066, 4077, 4087, 4098, 4108, 4118, 4129, 4138,
+					4149, 4158, 4169, 4179, 4190, 4200, 4211, 4222, 4233, 4244, 4253, 4263,
+					4272, 4281, 4291, 4302, 4312, 4321, 4331, 4340, 4351, 4362, 4373, 4383,
+					4394, 4404, 4415, 4424, 4433, 4444, 4457, 4466, 4475, 4486, 4497, 4508,
+					4519, 4528, 4536, 4544, 4551, 4558, 4567, 4575, 4582, 4593, 4603, 4611,
+					4617, 4624, 4633, 4642, 4650, 4659, 4667, 4676, 4685, 4694, 4703, 4712,
+					4720, 4727, 4735, 4741, 4747, 4755, 4764, 4772, 4781, 4788, 4795, 4804,
+					4812, 4819, 4826, 4833, 4841, 4850, 4859, 4866, 4874, 4881, 4887, 4894,
+					4901, 4909, 4918, 4927, 4935, 4943, 4951, 4958, 4967, 4977, 4987, 4997,
+					5007, 5018, 5028, 5037, 5046, 5054, 5065, 5074, 5084, 5094, 5106, 5117,
+					5125, 5133, 5144, 5154, 5164, 5172, 5181, 5189, 5196, 5205, 5214, 5225,
+					5234, 5244, 5255, 5265, 5276, 5288, 5301, 5311, 5322, 5333, 5341, 5352,
+					5361, 5370, 5379, 5387, 5398, 5409, 5417, 5427, 5438, 5447, 5456, 5465,
+					5473, 5484, 5493, 5503, 5511, 5519, 5528, 5537, 5545, 5553, 5563, 5571,
+					5580, 5588, 5596, 5602, 5611, 5620, 5629, 5635, 5643, 5650, 5659, 5668,
+					5677, 5686, 5695, 5704, 5711, 5720, 5729, 5742, 5750, 5759, 5767, 5774,
+					5783, 5794, 5804, 5814, 5823, 5834, 5847, 5855, 5866, 5874, 5884, 5895,
+					5904, 5914, 5925, 5936, 5946, 5955, 5964, 5974, 5981, 5992, 6001, 6009,
+					6018, 6029, 6036, 6043, 6052, 6060, 6068, 6075, 6083, 6090, 6098, 6106,
+					6118, 6127, 6137, 6148, 6159, 6170, 6180, 6190, 6200, 6207, 6216, 6226,
+					6235, 6246, 6257, 6267, 6276, 6284, 6293, 6303, 6313, 6324, 6335, 6344,
+					6355, 6365, 6371, 6382, 6390, 6399, 6408, 6417, 6424, 6435, 6443, 6451,
+					6459, 6468, 6477, 6484, 6492, 6501, 6512, 6521, 6529, 6538, 6545, 6554,
+					6563, 6571, 6577, 6586, 6594, 6601, 6609, 6617, 6625, 6632, 6640, 6648,
+					6656, 6663, 6672, 6681, 6687, 6695, 6702, 6709, 6716, 6723, 6733, 6744,
+					6756, 6764, 6770, 6778, 6786, 6795, 6802, 6811, 6819, 6828, 6836, 6843,
+					6853, 6860, 6868, 6875, 6884, 6891, 6900, 6909, 6919, 6927, 6934, 6940,
+					6948, 6957, 6963, 6969, 6975, 6983, 6989, 6997, 7004, 7012, 7021, 7029,
+					7038, 7044, 7052, 7059, 7065, 7074, 7081, 7089, 7095, 7104, 7113, 7122,
+					7129, 7138, 7147, 7155, 7163, 7170, 7180, 7189, 7197, 7204, 7212, 7219,
+					7228, 7236, 7244, 7254, 7262, 7269, 7278, 7291, 7299, 7307, 7316, 7324,
+					7332, 7338, 7346, 7354, 7362, 7368, 7376, 7382, 7389, 7397, 7404, 7411,
+					7417, 7424, 7432, 7440, 7449, 7458, 7466, 7473, 7482, 7490, 7496, 7504,
+					7515, 7524, 7533, 7545, 7553, 7559, 7566, 7577, 7590, 7601, 7607, 7615,
+					7622, 7629, 7636, 7643, 7649, 7655, 7662, 7670, 7676, 7683, 7692, 7700,
+					7706, 7714, 7720, 7728, 7736, 7744, 7751, 7760, 7769, 7776, 7784, 7793,
+					7800, 7806, 7814, 7822, 7829, 7836, 7845, 7853, 7861, 7869, 7877, 7884,
+					7891, 7898, 7906, 7916, 7926, 7935, 7941, 7950, 7958, 7967, 7976, 7985,
+					7994, 8002, 8008, 8015, 8022, 8031, 8039, 8048, 8055, 8062, 8071, 8082,
+					8088, 8099, 8107, 8115, 8125, 8133, 8142, 8148, 8157, 8166, 8172, 8179,
+					8187, 8198, 8206, 8214, 8222, 8228, 8236, 8244, 8252, 8261, 8269, 8276,
+					8283, 8291, 8298, 8305, 8312, 8319, 8326, 8335, 8345, 8351, 8359, 8366,
+					8374, 8381, 8390, 8399, 8405, 8413, 8420, 8428, 8437, 8446, 8453, 8464,
+					8473, 8481, 8490, 8498, 8507, 8516, 8525, 8534, 8543, 8551, 8558, 8567,
+					8576, 8584, 8592, 8599, 8608, 8617, 8626, 8636, 8644, 8652, 8661, 8668,
+					8677, 8686, 8694, 8703, 8711, 8719, 8728, 8737, 8746, 8755, 8762, 8770,
+					8777, 8786, 8795, 8803, 8812, 8821, 8829, 8838, 8847, 8856, 8865, 8873,
+					8880, 8887, 8895, 8902, 8910, 8916, 8924, 8931, 8938, 8944, 8952, 8960,
+					8966, 8972, 8981, 8989, 8997, 9005, 9012, 9021, 9029, 9036, 9042, 9049,
+					9057, 9066, 9073, 9079, 9087, 9095, 9102, 9113, 9119, 9126, 9134, 9140,
+					9147, 9156, 9166, 9174, 9181, 9187, 9195, 9203, 9211, 9219, 9225, 9233,
+					9241, 9250, 9256, 9264, 9270, 9278, 9285, 9292, 9300, 9308, 9316, 9325,
+					9333, 9340, 9347, 9355, 9364, 9371, 9381, 9387, 9395, 9403, 9411, 9420,
+					9429, 9437, 9443, 9449, 9456, 9465, 9473, 9484, 9491, 9500, 9508, 9518,
+					9525, 9533, 9540, 9549, 9557, 9565, 9574, 9581, 9589, 9597, 9603, 9609,
+					9616, 9622, 9628, 9634, 9641, 9650, 9656, 9664, 9672, 9682, 9690, 9696,
+					9702, 9709, 9717, 9725, 9733, 9741, 9749, 9756, 9764, 9773, 9780, 9787,
+					9795, 9803, 9814, 9822, 9829, 9838, 9847, 9856, 9865, 9874, 9882, 9889,
+					9898, 9905, 9914, 9920, 9929, 9938, 9945, 9954, 9963, 9970, 9981, 9991,
+					10000, 10008, 10017, 10023, 10031, 10041, 10051, 10062, 10072, 10082, 10091, 10100,
+					10110, 10120, 10127, 10137, 10145, 10151, 10158, 10167, 10174, 10183, 10192, 10198,
+					10207, 10214, 10222, 10234, 10244, 10253, 10260, 10268, 10276, 10283, 10290, 10297,
+					10304, 10312, 10320, 10326, 10336, 10344, 10352, 10359, 10367, 10376, 10384, 10390,
+					10397, 10405, 10414, 10422, 10431, 10439, 10448, 10456, 10465, 10474, 10482, 10490,
+					10498, 10506, 10513, 10519, 10526, 10533, 10540, 10548, 10555, 10563, 10572, 10581,
+					10590, 10599, 10607, 10614, 10623, 10632, 10641, 10647, 10654, 10662, 10671, 10681,
+					10690, 10697, 10703, 10712, 10719, 10728, 10735, 10742, 10751, 10760, 10767, 10778,
+					10785, 10795, 10806, 10817, 10828, 10834, 10842, 10851, 10859, 10867, 10873, 10879,
+					10886, 10894, 10901, 10907, 10913, 10922, 10931, 10940, 10947, 10956, 10963, 10972,
+					10980, 10989, 10997, 11005, 11013, 11022, 11031, 11038, 11044, 11052, 11058, 11067,
+					11076, 11084, 11090, 11099, 11107, 11116, 11124, 11131, 11140, 11149, 11157, 11165,
+					11174, 11182, 11190, 11198, 11207, 11216, 11225, 11231, 11239, 11248, 11257, 11264,
+					11270, 11277, 11286, 11295, 11303, 11311, 11319, 11328, 11336, 11346, 11355, 11361,
+					11368, 11377, 11385, 11394, 11403, 11409, 11417, 11425, 11432, 11439, 11448, 11456,
+					11463, 11471, 11479, 11488, 11494, 11500, 11509, 11516, 11525, 11532, 11540, 11547,
+					11553, 11562, 11570, 11578, 11584, 11594, 11600, 11609, 11616, 11627, 11636, 11643,
+					11651, 11657, 11666, 11675, 11683, 11692, 11701, 11708, 11715, 11723, 11731, 11740,
+					11749, 11757, 11766, 11773, 11780, 11788, 11797, 11806, 11813, 11822, 11830, 11841,
+					11850, 11859, 11866, 11875, 11884, 11890, 11898, 11905, 11913, 11920, 11930, 11936,
+					11944, 11952, 11960, 11973, 11983, 11990, 12000, 12009, 12018, 12026, 12035, 12045,
+					12054, 12063, 12070, 12076, 12082, 12091, 12097, 12106, 12113, 12121, 12128, 12135,
+					12142, 12149, 12158, 12164, 12173, 12181, 12188, 12196, 12203, 12211, 12219, 12226,
+					12234, 12242, 12249, 12257, 12263, 12269, 12277, 12285, 12293, 12300, 12307, 12316,
+					12324, 12332, 12339, 12346, 12352, 12360, 12366, 12374, 12383, 12392, 12400, 12407,
+					12415, 12423, 12430, 12438, 12447, 12454, 12463, 12471, 12479, 12488, 12499, 12505,
+					12514, 12523, 12534, 12542, 12550, 12557, 12564, 12570, 12578, 12585, 12593, 12601,
+					12609, 12617, 12626, 12637, 12647, 12657, 12667, 12676, 12687, 12698, 12708, 12717,
+					12724, 12731, 12738, 12749, 12760, 12768, 12776, 12786, 12792, 12801, 12810, 12819,
+					12826, 12837, 12848, 12857, 12866, 12875, 12883, 12892, 12899, 12907, 12914, 12920,
+					12927, 12935, 12943, 12951, 12960, 12967, 12976, 12983, 12992, 13001, 13012, 13020,
+					13029, 13036, 13045, 13053, 13062, 13070, 13077, 13086, 13095, 13104, 13111, 13118,
+					13127, 13135, 13141, 13150, 13160, 13169, 13180, 13191, 13200, 13210, 13221, 13232,
+					13241, 13249, 13258, 13268, 13277, 13285, 13295, 13306, 13314, 13321, 13332, 13341,
+					13351, 13362, 13375, 13383, 13391, 13399, 13407, 13414, 13423, 13432, 13439, 13448,
+					13456, 13463, 13470, 13478, 13487, 13496, 13504, 13511, 13519, 13528, 13536, 13544,
+					13551, 13561, 13572, 13583, 13591, 13598, 13609, 13620, 13628, 13639, 13648, 13657,
+					13667, 13677, 13686, 13694, 13704, 13715, 13724, 13731, 13737, 13744, 13752, 13759,
+					13768, 13776, 13783, 13790, 13796, 13806, 13814, 13822, 13829, 13835, 13842, 13849,
+					13856, 13864, 13870, 13877, 13883, 13891, 13899, 13907, 13915, 13921, 13927, 13933,
+					13940, 13948, 13955, 13964, 13970, 13979, 13986, 13993, 14001, 14007, 14015, 14022,
+					14030, 14037, 14044, 14051, 14057, 14064, 14071, 14080, 14089, 14098, 14106, 14114,
+					14123, 14130, 14137, 14145, 14152, 14161, 14169, 14178, 14191, 14202, 14210, 14219,
+					14227, 14235, 14241, 14249, 14258, 14267, 14277, 14286, 14294, 14307, 14317, 14327,
+					14336, 14345, 14356, 14364, 14372, 14380, 14390, 14401, 14410, 14419, 14429, 14440,
+					14447, 14455, 14465, 14473, 14481, 14489, 14498, 14506, 14514, 14523, 14533, 14542,
+					14551, 14559, 14565, 14572, 14580, 14589, 14596, 14606, 14615, 14622, 14628, 14637,
+					14644, 14650, 14657, 14663, 14670, 14679, 14686, 14693, 14702, 14710, 14717, 14725,
+					14734, 14740, 14748, 14757, 14764, 14772, 14779, 14785, 14793, 14802, 14810, 14818,
+					14827, 14835, 14842, 14851, 14860, 14869, 14877, 14887, 14896, 14903, 14910, 14918,
+					14926, 14935, 14944, 14951, 14960, 14968, 14977, 14985, 14994, 15001, 15010, 15019,
+					15025, 15033, 15044, 15052, 15060, 15068, 15077, 15085, 15094, 15103, 15112, 15120,
+					15127, 15135, 15143, 15151, 15162, 15170, 15178, 15188, 15194, 15202, 15210, 15218,
+					15225, 15234, 15243, 15251, 15259, 15268, 15274, 15283, 15290, 15296, 15304, 15310,
+					15317, 15326, 15332, 15340, 15346, 15355, 15364, 15373, 15380, 15387, 15393, 15401,
+					15410, 15416, 15425, 15434, 15440, 15448, 15458, 15469, 15476, 15482, 15490, 15497,
+					15506, 15513, 15519, 15526, 15532, 15540, 15549, 15560, 15567, 15575, 15583, 15592,
+					15599, 15606, 15614, 15623, 15631, 15637, 15644, 15650, 15658, 15667, 15675, 15682,
+					15691, 15698, 15707, 15714, 15720, 15729, 15737, 15746, 15754, 15763, 15770, 15777,
+					15786, 15795, 15804, 15813, 15821, 15830, 15838, 15847, 15853, 15862, 15871, 15877,
+					15884, 15892, 15899, 15907, 15914, 15922, 15928, 15935, 15942, 15950, 15956, 15965,
+					15972, 15981, 15989, 15997, 16003, 16010, 16019, 16027, 16035, 16042, 16051, 16057,
+					16063, 16069, 16075, 16081, 16088, 16096, 16103, 16112, 16118, 16127, 16135, 16144,
+					16152, 16159, 16166, 16172, 16180, 16188, 16195, 16202, 16209, 16216, 16222, 16230,
+					16238, 16250, 16261, 16269, 16278, 16287, 16299, 16306, 16315, 16324, 16332, 16340,
+					16347, 16354, 16361, 16367, 16374, 16386, 16396, 16403, 16409, 16416, 16423, 16432,
+					16440, 16448, 16457, 16465, 16472, 16480, 16489, 16496, 16505, 16514, 16523, 16529,
+					16536, 16543, 16550, 16559, 16566, 16572, 16580, 16589, 16597, 16604, 16613, 16622,
+					16629, 16635, 16642, 16650, 16659, 16666, 16675, 16682, 16689, 16696, 16702, 16710,
+					16717, 16725, 16731, 16739, 16745, 16753, 16762, 16768,
+			};
+
+			constexpr char BIP39PoolItalian[] =
+					"abaco\0"
+					"abbaglio\0"
+					"abbinato\0"
+					"abete\0"
+					"abisso\0"
+					"abolire\0"
+					"abrasivo\0"
+					"abrogato\0"
+					"accadere\0"
+					"accenno\0"
+					"accusato\0"
+					"acetone\0"
+					"achille\0"
+					"acido\0"
+					"acqua\0"
+					"acre\0"
+					"acrilico\0"
+					"acrobata\0"
+					"acuto\0"
+					"adagio\0"
+					"addebito\0"
+					"addome\0"
+					"adeguato\0"
+					"aderire\0"
+					"adipe\0"
+					"adottare\0"
+					"adulare\0"
+					"affabile\0"
+					"affetto\0"
+					"affisso\0"
+					"affranto\0"
+					"aforisma\0"
+					"afoso\0"
+					"africano\0"
+					"agave\0"
+					"agente\0"
+					"agevole\0"
+					"aggancio\0"
+					"agire\0"
+					"agitare\0"
+					"agonismo\0"
+					"agricolo\0"
+					"agrumeto\0"
+					"aguzzo\0"
+					"alabarda\0"
+					"alato\0"
+					"albatro\0"
+					"alberato\0"
+					"albo\0"
+					"albume\0"
+					"alce\0"
+					"alcolico\0"
+					"alettone\0"
+					"alfa\0"
+					"algebra\0"
+					"aliante\0"
+					"alibi\0"
+					"alimento\0"
+					"allagato\0"
+					"allegro\0"
+					"allievo\0"
+					"allodola\0"
+					"allusivo\0"
+					"almeno\0"
+					"alogeno\0"
+					"alpaca\0"
+					"alpestre\0"
+					"altalena\0"
+					"alterno\0"
+					"alticcio\0"
+					"altrove\0"
+					"alunno\0"
+					"alveolo\0"
+					"alzare\0"
+					"amalgama\0"
+					"amanita\0"
+					"amarena\0"
+					"ambito\0"
+					"ambrato\0"
+					"ameba\0"
+					"america\0"
+					"ametista\0"
+					"amico\0"
+					"ammasso\0"
+					"ammenda\0"
+					"ammirare\0"
+					"ammonito\0"
+					"amore\0"
+					"ampio\0"
+					"ampliare\0"
+					"amuleto\0"
+					"anacardo\0"
+					"anagrafe\0"
+					"analista\0"
+					"anarchia\0"
+					"anatra\0"
+					"anca\0"
+					"ancella\0"
+					"ancora\0"
+					"andare\0"
+					"andrea\0"
+					"anello\0"
+					"angelo\0"
+					"angolare\0"
+					"angusto\0"
+					"anima\0"
+					"annegare\0"
+					"annidato\0"
+					"anno\0"
+					"annuncio\0"
+					"anonimo\0"
+					"anticipo\0"
+					"anzi\0"
+					"apatico\0"
+					"apertura\0"
+					"apode\0"
+					"apparire\0"
+					"appetito\0"
+					"appoggio\0"
+					"approdo\0"
+					"appunto\0"
+					"aprile\0"
+					"arabica\0"
+					"arachide\0"
+					"aragosta\0"
+					"araldica\0"
+					"arancio\0"
+					"aratura\0"
+					"arazzo\0"
+					"arbitro\0"
+					"archivio\0"
+					"ardito\0"
+					"arenile\0"
+					"argento\0"
+					"argine\0"
+					"arguto\0"
+					"aria\0"
+					"armonia\0"
+					"arnese\0"
+					"arredato\0"
+					"arringa\0"
+					"arrosto\0"
+					"arsenico\0"
+					"arso\0"
+					"artefice\0"
+					"arzillo\0"
+					"asciutto\0"
+					"ascolto\0"
+					"asepsi\0"
+					"asettico\0"
+					"asfalto\0"
+					"asino\0"
+					"asola\0"
+					"aspirato\0"
+					"aspro\0"
+					"assaggio\0"
+					"asse\0"
+					"assoluto\0"
+					"assurdo\0"
+					"asta\0"
+					"astenuto\0"
+					"astice\0"
+					"astratto\0"
+					"atavico\0"
+					"ateismo\0"
+					"atomico\0"
+					"atono\0"
+					"attesa\0"
+					"attivare\0"
+					"attorno\0"
+					"attrito\0"
+					"attuale\0"
+					"ausilio\0"
+					"austria\0"
+					"autista\0"
+					"autonomo\0"
+					"autunno\0"
+					"avanzato\0"
+					"avere\0"
+					"avvenire\0"
+					"avviso\0"
+					"avvolgere\0"
+					"azione\0"
+					"azoto\0"
+					"azzimo\0"
+					"azzurro\0"
+					"babele\0"
+					"baccano\0"
+					"bacino\0"
+					"baco\0"
+					"badessa\0"
+					"badilata\0"
+					"bagnato\0"
+					"baita\0"
+					"balcone\0"
+					"baldo\0"
+					"balena\0"
+					"ballata\0"
+					"balzano\0"
+					"bambino\0"
+					"bandire\0"
+					"baraonda\0"
+					"barbaro\0"
+					"barca\0"
+					"baritono\0"
+					"barlume\0"
+					"barocco\0"
+					"basilico\0"
+					"basso\0"
+					"batosta\0"
+					"battuto\0"
+					"baule\0"
+					"bava\0"
+					"bavosa\0"
+					"becco\0"
+					"beffa\0"
+					"belgio\0"
+					"belva\0"
+					"benda\0"
+					"benevole\0"
+					"benigno\0"
+					"benzina\0"
+					"bere\0"
+					"berlina\0"
+					"beta\0"
+					"bibita\0"
+					"bici\0"
+					"bidone\0"
+					"bifido\0"
+					"biga\0"
+					"bilancia\0"
+					"bimbo\0"
+					"binocolo\0"
+					"biologo\0"
+					"bipede\0"
+					"bipolare\0"
+					"birbante\0"
+					"birra\0"
+					"biscotto\0"
+					"bisesto\0"
+					"bisnonno\0"
+					"bisonte\0"
+					"bisturi\0"
+					"bizzarro\0"
+					"blando\0"
+					"blatta\0"
+					"bollito\0"
+					"bonifico\0"
+					"bordo\0"
+					"bosco\0"
+					"botanico\0"
+					"bottino\0"
+					"bozzolo\0"
+					"braccio\0"
+					"bradipo\0"
+					"brama\0"
+					"branca\0"
+					"bravura\0"
+					"bretella\0"
+					"brevetto\0"
+					"brezza\0"
+					"briglia\0"
+					"brillante\0"
+					"brindare\0"
+					"broccolo\0"
+					"brodo\0"
+					"bronzina\0"
+					"brullo\0"
+					"bruno\0"
+					"bubbone\0"
+					"buca\0"
+					"budino\0"
+					"buffone\0"
+					"buio\0"
+					"bulbo\0"
+					"buono\0"
+					"burlone\0"
+					"burrasca\0"
+					"bussola\0"
+					"busta\0"
+					"cadetto\0"
+					"caduco\0"
+					"calamaro\0"
+					"calcolo\0"
+					"calesse\0"
+					"calibro\0"
+					"calmo\0"
+					"caloria\0"
+					"cambusa\0"
+					"camerata\0"
+					"camicia\0"
+					"cammino\0"
+					"camola\0"
+					"campale\0"
+					"canapa\0"
+					"candela\0"
+					"cane\0"
+					"canino\0"
+					"canotto\0"
+					"cantina\0"
+					"capace\0"
+					"capello\0"
+					"capitolo\0"
+					"capogiro\0"
+					"cappero\0"
+					"capra\0"
+					"capsula\0"
+					"carapace\0"
+					"carcassa\0"
+					"cardo\0"
+					"carisma\0"
+					"carovana\0"
+					"carretto\0"
+					"cartolina\0"
+					"casaccio\0"
+					"cascata\0"
+					"caserma\0"
+					"caso\0"
+					"cassone\0"
+					"castello\0"
+					"casuale\0"
+					"catasta\0"
+					"catena\0"
+					"catrame\0"
+					"cauto\0"
+					"cavillo\0"
+					"cedibile\0"
+					"cedrata\0"
+					"cefalo\0"
+					"celebre\0"
+					"cellulare\0"
+					"cena\0"
+					"cenone\0"
+					"centesimo\0"
+					"ceramica\0"
+					"cercare\0"
+					"certo\0"
+					"cerume\0"
+					"cervello\0"
+					"cesoia\0"
+					"cespo\0"
+					"ceto\0"
+					"chela\0"
+					"chiaro\0"
+					"chicca\0"
+					"chiedere\0"
+					"chimera\0"
+					"china\0"
+					"chirurgo\0"
+					"chitarra\0"
+					"ciao\0"
+					"ciclismo\0"
+					"cifrare\0"
+					"cigno\0"
+					"cilindro\0"
+					"ciottolo\0"
+					"circa\0"
+					"cirrosi\0"
+					"citrico\0"
+					"cittadino\0"
+					"ciuffo\0"
+					"civetta\0"
+					"civile\0"
+					"classico\0"
+					"clinica\0"
+					"cloro\0"
+					"cocco\0"
+					"codardo\0"
+					"codice\0"
+					"coerente\0"
+					"cognome\0"
+					"collare\0"
+					"colmato\0"
+					"colore\0"
+					"colposo\0"
+					"coltivato\0"
+					"colza\0"
+					"coma\0"
+					"cometa\0"
+					"commando\0"
+					"comodo\0"
+					"computer\0"
+					"comune\0"
+					"conciso\0"
+					"condurre\0"
+					"conferma\0"
+					"congelare\0"
+					"coniuge\0"
+					"connesso\0"
+					"conoscere\0"
+					"consumo\0"
+					"continuo\0"
+					"convegno\0"
+					"coperto\0"
+					"copione\0"
+					"coppia\0"
+					"copricapo\0"
+					"corazza\0"
+					"cordata\0"
+					"coricato\0"
+					"cornice\0"
+					"corolla\0"
+					"corpo\0"
+					"corredo\0"
+					"corsia\0"
+					"cortese\0"
+					"cosmico\0"
+					"costante\0"
+					"cottura\0"
+					"covato\0"
+					"cratere\0"
+					"cravatta\0"
+					"creato\0"
+					"credere\0"
+					"cremoso\0"
+					"crescita\0"
+					"creta\0"
+					"criceto\0"
+					"crinale\0"
+					"crisi\0"
+					"critico\0"
+					"croce\0"
+					"cronaca\0"
+					"crostata\0"
+					"cruciale\0"
+					"crusca\0"
+					"cucire\0"
+					"cuculo\0"
+					"cugino\0"
+					"cullato\0"
+					"cupola\0"
+					"curatore\0"
+					"cursore\0"
+					"curvo\0"
+					"cuscino\0"
+					"custode\0"
+					"dado\0"
+					"daino\0"
+					"dalmata\0"
+					"damerino\0"
+					"daniela\0"
+					"dannoso\0"
+					"danzare\0"
+					"datato\0"
+					"davanti\0"
+					"davvero\0"
+					"debutto\0"
+					"decennio\0"
+					"deciso\0"
+					"declino\0"
+					"decollo\0"
+					"decreto\0"
+					"dedicato\0"
+					"definito\0"
+					"deforme\0"
+					"degno\0"
+					"delegare\0"
+					"delfino\0"
+					"delirio\0"
+					"delta\0"
+					"demenza\0"
+					"denotato\0"
+					"dentro\0"
+					"deposito\0"
+					"derapata\0"
+					"derivare\0"
+					"deroga\0"
+					"descritto\0"
+					"deserto\0"
+					"desiderio\0"
+					"desumere\0"
+					"detersivo\0"
+					"devoto\0"
+					"diametro\0"
+					"dicembre\0"
+					"diedro\0"
+					"difeso\0"
+					"diffuso\0"
+					"digerire\0"
+					"digitale\0"
+					"diluvio\0"
+					"dinamico\0"
+					"dinnanzi\0"
+					"dipinto\0"
+					"diploma\0"
+					"dipolo\0"
+					"diradare\0"
+					"dire\0"
+					"dirotto\0"
+					"dirupo\0"
+					"disagio\0"
+					"discreto\0"
+					"disfare\0"
+					"disgelo\0"
+					"disposto\0"
+					"distanza\0"
+					"disumano\0"
+					"dito\0"
+					"divano\0"
+					"divelto\0"
+					"dividere\0"
+					"divorato\0"
+					"doblone\0"
+					"docente\0"
+					"doganale\0"
+					"dogma\0"
+					"dolce\0"
+					"domato\0"
+					"domenica\0"
+					"dominare\0"
+					"dondolo\0"
+					"dono\0"
+					"dormire\0"
+					"dote\0"
+					"dottore\0"
+					"dovuto\0"
+					"dozzina\0"
+					"drago\0"
+					"druido\0"
+					"dubbio\0"
+					"dubitare\0"
+					"ducale\0"
+					"duna\0"
+					"duomo\0"
+					"duplice\0"
+					"duraturo\0"
+					"ebano\0"
+					"eccesso\0"
+					"ecco\0"
+					"eclissi\0"
+					"economia\0"
+					"edera\0"
+					"edicola\0"
+					"edile\0"
+					"editoria\0"
+					"educare\0"
+					"egemonia\0"
+					"egli\0"
+					"egoismo\0"
+					"egregio\0"
+					"elaborato\0"
+					"elargire\0"
+					"elegante\0"
+					"elencato\0"
+					"eletto\0"
+					"elevare\0"
+					"elfico\0"
+					"elica\0"
+					"elmo\0"
+					"elsa\0"
+					"eluso\0"
+					"emanato\0"
+					"emblema\0"
+					"emesso\0"
+					"emiro\0"
+					"emotivo\0"
+					"emozione\0"
+					"empirico\0"
+					"emulo\0"
+					"endemico\0"
+					"enduro\0"
+					"energia\0"
+					"enfasi\0"
+					"enoteca\0"
+					"entrare\0"
+					"enzima\0"
+					"epatite\0"
+					"epilogo\0"
+					"episodio\0"
+					"epocale\0"
+					"eppure\0"
+					"equatore\0"
+					"erario\0"
+					"erba\0"
+					"erboso\0"
+					"erede\0"
+					"eremita\0"
+					"erigere\0"
+					"ermetico\0"
+					"eroe\0"
+					"erosivo\0"
+					"errante\0"
+					"esagono\0"
+					"esame\0"
+					"esanime\0"
+					"esaudire\0"
+					"esca\0"
+					"esempio\0"
+					"esercito\0"
+					"esibito\0"
+					"esigente\0"
+					"esistere\0"
+					"esito\0"
+					"esofago\0"
+					"esortato\0"
+					"esoso\0"
+					"espanso\0"
+					"espresso\0"
+					"essenza\0"
+					"esso\0"
+					"esteso\0"
+					"estimare\0"
+					"estonia\0"
+					"estroso\0"
+					"esultare\0"
+					"etilico\0"
+					"etnico\0"
+					"etrusco\0"
+					"etto\0"
+					"euclideo\0"
+					"europa\0"
+					"evaso\0"
+					"evidenza\0"
+					"evitato\0"
+					"evoluto\0"
+					"evviva\0"
+					"fabbrica\0"
+					"faccenda\0"
+					"fachiro\0"
+					"falco\0"
+					"famiglia\0"
+					"fanale\0"
+					"fanfara\0"
+					"fango\0"
+					"fantasma\0"
+					"fare\0"
+					"farfalla\0"
+					"farinoso\0"
+					"farmaco\0"
+					"fascia\0"
+					"fastoso\0"
+					"fasullo\0"
+					"faticare\0"
+					"fato\0"
+					"favoloso\0"
+					"febbre\0"
+					"fecola\0"
+					"fede\0"
+					"fegato\0"
+					"felpa\0"
+					"feltro\0"
+					"femmina\0"
+					"fendere\0"
+					"fenomeno\0"
+					"fermento\0"
+					"ferro\0"
+					"fertile\0"
+					"fessura\0"
+					"festivo\0"
+					"fetta\0"
+					"feudo\0"
+					"fiaba\0"
+					"fiducia\0"
+					"fifa\0"
+					"figurato\0"
+					"filo\0"
+					"finanza\0"
+					"finestra\0"
+					"finire\0"
+					"fiore\0"
+					"fiscale\0"
+					"fisico\0"
+					"fiume\0"
+					"flacone\0"
+					"flamenco\0"
+					"flebo\0"
+					"flemma\0"
+					"florido\0"
+					"fluente\0"
+					"fluoro\0"
+					"fobico\0"
+					"focaccia\0"
+					"focoso\0"
+					"foderato\0"
+					"foglio\0"
+					"folata\0"
+					"folclore\0"
+					"folgore\0"
+					"fondente\0"
+					"fonetico\0"
+					"fonia\0"
+					"fontana\0"
+					"forbito\0"
+					"forchetta\0"
+					"foresta\0"
+					"formica\0"
+					"fornaio\0"
+					"foro\0"
+					"fortezza\0"
+					"forzare\0"
+					"fosfato\0"
+					"fosso\0"
+					"fracasso\0"
+					"frana\0"
+					"frassino\0"
+					"fratello\0"
+					"freccetta\0"
+					"frenata\0"
+					"fresco\0"
+					"frigo\0"
+					"frollino\0"
+					"fronde\0"
+					"frugale\0"
+					"frutta\0"
+					"fucilata\0"
+					"fucsia\0"
+					"fuggente\0"
+					"fulmine\0"
+					"fulvo\0"
+					"fumante\0"
+					"fumetto\0"
+					"fumoso\0"
+					"fune\0"
+					"funzione\0"
+					"fuoco\0"
+					"furbo\0"
+					"furgone\0"
+					"furore\0"
+					"fuso\0"
+					"futile\0"
+					"gabbiano\0"
+					"gaffe\0"
+					"galateo\0"
+					"gallina\0"
+					"galoppo\0"
+					"gambero\0"
+					"gamma\0"
+					"garanzia\0"
+					"garbo\0"
+					"garofano\0"
+					"garzone\0"
+					"gasdotto\0"
+					"gasolio\0"
+					"gastrico\0"
+					"gatto\0"
+					"gaudio\0"
+					"gazebo\0"
+					"gazzella\0"
+					"geco\0"
+					"gelatina\0"
+					"gelso\0"
+					"gemello\0"
+					"gemmato\0"
+					"gene\0"
+					"genitore\0"
+					"gennaio\0"
+					"genotipo\0"
+					"gergo\0"
+					"ghepardo\0"
+					"ghiaccio\0"
+					"ghisa\0"
+					"giallo\0"
+					"gilda\0"
+					"ginepro\0"
+					"giocare\0"
+					"gioiello\0"
+					"giorno\0"
+					"giove\0"
+					"girato\0"
+					"girone\0"
+					"gittata\0"
+					"giudizio\0"
+					"giurato\0"
+					"giusto\0"
+					"globulo\0"
+					"glutine\0"
+					"gnomo\0"
+					"gobba\0"
+					"golf\0"
+					"gomito\0"
+					"gommone\0"
+					"gonfio\0"
+					"gonna\0"
+					"governo\0"
+					"gracile\0"
+					"grado\0"
+					"grafico\0"
+					"grammo\0"
+					"grande\0"
+					"grattare\0"
+					"gravoso\0"
+					"grazia\0"
+					"greca\0"
+					"gregge\0"
+					"grifone\0"
+					"grigio\0"
+					"grinza\0"
+					"grotta\0"
+					"gruppo\0"
+					"guadagno\0"
+					"guaio\0"
+					"guanto\0"
+					"guardare\0"
+					"gufo\0"
+					"guidare\0"
+					"ibernato\0"
+					"icona\0"
+					"identico\0"
+					"idillio\0"
+					"idolo\0"
+					"idra\0"
+					"idrico\0"
+					"idrogeno\0"
+					"igiene\0"
+					"ignaro\0"
+					"ignorato\0"
+					"ilare\0"
+					"illeso\0"
+					"illogico\0"
+					"illudere\0"
+					"imballo\0"
+					"imbevuto\0"
+					"imbocco\0"
+					"imbuto\0"
+					"immane\0"
+					"immerso\0"
+					"immolato\0"
+					"impacco\0"
+					"impeto\0"
+					"impiego\0"
+					"importo\0"
+					"impronta\0"
+					"inalare\0"
+					"inarcare\0"
+					"inattivo\0"
+					"incanto\0"
+					"incendio\0"
+					"inchino\0"
+					"incisivo\0"
+					"incluso\0"
+					"incontro\0"
+					"incrocio\0"
+					"incubo\0"
+					"indagine\0"
+					"india\0"
+					"indole\0"
+					"inedito\0"
+					"infatti\0"
+					"infilare\0"
+					"inflitto\0"
+					"ingaggio\0"
+					"ingegno\0"
+					"inglese\0"
+					"ingordo\0"
+					"ingrosso\0"
+					"innesco\0"
+					"inodore\0"
+					"inoltrare\0"
+					"inondato\0"
+					"insano\0"
+					"insetto\0"
+					"insieme\0"
+					"insonnia\0"
+					"insulina\0"
+					"intasato\0"
+					"intero\0"
+					"intonaco\0"
+					"intuito\0"
+					"inumidire\0"
+					"invalido\0"
+					"invece\0"
+					"invito\0"
+					"iperbole\0"
+					"ipnotico\0"
+					"ipotesi\0"
+					"ippica\0"
+					"iride\0"
+					"irlanda\0"
+					"ironico\0"
+					"irrigato\0"
+					"irrorare\0"
+					"isolato\0"
+					"isotopo\0"
+					"isterico\0"
+					"istituto\0"
+					"istrice\0"
+					"italia\0"
+					"iterare\0"
+					"labbro\0"
+					"labirinto\0"
+					"lacca\0"
+					"lacerato\0"
+					"lacrima\0"
+					"lacuna\0"
+					"laddove\0"
+					"lago\0"
+					"lampo\0"
+					"lancetta\0"
+					"lanterna\0"
+					"lardoso\0"
+					"larga\0"
+					"laringe\0"
+					"lastra\0"
+					"latenza\0"
+					"latino\0"
+					"lattuga\0"
+					"lavagna\0"
+					"lavoro\0"
+					"legale\0"
+					"leggero\0"
+					"lembo\0"
+					"lentezza\0"
+					"lenza\0"
+					"leone\0"
+					"lepre\0"
+					"lesivo\0"
+					"lessato\0"
+					"lesto\0"
+					"letterale\0"
+					"leva\0"
+					"levigato\0"
+					"libero\0"
+					"lido\0"
+					"lievito\0"
+					"lilla\0"
+					"limatura\0"
+					"limitare\0"
+					"limpido\0"
+					"lineare\0"
+					"lingua\0"
+					"liquido\0"
+					"lira\0"
+					"lirica\0"
+					"lisca\0"
+					"lite\0"
+					"litigio\0"
+					"livrea\0"
+					"locanda\0"
+					"lode\0"
+					"logica\0"
+					"lombare\0"
+					"londra\0"
+					"longevo\0"
+					"loquace\0"
+					"lorenzo\0"
+					"loto\0"
+					"lotteria\0"
+					"luce\0"
+					"lucidato\0"
+					"lumaca\0"
+					"luminoso\0"
+					"lungo\0"
+					"lupo\0"
+					"luppolo\0"
+					"lusinga\0"
+					"lusso\0"
+					"lutto\0"
+					"macabro\0"
+					"macchina\0"
+					"macero\0"
+					"macinato\0"
+					"madama\0"
+					"magico\0"
+					"maglia\0"
+					"magnete\0"
+					"magro\0"
+					"maiolica\0"
+					"malafede\0"
+					"malgrado\0"
+					"malinteso\0"
+					"malsano\0"
+					"malto\0"
+					"malumore\0"
+					"mana\0"
+					"mancia\0"
+					"mandorla\0"
+					"mangiare\0"
+					"manifesto\0"
+					"mannaro\0"
+					"manovra\0"
+					"mansarda\0"
+					"mantide\0"
+					"manubrio\0"
+					"mappa\0"
+					"maratona\0"
+					"marcire\0"
+					"maretta\0"
+					"marmo\0"
+					"marsupio\0"
+					"maschera\0"
+					"massaia\0"
+					"mastino\0"
+					"materasso\0"
+					"matricola\0"
+					"mattone\0"
+					"maturo\0"
+					"mazurca\0"
+					"meandro\0"
+					"meccanico\0"
+					"mecenate\0"
+					"medesimo\0"
+					"meditare\0"
+					"mega\0"
+					"melassa\0"
+					"melis\0"
+					"melodia\0"
+					"meninge\0"
+					"meno\0"
+					"mensola\0"
+					"mercurio\0"
+					"merenda\0"
+					"merlo\0"
+					"meschino\0"
+					"mese\0"
+					"messere\0"
+					"mestolo\0"
+					"metallo\0"
+					"metodo\0"
+					"mettere\0"
+					"miagolare\0"
+					"mica\0"
+					"micelio\0"
+					"michele\0"
+					"microbo\0"
+					"midollo\0"
+					"miele\0"
+					"migliore\0"
+					"milano\0"
+					"milite\0"
+					"mimosa\0"
+					"minerale\0"
+					"mini\0"
+					"minore\0"
+					"mirino\0"
+					"mirtillo\0"
+					"miscela\0"
+					"missiva\0"
+					"misto\0"
+					"misurare\0"
+					"mitezza\0"
+					"mitigare\0"
+					"mitra\0"
+					"mittente\0"
+					"mnemonico\0"
+					"modello\0"
+					"modifica\0"
+					"modulo\0"
+					"mogano\0"
+					"mogio\0"
+					"mole\0"
+					"molosso\0"
+					"monastero\0"
+					"monco\0"
+					"mondina\0"
+					"monetario\0"
+					"monile\0"
+					"monotono\0"
+					"monsone\0"
+					"montato\0"
+					"monviso\0"
+					"mora\0"
+					"mordere\0"
+					"morsicato\0"
+					"mostro\0"
+					"motivato\0"
+					"motosega\0"
+					"motto\0"
+					"movenza\0"
+					"movimento\0"
+					"mozzo\0"
+					"mucca\0"
+					"mucosa\0"
+					"muffa\0"
+					"mughetto\0"
+					"mugnaio\0"
+					"mulatto\0"
+					"mulinello\0"
+					"multiplo\0"
+					"mummia\0"
+					"munto\0"
+					"muovere\0"
+					"murale\0"
+					"musa\0"
+					"muscolo\0"
+					"musica\0"
+					"mutevole\0"
+					"muto\0"
+					"nababbo\0"
+					"nafta\0"
+					"nanometro\0"
+					"narciso\0"
+					"narice\0"
+					"narrato\0"
+					"nascere\0"
+					"nastrare\0"
+					"naturale\0"
+					"nautica\0"
+					"naviglio\0"
+					"nebulosa\0"
+					"necrosi\0"
+					"negativo\0"
+					"negozio\0"
+					"nemmeno\0"
+					"neofita\0"
+					"neretto\0"
+					"nervo\0"
+					"nessuno\0"
+					"nettuno\0"
+					"neutrale\0"
+					"neve\0"
+					"nevrotico\0"
+					"nicchia\0"
+					"ninfa\0"
+					"nitido\0"
+					"nobile\0"
+					"nocivo\0"
+					"nodo\0"
+					"nome\0"
+					"nomina\0"
+					"nordico\0"
+					"normale\0"
+					"norvegese\0"
+					"nostrano\0"
+					"notare\0"
+					"notizia\0"
+					"notturno\0"
+					"novella\0"
+					"nucleo\0"
+					"nulla\0"
+					"numero\0"
+					"nuovo\0"
+					"nutrire\0"
+					"nuvola\0"
+					"nuziale\0"
+					"oasi\0"
+					"obbedire\0"
+					"obbligo\0"
+					"obelisco\0"
+					"oblio\0"
+					"obolo\0"
+					"obsoleto\0"
+					"occasione\0"
+					"occhio\0"
+					"occidente\0"
+					"occorrere\0"
+					"occultare\0"
+					"ocra\0"
+					"oculato\0"
+					"odierno\0"
+					"odorare\0"
+					"offerta\0"
+					"offrire\0"
+					"offuscato\0"
+					"oggetto\0"
+					"oggi\0"
+					"ognuno\0"
+					"olandese\0"
+					"olfatto\0"
+					"oliato\0"
+					"oliva\0"
+					"ologramma\0"
+					"oltre\0"
+					"omaggio\0"
+					"ombelico\0"
+					"ombra\0"
+					"omega\0"
+					"omissione\0"
+					"ondoso\0"
+					"onere\0"
+					"onice\0"
+					"onnivoro\0"
+					"onorevole\0"
+					"onta\0"
+					"operato\0"
+					"opinione\0"
+					"opposto\0"
+					"oracolo\0"
+					"orafo\0"
+					"ordine\0"
+					"orecchino\0"
+					"orefice\0"
+					"orfano\0"
+					"organico\0"
+					"origine\0"
+					"orizzonte\0"
+					"orma\0"
+					"ormeggio\0"
+					"ornativo\0"
+					"orologio\0"
+					"orrendo\0"
+					"orribile\0"
+					"ortensia\0"
+					"ortica\0"
+					"orzata\0"
+					"orzo\0"
+					"osare\0"
+					"oscurare\0"
+					"osmosi\0"
+					"ospedale\0"
+					"ospite\0"
+					"ossa\0"
+					"ossidare\0"
+					"ostacolo\0"
+					"oste\0"
+					"otite\0"
+					"otre\0"
+					"ottagono\0"
+					"ottimo\0"
+					"ottobre\0"
+					"ovale\0"
+					"ovest\0"
+					"ovino\0"
+					"oviparo\0"
+					"ovocito\0"
+					"ovunque\0"
+					"ovviare\0"
+					"ozio\0"
+					"pacchetto\0"
+					"pace\0"
+					"pacifico\0"
+					"padella\0"
+					"padrone\0"
+					"paese\0"
+					"paga\0"
+					"pagina\0"
+					"palazzina\0"
+					"palesare\0"
+					"pallido\0"
+					"palo\0"
+					"palude\0"
+					"pandoro\0"
+					"pannello\0"
+					"paolo\0"
+					"paonazzo\0"
+					"paprica\0"
+					"parabola\0"
+					"parcella\0"
+					"parere\0"
+					"pargolo\0"
+					"pari\0"
+					"parlato\0"
+					"parola\0"
+					"partire\0"
+					"parvenza\0"
+					"parziale\0"
+					"passivo\0"
+					"pasticca\0"
+					"patacca\0"
+					"patologia\0"
+					"pattume\0"
+					"pavone\0"
+					"peccato\0"
+					"pedalare\0"
+					"pedonale\0"
+					"peggio\0"
+					"peloso\0"
+					"penare\0"
+					"pendice\0"
+					"penisola\0"
+					"pennuto\0"
+					"penombra\0"
+					"pensare\0"
+					"pentola\0"
+					"pepe\0"
+					"pepita\0"
+					"perbene\0"
+					"percorso\0"
+					"perdonato\0"
+					"perforare\0"
+					"pergamena\0"
+					"periodo\0"
+					"permesso\0"
+					"perno\0"
+					"perplesso\0"
+					"persuaso\0"
+					"pertugio\0"
+					"pervaso\0"
+					"pesatore\0"
+					"pesista\0"
+					"peso\0"
+					"pestifero\0"
+					"petalo\0"
+					"pettine\0"
+					"petulante\0"
+					"pezzo\0"
+					"piacere\0"
+					"pianta\0"
+					"piattino\0"
+					"piccino\0"
+					"picozza\0"
+					"piega\0"
+					"pietra\0"
+					"piffero\0"
+					"pigiama\0"
+					"pigolio\0"
+					"pigro\0"
+					"pila\0"
+					"pilifero\0"
+					"pillola\0"
+					"pilota\0"
+					"pimpante\0"
+					"pineta\0"
+					"pinna\0"
+					"pinolo\0"
+					"pioggia\0"
+					"piombo\0"
+					"piramide\0"
+					"piretico\0"
+					"pirite\0"
+					"pirolisi\0"
+					"pitone\0"
+					"pizzico\0"
+					"placebo\0"
+					"planare\0"
+					"plasma\0"
+					"platano\0"
+					"plenario\0"
+					"pochezza\0"
+					"poderoso\0"
+					"podismo\0"
+					"poesia\0"
+					"poggiare\0"
+					"polenta\0"
+					"poligono\0"
+					"pollice\0"
+					"polmonite\0"
+					"polpetta\0"
+					"polso\0"
+					"poltrona\0"
+					"polvere\0"
+					"pomice\0"
+					"pomodoro\0"
+					"ponte\0"
+					"popoloso\0"
+					"porfido\0"
+					"poroso\0"
+					"porpora\0"
+					"porre\0"
+					"portata\0"
+					"posa\0"
+					"positivo\0"
+					"possesso\0"
+					"postulato\0"
+					"potassio\0"
+					"potere\0"
+					"pranzo\0"
+					"prassi\0"
+					"pratica\0"
+					"precluso\0"
+					"predica\0"
+					"prefisso\0"
+					"pregiato\0"
+					"prelievo\0"
+					"premere\0"
+					"prenotare\0"
+					"preparato\0"
+					"presenza\0"
+					"pretesto\0"
+					"prevalso\0"
+					"prima\0"
+					"principe\0"
+					"privato\0"
+					"problema\0"
+					"procura\0"
+					"produrre\0"
+					"profumo\0"
+					"progetto\0"
+					"prolunga\0"
+					"promessa\0"
+					"pronome\0"
+					"proposta\0"
+					"proroga\0"
+					"proteso\0"
+					"prova\0"
+					"prudente\0"
+					"prugna\0"
+					"prurito\0"
+					"psiche\0"
+					"pubblico\0"
+					"pudica\0"
+					"pugilato\0"
+					"pugno\0"
+					"pulce\0"
+					"pulito\0"
+					"pulsante\0"
+					"puntare\0"
+					"pupazzo\0"
+					"pupilla\0"
+					"puro\0"
+					"quadro\0"
+					"qualcosa\0"
+					"quasi\0"
+					"querela\0"
+					"quota\0"
+					"raccolto\0"
+					"raddoppio\0"
+					"radicale\0"
+					"radunato\0"
+					"raffica\0"
+					"ragazzo\0"
+					"ragione\0"
+					"ragno\0"
+					"ramarro\0"
+					"ramingo\0"
+					"ramo\0"
+					"randagio\0"
+					"rantolare\0"
+					"rapato\0"
+					"rapina\0"
+					"rappreso\0"
+					"rasatura\0"
+					"raschiato\0"
+					"rasente\0"
+					"rassegna\0"
+					"rastrello\0"
+					"rata\0"
+					"ravveduto\0"
+					"reale\0"
+					"recepire\0"
+					"recinto\0"
+					"recluta\0"
+					"recondito\0"
+					"recupero\0"
+					"reddito\0"
+					"redimere\0"
+					"regalato\0"
+					"registro\0"
+					"regola\0"
+					"regresso\0"
+					"relazione\0"
+					"remare\0"
+					"remoto\0"
+					"renna\0"
+					"replica\0"
+					"reprimere\0"
+					"reputare\0"
+					"resa\0"
+					"residente\0"
+					"responso\0"
+					"restauro\0"
+					"rete\0"
+					"retina\0"
+					"retorica\0"
+					"rettifica\0"
+					"revocato\0"
+					"riassunto\0"
+					"ribadire\0"
+					"ribelle\0"
+					"ribrezzo\0"
+					"ricarica\0"
+					"ricco\0"
+					"ricevere\0"
+					"riciclato\0"
+					"ricordo\0"
+					"ricreduto\0"
+					"ridicolo\0"
+					"ridurre\0"
+					"rifasare\0"
+					"riflesso\0"
+					"riforma\0"
+					"rifugio\0"
+					"rigare\0"
+					"rigettato\0"
+					"righello\0"
+					"rilassato\0"
+					"rilevato\0"
+					"rimanere\0"
+					"rimbalzo\0"
+					"rimedio\0"
+					"rimorchio\0"
+					"rinascita\0"
+					"rincaro\0"
+					"rinforzo\0"
+					"rinnovo\0"
+					"rinomato\0"
+					"rinsavito\0"
+					"rintocco\0"
+					"rinuncia\0"
+					"rinvenire\0"
+					"riparato\0"
+					"ripetuto\0"
+					"ripieno\0"
+					"riportare\0"
+					"ripresa\0"
+					"ripulire\0"
+					"risata\0"
+					"rischio\0"
+					"riserva\0"
+					"risibile\0"
+					"riso\0"
+					"rispetto\0"
+					"ristoro\0"
+					"risultato\0"
+					"risvolto\0"
+					"ritardo\0"
+					"ritegno\0"
+					"ritmico\0"
+					"ritrovo\0"
+					"riunione\0"
+					"riva\0"
+					"riverso\0"
+					"rivincita\0"
+					"rivolto\0"
+					"rizoma\0"
+					"roba\0"
+					"robotico\0"
+					"robusto\0"
+					"roccia\0"
+					"roco\0"
+					"rodaggio\0"
+					"rodere\0"
+					"roditore\0"
+					"rogito\0"
+					"rollio\0"
+					"romantico\0"
+					"rompere\0"
+					"ronzio\0"
+					"rosolare\0"
+					"rospo\0"
+					"rotante\0"
+					"rotondo\0"
+					"rotula\0"
+					"rovescio\0"
+					"rubizzo\0"
+					"rubrica\0"
+					"ruga\0"
+					"rullino\0"
+					"rumine\0"
+					"rumoroso\0"
+					"ruolo\0"
+					"rupe\0"
+					"russare\0"
+					"rustico\0"
+					"sabato\0"
+					"sabbiare\0"
+					"sabotato\0"
+					"sagoma\0"
+					"salasso\0"
+					"saldatura\0"
+					"salgemma\0"
+					"salivare\0"
+					"salmone\0"
+					"salone\0"
+					"saltare\0"
+					"saluto\0"
+					"salvo\0"
+					"sapere\0"
+					"sapido\0"
+					"saporito\0"
+					"saraceno\0"
+					"sarcasmo\0"
+					"sarto\0"
+					"sassoso\0"
+					"satellite\0"
+					"satira\0"
+					"satollo\0"
+					"saturno\0"
+					"savana\0"
+					"savio\0"
+					"saziato\0"
+					"sbadiglio\0"
+					"sbalzo\0"
+					"sbancato\0"
+					"sbarra\0"
+					"sbattere\0"
+					"sbavare\0"
+					"sbendare\0"
+					"sbirciare\0"
+					"sbloccato\0"
+					"sbocciato\0"
+					"sbrinare\0"
+					"sbruffone\0"
+					"sbuffare\0"
+					"scabroso\0"
+					"scadenza\0"
+					"scala\0"
+					"scambiare\0"
+					"scandalo\0"
+					"scapola\0"
+					"scarso\0"
+					"scatenare\0"
+					"scavato\0"
+					"scelto\0"
+					"scenico\0"
+					"scettro\0"
+					"scheda\0"
+					"schiena\0"
+					"sciarpa\0"
+					"scienza\0"
+					"scindere\0"
+					"scippo\0"
+					"sciroppo\0"
+					"scivolo\0"
+					"sclerare\0"
+					"scodella\0"
+					"scolpito\0"
+					"scomparto\0"
+					"sconforto\0"
+					"scoprire\0"
+					"scorta\0"
+					"scossone\0"
+					"scozzese\0"
+					"scriba\0"
+					"scrollare\0"
+					"scrutinio\0"
+					"scuderia\0"
+					"scultore\0"
+					"scuola\0"
+					"scuro\0"
+					"scusare\0"
+					"sdebitare\0"
+					"sdoganare\0"
+					"seccatura\0"
+					"secondo\0"
+					"sedano\0"
+					"seggiola\0"
+					"segnalato\0"
+					"segregato\0"
+					"seguito\0"
+					"selciato\0"
+					"selettivo\0"
+					"sella\0"
+					"selvaggio\0"
+					"semaforo\0"
+					"sembrare\0"
+					"seme\0"
+					"seminato\0"
+					"sempre\0"
+					"senso\0"
+					"sentire\0"
+					"sepolto\0"
+					"sequenza\0"
+					"serata\0"
+					"serbato\0"
+					"sereno\0"
+					"serio\0"
+					"serpente\0"
+					"serraglio\0"
+					"servire\0"
+					"sestina\0"
+					"setola\0"
+					"settimana\0"
+					"sfacelo\0"
+					"sfaldare\0"
+					"sfamato\0"
+					"sfarzoso\0"
+					"sfaticato\0"
+					"sfera\0"
+					"sfida\0"
+					"sfilato\0"
+					"sfinge\0"
+					"sfocato\0"
+					"sfoderare\0"
+					"sfogo\0"
+					"sfoltire\0"
+					"sforzato\0"
+					"sfratto\0"
+					"sfruttato\0"
+					"sfuggito\0"
+					"sfumare\0"
+					"sfuso\0"
+					"sgabello\0"
+					"sgarbato\0"
+					"sgonfiare\0"
+					"sgorbio\0"
+					"sgrassato\0"
+					"sguardo\0"
+					"sibilo\0"
+					"siccome\0"
+					"sierra\0"
+					"sigla\0"
+					"signore\0"
+					"silenzio\0"
+					"sillaba\0"
+					"simbolo\0"
+					"simpatico\0"
+					"simulato\0"
+					"sinfonia\0"
+					"singolo\0"
+					"sinistro\0"
+					"sino\0"
+					"sintesi\0"
+					"sinusoide\0"
+					"sipario\0"
+					"sisma\0"
+					"sistole\0"
+					"situato\0"
+					"slitta\0"
+					"slogatura\0"
+					"sloveno\0"
+					"smarrito\0"
+					"smemorato\0"
+					"smentito\0"
+					"smeraldo\0"
+					"smilzo\0"
+					"smontare\0"
+					"smottato\0"
+					"smussato\0"
+					"snellire\0"
+					"snervato\0"
+					"snodo\0"
+					"sobbalzo\0"
+					"sobrio\0"
+					"soccorso\0"
+					"sociale\0"
+					"sodale\0"
+					"soffitto\0"
+					"sogno\0"
+					"soldato\0"
+					"solenne\0"
+					"solido\0"
+					"sollazzo\0"
+					"solo\0"
+					"solubile\0"
+					"solvente\0"
+					"somatico\0"
+					"somma\0"
+					"sonda\0"
+					"sonetto\0"
+					"sonnifero\0"
+					"sopire\0"
+					"soppeso\0"
+					"sopra\0"
+					"sorgere\0"
+					"sorpasso\0"
+					"sorriso\0"
+					"sorso\0"
+					"sorteggio\0"
+					"sorvolato\0"
+					"sospiro\0"
+					"sosta\0"
+					"sottile\0"
+					"spada\0"
+					"spalla\0"
+					"spargere\0"
+					"spatola\0"
+					"spavento\0"
+					"spazzola\0"
+					"specie\0"
+					"spedire\0"
+					"spegnere\0"
+					"spelatura\0"
+					"speranza\0"
+					"spessore\0"
+					"spettrale\0"
+					"spezzato\0"
+					"spia\0"
+					"spigoloso\0"
+					"spillato\0"
+					"spinoso\0"
+					"spirale\0"
+					"splendido\0"
+					"sportivo\0"
+					"sposo\0"
+					"spranga\0"
+					"sprecare\0"
+					"spronato\0"
+					"spruzzo\0"
+					"spuntino\0"
+					"squillo\0"
+					"sradicare\0"
+					"srotolato\0"
+					"stabile\0"
+					"stacco\0"
+					"staffa\0"
+					"stagnare\0"
+					"stampato\0"
+					"stantio\0"
+					"starnuto\0"
+					"stasera\0"
+					"statuto\0"
+					"stelo\0"
+					"steppa\0"
+					"sterzo\0"
+					"stiletto\0"
+					"stima\0"
+					"stirpe\0"
+					"stivale\0"
+					"stizzoso\0"
+					"stonato\0"
+					"storico\0"
+					"strappo\0"
+					"stregato\0"
+					"stridulo\0"
+					"strozzare\0"
+					"strutto\0"
+					"stuccare\0"
+					"stufo\0"
+					"stupendo\0"
+					"subentro\0"
+					"succoso\0"
+					"sudore\0"
+					"suggerito\0"
+					"sugo\0"
+					"sultano\0"
+					"suonare\0"
+					"superbo\0"
+					"supporto\0"
+					"surgelato\0"
+					"surrogato\0"
+					"sussurro\0"
+					"sutura\0"
+					"svagare\0"
+					"svedese\0"
+					"sveglio\0"
+					"svelare\0"
+					"svenuto\0"
+					"svezia\0"
+					"sviluppo\0"
+					"svista\0"
+					"svizzera\0"
+					"svolta\0"
+					"svuotare\0"
+					"tabacco\0"
+					"tabulato\0"
+					"tacciare\0"
+					"taciturno\0"
+					"tale\0"
+					"talismano\0"
+					"tampone\0"
+					"tannino\0"
+					"tara\0"
+					"tardivo\0"
+					"targato\0"
+					"tariffa\0"
+					"tarpare\0"
+					"tartaruga\0"
+					"tasto\0"
+					"tattico\0"
+					"taverna\0"
+					"tavolata\0"
+					"tazza\0"
+					"teca\0"
+					"tecnico\0"
+					"telefono\0"
+					"temerario\0"
+					"tempo\0"
+					"temuto\0"
+					"tendone\0"
+					"tenero\0"
+					"tensione\0"
+					"tentacolo\0"
+					"teorema\0"
+					"terme\0"
+					"terrazzo\0"
+					"terzetto\0"
+					"tesi\0"
+					"tesserato\0"
+					"testato\0"
+					"tetro\0"
+					"tettoia\0"
+					"tifare\0"
+					"tigella\0"
+					"timbro\0"
+					"tinto\0"
+					"tipico\0"
+					"tipografo\0"
+					"tiraggio\0"
+					"tiro\0"
+					"titanio\0"
+					"titolo\0"
+					"titubante\0"
+					"tizio\0"
+					"tizzone\0"
+					"toccare\0"
+					"tollerare\0"
+					"tolto\0"
+					"tombola\0"
+					"tomo\0"
+					"tonfo\0"
+					"tonsilla\0"
+					"topazio\0"
+					"topologia\0"
+					"toppa\0"
+					"torba\0"
+					"tornare\0"
+					"torrone\0"
+					"tortora\0"
+					"toscano\0"
+					"tossire\0"
+					"tostatura\0"
+					"totano\0"
+					"trabocco\0"
+					"trachea\0"
+					"trafila\0"
+					"tragedia\0"
+					"tralcio\0"
+					"tramonto\0"
+					"transito\0"
+					"trapano\0"
+					"trarre\0"
+					"trasloco\0"
+					"trattato\0"
+					"trave\0"
+					"treccia\0"
+					"tremolio\0"
+					"trespolo\0"
+					"tributo\0"
+					"tricheco\0"
+					"trifoglio\0"
+					"trillo\0"
+					"trincea\0"
+					"trio\0"
+					"tristezza\0"
+					"triturato\0"
+					"trivella\0"
+					"tromba\0"
+					"trono\0"
+					"troppo\0"
+					"trottola\0"
+					"trovare\0"
+					"truccato\0"
+					"tubatura\0"
+					"tuffato\0"
+					"tulipano\0"
+					"tumulto\0"
+					"tunisia\0"
+					"turbare\0"
+					"turchino\0"
+					"tuta\0"
+					"tutela\0"
+					"ubicato\0"
+					"uccello\0"
+					"uccisore\0"
+					"udire\0"
+					"uditivo\0"
+					"uffa\0"
+					"ufficio\0"
+					"uguale\0"
+					"ulisse\0"
+					"ultimato\0"
+					"umano\0"
+					"umile\0"
+					"umorismo\0"
+					"uncinetto\0"
+					"ungere\0"
+					"ungherese\0"
+					"unicorno\0"
+					"unificato\0"
+					"unisono\0"
+					"unitario\0"
+					"unte\0"
+					"uovo\0"
+					"upupa\0"
+					"uragano\0"
+					"urgenza\0"
+					"urlo\0"
+					"usanza\0"
+					"usato\0"
+					"uscito\0"
+					"usignolo\0"
+					"usuraio\0"
+					"utensile\0"
+					"utilizzo\0"
+					"utopia\0"
+					"vacante\0"
+					"vaccinato\0"
+					"vagabondo\0"
+					"vagliato\0"
+					"valanga\0"
+					"valgo\0"
+					"valico\0"
+					"valletta\0"
+					"valoroso\0"
+					"valutare\0"
+					"valvola\0"
+					"vampata\0"
+					"vangare\0"
+					"vanitoso\0"
+					"vano\0"
+					"vantaggio\0"
+					"vanvera\0"
+					"vapore\0"
+					"varano\0"
+					"varcato\0"
+					"variante\0"
+					"vasca\0"
+					"vedetta\0"
+					"vedova\0"
+					"veduto\0"
+					"vegetale\0"
+					"veicolo\0"
+					"velcro\0"
+					"velina\0"
+					"velluto\0"
+					"veloce\0"
+					"venato\0"
+					"vendemmia\0"
+					"vento\0"
+					"verace\0"
+					"verbale\0"
+					"vergogna\0"
+					"verifica\0"
+					"vero\0"
+					"verruca\0"
+					"verticale\0"
+					"vescica\0"
+					"vessillo\0"
+					"vestale\0"
+					"veterano\0"
+					"vetrina\0"
+					"vetusto\0"
+					"viandante\0"
+					"vibrante\0"
+					"vicenda\0"
+					"vichingo\0"
+					"vicinanza\0"
+					"vidimare\0"
+					"vigilia\0"
+					"vigneto\0"
+					"vigore\0"
+					"vile\0"
+					"villano\0"
+					"vimini\0"
+					"vincitore\0"
+					"viola\0"
+					"vipera\0"
+					"virgola\0"
+					"virologo\0"
+					"virulento\0"
+					"viscoso\0"
+					"visione\0"
+					"vispo\0"
+					"vissuto\0"
+					"visura\0"
+					"vita\0"
+					"vitello\0"
+					"vittima\0"
+					"vivanda\0"
+					"vivido\0"
+					"viziare\0"
+					"voce\0"
+					"voga\0"
+					"volatile\0"
+					"volere\0"
+					"volpe\0"
+					"voragine\0"
+					"vulcano\0"
+					"zampogna\0"
+					"zanna\0"
+					"zappato\0"
+					"zattera\0"
+					"zavorra\0"
+					"zefiro\0"
+					"zelante\0"
+					"zelo\0"
+					"zenzero\0"
+					"zerbino\0"
+					"zibetto\0"
+					"zinco\0"
+					"zircone\0"
+					"zitto\0"
+					"zolla\0"
+					"zotico\0"
+					"zucchero\0"
+					"zufolo\0"
+					"zulu\0"
+					"zuppa\0";
+
+			constexpr uint16_t BIP39OffsetsItalian[BIP39_WORDLIST_COUNT] = {
+					0, 6, 15, 24, 30, 37, 45, 54, 63, 72, 80, 89,
+					97, 105, 111, 117, 122, 131, 140, 146, 153, 162, 169, 178,
+					186, 192, 201, 209, 218, 226, 234, 243, 252, 258, 267, 273,
+					280, 288, 297, 303, 311, 320, 329, 338, 345, 354, 360, 368,
+					377, 382, 389, 394, 403, 412, 417, 425, 433, 439, 448, 457,
+					465, 473, 482, 491, 498, 506, 513, 522, 531, 539, 548, 556,
+					563, 571, 578, 587, 595, 603, 610, 618, 624, 632, 641, 647,
+					655, 663, 672, 681, 687, 693, 702, 710, 719, 728, 737, 746,
+					753, 758, 766, 773, 780, 787, 794, 801, 810, 818, 824, 833,
+					842, 847, 856, 864, 873, 878, 886, 895, 901, 910, 919, 928,
+					936, 944, 951, 959, 968, 977, 986, 994, 1002, 1009, 1017, 1026,
+					1033, 1041, 1049, 1056, 1063, 1068, 1076, 1083, 1092, 1100, 1108, 1117,
+					1122, 1131, 1139, 1148, 1156, 1163, 1172, 1180, 1186, 1192, 1201, 1207,
+					1216, 1221, 1230, 1238, 1243, 1252, 1259, 1268, 1276, 1284, 1292, 1298,
+					1305, 1314, 1322, 1330, 1338, 1346, 1354, 1362, 1371, 1379, 1388, 1394,
+					1403, 1410, 1420, 1427, 1433, 1440, 1448, 1455, 1463, 1470, 1475, 1483,
+					1492, 1500, 1506, 1514, 1520, 1527, 1535, 1543, 1551, 1559, 1568, 1576,
+					1582, 1591, 1599, 1607, 1616, 1622, 1630, 1638, 1644, 1649, 1656, 1662,
+					1668, 1675, 1681, 1687, 1696, 1704, 1712, 1717, 1725, 1730, 1737, 1742,
+					1749, 1756, 1761, 1770, 1776, 1785, 1793, 1800, 1809, 1818, 1824, 1833,
+					1841, 1850, 1858, 1866, 1875, 1882, 1889, 1897, 1906, 1912, 1918, 1927,
+					1935, 1943, 1951, 1959, 1965, 1972, 1980, 1989, 1998, 2005, 2013, 2023,
+					2032, 2041, 2047, 2056, 2063, 2069, 2077, 2082, 2089, 2097, 2102, 2108,
+					2114, 2122, 2131, 2139, 2145, 2153, 2160, 2169, 2177, 2185, 2193, 2199,
+					2207, 2215, 2224, 2232, 2240, 2247, 2255, 2262, 2270, 2275, 2282, 2290,
+					2298, 2305, 2313, 2322, 2331, 2339, 2345, 2353, 2362, 2371, 2377, 2385,
+					2394, 2403, 2413, 2422, 2430, 2438, 2443, 2451, 2460, 2468, 2476, 2483,
+					2491, 2497, 2505, 2514, 2522, 2529, 2537, 2547, 2552, 2559, 2569, 2578,
+					2586, 2592, 2599, 2608, 2615, 2621, 2626, 2632, 2639, 2646, 2655, 2663,
+					2669, 2678, 2687, 2692, 2701, 2709, 2715, 2724, 2733, 2739, 2747, 2755,
+					2765, 2772, 2780, 2787, 2796, 2804, 2810, 2816, 2824, 2831, 2840, 2848,
+					2856, 2864, 2871, 2879, 2889, 2895, 2900, 2907, 2916, 2923, 2932, 2939,
+					2947, 2956, 2965, 2975, 2983, 2992, 3002, 3010, 3019, 3028, 3036, 3044,
+					3051, 3061, 3069, 3077, 3086, 3094, 3102, 3108, 3116, 3123, 3131, 3139,
+					3148, 3156, 3163, 3171, 3180, 3187, 3195, 3203, 3212, 3218, 3226, 3234,
+					3240, 3248, 3254, 3262, 3271, 3280, 3287, 3294, 3301, 3308, 3316, 3323,
+					3332, 3340, 3346, 3354, 3362, 3367, 3373, 3381, 3390, 3398, 3406, 3414,
+					3421, 3429, 3437, 3445, 3454, 3461, 3469, 3477, 3485, 3494, 3503, 3511,
+					3517, 3526, 3534, 3542, 3548, 3556, 3565, 3572, 3581, 3590, 3599, 3606,
+					3616, 3624, 3634, 3643, 3653, 3660, 3669, 3678, 3685, 3692, 3700, 3709,
+					3718, 3726, 3735, 3744, 3752, 3760, 3767, 3776, 3781, 3789, 3796, 3804,
+					3813, 3821, 3829, 3838, 3847, 3856, 3861, 3868, 3876, 3885, 3894, 3902,
+					3910, 3919, 3925, 3931, 3938, 3947, 3956, 3964, 3969, 3977, 3982, 3990,
+					3997, 4005, 4011, 4018, 4025, 4034, 4041, 4046, 4052, 4060, 4069, 4075,
+					4083, 4088, 4096, 4105, 4111, 4119, 4125, 4134, 4142, 4151, 4156, 4164,
+					4172, 4182, 4191, 4200, 4209, 4216, 4224, 4231, 4237, 4242, 4247, 4253,
+					4261, 4269, 4276, 4282, 4290, 4299, 4308, 4314, 4323, 4330, 4338, 4345,
+					4353, 4361, 4368, 4376, 4384, 4393, 4401, 4408, 4417, 4424, 4429, 4436,
+					4442, 4450, 4458, 4467, 4472, 4480, 4488, 4496, 4502, 4510, 4519, 4524,
+					4532, 4541, 4549, 4558, 4567, 4573, 4581, 4590, 4596, 4604, 4613, 4621,
+					4626, 4633, 4642, 4650, 4658, 4667, 4675, 4682, 4690, 4695, 4704, 4711,
+					4717, 4726, 4734, 4742, 4749, 4758, 4767, 4775, 4781, 4790, 4797, 4805,
+					4811, 4820, 4825, 4834, 4843, 4851, 4858, 4866, 4874, 4883, 4888, 4897,
+					4904, 4911, 4916, 4923, 4929, 4936, 4944, 4952, 4961, 4970, 4976, 4984,
+					4992, 5000, 5006, 5012, 5018, 5026, 5031, 5040, 5045, 5053, 5062, 5069,
+					5075, 5083, 5090, 5096, 5104, 5113, 5119, 5126, 5134, 5142, 5149, 5156,
+					5165, 5172, 5181, 5188, 5195, 5204, 5212, 5221, 5230, 5236, 5244, 5252,
+					5262, 5270, 5278, 5286, 5291, 5300, 5308, 5316, 5322, 5331, 5337, 5346,
+					5355, 5365, 5373, 5380, 5386, 5395, 5402, 5410, 5417, 5426, 5433, 5442,
+					5450, 5456, 5464, 5472, 5479, 5484, 5493, 5499, 5505, 5513, 5520, 5525,
+					5532, 5541, 5547, 5555, 5563, 5571, 5579, 5585, 5594, 5600, 5609, 5617,
+					5626, 5634, 5643, 5649, 5656, 5663, 5672, 5677, 5686, 5692, 5700, 5708,
+					5713, 5722, 5730, 5739, 5745, 5754, 5763, 5769, 5776, 5782, 5790, 5798,
+					5807, 5814, 5820, 5827, 5834, 5842, 5851, 5859, 5866, 5874, 5882, 5888,
+					5894, 5899, 5906, 5914, 5921, 5927, 5935, 5943, 5949, 5957, 5964, 5971,
+					5980, 5988, 5995, 6001, 6008, 6016, 6023, 6030, 6037, 6044, 6053, 6059,
+					6066, 6075, 6080, 6088, 6097, 6103, 6112, 6120, 6126, 6131, 6138, 6147,
+					6154, 6161, 6170, 6176, 6183, 6192, 6201, 6209, 6218, 6226, 6233, 6240,
+					6248, 6257, 6265, 6272, 6280, 6288, 6297, 6305, 6314, 6323, 6331, 6340,
+					6348, 6357, 6365, 6374, 6383, 6390, 6399, 6405, 6412, 6420, 6428, 6437,
+					6446, 6455, 6463, 6471, 6479, 6488, 6496, 6504, 6514, 6523, 6530, 6538,
+					6546, 6555, 6564, 6573, 6580, 6589, 6597, 6607, 6616, 6623, 6630, 6639,
+					6648, 6656, 6663, 6669, 6677, 6685, 6694, 6703, 6711, 6719, 6728, 6737,
+					6745, 6752, 6760, 6767, 6777, 6783, 6792, 6800, 6807, 6815, 6820, 6826,
+					6835, 6844, 6852, 6858, 6866, 6873, 6881, 6888, 6896, 6904, 6911, 6918,
+					6926, 6932, 6941, 6947, 6953, 6959, 6966, 6974, 6980, 6990, 6995, 7004,
+					7011, 7016, 7024, 7030, 7039, 7048, 7056, 7064, 7071, 7079, 7084, 7091,
+					7097, 7102, 7110, 7117, 7125, 7130, 7137, 7145, 7152, 7160, 7168, 7176,
+					7181, 7190, 7195, 7204, 7211, 7220, 7226, 7231, 7239, 7247, 7253, 7259,
+					7267, 7276, 7283, 7292, 7299, 7306, 7313, 7321, 7327, 7336, 7345, 7354,
+					7364, 7372, 7378, 7387, 7392, 7399, 7408, 7417, 7427, 7435, 7443, 7452,
+					7460, 7469, 7475, 7484, 7492, 7500, 7506, 7515, 7524, 7532, 7540, 7550,
+					7560, 7568, 7575, 7583, 7591, 7601, 7610, 7619, 7628, 7633, 7641, 7647,
+					7655, 7663, 7668, 7676, 7685, 7693, 7699, 7708, 7713, 7721, 7729, 7737,
+					7744, 7752, 7762, 7767, 7775, 7783, 7791, 7799, 7805, 7814, 7821, 7828,
+					7835, 7844, 7849, 7856, 7863, 7872, 7880, 7888, 7894, 7903, 7911, 7920,
+					7926, 7935, 7945, 7953, 7962, 7969, 7976, 7982, 7987, 7995, 8005, 8011,
+					8019, 8029, 8036, 8045, 8053, 8061, 8069, 8074, 8082, 8092, 8099, 8108,
+					8117, 8123, 8131, 8141, 8147, 8153, 8160, 8166, 8175, 8183, 8191, 8201,
+					8210, 8217, 8223, 8231, 8238, 8243, 8251, 8258, 8267, 8272, 8280, 8286,
+					8296, 8304, 8311, 8319, 8327, 8336, 8345, 8353, 8362, 8371, 8379, 8388,
+					8396, 8404, 8412, 8420, 8426, 8434, 8442, 8451, 8456, 8466, 8474, 8480,
+					8487, 8494, 8501, 8506, 8511, 8518, 8526, 8534, 8544, 8553, 8560, 8568,
+					8577, 8585, 8592, 8598, 8605, 8611, 8619, 8626, 8634, 8639, 8648, 8656,
+					8665, 8671, 8677, 8686, 8696, 8703, 8713, 8723, 8733, 8738, 8746, 8754,
+					8762, 8770, 8778, 8788, 8796, 8801, 8808, 8817, 8825, 8832, 8838, 8848,
+					8854, 8862, 8871, 8877, 8883, 8893, 8900, 8906, 8912, 8921, 8931, 8936,
+					8944, 8953, 8961, 8969, 8975, 8982, 8992, 9000, 9007, 9016, 9024, 9034,
+					9039, 9048, 9057, 9066, 9074, 9083, 9092, 9099, 9106, 9111, 9117, 9126,
+					9133, 9142, 9149, 9154, 9163, 9172, 9177, 9183, 9188, 9197, 9204, 9212,
+					9218, 9224, 9230, 9238, 9246, 9254, 9262, 9267, 9277, 9282, 9291, 9299,
+					9307, 9313, 9318, 9325, 9335, 9344, 9352, 9357, 9364, 9372, 9381, 9387,
+					9396, 9404, 9413, 9422, 9429, 9437, 9442, 9450, 9457, 9465, 9474, 9483,
+					9491, 9500, 9508, 9518, 9526, 9533, 9541, 9550, 9559, 9566, 9573, 9580,
+					9588, 9597, 9605, 9614, 9622, 9630, 9635, 9642, 9650, 9659, 9669, 9679,
+					9689, 9697, 9706, 9712, 9722, 9731, 9740, 9748, 9757, 9765, 9770, 9780,
+					9787, 9795, 9805, 9811, 9819, 9826, 9835, 9843, 9851, 9857, 9864, 9872,
+					9880, 9888, 9894, 9899, 9908, 9916, 9923, 9932, 9939, 9945, 9952, 9960,
+					9967, 9976, 9985, 9992, 10001, 10008, 10016, 10024, 10032, 10039, 10047, 10056,
+					10065, 10074, 10082, 10089, 10098, 10106, 10115, 10123, 10133, 10142, 10148, 10157,
+					10165, 10172, 10181, 10187, 10196, 10204, 10211, 10219, 10225, 10233, 10238, 10247,
+					10256, 10266, 10275, 10282, 10289, 10296, 10304, 10313, 10321, 10330, 10339, 10348,
+					10356, 10366, 10376, 10385, 10394, 10403, 10409, 10418, 10426, 10435, 10443, 10452,
+					10460, 10469, 10478, 10487, 10495, 10504, 10512, 10520, 10526, 10535, 10542, 10550,
+					10557, 10566, 10573, 10582, 10588, 10594, 10601, 10610, 10618, 10626, 10634, 10639,
+					10646, 10655, 10661, 10669, 10675, 10684, 10694, 10703, 10712, 10720, 10728, 10736,
+					10742, 10750, 10758, 10763, 10772, 10782, 10789, 10796, 10805, 10814, 10824, 10832,
+					10841, 10851, 10856, 10866, 10872, 10881, 10889, 10897, 10907, 10916, 10924, 10933,
+					10942, 10951, 10958, 10967, 10977, 10984, 10991, 10997, 11005, 11015, 11024, 11029,
+					11039, 11048, 11057, 11062, 11069, 11078, 11088, 11097, 11107, 11116, 11124, 11133,
+					11142, 11148, 11157, 11167, 11175, 11185, 11194, 11202, 11211, 11220, 11228, 11236,
+					11243, 11253, 11262, 11272, 11281, 11290, 11299, 11307, 11317, 11327, 11335, 11344,
+					11352, 11361, 11371, 11380, 11389, 11399, 11408, 11417, 11425, 11435, 11443, 11452,
+					11459, 11467, 11475, 11484, 11489, 11498, 11506, 11516, 11525, 11533, 11541, 11549,
+					11557, 11566, 11571, 11579, 11589, 11597, 11604, 11609, 11618, 11626, 11633, 11638,
+					11647, 11654, 11663, 11670, 11677, 11687, 11695, 11702, 11711, 11717, 11725, 11733,
+					11740, 11749, 11757, 11765, 11770, 11778, 11785, 11794, 11800, 11805, 11813, 11821,
+					11828, 11837, 11846, 11853, 11861, 11871, 11880, 11889, 11897, 11904, 11912, 11919,
+					11925, 11932, 11939, 11948, 11957, 11966, 11972, 11980, 11990, 11997, 12005, 12013,
+					12020, 12026, 12034, 12044, 12051, 12060, 12067, 12076, 12084, 12093, 12103, 12113,
+					12123, 12132, 12142, 12151, 12160, 12169, 12175, 12185, 12194, 12202, 12209, 12219,
+					12227, 12234, 12242, 12250, 12257, 12265, 12273, 12281, 12290, 12297, 12306, 12314,
+					12323, 12332, 12341, 12351, 12361, 12370, 12377, 12386, 12395, 12402, 12412, 12422,
+					12431, 12440, 12447, 12453, 12461, 12471, 12481, 12491, 12499, 12506, 12515, 12525,
+					12535, 12543, 12552, 12562, 12568, 12578, 12587, 12596, 12601, 12610, 12617, 12623,
+					12631, 12639, 12648, 12655, 12663, 12670, 12676, 12685, 12695, 12703, 12711, 12718,
+					12728, 12736, 12745, 12753, 12762, 12772, 12778, 12784, 12792, 12799, 12807, 12817,
+					12823, 12832, 12841, 12849, 12859, 12868, 12876, 12882, 12891, 12900, 12910, 12918,
+					12928, 12936, 12943, 12951, 12958, 12964, 12972, 12981, 12989, 12997, 13007, 13016,
+					13025, 13033, 13042, 13047, 13055, 13065, 13073, 13079, 13087, 13095, 13102, 13112,
+					13120, 13129, 13139, 13148, 13157, 13164, 13173, 13182, 13191, 13200, 13209, 13215,
+					13224, 13231, 13240, 13248, 13255, 13264, 13270, 13278, 13286, 13293, 13302, 13307,
+					13316, 13325, 13334, 13340, 13346, 13354, 13364, 13371, 13379, 13385, 13393, 13402,
+					13410, 13416, 13426, 13436, 13444, 13450, 13458, 13464, 13471, 13480, 13488, 13497,
+					13506, 13513, 13521, 13530, 13540, 13549, 13558, 13568, 13577, 13582, 13592, 13601,
+					13609, 13617, 13627, 13636, 13642, 13650, 13659, 13668, 13676, 13685, 13693, 13703,
+					13713, 13721, 13728, 13735, 13744, 13753, 13761, 13770, 13778, 13786, 13792, 13799,
+					13806, 13815, 13821, 13828, 13836, 13845, 13853, 13861, 13869, 13878, 13887, 13897,
+					13905, 13914, 13920, 13929, 13938, 13946, 13953, 13963, 13968, 13976, 13984, 13992,
+					14001, 14011, 14021, 14030, 14037, 14045, 14053, 14061, 14069, 14077, 14084, 14093,
+					14100, 14109, 14116, 14125, 14133, 14142, 14151, 14161, 14166, 14176, 14184, 14192,
+					14197, 14205, 14213, 14221, 14229, 14239, 14245, 14253, 14261, 14270, 14276, 14281,
+					14289, 14298, 14308, 14314, 14321, 14329, 14336, 14345, 14355, 14363, 14369, 14378,
+					14387, 14392, 14402, 14410, 14416, 14424, 14431, 14439, 14446, 14452, 14459, 14469,
+					14478, 14483, 14491, 14498, 14508, 14514, 14522, 14530, 14540, 14546, 14554, 14559,
+					14565, 14574, 14582, 14592, 14598, 14604, 14612, 14620, 14628, 14636, 14644, 14654,
+					14661, 14670, 14678, 14686, 14695, 14703, 14712, 14721, 14729, 14736, 14745, 14754,
+					14760, 14768, 14777, 14786, 14794, 14803, 14813, 14820, 14828, 14833, 14843, 14853,
+					14862, 14869, 14875, 14882, 14891, 14899, 14908, 14917, 14925, 14934, 14942, 14950,
+					14958, 14967, 14972, 14979, 14987, 14995, 15004, 15010, 15018, 15023, 15031, 15038,
+					15045, 15054, 15060, 15066, 15075, 15085, 15092, 15102, 15111, 15121, 15129, 15138,
+					15143, 15148, 15154, 15162, 15170, 15175, 15182, 15188, 15195, 15204, 15212, 15221,
+					15230, 15237, 15245, 15255, 15265, 15274, 15282, 15288, 15295, 15304, 15313, 15322,
+					15330, 15338, 15346, 15355, 15360, 15370, 15378, 15385, 15392, 15400, 15409, 15415,
+					15423, 15430, 15437, 15446, 15454, 15461, 15468, 15476, 15483, 15490, 15500, 15506,
+					15513, 15521, 15530, 15539, 15544, 15552, 15562, 15570, 15579, 15587, 15596, 15604,
+					15612, 15622, 15631, 15639, 15648, 15658, 15667, 15675, 15683, 15690, 15695, 15703,
+					15710, 15720, 15726, 15733, 15741, 15750, 15760, 15768, 15776, 15782, 15790, 15797,
+					15802, 15810, 15818, 15826, 15833, 15841, 15846, 15851, 15860, 15867, 15873, 15882,
+					15890, 15899, 15905, 15913, 15921, 15929, 15936, 15944, 15949, 15957, 15965, 15973,
+					15979, 15987, 15993, 15999, 16006, 16015, 16022, 16027,
+			};
+
+			constexpr char BIP39PoolJapanese[] =
+					"あいこくしん\0"
+					"あいさつ\0"
+					"あいだ\0"
+					"あおぞら\0"
+					"あかちゃん\0"
+					"あきる\0"
+					"あけがた\0"
+					"あける\0"
+					"あこがれる\0"
+					"あさい\0"
+					"あさひ\0"
+					"あしあと\0"
+					"あじわう\0"
+					"あずかる\0"
+					"あずき\0"
+					"あそぶ\0"
+					"あたえる\0"
+					"あたためる\0"
+					"あたりまえ\0"
+					"あたる\0"
+					"あつい\0"
+					"あつかう\0"
+					"あっしゅく\0"
+					"あつまり\0"
+					"あつめる\0"
+					"あてな\0"
+					"あてはまる\0"
+					"あひる\0"
+					"あぶら\0"
+					"あぶる\0"
+					"あふれる\0"
+					"あまい\0"
+					"あまど\0"
+					"あまやかす\0"
+					"あまり\0"
+					"あみもの\0"
+					"あめりか\0"
+					"あやまる\0"
+					"あゆむ\0"
+					"あらいぐま\0"
+					"あらし\0"
+					"あらすじ\0"
+					"あらためる\0"
+					"あらゆる\0"
+					"あらわす\0"
+					"ありがとう\0"
+					"あわせる\0"
+					"あわてる\0"
+					"あんい\0"
+					"あんがい\0"
+					"あんこ\0"
+					"あんぜん\0"
+					"あんてい\0"
+					"あんない\0"
+					"あんまり\0"
+					"いいだす\0"
+					"いおん\0"
+					"いがい\0"
+					"いがく\0"
+					"いきおい\0"
+					"いきなり\0"
+					"いきもの\0"
+					"いきる\0"
+					"いくじ\0"
+					"いくぶん\0"
+					"いけばな\0"
+					"いけん\0"
+					"いこう\0"
+					"いこく\0"
+					"いこつ\0"
+					"いさましい\0"
+					"いさん\0"
+					"いしき\0"
+					"いじゅう\0"
+					"いじょう\0"
+					"いじわる\0"
+					"いずみ\0"
+					"いずれ\0"
+					"いせい\0"
+					"いせえび\0"
+					"いせかい\0"
+					"いせき\0"
+					"いぜん\0"
+					"いそうろう\0"
+					"いそがしい\0"
+					"いだい\0"
+					"いだく\0"
+					"いたずら\0"
+					"いたみ\0"
+					"いたりあ\0"
+					"いちおう\0"
+					"いちじ\0"
+					"いちど\0"
+					"いちば\0"
+					"いちぶ\0"
+					"いちりゅう\0"
+					"いつか\0"
+					"いっしゅん\0"
+					"いっせい\0"
+					"いっそう\0"
+					"いったん\0"
+					"いっち\0"
+					"いってい\0"
+					"いっぽう\0"
+					"いてざ\0"
+					"いてん\0"
+					"いどう\0"
+					"いとこ\0"
+					"いない\0"
+					"いなか\0"
+					"いねむり\0"
+					"いのち\0"
+					"いのる\0"
+					"いはつ\0"
+					"いばる\0"
+					"いはん\0"
+					"いびき\0"
+					"いひん\0"
+					"いふく\0"
+					"いへん\0"
+					"いほう\0"
+					"いみん\0"
+					"いもうと\0"
+					"いもたれ\0"
+					"いもり\0"
+					"いやがる\0"
+					"いやす\0"
+					"いよかん\0"
+					"いよく\0"
+					"いらい\0"
+					"いらすと\0"
+					"いりぐち\0"
+					"いりょう\0"
+					"いれい\0"
+					"いれもの\0"
+					"いれる\0"
+					"いろえんぴつ\0"
+					"いわい\0"
+					"いわう\0"
+					"いわかん\0"
+					"いわば\0"
+					"いわゆる\0"
+					"いんげんまめ\0"
+					"いんさつ\0"
+					"いんしょう\0"
+					"いんよう\0"
+					"うえき\0"
+					"うえる\0"
+					"うおざ\0"
+					"うがい\0"
+					"うかぶ\0"
+					"うかべる\0"
+					"うきわ\0"
+					"うくらいな\0"
+					"うくれれ\0"
+					"うけたまわる\0"
+					"うけつけ\0"
+					"うけとる\0"
+					"うけもつ\0"
+					"うける\0"
+					"うごかす\0"
+					"うごく\0"
+					"うこん\0"
+					"うさぎ\0"
+					"うしなう\0"
+					"うしろがみ\0"
+					"うすい\0"
+					"うすぎ\0"
+					"うすぐらい\0"
+					"うすめる\0"
+					"うせつ\0"
+					"うちあわせ\0"
+					"うちがわ\0"
+					"うちき\0"
+					"うちゅう\0"
+					"うっかり\0"
+					"うつくしい\0"
+					"うったえる\0"
+					"うつる\0"
+					"うどん\0"
+					"うなぎ\0"
+					"うなじ\0"
+					"うなずく\0"
+					"うなる\0"
+					"うねる\0"
+					"うのう\0"
+					"うぶげ\0"
+					"うぶごえ\0"
+					"うまれる\0"
+					"うめる\0"
+					"うもう\0"
+					"うやまう\0"
+					"うよく\0"
+					"うらがえす\0"
+					"うらぐち\0"
+					"うらない\0"
+					"うりあげ\0"
+					"うりきれ\0"
+					"うるさい\0"
+					"うれしい\0"
+					"うれゆき\0"
+					"うれる\0"
+					"うろこ\0"
+					"うわき\0"
+					"うわさ\0"
+					"うんこう\0"
+					"うんちん\0"
+					"うんてん\0"
+					"うんどう\0"
+					"えいえん\0"
+					"えいが\0"
+					"えいきょう\0"
+					"えいご\0"
+					"えいせい\0"
+					"えいぶん\0"
+					"えいよう\0"
+					"えいわ\0"
+					"えおり\0"
+					"えがお\0"
+					"えがく\0"
+					"えきたい\0"
+					"えくせる\0"
+					"えしゃく\0"
+					"えすて\0"
+					"えつらん\0"
+					"えのぐ\0"
+					"えほうまき\0"
+					"えほん\0"
+					"えまき\0"
+					"えもじ\0"
+					"えもの\0"
+					"えらい\0"
+					"えらぶ\0"
+					"えりあ\0"
+					"えんえん\0"
+					"えんかい\0"
+					"えんぎ\0"
+					"えんげき\0"
+					"えんしゅう\0"
+					"えんぜつ\0"
+					"えんそく\0"
+					"えんちょう\0"
+					"えんとつ\0"
+					"おいかける\0"
+					"おいこす\0"
+					"おいしい\0"
+					"おいつく\0"
+					"おうえん\0"
+					"おうさま\0"
+					"おうじ\0"
+					"おうせつ\0"
+					"おうたい\0"
+					"おうふく\0"
+					"おうべい\0"
+					"おうよう\0"
+					"おえる\0"
+					"おおい\0"
+					"おおう\0"
+					"おおどおり\0"
+					"おおや\0"
+					"おおよそ\0"
+					"おかえり\0"
+					"おかず\0"
+					"おがむ\0"
+					"おかわり\0"
+					"おぎなう\0"
+					"おきる\0"
+					"おくさま\0"
+					"おくじょう\0"
+					"おくりがな\0"
+					"おくる\0"
+					"おくれる\0"
+					"おこす\0"
+					"おこなう\0"
+					"おこる\0"
+					"おさえる\0"
+					"おさない\0"
+					"おさめる\0"
+					"おしいれ\0"
+					"おしえる\0"
+					"おじぎ\0"
+					"おじさん\0"
+					"おしゃれ\0"
+					"おそらく\0"
+					"おそわる\0"
+					"おたがい\0"
+					"おたく\0"
+					"おだやか\0"
+					"おちつく\0"
+					"おっと\0"
+					"おつり\0"
+					"おでかけ\0"
+					"おとしもの\0"
+					"おとなしい\0"
+					"おどり\0"
+					"おどろかす\0"
+					"おばさん\0"
+					"おまいり\0"
+					"おめでとう\0"
+					"おもいで\0"
+					"おもう\0"
+					"おもたい\0"
+					"おもちゃ\0"
+					"おやつ\0"
+					"おやゆび\0"
+					"およぼす\0"
+					"おらんだ\0"
+					"おろす\0"
+					"おんがく\0"
+					"おんけい\0"
+					"おんしゃ\0"
+					"おんせん\0"
+					"おんだん\0"
+					"おんちゅう\0"
+					"おんどけい\0"
+					"かあつ\0"
+					"かいが\0"
+					"がいき\0"
+					"がいけん\0"
+					"がいこう\0"
+					"かいさつ\0"
+					"かいしゃ\0"
+					"かいすいよく\0"
+					"かいぜん\0"
+					"かいぞうど\0"
+					"かいつう\0"
+					"かいてん\0"
+					"かいとう\0"
+					"かいふく\0"
+					"がいへき\0"
+					"かいほう\0"
+					"かいよう\0"
+					"がいらい\0"
+					"かいわ\0"
+					"かえる\0"
+					"かおり\0"
+					"かかえる\0"
+					"かがく\0"
+					"かがし\0"
+					"かがみ\0"
+					"かくご\0"
+					"かくとく\0"
+					"かざる\0"
+					"がぞう\0"
+					"かたい\0"
+					"かたち\0"
+					"がちょう\0"
+					"がっきゅう\0"
+					"がっこう\0"
+					"がっさん\0"
+					"がっしょう\0"
+					"かなざわし\0"
+					"かのう\0"
+					"がはく\0"
+					"かぶか\0"
+					"かほう\0"
+					"かほご\0"
+					"かまう\0"
+					"かまぼこ\0"
+					"かめれおん\0"
+					"かゆい\0"
+					"かようび\0"
+					"からい\0"
+					"かるい\0"
+					"かろう\0"
+					"かわく\0"
+					"かわら\0"
+					"がんか\0"
+					"かんけい\0"
+					"かんこう\0"
+					"かんしゃ\0"
+					"かんそう\0"
+					"かんたん\0"
+					"かんち\0"
+					"がんばる\0"
+					"きあい\0"
+					"きあつ\0"
+					"きいろ\0"
+					"ぎいん\0"
+					"きうい\0"
+					"きうん\0"
+					"きえる\0"
+					"きおう\0"
+					"きおく\0"
+					"きおち\0"
+					"きおん\0"
+					"きかい\0"
+					"きかく\0"
+					"きかんしゃ\0"
+					"ききて\0"
+					"きくばり\0"
+					"きくらげ\0"
+					"きけんせい\0"
+					"きこう\0"
+					"きこえる\0"
+					"きこく\0"
+					"きさい\0"
+					"きさく\0"
+					"きさま\0"
+					"きさらぎ\0"
+					"ぎじかがく\0"
+					"ぎしき\0"
+					"ぎじたいけん\0"
+					"ぎじにってい\0"
+					"ぎじゅつしゃ\0"
+					"きすう\0"
+					"きせい\0"
+					"きせき\0"
+					"きせつ\0"
+					"きそう\0"
+					"きぞく\0"
+					"きぞん\0"
+					"きたえる\0"
+					"きちょう\0"
+					"きつえん\0"
+					"ぎっちり\0"
+					"きつつき\0"
+					"きつね\0"
+					"きてい\0"
+					"きどう\0"
+					"きどく\0"
+					"きない\0"
+					"きなが\0"
+					"きなこ\0"
+					"きぬごし\0"
+					"きねん\0"
+					"きのう\0"
+					"きのした\0"
+					"きはく\0"
+					"きびしい\0"
+					"きひん\0"
+					"きふく\0"
+					"きぶん\0"
+					"きぼう\0"
+					"きほん\0"
+					"きまる\0"
+					"きみつ\0"
+					"きむずかしい\0"
+					"きめる\0"
+					"きもだめし\0"
+					"きもち\0"
+					"きもの\0"
+					"きゃく\0"
+					"きやく\0"
+					"ぎゅうにく\0"
+					"きよう\0"
+					"きょうりゅう\0"
+					"きらい\0"
+					"きらく\0"
+					"きりん\0"
+					"きれい\0"
+					"きれつ\0"
+					"きろく\0"
+					"ぎろん\0"
+					"きわめる\0"
+					"ぎんいろ\0"
+					"きんかくじ\0"
+					"きんじょ\0"
+					"きんようび\0"
+					"ぐあい\0"
+					"くいず\0"
+					"くうかん\0"
+					"くうき\0"
+					"くうぐん\0"
+					"くうこう\0"
+					"ぐうせい\0"
+					"くうそう\0"
+					"ぐうたら\0"
+					"くうふく\0"
+					"くうぼ\0"
+					"くかん\0"
+					"くきょう\0"
+					"くげん\0"
+					"ぐこう\0"
+					"くさい\0"
+					"くさき\0"
+					"くさばな\0"
+					"くさる\0"
+					"くしゃみ\0"
+					"くしょう\0"
+					"くすのき\0"
+					"くすりゆび\0"
+					"くせげ\0"
+					"くせん\0"
+					"ぐたいてき\0"
+					"くださる\0"
+					"くたびれる\0"
+					"くちこみ\0"
+					"くちさき\0"
+					"くつした\0"
+					"ぐっすり\0"
+					"くつろぐ\0"
+					"くとうてん\0"
+					"くどく\0"
+					"くなん\0"
+					"くねくね\0"
+					"くのう\0"
+					"くふう\0"
+					"くみあわせ\0"
+					"くみたてる\0"
+					"くめる\0"
+					"くやくしょ\0"
+					"くらす\0"
+					"くらべる\0"
+					"くるま\0"
+					"くれる\0"
+					"くろう\0"
+					"くわしい\0"
+					"ぐんかん\0"
+					"ぐんしょく\0"
+					"ぐんたい\0"
+					"ぐんて\0"
+					"けあな\0"
+					"けいかく\0"
+					"けいけん\0"
+					"けいこ\0"
+					"けいさつ\0"
+					"げいじゅつ\0"
+					"けいたい\0"
+					"げいのうじん\0"
+					"けいれき\0"
+					"けいろ\0"
+					"けおとす\0"
+					"けおりもの\0"
+					"げきか\0"
+					"げきげん\0"
+					"げきだん\0"
+					"げきちん\0"
+					"げきとつ\0"
+					"げきは\0"
+					"げきやく\0"
+					"げこう\0"
+					"げこくじょう\0"
+					"げざい\0"
+					"けさき\0"
+					"げざん\0"
+					"けしき\0"
+					"けしごむ\0"
+					"けしょう\0"
+					"げすと\0"
+					"けたば\0"
+					"けちゃっぷ\0"
+					"けちらす\0"
+					"けつあつ\0"
+					"けつい\0"
+					"けつえき\0"
+					"けっこん\0"
+					"けつじょ\0"
+					"けっせき\0"
+					"けってい\0"
+					"けつまつ\0"
+					"げつようび\0"
+					"げつれい\0"
+					"けつろん\0"
+					"げどく\0"
+					"けとばす\0"
+					"けとる\0"
+					"けなげ\0"
+					"けなす\0"
+					"けなみ\0"
+					"けぬき\0"
+					"げねつ\0"
+					"けねん\0"
+					"けはい\0"
+					"げひん\0"
+					"けぶかい\0"
+					"げぼく\0"
+					"けまり\0"
+					"けみかる\0"
+					"けむし\0"
+					"けむり\0"
+					"けもの\0"
+					"けらい\0"
+					"けろけろ\0"
+					"けわしい\0"
+					"けんい\0"
+					"けんえつ\0"
+					"けんお\0"
+					"けんか\0"
+					"げんき\0"
+					"けんげん\0"
+					"けんこう\0"
+					"けんさく\0"
+					"けんしゅう\0"
+					"けんすう\0"
+					"げんそう\0"
+					"けんちく\0"
+					"けんてい\0"
+					"けんとう\0"
+					"けんない\0"
+					"けんにん\0"
+					"げんぶつ\0"
+					"けんま\0"
+					"けんみん\0"
+					"けんめい\0"
+					"けんらん\0"
+					"けんり\0"
+					"こあくま\0"
+					"こいぬ\0"
+					"こいびと\0"
+					"ごうい\0"
+					"こうえん\0"
+					"こうおん\0"
+					"こうかん\0"
+					"ごうきゅう\0"
+					"ごうけい\0"
+					"こうこう\0"
+					"こうさい\0"
+					"こうじ\0"
+					"こうすい\0"
+					"ごうせい\0"
+					"こうそく\0"
+					"こうたい\0"
+					"こうちゃ\0"
+					"こうつう\0"
+					"こうてい\0"
+					"こうどう\0"
+					"こうない\0"
+					"こうはい\0"
+					"ごうほう\0"
+					"ごうまん\0"
+					"こうもく\0"
+					"こうりつ\0"
+					"こえる\0"
+					"こおり\0"
+					"ごかい\0"
+					"ごがつ\0"
+					"ごかん\0"
+					"こくご\0"
+					"こくさい\0"
+					"こくとう\0"
+					"こくない\0"
+					"こくはく\0"
+					"こぐま\0"
+					"こけい\0"
+					"こける\0"
+					"ここのか\0"
+					"こころ\0"
+					"こさめ\0"
+					"こしつ\0"
+					"こすう\0"
+					"こせい\0"
+					"こせき\0"
+					"こぜん\0"
+					"こそだて\0"
+					"こたい\0"
+					"こたえる\0"
+					"こたつ\0"
+					"こちょう\0"
+					"こっか\0"
+					"こつこつ\0"
+					"こつばん\0"
+					"こつぶ\0"
+					"こてい\0"
+					"こてん\0"
+					"ことがら\0"
+					"ことし\0"
+					"ことば\0"
+					"ことり\0"
+					"こなごな\0"
+					"こねこね\0"
+					"このまま\0"
+					"このみ\0"
+					"このよ\0"
+					"ごはん\0"
+					"こひつじ\0"
+					"こふう\0"
+					"こふん\0"
+					"こぼれる\0"
+					"ごまあぶら\0"
+					"こまかい\0"
+					"ごますり\0"
+					"こまつな\0"
+					"こまる\0"
+					"こむぎこ\0"
+					"こもじ\0"
+					"こもち\0"
+					"こもの\0"
+					"こもん\0"
+					"こやく\0"
+					"こやま\0"
+					"こゆう\0"
+					"こゆび\0"
+					"こよい\0"
+					"こよう\0"
+					"こりる\0"
+					"これくしょん\0"
+					"ころっけ\0"
+					"こわもて\0"
+					"こわれる\0"
+					"こんいん\0"
+					"こんかい\0"
+					"こんき\0"
+					"こんしゅう\0"
+					"こんすい\0"
+					"こんだて\0"
+					"こんとん\0"
+					"こんなん\0"
+					"こんびに\0"
+					"こんぽん\0"
+					"こんまけ\0"
+					"こんや\0"
+					"こんれい\0"
+					"こんわく\0"
+					"ざいえき\0"
+					"さいかい\0"
+					"さいきん\0"
+					"ざいげん\0"
+					"ざいこ\0"
+					"さいしょ\0"
+					"さいせい\0"
+					"ざいたく\0"
+					"ざいちゅう\0"
+					"さいてき\0"
+					"ざいりょう\0"
+					"さうな\0"
+					"さかいし\0"
+					"さがす\0"
+					"さかな\0"
+					"さかみち\0"
+					"さがる\0"
+					"さぎょう\0"
+					"さくし\0"
+					"さくひん\0"
+					"さくら\0"
+					"さこく\0"
+					"さこつ\0"
+					"さずかる\0"
+					"ざせき\0"
+					"さたん\0"
+					"さつえい\0"
+					"ざつおん\0"
+					"ざっか\0"
+					"ざつがく\0"
+					"さっきょく\0"
+					"ざっし\0"
+					"さつじん\0"
+					"ざっそう\0"
+					"さつたば\0"
+					"さつまいも\0"
+					"さてい\0"
+					"さといも\0"
+					"さとう\0"
+					"さとおや\0"
+					"さとし\0"
+					"さとる\0"
+					"さのう\0"
+					"さばく\0"
+					"さびしい\0"
+					"さべつ\0"
+					"さほう\0"
+					"さほど\0"
+					"さます\0"
+					"さみしい\0"
+					"さみだれ\0"
+					"さむけ\0"
+					"さめる\0"
+					"さやえんどう\0"
+					"さゆう\0"
+					"さよう\0"
+					"さよく\0"
+					"さらだ\0"
+					"ざるそば\0"
+					"さわやか\0"
+					"さわる\0"
+					"さんいん\0"
+					"さんか\0"
+					"さんきゃく\0"
+					"さんこう\0"
+					"さんさい\0"
+					"ざんしょ\0"
+					"さんすう\0"
+					"さんせい\0"
+					"さんそ\0"
+					"さんち\0"
+					"さんま\0"
+					"さんみ\0"
+					"さんらん\0"
+					"しあい\0"
+					"しあげ\0"
+					"しあさって\0"
+					"しあわせ\0"
+					"しいく\0"
+					"しいん\0"
+					"しうち\0"
+					"しえい\0"
+					"しおけ\0"
+					"しかい\0"
+					"しかく\0"
+					"じかん\0"
+					"しごと\0"
+					"しすう\0"
+					"じだい\0"
+					"したうけ\0"
+					"したぎ\0"
+					"したて\0"
+					"したみ\0"
+					"しちょう\0"
+					"しちりん\0"
+					"しっかり\0"
+					"しつじ\0"
+					"しつもん\0"
+					"してい\0"
+					"してき\0"
+					"してつ\0"
+					"じてん\0"
+					"じどう\0"
+					"しなぎれ\0"
+					"しなもの\0"
+					"しなん\0"
+					"しねま\0"
+					"しねん\0"
+					"しのぐ\0"
+					"しのぶ\0"
+					"しはい\0"
+					"しばかり\0"
+					"しはつ\0"
+					"しはらい\0"
+					"しはん\0"
+					"しひょう\0"
+					"しふく\0"
+					"じぶん\0"
+					"しへい\0"
+					"しほう\0"
+					"しほん\0"
+					"しまう\0"
+					"しまる\0"
+					"しみん\0"
+					"しむける\0"
+					"じむしょ\0"
+					"しめい\0"
+					"しめる\0"
+					"しもん\0"
+					"しゃいん\0"
+					"しゃうん\0"
+					"しゃおん\0"
+					"じゃがいも\0"
+					"しやくしょ\0"
+					"しゃくほう\0"
+					"しゃけん\0"
+					"しゃこ\0"
+					"しゃざい\0"
+					"しゃしん\0"
+					"しゃせん\0"
+					"しゃそう\0"
+					"しゃたい\0"
+					"しゃちょう\0"
+					"しゃっきん\0"
+					"じゃま\0"
+					"しゃりん\0"
+					"しゃれい\0"
+					"じゆう\0"
+					"じゅうしょ\0"
+					"しゅくはく\0"
+					"じゅしん\0"
+					"しゅっせき\0"
+					"しゅみ\0"
+					"しゅらば\0"
+					"じゅんばん\0"
+					"しょうかい\0"
+					"しょくたく\0"
+					"しょっけん\0"
+					"しょどう\0"
+					"しょもつ\0"
+					"しらせる\0"
+					"しらべる\0"
+					"しんか\0"
+					"しんこう\0"
+					"じんじゃ\0"
+					"しんせいじ\0"
+					"しんちく\0"
+					"しんりん\0"
+					"すあげ\0"
+					"すあし\0"
+					"すあな\0"
+					"ずあん\0"
+					"すいえい\0"
+					"すいか\0"
+					"すいとう\0"
+					"ずいぶん\0"
+					"すいようび\0"
+					"すうがく\0"
+					"すうじつ\0"
+					"すうせん\0"
+					"すおどり\0"
+					"すきま\0"
+					"すくう\0"
+					"すくない\0"
+					"すける\0"
+					"すごい\0"
+					"すこし\0"
+					"ずさん\0"
+					"すずしい\0"
+					"すすむ\0"
+					"すすめる\0"
+					"すっかり\0"
+					"ずっしり\0"
+					"ずっと\0"
+					"すてき\0"
+					"すてる\0"
+					"すねる\0"
+					"すのこ\0"
+					"すはだ\0"
+					"すばらしい\0"
+					"ずひょう\0"
+					"ずぶぬれ\0"
+					"すぶり\0"
+					"すふれ\0"
+					"すべて\0"
+					"すべる\0"
+					"ずほう\0"
+					"すぼん\0"
+					"すまい\0"
+					"すめし\0"
+					"すもう\0"
+					"すやき\0"
+					"すらすら\0"
+					"するめ\0"
+					"すれちがう\0"
+					"すろっと\0"
+					"すわる\0"
+					"すんぜん\0"
+					"すんぽう\0"
+					"せあぶら\0"
+					"せいかつ\0"
+					"せいげん\0"
+					"せいじ\0"
+					"せいよう\0"
+					"せおう\0"
+					"せかいかん\0"
+					"せきにん\0"
+					"せきむ\0"
+					"せきゆ\0"
+					"せきらんうん\0"
+					"せけん\0"
+					"せこう\0"
+					"せすじ\0"
+					"せたい\0"
+					"せたけ\0"
+					"せっかく\0"
+					"せっきゃく\0"
+					"ぜっく\0"
+					"せっけん\0"
+					"せっこつ\0"
+					"せっさたくま\0"
+					"せつぞく\0"
+					"せつだん\0"
+					"せつでん\0"
+					"せっぱん\0"
+					"せつび\0"
+					"せつぶん\0"
+					"せつめい\0"
+					"せつりつ\0"
+					"せなか\0"
+					"せのび\0"
+					"せはば\0"
+					"せびろ\0"
+					"せぼね\0"
+					"せまい\0"
+					"せまる\0"
+					"せめる\0"
+					"せもたれ\0"
+					"せりふ\0"
+					"ぜんあく\0"
+					"せんい\0"
+					"せんえい\0"
+					"せんか\0"
+					"せんきょ\0"
+					"せんく\0"
+					"せんげん\0"
+					"ぜんご\0"
+					"せんさい\0"
+					"せんしゅ\0"
+					"せんすい\0"
+					"せんせい\0"
+					"せんぞ\0"
+					"せんたく\0"
+					"せんちょう\0"
+					"せんてい\0"
+					"せんとう\0"
+					"せんぬき\0"
+					"せんねん\0"
+					"せんぱい\0"
+					"ぜんぶ\0"
+					"ぜんぽう\0"
+					"せんむ\0"
+					"せんめんじょ\0"
+					"せんもん\0"
+					"せんやく\0"
+					"せんゆう\0"
+					"せんよう\0"
+					"ぜんら\0"
+					"ぜんりゃく\0"
+					"せんれい\0"
+					"せんろ\0"
+					"そあく\0"
+					"そいとげる\0"
+					"そいね\0"
+					"そうがんきょう\0"
+					"そうき\0"
+					"そうご\0"
+					"そうしん\0"
+					"そうだん\0"
+					"そうなん\0"
+					"そうび\0"
+					"そうめん\0"
+					"そうり\0"
+					"そえもの\0"
+					"そえん\0"
+					"そがい\0"
+					"そげき\0"
+					"そこう\0"
+					"そこそこ\0"
+					"そざい\0"
+					"そしな\0"
+					"そせい\0"
+					"そせん\0"
+					"そそぐ\0"
+					"そだてる\0"
+					"そつう\0"
+					"そつえん\0"
+					"そっかん\0"
+					"そつぎょう\0"
+					"そっけつ\0"
+					"そっこう\0"
+					"そっせん\0"
+					"そっと\0"
+					"そとがわ\0"
+					"そとづら\0"
+					"そなえる\0"
+					"そなた\0"
+					"そふぼ\0"
+					"そぼく\0"
+					"そぼろ\0"
+					"そまつ\0"
+					"そまる\0"
+					"そむく\0"
+					"そむりえ\0"
+					"そめる\0"
+					"そもそも\0"
+					"そよかぜ\0"
+					"そらまめ\0"
+					"そろう\0"
+					"そんかい\0"
+					"そんけい\0"
+					"そんざい\0"
+					"そんしつ\0"
+					"そんぞく\0"
+					"そんちょう\0"
+					"ぞんび\0"
+					"ぞんぶん\0"
+					"そんみん\0"
+					"たあい\0"
+					"たいいん\0"
+					"たいうん\0"
+					"たいえき\0"
+					"たいおう\0"
+					"だいがく\0"
+					"たいき\0"
+					"たいぐう\0"
+					"たいけん\0"
+					"たいこ\0"
+					"たいざい\0"
+					"だいじょうぶ\0"
+					"だいすき\0"
+					"たいせつ\0"
+					"たいそう\0"
+					"だいたい\0"
+					"たいちょう\0"
+					"たいてい\0"
+					"だいどころ\0"
+					"たいない\0"
+					"たいねつ\0"
+					"たいのう\0"
+					"たいはん\0"
+					"だいひょう\0"
+					"たいふう\0"
+					"たいへん\0"
+					"たいほ\0"
+					"たいまつばな\0"
+					"たいみんぐ\0"
+					"たいむ\0"
+					"たいめん\0"
+					"たいやき\0"
+					"たいよう\0"
+					"たいら\0"
+					"たいりょく\0"
+					"たいる\0"
+					"たいわん\0"
+					"たうえ\0"
+					"たえる\0"
+					"たおす\0"
+					"たおる\0"
+					"たおれる\0"
+					"たかい\0"
+					"たかね\0"
+					"たきび\0"
+					"たくさん\0"
+					"たこく\0"
+					"たこやき\0"
+					"たさい\0"
+					"たしざん\0"
+					"だじゃれ\0"
+					"たすける\0"
+					"たずさわる\0"
+					"たそがれ\0"
+					"たたかう\0"
+					"たたく\0"
+					"ただしい\0"
+					"たたみ\0"
+					"たちばな\0"
+					"だっかい\0"
+					"だっきゃく\0"
+					"だっこ\0"
+					"だっしゅつ\0"
+					"だったい\0"
+					"たてる\0"
+					"たとえる\0"
+					"たなばた\0"
+					"たにん\0"
+					"たぬき\0"
+					"たのしみ\0"
+					"たはつ\0"
+					"たぶん\0"
+					"たべる\0"
+					"たぼう\0"
+					"たまご\0"
+					"たまる\0"
+					"だむる\0"
+					"ためいき\0"
+					"ためす\0"
+					"ためる\0"
+					"たもつ\0"
+					"たやすい\0"
+					"たよる\0"
+					"たらす\0"
+					"たりきほんがん\0"
+					"たりょう\0"
+					"たりる\0"
+					"たると\0"
+					"たれる\0"
+					"たれんと\0"
+					"たろっと\0"
+					"たわむれる\0"
+					"だんあつ\0"
+					"たんい\0"
+					"たんおん\0"
+					"たんか\0"
+					"たんき\0"
+					"たんけん\0"
+					"たんご\0"
+					"たんさん\0"
+					"たんじょうび\0"
+					"だんせい\0"
+					"たんそく\0"
+					"たんたい\0"
+					"だんち\0"
+					"たんてい\0"
+					"たんとう\0"
+					"だんな\0"
+					"たんにん\0"
+					"だんねつ\0"
+					"たんのう\0"
+					"たんぴん\0"
+					"だんぼう\0"
+					"たんまつ\0"
+					"たんめい\0"
+					"だんれつ\0"
+					"だんろ\0"
+					"だんわ\0"
+					"ちあい\0"
+					"ちあん\0"
+					"ちいき\0"
+					"ちいさい\0"
+					"ちえん\0"
+					"ちかい\0"
+					"ちから\0"
+					"ちきゅう\0"
+					"ちきん\0"
+					"ちけいず\0"
+					"ちけん\0"
+					"ちこく\0"
+					"ちさい\0"
+					"ちしき\0"
+					"ちしりょう\0"
+					"ちせい\0"
+					"ちそう\0"
+					"ちたい\0"
+					"ちたん\0"
+					"ちちおや\0"
+					"ちつじょ\0"
+					"ちてき\0"
+					"ちてん\0"
+					"ちぬき\0"
+					"ちぬり\0"
+					"ちのう\0"
+					"ちひょう\0"
+					"ちへいせん\0"
+					"ちほう\0"
+					"ちまた\0"
+					"ちみつ\0"
+					"ちみどろ\0"
+					"ちめいど\0"
+					"ちゃんこなべ\0"
+					"ちゅうい\0"
+					"ちゆりょく\0"
+					"ちょうし\0"
+					"ちょさくけん\0"
+					"ちらし\0"
+					"ちらみ\0"
+					"ちりがみ\0"
+					"ちりょう\0"
+					"ちるど\0"
+					"ちわわ\0"
+					"ちんたい\0"
+					"ちんもく\0"
+					"ついか\0"
+					"ついたち\0"
+					"つうか\0"
+					"つうじょう\0"
+					"つうはん\0"
+					"つうわ\0"
+					"つかう\0"
+					"つかれる\0"
+					"つくね\0"
+					"つくる\0"
+					"つけね\0"
+					"つける\0"
+					"つごう\0"
+					"つたえる\0"
+					"つづく\0"
+					"つつじ\0"
+					"つつむ\0"
+					"つとめる\0"
+					"つながる\0"
+					"つなみ\0"
+					"つねづね\0"
+					"つのる\0"
+					"つぶす\0"
+					"つまらない\0"
+					"つまる\0"
+					"つみき\0"
+					"つめたい\0"
+					"つもり\0"
+					"つもる\0"
+					"つよい\0"
+					"つるぼ\0"
+					"つるみく\0"
+					"つわもの\0"
+					"つわり\0"
+					"てあし\0"
+					"てあて\0"
+					"てあみ\0"
+					"ていおん\0"
+					"ていか\0"
+					"ていき\0"
+					"ていけい\0"
+					"ていこく\0"
+					"ていさつ\0"
+					"ていし\0"
+					"ていせい\0"
+					"ていたい\0"
+					"ていど\0"
+					"ていねい\0"
+					"ていひょう\0"
+					"ていへん\0"
+					"ていぼう\0"
+					"てうち\0"
+					"ておくれ\0"
+					"てきとう\0"
+					"てくび\0"
+					"でこぼこ\0"
+					"てさぎょう\0"
+					"てさげ\0"
+					"てすり\0"
+					"てそう\0"
+					"てちがい\0"
+					"てちょう\0"
+					"てつがく\0"
+					"てつづき\0"
+					"でっぱ\0"
+					"てつぼう\0"
+					"てつや\0"
+					"でぬかえ\0"
+					"てぬき\0"
+					"てぬぐい\0"
+					"てのひら\0"
+					"てはい\0"
+					"てぶくろ\0"
+					"てふだ\0"
+					"てほどき\0"
+					"てほん\0"
+					"てまえ\0"
+					"てまきずし\0"
+					"てみじか\0"
+					"てみやげ\0"
+					"てらす\0"
+					"てれび\0"
+					"てわけ\0"
+					"てわたし\0"
+					"でんあつ\0"
+					"てんいん\0"
+					"てんかい\0"
+					"てんき\0"
+					"てんぐ\0"
+					"てんけん\0"
+					"てんごく\0"
+					"てんさい\0"
+					"てんし\0"
+					"てんすう\0"
+					"でんち\0"
+					"てんてき\0"
+					"てんとう\0"
+					"てんない\0"
+					"てんぷら\0"
+					"てんぼうだい\0"
+					"てんめつ\0"
+					"てんらんかい\0"
+					"でんりょく\0"
+					"でんわ\0"
+					"どあい\0"
+					"といれ\0"
+					"どうかん\0"
+					"とうきゅう\0"
+					"どうぐ\0"
+					"とうし\0"
+					"とうむぎ\0"
+					"とおい\0"
+					"とおか\0"
+					"とおく\0"
+					"とおす\0"
+					"とおる\0"
+					"とかい\0"
+					"とかす\0"
+					"ときおり\0"
+					"ときどき\0"
+					"とくい\0"
+					"とくしゅう\0"
+					"とくてん\0"
+					"とくに\0"
+					"とくべつ\0"
+					"とけい\0"
+					"とける\0"
+					"とこや\0"
+					"とさか\0"
+					"としょかん\0"
+					"とそう\0"
+					"とたん\0"
+					"とちゅう\0"
+					"とっきゅう\0"
+					"とっくん\0"
+					"とつぜん\0"
+					"とつにゅう\0"
+					"とどける\0"
+					"ととのえる\0"
+					"とない\0"
+					"となえる\0"
+					"となり\0"
+					"とのさま\0"
+					"とばす\0"
+					"どぶがわ\0"
+					"とほう\0"
+					"とまる\0"
+					"とめる\0"
+					"ともだち\0"
+					"ともる\0"
+					"どようび\0"
+					"とらえる\0"
+					"とんかつ\0"
+					"どんぶり\0"
+					"ないかく\0"
+					"ないこう\0"
+					"ないしょ\0"
+					"ないす\0"
+					"ないせん\0"
+					"ないそう\0"
+					"なおす\0"
+					"ながい\0"
+					"なくす\0"
+					"なげる\0"
+					"なこうど\0"
+					"なさけ\0"
+					"なたでここ\0"
+					"なっとう\0"
+					"なつやすみ\0"
+					"ななおし\0"
+					"なにごと\0"
+					"なにもの\0"
+					"なにわ\0"
+					"なのか\0"
+					"なふだ\0"
+					"なまいき\0"
+					"なまえ\0"
+					"なまみ\0"
+					"なみだ\0"
+					"なめらか\0"
+					"なめる\0"
+					"なやむ\0"
+					"ならう\0"
+					"ならび\0"
+					"ならぶ\0"
+					"なれる\0"
+					"なわとび\0"
+					"なわばり\0"
+					"にあう\0"
+					"にいがた\0"
+					"にうけ\0"
+					"におい\0"
+					"にかい\0"
+					"にがて\0"
+					"にきび\0"
+					"にくしみ\0"
+					"にくまん\0"
+					"にげる\0"
+					"にさんかたんそ\0"
+					"にしき\0"
+					"にせもの\0"
+					"にちじょう\0"
+					"にちようび\0"
+					"にっか\0"
+					"にっき\0"
+					"にっけい\0"
+					"にっこう\0"
+					"にっさん\0"
+					"にっしょく\0"
+					"にっすう\0"
+					"にっせき\0"
+					"にってい\0"
+					"になう\0"
+					"にほん\0"
+					"にまめ\0"
+					"にもつ\0"
+					"にやり\0"
+					"にゅういん\0"
+					"にりんしゃ\0"
+					"にわとり\0"
+					"にんい\0"
+					"にんか\0"
+					"にんき\0"
+					"にんげん\0"
+					"にんしき\0"
+					"にんずう\0"
+					"にんそう\0"
+					"にんたい\0"
+					"にんち\0"
+					"にんてい\0"
+					"にんにく\0"
+					"にんぷ\0"
+					"にんまり\0"
+					"にんむ\0"
+					"にんめい\0"
+					"にんよう\0"
+					"ぬいくぎ\0"
+					"ぬかす\0"
+					"ぬぐいとる\0"
+					"ぬぐう\0"
+					"ぬくもり\0"
+					"ぬすむ\0"
+					"ぬまえび\0"
+					"ぬめり\0"
+					"ぬらす\0"
+					"ぬんちゃく\0"
+					"ねあげ\0"
+					"ねいき\0"
+					"ねいる\0"
+					"ねいろ\0"
+					"ねぐせ\0"
+					"ねくたい\0"
+					"ねくら\0"
+					"ねこぜ\0"
+					"ねこむ\0"
+					"ねさげ\0"
+					"ねすごす\0"
+					"ねそべる\0"
+					"ねだん\0"
+					"ねつい\0"
+					"ねっしん\0"
+					"ねつぞう\0"
+					"ねったいぎょ\0"
+					"ねぶそく\0"
+					"ねふだ\0"
+					"ねぼう\0"
+					"ねほりはほり\0"
+					"ねまき\0"
+					"ねまわし\0"
+					"ねみみ\0"
+					"ねむい\0"
+					"ねむたい\0"
+					"ねもと\0"
+					"ねらう\0"
+					"ねわざ\0"
+					"ねんいり\0"
+					"ねんおし\0"
+					"ねんかん\0"
+					"ねんきん\0"
+					"ねんぐ\0"
+					"ねんざ\0"
+					"ねんし\0"
+					"ねんちゃく\0"
+					"ねんど\0"
+					"ねんぴ\0"
+					"ねんぶつ\0"
+					"ねんまつ\0"
+					"ねんりょう\0"
+					"ねんれい\0"
+					"のいず\0"
+					"のおづま\0"
+					"のがす\0"
+					"のきなみ\0"
+					"のこぎり\0"
+					"のこす\0"
+					"のこる\0"
+					"のせる\0"
+					"のぞく\0"
+					"のぞむ\0"
+					"のたまう\0"
+					"のちほど\0"
+					"のっく\0"
+					"のばす\0"
+					"のはら\0"
+					"のべる\0"
+					"のぼる\0"
+					"のみもの\0"
+					"のやま\0"
+					"のらいぬ\0"
+					"のらねこ\0"
+					"のりもの\0"
+					"のりゆき\0"
+					"のれん\0"
+					"のんき\0"
+					"ばあい\0"
+					"はあく\0"
+					"ばあさん\0"
+					"ばいか\0"
+					"ばいく\0"
+					"はいけん\0"
+					"はいご\0"
+					"はいしん\0"
+					"はいすい\0"
+					"はいせん\0"
+					"はいそう\0"
+					"はいち\0"
+					"ばいばい\0"
+					"はいれつ\0"
+					"はえる\0"
+					"はおる\0"
+					"はかい\0"
+					"ばかり\0"
+					"はかる\0"
+					"はくしゅ\0"
+					"はけん\0"
+					"はこぶ\0"
+					"はさみ\0"
+					"はさん\0"
+					"はしご\0"
+					"ばしょ\0"
+					"はしる\0"
+					"はせる\0"
+					"ぱそこん\0"
+					"はそん\0"
+					"はたん\0"
+					"はちみつ\0"
+					"はつおん\0"
+					"はっかく\0"
+					"はづき\0"
+					"はっきり\0"
+					"はっくつ\0"
+					"はっけん\0"
+					"はっこう\0"
+					"はっさん\0"
+					"はっしん\0"
+					"はったつ\0"
+					"はっちゅう\0"
+					"はってん\0"
+					"はっぴょう\0"
+					"はっぽう\0"
+					"はなす\0"
+					"はなび\0"
+					"はにかむ\0"
+					"はぶらし\0"
+					"はみがき\0"
+					"はむかう\0"
+					"はめつ\0"
+					"はやい\0"
+					"はやし\0"
+					"はらう\0"
+					"はろうぃん\0"
+					"はわい\0"
+					"はんい\0"
+					"はんえい\0"
+					"はんおん\0"
+					"はんかく\0"
+					"はんきょう\0"
+					"ばんぐみ\0"
+					"はんこ\0"
+					"はんしゃ\0"
+					"はんすう\0"
+					"はんだん\0"
+					"ぱんち\0"
+					"ぱんつ\0"
+					"はんてい\0"
+					"はんとし\0"
+					"はんのう\0"
+					"はんぱ\0"
+					"はんぶん\0"
+					"はんぺん\0"
+					"はんぼうき\0"
+					"はんめい\0"
+					"はんらん\0"
+					"はんろん\0"
+					"ひいき\0"
+					"ひうん\0"
+					"ひえる\0"
+					"ひかく\0"
+					"ひかり\0"
+					"ひかる\0"
+					"ひかん\0"
+					"ひくい\0"
+					"ひけつ\0"
+					"ひこうき\0"
+					"ひこく\0"
+					"ひさい\0"
+					"ひさしぶり\0"
+					"ひさん\0"
+					"びじゅつかん\0"
+					"ひしょ\0"
+					"ひそか\0"
+					"ひそむ\0"
+					"ひたむき\0"
+					"ひだり\0"
+					"ひたる\0"
+					"ひつぎ\0"
+					"ひっこし\0"
+					"ひっし\0"
+					"ひつじゅひん\0"
+					"ひっす\0"
+					"ひつぜん\0"
+					"ぴったり\0"
+					"ぴっちり\0"
+					"ひつよう\0"
+					"ひてい\0"
+					"ひとごみ\0"
+					"ひなまつり\0"
+					"ひなん\0"
+					"ひねる\0"
+					"ひはん\0"
+					"ひびく\0"
+					"ひひょう\0"
+					"ひほう\0"
+					"ひまわり\0"
+					"ひまん\0"
+					"ひみつ\0"
+					"ひめい\0"
+					"ひめじし\0"
+					"ひやけ\0"
+					"ひやす\0"
+					"ひよう\0"
+					"びょうき\0"
+					"ひらがな\0"
+					"ひらく\0"
+					"ひりつ\0"
+					"ひりょう\0"
+					"ひるま\0"
+					"ひるやすみ\0"
+					"ひれい\0"
+					"ひろい\0"
+					"ひろう\0"
+					"ひろき\0"
+					"ひろゆき\0"
+					"ひんかく\0"
+					"ひんけつ\0"
+					"ひんこん\0"
+					"ひんしゅ\0"
+					"ひんそう\0"
+					"ぴんち\0"
+					"ひんぱん\0"
+					"びんぼう\0"
+					"ふあん\0"
+					"ふいうち\0"
+					"ふうけい\0"
+					"ふうせん\0"
+					"ぷうたろう\0"
+					"ふうとう\0"
+					"ふうふ\0"
+					"ふえる\0"
+					"ふおん\0"
+					"ふかい\0"
+					"ふきん\0"
+					"ふくざつ\0"
+					"ふくぶくろ\0"
+					"ふこう\0"
+					"ふさい\0"
+					"ふしぎ\0"
+					"ふじみ\0"
+					"ふすま\0"
+					"ふせい\0"
+					"ふせぐ\0"
+					"ふそく\0"
+					"ぶたにく\0"
+					"ふたん\0"
+					"ふちょう\0"
+					"ふつう\0"
+					"ふつか\0"
+					"ふっかつ\0"
+					"ふっき\0"
+					"ふっこく\0"
+					"ぶどう\0"
+					"ふとる\0"
+					"ふとん\0"
+					"ふのう\0"
+					"ふはい\0"
+					"ふひょう\0"
+					"ふへん\0"
+					"ふまん\0"
+					"ふみん\0"
+					"ふめつ\0"
+					"ふめん\0"
+					"ふよう\0"
+					"ふりこ\0"
+					"ふりる\0"
+					"ふるい\0"
+					"ふんいき\0"
+					"ぶんがく\0"
+					"ぶんぐ\0"
+					"ふんしつ\0"
+					"ぶんせき\0"
+					"ふんそう\0"
+					"ぶんぽう\0"
+					"へいあん\0"
+					"へいおん\0"
+					"へいがい\0"
+					"へいき\0"
+					"へいげん\0"
+					"へいこう\0"
+					"へいさ\0"
+					"へいしゃ\0"
+					"へいせつ\0"
+					"へいそ\0"
+					"へいたく\0"
+					"へいてん\0"
+					"へいねつ\0"
+					"へいわ\0"
+					"へきが\0"
+					"へこむ\0"
+					"べにいろ\0"
+					"べにしょうが\0"
+					"へらす\0"
+					"へんかん\0"
+					"べんきょう\0"
+					"べんごし\0"
+					"へんさい\0"
+					"へんたい\0"
+					"べんり\0"
+					"ほあん\0"
+					"ほいく\0"
+					"ぼうぎょ\0"
+					"ほうこく\0"
+					"ほうそう\0"
+					"ほうほう\0"
+					"ほうもん\0"
+					"ほうりつ\0"
+					"ほえる\0"
+					"ほおん\0"
+					"ほかん\0"
+					"ほきょう\0"
+					"ぼきん\0"
+					"ほくろ\0"
+					"ほけつ\0"
+					"ほけん\0"
+					"ほこう\0"
+					"ほこる\0"
+					"ほしい\0"
+					"ほしつ\0"
+					"ほしゅ\0"
+					"ほしょう\0"
+					"ほせい\0"
+					"ほそい\0"
+					"ほそく\0"
+					"ほたて\0"
+					"ほたる\0"
+					"ぽちぶくろ\0"
+					"ほっきょく\0"
+					"ほっさ\0"
+					"ほったん\0"
+					"ほとんど\0"
+					"ほめる\0"
+					"ほんい\0"
+					"ほんき\0"
+					"ほんけ\0"
+					"ほんしつ\0"
+					"ほんやく\0"
+					"まいにち\0"
+					"まかい\0"
+					"まかせる\0"
+					"まがる\0"
+					"まける\0"
+					"まこと\0"
+					"まさつ\0"
+					"まじめ\0"
+					"ますく\0"
+					"まぜる\0"
+					"まつり\0"
+					"まとめ\0"
+					"まなぶ\0"
+					"まぬけ\0"
+					"まねく\0"
+					"まほう\0"
+					"まもる\0"
+					"まゆげ\0"
+					"まよう\0"
+					"まろやか\0"
+					"まわす\0"
+					"まわり\0"
+					"まわる\0"
+					"まんが\0"
+					"まんきつ\0"
+					"まんぞく\0"
+					"まんなか\0"
+					"みいら\0"
+					"みうち\0"
+					"みえる\0"
+					"みがく\0"
+					"みかた\0"
+					"みかん\0"
+					"みけん\0"
+					"みこん\0"
+					"みじかい\0"
+					"みすい\0"
+					"みすえる\0"
+					"みせる\0"
+					"みっか\0"
+					"みつかる\0"
+					"みつける\0"
+					"みてい\0"
+					"みとめる\0"
+					"みなと\0"
+					"みなみかさい\0"
+					"みねらる\0"
+					"みのう\0"
+					"みのがす\0"
+					"みほん\0"
+					"みもと\0"
+					"みやげ\0"
+					"みらい\0"
+					"みりょく\0"
+					"みわく\0"
+					"みんか\0"
+					"みんぞく\0"
+					"むいか\0"
+					"むえき\0"
+					"むえん\0"
+					"むかい\0"
+					"むかう\0"
+					"むかえ\0"
+					"むかし\0"
+					"むぎちゃ\0"
+					"むける\0"
+					"むげん\0"
+					"むさぼる\0"
+					"むしあつい\0"
+					"むしば\0"
+					"むじゅん\0"
+					"むしろ\0"
+					"むすう\0"
+					"むすこ\0"
+					"むすぶ\0"
+					"むすめ\0"
+					"むせる\0"
+					"むせん\0"
+					"むちゅう\0"
+					"むなしい\0"
+					"むのう\0"
+					"むやみ\0"
+					"むよう\0"
+					"むらさき\0"
+					"むりょう\0"
+					"むろん\0"
+					"めいあん\0"
+					"めいうん\0"
+					"めいえん\0"
+					"めいかく\0"
+					"めいきょく\0"
+					"めいさい\0"
+					"めいし\0"
+					"めいそう\0"
+					"めいぶつ\0"
+					"めいれい\0"
+					"めいわく\0"
+					"めぐまれる\0"
+					"めざす\0"
+					"めした\0"
+					"めずらしい\0"
+					"めだつ\0"
+					"めまい\0"
+					"めやす\0"
+					"めんきょ\0"
+					"めんせき\0"
+					"めんどう\0"
+					"もうしあげる\0"
+					"もうどうけん\0"
+					"もえる\0"
+					"もくし\0"
+					"もくてき\0"
+					"もくようび\0"
+					"もちろん\0"
+					"もどる\0"
+					"もらう\0"
+					"もんく\0"
+					"もんだい\0"
+					"やおや\0"
+					"やける\0"
+					"やさい\0"
+					"やさしい\0"
+					"やすい\0"
+					"やすたろう\0"
+					"やすみ\0"
+					"やせる\0"
+					"やそう\0"
+					"やたい\0"
+					"やちん\0"
+					"やっと\0"
+					"やっぱり\0"
+					"やぶる\0"
+					"やめる\0"
+					"ややこしい\0"
+					"やよい\0"
+					"やわらかい\0"
+					"ゆうき\0"
+					"ゆうびんきょく\0"
+					"ゆうべ\0"
+					"ゆうめい\0"
+					"ゆけつ\0"
+					"ゆしゅつ\0"
+					"ゆせん\0"
+					"ゆそう\0"
+					"ゆたか\0"
+					"ゆちゃく\0"
+					"ゆでる\0"
+					"ゆにゅう\0"
+					"ゆびわ\0"
+					"ゆらい\0"
+					"ゆれる\0"
+					"ようい\0"
+					"ようか\0"
+					"ようきゅう\0"
+					"ようじ\0"
+					"ようす\0"
+					"ようちえん\0"
+					"よかぜ\0"
+					"よかん\0"
+					"よきん\0"
+					"よくせい\0"
+					"よくぼう\0"
+					"よけい\0"
+					"よごれる\0"
+					"よさん\0"
+					"よしゅう\0"
+					"よそう\0"
+					"よそく\0"
+					"よっか\0"
+					"よてい\0"
+					"よどがわく\0"
+					"よねつ\0"
+					"よやく\0"
+					"よゆう\0"
+					"よろこぶ\0"
+					"よろしい\0"
+					"らいう\0"
+					"らくがき\0"
+					"らくご\0"
+					"らくさつ\0"
+					"らくだ\0"
+					"らしんばん\0"
+					"らせん\0"
+					"らぞく\0"
+					"らたい\0"
+					"らっか\0"
+					"られつ\0"
+					"りえき\0"
+					"りかい\0"
+					"りきさく\0"
+					"りきせつ\0"
+					"りくぐん\0"
+					"りくつ\0"
+					"りけん\0"
+					"りこう\0"
+					"りせい\0"
+					"りそう\0"
+					"りそく\0"
+					"りてん\0"
+					"りねん\0"
+					"りゆう\0"
+					"りゅうがく\0"
+					"りよう\0"
+					"りょうり\0"
+					"りょかん\0"
+					"りょくちゃ\0"
+					"りょこう\0"
+					"りりく\0"
+					"りれき\0"
+					"りろん\0"
+					"りんご\0"
+					"るいけい\0"
+					"るいさい\0"
+					"るいじ\0"
+					"るいせき\0"
+					"るすばん\0"
+					"るりがわら\0"
+					"れいかん\0"
+					"れいぎ\0"
+					"れいせい\0"
+					"れいぞうこ\0"
+					"れいとう\0"
+					"れいぼう\0"
+					"れきし\0"
+					"れきだい\0"
+					"れんあい\0"
+					"れんけい\0"
+					"れんこん\0"
+					"れんさい\0"
+					"れんしゅう\0"
+					"れんぞく\0"
+					"れんらく\0"
+					"ろうか\0"
+					"ろうご\0"
+					"ろうじん\0"
+					"ろうそく\0"
+					"ろくが\0"
+					"ろこつ\0"
+					"ろじうら\0"
+					"ろしゅつ\0"
+					"ろせん\0"
+					"ろてん\0"
+					"ろめん\0"
+					"ろれつ\0"
+					"ろんぎ\0"
+					"ろんぱ\0"
+					"ろんぶん\0"
+					"ろんり\0"
+					"わかす\0"
+					"わかめ\0"
+					"わかやま\0"
+					"わかれる\0"
+					"わしつ\0"
+					"わじまし\0"
+					"わすれもの\0"
+					"わらう\0"
+					"われる\0";
+
+			constexpr uint16_t BIP39OffsetsJapanese[BIP39_WORDLIST_COUNT] = {
+					0, 19, 32, 45, 61, 77, 87, 103, 113, 132, 142, 152,
+					165, 181, 197, 210, 223, 236, 252, 268, 278, 288, 301, 317,
+					330, 343, 353, 369, 379, 392, 405, 418, 428, 441, 457, 467,
+					480, 493, 506, 516, 535, 545, 561, 577, 590, 603, 622, 635,
+					648, 658, 674, 684, 700, 713, 726, 739, 755, 765, 778, 791,
+					804, 817, 830, 840, 853, 869, 885, 895, 905, 915, 925, 941,
+					951, 961, 977, 993, 1009, 1022, 1035, 1045, 1061, 1074, 1084, 1097,
+					1113, 1132, 1145, 1158, 1174, 1184, 1197, 1210, 1223, 1236, 1249, 1262,
+					1278, 1288, 1304, 1317, 1330, 1343, 1353, 1366, 1382, 1395, 1405, 1418,
+					1428, 1438, 1448, 1461, 1471, 1481, 1491, 1504, 1514, 1527, 1537, 1547,
+					1557, 1567, 1577, 1590, 1603, 1613, 1629, 1639, 1652, 1662, 1672, 1685,
+					1701, 1714, 1724, 1737, 1747, 1769, 1779, 1789, 1802, 1815, 1828, 1850,
+					1863, 1879, 1892, 1902, 1912, 1925, 1938, 1951, 1967, 1977, 1993, 2006,
+					2025, 2038, 2051, 2064, 2074, 2090, 2103, 2113, 2126, 2139, 2158, 2168,
+					2181, 2200, 2213, 2223, 2239, 2255, 2265, 2278, 2291, 2307, 2323, 2333,
+					2346, 2359, 2372, 2388, 2398, 2408, 2418, 2434, 2453, 2466, 2476, 2486,
+					2499, 2509, 2528, 2544, 2557, 2573, 2586, 2599, 2612, 2625, 2635, 2645,
+					2655, 2665, 2678, 2691, 2704, 2720, 2733, 2746, 2762, 2775, 2788, 2804,
+					2817, 2827, 2837, 2850, 2863, 2876, 2889, 2902, 2912, 2925, 2938, 2954,
+					2964, 2974, 2987, 2997, 3007, 3020, 3030, 3043, 3056, 3069, 3085, 3101,
+					3117, 3130, 3146, 3159, 3175, 3188, 3201, 3214, 3227, 3240, 3253, 3266,
+					3279, 3292, 3308, 3321, 3331, 3341, 3351, 3370, 3380, 3393, 3406, 3419,
+					3432, 3445, 3461, 3471, 3484, 3503, 3522, 3532, 3545, 3555, 3568, 3578,
+					3591, 3604, 3617, 3630, 3643, 3659, 3675, 3688, 3701, 3714, 3730, 3740,
+					3756, 3769, 3779, 3789, 3805, 3821, 3837, 3850, 3869, 3885, 3898, 3917,
+					3933, 3943, 3956, 3969, 3979, 3995, 4011, 4027, 4037, 4053, 4066, 4079,
+					4092, 4108, 4124, 4143, 4153, 4166, 4179, 4195, 4211, 4224, 4237, 4256,
+					4272, 4294, 4307, 4320, 4333, 4346, 4362, 4375, 4388, 4404, 4414, 4424,
+					4434, 4447, 4460, 4473, 4486, 4499, 4512, 4525, 4541, 4551, 4561, 4577,
+					4596, 4612, 4628, 4647, 4666, 4676, 4689, 4702, 4712, 4725, 4735, 4751,
+					4767, 4777, 4793, 4803, 4813, 4823, 4833, 4843, 4856, 4869, 4882, 4895,
+					4908, 4921, 4931, 4950, 4960, 4970, 4980, 4993, 5003, 5013, 5023, 5033,
+					5043, 5053, 5063, 5073, 5083, 5099, 5109, 5125, 5141, 5157, 5167, 5180,
+					5190, 5200, 5210, 5220, 5236, 5261, 5274, 5299, 5324, 5349, 5359, 5369,
+					5379, 5389, 5399, 5412, 5425, 5438, 5451, 5464, 5480, 5493, 5503, 5513,
+					5526, 5539, 5549, 5562, 5572, 5588, 5598, 5608, 5621, 5631, 5647, 5657,
+					5667, 5680, 5693, 5703, 5713, 5723, 5745, 5755, 5774, 5784, 5794, 5804,
+					5814, 5833, 5843, 5862, 5872, 5882, 5892, 5902, 5912, 5922, 5935, 5948,
+					5964, 5983, 5999, 6018, 6031, 6044, 6057, 6067, 6083, 6096, 6112, 6125,
+					6141, 6154, 6167, 6177, 6190, 6203, 6216, 6226, 6236, 6252, 6262, 6275,
+					6288, 6301, 6320, 6333, 6343, 6362, 6378, 6397, 6410, 6423, 6436, 6452,
+					6468, 6484, 6497, 6507, 6520, 6530, 6540, 6556, 6572, 6582, 6598, 6608,
+					6624, 6634, 6644, 6654, 6667, 6683, 6702, 6718, 6731, 6741, 6754, 6767,
+					6777, 6790, 6812, 6825, 6850, 6863, 6873, 6886, 6902, 6915, 6934, 6953,
+					6969, 6985, 6998, 7014, 7027, 7052, 7068, 7078, 7094, 7104, 7120, 7133,
+					7146, 7159, 7178, 7191, 7204, 7214, 7227, 7240, 7256, 7269, 7282, 7295,
+					7317, 7333, 7346, 7362, 7378, 7388, 7401, 7411, 7421, 7431, 7444, 7454,
+					7464, 7477, 7493, 7509, 7519, 7532, 7542, 7552, 7562, 7572, 7585, 7598,
+					7608, 7621, 7631, 7641, 7654, 7670, 7683, 7696, 7712, 7725, 7741, 7754,
+					7767, 7780, 7793, 7806, 7825, 7835, 7848, 7861, 7874, 7884, 7897, 7907,
+					7923, 7936, 7949, 7962, 7975, 7994, 8010, 8023, 8036, 8049, 8062, 8078,
+					8091, 8104, 8117, 8130, 8143, 8159, 8172, 8185, 8201, 8217, 8230, 8243,
+					8253, 8263, 8276, 8292, 8305, 8318, 8331, 8344, 8357, 8370, 8383, 8393,
+					8403, 8416, 8426, 8436, 8446, 8456, 8466, 8476, 8489, 8505, 8515, 8528,
+					8538, 8551, 8561, 8574, 8590, 8603, 8613, 8623, 8639, 8649, 8662, 8672,
+					8688, 8701, 8714, 8724, 8734, 8747, 8763, 8773, 8783, 8799, 8821, 8834,
+					8850, 8863, 8873, 8889, 8902, 8912, 8922, 8932, 8942, 8952, 8962, 8975,
+					8985, 8995, 9005, 9024, 9037, 9050, 9063, 9076, 9089, 9099, 9115, 9128,
+					9144, 9157, 9170, 9186, 9202, 9215, 9225, 9238, 9251, 9267, 9280, 9293,
+					9312, 9325, 9338, 9351, 9367, 9386, 9399, 9418, 9428, 9441, 9454, 9464,
+					9477, 9490, 9506, 9516, 9529, 9539, 9549, 9559, 9575, 9588, 9598, 9611,
+					9627, 9640, 9659, 9675, 9688, 9704, 9720, 9736, 9752, 9762, 9775, 9785,
+					9798, 9808, 9818, 9828, 9841, 9857, 9870, 9880, 9893, 9903, 9916, 9932,
+					9942, 9952, 9974, 9984, 9994, 10004, 10017, 10036, 10049, 10059, 10072, 10082,
+					10098, 10111, 10124, 10140, 10153, 10166, 10176, 10186, 10196, 10206, 10219, 10229,
+					10242, 10258, 10271, 10281, 10291, 10301, 10311, 10321, 10331, 10341, 10354, 10367,
+					10377, 10393, 10406, 10419, 10429, 10439, 10452, 10465, 10478, 10491, 10504, 10514,
+					10524, 10534, 10547, 10563, 10579, 10592, 10602, 10612, 10622, 10635, 10648, 10658,
+					10674, 10684, 10697, 10707, 10720, 10730, 10746, 10756, 10766, 10776, 10786, 10796,
+					10806, 10819, 10835, 10845, 10855, 10865, 10878, 10891, 10904, 10926, 10942, 10958,
+					10971, 10981, 10997, 11010, 11023, 11036, 11049, 11065, 11081, 11094, 11107, 11120,
+					11133, 11152, 11168, 11184, 11200, 11210, 11226, 11248, 11264, 11280, 11296, 11312,
+					11325, 11338, 11354, 11364, 11377, 11396, 11415, 11428, 11441, 11454, 11464, 11474,
+					11487, 11500, 11510, 11523, 11542, 11561, 11577, 11593, 11606, 11622, 11632, 11642,
+					11655, 11665, 11678, 11688, 11701, 11717, 11727, 11740, 11753, 11769, 11782, 11792,
+					11802, 11812, 11822, 11835, 11854, 11870, 11889, 11902, 11912, 11925, 11938, 11951,
+					11964, 11974, 11984, 11994, 12004, 12017, 12027, 12046, 12059, 12069, 12085, 12101,
+					12117, 12130, 12146, 12159, 12172, 12182, 12198, 12211, 12221, 12231, 12250, 12260,
+					12270, 12283, 12293, 12303, 12316, 12332, 12345, 12358, 12371, 12390, 12406, 12422,
+					12438, 12454, 12467, 12483, 12496, 12509, 12519, 12532, 12545, 12558, 12571, 12581,
+					12591, 12601, 12614, 12624, 12640, 12650, 12663, 12673, 12686, 12696, 12712, 12728,
+					12741, 12754, 12767, 12780, 12793, 12806, 12822, 12835, 12848, 12861, 12874, 12890,
+					12906, 12925, 12935, 12957, 12970, 12983, 12996, 13009, 13022, 13041, 13054, 13064,
+					13074, 13093, 13103, 13128, 13138, 13151, 13164, 13180, 13193, 13206, 13219, 13229,
+					13242, 13252, 13265, 13278, 13288, 13301, 13314, 13324, 13334, 13344, 13357, 13373,
+					13383, 13396, 13409, 13428, 13441, 13454, 13467, 13477, 13493, 13509, 13522, 13532,
+					13545, 13558, 13571, 13581, 13591, 13601, 13614, 13624, 13637, 13653, 13666, 13676,
+					13689, 13702, 13718, 13731, 13747, 13763, 13779, 13798, 13811, 13821, 13834, 13847,
+					13860, 13873, 13892, 13902, 13918, 13931, 13941, 13957, 13985, 14001, 14014, 14027,
+					14043, 14059, 14072, 14094, 14107, 14120, 14133, 14146, 14165, 14178, 14191, 14201,
+					14223, 14242, 14252, 14265, 14278, 14291, 14301, 14317, 14327, 14340, 14350, 14360,
+					14370, 14380, 14393, 14403, 14413, 14426, 14439, 14449, 14462, 14472, 14488, 14507,
+					14520, 14539, 14555, 14568, 14578, 14594, 14604, 14620, 14636, 14655, 14668, 14687,
+					14703, 14713, 14726, 14742, 14752, 14762, 14775, 14785, 14798, 14811, 14824, 14837,
+					14847, 14860, 14873, 14883, 14893, 14903, 14916, 14926, 14936, 14961, 14974, 14984,
+					14994, 15004, 15017, 15030, 15046, 15062, 15072, 15085, 15095, 15105, 15118, 15131,
+					15144, 15169, 15185, 15198, 15211, 15224, 15237, 15250, 15263, 15276, 15292, 15305,
+					15321, 15340, 15353, 15366, 15382, 15395, 15408, 15418, 15428, 15438, 15451, 15461,
+					15471, 15481, 15494, 15504, 15520, 15530, 15540, 15550, 15560, 15576, 15586, 15596,
+					15606, 15616, 15629, 15645, 15655, 15665, 15675, 15685, 15695, 15708, 15724, 15734,
+					15744, 15754, 15770, 15786, 15808, 15821, 15837, 15850, 15869, 15879, 15889, 15905,
+					15918, 15931, 15941, 15954, 15967, 15977, 15990, 16000, 16019, 16032, 16042, 16052,
+					16065, 16075, 16085, 16095, 16105, 16118, 16131, 16144, 16157, 16167, 16180, 16196,
+					16206, 16222, 16232, 16245, 16261, 16271, 16281, 16294, 16304, 16314, 16324, 16337,
+					16350, 16363, 16373, 16383, 16393, 16403, 16416, 16426, 16436, 16449, 16462, 16475,
+					16485, 16498, 16511, 16524, 16537, 16553, 16566, 16582, 16592, 16605, 16618, 16631,
+					16650, 16669, 16682, 16692, 16702, 16718, 16731, 16747, 16763, 16779, 16795, 16805,
+					16821, 16831, 16847, 16860, 16870, 16886, 16899, 16915, 16925, 16935, 16954, 16970,
+					16986, 16996, 17009, 17019, 17032, 17048, 17061, 17074, 17084, 17097, 17110, 17126,
+					17139, 17149, 17162, 17175, 17188, 17201, 17214, 17230, 17255, 17268, 17287, 17306,
+					17319, 17332, 17342, 17358, 17374, 17390, 17400, 17416, 17426, 17436, 17446, 17456,
+					17466, 17476, 17486, 17499, 17515, 17525, 17541, 17554, 17564, 17580, 17590, 17600,
+					17610, 17620, 17636, 17646, 17656, 17669, 17685, 17698, 17714, 17730, 17746, 17762,
+					17772, 17785, 17795, 17808, 17821, 17843, 17853, 17863, 17873, 17889, 17899, 17918,
+					17931, 17944, 17963, 17976, 17989, 18002, 18012, 18025, 18038, 18048, 18061, 18071,
+					18084, 18100, 18110, 18129, 18142, 18158, 18171, 18187, 18200, 18210, 18220, 18233,
+					18246, 18256, 18266, 18279, 18292, 18302, 18312, 18322, 18335, 18348, 18358, 18374,
+					18390, 18400, 18416, 18426, 18436, 18446, 18459, 18472, 18485, 18498, 18511, 18533,
+					18543, 18556, 18575, 18594, 18604, 18614, 18627, 18640, 18653, 18669, 18682, 18695,
+					18708, 18718, 18728, 18738, 18748, 18758, 18774, 18790, 18803, 18813, 18823, 18833,
+					18849, 18862, 18878, 18891, 18904, 18914, 18927, 18940, 18953, 18966, 18976, 18989,
+					19002, 19018, 19028, 19047, 19060, 19073, 19083, 19099, 19109, 19119, 19135, 19148,
+					19158, 19168, 19178, 19191, 19204, 19214, 19227, 19237, 19250, 19266, 19282, 19295,
+					19305, 19318, 19334, 19356, 19372, 19385, 19398, 19417, 19427, 19440, 19450, 19460,
+					19473, 19483, 19493, 19506, 19519, 19532, 19545, 19558, 19571, 19584, 19594, 19610,
+					19623, 19636, 19652, 19665, 19681, 19694, 19707, 19723, 19736, 19749, 19765, 19775,
+					19785, 19795, 19808, 19821, 19834, 19850, 19860, 19873, 19883, 19896, 19909, 19922,
+					19932, 19945, 19958, 19971, 19984, 19994, 20004, 20017, 20027, 20043, 20056, 20069,
+					20082, 20095, 20108, 20121, 20134, 20147, 20157, 20176, 20189, 20199, 20209, 20219,
+					20232, 20242, 20255, 20265, 20278, 20288, 20298, 20311, 20324, 20334, 20344, 20360,
+					20370, 20380, 20393, 20406, 20419, 20432, 20445, 20458, 20471, 20484, 20497, 20510,
+					20523, 20539, 20552, 20571, 20587, 20597, 20610, 20623, 20639, 20655, 20668, 20678,
+					20688, 20698, 20708, 20724, 20734, 20744, 20757, 20770, 20783, 20799, 20818, 20828,
+					20841, 20854, 20870, 20883, 20896, 20909, 20922, 20935, 20948, 20964, 20980, 20999,
+					21012, 21025, 21038, 21048, 21058, 21068, 21078, 21088, 21098, 21108, 21118, 21128,
+					21141, 21151, 21161, 21180, 21190, 21215, 21225, 21235, 21245, 21258, 21271, 21281,
+					21294, 21307, 21317, 21339, 21349, 21365, 21381, 21397, 21410, 21420, 21436, 21452,
+					21462, 21472, 21482, 21495, 21508, 21518, 21531, 21541, 21551, 21561, 21577, 21587,
+					21597, 21607, 21623, 21639, 21649, 21659, 21672, 21682, 21698, 21708, 21718, 21728,
+					21738, 21751, 21764, 21777, 21790, 21803, 21816, 21829, 21845, 21864, 21874, 21887,
+					21900, 21913, 21932, 21945, 21955, 21965, 21975, 21985, 21995, 22011, 22030, 22040,
+					22050, 22063, 22076, 22086, 22096, 22109, 22119, 22135, 22145, 22158, 22168, 22178,
+					22191, 22201, 22214, 22230, 22240, 22250, 22260, 22270, 22283, 22293, 22303, 22313,
+					22323, 22333, 22343, 22353, 22363, 22373, 22386, 22405, 22421, 22434, 22450, 22463,
+					22482, 22495, 22508, 22524, 22534, 22550, 22563, 22573, 22586, 22599, 22609, 22622,
+					22635, 22648, 22658, 22671, 22681, 22697, 22722, 22732, 22745, 22764, 22783, 22796,
+					22809, 22822, 22832, 22842, 22861, 22874, 22887, 22900, 22913, 22926, 22936, 22946,
+					22956, 22969, 22982, 22992, 23002, 23012, 23022, 23032, 23042, 23052, 23062, 23075,
+					23085, 23095, 23105, 23115, 23125, 23147, 23163, 23173, 23186, 23202, 23212, 23222,
+					23232, 23242, 23255, 23268, 23281, 23291, 23304, 23317, 23327, 23337, 23347, 23360,
+					23370, 23383, 23393, 23403, 23416, 23426, 23436, 23446, 23456, 23469, 23479, 23492,
+					23502, 23512, 23522, 23535, 23548, 23564, 23577, 23587, 23597, 23607, 23620, 23630,
+					23640, 23650, 23660, 23676, 23686, 23699, 23709, 23719, 23732, 23745, 23755, 23768,
+					23778, 23797, 23810, 23820, 23836, 23846, 23856, 23869, 23879, 23892, 23902, 23912,
+					23928, 23938, 23948, 23958, 23968, 23978, 23988, 23998, 24014, 24024, 24037, 24053,
+					24069, 24082, 24098, 24108, 24118, 24128, 24141, 24151, 24161, 24171, 24184, 24197,
+					24207, 24217, 24227, 24240, 24253, 24263, 24276, 24289, 24302, 24315, 24331, 24344,
+					24354, 24367, 24383, 24396, 24409, 24428, 24441, 24451, 24470, 24483, 24493, 24503,
+					24516, 24529, 24545, 24567, 24589, 24599, 24609, 24622, 24641, 24654, 24667, 24677,
+					24687, 24703, 24713, 24723, 24733, 24746, 24756, 24772, 24782, 24792, 24802, 24812,
+					24822, 24832, 24848, 24861, 24871, 24887, 24897, 24913, 24923, 24948, 24961, 24974,
+					24984, 24997, 25007, 25017, 25027, 25040, 25053, 25066, 25079, 25089, 25099, 25109,
+					25119, 25135, 25148, 25158, 25174, 25187, 25197, 25207, 25220, 25236, 25246, 25262,
+					25272, 25285, 25295, 25305, 25315, 25325, 25347, 25357, 25367, 25377, 25393, 25406,
+					25416, 25432, 25445, 25458, 25471, 25490, 25500, 25513, 25523, 25533, 25543, 25553,
+					25563, 25576, 25589, 25605, 25615, 25625, 25635, 25645, 25655, 25665, 25675, 25685,
+					25695, 25714, 25724, 25737, 25750, 25766, 25779, 25789, 25799, 25809, 25822, 25835,
+					25848, 25861, 25874, 25890, 25909, 25922, 25935, 25948, 25967, 25980, 25996, 26006,
+					26022, 26035, 26048, 26061, 26074, 26090, 26106, 26119, 26129, 26142, 26158, 26171,
+					26184, 26194, 26210, 26223, 26233, 26243, 26253, 26263, 26276, 26289, 26305, 26315,
+					26325, 26335, 26348, 26361, 26371, 26387, 26403, 26413,
+			};
+
+			constexpr char BIP39PoolSpanish[] =
+					"ábaco\0"
+					"abdomen\0"
+					"abeja\0"
+					"abierto\0"
+					"abogado\0"
+					"abono\0"
+					"aborto\0"
+					"abrazo\0"
+					"abrir\0"
+					"abuelo\0"
+					"abuso\0"
+					"acabar\0"
+					"academia\0"
+					"acceso\0"
+					"acción\0"
+					"aceite\0"
+					"acelga\0"
+					"acento\0"
+					"aceptar\0"
+					"ácido\0"
+					"aclarar\0"
+					"acné\0"
+					"acoger\0"
+					"acoso\0"
+					"activo\0"
+					"acto\0"
+					"actriz\0"
+					"actuar\0"
+					"acudir\0"
+					"acuerdo\0"
+					"acusar\0"
+					"adicto\0"
+					"admitir\0"
+					"adoptar\0"
+					"adorno\0"
+					"aduana\0"
+					"adulto\0"
+					"aéreo\0"
+					"afectar\0"
+					"afición\0"
+					"afinar\0"
+					"afirmar\0"
+					"ágil\0"
+					"agitar\0"
+					"agonía\0"
+					"agosto\0"
+					"agotar\0"
+					"agregar\0"
+					"agrio\0"
+					"agua\0"
+					"agudo\0"
+					"águila\0"
+					"aguja\0"
+					"ahogo\0"
+					"ahorro\0"
+					"aire\0"
+					"aislar\0"
+					"ajedrez\0"
+					"ajeno\0"
+					"ajuste\0"
+					"alacrán\0"
+					"alambre\0"
+					"alarma\0"
+					"alba\0"
+					"álbum\0"
+					"alcalde\0"
+					"aldea\0"
+					"alegre\0"
+					"alejar\0"
+					"alerta\0"
+					"aleta\0"
+					"alfiler\0"
+					"alga\0"
+					"algodón\0"
+					"aliado\0"
+					"aliento\0"
+					"alivio\0"
+					"alma\0"
+					"almeja\0"
+					"almíbar\0"
+					"altar\0"
+					"alteza\0"
+					"altivo\0"
+					"alto\0"
+					"altura\0"
+					"alumno\0"
+					"alzar\0"
+					"amable\0"
+					"amante\0"
+					"amapola\0"
+					"amargo\0"
+					"amasar\0"
+					"ámbar\0"
+					"ámbito\0"
+					"ameno\0"
+					"amigo\0"
+					"amistad\0"
+					"amor\0"
+					"amparo\0"
+					"amplio\0"
+					"ancho\0"
+					"anciano\0"
+					"ancla\0"
+					"andar\0"
+					"andén\0"
+					"anemia\0"
+					"ángulo\0"
+					"anillo\0"
+					"ánimo\0"
+					"anís\0"
+					"anotar\0"
+					"antena\0"
+					"antiguo\0"
+					"antojo\0"
+					"anual\0"
+					"anular\0"
+					"anuncio\0"
+					"añadir\0"
+					"añejo\0"
+					"año\0"
+					"apagar\0"
+					"aparato\0"
+					"apetito\0"
+					"apio\0"
+					"aplicar\0"
+					"apodo\0"
+					"aporte\0"
+					"apoyo\0"
+					"aprender\0"
+					"aprobar\0"
+					"apuesta\0"
+					"apuro\0"
+					"arado\0"
+					"araña\0"
+					"arar\0"
+					"árbitro\0"
+					"árbol\0"
+					"arbusto\0"
+					"archivo\0"
+					"arco\0"
+					"arder\0"
+					"ardilla\0"
+					"arduo\0"
+					"área\0"
+					"árido\0"
+					"aries\0"
+					"armonía\0"
+					"arnés\0"
+					"aroma\0"
+					"arpa\0"
+					"arpón\0"
+					"arreglo\0"
+					"arroz\0"
+					"arruga\0"
+					"arte\0"
+					"artista\0"
+					"asa\0"
+					"asado\0"
+					"asalto\0"
+					"ascenso\0"
+					"asegurar\0"
+					"aseo\0"
+					"asesor\0"
+					"asiento\0"
+					"asilo\0"
+					"asistir\0"
+					"asno\0"
+					"asombro\0"
+					"áspero\0"
+					"astilla\0"
+					"astro\0"
+					"astuto\0"
+					"asumir\0"
+					"asunto\0"
+					"atajo\0"
+					"ataque\0"
+					"atar\0"
+					"atento\0"
+					"ateo\0"
+					"ático\0"
+					"atleta\0"
+					"átomo\0"
+					"atraer\0"
+					"atroz\0"
+					"atún\0"
+					"audaz\0"
+					"audio\0"
+					"auge\0"
+					"aula\0"
+					"aumento\0"
+					"ausente\0"
+					"autor\0"
+					"aval\0"
+					"avance\0"
+					"avaro\0"
+					"ave\0"
+					"avellana\0"
+					"avena\0"
+					"avestruz\0"
+					"avión\0"
+					"aviso\0"
+					"ayer\0"
+					"ayuda\0"
+					"ayuno\0"
+					"azafrán\0"
+					"azar\0"
+					"azote\0"
+					"azúcar\0"
+					"azufre\0"
+					"azul\0"
+					"baba\0"
+					"babor\0"
+					"bache\0"
+					"bahía\0"
+					"baile\0"
+					"bajar\0"
+					"balanza\0"
+					"balcón\0"
+					"balde\0"
+					"bambú\0"
+					"banco\0"
+					"banda\0"
+					"baño\0"
+					"barba\0"
+					"barco\0"
+					"barniz\0"
+					"barro\0"
+					"báscula\0"
+					"bastón\0"
+					"basura\0"
+					"batalla\0"
+					"batería\0"
+					"batir\0"
+					"batuta\0"
+					"baúl\0"
+					"bazar\0"
+					"bebé\0"
+					"bebida\0"
+					"bello\0"
+					"besar\0"
+					"beso\0"
+					"bestia\0"
+					"bicho\0"
+					"bien\0"
+					"bingo\0"
+					"blanco\0"
+					"bloque\0"
+					"blusa\0"
+					"boa\0"
+					"bobina\0"
+					"bobo\0"
+					"boca\0"
+					"bocina\0"
+					"boda\0"
+					"bodega\0"
+					"boina\0"
+					"bola\0"
+					"bolero\0"
+					"bolsa\0"
+					"bomba\0"
+					"bondad\0"
+					"bonito\0"
+					"bono\0"
+					"bonsái\0"
+					"borde\0"
+					"borrar\0"
+					"bosque\0"
+					"bote\0"
+					"botín\0"
+					"bóveda\0"
+					"bozal\0"
+					"bravo\0"
+					"brazo\0"
+					"brecha\0"
+					"breve\0"
+					"brillo\0"
+					"brinco\0"
+					"brisa\0"
+					"broca\0"
+					"broma\0"
+					"bronce\0"
+					"brote\0"
+					"bruja\0"
+					"brusco\0"
+					"bruto\0"
+					"buceo\0"
+					"bucle\0"
+					"bueno\0"
+					"buey\0"
+					"bufanda\0"
+					"bufón\0"
+					"búho\0"
+					"buitre\0"
+					"bulto\0"
+					"burbuja\0"
+					"burla\0"
+					"burro\0"
+					"buscar\0"
+					"butaca\0"
+					"buzón\0"
+					"caballo\0"
+					"cabeza\0"
+					"cabina\0"
+					"cabra\0"
+					"cacao\0"
+					"cadáver\0"
+					"cadena\0"
+					"caer\0"
+					"café\0"
+					"caída\0"
+					"caimán\0"
+					"caja\0"
+					"cajón\0"
+					"cal\0"
+					"calamar\0"
+					"calcio\0"
+					"caldo\0"
+					"calidad\0"
+					"calle\0"
+					"calma\0"
+					"calor\0"
+					"calvo\0"
+					"cama\0"
+					"cambio\0"
+					"camello\0"
+					"camino\0"
+					"campo\0"
+					"cáncer\0"
+					"candil\0"
+					"canela\0"
+					"canguro\0"
+					"canica\0"
+					"canto\0"
+					"caña\0"
+					"cañón\0"
+					"caoba\0"
+					"caos\0"
+					"capaz\0"
+					"capitán\0"
+					"capote\0"
+					"captar\0"
+					"capucha\0"
+					"cara\0"
+					"carbón\0"
+					"cárcel\0"
+					"careta\0"
+					"carga\0"
+					"cariño\0"
+					"carne\0"
+					"carpeta\0"
+					"carro\0"
+					"carta\0"
+					"casa\0"
+					"casco\0"
+					"casero\0"
+					"caspa\0"
+					"castor\0"
+					"catorce\0"
+					"catre\0"
+					"caudal\0"
+					"causa\0"
+					"cazo\0"
+					"cebolla\0"
+					"ceder\0"
+					"cedro\0"
+					"celda\0"
+					"célebre\0"
+					"celoso\0"
+					"célula\0"
+					"cemento\0"
+					"ceniza\0"
+					"centro\0"
+					"cerca\0"
+					"cerdo\0"
+					"cereza\0"
+					"cero\0"
+					"cerrar\0"
+					"certeza\0"
+					"césped\0"
+					"cetro\0"
+					"chacal\0"
+					"chaleco\0"
+					"champú\0"
+					"chancla\0"
+					"chapa\0"
+					"charla\0"
+					"chico\0"
+					"chiste\0"
+					"chivo\0"
+					"choque\0"
+					"choza\0"
+					"chuleta\0"
+					"chupar\0"
+					"ciclón\0"
+					"ciego\0"
+					"cielo\0"
+					"cien\0"
+					"cierto\0"
+					"cifra\0"
+					"cigarro\0"
+					"cima\0"
+					"cinco\0"
+					"cine\0"
+					"cinta\0"
+					"ciprés\0"
+					"circo\0"
+					"ciruela\0"
+					"cisne\0"
+					"cita\0"
+					"ciudad\0"
+					"clamor\0"
+					"clan\0"
+					"claro\0"
+					"clase\0"
+					"clave\0"
+					"cliente\0"
+					"clima\0"
+					"clínica\0"
+					"cobre\0"
+					"cocción\0"
+					"cochino\0"
+					"cocina\0"
+					"coco\0"
+					"código\0"
+					"codo\0"
+					"cofre\0"
+					"coger\0"
+					"cohete\0"
+					"cojín\0"
+					"cojo\0"
+					"cola\0"
+					"colcha\0"
+					"colegio\0"
+					"colgar\0"
+					"colina\0"
+					"collar\0"
+					"colmo\0"
+					"columna\0"
+					"combate\0"
+					"comer\0"
+					"comida\0"
+					"cómodo\0"
+					"compra\0"
+					"conde\0"
+					"conejo\0"
+					"conga\0"
+					"conocer\0"
+					"consejo\0"
+					"contar\0"
+					"copa\0"
+					"copia\0"
+					"corazón\0"
+					"corbata\0"
+					"corcho\0"
+					"cordón\0"
+					"corona\0"
+					"correr\0"
+					"coser\0"
+					"cosmos\0"
+					"costa\0"
+					"cráneo\0"
+					"cráter\0"
+					"crear\0"
+					"crecer\0"
+					"creído\0"
+					"crema\0"
+					"cría\0"
+					"crimen\0"
+					"cripta\0"
+					"crisis\0"
+					"cromo\0"
+					"crónica\0"
+					"croqueta\0"
+					"crudo\0"
+					"cruz\0"
+					"cuadro\0"
+					"cuarto\0"
+					"cuatro\0"
+					"cubo\0"
+					"cubrir\0"
+					"cuchara\0"
+					"cuello\0"
+					"cuento\0"
+					"cuerda\0"
+					"cuesta\0"
+					"cueva\0"
+					"cuidar\0"
+					"culebra\0"
+					"culpa\0"
+					"culto\0"
+					"cumbre\0"
+					"cumplir\0"
+					"cuna\0"
+					"cuneta\0"
+					"cuota\0"
+					"cupón\0"
+					"cúpula\0"
+					"curar\0"
+					"curioso\0"
+					"curso\0"
+					"curva\0"
+					"cutis\0"
+					"dama\0"
+					"danza\0"
+					"dar\0"
+					"dardo\0"
+					"dátil\0"
+					"deber\0"
+					"débil\0"
+					"década\0"
+					"decir\0"
+					"dedo\0"
+					"defensa\0"
+					"definir\0"
+					"dejar\0"
+					"delfín\0"
+					"delgado\0"
+					"delito\0"
+					"demora\0"
+					"denso\0"
+					"dental\0"
+					"deporte\0"
+					"derecho\0"
+					"derrota\0"
+					"desayuno\0"
+					"deseo\0"
+					"desfile\0"
+					"desnudo\0"
+					"destino\0"
+					"desvío\0"
+					"detalle\0"
+					"detener\0"
+					"deuda\0"
+					"día\0"
+					"diablo\0"
+					"diadema\0"
+					"diamante\0"
+					"diana\0"
+					"diario\0"
+					"dibujo\0"
+					"dictar\0"
+					"diente\0"
+					"dieta\0"
+					"diez\0"
+					"difícil\0"
+					"digno\0"
+					"dilema\0"
+					"diluir\0"
+					"dinero\0"
+					"directo\0"
+					"dirigir\0"
+					"disco\0"
+					"diseño\0"
+					"disfraz\0"
+					"diva\0"
+					"divino\0"
+					"doble\0"
+					"doce\0"
+					"dolor\0"
+					"domingo\0"
+					"don\0"
+					"donar\0"
+					"dorado\0"
+					"dormir\0"
+					"dorso\0"
+					"dos\0"
+					"dosis\0"
+					"dragón\0"
+					"droga\0"
+					"ducha\0"
+					"duda\0"
+					"duelo\0"
+					"dueño\0"
+					"dulce\0"
+					"dúo\0"
+					"duque\0"
+					"durar\0"
+					"dureza\0"
+					"duro\0"
+					"ébano\0"
+					"ebrio\0"
+					"echar\0"
+					"eco\0"
+					"ecuador\0"
+					"edad\0"
+					"edición\0"
+					"edificio\0"
+					"editor\0"
+					"educar\0"
+					"efecto\0"
+					"eficaz\0"
+					"eje\0"
+					"ejemplo\0"
+					"elefante\0"
+					"elegir\0"
+					"elemento\0"
+					"elevar\0"
+					"elipse\0"
+					"élite\0"
+					"elixir\0"
+					"elogio\0"
+					"eludir\0"
+					"embudo\0"
+					"emitir\0"
+					"emoción\0"
+					"empate\0"
+					"empeño\0"
+					"empleo\0"
+					"empresa\0"
+					"enano\0"
+					"encargo\0"
+					"enchufe\0"
+					"encía\0"
+					"enemigo\0"
+					"enero\0"
+					"enfado\0"
+					"enfermo\0"
+					"engaño\0"
+					"enigma\0"
+					"enlace\0"
+					"enorme\0"
+					"enredo\0"
+					"ensayo\0"
+					"enseñar\0"
+					"entero\0"
+					"entrar\0"
+					"envase\0"
+					"envío\0"
+					"época\0"
+					"equipo\0"
+					"erizo\0"
+					"escala\0"
+					"escena\0"
+					"escolar\0"
+					"escribir\0"
+					"escudo\0"
+					"esencia\0"
+					"esfera\0"
+					"esfuerzo\0"
+					"espada\0"
+					"espejo\0"
+					"espía\0"
+					"esposa\0"
+					"espuma\0"
+					"esquí\0"
+					"estar\0"
+					"este\0"
+					"estilo\0"
+					"estufa\0"
+					"etapa\0"
+					"eterno\0"
+					"ética\0"
+					"etnia\0"
+					"evadir\0"
+					"evaluar\0"
+					"evento\0"
+					"evitar\0"
+					"exacto\0"
+					"examen\0"
+					"exceso\0"
+					"excusa\0"
+					"exento\0"
+					"exigir\0"
+					"exilio\0"
+					"existir\0"
+					"éxito\0"
+					"experto\0"
+					"explicar\0"
+					"exponer\0"
+					"extremo\0"
+					"fábrica\0"
+					"fábula\0"
+					"fachada\0"
+					"fácil\0"
+					"factor\0"
+					"faena\0"
+					"faja\0"
+					"falda\0"
+					"fallo\0"
+					"falso\0"
+					"faltar\0"
+					"fama\0"
+					"familia\0"
+					"famoso\0"
+					"faraón\0"
+					"farmacia\0"
+					"farol\0"
+					"farsa\0"
+					"fase\0"
+					"fatiga\0"
+					"fauna\0"
+					"favor\0"
+					"fax\0"
+					"febrero\0"
+					"fecha\0"
+					"feliz\0"
+					"feo\0"
+					"feria\0"
+					"feroz\0"
+					"fértil\0"
+					"fervor\0"
+					"festín\0"
+					"fiable\0"
+					"fianza\0"
+					"fiar\0"
+					"fibra\0"
+					"ficción\0"
+					"ficha\0"
+					"fideo\0"
+					"fiebre\0"
+					"fiel\0"
+					"fiera\0"
+					"fiesta\0"
+					"figura\0"
+					"fijar\0"
+					"fijo\0"
+					"fila\0"
+					"filete\0"
+					"filial\0"
+					"filtro\0"
+					"fin\0"
+					"finca\0"
+					"fingir\0"
+					"finito\0"
+					"firma\0"
+					"flaco\0"
+					"flauta\0"
+					"flecha\0"
+					"flor\0"
+					"flota\0"
+					"fluir\0"
+					"flujo\0"
+					"flúor\0"
+					"fobia\0"
+					"foca\0"
+					"fogata\0"
+					"fogón\0"
+					"folio\0"
+					"folleto\0"
+					"fondo\0"
+					"forma\0"
+					"forro\0"
+					"fortuna\0"
+					"forzar\0"
+					"fosa\0"
+					"foto\0"
+					"fracaso\0"
+					"frágil\0"
+					"franja\0"
+					"frase\0"
+					"fraude\0"
+					"freír\0"
+					"freno\0"
+					"fresa\0"
+					"frío\0"
+					"frito\0"
+					"fruta\0"
+					"fuego\0"
+					"fuente\0"
+					"fuerza\0"
+					"fuga\0"
+					"fumar\0"
+					"función\0"
+					"funda\0"
+					"furgón\0"
+					"furia\0"
+					"fusil\0"
+					"fútbol\0"
+					"futuro\0"
+					"gacela\0"
+					"gafas\0"
+					"gaita\0"
+					"gajo\0"
+					"gala\0"
+					"galería\0"
+					"gallo\0"
+					"gamba\0"
+					"ganar\0"
+					"gancho\0"
+					"ganga\0"
+					"ganso\0"
+					"garaje\0"
+					"garza\0"
+					"gasolina\0"
+					"gastar\0"
+					"gato\0"
+					"gavilán\0"
+					"gemelo\0"
+					"gemir\0"
+					"gen\0"
+					"género\0"
+					"genio\0"
+					"gente\0"
+					"geranio\0"
+					"gerente\0"
+					"germen\0"
+					"gesto\0"
+					"gigante\0"
+					"gimnasio\0"
+					"girar\0"
+					"giro\0"
+					"glaciar\0"
+					"globo\0"
+					"gloria\0"
+					"gol\0"
+					"golfo\0"
+					"goloso\0"
+					"golpe\0"
+					"goma\0"
+					"gordo\0"
+					"gorila\0"
+					"gorra\0"
+					"gota\0"
+					"goteo\0"
+					"gozar\0"
+					"grada\0"
+					"gráfico\0"
+					"grano\0"
+					"grasa\0"
+					"gratis\0"
+					"grave\0"
+					"grieta\0"
+					"grillo\0"
+					"gripe\0"
+					"gris\0"
+					"grito\0"
+					"grosor\0"
+					"grúa\0"
+					"grueso\0"
+					"grumo\0"
+					"grupo\0"
+					"guante\0"
+					"guapo\0"
+					"guardia\0"
+					"guerra\0"
+					"guía\0"
+					"guiño\0"
+					"guion\0"
+					"guiso\0"
+					"guitarra\0"
+					"gusano\0"
+					"gustar\0"
+					"haber\0"
+					"hábil\0"
+					"hablar\0"
+					"hacer\0"
+					"hacha\0"
+					"hada\0"
+					"hallar\0"
+					"hamaca\0"
+					"harina\0"
+					"haz\0"
+					"hazaña\0"
+					"hebilla\0"
+					"hebra\0"
+					"hecho\0"
+					"helado\0"
+					"helio\0"
+					"hembra\0"
+					"herir\0"
+					"hermano\0"
+					"héroe\0"
+					"hervir\0"
+					"hielo\0"
+					"hierro\0"
+					"hígado\0"
+					"higiene\0"
+					"hijo\0"
+					"himno\0"
+					"historia\0"
+					"hocico\0"
+					"hogar\0"
+					"hoguera\0"
+					"hoja\0"
+					"hombre\0"
+					"hongo\0"
+					"honor\0"
+					"honra\0"
+					"hora\0"
+					"hormiga\0"
+					"horno\0"
+					"hostil\0"
+					"hoyo\0"
+					"hueco\0"
+					"huelga\0"
+					"huerta\0"
+					"hueso\0"
+					"huevo\0"
+					"huida\0"
+					"huir\0"
+					"humano\0"
+					"húmedo\0"
+					"humilde\0"
+					"humo\0"
+					"hundir\0"
+					"huracán\0"
+					"hurto\0"
+					"icono\0"
+					"ideal\0"
+					"idioma\0"
+					"ídolo\0"
+					"iglesia\0"
+					"iglú\0"
+					"igual\0"
+					"ilegal\0"
+					"ilusión\0"
+					"imagen\0"
+					"imán\0"
+					"imitar\0"
+					"impar\0"
+					"imperio\0"
+					"imponer\0"
+					"impulso\0"
+					"incapaz\0"
+					"índice\0"
+					"inerte\0"
+					"infiel\0"
+					"informe\0"
+					"ingenio\0"
+					"inicio\0"
+					"inmenso\0"
+					"inmune\0"
+					"innato\0"
+					"insecto\0"
+					"instante\0"
+					"interés\0"
+					"íntimo\0"
+					"intuir\0"
+					"inútil\0"
+					"invierno\0"
+					"ira\0"
+					"iris\0"
+					"ironía\0"
+					"isla\0"
+					"islote\0"
+					"jabalí\0"
+					"jabón\0"
+					"jamón\0"
+					"jarabe\0"
+					"jardín\0"
+					"jarra\0"
+					"jaula\0"
+					"jazmín\0"
+					"jefe\0"
+					"jeringa\0"
+					"jinete\0"
+					"jornada\0"
+					"joroba\0"
+					"joven\0"
+					"joya\0"
+					"juerga\0"
+					"jueves\0"
+					"juez\0"
+					"jugador\0"
+					"jugo\0"
+					"juguete\0"
+					"juicio\0"
+					"junco\0"
+					"jungla\0"
+					"junio\0"
+					"juntar\0"
+					"júpiter\0"
+					"jurar\0"
+					"justo\0"
+					"juvenil\0"
+					"juzgar\0"
+					"kilo\0"
+					"koala\0"
+					"labio\0"
+					"lacio\0"
+					"lacra\0"
+					"lado\0"
+					"ladrón\0"
+					"lagarto\0"
+					"lágrima\0"
+					"laguna\0"
+					"laico\0"
+					"lamer\0"
+					"lámina\0"
+					"lámpara\0"
+					"lana\0"
+					"lancha\0"
+					"langosta\0"
+					"lanza\0"
+					"lápiz\0"
+					"largo\0"
+					"larva\0"
+					"lástima\0"
+					"lata\0"
+					"látex\0"
+					"latir\0"
+					"laurel\0"
+					"lavar\0"
+					"lazo\0"
+					"leal\0"
+					"lección\0"
+					"leche\0"
+					"lector\0"
+					"leer\0"
+					"legión\0"
+					"legumbre\0"
+					"lejano\0"
+					"lengua\0"
+					"lento\0"
+					"leña\0"
+					"león\0"
+					"leopardo\0"
+					"lesión\0"
+					"letal\0"
+					"letra\0"
+					"leve\0"
+					"leyenda\0"
+					"libertad\0"
+					"libro\0"
+					"licor\0"
+					"líder\0"
+					"lidiar\0"
+					"lienzo\0"
+					"liga\0"
+					"ligero\0"
+					"lima\0"
+					"límite\0"
+					"limón\0"
+					"limpio\0"
+					"lince\0"
+					"lindo\0"
+					"línea\0"
+					"lingote\0"
+					"lino\0"
+					"linterna\0"
+					"líquido\0"
+					"liso\0"
+					"lista\0"
+					"litera\0"
+					"litio\0"
+					"litro\0"
+					"llaga\0"
+					"llama\0"
+					"llanto\0"
+					"llave\0"
+					"llegar\0"
+					"llenar\0"
+					"llevar\0"
+					"llorar\0"
+					"llover\0"
+					"lluvia\0"
+					"lobo\0"
+					"loción\0"
+					"loco\0"
+					"locura\0"
+					"lógica\0"
+					"logro\0"
+					"lombriz\0"
+					"lomo\0"
+					"lonja\0"
+					"lote\0"
+					"lucha\0"
+					"lucir\0"
+					"lugar\0"
+					"lujo\0"
+					"luna\0"
+					"lunes\0"
+					"lupa\0"
+					"lustro\0"
+					"luto\0"
+					"luz\0"
+					"maceta\0"
+					"macho\0"
+					"madera\0"
+					"madre\0"
+					"maduro\0"
+					"maestro\0"
+					"mafia\0"
+					"magia\0"
+					"mago\0"
+					"maíz\0"
+					"maldad\0"
+					"maleta\0"
+					"malla\0"
+					"malo\0"
+					"mamá\0"
+					"mambo\0"
+					"mamut\0"
+					"manco\0"
+					"mando\0"
+					"manejar\0"
+					"manga\0"
+					"maniquí\0"
+					"manjar\0"
+					"mano\0"
+					"manso\0"
+					"manta\0"
+					"mañana\0"
+					"mapa\0"
+					"máquina\0"
+					"mar\0"
+					"marco\0"
+					"marea\0"
+					"marfil\0"
+					"margen\0"
+					"marido\0"
+					"mármol\0"
+					"marrón\0"
+					"martes\0"
+					"marzo\0"
+					"masa\0"
+					"máscara\0"
+					"masivo\0"
+					"matar\0"
+					"materia\0"
+					"matiz\0"
+					"matriz\0"
+					"máximo\0"
+					"mayor\0"
+					"mazorca\0"
+					"mecha\0"
+					"medalla\0"
+					"medio\0"
+					"médula\0"
+					"mejilla\0"
+					"mejor\0"
+					"melena\0"
+					"melón\0"
+					"memoria\0"
+					"menor\0"
+					"mensaje\0"
+					"mente\0"
+					"menú\0"
+					"mercado\0"
+					"merengue\0"
+					"mérito\0"
+					"mes\0"
+					"mesón\0"
+					"meta\0"
+					"meter\0"
+					"método\0"
+					"metro\0"
+					"mezcla\0"
+					"miedo\0"
+					"miel\0"
+					"miembro\0"
+					"miga\0"
+					"mil\0"
+					"milagro\0"
+					"militar\0"
+					"millón\0"
+					"mimo\0"
+					"mina\0"
+					"minero\0"
+					"mínimo\0"
+					"minuto\0"
+					"miope\0"
+					"mirar\0"
+					"misa\0"
+					"miseria\0"
+					"misil\0"
+					"mismo\0"
+					"mitad\0"
+					"mito\0"
+					"mochila\0"
+					"moción\0"
+					"moda\0"
+					"modelo\0"
+					"moho\0"
+					"mojar\0"
+					"molde\0"
+					"moler\0"
+					"molino\0"
+					"momento\0"
+					"momia\0"
+					"monarca\0"
+					"moneda\0"
+					"monja\0"
+					"monto\0"
+					"moño\0"
+					"morada\0"
+					"morder\0"
+					"moreno\0"
+					"morir\0"
+					"morro\0"
+					"morsa\0"
+					"mortal\0"
+					"mosca\0"
+					"mostrar\0"
+					"motivo\0"
+					"mover\0"
+					"móvil\0"
+					"mozo\0"
+					"mucho\0"
+					"mudar\0"
+					"mueble\0"
+					"muela\0"
+					"muerte\0"
+					"muestra\0"
+					"mugre\0"
+					"mujer\0"
+					"mula\0"
+					"muleta\0"
+					"multa\0"
+					"mundo\0"
+					"muñeca\0"
+					"mural\0"
+					"muro\0"
+					"músculo\0"
+					"museo\0"
+					"musgo\0"
+					"música\0"
+					"muslo\0"
+					"nácar\0"
+					"nación\0"
+					"nadar\0"
+					"naipe\0"
+					"naranja\0"
+					"nariz\0"
+					"narrar\0"
+					"nasal\0"
+					"natal\0"
+					"nativo\0"
+					"natural\0"
+					"náusea\0"
+					"naval\0"
+					"nave\0"
+					"navidad\0"
+					"necio\0"
+					"néctar\0"
+					"negar\0"
+					"negocio\0"
+					"negro\0"
+					"neón\0"
+					"nervio\0"
+					"neto\0"
+					"neutro\0"
+					"nevar\0"
+					"nevera\0"
+					"nicho\0"
+					"nido\0"
+					"niebla\0"
+					"nieto\0"
+					"niñez\0"
+					"niño\0"
+					"nítido\0"
+					"nivel\0"
+					"nobleza\0"
+					"noche\0"
+					"nómina\0"
+					"noria\0"
+					"norma\0"
+					"norte\0"
+					"nota\0"
+					"noticia\0"
+					"novato\0"
+					"novela\0"
+					"novio\0"
+					"nube\0"
+					"nuca\0"
+					"núcleo\0"
+					"nudillo\0"
+					"nudo\0"
+					"nuera\0"
+					"nueve\0"
+					"nuez\0"
+					"nulo\0"
+					"número\0"
+					"nutria\0"
+					"oasis\0"
+					"obeso\0"
+					"obispo\0"
+					"objeto\0"
+					"obra\0"
+					"obrero\0"
+					"observar\0"
+					"obtener\0"
+					"obvio\0"
+					"oca\0"
+					"ocaso\0"
+					"océano\0"
+					"ochenta\0"
+					"ocho\0"
+					"ocio\0"
+					"ocre\0"
+					"octavo\0"
+					"octubre\0"
+					"oculto\0"
+					"ocupar\0"
+					"ocurrir\0"
+					"odiar\0"
+					"odio\0"
+					"odisea\0"
+					"oeste\0"
+					"ofensa\0"
+					"oferta\0"
+					"oficio\0"
+					"ofrecer\0"
+					"ogro\0"
+					"oído\0"
+					"oír\0"
+					"ojo\0"
+					"ola\0"
+					"oleada\0"
+					"olfato\0"
+					"olivo\0"
+					"olla\0"
+					"olmo\0"
+					"olor\0"
+					"olvido\0"
+					"ombligo\0"
+					"onda\0"
+					"onza\0"
+					"opaco\0"
+					"opción\0"
+					"ópera\0"
+					"opinar\0"
+					"oponer\0"
+					"optar\0"
+					"óptica\0"
+					"opuesto\0"
+					"oración\0"
+					"orador\0"
+					"oral\0"
+					"órbita\0"
+					"orca\0"
+					"orden\0"
+					"oreja\0"
+					"órgano\0"
+					"orgía\0"
+					"orgullo\0"
+					"oriente\0"
+					"origen\0"
+					"orilla\0"
+					"oro\0"
+					"orquesta\0"
+					"oruga\0"
+					"osadía\0"
+					"oscuro\0"
+					"osezno\0"
+					"oso\0"
+					"ostra\0"
+					"otoño\0"
+					"otro\0"
+					"oveja\0"
+					"óvulo\0"
+					"óxido\0"
+					"oxígeno\0"
+					"oyente\0"
+					"ozono\0"
+					"pacto\0"
+					"padre\0"
+					"paella\0"
+					"página\0"
+					"pago\0"
+					"país\0"
+					"pájaro\0"
+					"palabra\0"
+					"palco\0"
+					"paleta\0"
+					"pálido\0"
+					"palma\0"
+					"paloma\0"
+					"palpar\0"
+					"pan\0"
+					"panal\0"
+					"pánico\0"
+					"pantera\0"
+					"pañuelo\0"
+					"papá\0"
+					"papel\0"
+					"papilla\0"
+					"paquete\0"
+					"parar\0"
+					"parcela\0"
+					"pared\0"
+					"parir\0"
+					"paro\0"
+					"párpado\0"
+					"parque\0"
+					"párrafo\0"
+					"parte\0"
+					"pasar\0"
+					"paseo\0"
+					"pasión\0"
+					"paso\0"
+					"pasta\0"
+					"pata\0"
+					"patio\0"
+					"patria\0"
+					"pausa\0"
+					"pauta\0"
+					"pavo\0"
+					"payaso\0"
+					"peatón\0"
+					"pecado\0"
+					"pecera\0"
+					"pecho\0"
+					"pedal\0"
+					"pedir\0"
+					"pegar\0"
+					"peine\0"
+					"pelar\0"
+					"peldaño\0"
+					"pelea\0"
+					"peligro\0"
+					"pellejo\0"
+					"pelo\0"
+					"peluca\0"
+					"pena\0"
+					"pensar\0"
+					"peñón\0"
+					"peón\0"
+					"peor\0"
+					"pepino\0"
+					"pequeño\0"
+					"pera\0"
+					"percha\0"
+					"perder\0"
+					"pereza\0"
+					"perfil\0"
+					"perico\0"
+					"perla\0"
+					"permiso\0"
+					"perro\0"
+					"persona\0"
+					"pesa\0"
+					"pesca\0"
+					"pésimo\0"
+					"pestaña\0"
+					"pétalo\0"
+					"petróleo\0"
+					"pez\0"
+					"pezuña\0"
+					"picar\0"
+					"pichón\0"
+					"pie\0"
+					"piedra\0"
+					"pierna\0"
+					"pieza\0"
+					"pijama\0"
+					"pilar\0"
+					"piloto\0"
+					"pimienta\0"
+					"pino\0"
+					"pintor\0"
+					"pinza\0"
+					"piña\0"
+					"piojo\0"
+					"pipa\0"
+					"pirata\0"
+					"pisar\0"
+					"piscina\0"
+					"piso\0"
+					"pista\0"
+					"pitón\0"
+					"pizca\0"
+					"placa\0"
+					"plan\0"
+					"plata\0"
+					"playa\0"
+					"plaza\0"
+					"pleito\0"
+					"pleno\0"
+					"plomo\0"
+					"pluma\0"
+					"plural\0"
+					"pobre\0"
+					"poco\0"
+					"poder\0"
+					"podio\0"
+					"poema\0"
+					"poesía\0"
+					"poeta\0"
+					"polen\0"
+					"policía\0"
+					"pollo\0"
+					"polvo\0"
+					"pomada\0"
+					"pomelo\0"
+					"pomo\0"
+					"pompa\0"
+					"poner\0"
+					"porción\0"
+					"portal\0"
+					"posada\0"
+					"poseer\0"
+					"posible\0"
+					"poste\0"
+					"potencia\0"
+					"potro\0"
+					"pozo\0"
+					"prado\0"
+					"precoz\0"
+					"pregunta\0"
+					"premio\0"
+					"prensa\0"
+					"preso\0"
+					"previo\0"
+					"primo\0"
+					"príncipe\0"
+					"prisión\0"
+					"privar\0"
+					"proa\0"
+					"probar\0"
+					"proceso\0"
+					"producto\0"
+					"proeza\0"
+					"profesor\0"
+					"programa\0"
+					"prole\0"
+					"promesa\0"
+					"pronto\0"
+					"propio\0"
+					"próximo\0"
+					"prueba\0"
+					"público\0"
+					"puchero\0"
+					"pudor\0"
+					"pueblo\0"
+					"puerta\0"
+					"puesto\0"
+					"pulga\0"
+					"pulir\0"
+					"pulmón\0"
+					"pulpo\0"
+					"pulso\0"
+					"puma\0"
+					"punto\0"
+					"puñal\0"
+					"puño\0"
+					"pupa\0"
+					"pupila\0"
+					"puré\0"
+					"quedar\0"
+					"queja\0"
+					"quemar\0"
+					"querer\0"
+					"queso\0"
+					"quieto\0"
+					"química\0"
+					"quince\0"
+					"quitar\0"
+					"rábano\0"
+					"rabia\0"
+					"rabo\0"
+					"ración\0"
+					"radical\0"
+					"raíz\0"
+					"rama\0"
+					"rampa\0"
+					"rancho\0"
+					"rango\0"
+					"rapaz\0"
+					"rápido\0"
+					"rapto\0"
+					"rasgo\0"
+					"raspa\0"
+					"rato\0"
+					"rayo\0"
+					"raza\0"
+					"razón\0"
+					"reacción\0"
+					"realidad\0"
+					"rebaño\0"
+					"rebote\0"
+					"recaer\0"
+					"receta\0"
+					"rechazo\0"
+					"recoger\0"
+					"recreo\0"
+					"recto\0"
+					"recurso\0"
+					"red\0"
+					"redondo\0"
+					"reducir\0"
+					"reflejo\0"
+					"reforma\0"
+					"refrán\0"
+					"refugio\0"
+					"regalo\0"
+					"regir\0"
+					"regla\0"
+					"regreso\0"
+					"rehén\0"
+					"reino\0"
+					"reír\0"
+					"reja\0"
+					"relato\0"
+					"relevo\0"
+					"relieve\0"
+					"relleno\0"
+					"reloj\0"
+					"remar\0"
+					"remedio\0"
+					"remo\0"
+					"rencor\0"
+					"rendir\0"
+					"renta\0"
+					"reparto\0"
+					"repetir\0"
+					"reposo\0"
+					"reptil\0"
+					"res\0"
+					"rescate\0"
+					"resina\0"
+					"respeto\0"
+					"resto\0"
+					"resumen\0"
+					"retiro\0"
+					"retorno\0"
+					"retrato\0"
+					"reunir\0"
+					"revés\0"
+					"revista\0"
+					"rey\0"
+					"rezar\0"
+					"rico\0"
+					"riego\0"
+					"rienda\0"
+					"riesgo\0"
+					"rifa\0"
+					"rígido\0"
+					"rigor\0"
+					"rincón\0"
+					"riñón\0"
+					"río\0"
+					"riqueza\0"
+					"risa\0"
+					"ritmo\0"
+					"rito\0"
+					"rizo\0"
+					"roble\0"
+					"roce\0"
+					"rociar\0"
+					"rodar\0"
+					"rodeo\0"
+					"rodilla\0"
+					"roer\0"
+					"rojizo\0"
+					"rojo\0"
+					"romero\0"
+					"romper\0"
+					"ron\0"
+					"ronco\0"
+					"ronda\0"
+					"ropa\0"
+					"ropero\0"
+					"rosa\0"
+					"rosca\0"
+					"rostro\0"
+					"rotar\0"
+					"rubí\0"
+					"rubor\0"
+					"rudo\0"
+					"rueda\0"
+					"rugir\0"
+					"ruido\0"
+					"ruina\0"
+					"ruleta\0"
+					"rulo\0"
+					"rumbo\0"
+					"rumor\0"
+					"ruptura\0"
+					"ruta\0"
+					"rutina\0"
+					"sábado\0"
+					"saber\0"
+					"sabio\0"
+					"sable\0"
+					"sacar\0"
+					"sagaz\0"
+					"sagrado\0"
+					"sala\0"
+					"saldo\0"
+					"salero\0"
+					"salir\0"
+					"salmón\0"
+					"salón\0"
+					"salsa\0"
+					"salto\0"
+					"salud\0"
+					"salvar\0"
+					"samba\0"
+					"sanción\0"
+					"sandía\0"
+					"sanear\0"
+					"sangre\0"
+					"sanidad\0"
+					"sano\0"
+					"santo\0"
+					"sapo\0"
+					"saque\0"
+					"sardina\0"
+					"sartén\0"
+					"sastre\0"
+					"satán\0"
+					"sauna\0"
+					"saxofón\0"
+					"sección\0"
+					"seco\0"
+					"secreto\0"
+					"secta\0"
+					"sed\0"
+					"seguir\0"
+					"seis\0"
+					"sello\0"
+					"selva\0"
+					"semana\0"
+					"semilla\0"
+					"senda\0"
+					"sensor\0"
+					"señal\0"
+					"señor\0"
+					"separar\0"
+					"sepia\0"
+					"sequía\0"
+					"ser\0"
+					"serie\0"
+					"sermón\0"
+					"servir\0"
+					"sesenta\0"
+					"sesión\0"
+					"seta\0"
+					"setenta\0"
+					"severo\0"
+					"sexo\0"
+					"sexto\0"
+					"sidra\0"
+					"siesta\0"
+					"siete\0"
+					"siglo\0"
+					"signo\0"
+					"sílaba\0"
+					"silbar\0"
+					"silencio\0"
+					"silla\0"
+					"símbolo\0"
+					"simio\0"
+					"sirena\0"
+					"sistema\0"
+					"sitio\0"
+					"situar\0"
+					"sobre\0"
+					"socio\0"
+					"sodio\0"
+					"sol\0"
+					"solapa\0"
+					"soldado\0"
+					"soledad\0"
+					"sólido\0"
+					"soltar\0"
+					"solución\0"
+					"sombra\0"
+					"sondeo\0"
+					"sonido\0"
+					"sonoro\0"
+					"sonrisa\0"
+					"sopa\0"
+					"soplar\0"
+					"soporte\0"
+					"sordo\0"
+					"sorpresa\0"
+					"sorteo\0"
+					"sostén\0"
+					"sótano\0"
+					"suave\0"
+					"subir\0"
+					"suceso\0"
+					"sudor\0"
+					"suegra\0"
+					"suelo\0"
+					"sueño\0"
+					"suerte\0"
+					"sufrir\0"
+					"sujeto\0"
+					"sultán\0"
+					"sumar\0"
+					"superar\0"
+					"suplir\0"
+					"suponer\0"
+					"supremo\0"
+					"sur\0"
+					"surco\0"
+					"sureño\0"
+					"surgir\0"
+					"susto\0"
+					"sutil\0"
+					"tabaco\0"
+					"tabique\0"
+					"tabla\0"
+					"tabú\0"
+					"taco\0"
+					"tacto\0"
+					"tajo\0"
+					"talar\0"
+					"talco\0"
+					"talento\0"
+					"talla\0"
+					"talón\0"
+					"tamaño\0"
+					"tambor\0"
+					"tango\0"
+					"tanque\0"
+					"tapa\0"
+					"tapete\0"
+					"tapia\0"
+					"tapón\0"
+					"taquilla\0"
+					"tarde\0"
+					"tarea\0"
+					"tarifa\0"
+					"tarjeta\0"
+					"tarot\0"
+					"tarro\0"
+					"tarta\0"
+					"tatuaje\0"
+					"tauro\0"
+					"taza\0"
+					"tazón\0"
+					"teatro\0"
+					"techo\0"
+					"tecla\0"
+					"técnica\0"
+					"tejado\0"
+					"tejer\0"
+					"tejido\0"
+					"tela\0"
+					"teléfono\0"
+					"tema\0"
+					"temor\0"
+					"templo\0"
+					"tenaz\0"
+					"tender\0"
+					"tener\0"
+					"tenis\0"
+					"tenso\0"
+					"teoría\0"
+					"terapia\0"
+					"terco\0"
+					"término\0"
+					"ternura\0"
+					"terror\0"
+					"tesis\0"
+					"tesoro\0"
+					"testigo\0"
+					"tetera\0"
+					"texto\0"
+					"tez\0"
+					"tibio\0"
+					"tiburón\0"
+					"tiempo\0"
+					"tienda\0"
+					"tierra\0"
+					"tieso\0"
+					"tigre\0"
+					"tijera\0"
+					"tilde\0"
+					"timbre\0"
+					"tímido\0"
+					"timo\0"
+					"tinta\0"
+					"tío\0"
+					"típico\0"
+					"tipo\0"
+					"tira\0"
+					"tirón\0"
+					"titán\0"
+					"títere\0"
+					"título\0"
+					"tiza\0"
+					"toalla\0"
+					"tobillo\0"
+					"tocar\0"
+					"tocino\0"
+					"todo\0"
+					"toga\0"
+					"toldo\0"
+					"tomar\0"
+					"tono\0"
+					"tonto\0"
+					"topar\0"
+					"tope\0"
+					"toque\0"
+					"tórax\0"
+					"torero\0"
+					"tormenta\0"
+					"torneo\0"
+					"toro\0"
+					"torpedo\0"
+					"torre\0"
+					"torso\0"
+					"tortuga\0"
+					"tos\0"
+					"tosco\0"
+					"toser\0"
+					"tóxico\0"
+					"trabajo\0"
+					"tractor\0"
+					"traer\0"
+					"tráfico\0"
+					"trago\0"
+					"traje\0"
+					"tramo\0"
+					"trance\0"
+					"trato\0"
+					"trauma\0"
+					"trazar\0"
+					"trébol\0"
+					"tregua\0"
+					"treinta\0"
+					"tren\0"
+					"trepar\0"
+					"tres\0"
+					"tribu\0"
+					"trigo\0"
+					"tripa\0"
+					"triste\0"
+					"triunfo\0"
+					"trofeo\0"
+					"trompa\0"
+					"tronco\0"
+					"tropa\0"
+					"trote\0"
+					"trozo\0"
+					"truco\0"
+					"trueno\0"
+					"trufa\0"
+					"tubería\0"
+					"tubo\0"
+					"tuerto\0"
+					"tumba\0"
+					"tumor\0"
+					"túnel\0"
+					"túnica\0"
+					"turbina\0"
+					"turismo\0"
+					"turno\0"
+					"tutor\0"
+					"ubicar\0"
+					"úlcera\0"
+					"umbral\0"
+					"unidad\0"
+					"unir\0"
+					"universo\0"
+					"uno\0"
+					"untar\0"
+					"uña\0"
+					"urbano\0"
+					"urbe\0"
+					"urgente\0"
+					"urna\0"
+					"usar\0"
+					"usuario\0"
+					"útil\0"
+					"utopía\0"
+					"uva\0"
+					"vaca\0"
+					"vacío\0"
+					"vacuna\0"
+					"vagar\0"
+					"vago\0"
+					"vaina\0"
+					"vajilla\0"
+					"vale\0"
+					"válido\0"
+					"valle\0"
+					"valor\0"
+					"válvula\0"
+					"vampiro\0"
+					"vara\0"
+					"variar\0"
+					"varón\0"
+					"vaso\0"
+					"vecino\0"
+					"vector\0"
+					"vehículo\0"
+					"veinte\0"
+					"vejez\0"
+					"vela\0"
+					"velero\0"
+					"veloz\0"
+					"vena\0"
+					"vencer\0"
+					"venda\0"
+					"veneno\0"
+					"vengar\0"
+					"venir\0"
+					"venta\0"
+					"venus\0"
+					"ver\0"
+					"verano\0"
+					"verbo\0"
+					"verde\0"
+					"vereda\0"
+					"verja\0"
+					"verso\0"
+					"verter\0"
+					"vía\0"
+					"viaje\0"
+					"vibrar\0"
+					"vicio\0"
+					"víctima\0"
+					"vida\0"
+					"vídeo\0"
+					"vidrio\0"
+					"viejo\0"
+					"viernes\0"
+					"vigor\0"
+					"vil\0"
+					"villa\0"
+					"vinagre\0"
+					"vino\0"
+					"viñedo\0"
+					"violín\0"
+					"viral\0"
+					"virgo\0"
+					"virtud\0"
+					"visor\0"
+					"víspera\0"
+					"vista\0"
+					"vitamina\0"
+					"viudo\0"
+					"vivaz\0"
+					"vivero\0"
+					"vivir\0"
+					"vivo\0"
+					"volcán\0"
+					"volumen\0"
+					"volver\0"
+					"voraz\0"
+					"votar\0"
+					"voto\0"
+					"voz\0"
+					"vuelo\0"
+					"vulgar\0"
+					"yacer\0"
+					"yate\0"
+					"yegua\0"
+					"yema\0"
+					"yerno\0"
+					"yeso\0"
+					"yodo\0"
+					"yoga\0"
+					"yogur\0"
+					"zafiro\0"
+					"zanja\0"
+					"zapato\0"
+					"zarza\0"
+					"zona\0"
+					"zorro\0"
+					"zumo\0"
+					"zurdo\0";
+
+			constexpr uint16_t BIP39OffsetsSpanish[BIP39_WORDLIST_COUNT] = {
+					0, 8, 16, 22, 30, 38, 44, 51, 58, 64, 71, 77,
+					84, 93, 100, 109, 116, 123, 130, 138, 146, 154, 161, 168,
+					174, 181, 186, 193, 200, 207, 215, 222, 229, 237, 245, 252,
+					259, 266, 274, 282, 292, 299, 307, 314, 321, 330, 337, 344,
+					352, 358, 363, 369, 378, 384, 390, 397, 402, 409, 417, 423,
+					430, 440, 448, 455, 460, 468, 476, 482, 489, 496, 503, 509,
+					517, 522, 532, 539, 547, 554, 559, 566, 576, 582, 589, 596,
+					601, 608, 615, 621, 628, 635, 643, 650, 657, 665, 674, 680,
+					686, 694, 699, 706, 713, 719, 727, 733, 739, 747, 754, 763,
+					770, 778, 785, 792, 799, 807, 814, 820, 827, 835, 844, 852,
+					858, 865, 873, 881, 886, 894, 900, 907, 913, 922, 930, 938,
+					944, 950, 958, 963, 973, 981, 989, 997, 1002, 1008, 1016, 1022,
+					1029, 1037, 1043, 1053, 1061, 1067, 1072, 1080, 1088, 1094, 1101, 1106,
+					1114, 1118, 1124, 1131, 1139, 1148, 1153, 1160, 1168, 1174, 1182, 1187,
+					1195, 1204, 1212, 1218, 1225, 1232, 1239, 1245, 1252, 1257, 1264, 1269,
+					1277, 1284, 1292, 1299, 1305, 1312, 1318, 1324, 1329, 1334, 1342, 1350,
+					1356, 1361, 1368, 1374, 1378, 1387, 1393, 1402, 1410, 1416, 1421, 1427,
+					1433, 1443, 1448, 1454, 1463, 1470, 1475, 1480, 1486, 1492, 1500, 1506,
+					1512, 1520, 1529, 1535, 1543, 1549, 1555, 1562, 1568, 1574, 1581, 1587,
+					1597, 1606, 1613, 1621, 1631, 1637, 1644, 1651, 1657, 1664, 1671, 1677,
+					1683, 1688, 1695, 1701, 1706, 1712, 1719, 1726, 1732, 1736, 1743, 1748,
+					1753, 1760, 1765, 1772, 1778, 1783, 1790, 1796, 1802, 1809, 1816, 1821,
+					1830, 1836, 1843, 1850, 1855, 1863, 1872, 1878, 1884, 1890, 1897, 1903,
+					1910, 1917, 1923, 1929, 1935, 1942, 1948, 1954, 1961, 1967, 1973, 1979,
+					1985, 1990, 1998, 2006, 2013, 2020, 2026, 2034, 2040, 2046, 2053, 2060,
+					2068, 2076, 2083, 2090, 2096, 2102, 2112, 2119, 2124, 2131, 2139, 2148,
+					2153, 2161, 2165, 2173, 2180, 2186, 2194, 2200, 2206, 2212, 2218, 2223,
+					2230, 2238, 2245, 2251, 2260, 2267, 2274, 2282, 2289, 2295, 2302, 2312,
+					2318, 2323, 2329, 2339, 2346, 2353, 2361, 2366, 2375, 2384, 2391, 2397,
+					2406, 2412, 2420, 2426, 2432, 2437, 2443, 2450, 2456, 2463, 2471, 2477,
+					2484, 2490, 2495, 2503, 2509, 2515, 2521, 2531, 2538, 2547, 2555, 2562,
+					2569, 2575, 2581, 2588, 2593, 2600, 2608, 2617, 2623, 2630, 2638, 2647,
+					2655, 2661, 2668, 2674, 2681, 2687, 2694, 2700, 2708, 2715, 2724, 2730,
+					2736, 2741, 2748, 2754, 2762, 2767, 2773, 2778, 2784, 2793, 2799, 2807,
+					2813, 2818, 2825, 2832, 2837, 2843, 2849, 2855, 2863, 2869, 2879, 2885,
+					2895, 2903, 2910, 2915, 2924, 2929, 2935, 2941, 2948, 2956, 2961, 2966,
+					2973, 2981, 2988, 2995, 3002, 3008, 3016, 3024, 3030, 3037, 3046, 3053,
+					3059, 3066, 3072, 3080, 3088, 3095, 3100, 3106, 3116, 3124, 3131, 3140,
+					3147, 3154, 3160, 3167, 3173, 3182, 3191, 3197, 3204, 3213, 3219, 3226,
+					3233, 3240, 3247, 3253, 3263, 3272, 3278, 3283, 3290, 3297, 3304, 3309,
+					3316, 3324, 3331, 3338, 3345, 3352, 3358, 3365, 3373, 3379, 3385, 3392,
+					3400, 3405, 3412, 3418, 3426, 3435, 3441, 3449, 3455, 3461, 3467, 3472,
+					3478, 3482, 3488, 3496, 3502, 3510, 3519, 3525, 3530, 3538, 3546, 3552,
+					3561, 3569, 3576, 3583, 3589, 3596, 3604, 3612, 3620, 3629, 3635, 3643,
+					3651, 3659, 3668, 3676, 3684, 3690, 3696, 3703, 3711, 3720, 3726, 3733,
+					3740, 3747, 3754, 3760, 3765, 3775, 3781, 3788, 3795, 3802, 3810, 3818,
+					3824, 3833, 3841, 3846, 3853, 3859, 3864, 3870, 3878, 3882, 3888, 3895,
+					3902, 3908, 3912, 3918, 3927, 3933, 3939, 3944, 3950, 3958, 3964, 3970,
+					3976, 3982, 3989, 3994, 4002, 4008, 4014, 4018, 4026, 4031, 4041, 4050,
+					4057, 4064, 4071, 4078, 4082, 4090, 4099, 4106, 4115, 4122, 4129, 4137,
+					4144, 4151, 4158, 4165, 4172, 4182, 4189, 4198, 4205, 4213, 4219, 4227,
+					4235, 4243, 4251, 4257, 4264, 4272, 4281, 4288, 4295, 4302, 4309, 4316,
+					4326, 4333, 4340, 4347, 4355, 4363, 4370, 4376, 4383, 4390, 4398, 4407,
+					4414, 4422, 4429, 4438, 4445, 4452, 4460, 4467, 4474, 4482, 4488, 4493,
+					4500, 4507, 4513, 4520, 4528, 4534, 4541, 4549, 4556, 4563, 4570, 4577,
+					4584, 4591, 4598, 4605, 4612, 4620, 4628, 4636, 4645, 4653, 4661, 4671,
+					4680, 4688, 4696, 4703, 4709, 4714, 4720, 4726, 4732, 4739, 4744, 4752,
+					4759, 4768, 4777, 4783, 4789, 4794, 4801, 4807, 4813, 4817, 4825, 4831,
+					4837, 4841, 4847, 4853, 4862, 4869, 4878, 4885, 4892, 4897, 4903, 4913,
+					4919, 4925, 4932, 4937, 4943, 4950, 4957, 4963, 4968, 4973, 4980, 4987,
+					4994, 4998, 5004, 5011, 5018, 5024, 5030, 5037, 5044, 5049, 5055, 5061,
+					5067, 5075, 5081, 5086, 5093, 5101, 5107, 5115, 5121, 5127, 5133, 5141,
+					5148, 5153, 5158, 5166, 5175, 5182, 5188, 5195, 5203, 5209, 5215, 5222,
+					5228, 5234, 5240, 5247, 5254, 5259, 5265, 5275, 5281, 5290, 5296, 5302,
+					5311, 5318, 5325, 5331, 5337, 5342, 5347, 5357, 5363, 5369, 5375, 5382,
+					5388, 5394, 5401, 5407, 5416, 5423, 5428, 5438, 5445, 5451, 5455, 5464,
+					5470, 5476, 5484, 5492, 5499, 5505, 5513, 5522, 5528, 5533, 5541, 5547,
+					5554, 5558, 5564, 5571, 5577, 5582, 5588, 5595, 5601, 5606, 5612, 5618,
+					5624, 5634, 5640, 5646, 5653, 5659, 5666, 5673, 5679, 5684, 5690, 5697,
+					5704, 5711, 5717, 5723, 5730, 5736, 5744, 5751, 5758, 5766, 5772, 5778,
+					5787, 5794, 5801, 5807, 5815, 5822, 5828, 5834, 5839, 5846, 5853, 5860,
+					5864, 5873, 5881, 5887, 5893, 5900, 5906, 5913, 5919, 5927, 5935, 5942,
+					5948, 5955, 5964, 5972, 5977, 5983, 5992, 5999, 6005, 6013, 6018, 6025,
+					6031, 6037, 6043, 6048, 6056, 6062, 6069, 6074, 6080, 6087, 6094, 6100,
+					6106, 6112, 6117, 6124, 6133, 6141, 6146, 6153, 6163, 6169, 6175, 6181,
+					6188, 6196, 6204, 6211, 6217, 6224, 6234, 6241, 6248, 6255, 6261, 6269,
+					6277, 6285, 6293, 6302, 6309, 6316, 6324, 6332, 6339, 6347, 6354, 6361,
+					6369, 6378, 6388, 6397, 6404, 6413, 6422, 6426, 6431, 6440, 6445, 6452,
+					6461, 6469, 6477, 6484, 6493, 6499, 6505, 6514, 6519, 6527, 6534, 6542,
+					6549, 6555, 6560, 6567, 6574, 6579, 6587, 6592, 6600, 6607, 6613, 6620,
+					6626, 6633, 6643, 6649, 6655, 6663, 6670, 6675, 6681, 6687, 6693, 6699,
+					6704, 6713, 6721, 6731, 6738, 6744, 6750, 6759, 6769, 6774, 6781, 6790,
+					6796, 6804, 6810, 6816, 6826, 6831, 6839, 6845, 6852, 6858, 6863, 6868,
+					6878, 6884, 6891, 6896, 6905, 6914, 6921, 6928, 6934, 6941, 6948, 6957,
+					6966, 6972, 6978, 6983, 6991, 7000, 7006, 7012, 7020, 7027, 7034, 7039,
+					7046, 7051, 7060, 7068, 7075, 7081, 7087, 7095, 7103, 7108, 7117, 7127,
+					7132, 7138, 7145, 7151, 7157, 7163, 7169, 7176, 7182, 7189, 7196, 7203,
+					7210, 7217, 7224, 7229, 7238, 7243, 7250, 7259, 7265, 7273, 7278, 7284,
+					7289, 7295, 7301, 7307, 7312, 7317, 7323, 7328, 7335, 7340, 7344, 7351,
+					7357, 7364, 7370, 7377, 7385, 7391, 7397, 7402, 7409, 7416, 7423, 7429,
+					7434, 7441, 7447, 7453, 7459, 7465, 7473, 7479, 7489, 7496, 7501, 7507,
+					7513, 7522, 7527, 7537, 7541, 7547, 7553, 7560, 7567, 7574, 7583, 7592,
+					7599, 7605, 7610, 7620, 7627, 7633, 7641, 7647, 7654, 7663, 7669, 7677,
+					7683, 7691, 7697, 7706, 7714, 7720, 7727, 7735, 7743, 7749, 7757, 7763,
+					7770, 7778, 7787, 7796, 7800, 7808, 7813, 7819, 7828, 7834, 7841, 7847,
+					7852, 7860, 7865, 7869, 7877, 7885, 7894, 7899, 7904, 7911, 7920, 7927,
+					7933, 7939, 7944, 7952, 7958, 7964, 7970, 7975, 7983, 7992, 7997, 8004,
+					8009, 8015, 8021, 8027, 8034, 8042, 8048, 8056, 8063, 8069, 8075, 8082,
+					8089, 8096, 8103, 8109, 8115, 8121, 8128, 8134, 8142, 8149, 8155, 8163,
+					8168, 8174, 8180, 8187, 8193, 8200, 8208, 8214, 8220, 8225, 8232, 8238,
+					8244, 8253, 8259, 8264, 8274, 8280, 8286, 8295, 8301, 8309, 8318, 8324,
+					8330, 8338, 8344, 8351, 8357, 8363, 8370, 8378, 8387, 8393, 8398, 8406,
+					8412, 8421, 8427, 8435, 8441, 8448, 8455, 8460, 8467, 8473, 8480, 8486,
+					8491, 8498, 8504, 8512, 8519, 8528, 8534, 8542, 8548, 8557, 8563, 8569,
+					8575, 8580, 8588, 8595, 8602, 8608, 8613, 8618, 8627, 8635, 8640, 8646,
+					8652, 8657, 8662, 8671, 8678, 8684, 8690, 8697, 8704, 8709, 8716, 8725,
+					8733, 8739, 8743, 8749, 8758, 8766, 8771, 8776, 8781, 8788, 8796, 8803,
+					8810, 8818, 8824, 8829, 8836, 8842, 8849, 8856, 8863, 8871, 8876, 8883,
+					8889, 8893, 8897, 8904, 8911, 8917, 8922, 8927, 8932, 8939, 8947, 8952,
+					8957, 8963, 8972, 8980, 8987, 8994, 9000, 9009, 9017, 9027, 9034, 9039,
+					9048, 9053, 9059, 9065, 9074, 9082, 9090, 9098, 9105, 9112, 9116, 9125,
+					9131, 9140, 9147, 9154, 9158, 9164, 9172, 9177, 9183, 9191, 9199, 9209,
+					9216, 9222, 9228, 9234, 9241, 9250, 9255, 9262, 9271, 9279, 9285, 9292,
+					9301, 9307, 9314, 9321, 9325, 9331, 9340, 9348, 9358, 9365, 9371, 9379,
+					9387, 9393, 9401, 9407, 9413, 9418, 9428, 9435, 9445, 9451, 9457, 9463,
+					9472, 9477, 9483, 9488, 9494, 9501, 9507, 9513, 9518, 9525, 9534, 9541,
+					9548, 9554, 9560, 9566, 9572, 9578, 9584, 9594, 9600, 9608, 9616, 9621,
+					9628, 9633, 9640, 9650, 9657, 9662, 9669, 9679, 9684, 9691, 9698, 9705,
+					9712, 9719, 9725, 9733, 9739, 9747, 9752, 9758, 9767, 9777, 9786, 9797,
+					9801, 9810, 9816, 9825, 9829, 9836, 9843, 9849, 9856, 9862, 9869, 9878,
+					9883, 9890, 9896, 9903, 9909, 9914, 9921, 9927, 9935, 9940, 9946, 9954,
+					9960, 9966, 9971, 9977, 9983, 9989, 9996, 10002, 10008, 10014, 10021, 10027,
+					10032, 10038, 10044, 10050, 10059, 10065, 10071, 10081, 10087, 10093, 10100, 10107,
+					10112, 10118, 10124, 10134, 10141, 10148, 10155, 10163, 10169, 10178, 10184, 10189,
+					10195, 10202, 10211, 10218, 10225, 10231, 10238, 10244, 10255, 10265, 10272, 10277,
+					10284, 10292, 10301, 10308, 10317, 10326, 10332, 10340, 10347, 10354, 10364, 10371,
+					10381, 10389, 10395, 10402, 10409, 10416, 10422, 10428, 10437, 10443, 10449, 10454,
+					10460, 10468, 10475, 10480, 10487, 10494, 10501, 10507, 10514, 10521, 10527, 10534,
+					10544, 10551, 10558, 10567, 10573, 10578, 10587, 10595, 10602, 10607, 10613, 10620,
+					10626, 10632, 10641, 10647, 10653, 10659, 10664, 10669, 10674, 10682, 10693, 10702,
+					10711, 10718, 10725, 10732, 10740, 10748, 10755, 10761, 10769, 10773, 10781, 10789,
+					10797, 10805, 10814, 10822, 10829, 10835, 10841, 10849, 10857, 10863, 10870, 10875,
+					10882, 10889, 10897, 10905, 10911, 10917, 10925, 10930, 10937, 10944, 10950, 10958,
+					10966, 10973, 10980, 10984, 10992, 10999, 11007, 11013, 11021, 11028, 11036, 11044,
+					11051, 11059, 11067, 11071, 11077, 11082, 11088, 11095, 11102, 11107, 11116, 11122,
+					11131, 11141, 11147, 11155, 11160, 11166, 11171, 11176, 11182, 11187, 11194, 11200,
+					11206, 11214, 11219, 11226, 11231, 11238, 11245, 11249, 11255, 11261, 11266, 11273,
+					11278, 11284, 11291, 11297, 11304, 11310, 11315, 11321, 11327, 11333, 11339, 11346,
+					11351, 11357, 11363, 11371, 11376, 11383, 11392, 11398, 11404, 11410, 11416, 11422,
+					11430, 11435, 11441, 11448, 11454, 11463, 11471, 11477, 11483, 11489, 11496, 11502,
+					11512, 11521, 11528, 11535, 11543, 11548, 11554, 11559, 11565, 11573, 11582, 11589,
+					11597, 11603, 11613, 11623, 11628, 11636, 11642, 11646, 11653, 11658, 11664, 11670,
+					11677, 11685, 11691, 11698, 11706, 11714, 11722, 11728, 11737, 11741, 11747, 11756,
+					11763, 11771, 11780, 11785, 11793, 11800, 11805, 11811, 11817, 11824, 11830, 11836,
+					11842, 11851, 11858, 11867, 11873, 11883, 11889, 11896, 11904, 11910, 11917, 11923,
+					11929, 11935, 11939, 11946, 11954, 11962, 11971, 11978, 11989, 11996, 12003, 12010,
+					12017, 12025, 12030, 12037, 12045, 12051, 12060, 12067, 12076, 12085, 12091, 12097,
+					12104, 12110, 12117, 12123, 12131, 12138, 12145, 12152, 12161, 12167, 12175, 12182,
+					12190, 12198, 12202, 12208, 12217, 12224, 12230, 12236, 12243, 12251, 12257, 12264,
+					12269, 12275, 12280, 12286, 12292, 12300, 12306, 12314, 12323, 12330, 12336, 12343,
+					12348, 12355, 12361, 12369, 12378, 12384, 12390, 12397, 12405, 12411, 12417, 12423,
+					12431, 12437, 12442, 12450, 12457, 12463, 12469, 12479, 12486, 12492, 12499, 12504,
+					12515, 12520, 12526, 12533, 12539, 12546, 12552, 12558, 12564, 12573, 12581, 12587,
+					12597, 12605, 12612, 12618, 12625, 12633, 12640, 12646, 12650, 12656, 12666, 12673,
+					12680, 12687, 12693, 12699, 12706, 12712, 12719, 12728, 12733, 12739, 12745, 12754,
+					12759, 12764, 12772, 12780, 12789, 12798, 12803, 12810, 12818, 12824, 12831, 12836,
+					12841, 12847, 12853, 12858, 12864, 12870, 12875, 12881, 12889, 12896, 12905, 12912,
+					12917, 12925, 12931, 12937, 12945, 12949, 12955, 12961, 12970, 12978, 12986, 12992,
+					13002, 13008, 13014, 13020, 13027, 13033, 13040, 13047, 13056, 13063, 13071, 13076,
+					13083, 13088, 13094, 13100, 13106, 13113, 13121, 13128, 13135, 13142, 13148, 13154,
+					13160, 13166, 13173, 13179, 13189, 13194, 13201, 13207, 13213, 13221, 13230, 13238,
+					13246, 13252, 13258, 13265, 13274, 13281, 13288, 13293, 13302, 13306, 13312, 13318,
+					13325, 13330, 13338, 13343, 13348, 13356, 13363, 13372, 13376, 13381, 13389, 13396,
+					13402, 13407, 13413, 13421, 13426, 13435, 13441, 13447, 13457, 13465, 13470, 13477,
+					13485, 13490, 13497, 13504, 13515, 13522, 13528, 13533, 13540, 13546, 13551, 13558,
+					13564, 13571, 13578, 13584, 13590, 13596, 13600, 13607, 13613, 13619, 13626, 13632,
+					13638, 13645, 13651, 13657, 13664, 13670, 13680, 13685, 13693, 13700, 13706, 13714,
+					13720, 13724, 13730, 13738, 13743, 13752, 13761, 13767, 13773, 13780, 13786, 13796,
+					13802, 13811, 13817, 13823, 13830, 13836, 13841, 13850, 13858, 13865, 13871, 13877,
+					13882, 13886, 13892, 13899, 13905, 13910, 13916, 13921, 13927, 13932, 13937, 13942,
+					13948, 13955, 13961, 13968, 13974, 13979, 13985, 13990,
+			};
+		}
+	}
+}
+
+#endif //__ELASTOS_SDK_BIP39WORDLISTDATA_H__
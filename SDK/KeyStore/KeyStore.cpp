@@ -48,10 +48,20 @@ namespace Elastos {
 			std::vector<unsigned char> iv = Base64::toBits(sjclFile.getIv());
 			std::vector<unsigned char> adata = Base64::toBits(sjclFile.getAdata());
 			uint32_t ks = sjclFile.getKs();
+			KdfParams kdf(sjclFile.getIter());
+			if (sjclFile.getKdf() == "scrypt")
+				kdf = KdfParams::MemoryHard(sjclFile.getIter(), sjclFile.getR(), sjclFile.getP());
+			else if (sjclFile.getKdf() != "pbkdf2")
+				return false;
+
+			// the settings come from the file, bounded so a crafted one can not exhaust the stack or the CPU
+			if (!kdf.IsValid())
+				return false;
+
 			CMBlock plaintext;
 			plaintext = AES_256_CCM::decrypt(ct.data(), ct.size(), (unsigned char *) password.c_str(), password.size(),
 											 salt.data(), salt.size(), iv.data(), iv.size(), 128 == ks ? true : false,
-											 adata.data(), adata.size());
+											 adata.data(), adata.size(), kdf);
 			if (false == plaintext)
 				return false;
 
@@ -67,9 +77,10 @@ namespace Elastos {
 			return true;
 		}
 
-		bool KeyStore::save(const boost::filesystem::path &path, const std::string &password) {
+		bool KeyStore::save(const boost::filesystem::path &path, const std::string &password, const KdfParams &kdf) {
 			nlohmann::json json;
-			save(json, password);
+			if (!save(json, password, kdf))
+				return false;
 
 			std::ofstream outfile(path.string());
 			json >> outfile;
@@ -77,7 +88,7 @@ namespace Elastos {
 			return true;
 		}
 
-		bool KeyStore::save(nlohmann::json &json, const std::string &password) {
+		bool KeyStore::save(nlohmann::json &json, const std::string &password, const KdfParams &kdf) {
 			std::string str_ss;
 			nlohmann::json walletJson;
 			walletJson << _walletJson;
@@ -91,7 +102,7 @@ namespace Elastos {
 			bool bAes128 = false;
 			ciphertext = AES_256_CCM::encrypt((unsigned char *) str_ss.c_str(), str_ss.size(),
 											  (unsigned char *) password.c_str(), password.size(), salt, salt.GetSize(),
-											  iv, iv.GetSize(), bAes128);
+											  iv, iv.GetSize(), bAes128, nullptr, 0, kdf);
 			if (false == ciphertext)
 				return false;
 			std::string salt_base64 = Base64::fromBits(salt, salt.GetSize());
@@ -101,7 +112,12 @@ namespace Elastos {
 			SjclFile sjclFile;
 			sjclFile.setIv(iv_base64);
 			sjclFile.setV(1);
-			sjclFile.setIter(10000);
+			sjclFile.setIter(kdf.GetIterations());
+			if (kdf.GetAlgorithm() == KdfParams::Scrypt) {
+				sjclFile.setKdf("scrypt");
+				sjclFile.setR(kdf.GetBlockSize());
+				sjclFile.setP(kdf.GetParallelism());
+			}
 			sjclFile.setKs(!bAes128 ? uint32_t(256) : uint32_t(128));
 			sjclFile.setTs(64);
 			sjclFile.setMode("ccm");
@@ -8,6 +8,7 @@
 #include <boost/filesystem.hpp>
 
 #include "ElaNewWalletJson.h"
+#include "KeyDerivation.h"
 
 namespace Elastos {
 	namespace ElaWallet {
@@ -22,9 +23,11 @@ namespace Elastos {
 
 			bool open(const nlohmann::json &json, const std::string &password);
 
-			bool save(const boost::filesystem::path &path, const std::string &password);
+			bool save(const boost::filesystem::path &path, const std::string &password,
+					  const KdfParams &kdf = KdfParams());
 
-			bool save(nlohmann::json &json, const std::string &password);
+			// kdf selects how the file key is derived from password, see SjclFile for the scrypt extension
+			bool save(nlohmann::json &json, const std::string &password, const KdfParams &kdf = KdfParams());
 
 			const ElaNewWalletJson &json() const;
 
@@ -5,13 +5,13 @@
 #include <fstream>
 #include <sstream>
 
-#include "BRBIP39WordsEn.h"
-
 #include "Mnemonic.h"
+#include "BIP39WordList.h"
 
 #define MNEMONIC_PREFIX "mnemonic_"
 #define MNEMONIC_EXTENSION ".txt"
 #include "SDK/Common/ParamChecker.h"
+#include "SDK/Common/WalletTool.h"
 
 namespace fs = boost::filesystem;
 
@@ -19,12 +19,14 @@ namespace Elastos {
 	namespace ElaWallet {
 
 		Mnemonic::Mnemonic(const std::string &language) :
-			_i18nPath("data") {
+			_i18nPath("data"),
+			_wordList(nullptr) {
 			_language = language;
 			setLanguage(language);
 		}
 
-		Mnemonic::Mnemonic(const std::string &language, const boost::filesystem::path &path) {
+		Mnemonic::Mnemonic(const std::string &language, const boost::filesystem::path &path) :
+			_wordList(nullptr) {
 			setI18nPath(path);
 			_language = language;
 			setLanguage(language);
@@ -36,10 +38,9 @@ namespace Elastos {
 			_words.reserve(BIP39_WORDLIST_COUNT);
 			_language = language;
 
-			if (language == "english" || language == "") {
-				for (std::string str : BRBIP39WordsEn) {
-					_words.push_back(str);
-				}
+			_wordList = BIP39WordList::Get(language == "" ? "english" : language);
+			if (_wordList != nullptr) {
+				_words = _wordList->WordVector();
 			} else {
 				fs::path fileName = _i18nPath;
 				fileName /= MNEMONIC_PREFIX + language + MNEMONIC_EXTENSION;
@@ -71,5 +72,14 @@ namespace Elastos {
 			return _words;
 		}
 
+		bool Mnemonic::phraseIsValid(const std::string &phrase) const {
+			if (_wordList != nullptr)
+				return _wordList->PhraseIsValid(phrase);
+
+			CMemBlock<char> phraseData;
+			phraseData.SetMemFixed(phrase.c_str(), phrase.size() + 1);
+			return WalletTool::PhraseIsValid(phraseData, _words);
+		}
+
 	}
 }
\ No newline at end of file
@@ -11,6 +11,8 @@
 namespace Elastos {
 	namespace ElaWallet {
 
+		class BIP39WordList;
+
 		class Mnemonic {
 		public:
 			explicit Mnemonic(const std::string &language = "english");
@@ -19,6 +21,9 @@ namespace Elastos {
 
 			const std::vector<std::string> &words() const;
 
+			// checks words and checksum, built in languages use the BIP39WordList hash index
+			bool phraseIsValid(const std::string &phrase) const;
+
 			void setLanguage(const std::string &language);
 			std::string getLanguage() const;
 
@@ -31,6 +36,7 @@ namespace Elastos {
 			std::string _language;
 			boost::filesystem::path _i18nPath;
 			std::vector<std::string> _words;
+			const BIP39WordList *_wordList;
 		};
 
 	}
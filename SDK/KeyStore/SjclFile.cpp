@@ -7,7 +7,10 @@
 namespace Elastos {
 	namespace ElaWallet {
 
-		SjclFile::SjclFile() {
+		SjclFile::SjclFile() :
+				_kdf("pbkdf2"),
+				_r(0),
+				_p(0) {
 
 		}
 
@@ -95,6 +98,30 @@ namespace Elastos {
 			_ct = ct;
 		}
 
+		const std::string &SjclFile::getKdf() const {
+			return _kdf;
+		}
+
+		void SjclFile::setKdf(const std::string &kdf) {
+			_kdf = kdf;
+		}
+
+		uint32_t SjclFile::getR() const {
+			return _r;
+		}
+
+		void SjclFile::setR(uint32_t value) {
+			_r = value;
+		}
+
+		uint32_t SjclFile::getP() const {
+			return _p;
+		}
+
+		void SjclFile::setP(uint32_t value) {
+			_p = value;
+		}
+
 		nlohmann::json &operator<<(nlohmann::json &j, const SjclFile &p) {
 			to_json(j, p);
 
@@ -118,6 +145,11 @@ namespace Elastos {
 			j["cipher"] = p.getCipher();
 			j["salt"] = p.getSalt();
 			j["ct"] = p.getCt();
+			if (p.getKdf() != "pbkdf2") {
+				j["kdf"] = p.getKdf();
+				j["r"] = p.getR();
+				j["p"] = p.getP();
+			}
 		}
 
 		void from_json(const nlohmann::json &j, SjclFile &p) {
@@ -131,6 +163,11 @@ namespace Elastos {
 			p.setCipher(j["cipher"].get<std::string>());
 			p.setSalt(j["salt"].get<std::string>());
 			p.setCt(j["ct"].get<std::string>());
+			if (j.find("kdf") != j.end()) {
+				p.setKdf(j["kdf"].get<std::string>());
+				p.setR(j["r"].get<uint32_t>());
+				p.setP(j["p"].get<uint32_t>());
+			}
 		}
 	}
 }
\ No newline at end of file
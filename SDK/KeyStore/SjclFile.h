@@ -59,6 +59,19 @@ namespace Elastos {
 
 			void setCt(const std::string &ct);
 
+			// key derivation, "pbkdf2" (sjcl default) or "scrypt" with iter as the cost parameter N
+			const std::string &getKdf() const;
+
+			void setKdf(const std::string &kdf);
+
+			uint32_t getR() const;
+
+			void setR(uint32_t value);
+
+			uint32_t getP() const;
+
+			void setP(uint32_t value);
+
 		private:
 			JSON_SM_LS(SjclFile);
 			JSON_SM_RS(SjclFile);
@@ -76,6 +89,9 @@ namespace Elastos {
 			std::string _cipher;
 			std::string _salt;
 			std::string _ct;
+			std::string _kdf;
+			uint32_t _r;
+			uint32_t _p;
 		};
 	}
 }
@@ -8,6 +8,7 @@
 #include "BRCrypto.h"
 #include "BRMerkleBlock.h"
 #include "Utils.h"
+#include "MerkleTree.h"
 
 #include "MerkleBlock.h"
 
@@ -19,13 +20,6 @@ namespace Elastos {
 
 #define MAX_PROOF_OF_WORK 0xff7fffff    // highest value for difficulty target
 
-				inline static int _ceil_log2(int x)
-				{
-					int r = (x & (x - 1)) ? 1 : 0;
-
-					while ((x >>= 1) != 0) r++;
-					return r;
-				}
 			}
 		}
 
@@ -131,8 +125,7 @@ namespace Elastos {
 			// bit is the sign, and the remaining 23bits is the value after having been right shifted by (size - 3)*8 bits
 			static const uint32_t maxsize = MAX_PROOF_OF_WORK >> 24, maxtarget = MAX_PROOF_OF_WORK & 0x00ffffff;
 			const uint32_t size = _merkleBlock->raw.target >> 24, target = _merkleBlock->raw.target & 0x00ffffff;
-			size_t hashIdx = 0, flagIdx = 0;
-			UInt256 merkleRoot = MerkleBlockRootR(&hashIdx, &flagIdx, 0, _merkleBlock->raw), t = UINT256_ZERO;
+			UInt256 merkleRoot = MerkleTree::PartialRoot(_merkleBlock->raw), t = UINT256_ZERO;
 			int r = 1;
 
 			// check if merkle root is correct
@@ -252,31 +245,8 @@ namespace Elastos {
 			_merkleBlock->raw.height = height;
 		}
 
-		// recursively walks the merkle tree to calculate the merkle root
-		// NOTE: this merkle tree design has a security vulnerability (CVE-2012-2459), which can be defended against by
-		// considering the merkle root invalid if there are duplicate hashes in any rows with an even number of elements
 		UInt256 MerkleBlock::MerkleBlockRootR(size_t *hashIdx, size_t *flagIdx, int depth, const BRMerkleBlock &raw) {
-			uint8_t flag;
-			UInt256 hashes[2], md = UINT256_ZERO;
-
-			if (*flagIdx/8 < raw.flagsLen && *hashIdx < raw.hashesCount) {
-				flag = (raw.flags[*flagIdx/8] & (1 << (*flagIdx % 8)));
-				(*flagIdx)++;
-
-				if (flag && depth != _ceil_log2(raw.totalTx)) {
-					hashes[0] = MerkleBlockRootR(hashIdx, flagIdx, depth + 1, raw); // left branch
-					hashes[1] = MerkleBlockRootR(hashIdx, flagIdx, depth + 1, raw); // right branch
-
-					if (! UInt256IsZero(&hashes[0]) && ! UInt256Eq(&(hashes[0]), &(hashes[1]))) {
-						if (UInt256IsZero(&hashes[1])) hashes[1] = hashes[0]; // if right branch is missing, dup left branch
-						BRSHA256_2(&md, hashes, sizeof(hashes));
-					}
-					else *hashIdx = SIZE_MAX; // defend against (CVE-2012-2459)
-				}
-				else md = raw.hashes[(*hashIdx)++]; // leaf
-			}
-
-			return md;
+			return MerkleTree::PartialRootRecursive(hashIdx, flagIdx, depth, raw);
 		}
 
 		nlohmann::json MerkleBlock::toJson() const {
@@ -9,6 +9,7 @@
 #include "Utils.h"
 #include "MerkleBlock.h"
 #include "SidechainMerkleBlock.h"
+#include "MerkleTree.h"
 
 #define MAX_PROOF_OF_WORK 0xff7fffff    // highest value for difficulty target
 
@@ -254,8 +255,7 @@ namespace Elastos {
 			// bit is the sign, and the remaining 23bits is the value after having been right shifted by (size - 3)*8 bits
 			static const uint32_t maxsize = MAX_PROOF_OF_WORK >> 24, maxtarget = MAX_PROOF_OF_WORK & 0x00ffffff;
 			const uint32_t size = _merkleBlock->raw.target >> 24, target = _merkleBlock->raw.target & 0x00ffffff;
-			size_t hashIdx = 0, flagIdx = 0;
-			UInt256 merkleRoot = MerkleBlock::MerkleBlockRootR(&hashIdx, &flagIdx, 0, _merkleBlock->raw), t = UINT256_ZERO;
+			UInt256 merkleRoot = MerkleTree::PartialRoot(_merkleBlock->raw), t = UINT256_ZERO;
 			int r = 1;
 
 			// check if merkle root is correct
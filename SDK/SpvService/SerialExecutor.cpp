@@ -0,0 +1,145 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "SerialExecutor.h"
+#include "Log.h"
+
+// tasks run per turn before the queue goes back to the pool, so one busy wallet can not hog a worker
+#define SERIAL_DRAIN_BATCH 32
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		struct SerialExecutor::Queue {
+			struct Task {
+				boost::function<void()> Closure;
+				const void *Key;
+				boost::posix_time::ptime Queued;
+			};
+
+			Queue(WorkStealingExecutor &pool, size_t capacity) :
+					Pool(pool),
+					Capacity(capacity),
+					Scheduled(false),
+					Running(false),
+					Closed(false) {
+			}
+
+			WorkStealingExecutor &Pool;
+			size_t Capacity;
+
+			mutable boost::mutex Lock;
+			boost::condition_variable NotFull;
+			boost::condition_variable Idle;
+			std::deque<Task> Tasks;
+			bool Scheduled;
+			bool Running;
+			boost::thread::id RunningThread;
+			bool Closed;
+			ExecutorMetrics Metrics;
+		};
+
+		SerialExecutor::SerialExecutor(WorkStealingExecutor &pool, size_t capacity) :
+				_queue(new Queue(pool, capacity)) {
+		}
+
+		SerialExecutor::~SerialExecutor() {
+			boost::mutex::scoped_lock lock(_queue->Lock);
+			_queue->Closed = true;
+			_queue->Tasks.clear();
+			_queue->Metrics.QueueDepth = 0;
+			_queue->NotFull.notify_all();
+
+			// a task destroying its own executor must not wait for itself
+			while (_queue->Running && _queue->RunningThread != boost::this_thread::get_id())
+				_queue->Idle.wait(lock);
+		}
+
+		void SerialExecutor::execute(const Runnable &runnable) {
+			boost::mutex::scoped_lock lock(_queue->Lock);
+			if (_queue->Closed)
+				return;
+
+			if (runnable.Key != nullptr) {
+				for (std::deque<Queue::Task>::reverse_iterator it = _queue->Tasks.rbegin();
+					 it != _queue->Tasks.rend(); ++it) {
+					if (it->Key == runnable.Key) {
+						it->Closure = runnable.Closure;
+						_queue->Metrics.Coalesced++;
+						return;
+					}
+				}
+			} else if (_queue->Capacity != SERIAL_QUEUE_UNBOUNDED && _queue->Tasks.size() >= _queue->Capacity &&
+					   !_queue->Pool.IsWorkerThread()) {
+				_queue->Metrics.Blocked++;
+				while (_queue->Tasks.size() >= _queue->Capacity && !_queue->Closed)
+					_queue->NotFull.wait(lock);
+
+				if (_queue->Closed)
+					return;
+			}
+
+			Queue::Task task;
+			task.Closure = runnable.Closure;
+			task.Key = runnable.Key;
+			task.Queued = boost::posix_time::microsec_clock::universal_time();
+			_queue->Tasks.push_back(task);
+			_queue->Metrics.QueueDepth = _queue->Tasks.size();
+			_queue->Metrics.MaxQueueDepth = std::max(_queue->Metrics.MaxQueueDepth, _queue->Tasks.size());
+
+			if (!_queue->Scheduled) {
+				_queue->Scheduled = true;
+				_queue->Pool.execute(Runnable(boost::bind(&SerialExecutor::drain, _queue)));
+			}
+		}
+
+		ExecutorMetrics SerialExecutor::GetMetrics() const {
+			boost::mutex::scoped_lock lock(_queue->Lock);
+			return _queue->Metrics;
+		}
+
+		void SerialExecutor::drain(const QueuePtr &queue) {
+			boost::mutex::scoped_lock lock(queue->Lock);
+
+			for (size_t n = 0; n < SERIAL_DRAIN_BATCH && !queue->Tasks.empty(); ++n) {
+				Queue::Task task = queue->Tasks.front();
+				queue->Tasks.pop_front();
+				queue->NotFull.notify_one();
+
+				uint64_t latency = (uint64_t) (boost::posix_time::microsec_clock::universal_time() -
+											   task.Queued).total_microseconds();
+				queue->Metrics.QueueDepth = queue->Tasks.size();
+				queue->Metrics.TotalLatencyUs += latency;
+				queue->Metrics.MaxLatencyUs = std::max(queue->Metrics.MaxLatencyUs, latency);
+				queue->Running = true;
+				queue->RunningThread = boost::this_thread::get_id();
+				lock.unlock();
+
+				boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+				try {
+					task.Closure();
+				} catch (const std::exception &e) {
+					Log::getLogger()->error("Serial executor task error: {}", e.what());
+				} catch (...) {
+					Log::error("Serial executor task error.");
+				}
+				uint64_t run = (uint64_t) (boost::posix_time::microsec_clock::universal_time() -
+										   start).total_microseconds();
+
+				lock.lock();
+				queue->Metrics.Executed++;
+				queue->Metrics.TotalRunUs += run;
+				queue->Running = false;
+				queue->RunningThread = boost::thread::id();
+				queue->Idle.notify_all();
+			}
+
+			if (!queue->Tasks.empty() && !queue->Closed)
+				queue->Pool.execute(Runnable(boost::bind(&SerialExecutor::drain, queue)));
+			else
+				queue->Scheduled = false;
+		}
+
+	}
+}
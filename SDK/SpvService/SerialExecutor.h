@@ -0,0 +1,53 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_SERIALEXECUTOR_H__
+#define __ELASTOS_SDK_SERIALEXECUTOR_H__
+
+#include <boost/shared_ptr.hpp>
+
+#include "WorkStealingExecutor.h"
+
+#define DEFAULT_SERIAL_QUEUE_CAPACITY 1024
+#define SERIAL_QUEUE_UNBOUNDED 0
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Runs tasks one at a time in the order they were queued, on the threads of a shared WorkStealingExecutor.
+		 * Each wallet gets its own SerialExecutor: callbacks of one wallet keep their order while different wallets
+		 * run in parallel. When the queue is full, execute() blocks until there is room again, unless it is called
+		 * from a pool thread where waiting could deadlock the pool; a capacity of SERIAL_QUEUE_UNBOUNDED never blocks.
+		 * A runnable with a key replaces a queued one of the same key that has not started, keeping its place, and
+		 * never waits for room.
+		 * Destroying the executor drops the tasks still queued and waits for the running one.
+		 */
+		class SerialExecutor :
+			public Executor {
+		public:
+			explicit SerialExecutor(WorkStealingExecutor &pool = WorkStealingExecutor::Default(),
+									size_t capacity = DEFAULT_SERIAL_QUEUE_CAPACITY);
+
+			virtual ~SerialExecutor();
+
+			virtual void execute(const Runnable &runnable);
+
+			ExecutorMetrics GetMetrics() const;
+
+		private:
+			struct Queue;
+
+			typedef boost::shared_ptr<Queue> QueuePtr;
+
+			static void drain(const QueuePtr &queue);
+
+		private:
+			QueuePtr _queue;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_SERIALEXECUTOR_H__
@@ -8,23 +8,43 @@
 #include "WalletManager.h"
 #include "Utils.h"
 #include "Log.h"
+#include "Trace.h"
 #include "SingleAddressWallet.h"
+#include "WalletSnapshot.h"
 #include "ELACoreExt/ELATxOutput.h"
 #include "Plugin/Registry.h"
 #include "Plugin/Block/MerkleBlock.h"
 
-#define BACKGROUND_THREAD_COUNT 1
-
 #define DATABASE_PATH "spv_wallet.db"
 #define ISO "ela"
 
 namespace Elastos {
 	namespace ElaWallet {
 
+		namespace {
+			// carve a whole batch of transactions from a few slabs instead of one heap allocation per object
+			void reserveTransactionPools(size_t count) {
+				ObjectPool<ELATransaction>::Instance().Reserve(count);
+				ObjectPool<Transaction>::Instance().Reserve(count);
+				ObjectPool<TransactionOutput>::Instance().Reserve(2 * count);
+				ObjectPool<ELATxOutput>::Instance().Reserve(2 * count);
+				ObjectPool<Program>::Instance().Reserve(count);
+			}
+
+			// give back what the batch did not use, or what it freed again, once it is loaded
+			void trimTransactionPools() {
+				ObjectPool<ELATransaction>::Instance().Trim();
+				ObjectPool<Transaction>::Instance().Trim();
+				ObjectPool<TransactionOutput>::Instance().Trim();
+				ObjectPool<ELATxOutput>::Instance().Trim();
+				ObjectPool<Program>::Instance().Trim();
+			}
+		}
+
 		WalletManager::WalletManager(const WalletManager &proto) :
 				CoreWalletManager(proto._pluginTypes, proto._chainParams),
-				_executor(BACKGROUND_THREAD_COUNT),
 				_databaseManager(proto._databaseManager.getPath()),
+				_executor(WorkStealingExecutor::Default(), SERIAL_QUEUE_UNBOUNDED),
 				_forkId(proto._forkId) {
 			init(proto._masterPubKey, proto._earliestPeerTime, proto._singleAddress);
 		}
@@ -33,8 +53,8 @@ namespace Elastos {
 									 uint32_t earliestPeerTime, bool singleAddress,
 									 int forkId, const PluginTypes &pluginTypes, const ChainParams &chainParams) :
 				CoreWalletManager(pluginTypes, chainParams),
-				_executor(BACKGROUND_THREAD_COUNT),
 				_databaseManager(dbPath),
+				_executor(WorkStealingExecutor::Default(), SERIAL_QUEUE_UNBOUNDED),
 				_forkId(forkId) {
 			init(masterPubKey, earliestPeerTime, singleAddress);
 		}
@@ -44,8 +64,8 @@ namespace Elastos {
 									 const std::vector<std::string> &initialAddresses,
 									 const ChainParams &chainParams) :
 				CoreWalletManager(pluginTypes, chainParams),
-				_executor(BACKGROUND_THREAD_COUNT),
 				_databaseManager(dbPath),
+				_executor(WorkStealingExecutor::Default(), SERIAL_QUEUE_UNBOUNDED),
 				_forkId(forkId) {
 			init(earliestPeerTime, initialAddresses);
 		}
@@ -60,6 +80,7 @@ namespace Elastos {
 
 		void WalletManager::stop() {
 			getPeerManager()->disconnect();
+			writeSnapshot();
 		}
 
 		SharedWrapperList<Transaction, BRTransaction *> WalletManager::getTransactions(
@@ -68,6 +89,8 @@ namespace Elastos {
 
 			std::vector<TransactionEntity> txsEntity = _databaseManager.getAllTransactions(ISO);
 
+			reserveTransactionPools(txsEntity.size());
+
 			for (size_t i = 0; i < txsEntity.size(); ++i) {
 				TransactionPtr transaction(new Transaction());
 				ByteStream byteStream(txsEntity[i].buff, txsEntity[i].buff.GetSize(), false);
@@ -79,6 +102,8 @@ namespace Elastos {
 					txs.push_back(transaction);
 				}
 			}
+
+			trimTransactionPools();
 			return txs;
 		}
 
@@ -86,7 +111,7 @@ namespace Elastos {
 			nlohmann::json sendingTx = transaction->toJson();
 			ByteStream byteStream;
 			transaction->Serialize(byteStream);
-			Log::getLogger()->info("Sending transaction, json info: {}, hex String: {}",
+			Log::getLogger(Log::Wallet)->info("Sending transaction, json info: {}, hex String: {}",
 				sendingTx.dump(), Utils::encodeHex(byteStream.getBuffer()));
 
 			getPeerManager()->publishTransaction(transaction);
@@ -97,6 +122,10 @@ namespace Elastos {
 			//todo implement recover logic
 		}
 
+		ExecutorMetrics WalletManager::getListenerQueueMetrics() const {
+			return _executor.GetMetrics();
+		}
+
 		const PeerManagerPtr& WalletManager::getPeerManager() {
 			if (_peerManager == nullptr) {
 				_peerManager = PeerManagerPtr(new PeerManager(
@@ -174,6 +203,9 @@ namespace Elastos {
 		}
 
 		void WalletManager::syncStopped(const std::string &error) {
+			if (error.empty())
+				writeSnapshot();
+
 			std::for_each(_peerManagerListeners.begin(), _peerManagerListeners.end(),
 						  [&error](PeerManager::Listener *listener) {
 							  listener->syncStopped(error);
@@ -188,6 +220,8 @@ namespace Elastos {
 		}
 
 		void WalletManager::saveBlocks(bool replace, const SharedWrapperList<IMerkleBlock, BRMerkleBlock *> &blocks) {
+			TraceSpan span("wallet", "WalletManager::saveBlocks");
+			span.SetArg("wallet", _databaseManager.getWalletId());
 
 			if (replace) {
 				_databaseManager.deleteAllBlocks(ISO);
@@ -201,7 +235,7 @@ namespace Elastos {
 					continue;
 
 //				if (blocks.size() == 1)
-//					Log::getLogger()->info("checkpoint ====> [ {},  uint256(\"{}\"), {}, {} ],",
+//					Log::getLogger(Log::Wallet)->info("checkpoint ====> [ {},  uint256(\"{}\"), {}, {} ],",
 //									   blocks[i]->getHeight(),
 //									   Utils::UInt256ToString(blocks[i]->getBlockHash(), true),
 //									   blocks[i]->getRawBlock()->timestamp,
@@ -275,6 +309,7 @@ namespace Elastos {
 			SharedWrapperList<Transaction, BRTransaction *> txs;
 
 			std::vector<TransactionEntity> txsEntity = _databaseManager.getAllTransactions(ISO);
+			reserveTransactionPools(txsEntity.size());
 
 			for (size_t i = 0; i < txsEntity.size(); ++i) {
 				ELATransaction *tx = ELATransactionNew();
@@ -291,6 +326,7 @@ namespace Elastos {
 				txs.push_back(transaction);
 			}
 
+			trimTransactionPools();
 			return txs;
 		}
 
@@ -305,7 +341,7 @@ namespace Elastos {
 				ByteStream stream(blocksEntity[i].blockBytes, blocksEntity[i].blockBytes.GetSize(), false);
 				stream.setPosition(0);
 				if (!block->Deserialize(stream)) {
-					Log::getLogger()->error("block deserialize fail");
+					Log::getLogger(Log::Wallet)->error("block deserialize fail");
 				}
 				blocks.push_back(block);
 			}
@@ -326,10 +362,18 @@ namespace Elastos {
 			return peers;
 		}
 
+		WalletSnapshotPtr WalletManager::loadWalletSnapshot() {
+			return WalletSnapshot::Read(getSnapshotPath());
+		}
+
 		int WalletManager::getForkId() const {
 			return _forkId;
 		}
 
+		std::string WalletManager::getWalletId() const {
+			return _databaseManager.getWalletId();
+		}
+
 		const CoreWalletManager::PeerManagerListenerPtr &WalletManager::createPeerManagerListener() {
 			if (_peerManagerListener == nullptr) {
 				_peerManagerListener = PeerManagerListenerPtr(
@@ -353,5 +397,17 @@ namespace Elastos {
 			_peerManagerListeners.push_back(listener);
 		}
 
+		boost::filesystem::path WalletManager::getSnapshotPath() const {
+			boost::filesystem::path path = _databaseManager.getPath();
+			return path.replace_extension(".snapshot");
+		}
+
+		void WalletManager::writeSnapshot() {
+			if (_wallet == nullptr || _peerManager == nullptr)
+				return;
+
+			_wallet->WriteSnapshot(_peerManager->getLastBlockHash(), getSnapshotPath());
+		}
+
 	}
 }
@@ -14,7 +14,7 @@
 #include "TransactionCreationParams.h"
 #include "CoreWalletManager.h"
 #include "DatabaseManager.h"
-#include "BackgroundExecutor.h"
+#include "SerialExecutor.h"
 #include "KeyStore/KeyStore.h"
 #include "SDK/Transaction/Transaction.h"
 #include "CMemBlock.h"
@@ -63,6 +63,9 @@ namespace Elastos {
 
 			virtual const PeerManagerPtr &getPeerManager();
 
+			// depth and latency of the queue wallet and peer manager callbacks are delivered through
+			ExecutorMetrics getListenerQueueMetrics() const;
+
 		public:
 			// func balanceChanged(_ balance: UInt64)
 			virtual void balanceChanged(uint64_t balance);
@@ -107,15 +110,24 @@ namespace Elastos {
 
 			virtual SharedWrapperList<Peer, BRPeer *> loadPeers();
 
+			virtual WalletSnapshotPtr loadWalletSnapshot();
+
 			virtual int getForkId() const;
 
+			virtual std::string getWalletId() const;
+
 			virtual const PeerManagerListenerPtr &createPeerManagerListener();
 
 			virtual const WalletListenerPtr &createWalletListener();
 
 		private:
+			boost::filesystem::path getSnapshotPath() const;
+
+			void writeSnapshot();
+
 			DatabaseManager _databaseManager;
-			BackgroundExecutor _executor;
+			// unbounded: Core calls the listeners holding its own locks, so queuing them must never wait
+			SerialExecutor _executor;
 			int _forkId;
 
 			std::vector<Wallet::Listener *> _walletListeners;
@@ -0,0 +1,158 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "WorkStealingExecutor.h"
+#include "Log.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		WorkStealingExecutor::WorkStealingExecutor(size_t threadCount) :
+				_nextWorker(0),
+				_pending(0),
+				_stopping(false) {
+			if (threadCount == 0)
+				threadCount = std::max(boost::thread::hardware_concurrency(), 2u);
+
+			for (size_t i = 0; i < threadCount; ++i)
+				_workers.push_back(new Worker());
+
+			boost::mutex::scoped_lock lock(_lock);
+			for (size_t i = 0; i < threadCount; ++i) {
+				boost::thread *thread = _threads.create_thread(boost::bind(&WorkStealingExecutor::run, this, i));
+				_threadIds.push_back(thread->get_id());
+			}
+		}
+
+		WorkStealingExecutor::~WorkStealingExecutor() {
+			{
+				boost::mutex::scoped_lock lock(_lock);
+				_stopping = true;
+				_taskAvailable.notify_all();
+			}
+			_threads.join_all();
+
+			for (size_t i = 0; i < _workers.size(); ++i)
+				delete _workers[i];
+		}
+
+		WorkStealingExecutor &WorkStealingExecutor::Default() {
+			// intentionally leaked: wallets may still post callbacks during static destruction
+			static WorkStealingExecutor *executor = new WorkStealingExecutor();
+			return *executor;
+		}
+
+		void WorkStealingExecutor::execute(const Runnable &runnable) {
+			Task task;
+			task.Closure = runnable.Closure;
+			task.Queued = boost::posix_time::microsec_clock::universal_time();
+
+			// tasks queued from a worker stay on that worker, others are spread round robin
+			boost::mutex::scoped_lock lock(_lock);
+			int index = workerIndex();
+			Worker *worker = _workers[index >= 0 ? index : _nextWorker++ % _workers.size()];
+			{
+				boost::mutex::scoped_lock workerLock(worker->Lock);
+				worker->Tasks.push_back(task);
+			}
+
+			_pending++;
+			_metrics.QueueDepth = _pending;
+			_metrics.MaxQueueDepth = std::max(_metrics.MaxQueueDepth, _pending);
+			_taskAvailable.notify_one();
+		}
+
+		size_t WorkStealingExecutor::GetThreadCount() const {
+			return _workers.size();
+		}
+
+		bool WorkStealingExecutor::IsWorkerThread() const {
+			boost::mutex::scoped_lock lock(_lock);
+			return workerIndex() >= 0;
+		}
+
+		ExecutorMetrics WorkStealingExecutor::GetMetrics() const {
+			boost::mutex::scoped_lock lock(_lock);
+			return _metrics;
+		}
+
+		int WorkStealingExecutor::workerIndex() const {
+			boost::thread::id self = boost::this_thread::get_id();
+			for (size_t i = 0; i < _threadIds.size(); ++i) {
+				if (_threadIds[i] == self)
+					return (int) i;
+			}
+			return -1;
+		}
+
+		bool WorkStealingExecutor::takeTask(size_t index, Task &task) {
+			{
+				boost::mutex::scoped_lock lock(_workers[index]->Lock);
+				if (!_workers[index]->Tasks.empty()) {
+					task = _workers[index]->Tasks.back();
+					_workers[index]->Tasks.pop_back();
+					return true;
+				}
+			}
+
+			for (size_t i = 1; i < _workers.size(); ++i) {
+				Worker *victim = _workers[(index + i) % _workers.size()];
+				{
+					boost::mutex::scoped_lock lock(victim->Lock);
+					if (victim->Tasks.empty())
+						continue;
+					task = victim->Tasks.front();
+					victim->Tasks.pop_front();
+				}
+
+				// never hold a worker lock while taking _lock, execute() locks the other way round
+				boost::mutex::scoped_lock lock(_lock);
+				_metrics.Stolen++;
+				return true;
+			}
+
+			return false;
+		}
+
+		void WorkStealingExecutor::run(size_t index) {
+			for (;;) {
+				Task task;
+				if (takeTask(index, task)) {
+					uint64_t latency = (uint64_t) (boost::posix_time::microsec_clock::universal_time() -
+												   task.Queued).total_microseconds();
+					{
+						boost::mutex::scoped_lock lock(_lock);
+						_pending--;
+						_metrics.QueueDepth = _pending;
+						_metrics.TotalLatencyUs += latency;
+						_metrics.MaxLatencyUs = std::max(_metrics.MaxLatencyUs, latency);
+					}
+
+					boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+					try {
+						task.Closure();
+					} catch (const std::exception &e) {
+						Log::getLogger()->error("Work stealing executor task error: {}", e.what());
+					} catch (...) {
+						Log::error("Work stealing executor task error.");
+					}
+					uint64_t run = (uint64_t) (boost::posix_time::microsec_clock::universal_time() -
+											   start).total_microseconds();
+
+					boost::mutex::scoped_lock lock(_lock);
+					_metrics.Executed++;
+					_metrics.TotalRunUs += run;
+					continue;
+				}
+
+				boost::mutex::scoped_lock lock(_lock);
+				while (_pending == 0 && !_stopping)
+					_taskAvailable.wait(lock);
+				if (_stopping)
+					return;
+			}
+		}
+
+	}
+}
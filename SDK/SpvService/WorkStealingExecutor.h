@@ -0,0 +1,104 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_WORKSTEALINGEXECUTOR_H__
+#define __ELASTOS_SDK_WORKSTEALINGEXECUTOR_H__
+
+#include <deque>
+#include <vector>
+#include <boost/thread.hpp>
+
+#include "Executor.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		struct ExecutorMetrics {
+			ExecutorMetrics() :
+					QueueDepth(0),
+					MaxQueueDepth(0),
+					Executed(0),
+					Stolen(0),
+					Blocked(0),
+					Coalesced(0),
+					TotalLatencyUs(0),
+					MaxLatencyUs(0),
+					TotalRunUs(0) {
+			}
+
+			size_t QueueDepth;
+			size_t MaxQueueDepth;
+			// tasks finished
+			uint64_t Executed;
+			// tasks run by a worker other than the one they were queued on
+			uint64_t Stolen;
+			// execute() calls that had to wait for room in a full queue
+			uint64_t Blocked;
+			// tasks replaced, before they started, by a newer task of the same key
+			uint64_t Coalesced;
+			// time between execute() and the start of the task
+			uint64_t TotalLatencyUs;
+			uint64_t MaxLatencyUs;
+			// time spent running tasks
+			uint64_t TotalRunUs;
+		};
+
+		/**
+		 * Fixed size thread pool where every worker owns a task deque. Workers run their own tasks newest first and
+		 * take the oldest task of another worker when they run dry, so a worker stuck in a slow task does not hold
+		 * back the tasks queued behind it.
+		 */
+		class WorkStealingExecutor :
+			public Executor {
+		public:
+			// threadCount 0 means one thread per hardware thread, at least two
+			explicit WorkStealingExecutor(size_t threadCount = 0);
+
+			virtual ~WorkStealingExecutor();
+
+			// pool shared by the wallet listeners of every wallet in the process
+			static WorkStealingExecutor &Default();
+
+			virtual void execute(const Runnable &runnable);
+
+			size_t GetThreadCount() const;
+
+			bool IsWorkerThread() const;
+
+			ExecutorMetrics GetMetrics() const;
+
+		private:
+			struct Task {
+				boost::function<void()> Closure;
+				boost::posix_time::ptime Queued;
+			};
+
+			struct Worker {
+				boost::mutex Lock;
+				std::deque<Task> Tasks;
+			};
+
+			int workerIndex() const;
+
+			bool takeTask(size_t index, Task &task);
+
+			void run(size_t index);
+
+		private:
+			std::vector<Worker *> _workers;
+			std::vector<boost::thread::id> _threadIds;
+			boost::thread_group _threads;
+			size_t _nextWorker;
+
+			mutable boost::mutex _lock;
+			boost::condition_variable _taskAvailable;
+			size_t _pending;
+			bool _stopping;
+			ExecutorMetrics _metrics;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_WORKSTEALINGEXECUTOR_H__
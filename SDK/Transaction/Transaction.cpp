@@ -702,7 +702,7 @@ namespace Elastos {
 			if (_transaction->raw.inCount > 0 && wallet->inputFromWallet(&_transaction->raw.inputs[0])) {
 				std::string toAddress = "";
 
-				if (wallet->containsAddress(_transaction->outputs[0]->getAddress())) {
+				if (wallet->containsProgramHash(_transaction->outputs[0]->getProgramHash())) {
 					// transfer to my other address of wallet
 					jOut["Amount"] = _transaction->outputs[0]->getAmount();
 					jOut["ToAddress"] = _transaction->outputs[0]->getAddress();
@@ -725,7 +725,7 @@ namespace Elastos {
 				std::string toAddress = "";
 
 				for (size_t i = 0; i < _transaction->outputs.size(); ++i) {
-					if (wallet->containsAddress(_transaction->outputs[i]->getAddress())) {
+					if (wallet->containsProgramHash(_transaction->outputs[i]->getProgramHash())) {
 						inputAmount = _transaction->outputs[i]->getAmount();
 						toAddress = _transaction->outputs[i]->getAddress();
 					}
@@ -744,6 +744,123 @@ namespace Elastos {
 			Log::getLogger()->info("transaction summary = {}", summary.dump());
 		}
 
+		void Transaction::writeJson(JsonWriter &writer) const {
+			writeJson(writer, _transaction->Remark, nullptr);
+		}
+
+		void Transaction::writeJson(JsonWriter &writer, const boost::shared_ptr<Wallet> &wallet,
+									uint32_t blockHeight) {
+			// the remark of toJson(), from before generateExtraTransactionInfo() refreshes it
+			std::string remark = _transaction->Remark;
+
+			std::string summary;
+			JsonWriter summaryWriter(summary);
+			writeSummaryJson(summaryWriter, wallet, blockHeight);
+			Log::getLogger()->info("transaction summary = {}", summary);
+
+			writeJson(writer, remark, &summary);
+		}
+
+		// keys in the order of nlohmann::json, see JsonWriter
+		void Transaction::writeJson(JsonWriter &writer, const std::string &remark, const std::string *summary) const {
+			writer.BeginObject();
+
+			writer.Key("Attributes").BeginArray();
+			for (size_t i = 0; i < _transaction->attributes.size(); ++i)
+				_transaction->attributes[i]->writeJson(writer);
+			writer.EndArray();
+
+			writer.Key("BlockHeight").UInt(_transaction->raw.blockHeight);
+			writer.Key("Fee").UInt(_transaction->fee);
+
+			writer.Key("Inputs").BeginArray();
+			for (size_t i = 0; i < _transaction->raw.inCount; ++i) {
+				const BRTxInput *input = &_transaction->raw.inputs[i];
+				writer.BeginObject();
+				writer.Key("Address").String(input->address);
+				writer.Key("Amount").UInt(input->amount);
+				writer.Key("Index").UInt(input->index);
+				writer.Key("Script").Hex(input->script, input->scriptLen);
+				writer.Key("Sequence").UInt(input->sequence);
+				writer.Key("Signature").Hex(input->signature, input->sigLen);
+				writer.Key("TxHash").Hex(input->txHash.u8, sizeof(input->txHash.u8), true);
+				writer.EndObject();
+			}
+			writer.EndArray();
+
+			writer.Key("IsRegistered").Bool(_isRegistered);
+			writer.Key("LockTime").UInt(_transaction->raw.lockTime);
+
+			const std::vector<TransactionOutput *> &outputs = getOutputs();
+			writer.Key("Outputs").BeginArray();
+			for (size_t i = 0; i < outputs.size(); ++i)
+				outputs[i]->writeJson(writer);
+			writer.EndArray();
+
+			writer.Key("PayLoad");
+			_transaction->payload->writeJson(writer);
+			writer.Key("PayloadVersion").UInt(_transaction->payloadVersion);
+
+			writer.Key("Programs").BeginArray();
+			for (size_t i = 0; i < _transaction->programs.size(); ++i)
+				_transaction->programs[i]->writeJson(writer);
+			writer.EndArray();
+
+			writer.Key("Remark").String(remark);
+			if (summary != nullptr)
+				writer.Key("Summary").Raw(*summary);
+			writer.Key("Timestamp").UInt(_transaction->raw.timestamp);
+
+			UInt256 hash = getHash();
+			writer.Key("TxHash").Hex(hash.u8, sizeof(hash.u8), true);
+			writer.Key("Type").UInt((uint8_t) _transaction->type);
+			writer.Key("Version").UInt(_transaction->raw.version);
+
+			writer.EndObject();
+		}
+
+		// the summary of generateExtraTransactionInfo(), keys in the order of nlohmann::json
+		void Transaction::writeSummaryJson(JsonWriter &writer, const boost::shared_ptr<Wallet> &wallet,
+										   uint32_t blockHeight) {
+			UInt256 hash = getHash();
+			setRemark(wallet->GetRemark(Utils::UInt256ToString(hash)));
+
+			uint64_t inAmount = 0, outAmount = 0;
+			std::string inAddress, outAddress;
+			if (_transaction->raw.inCount > 0 && wallet->inputFromWallet(&_transaction->raw.inputs[0])) {
+				outAmount = _transaction->outputs[0]->getAmount();
+				outAddress = _transaction->outputs[0]->getAddress();
+				if (wallet->containsProgramHash(_transaction->outputs[0]->getProgramHash())) {
+					// transfer to my other address of wallet
+					inAmount = outAmount;
+					inAddress = outAddress;
+				}
+			} else {
+				for (size_t i = 0; i < _transaction->outputs.size(); ++i) {
+					if (wallet->containsProgramHash(_transaction->outputs[i]->getProgramHash())) {
+						inAmount = _transaction->outputs[i]->getAmount();
+						inAddress = _transaction->outputs[i]->getAddress();
+					}
+				}
+			}
+
+			writer.BeginObject();
+			writer.Key("ConfirmStatus").String(getConfirmInfo(blockHeight));
+			writer.Key("Fee").UInt(getTxFee(wallet));
+			writer.Key("Incoming").BeginObject();
+			writer.Key("Amount").UInt(inAmount);
+			writer.Key("ToAddress").String(inAddress);
+			writer.EndObject();
+			writer.Key("Outcoming").BeginObject();
+			writer.Key("Amount").UInt(outAmount);
+			writer.Key("ToAddress").String(outAddress);
+			writer.EndObject();
+			writer.Key("Remark").String(getRemark());
+			writer.Key("Status").String(getStatus(blockHeight));
+			writer.Key("TxHash").Hex(hash.u8, sizeof(hash.u8), true);
+			writer.EndObject();
+		}
+
 		std::string Transaction::getConfirmInfo(uint32_t blockHeight) {
 			if(getBlockHeight() == TX_UNCONFIRMED)
 				return std::to_string(0);
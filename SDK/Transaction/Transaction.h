@@ -14,6 +14,7 @@
 #include "Key.h"
 #include "WrapperList.h"
 #include "Program.h"
+#include "JsonWriter.h"
 #include "ELATransaction.h"
 #include "SDK/Plugin/Interface/ELAMessageSerializable.h"
 #include "ELACoreExt/Attribute.h"
@@ -47,6 +48,8 @@ namespace Elastos {
 
 			~Transaction();
 
+			DECLARE_POOLED_ALLOCATION(Transaction)
+
 			virtual std::string toString() const;
 
 			virtual BRTransaction *getRaw() const;
@@ -173,6 +176,15 @@ namespace Elastos {
 
 			void generateExtraTransactionInfo(nlohmann::json &rawTxJson, const boost::shared_ptr<Wallet> &wallet, uint32_t blockHeight);
 
+			// toJson().dump() written to writer
+			void writeJson(JsonWriter &writer) const;
+
+			// dump() of toJson() completed by generateExtraTransactionInfo(), written to writer
+			void writeJson(JsonWriter &writer, const boost::shared_ptr<Wallet> &wallet, uint32_t blockHeight);
+
+			// the "Summary" of generateExtraTransactionInfo(), written to writer
+			void writeSummaryJson(JsonWriter &writer, const boost::shared_ptr<Wallet> &wallet, uint32_t blockHeight);
+
 			void removeDuplicatePrograms();
 		private:
 			void reinit();
@@ -185,6 +197,8 @@ namespace Elastos {
 
 			std::string getConfirmInfo(uint32_t blockHeight);
 
+			void writeJson(JsonWriter &writer, const std::string &remark, const std::string *summary) const;
+
 			std::string getStatus(uint32_t blockHeight);
 
 		private:
@@ -66,6 +66,9 @@ namespace Elastos {
 
 		void TransactionOutput::setAddress(const std::string &address) {
 			BRTxOutputSetAddress(&_output->raw, address.c_str());
+			// wallets index outputs on the program hash
+			if (!Utils::UInt168FromAddress(_output->programHash, address))
+				_output->programHash = UINT168_ZERO;
 		}
 
 		void TransactionOutput::setAddressSignType(int signType) {
@@ -118,7 +121,7 @@ namespace Elastos {
 				return false;
 			}
 
-			setAddress(Utils::UInt168ToAddress(_output->programHash));
+			BRTxOutputSetAddress(&_output->raw, Utils::UInt168ToAddress(_output->programHash).c_str());
 
 			return true;
 		}
@@ -170,6 +173,19 @@ namespace Elastos {
 			return jsonData;
 		}
 
+		void TransactionOutput::writeJson(JsonWriter &writer) const {
+			writer.BeginObject();
+			writer.Key("Address").String(_output->raw.address);
+			writer.Key("Amount").UInt(_output->raw.amount);
+			writer.Key("AssetId").Hex(_output->assetId.u8, sizeof(_output->assetId.u8));
+			writer.Key("OutputLock").UInt(_output->outputLock);
+			writer.Key("ProgramHash").Hex(_output->programHash.u8, sizeof(_output->programHash.u8));
+			writer.Key("Script").Hex(_output->raw.script, _output->raw.scriptLen);
+			writer.Key("ScriptLen").UInt(_output->raw.scriptLen);
+			writer.Key("SignType").Int(_output->signType);
+			writer.EndObject();
+		}
+
 		void TransactionOutput::fromJson(const nlohmann::json &jsonData) {
 			std::string address = jsonData["Address"].get<std::string>();
 			size_t addressSize = sizeof(_output->raw.address);
@@ -11,6 +11,8 @@
 #include "SDK/ELACoreExt/ELATxOutput.h"
 #include "Wrapper.h"
 #include "CMemBlock.h"
+#include "ObjectPool.h"
+#include "JsonWriter.h"
 #include "SDK/Plugin/Interface/ELAMessageSerializable.h"
 
 namespace Elastos {
@@ -32,6 +34,8 @@ namespace Elastos {
 
 			~TransactionOutput();
 
+			DECLARE_POOLED_ALLOCATION(TransactionOutput)
+
 			virtual std::string toString() const;
 
 			virtual BRTxOutput *getRaw() const;
@@ -68,6 +72,9 @@ namespace Elastos {
 
 			virtual nlohmann::json toJson() const;
 
+			// toJson().dump() written to writer
+			void writeJson(JsonWriter &writer) const;
+
 			virtual void fromJson(const nlohmann::json &jsonData);
 
 		private:
@@ -7,7 +7,8 @@
 
 #include <string>
 
-#include "MasterPrivKey.h"
+#include "MasterPubKey.h"
+#include "PubKeyChain.h"
 #include "DatabaseManager.h"
 
 #define INTERNAL_ADDRESS_CACHE_SIZE 1000
@@ -18,7 +19,7 @@ namespace Elastos {
 
 		class AddressCache {
 		public:
-			AddressCache(const MasterPrivKey &masterPrivKey, DatabaseManager *databaseManager,
+			AddressCache(const MasterPubKey &masterPubKey, DatabaseManager *databaseManager,
 				uint32_t internalCacheSize = INTERNAL_ADDRESS_CACHE_SIZE,
 				uint32_t externalCacheSize = EXTERNAL_ADDRESS_CACHE_SIZE);
 
@@ -26,11 +27,13 @@ namespace Elastos {
 
 			std::vector<std::string> FetchAddresses(size_t size, bool external);
 
-			void Reset(const std::string &payPassword, uint32_t startIndex, bool external);
+			// tops the cache of a chain up to its size from startIndex, derived from the master public key alone
+			void Reset(uint32_t startIndex, bool external);
 
 		private:
 			DatabaseManager *_databaseManager;
-			MasterPrivKey _masterPrivKey;
+			PubKeyChain _internalChain;
+			PubKeyChain _externalChain;
 			uint32_t _internalStartIndex;
 			uint32_t _externalStartIndex;
 
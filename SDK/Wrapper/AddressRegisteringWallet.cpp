@@ -8,6 +8,7 @@
 #include "Core/BRArray.h"
 
 #include "AddressRegisteringWallet.h"
+#include "Utils.h"
 
 namespace Elastos {
 	namespace ElaWallet {
@@ -36,13 +37,16 @@ namespace Elastos {
 
 		void AddressRegisteringWallet::RegisterAddress(const std::string &address) {
 
+			UInt168 programHash;
+			if (!Utils::UInt168FromAddress(programHash, address))
+				return;
+
 			pthread_mutex_lock(&_wallet->Raw.lock);
 
-			if (BRSetContains(_wallet->Raw.allAddrs, address.c_str()) == 0) {
+			if (_wallet->AllProgramHashes.count(programHash) == 0) {
 				Address addr(address);
-				size_t count = array_count(_wallet->Raw.externalChain);
 				array_add(_wallet->Raw.externalChain, *addr.getRaw());
-				BRSetAdd(_wallet->Raw.allAddrs, &_wallet->Raw.externalChain[count]);
+				ELAWalletIndexAddress(_wallet, *addr.getRaw(), 0);
 			}
 			pthread_mutex_unlock(&_wallet->Raw.lock);
 		}
@@ -51,9 +55,7 @@ namespace Elastos {
 			ELAWallet *wallet = nullptr;
 			BRTransaction *tx;
 
-			wallet = (ELAWallet *) calloc(1, sizeof(*wallet));
-			assert(wallet != nullptr);
-			memset(wallet, 0, sizeof(*wallet));
+			wallet = ELAWalletAlloc();
 			array_new(wallet->Raw.utxos, 100);
 			array_new(wallet->Raw.transactions, 100);
 			wallet->Raw.feePerKb = DEFAULT_FEE_PER_KB;
@@ -70,30 +72,27 @@ namespace Elastos {
 			wallet->Raw.TransactionIsSigned = Wallet::TransactionIsSigned;
 			wallet->Raw.KeyToAddress = Wallet::KeyToAddress;
 			wallet->Raw.balanceAfterTx = Wallet::BalanceAfterTx;
+			wallet->Raw.WalletAmountReceivedFromTx = Wallet::WalletAmountReceivedFromTx;
+			wallet->Raw.WalletAmountSentByTx = Wallet::WalletAmountSentByTx;
 			wallet->Raw.internalChain = nullptr;
 			array_new(wallet->Raw.externalChain, 100);
 			array_new(wallet->Raw.balanceHist, 100);
-			wallet->Raw.allTx = BRSetNew(BRTransactionHash, BRTransactionEq, 100);
-			wallet->Raw.invalidTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-			wallet->Raw.pendingTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-			wallet->Raw.spentOutputs = BRSetNew(BRUTXOHash, BRUTXOEq, 100);
-			wallet->Raw.usedAddrs = BRSetNew(BRAddressHash, BRAddressEq, 100);
-			wallet->Raw.allAddrs = BRSetNew(BRAddressHash, BRAddressEq, 100);
+			wallet->Raw.allTx = BRSetNewUInt256(100);
+			wallet->Raw.invalidTx = BRSetNewUInt256(10);
+			wallet->Raw.pendingTx = BRSetNewUInt256(10);
+			wallet->Raw.spentOutputs = BRSetNewUTXO(100);
 			pthread_mutex_init(&wallet->Raw.lock, nullptr);
 
 			wallet->Raw.WalletUnusedAddrs((BRWallet *) wallet, nullptr, SEQUENCE_GAP_LIMIT_EXTERNAL, 0);
 			wallet->Raw.WalletUnusedAddrs((BRWallet *) wallet, nullptr, SEQUENCE_GAP_LIMIT_INTERNAL, 1);
 
 			std::set<std::string> uniqueAddress(initialAddrs.cbegin(), initialAddrs.cend());
-			int index = 0;
 			for (std::set<std::string>::iterator it = uniqueAddress.begin(); it != uniqueAddress.end(); ++it) {
 				Address addr(*it);
 				array_add(wallet->Raw.externalChain, *addr.getRaw());
-				BRSetAdd(wallet->Raw.allAddrs, &wallet->Raw.externalChain[index]);
-				index++;
+				ELAWalletIndexAddress(wallet, *addr.getRaw(), 0);
 			}
 
-			wallet->TxRemarkMap = ELAWallet::TransactionRemarkMap();
 			return wallet;
 		}
 
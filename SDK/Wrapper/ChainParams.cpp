@@ -8,6 +8,7 @@
 #include <SDK/Common/Log.h>
 
 #include "ChainParams.h"
+#include "CheckPointBundle.h"
 #include "BRBCashParams.h"
 
 namespace Elastos {
@@ -157,8 +158,7 @@ namespace Elastos {
 		};
 
 		ChainParams::ChainParams(const ChainParams &chainParams) {
-			_chainParams = boost::shared_ptr<ELAChainParams>(
-					new ELAChainParams(*(ELAChainParams *) chainParams.getRaw()));
+			copyFrom(chainParams);
 		}
 
 		ChainParams::ChainParams(const CoinConfig &coinConfig) {
@@ -214,10 +214,30 @@ namespace Elastos {
 		}
 
 		ChainParams &ChainParams::operator=(const ChainParams &params) {
-			_chainParams = boost::shared_ptr<ELAChainParams>(new ELAChainParams(*(ELAChainParams *) params.getRaw()));
+			copyFrom(params);
 			return *this;
 		}
 
+		void ChainParams::copyFrom(const ChainParams &params) {
+			_chainParams = boost::shared_ptr<ELAChainParams>(new ELAChainParams(*(ELAChainParams *) params.getRaw()));
+			if (!_chainParams->CheckPoints.empty())
+				_chainParams->Raw.checkpoints = _chainParams->CheckPoints.data();
+		}
+
+		void ChainParams::extendCheckPoints() {
+			std::vector<BRCheckPoint> checkPoints = CheckPointBundle::Extend(_chainParams->Raw.magicNumber,
+																			 _chainParams->Raw.checkpoints,
+																			 _chainParams->Raw.checkpointsCount);
+			if (checkPoints.size() == _chainParams->Raw.checkpointsCount)
+				return;
+
+			Log::getLogger()->info("Extend checkpoints of network {} to height {}", _chainParams->Raw.magicNumber,
+								   checkPoints.back().height);
+			_chainParams->CheckPoints.swap(checkPoints);
+			_chainParams->Raw.checkpoints = _chainParams->CheckPoints.data();
+			_chainParams->Raw.checkpointsCount = _chainParams->CheckPoints.size();
+		}
+
 		uint32_t ChainParams::getTargetTimeSpan() const {
 			return _chainParams->TargetTimeSpan;
 		}
@@ -6,6 +6,7 @@
 #define __ELASTOS_SDK_CHAINPARAMS_H__
 
 #include <string>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 
 #include "BRChainParams.h"
@@ -23,6 +24,9 @@ namespace Elastos {
 			uint32_t TargetTimeSpan;
 			uint32_t TargetTimePerBlock;
 			std::string NetType;
+
+			// set when extended by a checkpoint bundle, Raw.checkpoints points into it
+			std::vector<BRCheckPoint> CheckPoints;
 		};
 
 		class ChainParams :
@@ -42,9 +46,14 @@ namespace Elastos {
 			uint32_t getTargetTimeSpan() const;
 			uint32_t getTargetTimePerBlock() const;
 
+			// appends the newer checkpoints of the bundle registered for this network, see CheckPointBundle
+			void extendCheckPoints();
+
 		private:
 			void tryInit(const CoinConfig &coinConfig);
 
+			void copyFrom(const ChainParams &params);
+
 		private:
 
 			boost::shared_ptr<ELAChainParams> _chainParams;
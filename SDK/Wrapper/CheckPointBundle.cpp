@@ -0,0 +1,199 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <map>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "BRCrypto.h"
+
+#include "CheckPointBundle.h"
+#include "ByteStream.h"
+#include "Log.h"
+#include "Utils.h"
+#include "Plugin/Block/MerkleBlock.h"
+
+#define CHECKPOINT_BUNDLE_MAGIC 0x42504345 // "ECPB"
+// version, prevBlock, merkleRoot, timestamp, target, nonce and height
+#define COMPACT_HEADER_SIZE 84
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			struct BundleRegistry {
+				boost::mutex Lock;
+				std::map<uint32_t, std::vector<BRCheckPoint> > Bundles;
+			};
+
+			// leaked on purpose, chain params may be created while static objects are destroyed
+			BundleRegistry &bundleRegistry() {
+				static BundleRegistry *instance = new BundleRegistry();
+				return *instance;
+			}
+
+			UInt256 headerHash(const BRMerkleBlock &header) {
+				ByteStream stream;
+				MerkleBlock::serializeNoAux(stream, header);
+				CMBlock buf = stream.getBuffer();
+				UInt256 hash;
+				BRSHA256_2(&hash, buf, buf.GetSize());
+				return hash;
+			}
+
+			bool readHeader(ByteStream &stream, BRMerkleBlock &header) {
+				return stream.readUint32(header.version) &&
+					   stream.readBytes(header.prevBlock.u8, sizeof(UInt256)) &&
+					   stream.readBytes(header.merkleRoot.u8, sizeof(UInt256)) &&
+					   stream.readUint32(header.timestamp) &&
+					   stream.readUint32(header.target) &&
+					   stream.readUint32(header.nonce) &&
+					   stream.readUint32(header.height);
+			}
+		}
+
+		CheckPointBundle::CheckPointBundle() :
+				_magicNumber(0) {
+		}
+
+		CheckPointBundle CheckPointBundle::Read(const boost::filesystem::path &path, const std::string &publicKey) {
+			boost::system::error_code ec;
+			uintmax_t size = boost::filesystem::file_size(path, ec);
+			if (ec)
+				throw std::logic_error("Can not read checkpoint bundle " + path.string() + ": " + ec.message());
+
+			CMBlock data((size_t) size);
+			{
+				boost::filesystem::ifstream in(path, std::ios::in | std::ios::binary);
+				if (!in.read((char *) (void *) data, data.GetSize()))
+					throw std::logic_error("Can not read checkpoint bundle " + path.string());
+			}
+
+			ByteStream stream(data, data.GetSize(), false);
+			uint32_t magic = 0, version = 0;
+			uint64_t count = 0;
+			CheckPointBundle bundle;
+			if (!stream.readUint32(magic) || !stream.readUint32(version) || magic != CHECKPOINT_BUNDLE_MAGIC ||
+				version != CHECKPOINT_BUNDLE_VERSION)
+				throw std::logic_error("Unsupported checkpoint bundle " + path.string());
+
+			if (!stream.readUint32(bundle._magicNumber) || !stream.readVarUint(count) ||
+				count > stream.availableSize() / COMPACT_HEADER_SIZE)
+				throw std::logic_error("Truncated checkpoint bundle " + path.string());
+
+			for (uint64_t i = 0; i < count; ++i) {
+				BRMerkleBlock header;
+				if (!readHeader(stream, header))
+					throw std::logic_error("Truncated checkpoint bundle " + path.string());
+
+				// sync starting anywhere else stops at the next transition, its previous one is missing
+				if (header.height % BLOCK_DIFFICULTY_INTERVAL != 0)
+					throw std::logic_error("Checkpoint bundle has no difficulty transition at height " +
+										   std::to_string(header.height));
+
+				UInt256 hash = headerHash(header);
+				if (!bundle._checkPoints.empty()) {
+					const BRCheckPoint &prev = bundle._checkPoints.back();
+					if (header.height <= prev.height || header.timestamp < prev.timestamp)
+						throw std::logic_error("Checkpoint bundle is out of order at height " +
+											   std::to_string(header.height));
+				}
+
+				BRCheckPoint checkPoint;
+				checkPoint.height = header.height;
+				checkPoint.hash = UInt256Reverse(&hash);
+				checkPoint.timestamp = header.timestamp;
+				checkPoint.target = header.target;
+				bundle._checkPoints.push_back(checkPoint);
+			}
+
+			size_t signedSize = (size_t) stream.position();
+			CMBlock signature;
+			if (!stream.readVarBytes(signature) || stream.availableSize() != 0)
+				throw std::logic_error("Malformed checkpoint bundle signature " + path.string());
+
+			UInt256 digest;
+			BRSHA256(&digest, data, signedSize);
+			if (!Key::verifyByPublicKey(publicKey, digest, signature))
+				throw std::logic_error("Checkpoint bundle " + path.string() + " is not signed by " + publicKey);
+
+			return bundle;
+		}
+
+		void CheckPointBundle::Write(const boost::filesystem::path &path, uint32_t magicNumber,
+									 const std::vector<BRMerkleBlock> &headers, const Key &publisher) {
+			ByteStream stream;
+			stream.writeUint32(CHECKPOINT_BUNDLE_MAGIC);
+			stream.writeUint32(CHECKPOINT_BUNDLE_VERSION);
+			stream.writeUint32(magicNumber);
+			stream.writeVarUint(headers.size());
+			for (size_t i = 0; i < headers.size(); ++i)
+				MerkleBlock::serializeNoAux(stream, headers[i]);
+
+			CMBlock content = stream.getBuffer();
+			CMBlock digest(sizeof(UInt256));
+			BRSHA256(digest, content, content.GetSize());
+			stream.writeVarBytes(publisher.compactSign(digest));
+
+			CMBlock bundle = stream.getBuffer();
+			boost::filesystem::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!out.write((const char *) (const void *) bundle, bundle.GetSize()) || !out.flush())
+				throw std::logic_error("Can not write checkpoint bundle " + path.string());
+		}
+
+		uint32_t CheckPointBundle::GetMagicNumber() const {
+			return _magicNumber;
+		}
+
+		const std::vector<BRCheckPoint> &CheckPointBundle::GetCheckPoints() const {
+			return _checkPoints;
+		}
+
+		void CheckPointBundle::Register(const CheckPointBundle &bundle) {
+			BundleRegistry &r = bundleRegistry();
+			boost::mutex::scoped_lock lock(r.Lock);
+			r.Bundles[bundle._magicNumber] = bundle._checkPoints;
+		}
+
+		std::vector<BRCheckPoint> CheckPointBundle::Extend(uint32_t magicNumber, const BRCheckPoint *checkPoints,
+														   size_t count) {
+			std::vector<BRCheckPoint> result(checkPoints, checkPoints + count);
+
+			std::vector<BRCheckPoint> bundle;
+			{
+				BundleRegistry &r = bundleRegistry();
+				boost::mutex::scoped_lock lock(r.Lock);
+				std::map<uint32_t, std::vector<BRCheckPoint> >::const_iterator it = r.Bundles.find(magicNumber);
+				if (it == r.Bundles.end())
+					return result;
+				bundle = it->second;
+			}
+
+			if (count == 0 || bundle.empty() || bundle[0].height != checkPoints[0].height ||
+				!UInt256Eq(&bundle[0].hash, &checkPoints[0].hash)) {
+				Log::getLogger()->error("Ignore checkpoint bundle of another genesis block for network {}", magicNumber);
+				return result;
+			}
+
+			size_t next = 0;
+			for (size_t i = 0; i < bundle.size(); ++i) {
+				while (next < count && checkPoints[next].height < bundle[i].height)
+					next++;
+				if (next < count && checkPoints[next].height == bundle[i].height &&
+					!UInt256Eq(&checkPoints[next].hash, &bundle[i].hash)) {
+					Log::getLogger()->error("Ignore checkpoint bundle for network {}, it differs at height {}",
+											magicNumber, bundle[i].height);
+					return result;
+				}
+			}
+
+			for (size_t i = 0; i < bundle.size(); ++i) {
+				if (bundle[i].height > checkPoints[count - 1].height)
+					result.push_back(bundle[i]);
+			}
+			return result;
+		}
+
+	}
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_CHECKPOINTBUNDLE_H__
+#define __ELASTOS_SDK_CHECKPOINTBUNDLE_H__
+
+#include <vector>
+#include <boost/filesystem.hpp>
+
+#include "BRChainParams.h"
+#include "BRMerkleBlock.h"
+
+#include "Key.h"
+
+#define CHECKPOINT_BUNDLE_VERSION 1
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Checkpoints newer than the ones built into ChainParams, shipped as a file next to a deployment so new
+		 * wallets start syncing close to the tip. The file holds AuxPow-free block headers in ascending height, each
+		 * at a difficulty transition (a multiple of BLOCK_DIFFICULTY_INTERVAL) like the built-in checkpoints, since
+		 * the peer manager starts the chain at a checkpoint and needs the previous transition to verify the next one.
+		 * The block hashes are computed from the headers. Checkpoints are 2016 blocks apart and not linked to each
+		 * other, so they are trusted only because the publisher signed the whole file.
+		 */
+		class CheckPointBundle {
+		public:
+			CheckPointBundle();
+
+			// throws std::logic_error when the file is unreadable, not signed by publicKey (hex), out of order or has a
+			// checkpoint off a difficulty transition
+			static CheckPointBundle Read(const boost::filesystem::path &path, const std::string &publicKey);
+
+			static void Write(const boost::filesystem::path &path, uint32_t magicNumber,
+							  const std::vector<BRMerkleBlock> &headers, const Key &publisher);
+
+			uint32_t GetMagicNumber() const;
+
+			const std::vector<BRCheckPoint> &GetCheckPoints() const;
+
+			// use the checkpoints of the bundle for chain params of its network extended from now on
+			static void Register(const CheckPointBundle &bundle);
+
+			/**
+			 * Built-in checkpoints followed by the newer ones of the bundle registered for the network. The bundle is
+			 * ignored unless it starts at the same genesis block and agrees with every built-in checkpoint it has.
+			 */
+			static std::vector<BRCheckPoint> Extend(uint32_t magicNumber, const BRCheckPoint *checkPoints,
+													size_t count);
+
+		private:
+			uint32_t _magicNumber;
+			std::vector<BRCheckPoint> _checkPoints;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_CHECKPOINTBUNDLE_H__
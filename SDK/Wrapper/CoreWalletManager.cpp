@@ -46,14 +46,17 @@ namespace Elastos {
 									 const std::vector<std::string> &initialAddresses) {
 			_earliestPeerTime = earliestPeerTime;
 			_wallet = WalletPtr(new AddressRegisteringWallet(createWalletListener(), initialAddresses));
+			_wallet->setWalletId(getWalletId());
 		}
 
 		const WalletPtr &CoreWalletManager::getWallet() {
 			if (_wallet == nullptr) {
+				WalletSnapshotPtr snapshot = loadWalletSnapshot();
 				_wallet = WalletPtr(!_singleAddress
-									? new Wallet(loadTransactions(), _masterPubKey, createWalletListener())
+									? new Wallet(loadTransactions(), _masterPubKey, createWalletListener(), snapshot)
 									: new SingleAddressWallet(loadTransactions(), _masterPubKey,
-															  createWalletListener()));
+															  createWalletListener(), snapshot));
+				_wallet->setWalletId(getWalletId());
 			}
 			return _wallet;
 		}
@@ -150,11 +153,19 @@ namespace Elastos {
 			return SharedWrapperList<Peer, BRPeer *>();
 		}
 
+		WalletSnapshotPtr CoreWalletManager::loadWalletSnapshot() {
+			return WalletSnapshotPtr();
+		}
+
 		int CoreWalletManager::getForkId() const {
 			//todo complete me
 			return -1;
 		}
 
+		std::string CoreWalletManager::getWalletId() const {
+			return "";
+		}
+
 		const CoreWalletManager::PeerManagerListenerPtr &CoreWalletManager::createPeerManagerListener() {
 			if (_peerManagerListener == nullptr) {
 				_peerManagerListener = PeerManagerListenerPtr(
@@ -181,10 +192,10 @@ namespace Elastos {
 				_listener->syncStarted();
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (syncStarted) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStarted) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (syncStarted) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStarted) error.");
 			}
 		}
 
@@ -193,10 +204,10 @@ namespace Elastos {
 				_listener->syncStopped(error);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (syncStopped) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStopped) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (syncStopped) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStopped) error.");
 			}
 		}
 
@@ -205,10 +216,10 @@ namespace Elastos {
 				_listener->txStatusUpdate();
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (txStatusUpdate) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (txStatusUpdate) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (txStatusUpdate) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (txStatusUpdate) error.");
 			}
 		}
 
@@ -220,10 +231,10 @@ namespace Elastos {
 				_listener->saveBlocks(replace, blocks);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (saveBlocks) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (saveBlocks) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (saveBlocks) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (saveBlocks) error.");
 			}
 		}
 
@@ -234,10 +245,10 @@ namespace Elastos {
 				_listener->savePeers(replace, peers);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (savePeers) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (savePeers) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (savePeers) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (savePeers) error.");
 			}
 		}
 
@@ -246,10 +257,10 @@ namespace Elastos {
 				return _listener->networkIsReachable();
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (networkIsReachable) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (networkIsReachable) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (networkIsReachable) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (networkIsReachable) error.");
 			}
 
 			return false;
@@ -260,10 +271,10 @@ namespace Elastos {
 				_listener->txPublished(error);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (txPublished) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (txPublished) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (txPublished) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (txPublished) error.");
 			}
 		}
 
@@ -272,10 +283,10 @@ namespace Elastos {
 				_listener->blockHeightIncreased(blockHeight);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Peer manager callback (blockHeightIncreased) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (blockHeightIncreased) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::getLogger()->error("Peer manager callback (blockHeightIncreased) error.");
+				Log::getLogger(Log::Wallet)->error("Peer manager callback (blockHeightIncreased) error.");
 			}
 		}
 
@@ -294,10 +305,10 @@ namespace Elastos {
 					_listener->syncStarted();
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (syncStarted) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStarted) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (syncStarted) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStarted) error.");
 				}
 			}));
 		}
@@ -308,10 +319,10 @@ namespace Elastos {
 					_listener->syncStopped(error);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (syncStopped) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStopped) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (syncStopped) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (syncStopped) error.");
 				}
 			}));
 		}
@@ -322,10 +333,10 @@ namespace Elastos {
 					_listener->txStatusUpdate();
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (txStatusUpdate) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (txStatusUpdate) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (txStatusUpdate) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (txStatusUpdate) error.");
 				}
 			}));
 		}
@@ -338,10 +349,10 @@ namespace Elastos {
 					_listener->saveBlocks(replace, blocks);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (saveBlocks) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (saveBlocks) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (saveBlocks) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (saveBlocks) error.");
 				}
 			}));
 		}
@@ -353,10 +364,10 @@ namespace Elastos {
 					_listener->savePeers(replace, peers);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (savePeers) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (savePeers) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (savePeers) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (savePeers) error.");
 				}
 			}));
 		}
@@ -369,10 +380,10 @@ namespace Elastos {
 					_listener->networkIsReachable();
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (networkIsReachable) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (networkIsReachable) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (networkIsReachable) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (networkIsReachable) error.");
 				}
 			}));
 			return result;
@@ -385,26 +396,27 @@ namespace Elastos {
 					_listener->txPublished(error);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (txPublished) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (txPublished) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (txPublished) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (txPublished) error.");
 				}
 			}));
 		}
 
 		void WrappedExecutorPeerManagerListener::blockHeightIncreased(uint32_t blockHeight) {
+			// only the latest height matters, a burst of blocks during sync is delivered once
 			_executor->execute(Runnable([this, blockHeight]() -> void {
 				try {
 					_listener->blockHeightIncreased(blockHeight);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Peer manager callback (blockHeightIncreased) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (blockHeightIncreased) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Peer manager callback (blockHeightIncreased) error.");
+					Log::getLogger(Log::Wallet)->error("Peer manager callback (blockHeightIncreased) error.");
 				}
-			}));
+			}, &_blockHeightKey));
 		}
 
 		WrappedExceptionWalletListener::WrappedExceptionWalletListener(Wallet::Listener *listener) :
@@ -416,10 +428,10 @@ namespace Elastos {
 				_listener->balanceChanged(balance);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Wallet callback (balanceChanged) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Wallet callback (balanceChanged) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::error("Wallet callback (balanceChanged) error.");
+				Log::getLogger(Log::Wallet)->error("Wallet callback (balanceChanged) error.");
 			}
 		}
 
@@ -428,10 +440,10 @@ namespace Elastos {
 				return _listener->onTxAdded(transaction);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Wallet callback (onTxAdded) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Wallet callback (onTxAdded) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::error("Wallet callback (onTxAdded) error.");
+				Log::getLogger(Log::Wallet)->error("Wallet callback (onTxAdded) error.");
 			}
 		}
 
@@ -442,10 +454,10 @@ namespace Elastos {
 				_listener->onTxUpdated(hash, blockHeight, timeStamp);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Wallet callback (onTxUpdated) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Wallet callback (onTxUpdated) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::error("Wallet callback (onTxUpdated) error.");
+				Log::getLogger(Log::Wallet)->error("Wallet callback (onTxUpdated) error.");
 			}
 		}
 
@@ -456,10 +468,10 @@ namespace Elastos {
 				_listener->onTxDeleted(hash, notifyUser, recommendRescan);
 			}
 			catch (std::exception ex) {
-				Log::getLogger()->error("Wallet callback (onTxDeleted) error: {}", ex.what());
+				Log::getLogger(Log::Wallet)->error("Wallet callback (onTxDeleted) error: {}", ex.what());
 			}
 			catch (...) {
-				Log::error("Wallet callback (onTxDeleted) error.");
+				Log::getLogger(Log::Wallet)->error("Wallet callback (onTxDeleted) error.");
 			}
 		}
 
@@ -476,10 +488,10 @@ namespace Elastos {
 					_listener->balanceChanged(balance);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Wallet callback (balanceChanged) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Wallet callback (balanceChanged) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Wallet callback (balanceChanged) error.");
+					Log::getLogger(Log::Wallet)->error("Wallet callback (balanceChanged) error.");
 				}
 			}));
 		}
@@ -490,10 +502,10 @@ namespace Elastos {
 					_listener->onTxAdded(transaction);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Wallet callback (onTxAdded) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Wallet callback (onTxAdded) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Wallet callback (onTxAdded) error.");
+					Log::getLogger(Log::Wallet)->error("Wallet callback (onTxAdded) error.");
 				}
 			}));
 		}
@@ -505,10 +517,10 @@ namespace Elastos {
 					_listener->onTxUpdated(hash, blockHeight, timeStamp);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Wallet callback (onTxUpdated) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Wallet callback (onTxUpdated) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Wallet callback (onTxUpdated) error.");
+					Log::getLogger(Log::Wallet)->error("Wallet callback (onTxUpdated) error.");
 				}
 			}));
 		}
@@ -520,10 +532,10 @@ namespace Elastos {
 					_listener->onTxDeleted(hash, notifyUser, recommendRescan);
 				}
 				catch (std::exception ex) {
-					Log::getLogger()->error("Wallet callback (onTxDeleted) error: {}", ex.what());
+					Log::getLogger(Log::Wallet)->error("Wallet callback (onTxDeleted) error: {}", ex.what());
 				}
 				catch (...) {
-					Log::error("Wallet callback (onTxDeleted) error.");
+					Log::getLogger(Log::Wallet)->error("Wallet callback (onTxDeleted) error.");
 				}
 			}));
 		}
@@ -83,8 +83,14 @@ namespace Elastos {
 
 			virtual SharedWrapperList<Peer, BRPeer *> loadPeers();
 
+			// state of the wallet saved on a previous run, nullptr to rebuild it from the transactions
+			virtual WalletSnapshotPtr loadWalletSnapshot();
+
 			virtual int getForkId() const;
 
+			// tags the trace spans of the wallet, empty without a database
+			virtual std::string getWalletId() const;
+
 			typedef boost::shared_ptr<PeerManager::Listener> PeerManagerListenerPtr;
 
 			virtual const PeerManagerListenerPtr &createPeerManagerListener();
@@ -171,6 +177,8 @@ namespace Elastos {
 		private:
 			PeerManager::Listener *_listener;
 			Executor *_executor;
+			// Runnable key of blockHeightIncreased()
+			char _blockHeightKey;
 		};
 
 		// Exception Wrapped WalletListener
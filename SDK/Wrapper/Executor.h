@@ -11,11 +11,14 @@ namespace Elastos {
 	namespace ElaWallet {
 
 		struct Runnable {
-			Runnable(const boost::function<void()> &closure) :
-				Closure(closure) {
+			Runnable(const boost::function<void()> &closure, const void *key = nullptr) :
+				Closure(closure),
+				Key(key) {
 			}
 
 			boost::function<void()> Closure;
+			// an executor may drop a queued runnable that has not started for a newer one with the same non null key
+			const void *Key;
 		};
 
 		class Executor {
@@ -24,10 +24,18 @@
 #include "BTCKey.h"
 #include "BigIntFormat.h"
 #include "Utils.h"
+#include "Metrics.h"
 
 namespace Elastos {
 	namespace ElaWallet {
 
+		namespace {
+			MetricHistogram &keyLatency(const std::string &op) {
+				return Metrics::Instance().Histogram("spv_key_operation_seconds", "Signing and verification latency.",
+													 Metrics::LatencyBuckets(), "op=\"" + op + "\"");
+			}
+		}
+
 		Key::Key() {
 			_key = boost::shared_ptr<BRKey>(new BRKey);
 			memset(_key.get(), 0, sizeof(BRKey));
@@ -221,6 +229,9 @@ namespace Elastos {
 			CMBlock privKey;
 			privKey.SetMemFixed(_key->secret.u8, sizeof(_key->secret));
 
+			static MetricHistogram &latency = keyLatency("sign");
+			MetricTimer timer(latency);
+
 			CMBlock signedData;
 			BTCKey::ECDSA65Sign_sha256(privKey, *(UInt256 *) &md32[0], signedData, NID_X9_62_prime256v1);
 			return signedData;
@@ -377,6 +388,8 @@ namespace Elastos {
 			mbcPubKey.SetMemFixed(publicKey.c_str(), publicKey.size() + 1);
 			CMBlock pubKey = Str2Hex(mbcPubKey);
 
+			static MetricHistogram &latency = keyLatency("verify");
+			MetricTimer timer(latency);
 			return BTCKey::ECDSA65Verify_sha256(pubKey, messageDigest, signature, NID_X9_62_prime256v1);
 		}
 
@@ -13,6 +13,7 @@
 #include "Peer.h"
 #include "MerkleBlockMessage.h"
 #include "Log.h"
+#include "Trace.h"
 #include "Utils.h"
 #include "AuxPow.h"
 #include "ELACoreExt/ELAPeerManager.h"
@@ -24,6 +25,9 @@ namespace Elastos {
 	namespace ElaWallet {
 
 		int MerkleBlockMessage::Accept(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+			TraceSpan span("peer", "MerkleBlockMessage::Accept");
+			span.SetPeer(peer);
+
 			BRPeerContext *ctx = (BRPeerContext *) peer;
 			// msg is holding by payload pointer create by malloc, do not match delete[] in ByteStream
 			ByteStream stream(const_cast<uint8_t *>(msg), msgLen, false);
@@ -24,11 +24,17 @@
 #include "PingMessage.h"
 #include "PongMessage.h"
 #include "ELAMerkleBlock.h"
+#include "Metrics.h"
 
 namespace Elastos {
 	namespace ElaWallet {
 
 		namespace {
+			MetricCounter &messageCounter(const std::string &type, const std::string &direction) {
+				return Metrics::Instance().Counter("spv_peer_messages_total", "Peer messages by type and direction.",
+												   "type=\"" + type + "\",direction=\"" + direction + "\"");
+			}
+
 			BRMerkleBlock *BRMerkleBlockNewWrapper(void *info) {
 				BRMerkleBlock *block = nullptr;
 
@@ -65,6 +71,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptTxMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_TX, "received");
+				counter.Increment();
+
 				TransactionMessage *message = static_cast<TransactionMessage *>(
 						PeerMessageManager::instance().getWrapperMessage(MSG_TX).get());
 
@@ -72,6 +81,9 @@ namespace Elastos {
 			}
 
 			void PeerSendTxMessage(BRPeer *peer, BRTransaction *tx) {
+				static MetricCounter &counter = messageCounter(MSG_TX, "sent");
+				counter.Increment();
+
 				TransactionMessage *message = static_cast<TransactionMessage *>(
 						PeerMessageManager::instance().getWrapperMessage(MSG_TX).get());
 
@@ -79,6 +91,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptMerkleblockMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_MERKLEBLOCK, "received");
+				counter.Increment();
+
 				MerkleBlockMessage *message = static_cast<MerkleBlockMessage *>(
 						PeerMessageManager::instance().getWrapperMessage(MSG_MERKLEBLOCK).get());
 
@@ -86,6 +101,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptVersionMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_VERSION, "received");
+				counter.Increment();
+
 				VersionMessage *message = static_cast<VersionMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_VERSION).get());
 
@@ -93,6 +111,9 @@ namespace Elastos {
 			}
 
 			void PeerSendVersionMessage(BRPeer *peer) {
+				static MetricCounter &counter = messageCounter(MSG_VERSION, "sent");
+				counter.Increment();
+
 				VersionMessage *message = static_cast<VersionMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_VERSION).get());
 
@@ -100,6 +121,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptAddressMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_ADDR, "received");
+				counter.Increment();
+
 				AddressMessage *message = static_cast<AddressMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_ADDR).get());
 
@@ -107,6 +131,9 @@ namespace Elastos {
 			}
 
 			void PeerSendAddressMessage(BRPeer *peer) {
+				static MetricCounter &counter = messageCounter(MSG_ADDR, "sent");
+				counter.Increment();
+
 				AddressMessage *message = static_cast<AddressMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_ADDR).get());
 
@@ -114,6 +141,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptInventoryMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_INV, "received");
+				counter.Increment();
+
 				InventoryMessage *message = static_cast<InventoryMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_INV).get());
 
@@ -121,6 +151,9 @@ namespace Elastos {
 			}
 
 			void PeerSendInventoryMessage(BRPeer *peer, const UInt256 *txHashes, size_t txCount) {
+				static MetricCounter &counter = messageCounter(MSG_INV, "sent");
+				counter.Increment();
+
 				InventoryMessage *message = static_cast<InventoryMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_INV).get());
 
@@ -128,6 +161,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptNotFoundMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_NOTFOUND, "received");
+				counter.Increment();
+
 				NotFoundMessage *message = static_cast<NotFoundMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_NOTFOUND).get());
 
@@ -135,6 +171,9 @@ namespace Elastos {
 			}
 
 			void PeerSendFilterload(BRPeer *peer, BRBloomFilter *filter) {
+				static MetricCounter &counter = messageCounter(MSG_FILTERLOAD, "sent");
+				counter.Increment();
+
 				BloomFilterMessage *message = static_cast<BloomFilterMessage *>(
 						PeerMessageManager::instance().getWrapperMessage(MSG_FILTERLOAD).get());
 
@@ -142,6 +181,9 @@ namespace Elastos {
 			}
 
 			void PeerSendGetblocks(BRPeer *peer, const UInt256 *locators, size_t locatorsCount, UInt256 hashStop) {
+				static MetricCounter &counter = messageCounter(MSG_GETBLOCKS, "sent");
+				counter.Increment();
+
 				GetBlocksMessage *message = static_cast<GetBlocksMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_GETBLOCKS).get());
 
@@ -150,6 +192,9 @@ namespace Elastos {
 
 			void PeerSendGetdata(BRPeer *peer, const UInt256 *txHashes, size_t txCount,
 								 const UInt256 *blockHashes, size_t blockCount) {
+				static MetricCounter &counter = messageCounter(MSG_GETDATA, "sent");
+				counter.Increment();
+
 				GetDataMessage *message = static_cast<GetDataMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_GETDATA).get());
 
@@ -157,6 +202,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptGetData(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_GETDATA, "received");
+				counter.Increment();
+
 				GetDataMessage *message = static_cast<GetDataMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_GETDATA).get());
 
@@ -164,6 +212,9 @@ namespace Elastos {
 			}
 
 			void PeerSendPingMessage(BRPeer *peer, void *info, void (*pongCallback)(void *info, int success)) {
+				static MetricCounter &counter = messageCounter(MSG_PING, "sent");
+				counter.Increment();
+
 				PingMessage *message = static_cast<PingMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_PING).get());
 
@@ -171,6 +222,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptPingMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_PING, "received");
+				counter.Increment();
+
 				PingMessage *message = static_cast<PingMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_PING).get());
 
@@ -178,6 +232,9 @@ namespace Elastos {
 			}
 
 			int PeerAcceptPongMessage(BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+				static MetricCounter &counter = messageCounter(MSG_PONG, "received");
+				counter.Increment();
+
 				PongMessage *message = static_cast<PongMessage *>(
 						PeerMessageManager::instance().getMessage(MSG_PONG).get());
 				
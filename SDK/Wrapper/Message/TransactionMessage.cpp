@@ -10,6 +10,7 @@
 #include "TransactionMessage.h"
 #include "SDK/Transaction/Transaction.h"
 #include "Log.h"
+#include "Trace.h"
 #include "Utils.h"
 #include "ELATransaction.h"
 
@@ -22,6 +23,8 @@ namespace Elastos {
 
 		int TransactionMessage::Accept(
 				BRPeer *peer, const uint8_t *msg, size_t msgLen) {
+			TraceSpan span("peer", "TransactionMessage::Accept");
+			span.SetPeer(peer);
 
 			BRPeerContext *ctx = (BRPeerContext *) peer;
 
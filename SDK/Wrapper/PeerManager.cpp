@@ -216,6 +216,10 @@ namespace Elastos {
 			return BRPeerManagerLastBlockTimestamp((BRPeerManager *) _manager);
 		}
 
+		UInt256 PeerManager::getLastBlockHash() const {
+			return BRPeerManagerLastBlockHash((BRPeerManager *) _manager);
+		}
+
 		double PeerManager::getSyncProgress(uint32_t startHeight) {
 			return BRPeerManagerSyncProgress((BRPeerManager *) _manager, startHeight);
 		}
@@ -365,8 +369,13 @@ namespace Elastos {
 			manager->filterUpdateHeight = manager->lastBlock->height;
 			manager->fpRate = BLOOM_REDUCED_FALSEPOSITIVE_RATE;
 
-			size_t addrsCount = manager->wallet->WalletAllAddrs(manager->wallet, NULL, 0);
-			BRAddress *addrs = (BRAddress *)malloc(addrsCount*sizeof(*addrs));
+			ELAWallet *elaWallet = (ELAWallet *)manager->wallet;
+			pthread_mutex_lock(&manager->wallet->lock);
+			std::vector<UInt168> programHashes(elaWallet->AllProgramHashes.cbegin(), elaWallet->AllProgramHashes.cend());
+			programHashes.insert(programHashes.end(), elaWallet->ListeningProgramHashes.cbegin(),
+								 elaWallet->ListeningProgramHashes.cend());
+			pthread_mutex_unlock(&manager->wallet->lock);
+
 			size_t utxosCount = BRWalletUTXOs(manager->wallet, NULL, 0);
 			BRUTXO *utxos = (BRUTXO *)malloc(utxosCount*sizeof(*utxos));
 			uint32_t blockHeight = (manager->lastBlock->height > 100) ? manager->lastBlock->height - 100 : 0;
@@ -374,32 +383,16 @@ namespace Elastos {
 			BRTransaction **transactions = (BRTransaction **)malloc(txCount*sizeof(*transactions));
 			BRBloomFilter *filter;
 
-			assert(addrs != NULL);
 			assert(utxos != NULL);
 			assert(transactions != NULL);
-			addrsCount = manager->wallet->WalletAllAddrs(manager->wallet, addrs, addrsCount);
 			utxosCount = BRWalletUTXOs(manager->wallet, utxos, utxosCount);
 			txCount = BRWalletTxUnconfirmedBefore(manager->wallet, transactions, txCount, blockHeight);
-			filter = BRBloomFilterNew(manager->fpRate, addrsCount + utxosCount + txCount + 100, (uint32_t)BRPeerHash(peer),
+			filter = BRBloomFilterNew(manager->fpRate, programHashes.size() + utxosCount + txCount + 100, (uint32_t)BRPeerHash(peer),
 									  BLOOM_UPDATE_ALL); // BUG: XXX txCount not the same as number of spent wallet outputs
 
-			for (size_t i = 0; i < addrsCount; i++) { // add addresses to watch for tx receiveing money to the wallet
-				UInt168 hash = UINT168_ZERO;
-
-				BRAddressHash168(&hash, addrs[i].s);
-
-				if (! UInt168IsZero(&hash) && ! BRBloomFilterContainsData(filter, hash.u8, sizeof(hash))) {
-					BRBloomFilterInsertData(filter, hash.u8, sizeof(hash));
-				}
-			}
-
-			free(addrs);
-
-			ELAWallet *elaWallet = (ELAWallet *)manager->wallet;
-			for (size_t i = 0; i < elaWallet->ListeningAddrs.size(); ++i) {
-				UInt168 hash = UINT168_ZERO;
-
-				BRAddressHash168(&hash, elaWallet->ListeningAddrs[i].c_str());
+			// add wallet and listening addresses to watch for tx receiveing money to the wallet
+			for (size_t i = 0; i < programHashes.size(); i++) {
+				const UInt168 &hash = programHashes[i];
 
 				if (! UInt168IsZero(&hash) && ! BRBloomFilterContainsData(filter, hash.u8, sizeof(hash))) {
 					BRBloomFilterInsertData(filter, hash.u8, sizeof(hash));
@@ -419,11 +412,17 @@ namespace Elastos {
 			for (size_t i = 0; i < txCount; i++) { // also add TXOs spent within the last 100 blocks
 				for (size_t j = 0; j < transactions[i]->inCount; j++) {
 					BRTxInput *input = &transactions[i]->inputs[j];
-					BRTransaction *tx = BRWalletTransactionForHash(manager->wallet, input->txHash);
+					ELATransaction *tx = (ELATransaction *) BRWalletTransactionForHash(manager->wallet, input->txHash);
 					uint8_t o[sizeof(UInt256) + sizeof(uint32_t)];
 
-					if (tx && input->index < tx->outCount &&
-						BRWalletContainsAddress(manager->wallet, tx->outputs[input->index].address)) {
+					bool fromWallet = false;
+					if (tx && input->index < tx->outputs.size()) {
+						pthread_mutex_lock(&manager->wallet->lock);
+						fromWallet = elaWallet->AllProgramHashes.count(tx->outputs[input->index]->getProgramHash()) != 0;
+						pthread_mutex_unlock(&manager->wallet->lock);
+					}
+
+					if (fromWallet) {
 						UInt256Set(o, input->txHash);
 						UInt32SetLE(&o[sizeof(UInt256)], input->index);
 						if (! BRBloomFilterContainsData(filter, o, sizeof(o))) BRBloomFilterInsertData(filter, o,sizeof(o));
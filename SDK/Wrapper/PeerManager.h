@@ -101,6 +101,8 @@ namespace Elastos {
 
 			uint32_t getLastBlockTimestamp() const;
 
+			UInt256 getLastBlockHash() const;
+
 			double getSyncProgress(uint32_t startHeight);
 
 			Peer::ConnectStatus getConnectStatus() const;
@@ -88,6 +88,13 @@ namespace Elastos {
 			return jsonData;
 		}
 
+		void Program::writeJson(JsonWriter &writer) const {
+			writer.BeginObject();
+			writer.Key("Code").Hex(_code, _code.GetSize());
+			writer.Key("Parameter").Hex(_parameter, _parameter.GetSize());
+			writer.EndObject();
+		}
+
 		void Program::fromJson(const nlohmann::json &jsonData) {
 			_parameter = Utils::decodeHex(jsonData["Parameter"].get<std::string>());
 			_code = Utils::decodeHex(jsonData["Code"].get<std::string>());
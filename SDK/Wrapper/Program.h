@@ -8,6 +8,8 @@
 #include <boost/shared_ptr.hpp>
 
 #include "CMemBlock.h"
+#include "ObjectPool.h"
+#include "JsonWriter.h"
 #include "SDK/Plugin/Interface/ELAMessageSerializable.h"
 
 namespace Elastos {
@@ -24,6 +26,8 @@ namespace Elastos {
 
 			~Program();
 
+			DECLARE_POOLED_ALLOCATION(Program)
+
 			bool isValid();
 
 			const CMBlock &getCode();
@@ -40,6 +44,9 @@ namespace Elastos {
 
 			virtual nlohmann::json toJson() const;
 
+			// toJson().dump() written to writer
+			void writeJson(JsonWriter &writer) const;
+
 			virtual void fromJson(const nlohmann::json &jsonData);
 
 		private:
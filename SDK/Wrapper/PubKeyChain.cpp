@@ -0,0 +1,152 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <algorithm>
+#include <openssl/bn.h>
+#include <openssl/obj_mac.h>
+
+#include "BRAddress.h"
+#include "BRCrypto.h"
+
+#include "PubKeyChain.h"
+#include "Utils.h"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			// CKDpub of BIP32 on prime256v1: I = HMAC-SHA512(c, serP(K) || i), child = point(IL) + K and its chain
+			// code IR. The child point is left in projective coordinates
+			bool deriveChild(const EC_GROUP *group, const BIGNUM *order, const EC_POINT *parent,
+							 const uint8_t parentPubKey[33], const UInt256 &chainCode, uint32_t i, EC_POINT *child,
+							 UInt256 *childChainCode, BN_CTX *ctx) {
+				if ((i & BIP32_HARD) == BIP32_HARD) // can't derive private child key from public parent key
+					return false;
+
+				uint8_t buf[33 + sizeof(i)];
+				UInt512 I;
+				memcpy(buf, parentPubKey, 33);
+				UInt32SetBE(&buf[33], i);
+				BRHMAC(&I, BRSHA512, sizeof(UInt512), &chainCode, sizeof(chainCode), buf, sizeof(buf));
+
+				BN_CTX_start(ctx);
+				BIGNUM *il = BN_CTX_get(ctx);
+				bool ok = il != nullptr && BN_bin2bn(I.u8, sizeof(UInt256), il) != nullptr &&
+						  BN_cmp(il, order) < 0 &&
+						  1 == EC_POINT_mul(group, child, il, nullptr, nullptr, ctx) &&
+						  1 == EC_POINT_add(group, child, child, parent, ctx) &&
+						  !EC_POINT_is_at_infinity(group, child);
+				if (ok && childChainCode != nullptr)
+					memcpy(childChainCode->u8, &I.u8[sizeof(UInt256)], sizeof(UInt256));
+				BN_CTX_end(ctx);
+
+				var_clean(&I);
+				mem_clean(buf, sizeof(buf));
+				return ok;
+			}
+		}
+
+		PubKeyChain::PubKeyChain(const BRMasterPubKey &masterPubKey, uint32_t chain) :
+				_group(EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1)),
+				_order(BN_new()),
+				_chainPoint(nullptr),
+				_chainCode(masterPubKey.chainCode) {
+			memset(_chainPubKey, 0, sizeof(_chainPubKey));
+
+			BN_CTX *ctx = BN_CTX_new();
+			EC_POINT *master = _group ? EC_POINT_new(_group) : nullptr;
+			EC_POINT *node = _group ? EC_POINT_new(_group) : nullptr;
+			if (ctx && master && node && _order && 1 == EC_GROUP_get_order(_group, _order, ctx) &&
+				1 == EC_POINT_oct2point(_group, master, masterPubKey.pubKey, sizeof(masterPubKey.pubKey), ctx) &&
+				deriveChild(_group, _order, master, masterPubKey.pubKey, masterPubKey.chainCode, chain, node,
+							&_chainCode, ctx) &&
+				sizeof(_chainPubKey) == EC_POINT_point2oct(_group, node, POINT_CONVERSION_COMPRESSED, _chainPubKey,
+														   sizeof(_chainPubKey), ctx)) {
+				_chainPoint = node;
+				node = nullptr;
+			}
+
+			EC_POINT_free(node);
+			EC_POINT_free(master);
+			BN_CTX_free(ctx);
+		}
+
+		PubKeyChain::~PubKeyChain() {
+			EC_POINT_free(_chainPoint);
+			BN_free(_order);
+			EC_GROUP_free(_group);
+			var_clean(&_chainCode);
+		}
+
+		bool PubKeyChain::IsValid() const {
+			return _chainPoint != nullptr;
+		}
+
+		void PubKeyChain::deriveBatch(uint32_t start, size_t count, std::vector<CMBlock> &pubKeys, BN_CTX *ctx) const {
+			std::vector<EC_POINT *> points;
+			points.reserve(count);
+			for (size_t i = 0; i < count; ++i) {
+				EC_POINT *point = EC_POINT_new(_group);
+				if (point == nullptr || !deriveChild(_group, _order, _chainPoint, _chainPubKey, _chainCode,
+													 (uint32_t) (start + i), point, nullptr, ctx)) {
+					EC_POINT_free(point);
+					break;
+				}
+				points.push_back(point);
+			}
+
+			// Montgomery's trick, serializing the affine points needs no more inversions
+			if (!points.empty())
+				EC_POINTs_make_affine(_group, points.size(), &points[0], ctx);
+
+			for (size_t i = 0; i < points.size(); ++i) {
+				CMBlock pubKey(sizeof(_chainPubKey));
+				if (pubKey.GetSize() != EC_POINT_point2oct(_group, points[i], POINT_CONVERSION_COMPRESSED, pubKey,
+														   pubKey.GetSize(), ctx))
+					break;
+				pubKeys.push_back(pubKey);
+			}
+
+			for (size_t i = 0; i < points.size(); ++i)
+				EC_POINT_free(points[i]);
+		}
+
+		std::vector<CMBlock> PubKeyChain::DerivePubKeys(uint32_t start, size_t count) const {
+			std::vector<CMBlock> pubKeys;
+			if (!IsValid())
+				return pubKeys;
+
+			BN_CTX *ctx = BN_CTX_new();
+			if (ctx == nullptr)
+				return pubKeys;
+
+			pubKeys.reserve(count);
+			for (size_t done = 0; done < count && pubKeys.size() == done; done += PUBKEY_CHAIN_BATCH_SIZE) {
+				size_t batch = std::min<size_t>(count - done, PUBKEY_CHAIN_BATCH_SIZE);
+				deriveBatch((uint32_t) (start + done), batch, pubKeys, ctx);
+			}
+
+			BN_CTX_free(ctx);
+			return pubKeys;
+		}
+
+		std::vector<std::string> PubKeyChain::DeriveAddresses(uint32_t start, size_t count) const {
+			std::vector<CMBlock> pubKeys = DerivePubKeys(start, count);
+
+			// redeem script of Key::keyToRedeemScript(ELA_STANDARD)
+			std::vector<UInt168> programHashes(pubKeys.size());
+			uint8_t script[1 + sizeof(_chainPubKey) + 1];
+			script[0] = sizeof(_chainPubKey);
+			script[sizeof(script) - 1] = ELA_STANDARD;
+			for (size_t i = 0; i < pubKeys.size(); ++i) {
+				memcpy(&script[1], pubKeys[i], sizeof(_chainPubKey));
+				programHashes[i].u8[0] = ELA_STAND_ADDRESS;
+				BRHash160(&programHashes[i].u8[1], script, sizeof(script));
+			}
+
+			return Utils::UInt168ToAddresses(programHashes);
+		}
+
+	}
+}
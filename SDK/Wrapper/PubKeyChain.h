@@ -0,0 +1,64 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_PUBKEYCHAIN_H__
+#define __ELASTOS_SDK_PUBKEYCHAIN_H__
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <openssl/ec.h>
+
+#include "BRBIP32Sequence.h"
+
+#include "CMemBlock.h"
+
+// keys derived at once, their points share one field inversion
+#define PUBKEY_CHAIN_BATCH_SIZE 1024
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * Public keys and standard addresses N(m/chain/index) of a master public key, the same ones as
+		 * MasterPubKey::BIP32PubKey() without any private key material, for watch-only wallets. The chain node is
+		 * derived once and kept, and the points of the keys derived together are converted to affine coordinates
+		 * with a single field inversion instead of one per key.
+		 */
+		class PubKeyChain {
+		public:
+			PubKeyChain(const BRMasterPubKey &masterPubKey, uint32_t chain);
+
+			~PubKeyChain();
+
+			// false if the master public key is not a point of the curve
+			bool IsValid() const;
+
+			// compressed public keys of indexes start to start + count - 1, cut short at the first invalid child
+			std::vector<CMBlock> DerivePubKeys(uint32_t start, size_t count) const;
+
+			// standard addresses of the public keys of DerivePubKeys()
+			std::vector<std::string> DeriveAddresses(uint32_t start, size_t count) const;
+
+		private:
+			PubKeyChain(const PubKeyChain &);
+
+			PubKeyChain &operator=(const PubKeyChain &);
+
+			void deriveBatch(uint32_t start, size_t count, std::vector<CMBlock> &pubKeys, BN_CTX *ctx) const;
+
+		private:
+			EC_GROUP *_group;
+			BIGNUM *_order;
+			EC_POINT *_chainPoint;
+			uint8_t _chainPubKey[33];
+			UInt256 _chainCode;
+		};
+
+		typedef boost::shared_ptr<PubKeyChain> PubKeyChainPtr;
+
+	}
+}
+
+#endif //__ELASTOS_SDK_PUBKEYCHAIN_H__
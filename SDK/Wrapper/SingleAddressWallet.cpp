@@ -14,13 +14,14 @@ namespace Elastos {
 
 		SingleAddressWallet::SingleAddressWallet(const SharedWrapperList<Transaction, BRTransaction *> &transactions,
 												 const MasterPubKeyPtr &masterPubKey,
-												 const boost::shared_ptr<Wallet::Listener> &listener) {
+												 const boost::shared_ptr<Wallet::Listener> &listener,
+												 const WalletSnapshotPtr &snapshot) {
 
 			ParamChecker::checkNullPointer(listener.get());
 			_listener = boost::weak_ptr<Listener>(listener);
 
 			_wallet = createSingleWallet(transactions.getRawPointerArray().data(),
-										 transactions.size(), *masterPubKey->getRaw());
+										 transactions.size(), *masterPubKey->getRaw(), snapshot);
 			ParamChecker::checkNullPointer(_wallet, false);
 
 			BRWalletSetCallbacks((BRWallet *) _wallet, &_listener,
@@ -43,14 +44,12 @@ namespace Elastos {
 		}
 
 		ELAWallet *SingleAddressWallet::createSingleWallet(BRTransaction **transactions, size_t txCount,
-														  const BRMasterPubKey &mpk) {
+														  const BRMasterPubKey &mpk,
+														  const WalletSnapshotPtr &snapshot) {
 			ELAWallet *wallet = nullptr;
-			BRTransaction *tx;
 
 			assert(transactions != nullptr || txCount == 0);
-			wallet = (ELAWallet *) calloc(1, sizeof(*wallet));
-			assert(wallet != nullptr);
-			memset(wallet, 0, sizeof(*wallet));
+			wallet = ELAWalletAlloc();
 			array_new(wallet->Raw.utxos, 100);
 			array_new(wallet->Raw.transactions, txCount + 100);
 			wallet->Raw.feePerKb = DEFAULT_FEE_PER_KB;
@@ -67,31 +66,19 @@ namespace Elastos {
 			wallet->Raw.TransactionIsSigned = Wallet::TransactionIsSigned;
 			wallet->Raw.KeyToAddress = Wallet::KeyToAddress;
 			wallet->Raw.balanceAfterTx = Wallet::BalanceAfterTx;
+			wallet->Raw.WalletAmountReceivedFromTx = Wallet::WalletAmountReceivedFromTx;
+			wallet->Raw.WalletAmountSentByTx = Wallet::WalletAmountSentByTx;
 			wallet->Raw.internalChain = nullptr;
 			array_new(wallet->Raw.externalChain, 1);
 			array_new(wallet->Raw.balanceHist, txCount + 100);
-			wallet->Raw.allTx = BRSetNew(BRTransactionHash, BRTransactionEq, txCount + 100);
-			wallet->Raw.invalidTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-			wallet->Raw.pendingTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-			wallet->Raw.spentOutputs = BRSetNew(BRUTXOHash, BRUTXOEq, txCount + 100);
-			wallet->Raw.usedAddrs = BRSetNew(BRAddressHash, BRAddressEq, txCount + 100);
-			wallet->Raw.allAddrs = BRSetNew(BRAddressHash, BRAddressEq, txCount + 100);
+			wallet->Raw.allTx = BRSetNewUInt256(txCount + 100);
+			wallet->Raw.invalidTx = BRSetNewUInt256(10);
+			wallet->Raw.pendingTx = BRSetNewUInt256(10);
+			wallet->Raw.spentOutputs = BRSetNewUTXO(txCount + 100);
+			wallet->UsedProgramHashes.reserve(txCount + 100);
 			pthread_mutex_init(&wallet->Raw.lock, nullptr);
 
-			for (size_t i = 0; transactions && i < txCount; i++) {
-				tx = transactions[i];
-				if (!wallet->Raw.TransactionIsSigned(tx) || BRSetContains(wallet->Raw.allTx, tx)) continue;
-				BRSetAdd(wallet->Raw.allTx, tx);
-				_BRWalletInsertTx((BRWallet *)wallet, tx);
-
-				wallet->Raw.WalletAddUsedAddrs((BRWallet *)wallet, tx);
-			}
-
-			wallet->Raw.WalletUnusedAddrs((BRWallet *)wallet, nullptr, SEQUENCE_GAP_LIMIT_EXTERNAL, 0);
-			wallet->Raw.WalletUnusedAddrs((BRWallet *)wallet, nullptr, SEQUENCE_GAP_LIMIT_INTERNAL, 1);
-			wallet->Raw.WalletUpdateBalance((BRWallet *)wallet);
-			wallet->TxRemarkMap = ELAWallet::TransactionRemarkMap();
-			wallet->ListeningAddrs = std::vector<std::string>();
+			ELAWalletLoadTransactions(wallet, transactions, txCount, snapshot);
 
 			if (txCount > 0 && !wallet->Raw.WalletContainsTx((BRWallet *)wallet, transactions[0])) {
 				ELAWalletFree(wallet, false);
@@ -136,7 +123,7 @@ namespace Elastos {
 					return 0;
 
 				array_add(wallet->externalChain, address);
-				BRSetAdd(wallet->allAddrs, &wallet->externalChain[0]);
+				ELAWalletIndexAddress((ELAWallet *) wallet, address, 0);
 			} else if (addrs && count > 0) {
 				addrs[0] = wallet->externalChain[0];
 			}
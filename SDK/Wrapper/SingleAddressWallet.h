@@ -14,12 +14,14 @@ namespace Elastos {
 		public:
 			SingleAddressWallet(const SharedWrapperList<Transaction, BRTransaction *> &transactions,
 								const MasterPubKeyPtr &masterPubKey,
-								const boost::shared_ptr<Listener> &listener);
+								const boost::shared_ptr<Listener> &listener,
+								const WalletSnapshotPtr &snapshot = WalletSnapshotPtr());
 
 			virtual ~SingleAddressWallet();
 
 		private:
-			ELAWallet *createSingleWallet(BRTransaction *transactions[], size_t txCount, const BRMasterPubKey &mpk);
+			ELAWallet *createSingleWallet(BRTransaction *transactions[], size_t txCount, const BRMasterPubKey &mpk,
+										  const WalletSnapshotPtr &snapshot);
 
 			static size_t singleAddressWalletAllAddrs(BRWallet *wallet, BRAddress addrs[], size_t addrsCount);
 
@@ -3,6 +3,8 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <stdlib.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <boost/scoped_ptr.hpp>
 #include <Core/BRTransaction.h>
 #include <SDK/ELACoreExt/ELATxOutput.h>
@@ -18,7 +20,10 @@
 #include "BRTransaction.h"
 
 #include "Wallet.h"
+#include "WalletSnapshot.h"
 #include "Utils.h"
+#include "Trace.h"
+#include "JsonWriter.h"
 #include "ELACoreExt/ELATransaction.h"
 #include "ELATxOutput.h"
 
@@ -40,14 +45,12 @@ namespace Elastos {
 								uint64_t (*WalletFeeForTx)(BRWallet *wallet, const BRTransaction *tx),
 								int (*TransactionIsSigned)(const BRTransaction *tx),
 								size_t (*KeyToAddress)(const BRKey *key, char *addr, size_t addrLen),
-								uint64_t (*balanceAfterTx)(BRWallet *wallet, const BRTransaction *tx)) {
+								uint64_t (*balanceAfterTx)(BRWallet *wallet, const BRTransaction *tx),
+								const WalletSnapshotPtr &snapshot) {
 			ELAWallet *wallet = NULL;
-			BRTransaction *tx;
 
 			assert(transactions != NULL || txCount == 0);
-			wallet = (ELAWallet *) calloc(1, sizeof(*wallet));
-			assert(wallet != NULL);
-			memset(wallet, 0, sizeof(*wallet));
+			wallet = ELAWalletAlloc();
 			array_new(wallet->Raw.utxos, 100);
 			array_new(wallet->Raw.transactions, txCount + 100);
 			wallet->Raw.feePerKb = DEFAULT_FEE_PER_KB;
@@ -67,34 +70,15 @@ namespace Elastos {
 			array_new(wallet->Raw.internalChain, 100);
 			array_new(wallet->Raw.externalChain, 100);
 			array_new(wallet->Raw.balanceHist, txCount + 100);
-			wallet->Raw.allTx = BRSetNew(BRTransactionHash, BRTransactionEq, txCount + 100);
-			wallet->Raw.invalidTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-			wallet->Raw.pendingTx = BRSetNew(BRTransactionHash, BRTransactionEq, 10);
-			wallet->Raw.spentOutputs = BRSetNew(BRUTXOHash, BRUTXOEq, txCount + 100);
-			wallet->Raw.usedAddrs = BRSetNew(BRAddressHash, BRAddressEq, txCount + 100);
-			wallet->Raw.allAddrs = BRSetNew(BRAddressHash, BRAddressEq, txCount + 100);
+			wallet->Raw.allTx = BRSetNewUInt256(txCount + 100);
+			wallet->Raw.invalidTx = BRSetNewUInt256(10);
+			wallet->Raw.pendingTx = BRSetNewUInt256(10);
+			wallet->Raw.spentOutputs = BRSetNewUTXO(txCount + 100);
+			wallet->UsedProgramHashes.reserve(txCount + 100);
+			wallet->AllProgramHashes.reserve(txCount + 100);
 			pthread_mutex_init(&wallet->Raw.lock, NULL);
 
-			for (size_t i = 0; transactions && i < txCount; i++) {
-				tx = transactions[i];
-				if (!wallet->Raw.TransactionIsSigned(tx) || BRSetContains(wallet->Raw.allTx, tx)) continue;
-				BRSetAdd(wallet->Raw.allTx, tx);
-				_BRWalletInsertTx((BRWallet *) wallet, tx);
-
-				if (wallet->Raw.WalletAddUsedAddrs) {
-					wallet->Raw.WalletAddUsedAddrs((BRWallet *) wallet, tx);
-				} else {
-					for (size_t j = 0; j < tx->outCount; j++) {
-						if (tx->outputs[j].address[0] != '\0') BRSetAdd(wallet->Raw.usedAddrs, tx->outputs[j].address);
-					}
-				}
-			}
-
-			wallet->Raw.WalletUnusedAddrs((BRWallet *) wallet, NULL, SEQUENCE_GAP_LIMIT_EXTERNAL, 0);
-			wallet->Raw.WalletUnusedAddrs((BRWallet *) wallet, NULL, SEQUENCE_GAP_LIMIT_INTERNAL, 1);
-			wallet->Raw.WalletUpdateBalance((BRWallet *) wallet);
-			wallet->TxRemarkMap = ELAWallet::TransactionRemarkMap();
-			wallet->ListeningAddrs = std::vector<std::string>();
+			ELAWalletLoadTransactions(wallet, transactions, txCount, snapshot);
 
 			if (txCount > 0 && !wallet->Raw.WalletContainsTx((BRWallet *) wallet,
 															 transactions[0])) { // verify transactions match master pubKey
@@ -108,8 +92,6 @@ namespace Elastos {
 		void ELAWalletFree(ELAWallet *wallet, bool freeInternal) {
 			assert(wallet != NULL);
 			pthread_mutex_lock(&wallet->Raw.lock);
-			BRSetFree(wallet->Raw.allAddrs);
-			BRSetFree(wallet->Raw.usedAddrs);
 			BRSetFree(wallet->Raw.invalidTx);
 			BRSetFree(wallet->Raw.pendingTx);
 			BRSetApply(wallet->Raw.allTx, NULL, wallet->Raw.setApplyFreeTx);
@@ -124,7 +106,22 @@ namespace Elastos {
 			pthread_mutex_unlock(&wallet->Raw.lock);
 			pthread_mutex_destroy(&wallet->Raw.lock);
 
-			free(wallet);
+			delete wallet;
+		}
+
+		ELAWallet *ELAWalletAlloc() {
+			// value initialization zeroes Raw and constructs the indexes
+			return new ELAWallet();
+		}
+
+		void ELAWalletIndexAddress(ELAWallet *wallet, const BRAddress &address, int internal) {
+			UInt168 programHash = UINT168_ZERO;
+			if (Utils::UInt168FromAddress(programHash, address.s))
+				wallet->AllProgramHashes.insert(programHash);
+			if (internal)
+				wallet->InternalProgramHashes.push_back(programHash);
+			else
+				wallet->ExternalProgramHashes.push_back(programHash);
 		}
 
 		std::string ELAWalletGetRemark(ELAWallet *wallet, const std::string &txHash) {
@@ -138,14 +135,68 @@ namespace Elastos {
 			wallet->TxRemarkMap[txHash] = remark;
 		}
 
-		void ELAWalletLoadRemarks(ELAWallet *wallet,
-												const SharedWrapperList<Transaction, BRTransaction *> &transaction) {
-			for (int i = 0; i < transaction.size(); ++i) {
-				wallet->TxRemarkMap[Utils::UInt256ToString(transaction[i]->getHash())] =
-						((ELATransaction *) transaction[i]->getRaw())->Remark;
+		static void addUsedAddrs(ELAWallet *wallet, BRTransaction *tx) {
+			if (wallet->Raw.WalletAddUsedAddrs) {
+				wallet->Raw.WalletAddUsedAddrs((BRWallet *) wallet, tx);
+			} else {
+				UInt168 programHash;
+				for (size_t j = 0; j < tx->outCount; j++) {
+					if (Utils::UInt168FromAddress(programHash, tx->outputs[j].address))
+						wallet->UsedProgramHashes.insert(programHash);
+				}
 			}
 		}
 
+		void ELAWalletLoadTransactions(ELAWallet *wallet, BRTransaction *transactions[], size_t txCount,
+									   const WalletSnapshotPtr &snapshot) {
+			std::vector<BRTransaction *> added;
+			BRTransaction *tx;
+
+			for (size_t i = 0; transactions && i < txCount; i++) {
+				tx = transactions[i];
+				if (!wallet->Raw.TransactionIsSigned(tx) || BRSetContains(wallet->Raw.allTx, tx)) continue;
+				BRSetAdd(wallet->Raw.allTx, tx);
+				added.push_back(tx);
+			}
+
+			size_t restored = 0;
+			bool resume = false;
+			if (snapshot != nullptr && snapshot->Restore(wallet)) {
+				restored = array_count(wallet->Raw.transactions);
+				// the balance can only resume after the snapshot if its pending state can not have changed
+				resume = true;
+				for (size_t i = 0; resume && i < restored; i++)
+					resume = wallet->Raw.transactions[i]->blockHeight != TX_UNCONFIRMED;
+			}
+
+			std::unordered_set<BRTransaction *> inSnapshot(wallet->Raw.transactions,
+														   wallet->Raw.transactions + restored);
+			for (size_t i = 0; i < added.size(); i++) {
+				tx = added[i];
+				if (inSnapshot.count(tx)) continue;
+				_BRWalletInsertTx((BRWallet *) wallet, tx);
+				addUsedAddrs(wallet, tx);
+				if (tx->blockHeight == TX_UNCONFIRMED) resume = false;
+				wallet->TxRemarkMap[Utils::UInt256ToString(tx->txHash)] = ((ELATransaction *) tx)->Remark;
+			}
+
+			// newer transactions must all have been sorted after the snapshot ones
+			for (size_t i = 0; resume && i < restored; i++)
+				resume = inSnapshot.count(wallet->Raw.transactions[i]) != 0;
+
+			if (restored > 0 && !resume) {
+				for (size_t i = 0; i < restored; i++)
+					addUsedAddrs(wallet, wallet->Raw.transactions[i]);
+			}
+
+			wallet->Raw.WalletUnusedAddrs((BRWallet *) wallet, NULL, SEQUENCE_GAP_LIMIT_EXTERNAL, 0);
+			wallet->Raw.WalletUnusedAddrs((BRWallet *) wallet, NULL, SEQUENCE_GAP_LIMIT_INTERNAL, 1);
+			if (resume)
+				ELAWalletUpdateBalance((BRWallet *) wallet, restored);
+			else
+				wallet->Raw.WalletUpdateBalance((BRWallet *) wallet);
+		}
+
 
 		Wallet::Wallet() {
 
@@ -153,14 +204,17 @@ namespace Elastos {
 
 		Wallet::Wallet(const SharedWrapperList<Transaction, BRTransaction *> &transactions,
 					   const MasterPubKeyPtr &masterPubKey,
-					   const boost::shared_ptr<Listener> &listener) {
+					   const boost::shared_ptr<Listener> &listener,
+					   const WalletSnapshotPtr &snapshot) {
 
 			_wallet = ELAWalletNew(transactions.getRawPointerArray().data(), transactions.size(),
 								   *masterPubKey->getRaw(),
 								   WalletUnusedAddrs, BRWalletAllAddrs, setApplyFreeTx, WalletUpdateBalance,
 								   WalletContainsTx, WalletAddUsedAddrs, WalletCreateTxForOutputs,
 								   WalletMaxOutputAmount, WalletFeeForTx, TransactionIsSigned, KeyToAddress,
-								   BalanceAfterTx);
+								   BalanceAfterTx, snapshot);
+			_wallet->Raw.WalletAmountReceivedFromTx = WalletAmountReceivedFromTx;
+			_wallet->Raw.WalletAmountSentByTx = WalletAmountSentByTx;
 			assert(listener != nullptr);
 			_listener = boost::weak_ptr<Listener>(listener);
 
@@ -174,8 +228,6 @@ namespace Elastos {
 			for (Transactions::const_iterator it = transactions.cbegin(); it != transactions.cend(); ++it) {
 				(*it)->isRegistered() = true;
 			}
-
-			ELAWalletLoadRemarks(_wallet, transactions);
 		}
 
 		Wallet::~Wallet() {
@@ -186,7 +238,11 @@ namespace Elastos {
 		}
 
 		void Wallet::initListeningAddresses(const std::vector<std::string> &addrs) {
-			_wallet->ListeningAddrs = addrs;
+			std::vector<UInt168> programHashes = Utils::UInt168FromAddresses(addrs);
+
+			pthread_mutex_lock(&_wallet->Raw.lock);
+			_wallet->ListeningProgramHashes.swap(programHashes);
+			pthread_mutex_unlock(&_wallet->Raw.lock);
 		}
 
 		std::string Wallet::toString() const {
@@ -208,30 +264,45 @@ namespace Elastos {
 			return ELAWalletGetRemark(_wallet, txHash);
 		}
 
-		nlohmann::json Wallet::GetBalanceInfo() {
+		bool Wallet::WriteSnapshot(const UInt256 &lastBlockHash, const boost::filesystem::path &path) {
+			return WalletSnapshot::Write(_wallet, lastBlockHash, path);
+		}
 
-			size_t utxosCount = BRWalletUTXOs((BRWallet *) _wallet, nullptr, 0);
+		// balances of the addresses holding UTXOs, in address order
+		static std::map<std::string, uint64_t> addressBalances(ELAWallet *wallet) {
+			size_t utxosCount = BRWalletUTXOs((BRWallet *) wallet, nullptr, 0);
 			BRUTXO utxos[utxosCount];
-			BRWalletUTXOs((BRWallet *) _wallet, utxos, utxosCount);
-
-			nlohmann::json j;
+			BRWalletUTXOs((BRWallet *) wallet, utxos, utxosCount);
 
 			ELATransaction *t;
-			std::map<std::string, uint64_t> addressesBalanceMap;
-			pthread_mutex_lock(&_wallet->Raw.lock);
+			std::unordered_map<UInt168, uint64_t, ProgramHashHasher, ProgramHashEqual> programHashBalances;
+			pthread_mutex_lock(&wallet->Raw.lock);
 			for (size_t i = 0; i < utxosCount; ++i) {
-				void *tempPtr = BRSetGet(_wallet->Raw.allTx, &utxos[utxosCount].hash);
+				void *tempPtr = BRSetGet(wallet->Raw.allTx, &utxos[i].hash);
 				if (tempPtr == nullptr) continue;
 				t = static_cast<ELATransaction *>(tempPtr);
+				if (utxos[i].n >= t->outputs.size()) continue;
 
-				if (addressesBalanceMap.find(t->outputs[utxos->n]->getAddress()) != addressesBalanceMap.end()) {
-					addressesBalanceMap[t->outputs[utxos->n]->getAddress()] += t->outputs[utxos->n]->getAmount();
-				} else {
-					addressesBalanceMap[t->outputs[utxos->n]->getAddress()] = t->outputs[utxos->n]->getAmount();
-				}
+				programHashBalances[t->outputs[utxos[i].n]->getProgramHash()] += t->outputs[utxos[i].n]->getAmount();
 			}
-			pthread_mutex_unlock(&_wallet->Raw.lock);
+			pthread_mutex_unlock(&wallet->Raw.lock);
+
+			std::vector<UInt168> programHashes;
+			programHashes.reserve(programHashBalances.size());
+			for (auto it = programHashBalances.cbegin(); it != programHashBalances.cend(); ++it)
+				programHashes.push_back(it->first);
+			std::vector<std::string> addresses = Utils::UInt168ToAddresses(programHashes);
 
+			std::map<std::string, uint64_t> addressesBalanceMap;
+			for (size_t i = 0; i < programHashes.size(); ++i)
+				addressesBalanceMap[addresses[i]] = programHashBalances[programHashes[i]];
+			return addressesBalanceMap;
+		}
+
+		nlohmann::json Wallet::GetBalanceInfo() {
+			std::map<std::string, uint64_t> addressesBalanceMap = addressBalances(_wallet);
+
+			nlohmann::json j;
 			std::vector<nlohmann::json> balances;
 			std::for_each(addressesBalanceMap.begin(), addressesBalanceMap.end(),
 						  [&addressesBalanceMap, &balances](const std::map<std::string, uint64_t>::value_type &item) {
@@ -244,7 +315,26 @@ namespace Elastos {
 			return j;
 		}
 
+		std::string Wallet::GetBalanceInfoString() {
+			std::map<std::string, uint64_t> addressesBalanceMap = addressBalances(_wallet);
+
+			std::string result;
+			result.reserve(16 + addressesBalanceMap.size() * 64);
+			JsonWriter writer(result);
+			writer.BeginObject().Key("Balances").BeginArray();
+			for (auto it = addressesBalanceMap.cbegin(); it != addressesBalanceMap.cend(); ++it) {
+				// addresses are base58, nothing to escape
+				writer.BeginObject().Key(it->first.c_str()).UInt(it->second).EndObject();
+			}
+			writer.EndArray().EndObject();
+			return result;
+		}
+
 		uint64_t Wallet::GetBalanceWithAddress(const std::string &address) {
+			UInt168 programHash;
+			if (!Utils::UInt168FromAddress(programHash, address))
+				return 0;
+
 			size_t utxosCount = BRWalletUTXOs((BRWallet *) _wallet, nullptr, 0);
 			BRUTXO utxos[utxosCount];
 			BRWalletUTXOs((BRWallet *) _wallet, utxos, utxosCount);
@@ -256,7 +346,8 @@ namespace Elastos {
 				void *tempPtr = BRSetGet(_wallet->Raw.allTx, &utxos[i].hash);
 				if (tempPtr == nullptr) continue;
 				t = static_cast<ELATransaction *>(tempPtr);
-				if (BRAddressEq(t->outputs[utxos[i].n]->getRaw()->address, address.c_str())) {
+				if (utxos[i].n < t->outputs.size() &&
+					UInt168Eq(&t->outputs[utxos[i].n]->getProgramHash(), &programHash)) {
 					balance += t->outputs[utxos[i].n]->getAmount();
 				}
 			}
@@ -305,6 +396,38 @@ namespace Elastos {
 			return BRWalletBalance((BRWallet *) _wallet);
 		}
 
+		size_t Wallet::getMemoryUsage() const {
+			BRWallet *wallet = (BRWallet *) _wallet;
+			size_t bytes = sizeof(ELAWallet);
+
+			pthread_mutex_lock(&wallet->lock);
+			for (size_t i = 0; i < array_count(wallet->transactions); i++) {
+				const ELATransaction *tx = (const ELATransaction *) wallet->transactions[i];
+				bytes += sizeof(ELATransaction) + tx->raw.inCount * sizeof(BRTxInput) +
+						 tx->outputs.size() * (sizeof(TransactionOutput) + sizeof(BRTxOutput)) +
+						 tx->attributes.size() * sizeof(Attribute) + tx->programs.size() * sizeof(Program) +
+						 tx->Remark.size();
+			}
+			bytes += array_count(wallet->utxos) * sizeof(BRUTXO) +
+					 array_count(wallet->balanceHist) * sizeof(uint64_t) +
+					 array_count(wallet->externalChain) * sizeof(BRAddress);
+			if (wallet->internalChain != nullptr)
+				bytes += array_count(wallet->internalChain) * sizeof(BRAddress);
+			// set tables are kept at most three quarters full, with a control byte per bucket
+			bytes += (BRSetCount(wallet->allTx) + BRSetCount(wallet->invalidTx) + BRSetCount(wallet->pendingTx) +
+					  BRSetCount(wallet->spentOutputs)) * 4 / 3 * (sizeof(void *) + 1);
+			// a node and a bucket per program hash
+			bytes += (_wallet->UsedProgramHashes.size() + _wallet->AllProgramHashes.size()) *
+					 (sizeof(UInt168) + 3 * sizeof(void *)) +
+					 _wallet->ListeningProgramHashes.size() * sizeof(UInt168);
+			for (ELAWallet::TransactionRemarkMap::const_iterator it = _wallet->TxRemarkMap.cbegin();
+				 it != _wallet->TxRemarkMap.cend(); ++it)
+				bytes += it->first.size() + it->second.size();
+			pthread_mutex_unlock(&wallet->lock);
+
+			return bytes;
+		}
+
 		uint64_t Wallet::getTotalSent() {
 			return BRWalletTotalSent((BRWallet *) _wallet);
 		}
@@ -329,14 +452,14 @@ namespace Elastos {
 			return DEFAULT_FEE_PER_KB;
 		}
 
-		bool Wallet::AddressFilter(const std::string &fromAddress, const std::string &filterAddress) {
-			return filterAddress == fromAddress;
+		bool Wallet::AddressFilter(const UInt168 &fromProgramHash, const UInt168 &programHash) {
+			return UInt168Eq(&fromProgramHash, &programHash) != 0;
 		}
 
 		BRTransaction *Wallet::CreateTxForOutputs(BRWallet *wallet, const BRTxOutput outputs[], size_t outCount,
 												  uint64_t fee, const std::string &fromAddress,
-												  bool(*filter)(const std::string &fromAddress,
-																const std::string &addr)) {
+												  bool(*filter)(const UInt168 &fromProgramHash,
+																const UInt168 &programHash)) {
 			ELATransaction *tx, *transaction = ELATransactionNew();
 			uint64_t feeAmount, amount = 0, balance = 0, minAmount;
 			size_t i, j, cpfpSize = 0;
@@ -346,6 +469,12 @@ namespace Elastos {
 			assert(wallet != NULL);
 			assert(outputs != NULL && outCount > 0);
 
+			UInt168 fromProgramHash = UINT168_ZERO;
+			if (filter && !fromAddress.empty() && !Utils::UInt168FromAddress(fromProgramHash, fromAddress)) {
+				delete transaction;
+				throw std::logic_error("Invalid spender address: " + fromAddress);
+			}
+
 			for (i = 0; outputs && i < outCount; i++) {
 				assert(outputs[i].script != NULL && outputs[i].scriptLen > 0);
 				CMBlock script;
@@ -372,18 +501,17 @@ namespace Elastos {
 				o = &wallet->utxos[i];
 				tx = (ELATransaction *) BRSetGet(wallet->allTx, o);
 				if (!tx || o->n >= tx->outputs.size()) continue;
-				if (filter && !fromAddress.empty() && !filter(fromAddress, tx->outputs[o->n]->getAddress())) {
+				if (filter && !fromAddress.empty() && !filter(fromProgramHash, tx->outputs[o->n]->getProgramHash())) {
 					continue;
 				}
 
 				BRTransactionAddInput(&transaction->raw, tx->raw.txHash, o->n, tx->outputs[o->n]->getAmount(),
 									  tx->outputs[o->n]->getRaw()->script, tx->outputs[o->n]->getRaw()->scriptLen,
 									  nullptr, 0, TXIN_SEQUENCE);
-				std::string addr = Utils::UInt168ToAddress(tx->outputs[o->n]->getProgramHash());
 				size_t inCount = transaction->raw.inCount;
 				BRTxInput *input = &transaction->raw.inputs[inCount - 1];
 				memset(input->address, 0, sizeof(input->address));
-				strncpy(input->address, addr.c_str(), sizeof(input->address) - 1);
+				strncpy(input->address, tx->outputs[o->n]->getRaw()->address, sizeof(input->address) - 1);
 
 				if (ELATransactionSize(transaction) + TX_OUTPUT_SIZE >
 					TX_MAX_SIZE) { // transaction size-in-bytes too large
@@ -559,20 +687,24 @@ namespace Elastos {
 		}
 
 		bool Wallet::inputFromWallet(const BRTxInput *in) {
-			BRWallet *wallet = &_wallet->Raw;
-			for (size_t i = 0; i < array_count(wallet->transactions); i++) {
-				ELATransaction *tx = (ELATransaction *) wallet->transactions[i];
-				if (UInt256Eq(&in->txHash, &tx->raw.txHash)) {
-					if (containsAddress(tx->outputs[in->index]->getAddress())) {
-						return true;
-					}
-				}
-			}
+			bool r = false;
+
+			pthread_mutex_lock(&_wallet->Raw.lock);
+			ELATransaction *tx = (ELATransaction *) BRSetGet(_wallet->Raw.allTx, &in->txHash);
+			if (tx && in->index < tx->outputs.size())
+				r = _wallet->AllProgramHashes.count(tx->outputs[in->index]->getProgramHash()) != 0;
+			pthread_mutex_unlock(&_wallet->Raw.lock);
 
-			return false;
+			return r;
 		}
 
 		bool Wallet::registerTransaction(const TransactionPtr &transaction) {
+			TraceSpan span("wallet", "Wallet::registerTransaction");
+			if (span.IsRecording()) {
+				span.SetArg("wallet", _walletId);
+				span.SetArg("tx", Utils::UInt256ToString(transaction->getHash()));
+			}
+
 			return BRWalletRegisterTransaction((BRWallet *) _wallet, transaction->getRaw()) != 0;
 		}
 
@@ -618,13 +750,11 @@ namespace Elastos {
 		}
 
 		uint64_t Wallet::getTransactionAmountSent(const TransactionPtr &tx) {
-
-			return BRWalletAmountSentByTx((BRWallet *) _wallet, tx->getRaw());
+			return WalletAmountSentByTx((BRWallet *) _wallet, tx->getRaw());
 		}
 
 		uint64_t Wallet::getTransactionAmountReceived(const TransactionPtr &tx) {
-
-			return BRWalletAmountReceivedFromTx((BRWallet *) _wallet, tx->getRaw());
+			return WalletAmountReceivedFromTx((BRWallet *) _wallet, tx->getRaw());
 		}
 
 		uint64_t Wallet::getBalanceAfterTransaction(const TransactionPtr &transaction) {
@@ -634,20 +764,36 @@ namespace Elastos {
 
 		std::string Wallet::getTransactionAddress(const TransactionPtr &transaction) {
 
-			return getTransactionAmount(transaction) > 0
+			// the amount is negative when we sent
+			return (int64_t) getTransactionAmount(transaction) > 0
 				   ? getTransactionAddressInputs(transaction)   // we received -> from inputs
 				   : getTransactionAddressOutputs(transaction); // we sent     -> to outputs
 		}
 
 		std::string Wallet::getTransactionAddressInputs(const TransactionPtr &transaction) {
 
-			for (size_t i = 0; i < transaction->getRaw()->inCount; i++) {
+			const BRTransaction *raw = transaction->getRaw();
+			std::string address;
 
-				std::string address = transaction->getRaw()->inputs[i].address;
-				if (!containsAddress(address))
-					return address;
+			// the address of an input is the one of the output it spends, if that is known
+			pthread_mutex_lock(&_wallet->Raw.lock);
+			for (size_t i = 0; address.empty() && i < raw->inCount; i++) {
+				ELATransaction *t = (ELATransaction *) BRSetGet(_wallet->Raw.allTx, &raw->inputs[i].txHash);
+				uint32_t n = raw->inputs[i].index;
+				UInt168 programHash;
+
+				if (t && n < t->outputs.size()) {
+					if (!_wallet->AllProgramHashes.count(t->outputs[n]->getProgramHash()))
+						address = t->outputs[n]->getAddress();
+				} else if (raw->inputs[i].address[0] != '\0' &&
+						   (!Utils::UInt168FromAddress(programHash, raw->inputs[i].address) ||
+							!_wallet->AllProgramHashes.count(programHash))) {
+					address = raw->inputs[i].address;
+				}
 			}
-			return "";
+			pthread_mutex_unlock(&_wallet->Raw.lock);
+
+			return address;
 		}
 
 		std::string Wallet::getTransactionAddressOutputs(const TransactionPtr &transaction) {
@@ -696,13 +842,26 @@ namespace Elastos {
 		}
 
 		bool Wallet::containsAddress(const std::string &address) {
-
-			return BRWalletContainsAddress((BRWallet *) _wallet, address.c_str()) != 0;
+			UInt168 programHash;
+			return Utils::UInt168FromAddress(programHash, address) && containsProgramHash(programHash);
 		}
 
 		bool Wallet::addressIsUsed(const std::string &address) {
+			UInt168 programHash;
+			if (!Utils::UInt168FromAddress(programHash, address))
+				return false;
 
-			return BRWalletAddressIsUsed((BRWallet *) _wallet, address.c_str()) != 0;
+			pthread_mutex_lock(&_wallet->Raw.lock);
+			bool r = _wallet->UsedProgramHashes.count(programHash) != 0;
+			pthread_mutex_unlock(&_wallet->Raw.lock);
+			return r;
+		}
+
+		bool Wallet::containsProgramHash(const UInt168 &programHash) {
+			pthread_mutex_lock(&_wallet->Raw.lock);
+			bool r = _wallet->AllProgramHashes.count(programHash) != 0;
+			pthread_mutex_unlock(&_wallet->Raw.lock);
+			return r;
 		}
 
 		// maximum amount that can be sent from the wallet to a single address after fees
@@ -764,23 +923,61 @@ namespace Elastos {
 			return amount;
 		}
 
-		void Wallet::WalletUpdateBalance(BRWallet *wallet) {
+		// the Core versions look the addresses up in allAddrs, which is not allocated
+		uint64_t Wallet::WalletAmountReceivedFromTx(BRWallet *wallet, const BRTransaction *tx) {
+			uint64_t amount = 0;
+			const ELATransaction *txn = (const ELATransaction *) tx;
+			const ELAWallet *elaWallet = (const ELAWallet *) wallet;
+
+			pthread_mutex_lock(&wallet->lock);
+			for (size_t i = 0; txn && i < txn->outputs.size(); i++) {
+				if (elaWallet->AllProgramHashes.count(txn->outputs[i]->getProgramHash()))
+					amount += txn->outputs[i]->getAmount();
+			}
+			pthread_mutex_unlock(&wallet->lock);
+
+			return amount;
+		}
+
+		uint64_t Wallet::WalletAmountSentByTx(BRWallet *wallet, const BRTransaction *tx) {
+			uint64_t amount = 0;
+			const ELAWallet *elaWallet = (const ELAWallet *) wallet;
+
+			pthread_mutex_lock(&wallet->lock);
+			for (size_t i = 0; tx && i < tx->inCount; i++) {
+				ELATransaction *t = (ELATransaction *) BRSetGet(wallet->allTx, &tx->inputs[i].txHash);
+				uint32_t n = tx->inputs[i].index;
+
+				if (t && n < t->outputs.size() && elaWallet->AllProgramHashes.count(t->outputs[n]->getProgramHash()))
+					amount += t->outputs[n]->getAmount();
+			}
+			pthread_mutex_unlock(&wallet->lock);
+
+			return amount;
+		}
+
+		void ELAWalletUpdateBalance(BRWallet *wallet, size_t start) {
 			int isInvalid, isPending;
 			uint64_t balance = 0, prevBalance = 0;
 			time_t now = time(NULL);
 			size_t i, j;
 			ELATransaction *tx, *t;
+			ELAWallet *elaWallet = (ELAWallet *) wallet;
 
-			array_clear(wallet->utxos);
-			array_clear(wallet->balanceHist);
-			BRSetClear(wallet->spentOutputs);
-			BRSetClear(wallet->invalidTx);
-			BRSetClear(wallet->pendingTx);
-			BRSetClear(wallet->usedAddrs);
-			wallet->totalSent = 0;
-			wallet->totalReceived = 0;
+			if (start > 0) {
+				balance = prevBalance = wallet->balance;
+			} else {
+				array_clear(wallet->utxos);
+				array_clear(wallet->balanceHist);
+				BRSetClear(wallet->spentOutputs);
+				BRSetClear(wallet->invalidTx);
+				BRSetClear(wallet->pendingTx);
+				elaWallet->UsedProgramHashes.clear();
+				wallet->totalSent = 0;
+				wallet->totalReceived = 0;
+			}
 
-			for (i = 0; i < array_count(wallet->transactions); i++) {
+			for (i = start; i < array_count(wallet->transactions); i++) {
 				tx = (ELATransaction *) wallet->transactions[i];
 
 				// check if any inputs are invalid or already spent
@@ -836,10 +1033,11 @@ namespace Elastos {
 				// TODO: don't add coin generation outputs < 100 blocks deep
 				// NOTE: balance/UTXOs will then need to be recalculated when last block changes
 				for (j = 0; tx->raw.blockHeight != TX_UNCONFIRMED && j < tx->outputs.size(); j++) {
-					if (tx->outputs[j]->getRaw()->address[0] != '\0') {
-						BRSetAdd(wallet->usedAddrs, tx->outputs[j]->getRaw()->address);
+					const UInt168 &programHash = tx->outputs[j]->getProgramHash();
+					if (!UInt168IsZero(&programHash)) {
+						elaWallet->UsedProgramHashes.insert(programHash);
 
-						if (BRSetContains(wallet->allAddrs, tx->outputs[j]->getRaw()->address)) {
+						if (elaWallet->AllProgramHashes.count(programHash)) {
 							array_add(wallet->utxos, ((BRUTXO) {tx->raw.txHash, (uint32_t) j}));
 							balance += tx->outputs[j]->getAmount();
 						}
@@ -864,10 +1062,15 @@ namespace Elastos {
 			wallet->balance = balance;
 		}
 
+		void Wallet::WalletUpdateBalance(BRWallet *wallet) {
+			ELAWalletUpdateBalance(wallet, 0);
+		}
+
 		int Wallet::WalletContainsTx(BRWallet *wallet, const BRTransaction *tx) {
 			int r = 0;
 
 			const ELATransaction *txn = (const ELATransaction *) tx;
+			const ELAWallet *elaWallet = (const ELAWallet *) wallet;
 
 			if (!txn)
 				return r;
@@ -875,22 +1078,22 @@ namespace Elastos {
 			size_t outCount = txn->outputs.size();
 
 			for (size_t i = 0; !r && i < outCount; i++) {
-				if (BRSetContains(wallet->allAddrs, txn->outputs[i]->getRaw()->address)) r = 1;
+				if (elaWallet->AllProgramHashes.count(txn->outputs[i]->getProgramHash())) r = 1;
 			}
 
 			for (size_t i = 0; !r && i < txn->raw.inCount; i++) {
 				ELATransaction *t = (ELATransaction *) BRSetGet(wallet->allTx, &txn->raw.inputs[i].txHash);
 				uint32_t n = txn->raw.inputs[i].index;
 
-				if (t && n < outCount && BRSetContains(wallet->allAddrs, t->outputs[n]->getRaw()->address)) r = 1;
+				if (t && n < t->outputs.size() && elaWallet->AllProgramHashes.count(t->outputs[n]->getProgramHash()))
+					r = 1;
 			}
 
 			//for listening addresses
-			ELAWallet *elaWallet = (ELAWallet *)wallet;
-			for (size_t i = 0; i < outCount; ++i) {
-				if (std::find(elaWallet->ListeningAddrs.begin(), elaWallet->ListeningAddrs.end(),
-							  txn->outputs[i]->getRaw()->address) != elaWallet->ListeningAddrs.end())
-					r = 1;
+			for (size_t i = 0; !r && i < outCount; ++i) {
+				for (size_t j = 0; !r && j < elaWallet->ListeningProgramHashes.size(); ++j) {
+					if (UInt168Eq(&elaWallet->ListeningProgramHashes[j], &txn->outputs[i]->getProgramHash())) r = 1;
+				}
 			}
 
 			return r;
@@ -902,10 +1105,12 @@ namespace Elastos {
 			if (!txn)
 				return;
 
+			ELAWallet *elaWallet = (ELAWallet *) wallet;
 			size_t outCount = txn->outputs.size();
 			for (size_t j = 0; j < outCount; j++) {
-				if (txn->outputs[j]->getRaw()->address[0] != '\0')
-					BRSetAdd(wallet->usedAddrs, txn->outputs[j]->getRaw()->address);
+				const UInt168 &programHash = txn->outputs[j]->getProgramHash();
+				if (!UInt168IsZero(&programHash))
+					elaWallet->UsedProgramHashes.insert(programHash);
 			}
 		}
 
@@ -975,38 +1180,48 @@ namespace Elastos {
 			return _wallet->Raw.blockHeight;
 		}
 
+		void Wallet::setWalletId(const std::string &walletId) {
+			_walletId = walletId;
+		}
+
 		size_t Wallet::WalletUnusedAddrs(BRWallet *wallet, BRAddress addrs[], uint32_t gapLimit, int internal) {
-			BRAddress *addrChain, emptyAddress = BR_ADDRESS_NONE;
-			size_t i, j = 0, count, startCount;
+			ELAWallet *elaWallet = (ELAWallet *) wallet;
+			BRAddress *addrChain;
+			size_t i, j = 0, count;
 			uint32_t chain = (internal) ? SEQUENCE_INTERNAL_CHAIN : SEQUENCE_EXTERNAL_CHAIN;
 
 			assert(wallet != NULL);
 			assert(gapLimit > 0);
 			pthread_mutex_lock(&wallet->lock);
 			addrChain = (internal) ? wallet->internalChain : wallet->externalChain;
-			i = count = startCount = array_count(addrChain);
+			const std::vector<UInt168> &programHashes = (internal) ? elaWallet->InternalProgramHashes :
+														elaWallet->ExternalProgramHashes;
+			i = count = array_count(addrChain);
+			assert(programHashes.size() == count);
 
 			// keep only the trailing contiguous block of addresses with no transactions
-			while (i > 0 && !BRSetContains(wallet->usedAddrs, &addrChain[i - 1])) i--;
-
-			while (i + gapLimit > count) { // generate new addresses up to gapLimit
-				Key key;
-				BRAddress address = BR_ADDRESS_NONE;
+			while (i > 0 && !elaWallet->UsedProgramHashes.count(programHashes[i - 1])) i--;
 
-				uint8_t pubKey[MasterPubKey::BIP32PubKey(NULL, 0, wallet->masterPubKey, chain, count)];
-				size_t len = MasterPubKey::BIP32PubKey(pubKey, sizeof(pubKey), wallet->masterPubKey, chain, count);
+			PubKeyChainPtr &keyChain = (internal) ? elaWallet->InternalKeyChain : elaWallet->ExternalKeyChain;
+			if (keyChain == nullptr)
+				keyChain = PubKeyChainPtr(new PubKeyChain(wallet->masterPubKey, chain));
 
-				CMBlock publicKey(len);
-				memcpy(publicKey, pubKey, len);
-
-				if (!key.setPubKey(publicKey)) break;
-				if (!wallet->KeyToAddress(key.getRaw(), address.s, sizeof(BRAddress)) ||
-					BRAddressEq(&address, &emptyAddress))
-					break;
+			while (i + gapLimit > count) { // generate new addresses up to gapLimit
+				// the missing ones in one batch, using one of them moves i and asks for another batch
+				size_t wanted = i + gapLimit - count;
+				std::vector<std::string> addresses = keyChain->DeriveAddresses((uint32_t) count, wanted);
+
+				for (size_t k = 0; k < addresses.size() && i + gapLimit > count; ++k) {
+					BRAddress address = BR_ADDRESS_NONE;
+					strncpy(address.s, addresses[k].c_str(), sizeof(address.s) - 1);
+
+					array_add(addrChain, address);
+					ELAWalletIndexAddress(elaWallet, address, internal);
+					count++;
+					if (elaWallet->UsedProgramHashes.count(programHashes[count - 1])) i = count;
+				}
 
-				array_add(addrChain, address);
-				count++;
-				if (BRSetContains(wallet->usedAddrs, &address)) i = count;
+				if (addresses.size() < wanted) break;
 			}
 
 			if (addrs && i + gapLimit <= count) {
@@ -1015,24 +1230,9 @@ namespace Elastos {
 				}
 			}
 
-			// was addrChain moved to a new memory location?
-			if (addrChain == (internal ? wallet->internalChain : wallet->externalChain)) {
-				for (i = startCount; i < count; i++) {
-					BRSetAdd(wallet->allAddrs, &addrChain[i]);
-				}
-			} else {
-				if (internal) wallet->internalChain = addrChain;
-				if (!internal) wallet->externalChain = addrChain;
-				BRSetClear(wallet->allAddrs); // clear and rebuild allAddrs
-
-				for (i = array_count(wallet->internalChain); i > 0; i--) {
-					BRSetAdd(wallet->allAddrs, &wallet->internalChain[i - 1]);
-				}
-
-				for (i = array_count(wallet->externalChain); i > 0; i--) {
-					BRSetAdd(wallet->allAddrs, &wallet->externalChain[i - 1]);
-				}
-			}
+			// addrChain may have moved to a new memory location, the program hash index holds values
+			if (internal) wallet->internalChain = addrChain;
+			if (!internal) wallet->externalChain = addrChain;
 
 			pthread_mutex_unlock(&wallet->lock);
 			return j;
@@ -7,6 +7,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <BRWallet.h>
 #include <boost/weak_ptr.hpp>
 #include <boost/function.hpp>
@@ -23,17 +24,58 @@
 #include "WrapperList.h"
 #include "MasterPrivKey.h"
 #include "AddressCache.h"
+#include "PubKeyChain.h"
 
 namespace Elastos {
 	namespace ElaWallet {
 
+		class WalletSnapshot;
+
+		typedef boost::shared_ptr<WalletSnapshot> WalletSnapshotPtr;
+
+		struct ProgramHashHasher {
+			// program hashes are hash outputs, the bytes after the address prefix are evenly distributed already
+			size_t operator()(const UInt168 &programHash) const {
+				size_t h;
+				memcpy(&h, &programHash.u8[1], sizeof(h));
+				return h;
+			}
+		};
+
+		struct ProgramHashEqual {
+			bool operator()(const UInt168 &a, const UInt168 &b) const {
+				return UInt168Eq(&a, &b) != 0;
+			}
+		};
+
+		typedef std::unordered_set<UInt168, ProgramHashHasher, ProgramHashEqual> ProgramHashSet;
+
+		/**
+		 * Raw.usedAddrs and Raw.allAddrs are not allocated, addresses are indexed on their program hash instead and
+		 * only turned into Base58 at the API.
+		 */
 		struct ELAWallet {
 			BRWallet Raw;
 			typedef std::map<std::string, std::string> TransactionRemarkMap;
 			TransactionRemarkMap TxRemarkMap;
-			std::vector<std::string> ListeningAddrs;
+			std::vector<UInt168> ListeningProgramHashes;
+			// program hashes of the outputs of confirmed transactions
+			ProgramHashSet UsedProgramHashes;
+			// program hashes of Raw.internalChain and Raw.externalChain, in the same order
+			std::vector<UInt168> InternalProgramHashes;
+			std::vector<UInt168> ExternalProgramHashes;
+			ProgramHashSet AllProgramHashes;
+			// chain nodes of masterPubKey, created by the first WalletUnusedAddrs() of each chain
+			PubKeyChainPtr InternalKeyChain;
+			PubKeyChainPtr ExternalKeyChain;
 		};
 
+		// allocates a wallet with Raw zeroed, freed by ELAWalletFree()
+		ELAWallet *ELAWalletAlloc();
+
+		// indexes an address just added to the internal or external chain
+		void ELAWalletIndexAddress(ELAWallet *wallet, const BRAddress &address, int internal);
+
 		ELAWallet *ELAWalletNew(BRTransaction *transactions[], size_t txCount, BRMasterPubKey mpk,
 								size_t (*WalletUnusedAddrs)(BRWallet *wallet, BRAddress addrs[], uint32_t gapLimit,
 															int internal),
@@ -49,7 +91,8 @@ namespace Elastos {
 								uint64_t (*WalletFeeForTx)(BRWallet *wallet, const BRTransaction *tx),
 								int (*TransactionIsSigned)(const BRTransaction *tx),
 								size_t (*KeyToAddress)(const BRKey *key, char *addr, size_t addrLen),
-								uint64_t (*balanceAfterTx)(BRWallet *wallet, const BRTransaction *tx));
+								uint64_t (*balanceAfterTx)(BRWallet *wallet, const BRTransaction *tx),
+								const WalletSnapshotPtr &snapshot = WalletSnapshotPtr());
 
 		void ELAWalletFree(ELAWallet *wallet, bool freeInternal = true);
 
@@ -58,8 +101,17 @@ namespace Elastos {
 		void ELAWalletRegisterRemark(ELAWallet *wallet, const std::string &txHash,
 												   const std::string &remark);
 
-		void ELAWalletLoadRemarks(ELAWallet *wallet,
-												const SharedWrapperList<Transaction, BRTransaction *> &transaction);
+		/**
+		 * Adds the signed transactions to a new wallet, derives its addresses and computes its balance and remarks.
+		 * With a snapshot that matches the transactions, its state is restored instead and only the transactions
+		 * not in it are replayed.
+		 */
+		void ELAWalletLoadTransactions(ELAWallet *wallet, BRTransaction *transactions[], size_t txCount,
+									   const WalletSnapshotPtr &snapshot);
+
+		// recomputes balance, UTXOs and balance history from the start-th transaction on, start > 0 resumes from
+		// the state left by the previous transactions
+		void ELAWalletUpdateBalance(BRWallet *wallet, size_t start);
 
 		class Wallet :
 				public Wrapper<BRWallet> {
@@ -84,7 +136,8 @@ namespace Elastos {
 
 			Wallet(const SharedWrapperList<Transaction, BRTransaction *> &transactions,
 				   const MasterPubKeyPtr &masterPubKey,
-				   const boost::shared_ptr<Listener> &listener);
+				   const boost::shared_ptr<Listener> &listener,
+				   const WalletSnapshotPtr &snapshot = WalletSnapshotPtr());
 
 			virtual ~Wallet();
 
@@ -96,12 +149,21 @@ namespace Elastos {
 
 			uint32_t getBlockHeight() const;
 
+			// tags the trace spans of the wallet, see DatabaseManager::getWalletId()
+			void setWalletId(const std::string &walletId);
+
 			nlohmann::json GetBalanceInfo();
 
+			// GetBalanceInfo().dump() written without building the document
+			std::string GetBalanceInfoString();
+
 			void RegisterRemark(const TransactionPtr &transaction);
 
 			std::string GetRemark(const std::string &txHash);
 
+			// saves the derived state for the next start, see WalletSnapshot
+			bool WriteSnapshot(const UInt256 &lastBlockHash, const boost::filesystem::path &path);
+
 			uint64_t GetBalanceWithAddress(const std::string &address);
 
 			// returns the first unused external address
@@ -119,12 +181,17 @@ namespace Elastos {
 			// int BRWalletAddressIsUsed(BRWallet *wallet, const char *addr);
 			bool addressIsUsed(const std::string &address);
 
+			bool containsProgramHash(const UInt168 &programHash);
+
 			SharedWrapperList<Transaction, BRTransaction *> getTransactions() const;
 
 			SharedWrapperList<Transaction, BRTransaction *> getTransactionsConfirmedBefore(uint32_t blockHeight) const;
 
 			uint64_t getBalance() const;
 
+			// approximate bytes held by the transactions, addresses and indexes of the wallet
+			size_t getMemoryUsage() const;
+
 			uint64_t getTotalSent();
 
 			uint64_t getTotalReceived();
@@ -232,12 +299,12 @@ namespace Elastos {
 		protected:
 			Wallet();
 
-			static bool AddressFilter(const std::string &fromAddress, const std::string &filterAddress);
+			static bool AddressFilter(const UInt168 &fromProgramHash, const UInt168 &programHash);
 
 			static BRTransaction *CreateTxForOutputs(BRWallet *wallet, const BRTxOutput outputs[], size_t outCount,
 													 uint64_t fee, const std::string &fromAddress,
-													 bool(*filter)(const std::string &fromAddress,
-																   const std::string &addr));
+													 bool(*filter)(const UInt168 &fromProgramHash,
+																   const UInt168 &programHash));
 
 			static BRTransaction *
 			WalletCreateTxForOutputs(BRWallet *wallet, const BRTxOutput outputs[], size_t outCount);
@@ -248,6 +315,10 @@ namespace Elastos {
 
 			static uint64_t WalletFeeForTx(BRWallet *wallet, const BRTransaction *tx);
 
+			static uint64_t WalletAmountReceivedFromTx(BRWallet *wallet, const BRTransaction *tx);
+
+			static uint64_t WalletAmountSentByTx(BRWallet *wallet, const BRTransaction *tx);
+
 			static void WalletUpdateBalance(BRWallet *wallet);
 
 			static int WalletContainsTx(BRWallet *wallet, const BRTransaction *tx);
@@ -277,6 +348,8 @@ namespace Elastos {
 			ELAWallet *_wallet;
 
 			boost::weak_ptr<Listener> _listener;
+
+			std::string _walletId;
 		};
 
 		typedef boost::shared_ptr<Wallet> WalletPtr;
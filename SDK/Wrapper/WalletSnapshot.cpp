@@ -0,0 +1,304 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <string.h>
+#include <boost/filesystem/fstream.hpp>
+
+#include "BRArray.h"
+#include "BRCrypto.h"
+
+#include "WalletSnapshot.h"
+#include "ByteStream.h"
+#include "Log.h"
+#include "ELACoreExt/ELATransaction.h"
+
+#define WALLET_SNAPSHOT_MAGIC 0x53575345 // "ESWS"
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		namespace {
+			void writeChain(ByteStream &stream, const BRAddress *chain) {
+				size_t count = chain ? array_count(chain) : 0;
+				stream.writeVarUint(count);
+				for (size_t i = 0; i < count; i++)
+					stream.writeVarString(chain[i].s);
+			}
+
+			bool readChain(ByteStream &stream, std::vector<BRAddress> &chain) {
+				uint64_t count;
+				if (!stream.readVarUint(count) || count > stream.availableSize()) return false;
+				chain.resize((size_t) count);
+				for (size_t i = 0; i < chain.size(); i++) {
+					if (!stream.readVarString(chain[i].s, sizeof(chain[i].s))) return false;
+				}
+				return true;
+			}
+		}
+
+		WalletSnapshot::WalletSnapshot() :
+				_hasInternalChain(false),
+				_lastBlockHash(UINT256_ZERO),
+				_blockHeight(0),
+				_balance(0),
+				_totalSent(0),
+				_totalReceived(0) {
+			memset(&_masterPubKey, 0, sizeof(_masterPubKey));
+		}
+
+		bool WalletSnapshot::Write(ELAWallet *wallet, const UInt256 &lastBlockHash,
+								   const boost::filesystem::path &path) {
+			BRWallet *raw = &wallet->Raw;
+			ByteStream stream;
+
+			stream.writeUint32(WALLET_SNAPSHOT_MAGIC);
+			stream.writeUint32(WALLET_SNAPSHOT_VERSION);
+
+			pthread_mutex_lock(&raw->lock);
+			stream.writeUint32(raw->masterPubKey.fingerPrint);
+			stream.writeBytes(raw->masterPubKey.chainCode.u8, sizeof(UInt256));
+			stream.writeBytes(raw->masterPubKey.pubKey, sizeof(raw->masterPubKey.pubKey));
+			stream.writeUint8(raw->internalChain != nullptr ? 1 : 0);
+			stream.writeBytes(lastBlockHash.u8, sizeof(UInt256));
+			stream.writeUint32(raw->blockHeight);
+			stream.writeUint64(raw->balance);
+			stream.writeUint64(raw->totalSent);
+			stream.writeUint64(raw->totalReceived);
+
+			size_t txCount = array_count(raw->transactions);
+			stream.writeVarUint(txCount);
+			for (size_t i = 0; i < txCount; i++) {
+				BRTransaction *tx = raw->transactions[i];
+				uint8_t flags = 0;
+				if (BRSetContains(raw->invalidTx, tx)) flags |= Invalid;
+				if (BRSetContains(raw->pendingTx, tx)) flags |= Pending;
+				stream.writeBytes(tx->txHash.u8, sizeof(UInt256));
+				stream.writeUint32(tx->blockHeight);
+				stream.writeUint8(flags);
+			}
+
+			stream.writeVarUint(array_count(raw->utxos));
+			for (size_t i = 0; i < array_count(raw->utxos); i++) {
+				stream.writeBytes(raw->utxos[i].hash.u8, sizeof(UInt256));
+				stream.writeUint32(raw->utxos[i].n);
+			}
+
+			// one entry per transaction
+			for (size_t i = 0; i < array_count(raw->balanceHist); i++)
+				stream.writeUint64(raw->balanceHist[i]);
+
+			writeChain(stream, raw->internalChain);
+			writeChain(stream, raw->externalChain);
+
+			stream.writeVarUint(wallet->TxRemarkMap.size());
+			for (ELAWallet::TransactionRemarkMap::const_iterator it = wallet->TxRemarkMap.cbegin();
+				 it != wallet->TxRemarkMap.cend(); ++it) {
+				stream.writeVarString(it->first);
+				stream.writeVarString(it->second);
+			}
+			pthread_mutex_unlock(&raw->lock);
+
+			CMBlock content = stream.getBuffer();
+			UInt256 checksum;
+			BRSHA256(&checksum, content, content.GetSize());
+
+			boost::filesystem::path temp = path;
+			temp += ".tmp";
+			{
+				boost::filesystem::ofstream out(temp, std::ios::out | std::ios::binary | std::ios::trunc);
+				if (!out) {
+					Log::getLogger(Log::Wallet)->error("Can not write wallet snapshot to {}", temp.string());
+					return false;
+				}
+				out.write((const char *) (const void *) content, content.GetSize());
+				out.write((const char *) checksum.u8, sizeof(checksum));
+				if (!out.flush()) {
+					Log::getLogger(Log::Wallet)->error("Can not write wallet snapshot to {}", temp.string());
+					return false;
+				}
+			}
+
+			boost::system::error_code ec;
+			boost::filesystem::rename(temp, path, ec);
+			if (ec) {
+				Log::getLogger(Log::Wallet)->error("Can not move wallet snapshot to {}: {}", path.string(),
+												   ec.message());
+				return false;
+			}
+			return true;
+		}
+
+		WalletSnapshotPtr WalletSnapshot::Read(const boost::filesystem::path &path) {
+			boost::system::error_code ec;
+			if (!boost::filesystem::exists(path, ec))
+				return WalletSnapshotPtr();
+
+			uintmax_t size = boost::filesystem::file_size(path, ec);
+			if (ec || size < 2 * sizeof(uint32_t) + sizeof(UInt256)) {
+				Log::getLogger(Log::Wallet)->warn("Ignore truncated wallet snapshot {}", path.string());
+				return WalletSnapshotPtr();
+			}
+
+			CMBlock data((size_t) size);
+			{
+				boost::filesystem::ifstream in(path, std::ios::in | std::ios::binary);
+				if (!in.read((char *) (void *) data, data.GetSize())) {
+					Log::getLogger(Log::Wallet)->warn("Can not read wallet snapshot {}", path.string());
+					return WalletSnapshotPtr();
+				}
+			}
+
+			size_t contentSize = data.GetSize() - sizeof(UInt256);
+			UInt256 checksum;
+			BRSHA256(&checksum, data, contentSize);
+			if (memcmp(checksum.u8, &data[contentSize], sizeof(UInt256)) != 0) {
+				Log::getLogger(Log::Wallet)->warn("Ignore damaged wallet snapshot {}", path.string());
+				return WalletSnapshotPtr();
+			}
+
+			ByteStream stream(data, contentSize, false);
+			uint32_t magic = 0, version = 0;
+			if (!stream.readUint32(magic) || !stream.readUint32(version) || magic != WALLET_SNAPSHOT_MAGIC ||
+				version != WALLET_SNAPSHOT_VERSION) {
+				Log::getLogger(Log::Wallet)->info("Ignore wallet snapshot {} of version {}", path.string(), version);
+				return WalletSnapshotPtr();
+			}
+
+			WalletSnapshotPtr snapshot(new WalletSnapshot());
+			uint8_t hasInternalChain = 0;
+			uint64_t count = 0;
+			bool ok = stream.readUint32(snapshot->_masterPubKey.fingerPrint) &&
+					  stream.readBytes(snapshot->_masterPubKey.chainCode.u8, sizeof(UInt256)) &&
+					  stream.readBytes(snapshot->_masterPubKey.pubKey, sizeof(snapshot->_masterPubKey.pubKey)) &&
+					  stream.readUint8(hasInternalChain) &&
+					  stream.readBytes(snapshot->_lastBlockHash.u8, sizeof(UInt256)) &&
+					  stream.readUint32(snapshot->_blockHeight) &&
+					  stream.readUint64(snapshot->_balance) &&
+					  stream.readUint64(snapshot->_totalSent) &&
+					  stream.readUint64(snapshot->_totalReceived) &&
+					  stream.readVarUint(count) && count <= stream.availableSize();
+			snapshot->_hasInternalChain = hasInternalChain != 0;
+
+			snapshot->_transactions.resize(ok ? (size_t) count : 0);
+			for (size_t i = 0; ok && i < snapshot->_transactions.size(); i++) {
+				TransactionState &state = snapshot->_transactions[i];
+				ok = stream.readBytes(state.Hash.u8, sizeof(UInt256)) && stream.readUint32(state.BlockHeight) &&
+					 stream.readUint8(state.Flags);
+			}
+
+			ok = ok && stream.readVarUint(count) && count <= stream.availableSize();
+			snapshot->_utxos.resize(ok ? (size_t) count : 0);
+			for (size_t i = 0; ok && i < snapshot->_utxos.size(); i++) {
+				ok = stream.readBytes(snapshot->_utxos[i].hash.u8, sizeof(UInt256)) &&
+					 stream.readUint32(snapshot->_utxos[i].n);
+			}
+
+			snapshot->_balanceHist.resize(ok ? snapshot->_transactions.size() : 0);
+			for (size_t i = 0; ok && i < snapshot->_balanceHist.size(); i++)
+				ok = stream.readUint64(snapshot->_balanceHist[i]);
+
+			ok = ok && readChain(stream, snapshot->_internalChain) && readChain(stream, snapshot->_externalChain) &&
+				 stream.readVarUint(count) && count <= stream.availableSize();
+			for (size_t i = 0; ok && i < count; i++) {
+				std::string hash, remark;
+				ok = stream.readVarString(hash) && stream.readVarString(remark);
+				snapshot->_remarks[hash] = remark;
+			}
+
+			if (!ok) {
+				Log::getLogger(Log::Wallet)->warn("Ignore malformed wallet snapshot {}", path.string());
+				return WalletSnapshotPtr();
+			}
+			return snapshot;
+		}
+
+		const UInt256 &WalletSnapshot::GetLastBlockHash() const {
+			return _lastBlockHash;
+		}
+
+		uint32_t WalletSnapshot::GetBlockHeight() const {
+			return _blockHeight;
+		}
+
+		size_t WalletSnapshot::GetTransactionCount() const {
+			return _transactions.size();
+		}
+
+		bool WalletSnapshot::Restore(ELAWallet *wallet) const {
+			BRWallet *raw = &wallet->Raw;
+
+			if (raw->masterPubKey.fingerPrint != _masterPubKey.fingerPrint ||
+				!UInt256Eq(&raw->masterPubKey.chainCode, &_masterPubKey.chainCode) ||
+				memcmp(raw->masterPubKey.pubKey, _masterPubKey.pubKey, sizeof(_masterPubKey.pubKey)) != 0 ||
+				(raw->internalChain != nullptr) != _hasInternalChain) {
+				Log::getLogger(Log::Wallet)->warn("Ignore wallet snapshot of another master public key");
+				return false;
+			}
+
+			if (array_count(raw->transactions) != 0 || BRSetCount(raw->allTx) < _transactions.size() ||
+				(raw->internalChain && array_count(raw->internalChain) != 0) || array_count(raw->externalChain) != 0)
+				return false;
+
+			std::vector<BRTransaction *> transactions(_transactions.size());
+			for (size_t i = 0; i < _transactions.size(); i++) {
+				transactions[i] = (BRTransaction *) BRSetGet(raw->allTx, &_transactions[i].Hash);
+				if (transactions[i] == nullptr || transactions[i]->blockHeight != _transactions[i].BlockHeight) {
+					Log::getLogger(Log::Wallet)->info("Ignore outdated wallet snapshot");
+					return false;
+				}
+			}
+
+			for (size_t i = 0; i < _utxos.size(); i++) {
+				const ELATransaction *tx = (const ELATransaction *) BRSetGet(raw->allTx, &_utxos[i].hash);
+				if (tx == nullptr || _utxos[i].n >= tx->outputs.size()) {
+					Log::getLogger(Log::Wallet)->info("Ignore outdated wallet snapshot");
+					return false;
+				}
+			}
+
+			for (size_t i = 0; i < transactions.size(); i++) {
+				BRTransaction *tx = transactions[i];
+				array_add(raw->transactions, tx);
+
+				if (_transactions[i].Flags & Invalid) {
+					BRSetAdd(raw->invalidTx, tx);
+					continue;
+				}
+
+				for (size_t j = 0; j < tx->inCount; j++)
+					BRSetAdd(raw->spentOutputs, &tx->inputs[j]);
+				if (_transactions[i].Flags & Pending) BRSetAdd(raw->pendingTx, tx);
+
+				const ELATransaction *elaTx = (const ELATransaction *) tx;
+				for (size_t j = 0; tx->blockHeight != TX_UNCONFIRMED && j < elaTx->outputs.size(); j++) {
+					const UInt168 &programHash = elaTx->outputs[j]->getProgramHash();
+					if (!UInt168IsZero(&programHash))
+						wallet->UsedProgramHashes.insert(programHash);
+				}
+			}
+
+			array_add_array(raw->utxos, _utxos.data(), _utxos.size());
+			array_add_array(raw->balanceHist, _balanceHist.data(), _balanceHist.size());
+			raw->balance = _balance;
+			raw->totalSent = _totalSent;
+			raw->totalReceived = _totalReceived;
+
+			if (raw->internalChain != nullptr) {
+				array_add_array(raw->internalChain, _internalChain.data(), _internalChain.size());
+				for (size_t i = 0; i < _internalChain.size(); i++)
+					ELAWalletIndexAddress(wallet, _internalChain[i], 1);
+			}
+			array_add_array(raw->externalChain, _externalChain.data(), _externalChain.size());
+			for (size_t i = 0; i < _externalChain.size(); i++)
+				ELAWalletIndexAddress(wallet, _externalChain[i], 0);
+
+			wallet->TxRemarkMap = _remarks;
+
+			Log::getLogger(Log::Wallet)->info("Restored wallet snapshot of {} transactions at height {}",
+											  _transactions.size(), _blockHeight);
+			return true;
+		}
+
+	}
+}
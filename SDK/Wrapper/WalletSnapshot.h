@@ -0,0 +1,79 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef __ELASTOS_SDK_WALLETSNAPSHOT_H__
+#define __ELASTOS_SDK_WALLETSNAPSHOT_H__
+
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Wallet.h"
+
+#define WALLET_SNAPSHOT_VERSION 1
+
+namespace Elastos {
+	namespace ElaWallet {
+
+		/**
+		 * State a wallet derives from its transactions: transaction order, invalid and pending flags, UTXOs,
+		 * balances, balance history, address chains and remarks. Opening a wallet with a snapshot skips sorting the
+		 * transactions, deriving the addresses and replaying the balance; only transactions newer than the snapshot
+		 * are replayed. The file is versioned and checksummed, a snapshot that does not match the stored
+		 * transactions is ignored and the wallet is rebuilt as before.
+		 */
+		class WalletSnapshot {
+		public:
+			WalletSnapshot();
+
+			// writes the state of wallet, up to date with block lastBlockHash, replacing path atomically
+			static bool Write(ELAWallet *wallet, const UInt256 &lastBlockHash, const boost::filesystem::path &path);
+
+			// returns nullptr when there is no snapshot, or it is damaged or of another version
+			static WalletSnapshotPtr Read(const boost::filesystem::path &path);
+
+			const UInt256 &GetLastBlockHash() const;
+
+			uint32_t GetBlockHeight() const;
+
+			size_t GetTransactionCount() const;
+
+			/**
+			 * Restores the state into a new wallet, whose allTx holds the loaded transactions and nothing else is
+			 * set yet. Returns false and leaves the wallet untouched when the snapshot was taken for another
+			 * master public key or any of its transactions is missing or was updated since.
+			 */
+			bool Restore(ELAWallet *wallet) const;
+
+		private:
+			enum TransactionFlags {
+				Invalid = 1,
+				Pending = 2
+			};
+
+			struct TransactionState {
+				UInt256 Hash;
+				uint32_t BlockHeight;
+				uint8_t Flags;
+			};
+
+			BRMasterPubKey _masterPubKey;
+			bool _hasInternalChain;
+			UInt256 _lastBlockHash;
+			uint32_t _blockHeight;
+			uint64_t _balance;
+			uint64_t _totalSent;
+			uint64_t _totalReceived;
+			std::vector<TransactionState> _transactions;
+			std::vector<BRUTXO> _utxos;
+			std::vector<uint64_t> _balanceHist;
+			std::vector<BRAddress> _internalChain;
+			std::vector<BRAddress> _externalChain;
+			ELAWallet::TransactionRemarkMap _remarks;
+		};
+
+	}
+}
+
+#endif //__ELASTOS_SDK_WALLETSNAPSHOT_H__
@@ -8,6 +8,7 @@
 #include <catch.hpp>
 
 #include "AddressRegisteringWallet.h"
+#include "Utils.h"
 
 using namespace Elastos::ElaWallet;
 
@@ -85,4 +86,21 @@ TEST_CASE("Basic test for register address", "[AddressRegisteringWallet]") {
 
 		REQUIRE(wallet->getAllAddresses().size() == DefaultAddress.size());
 	}
+	SECTION("Contains registered addresses by program hash") {
+		std::vector<std::string> initialAddrs(DefaultAddress.cbegin(), DefaultAddress.cbegin() + 5);
+		boost::scoped_ptr<AddressRegisteringWallet> wallet(new AddressRegisteringWallet(
+				listener, initialAddrs));
+
+		REQUIRE(wallet->containsAddress(DefaultAddress[0]));
+		REQUIRE_FALSE(wallet->containsAddress(DefaultAddress[5]));
+		REQUIRE_FALSE(wallet->containsAddress("not an address"));
+
+		wallet->RegisterAddress(DefaultAddress[5]);
+		REQUIRE(wallet->containsAddress(DefaultAddress[5]));
+
+		UInt168 programHash;
+		REQUIRE(Utils::UInt168FromAddress(programHash, DefaultAddress[4]));
+		REQUIRE(wallet->containsProgramHash(programHash));
+		REQUIRE_FALSE(wallet->addressIsUsed(DefaultAddress[4]));
+	}
 }
\ No newline at end of file
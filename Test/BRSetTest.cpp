@@ -0,0 +1,129 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <vector>
+#include <catch.hpp>
+
+#include "BRSet.h"
+#include "BRWallet.h"
+
+static UInt256 randomHash() {
+	UInt256 u;
+	for (size_t i = 0; i < sizeof(u.u32) / sizeof(u.u32[0]); ++i)
+		u.u32[i] = (uint32_t) rand();
+	return u;
+}
+
+static void collect(void *info, void *item) {
+	((std::vector<void *> *) info)->push_back(item);
+}
+
+TEST_CASE("BRSet keyed by UInt256", "[BRSet]") {
+	srand(20180901);
+	std::vector<UInt256> hashes(5000);
+	for (size_t i = 0; i < hashes.size(); ++i)
+		hashes[i] = randomHash();
+
+	BRSet *set = BRSetNewUInt256(10);
+
+	SECTION("add, get and replace") {
+		for (size_t i = 0; i < hashes.size(); ++i)
+			REQUIRE(BRSetAdd(set, &hashes[i]) == nullptr);
+		REQUIRE(BRSetCount(set) == hashes.size());
+
+		for (size_t i = 0; i < hashes.size(); ++i) {
+			UInt256 copy = hashes[i];
+			REQUIRE(BRSetGet(set, &copy) == &hashes[i]);
+			REQUIRE(BRSetAdd(set, &copy) == &hashes[i]);
+			REQUIRE(BRSetGet(set, &hashes[i]) == &copy);
+			REQUIRE(BRSetAdd(set, &hashes[i]) == &copy);
+		}
+		REQUIRE(BRSetCount(set) == hashes.size());
+
+		UInt256 missing = randomHash();
+		REQUIRE(!BRSetContains(set, &missing));
+	}
+
+	SECTION("remove keeps the other items reachable") {
+		for (size_t i = 0; i < hashes.size(); ++i)
+			BRSetAdd(set, &hashes[i]);
+
+		for (size_t i = 0; i < hashes.size(); i += 2)
+			REQUIRE(BRSetRemove(set, &hashes[i]) == &hashes[i]);
+		REQUIRE(BRSetRemove(set, &hashes[0]) == nullptr);
+		REQUIRE(BRSetCount(set) == hashes.size() / 2);
+
+		for (size_t i = 0; i < hashes.size(); ++i)
+			REQUIRE(BRSetContains(set, &hashes[i]) == (i % 2 == 1));
+	}
+
+	SECTION("iterate, apply and clear") {
+		for (size_t i = 0; i < hashes.size(); ++i)
+			BRSetAdd(set, &hashes[i]);
+
+		size_t iterated = 0;
+		for (void *item = BRSetIterate(set, nullptr); item; item = BRSetIterate(set, item))
+			iterated++;
+		REQUIRE(iterated == hashes.size());
+
+		std::vector<void *> applied;
+		BRSetApply(set, &applied, collect);
+		REQUIRE(applied.size() == hashes.size());
+
+		BRSetClear(set);
+		REQUIRE(BRSetCount(set) == 0);
+		REQUIRE(!BRSetContains(set, &hashes[0]));
+		REQUIRE(BRSetIterate(set, nullptr) == nullptr);
+	}
+
+	SECTION("set operations") {
+		BRSet *other = BRSetNewUInt256(10);
+		for (size_t i = 0; i < hashes.size(); ++i)
+			BRSetAdd(i < 3000 ? set : other, &hashes[i]);
+		BRSetAdd(other, &hashes[0]);
+
+		REQUIRE(BRSetIntersects(set, other));
+		BRSetUnion(set, other);
+		REQUIRE(BRSetCount(set) == hashes.size());
+		BRSetMinus(set, other);
+		REQUIRE(BRSetCount(set) == 2999);
+		BRSetAdd(set, &hashes[4000]);
+		BRSetIntersect(set, other);
+		REQUIRE(BRSetCount(set) == 1);
+		REQUIRE(BRSetGet(set, &hashes[4000]) == &hashes[4000]);
+
+		BRSetFree(other);
+	}
+
+	BRSetFree(set);
+}
+
+TEST_CASE("BRSet keyed by output", "[BRSet]") {
+	srand(20180902);
+	std::vector<BRUTXO> outputs(4000);
+	for (size_t i = 0; i < outputs.size(); ++i) {
+		outputs[i].hash = i % 4 == 0 ? randomHash() : outputs[i - 1].hash;
+		outputs[i].n = (uint32_t) (i % 4);
+	}
+
+	BRSet *set = BRSetNewUTXO(0);
+	for (size_t i = 0; i < outputs.size(); ++i)
+		REQUIRE(BRSetAdd(set, &outputs[i]) == nullptr);
+	REQUIRE(BRSetCount(set) == outputs.size());
+
+	BRUTXO other = outputs[5];
+	other.n = 7;
+	REQUIRE(!BRSetContains(set, &other));
+	other.n = outputs[5].n;
+	REQUIRE(BRSetGet(set, &other) == &outputs[5]);
+
+	for (size_t i = 0; i < outputs.size(); i += 4)
+		REQUIRE(BRSetRemove(set, &outputs[i]) == &outputs[i]);
+	for (size_t i = 0; i < outputs.size(); ++i)
+		REQUIRE(BRSetContains(set, &outputs[i]) == (i % 4 != 0));
+
+	BRSetFree(set);
+}
@@ -7,10 +7,69 @@
 #include <fstream>
 #include <catch.hpp>
 
+#include "BRBase58.h"
+
 #include "BTCBase58.h"
+#include "Utils.h"
 
 using namespace Elastos::ElaWallet;
 
+static const char *base58Chars = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+// the digit by digit conversions BRBase58 used before, as reference: no leading '1's are written for zero bytes
+static std::string referenceEncode(const std::vector<uint8_t> &data) {
+	size_t zcount = 0;
+	while (zcount < data.size() && data[zcount] == 0) zcount++;
+
+	std::vector<uint8_t> buf((data.size() - zcount) * 138 / 100 + 1);
+	for (size_t i = zcount; i < data.size(); i++) {
+		uint32_t carry = data[i];
+		for (size_t j = buf.size(); j > 0; j--) {
+			carry += (uint32_t) buf[j - 1] << 8;
+			buf[j - 1] = carry % 58;
+			carry /= 58;
+		}
+	}
+
+	size_t i = 0;
+	while (i < buf.size() && buf[i] == 0) i++;
+	std::string str;
+	while (i < buf.size()) str += base58Chars[buf[i++]];
+	return str;
+}
+
+static std::vector<uint8_t> referenceDecode(const std::string &str) {
+	size_t zcount = 0, pos = 0;
+	while (pos < str.size() && str[pos] == '1') pos++, zcount++;
+
+	std::vector<uint8_t> buf((str.size() - pos) * 733 / 1000 + 1);
+	for (; pos < str.size(); pos++) {
+		const char *digit = strchr(base58Chars, str[pos]);
+		if (str[pos] == '\0' || digit == NULL) break;
+		uint32_t carry = (uint32_t) (digit - base58Chars);
+		for (size_t j = buf.size(); j > 0; j--) {
+			carry += (uint32_t) buf[j - 1] * 58;
+			buf[j - 1] = carry & 0xff;
+			carry >>= 8;
+		}
+	}
+
+	size_t i = 0;
+	while (i < buf.size() && buf[i] == 0) i++;
+	std::vector<uint8_t> data(zcount, 0);
+	data.insert(data.end(), buf.begin() + i, buf.end());
+	return data;
+}
+
+static std::vector<uint8_t> randomBytes(size_t maxSize) {
+	std::vector<uint8_t> data((size_t) rand() % maxSize + 1);
+	// mostly small bytes and leading zeroes now and then, to hit the carries and zero handling
+	uint32_t range = rand() % 2 ? 256 : 3;
+	for (size_t i = 0; i < data.size(); ++i)
+		data[i] = (uint8_t) (rand() % range);
+	return data;
+}
+
 TEST_CASE("encode/decode", "[BTCBase58]") {
 	SECTION("encode/decode") {
 		BTCBase58 base58;
@@ -24,3 +83,84 @@ TEST_CASE("encode/decode", "[BTCBase58]") {
 		REQUIRE(0 == memcmp(arr_ret, arr, sizeof(arr)));
 	}
 }
+
+TEST_CASE("BRBase58 matches the digit by digit conversion", "[BTCBase58]") {
+	srand(20180903);
+
+	SECTION("encode") {
+		for (size_t n = 0; n < 20000; ++n) {
+			std::vector<uint8_t> data = randomBytes(80);
+			std::string expected = referenceEncode(data);
+			size_t zcount = 0;
+			while (zcount < data.size() && data[zcount] == 0) zcount++;
+
+			char str[128];
+			REQUIRE(BRBase58Encode(nullptr, 0, data.data(), data.size()) == zcount + expected.size() + 1);
+			REQUIRE(BRBase58Encode(str, sizeof(str), data.data(), data.size()) == zcount + expected.size() + 1);
+			REQUIRE(std::string(str) == expected);
+			REQUIRE(BTCBase58::EncodeBase58(data.data(), data.size()) == std::string(zcount, '1') + expected);
+		}
+	}
+
+	SECTION("decode") {
+		const char *alphabet = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz0OIl+/";
+		for (size_t n = 0; n < 20000; ++n) {
+			std::string str;
+			size_t len = (size_t) rand() % 80;
+			// every fourth string may have characters outside the alphabet, where decoding stops
+			size_t range = n % 4 == 0 ? strlen(alphabet) : 58;
+			for (size_t i = 0; i < len; ++i)
+				str += alphabet[rand() % range];
+
+			std::vector<uint8_t> expected = referenceDecode(str);
+			std::vector<uint8_t> data(expected.size() + 1, 0xff);
+			REQUIRE(BRBase58Decode(nullptr, 0, str.c_str()) == expected.size());
+			REQUIRE(BRBase58Decode(data.data(), data.size(), str.c_str()) == expected.size());
+			REQUIRE(std::equal(expected.begin(), expected.end(), data.begin()));
+			if (!expected.empty())
+				REQUIRE(BRBase58Decode(data.data(), expected.size() - 1, str.c_str()) == 0);
+		}
+	}
+
+	SECTION("check encode round trip") {
+		for (size_t n = 0; n < 5000; ++n) {
+			// leading zeroes are not written, so they would not come back
+			std::vector<uint8_t> data = randomBytes(40);
+			data.insert(data.begin(), 0x21);
+			char str[128];
+			size_t len = BRBase58CheckEncode(str, sizeof(str), data.data(), data.size());
+			REQUIRE(len > 0);
+
+			std::vector<uint8_t> decoded(data.size() + 4);
+			REQUIRE(BRBase58CheckDecode(decoded.data(), decoded.size(), str) == data.size());
+			REQUIRE(std::equal(data.begin(), data.end(), decoded.begin()));
+			str[0] = str[0] == 'z' ? 'y' : 'z';
+			REQUIRE(BRBase58CheckDecode(decoded.data(), decoded.size(), str) == 0);
+		}
+	}
+}
+
+TEST_CASE("Batch address conversion", "[BTCBase58]") {
+	srand(20180904);
+	std::vector<UInt168> programHashes(500);
+	for (size_t i = 0; i < programHashes.size(); ++i) {
+		for (size_t j = 0; j < sizeof(programHashes[i].u8); ++j)
+			programHashes[i].u8[j] = (uint8_t) rand();
+		programHashes[i].u8[0] = i % 100 == 0 ? 0 : 0x21;
+	}
+
+	std::vector<std::string> addresses = Utils::UInt168ToAddresses(programHashes);
+	REQUIRE(addresses.size() == programHashes.size());
+	for (size_t i = 0; i < programHashes.size(); ++i) {
+		REQUIRE(addresses[i] == Utils::UInt168ToAddress(programHashes[i]));
+		if (programHashes[i].u8[0] != 0)
+			REQUIRE(addresses[i][0] == 'E');
+	}
+
+	addresses.push_back("not an address");
+	addresses.push_back(addresses[1].substr(1));
+	std::vector<UInt168> decoded = Utils::UInt168FromAddresses(addresses);
+	REQUIRE(decoded.size() == programHashes.size());
+	for (size_t i = 0; i < programHashes.size(); ++i)
+		REQUIRE(UInt168Eq(&decoded[i], &programHashes[i]));
+}
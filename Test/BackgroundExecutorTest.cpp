@@ -3,11 +3,65 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #define CATCH_CONFIG_MAIN
+
+#include <iostream>
+#include <boost/shared_ptr.hpp>
+
 #include "catch.hpp"
 #include "SpvService/BackgroundExecutor.h"
+#include "SpvService/SerialExecutor.h"
+#include "CoreWalletManager.h"
 
 using namespace Elastos::ElaWallet;
 
+// Takes coreLock on every block, as SubWallet::blockHeightIncreased() takes the peer manager lock for the progress
+class CoreLockListener : public PeerManager::Listener {
+public:
+	CoreLockListener(boost::mutex &coreLock) :
+			PeerManager::Listener(PluginTypes()),
+			_coreLock(coreLock),
+			_calls(0),
+			_height(0) {
+	}
+
+	virtual void syncStarted() {}
+
+	virtual void syncStopped(const std::string &error) {}
+
+	virtual void txStatusUpdate() {}
+
+	virtual void saveBlocks(bool replace, const SharedWrapperList<IMerkleBlock, BRMerkleBlock *> &blocks) {}
+
+	virtual void savePeers(bool replace, const SharedWrapperList<Peer, BRPeer *> &peers) {}
+
+	virtual bool networkIsReachable() { return true; }
+
+	virtual void txPublished(const std::string &error) {}
+
+	virtual void blockHeightIncreased(uint32_t blockHeight) {
+		boost::mutex::scoped_lock core(_coreLock);
+		boost::mutex::scoped_lock lock(_lock);
+		_calls++;
+		_height = blockHeight;
+	}
+
+	uint32_t Calls() {
+		boost::mutex::scoped_lock lock(_lock);
+		return _calls;
+	}
+
+	uint32_t Height() {
+		boost::mutex::scoped_lock lock(_lock);
+		return _height;
+	}
+
+private:
+	boost::mutex &_coreLock;
+	boost::mutex _lock;
+	uint32_t _calls;
+	uint32_t _height;
+};
+
 TEST_CASE( "BackgroundExecutor simple test", "[Normal]" ) {
 	SECTION("Single thread test (default)") {
 		BackgroundExecutor executor;
@@ -45,4 +99,211 @@ TEST_CASE( "BackgroundExecutor simple test", "[Normal]" ) {
 			REQUIRE(array[i] == expectValue);
 		}
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("Serial executors on a work stealing pool", "[Normal]") {
+	WorkStealingExecutor pool(4);
+
+	SECTION("Order is kept per queue") {
+		const int queueCount = 8, taskCount = 500;
+		std::vector<boost::shared_ptr<SerialExecutor> > queues;
+		std::vector<std::vector<int> > results(queueCount);
+
+		for (int q = 0; q < queueCount; ++q)
+			queues.push_back(boost::shared_ptr<SerialExecutor>(new SerialExecutor(pool)));
+
+		for (int i = 0; i < taskCount; ++i) {
+			for (int q = 0; q < queueCount; ++q) {
+				std::vector<int> *result = &results[q];
+				queues[q]->execute(Runnable([result, i]() -> void {
+					result->push_back(i);
+				}));
+			}
+		}
+
+		for (int q = 0; q < queueCount; ++q) {
+			while (queues[q]->GetMetrics().Executed < taskCount)
+				boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+
+			REQUIRE(results[q].size() == taskCount);
+			for (int i = 0; i < taskCount; ++i)
+				REQUIRE(results[q][i] == i);
+		}
+	}
+
+	SECTION("Slow queue does not hold back others") {
+		boost::mutex lock;
+		boost::condition_variable released;
+		bool release = false, fastDone = false;
+		SerialExecutor slow(pool), fast(pool);
+
+		slow.execute(Runnable([&lock, &released, &release]() -> void {
+			boost::mutex::scoped_lock scopedLock(lock);
+			while (!release)
+				released.wait(scopedLock);
+		}));
+		fast.execute(Runnable([&fastDone]() -> void {
+			fastDone = true;
+		}));
+
+		while (fast.GetMetrics().Executed == 0)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		ExecutorMetrics metrics = slow.GetMetrics();
+
+		{
+			boost::mutex::scoped_lock scopedLock(lock);
+			release = true;
+			released.notify_all();
+		}
+		REQUIRE(fastDone);
+		REQUIRE(metrics.QueueDepth == 0);
+		REQUIRE(metrics.Executed == 0);
+	}
+
+	SECTION("Full queue blocks the producer") {
+		boost::mutex lock;
+		boost::condition_variable released;
+		bool release = false;
+		int count = 0;
+		SerialExecutor queue(pool, 2);
+
+		queue.execute(Runnable([&lock, &released, &release]() -> void {
+			boost::mutex::scoped_lock scopedLock(lock);
+			while (!release)
+				released.wait(scopedLock);
+		}));
+		while (queue.GetMetrics().QueueDepth != 0)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+
+		boost::thread producer([&queue, &count]() {
+			for (int i = 0; i < 5; ++i)
+				queue.execute(Runnable([&count]() -> void {
+					count++;
+				}));
+		});
+
+		boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+		ExecutorMetrics metrics = queue.GetMetrics();
+
+		{
+			boost::mutex::scoped_lock scopedLock(lock);
+			release = true;
+			released.notify_all();
+		}
+		producer.join();
+		REQUIRE(metrics.QueueDepth == 2);
+		REQUIRE(metrics.Blocked >= 1);
+		while (queue.GetMetrics().Executed < 6)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		REQUIRE(count == 5);
+		REQUIRE(queue.GetMetrics().MaxQueueDepth == 2);
+	}
+}
+
+TEST_CASE("Peer manager listener on a serial executor", "[Normal]") {
+	WorkStealingExecutor pool(4);
+
+	SECTION("Blocks relayed under the Core lock never wait for the listener") {
+		const uint32_t blockCount = 10000;
+		boost::mutex coreLock;
+		CoreLockListener listener(coreLock);
+		SerialExecutor queue(pool, SERIAL_QUEUE_UNBOUNDED);
+		WrappedExecutorPeerManagerListener wrapped(&listener, &queue, PluginTypes());
+
+		// the peer thread relays every block holding the lock the listener needs
+		boost::thread peer([&coreLock, &wrapped, blockCount]() {
+			boost::mutex::scoped_lock core(coreLock);
+			for (uint32_t height = 1; height <= blockCount; ++height) {
+				wrapped.blockHeightIncreased(height);
+				wrapped.txStatusUpdate();
+			}
+		});
+		REQUIRE(peer.timed_join(boost::posix_time::seconds(30)));
+
+		while (listener.Height() != blockCount)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		while (queue.GetMetrics().QueueDepth != 0)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+
+		ExecutorMetrics metrics = queue.GetMetrics();
+		REQUIRE(metrics.Blocked == 0);
+		REQUIRE(metrics.Coalesced >= blockCount - 2);
+		REQUIRE(listener.Calls() <= 2);
+	}
+
+	SECTION("Keyed tasks keep their place") {
+		boost::mutex lock;
+		std::vector<int> order;
+		char key;
+		SerialExecutor queue(pool, 2);
+
+		boost::mutex::scoped_lock hold(lock);
+		queue.execute(Runnable([&lock, &order]() -> void {
+			boost::mutex::scoped_lock scopedLock(lock);
+			order.push_back(0);
+		}));
+		while (queue.GetMetrics().QueueDepth != 0)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+
+		queue.execute(Runnable([&order]() -> void { order.push_back(1); }, &key));
+		queue.execute(Runnable([&order]() -> void { order.push_back(2); }));
+		// the queue is full, a keyed task still does not wait
+		queue.execute(Runnable([&order]() -> void { order.push_back(3); }, &key));
+		hold.unlock();
+
+		while (queue.GetMetrics().Executed < 3)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		REQUIRE(order.size() == 3);
+		REQUIRE(order[1] == 3);
+		REQUIRE(order[2] == 2);
+		REQUIRE(queue.GetMetrics().Coalesced == 1);
+	}
+}
+
+TEST_CASE("Work stealing executor stress", "[.benchmark]") {
+	const int queueCount = 256, taskCount = 2000;
+	WorkStealingExecutor pool;
+	std::vector<boost::shared_ptr<SerialExecutor> > queues;
+	std::vector<uint64_t> sums(queueCount, 0);
+
+	for (int q = 0; q < queueCount; ++q)
+		queues.push_back(boost::shared_ptr<SerialExecutor>(new SerialExecutor(pool, 256)));
+
+	boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+	boost::thread_group producers;
+	for (int p = 0; p < 4; ++p) {
+		producers.create_thread([&queues, &sums, p, queueCount, taskCount]() {
+			for (int i = 0; i < taskCount; ++i) {
+				for (int q = p; q < queueCount; q += 4) {
+					uint64_t *sum = &sums[q];
+					queues[q]->execute(Runnable([sum, i]() -> void {
+						*sum = *sum * 31 + i;
+					}));
+				}
+			}
+		});
+	}
+	producers.join_all();
+
+	uint64_t totalLatency = 0, maxLatency = 0, blocked = 0;
+	for (int q = 0; q < queueCount; ++q) {
+		while (queues[q]->GetMetrics().Executed < taskCount)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		ExecutorMetrics metrics = queues[q]->GetMetrics();
+		totalLatency += metrics.TotalLatencyUs;
+		maxLatency = std::max(maxLatency, metrics.MaxLatencyUs);
+		blocked += metrics.Blocked;
+	}
+	boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::universal_time() - start;
+
+	uint64_t expect = 0;
+	for (int i = 0; i < taskCount; ++i)
+		expect = expect * 31 + i;
+	for (int q = 0; q < queueCount; ++q)
+		REQUIRE(sums[q] == expect);
+
+	ExecutorMetrics poolMetrics = pool.GetMetrics();
+	std::cout << queueCount * taskCount << " tasks on " << pool.GetThreadCount() << " threads in "
+			  << elapsed.total_milliseconds() << " ms, average latency "
+			  << totalLatency / (queueCount * taskCount) << " us, max latency " << maxLatency << " us, "
+			  << blocked << " producer waits, " << poolMetrics.Stolen << " steals" << std::endl;
+}
@@ -0,0 +1,179 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <catch.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "BRCrypto.h"
+#include "BRPeerManager.h"
+
+#include "CheckPointBundle.h"
+#include "ByteStream.h"
+#include "Utils.h"
+#include "Plugin/Block/MerkleBlock.h"
+
+using namespace Elastos::ElaWallet;
+
+#define TEST_MAGIC_NUMBER 7630401
+
+static UInt256 headerHash(const BRMerkleBlock &header) {
+	ByteStream stream;
+	MerkleBlock::serializeNoAux(stream, header);
+	CMBlock buf = stream.getBuffer();
+	UInt256 hash;
+	BRSHA256_2(&hash, buf, buf.GetSize());
+	return hash;
+}
+
+static BRMerkleBlock createHeader(uint32_t height) {
+	BRMerkleBlock header;
+	memset(&header, 0, sizeof(header));
+	header.version = 1;
+	header.height = height;
+	header.timestamp = 1513936800 + height * 120;
+	header.target = 0x1d00ffff;
+	header.nonce = height;
+	header.merkleRoot.u32[0] = height;
+	return header;
+}
+
+// a checkpoint every difficulty transition
+static std::vector<BRMerkleBlock> createHeaders() {
+	std::vector<BRMerkleBlock> headers;
+	for (uint32_t height = 0; height <= 3 * BLOCK_DIFFICULTY_INTERVAL; height += BLOCK_DIFFICULTY_INTERVAL)
+		headers.push_back(createHeader(height));
+	return headers;
+}
+
+// whether the peer manager, starting at lastBlock, can verify the next difficulty transition
+static bool verifiesNextTransition(const std::vector<BRCheckPoint> &checkPoints, const BRMerkleBlock &lastBlock) {
+	std::vector<BRMerkleBlock> blocks;
+	blocks.reserve(checkPoints.size() + BLOCK_DIFFICULTY_INTERVAL + 1);
+	BRSet *blockSet = BRSetNewUInt256(blocks.capacity());
+
+	// like BRPeerManagerNew()
+	for (size_t i = 0; i < checkPoints.size(); ++i) {
+		BRMerkleBlock block;
+		memset(&block, 0, sizeof(block));
+		block.height = checkPoints[i].height;
+		block.blockHash = UInt256Reverse(&checkPoints[i].hash);
+		blocks.push_back(block);
+		BRSetAdd(blockSet, &blocks.back());
+	}
+
+	BRMerkleBlock start = lastBlock;
+	start.blockHash = headerHash(lastBlock);
+	if (BRSetGet(blockSet, &start) == nullptr) {
+		blocks.push_back(start);
+		BRSetAdd(blockSet, &blocks.back());
+	}
+
+	// relay blocks up to the next transition
+	UInt256 prevHash = start.blockHash;
+	uint32_t height = start.height + 1;
+	do {
+		BRMerkleBlock block;
+		memset(&block, 0, sizeof(block));
+		block.height = height;
+		block.prevBlock = prevHash;
+		block.blockHash.u32[0] = height;
+		block.blockHash.u32[1] = 0xffffffff;
+		blocks.push_back(block);
+		BRSetAdd(blockSet, &blocks.back());
+		prevHash = block.blockHash;
+	} while (height++ % BLOCK_DIFFICULTY_INTERVAL != 0);
+
+	bool verified = _BRPrevTransitionBlock(blockSet, &blocks.back()) != nullptr;
+	BRSetFree(blockSet);
+	return verified;
+}
+
+static BRCheckPoint toCheckPoint(const BRMerkleBlock &header) {
+	UInt256 hash = headerHash(header);
+	BRCheckPoint checkPoint = {header.height, UInt256Reverse(&hash), header.timestamp, header.target};
+	return checkPoint;
+}
+
+TEST_CASE("CheckPointBundle", "[CheckPointBundle]") {
+	boost::filesystem::path path = boost::filesystem::temp_directory_path() / "CheckPointBundleTest.bundle";
+	boost::filesystem::remove(path);
+
+	UInt256 secret = uint256("0000000000000000000000000000000000000000000000000000000000000001");
+	Key publisher(secret, true);
+	std::string publicKey = Utils::encodeHex(publisher.getPubkey());
+	std::vector<BRMerkleBlock> headers = createHeaders();
+
+	SECTION("round trip") {
+		CheckPointBundle::Write(path, TEST_MAGIC_NUMBER, headers, publisher);
+		CheckPointBundle bundle = CheckPointBundle::Read(path, publicKey);
+
+		REQUIRE(bundle.GetMagicNumber() == TEST_MAGIC_NUMBER);
+		REQUIRE(bundle.GetCheckPoints().size() == headers.size());
+		for (size_t i = 0; i < headers.size(); ++i) {
+			BRCheckPoint expected = toCheckPoint(headers[i]);
+			REQUIRE(bundle.GetCheckPoints()[i].height == expected.height);
+			REQUIRE(UInt256Eq(&bundle.GetCheckPoints()[i].hash, &expected.hash));
+			REQUIRE(bundle.GetCheckPoints()[i].timestamp == expected.timestamp);
+		}
+	}
+
+	SECTION("signed by another key") {
+		CheckPointBundle::Write(path, TEST_MAGIC_NUMBER, headers, publisher);
+		UInt256 otherSecret = uint256("0000000000000000000000000000000000000000000000000000000000000002");
+		Key other(otherSecret, true);
+		REQUIRE_THROWS_AS(CheckPointBundle::Read(path, Utils::encodeHex(other.getPubkey())), std::logic_error);
+	}
+
+	SECTION("checkpoint off a difficulty transition") {
+		headers.push_back(createHeader(headers.back().height + 1));
+		CheckPointBundle::Write(path, TEST_MAGIC_NUMBER, headers, publisher);
+		REQUIRE_THROWS_AS(CheckPointBundle::Read(path, publicKey), std::logic_error);
+	}
+
+	SECTION("damaged file") {
+		CheckPointBundle::Write(path, TEST_MAGIC_NUMBER, headers, publisher);
+		{
+			boost::filesystem::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+			file.seekg(30);
+			char byte = (char) file.get();
+			file.seekp(30);
+			file.put((char) (byte ^ 1));
+		}
+		REQUIRE_THROWS_AS(CheckPointBundle::Read(path, publicKey), std::logic_error);
+	}
+
+	SECTION("extend built-in checkpoints") {
+		CheckPointBundle::Write(path, TEST_MAGIC_NUMBER, headers, publisher);
+		CheckPointBundle::Register(CheckPointBundle::Read(path, publicKey));
+
+		BRCheckPoint builtIn[] = {toCheckPoint(headers[0]), toCheckPoint(headers[1])};
+		std::vector<BRCheckPoint> extended = CheckPointBundle::Extend(TEST_MAGIC_NUMBER, builtIn, 2);
+		REQUIRE(extended.size() == headers.size());
+		REQUIRE(extended.back().height == 3 * BLOCK_DIFFICULTY_INTERVAL);
+
+		std::vector<BRCheckPoint> otherNetwork = CheckPointBundle::Extend(TEST_MAGIC_NUMBER + 1, builtIn, 2);
+		REQUIRE(otherNetwork.size() == 2);
+
+		builtIn[1].hash = UINT256_ZERO;
+		std::vector<BRCheckPoint> conflicting = CheckPointBundle::Extend(TEST_MAGIC_NUMBER, builtIn, 2);
+		REQUIRE(conflicting.size() == 2);
+	}
+
+	SECTION("sync continues past the next transition") {
+		CheckPointBundle::Write(path, TEST_MAGIC_NUMBER, headers, publisher);
+		CheckPointBundle::Register(CheckPointBundle::Read(path, publicKey));
+
+		BRCheckPoint builtIn[] = {toCheckPoint(headers[0]), toCheckPoint(headers[1])};
+		std::vector<BRCheckPoint> extended = CheckPointBundle::Extend(TEST_MAGIC_NUMBER, builtIn, 2);
+		REQUIRE(verifiesNextTransition(extended, headers.back()));
+
+		// what a checkpoint past the transition would do
+		REQUIRE_FALSE(verifiesNextTransition(extended, createHeader(headers.back().height + 1)));
+	}
+
+	boost::filesystem::remove(path);
+}
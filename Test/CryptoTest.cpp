@@ -0,0 +1,111 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <atomic>
+#include <boost/thread.hpp>
+
+#include "catch.hpp"
+#include "BRCrypto.h"
+#include "Utils.h"
+#include "TestHelper.h"
+
+using namespace Elastos::ElaWallet;
+
+static const BRSHA256Impl impls[] = {BRSHA256ImplPortable, BRSHA256ImplAVX2, BRSHA256ImplSHANI};
+
+TEST_CASE("SHA256 kernels", "[Crypto]") {
+	BRSHA256Impl selected = BRSHA256GetImpl();
+
+	SECTION("portable kernel is always available") {
+		REQUIRE(BRSHA256SetImpl(BRSHA256ImplPortable));
+		REQUIRE(BRSHA256GetImpl() == BRSHA256ImplPortable);
+	}
+
+	SECTION("known answer on every supported kernel") {
+		for (size_t i = 0; i < ARRAY_SIZE(impls); ++i) {
+			if (!BRSHA256SetImpl(impls[i]))
+				continue;
+
+			UInt256 md;
+			BRSHA256(&md, "abc", 3);
+			REQUIRE(Utils::encodeHex(md.u8, sizeof(md)) ==
+					"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+			BRSHA256(&md, "", 0);
+			REQUIRE(Utils::encodeHex(md.u8, sizeof(md)) ==
+					"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+		}
+	}
+
+	SECTION("kernels agree with the portable implementation") {
+		CMBlock data = getRandCMBlock(64 * 100);
+		std::vector<UInt256> expect(100), single(300);
+
+		BRSHA256SetImpl(BRSHA256ImplPortable);
+		for (size_t i = 0; i < expect.size(); ++i)
+			BRSHA256_2(&expect[i], &data[i * 64], 64);
+		for (size_t len = 0; len < single.size(); ++len)
+			BRSHA256(&single[len], data, len * 7);
+
+		for (size_t i = 0; i < ARRAY_SIZE(impls); ++i) {
+			if (!BRSHA256SetImpl(impls[i]))
+				continue;
+
+			for (size_t count = 0; count <= expect.size(); count += 9) {
+				std::vector<UInt256> actual(count);
+				BRSHA256_2x64(actual.data(), data, count);
+				for (size_t n = 0; n < count; ++n)
+					REQUIRE(UInt256Eq(&actual[n], &expect[n]));
+			}
+
+			for (size_t len = 0; len < single.size(); ++len) {
+				UInt256 md;
+				BRSHA256(&md, data, len * 7);
+				REQUIRE(UInt256Eq(&md, &single[len]));
+			}
+		}
+	}
+
+	SECTION("batch hashing in place") {
+		CMBlock data = getRandCMBlock(64 * 33);
+		std::vector<UInt256> expect(33);
+
+		for (size_t i = 0; i < expect.size(); ++i)
+			BRSHA256_2(&expect[i], &data[i * 64], 64);
+
+		BRSHA256_2x64(data, data, expect.size());
+		REQUIRE(memcmp(data, expect.data(), expect.size() * sizeof(UInt256)) == 0);
+	}
+
+	SECTION("switching kernels while other threads hash") {
+		CMBlock data = getRandCMBlock(64 * 32);
+		std::vector<UInt256> expect(32);
+		for (size_t i = 0; i < expect.size(); ++i)
+			BRSHA256_2(&expect[i], &data[i * 64], 64);
+
+		std::atomic<bool> stop(false);
+		std::atomic<size_t> mismatches(0);
+		boost::thread_group hashers;
+		for (size_t t = 0; t < 2; ++t) {
+			hashers.create_thread([&data, &expect, &stop, &mismatches] {
+				std::vector<UInt256> actual(expect.size());
+				while (!stop) {
+					BRSHA256_2x64(actual.data(), data, actual.size());
+					if (memcmp(actual.data(), expect.data(), expect.size() * sizeof(UInt256)) != 0)
+						mismatches++;
+				}
+			});
+		}
+
+		for (size_t n = 0; n < 3000; ++n)
+			BRSHA256SetImpl(impls[n % ARRAY_SIZE(impls)]);
+		stop = true;
+		hashers.join_all();
+		REQUIRE(mismatches == 0);
+	}
+
+	BRSHA256SetImpl(selected);
+}
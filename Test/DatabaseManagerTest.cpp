@@ -268,6 +268,89 @@ TEST_CASE("DatabaseManager test", "[DatabaseManager]") {
 
 	}
 
+	SECTION("Ethereum test") {
+#define ETH_ISO "eth"
+#define TEST_ETH_RECORD_CNT uint64_t(20)
+		static std::vector<EthereumTransactionEntity> txToSave;
+		static std::vector<EthereumBlockEntity> blocksToSave;
+
+		SECTION("Ethereum prepare for testing") {
+			for (uint64_t i = 0; i < TEST_ETH_RECORD_CNT; ++i) {
+				EthereumBlockEntity block;
+				block.blockNumber = 5000000 + 10 * i;
+				block.timeStamp = (uint64_t)rand();
+				block.blockHash = getRandString(66);
+				blocksToSave.push_back(block);
+
+				EthereumTransactionEntity tx;
+				tx.buff = getRandCMBlock(120);
+				tx.blockNumber = block.blockNumber;
+				tx.txHash = getRandString(66);
+				txToSave.push_back(tx);
+			}
+		}
+
+		SECTION("Ethereum save test") {
+			DatabaseManager dbm(DBFILE);
+			REQUIRE(0 == dbm.getLastEthereumBlockNumber(ETH_ISO));
+
+			for (int i = 0; i < txToSave.size(); ++i) {
+				REQUIRE(dbm.putEthereumBlock(ETH_ISO, blocksToSave[i]));
+				REQUIRE(dbm.putEthereumTransaction(ETH_ISO, txToSave[i]));
+			}
+			// saved again, as when announced again, is not a new record
+			REQUIRE(dbm.putEthereumTransaction(ETH_ISO, txToSave[0]));
+			REQUIRE(dbm.putEthereumBlock(ETH_ISO, blocksToSave[0]));
+
+			REQUIRE(dbm.putEthereumBalance(ETH_ISO, EthereumBalanceEntity("", "0x10")));
+			REQUIRE(dbm.putEthereumBalance(ETH_ISO, EthereumBalanceEntity("", "0x123f")));
+			REQUIRE(dbm.putEthereumBalance(ETH_ISO, EthereumBalanceEntity("0x558ec3152e2eb2174905cd19aea4e34a23de9ad6", "0x1")));
+		}
+
+		SECTION("Ethereum read test") {
+			DatabaseManager dbm(DBFILE);
+
+			std::vector<EthereumTransactionEntity> readTx = dbm.getAllEthereumTransactions(ETH_ISO);
+			REQUIRE(txToSave.size() == readTx.size());
+			for (int i = 0; i < readTx.size(); ++i) {
+				REQUIRE(txToSave[i].buff.GetSize() == readTx[i].buff.GetSize());
+				REQUIRE(0 == memcmp(readTx[i].buff, txToSave[i].buff, txToSave[i].buff.GetSize()));
+				REQUIRE(readTx[i].txHash == txToSave[i].txHash);
+				REQUIRE(readTx[i].blockNumber == txToSave[i].blockNumber);
+			}
+
+			std::vector<EthereumBlockEntity> readBlocks = dbm.getAllEthereumBlocks(ETH_ISO);
+			REQUIRE(blocksToSave.size() == readBlocks.size());
+			for (int i = 0; i < readBlocks.size(); ++i) {
+				REQUIRE(readBlocks[i].blockHash == blocksToSave[i].blockHash);
+				REQUIRE(readBlocks[i].blockNumber == blocksToSave[i].blockNumber);
+				REQUIRE(readBlocks[i].timeStamp == blocksToSave[i].timeStamp);
+			}
+			REQUIRE(blocksToSave.back().blockNumber == dbm.getLastEthereumBlockNumber(ETH_ISO));
+
+			std::vector<EthereumBalanceEntity> readBalances = dbm.getAllEthereumBalances(ETH_ISO);
+			REQUIRE(2 == readBalances.size());
+			for (int i = 0; i < readBalances.size(); ++i) {
+				if (readBalances[i].token.empty())
+					REQUIRE(readBalances[i].balance == "0x123f");
+				else
+					REQUIRE(readBalances[i].balance == "0x1");
+			}
+
+			REQUIRE(dbm.getAllEthereumTransactions(ISO).empty());
+		}
+
+		SECTION("Ethereum delete test") {
+			DatabaseManager dbm(DBFILE);
+
+			REQUIRE(dbm.deleteAllEthereum(ETH_ISO));
+			REQUIRE(dbm.getAllEthereumTransactions(ETH_ISO).empty());
+			REQUIRE(dbm.getAllEthereumBlocks(ETH_ISO).empty());
+			REQUIRE(dbm.getAllEthereumBalances(ETH_ISO).empty());
+			REQUIRE(0 == dbm.getLastEthereumBlockNumber(ETH_ISO));
+		}
+	}
+
 	SECTION("InternalAddresses test") {
 		DatabaseManager dbm(DBFILE);
 
@@ -0,0 +1,155 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <boost/thread.hpp>
+#include <openssl/evp.h>
+
+#include "catch.hpp"
+#include "AES_256_CCM.h"
+#include "KeyDerivation.h"
+#include "Utils.h"
+#include "TestHelper.h"
+
+using namespace Elastos::ElaWallet;
+
+static unsigned char salt[] = {0x65, 0x15, 0x63, 0x6B, 0x82, 0xC5, 0xAC, 0x56};
+static unsigned char iv[] = {0x9F, 0x62, 0x54, 0x4C, 0x9D, 0x3F, 0xCA, 0xB2, 0xDD, 0x08, 0x33, 0xDF, 0x21,
+							 0xCA, 0x80, 0xCF};
+
+TEST_CASE("Key derivation parameters", "[KeyDerivation]") {
+	const std::string password = "payPassword";
+	unsigned char plaintext[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+	SECTION("default is the legacy PBKDF2 derivation") {
+		unsigned char expect[32], key[32];
+		PKCS5_PBKDF2_HMAC(password.c_str(), password.size(), salt, sizeof(salt), 10000, EVP_sha256(),
+						  sizeof(expect), expect);
+		REQUIRE(KdfParams().Derive(key, sizeof(key), (const unsigned char *) password.c_str(), password.size(),
+								   salt, sizeof(salt)));
+		REQUIRE(0 == memcmp(key, expect, sizeof(key)));
+
+		CMBlock cipher = AES_256_CCM::encrypt(plaintext, sizeof(plaintext), (unsigned char *) password.c_str(),
+											  password.size(), salt, sizeof(salt), iv, sizeof(iv));
+		CMBlock plain = AES_256_CCM::decryptWithKey(cipher, cipher.GetSize(), key, sizeof(key), iv, sizeof(iv));
+		REQUIRE(plain.GetSize() == sizeof(plaintext));
+		REQUIRE(0 == memcmp(plain, plaintext, sizeof(plaintext)));
+	}
+
+	SECTION("memory hard derivation") {
+		KdfParams scrypt = KdfParams::MemoryHard(1024, 8, 1);
+		REQUIRE(scrypt.IsValid());
+		REQUIRE_FALSE(KdfParams::MemoryHard(1000).IsValid());
+		REQUIRE_FALSE(KdfParams(0).IsValid());
+		REQUIRE_FALSE(KdfParams(MAX_PBKDF2_ITERATIONS + 1).IsValid());
+		REQUIRE_FALSE(KdfParams::MemoryHard(1024, MAX_SCRYPT_R + 1, 1).IsValid());
+		REQUIRE_FALSE(KdfParams::MemoryHard(1024, 1, MAX_SCRYPT_P + 1).IsValid());
+		REQUIRE_FALSE(KdfParams::MemoryHard(1024, MAX_SCRYPT_R, MAX_SCRYPT_P).IsValid());
+		REQUIRE_FALSE(KdfParams::MemoryHard(MAX_SCRYPT_N_R, 2, 1).IsValid());
+		REQUIRE(KdfParams::MemoryHard(1024, 8, 8).IsValid());
+
+		CMBlock cipher = AES_256_CCM::encrypt(plaintext, sizeof(plaintext), (unsigned char *) password.c_str(),
+											  password.size(), salt, sizeof(salt), iv, sizeof(iv), false, nullptr, 0,
+											  scrypt);
+		REQUIRE(cipher.GetSize() > 0);
+
+		CMBlock plain = AES_256_CCM::decrypt(cipher, cipher.GetSize(), (unsigned char *) password.c_str(),
+											 password.size(), salt, sizeof(salt), iv, sizeof(iv), false, nullptr, 0,
+											 scrypt);
+		REQUIRE(plain.GetSize() == sizeof(plaintext));
+		REQUIRE(0 == memcmp(plain, plaintext, sizeof(plaintext)));
+
+		plain = AES_256_CCM::decrypt(cipher, cipher.GetSize(), (unsigned char *) password.c_str(), password.size(),
+									 salt, sizeof(salt), iv, sizeof(iv));
+		REQUIRE(plain.GetSize() == 0);
+	}
+}
+
+TEST_CASE("Derived key cache", "[KeyDerivation]") {
+	DerivedKeyCache &cache = DerivedKeyCache::Instance();
+	const std::string password = "payPassword", walletID = "wallet";
+	KdfParams kdf;
+	unsigned char expect[32], key[32];
+
+	kdf.Derive(expect, sizeof(expect), (const unsigned char *) password.c_str(), password.size(), salt,
+			   sizeof(salt));
+
+	SECTION("disabled by default") {
+		REQUIRE(cache.GetTimeout() == 0);
+		REQUIRE(cache.Derive(walletID, kdf, key, sizeof(key), (const unsigned char *) password.c_str(),
+							 password.size(), salt, sizeof(salt)));
+		REQUIRE(0 == memcmp(key, expect, sizeof(key)));
+		REQUIRE(cache.Size() == 0);
+	}
+
+	SECTION("entries are per wallet and per password") {
+		cache.SetTimeout(60);
+		REQUIRE(cache.Derive(walletID, kdf, key, sizeof(key), (const unsigned char *) password.c_str(),
+							 password.size(), salt, sizeof(salt)));
+		REQUIRE(cache.Size() == 0);
+		cache.Store(walletID, kdf, key, sizeof(key), (const unsigned char *) password.c_str(), password.size(),
+					salt, sizeof(salt));
+		REQUIRE(cache.Size() == 1);
+
+		for (int i = 0; i < 2; ++i) {
+			memset(key, 0, sizeof(key));
+			REQUIRE(cache.Derive(walletID, kdf, key, sizeof(key), (const unsigned char *) password.c_str(),
+								 password.size(), salt, sizeof(salt)));
+			REQUIRE(0 == memcmp(key, expect, sizeof(key)));
+		}
+
+		std::string wrong = "wrongPassword";
+		REQUIRE(cache.Derive(walletID, kdf, key, sizeof(key), (const unsigned char *) wrong.c_str(), wrong.size(),
+							 salt, sizeof(salt)));
+		REQUIRE(0 != memcmp(key, expect, sizeof(key)));
+
+		REQUIRE(cache.Size() == 1);
+
+		REQUIRE(cache.Derive("other", kdf, key, sizeof(key), (const unsigned char *) password.c_str(),
+							 password.size(), salt, sizeof(salt)));
+		REQUIRE(0 == memcmp(key, expect, sizeof(key)));
+		cache.Store("other", kdf, key, sizeof(key), (const unsigned char *) password.c_str(), password.size(),
+					salt, sizeof(salt));
+		REQUIRE(cache.Size() == 2);
+
+		cache.Clear(walletID);
+		REQUIRE(cache.Size() == 1);
+		cache.SetTimeout(0);
+		REQUIRE(cache.Size() == 0);
+	}
+
+	SECTION("Utils decryption through the cache") {
+		CMBlock data = getRandCMBlock(32);
+		CMBlock cipher = Utils::encrypt(data, password);
+
+		cache.SetTimeout(60);
+		for (int i = 0; i < 3; ++i) {
+			CMBlock plain = Utils::decrypt(cipher, password, walletID);
+			REQUIRE(plain.GetSize() == data.GetSize());
+			REQUIRE(0 == memcmp(plain, data, data.GetSize()));
+		}
+		REQUIRE(cache.Size() == 1);
+
+		// a wrong password is not cached, neither replacing an entry nor adding one
+		REQUIRE(Utils::decrypt(cipher, "wrongPassword", walletID).GetSize() == 0);
+		REQUIRE(Utils::decrypt(cipher, "wrongPassword", "fresh").GetSize() == 0);
+		REQUIRE(cache.Size() == 1);
+		REQUIRE(Utils::decrypt(cipher, password, walletID).GetSize() == data.GetSize());
+		cache.SetTimeout(0);
+	}
+
+	SECTION("expired keys are wiped") {
+		cache.SetTimeout(1);
+		REQUIRE(cache.Derive(walletID, kdf, key, sizeof(key), (const unsigned char *) password.c_str(),
+							 password.size(), salt, sizeof(salt)));
+		cache.Store(walletID, kdf, key, sizeof(key), (const unsigned char *) password.c_str(), password.size(),
+					salt, sizeof(salt));
+		REQUIRE(cache.Size() == 1);
+
+		boost::this_thread::sleep(boost::posix_time::milliseconds(1500));
+		REQUIRE(cache.Size() == 0);
+		cache.SetTimeout(0);
+	}
+}
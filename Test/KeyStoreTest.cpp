@@ -28,4 +28,66 @@ TEST_CASE("save/open", "[KeyStore]") {
 
 		REQUIRE(true == ks.open(path, password));
 	}
-}
\ No newline at end of file
+}
+
+TEST_CASE("save/open with memory hard key derivation", "[KeyStore]") {
+	KeyStore ks;
+	nlohmann::json json;
+	std::string password = "11111111";
+
+	REQUIRE(true == ks.save(json, password, KdfParams::MemoryHard(1024)));
+	REQUIRE(json["kdf"] == "scrypt");
+	REQUIRE(json["iter"] == 1024);
+
+	KeyStore opened;
+	REQUIRE(true == opened.open(json, password));
+	REQUIRE(false == opened.open(json, "22222222"));
+
+	json["kdf"] = "unknown";
+	REQUIRE(false == opened.open(json, password));
+}
+
+TEST_CASE("open rejects hostile key derivation settings", "[KeyStore]") {
+	KeyStore ks;
+	std::string password = "11111111";
+
+	SECTION("scrypt") {
+		nlohmann::json json;
+		REQUIRE(true == ks.save(json, password, KdfParams::MemoryHard(1024)));
+
+		// a block size or parallelism this large would overflow BRScrypt's stack buffers
+		nlohmann::json hostile = json;
+		hostile["r"] = 1000000;
+		REQUIRE(false == ks.open(hostile, password));
+
+		hostile = json;
+		hostile["p"] = 1000000;
+		REQUIRE(false == ks.open(hostile, password));
+
+		hostile = json;
+		hostile["r"] = MAX_SCRYPT_R;
+		hostile["p"] = MAX_SCRYPT_P;
+		REQUIRE(false == ks.open(hostile, password));
+
+		hostile = json;
+		hostile["iter"] = 1 << 20;
+		REQUIRE(false == ks.open(hostile, password));
+
+		REQUIRE(true == ks.open(json, password));
+	}
+
+	SECTION("pbkdf2") {
+		nlohmann::json json;
+		REQUIRE(true == ks.save(json, password));
+
+		// returns at once instead of running four billion rounds
+		nlohmann::json hostile = json;
+		hostile["iter"] = 4000000000u;
+		REQUIRE(false == ks.open(hostile, password));
+
+		hostile["iter"] = 0;
+		REQUIRE(false == ks.open(hostile, password));
+
+		REQUIRE(true == ks.open(json, password));
+	}
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
+
+#include "catch.hpp"
+#include "BRPeer.h"
+#include "Log.h"
+#include "Utils.h"
+
+using namespace Elastos::ElaWallet;
+
+static std::string readFile(const boost::filesystem::path &path) {
+	std::ifstream in(path.string());
+	std::stringstream content;
+	content << in.rdbuf();
+	return content.str();
+}
+
+static const char *countCall(int &calls) {
+	calls++;
+	return "argument";
+}
+
+TEST_CASE("Log subsystems", "[Log]") {
+	BRPeer *peer = BRPeerNew(0);
+
+	SECTION("Peer level is checked before the arguments are evaluated") {
+		int calls = 0;
+		Log::setLevel(Log::Peer, spdlog::level::warn);
+		REQUIRE(!BRPeerLogEnabled(PEER_LOG_INFO));
+		REQUIRE(!Log::shouldLog(Log::Peer, spdlog::level::info));
+		peer_log(peer, "%s", countCall(calls));
+		REQUIRE(calls == 0);
+
+		Log::setLevel(Log::Peer, spdlog::level::info);
+		REQUIRE(BRPeerLogEnabled(PEER_LOG_INFO));
+		REQUIRE(!BRPeerLogEnabled(PEER_LOG_DEBUG));
+		peer_log(peer, "%s", countCall(calls));
+		REQUIRE(calls == 1);
+	}
+
+	SECTION("Levels are per subsystem") {
+		Log::setLevel(spdlog::level::info);
+		Log::setLevel(Log::Database, spdlog::level::err);
+		REQUIRE(Log::shouldLog(Log::Wallet, spdlog::level::info));
+		REQUIRE(!Log::shouldLog(Log::Database, spdlog::level::info));
+		REQUIRE(Log::shouldLog(Log::Database, spdlog::level::err));
+		REQUIRE(Log::getLogger(Log::Wallet) != Log::getLogger(Log::Database));
+
+		Log::Subsystem subsystem;
+		REQUIRE(Log::findSubsystem("db", subsystem));
+		REQUIRE(subsystem == Log::Database);
+		REQUIRE(!Log::findSubsystem("unknown", subsystem));
+	}
+
+	SECTION("Rotating log file") {
+		boost::filesystem::path path = boost::filesystem::temp_directory_path() / "spvsdk_log_test.log";
+		boost::filesystem::remove(path);
+		Log::setLevel(spdlog::level::info);
+		Log::enableFileLogging(path.string(), 1024 * 1024, 2);
+
+		Log::getLogger(Log::Wallet)->info("wallet line {}", 1);
+		peer_log(peer, "peer line %d", 2);
+
+		std::string content;
+		for (int i = 0; i < 100; ++i) {
+			Log::flush();
+			content = readFile(path);
+			if (content.find("peer line 2") != std::string::npos && content.find("wallet line 1") != std::string::npos)
+				break;
+			boost::this_thread::sleep(boost::posix_time::milliseconds(20));
+		}
+		REQUIRE(content.find("[wallet] [info] wallet line 1") != std::string::npos);
+		REQUIRE(content.find("[peer] [info] ") != std::string::npos);
+		REQUIRE(content.find(":0 peer line 2") != std::string::npos);
+	}
+
+	BRPeerFree(peer);
+}
+
+TEST_CASE("Logging overhead during sync", "[.benchmark]") {
+	const int blocks = 5000;
+	const char *levelNames[] = {"trace", "debug", "info", "warning"};
+	BRPeer *peer = BRPeerNew(0);
+	uint8_t block[1024];
+	memset(block, 0xab, sizeof(block));
+
+	for (int level = spdlog::level::debug; level <= spdlog::level::warn; ++level) {
+		Log::setLevel(Log::Peer, (spdlog::level::level_enum) level);
+		boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+		for (int i = 0; i < blocks; ++i) {
+			peer_dbg(peer, "merkle block orignal data: %s", Utils::encodeHex(block, sizeof(block)).c_str());
+			peer_log(peer, "relayed block %d", i);
+		}
+		boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::universal_time() - start;
+		std::cerr << blocks << " blocks with peer level " << levelNames[level] << ": " << elapsed.total_microseconds()
+				  << " us" << std::endl;
+	}
+
+	BRPeerFree(peer);
+}
@@ -5,8 +5,10 @@
 #define CATCH_CONFIG_MAIN
 
 #include <climits>
+#include <atomic>
 #include <boost/scoped_ptr.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
 #include <SDK/Common/ParamChecker.h>
 #include <SDK/Common/Log.h>
 
@@ -19,12 +21,30 @@
 
 using namespace Elastos::ElaWallet;
 
+class NullSubWalletCallback : public ISubWalletCallback {
+public:
+	virtual void OnTransactionStatusChanged(const std::string &txid, const std::string &status,
+											const nlohmann::json &desc, uint32_t confirms) {}
+
+	virtual void OnBlockSyncStarted() {}
+
+	virtual void OnBlockHeightIncreased(uint32_t currentBlockHeight, double progress) {}
+
+	virtual void OnBlockSyncStopped() {}
+
+	virtual void OnDestroyWallet() {}
+};
+
 class TestMasterWalletManager : public MasterWalletManager {
 public:
 	TestMasterWalletManager() :
 			MasterWalletManager(MasterWalletMap(), "Data") {
 		_p2pEnable = false;
 	}
+
+	void LoadFromRoot() {
+		initMasterWallets();
+	}
 };
 
 
@@ -1249,5 +1269,166 @@ TEST_CASE("Wallet ExportWalletWithMnemonic method", "[ExportWalletWithMnemonic]"
 	}
 }
 
+TEST_CASE("Lazy loading of master wallets", "[MasterWalletManager]") {
+	std::string mnemonic = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+	std::string phrasePassword = "phrasePassword";
+	std::string payPassword = "payPassword";
+	std::vector<std::string> masterWalletIds = {"LazyWallet1", "LazyWallet2", "LazyWallet3", "LazyWallet4"};
+
+	{
+		boost::scoped_ptr<TestMasterWalletManager> masterWalletManager(new TestMasterWalletManager());
+		for (size_t i = 0; i < masterWalletIds.size(); ++i)
+			masterWalletManager->CreateMasterWallet(masterWalletIds[i], mnemonic, phrasePassword, payPassword);
+	}
+
+	boost::scoped_ptr<TestMasterWalletManager> masterWalletManager(new TestMasterWalletManager());
+	masterWalletManager->LoadFromRoot();
+
+	nlohmann::json progress = masterWalletManager->GetLoadingProgress();
+	size_t total = progress["Total"];
+	REQUIRE(total >= masterWalletIds.size());
+	REQUIRE(progress["Loaded"] == 0);
+	REQUIRE(progress["Pending"] == total);
+
+	std::vector<std::string> ids = masterWalletManager->GetAllMasterWalletIds();
+	for (size_t i = 0; i < masterWalletIds.size(); ++i)
+		REQUIRE(std::find(ids.begin(), ids.end(), masterWalletIds[i]) != ids.end());
+
+	SECTION("Wallet is loaded when touched") {
+		IMasterWallet *masterWallet = masterWalletManager->GetWallet(masterWalletIds[0]);
+		REQUIRE(masterWallet != nullptr);
+		REQUIRE(masterWallet->GetId() == masterWalletIds[0]);
+		REQUIRE(masterWalletManager->GetWallet(masterWalletIds[0]) == masterWallet);
+		REQUIRE(masterWalletManager->GetWallet("NotExist") == nullptr);
+
+		progress = masterWalletManager->GetLoadingProgress();
+		REQUIRE(progress["Loaded"] == 1);
+		REQUIRE(progress["Pending"] == total - 1);
+	}
+
+	SECTION("Wallets are loaded in background") {
+		masterWalletManager->LoadAllMasterWallets(2);
+		while (masterWalletManager->GetLoadingProgress()["Loading"] == true)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+
+		progress = masterWalletManager->GetLoadingProgress();
+		REQUIRE(progress["Pending"] == 0);
+		size_t loaded = progress["Loaded"], failed = progress["Failed"];
+		REQUIRE(loaded + failed == total);
+		REQUIRE(masterWalletManager->GetAllMasterWallets().size() == loaded);
+	}
+
+	for (size_t i = 0; i < masterWalletIds.size(); ++i)
+		masterWalletManager->DestroyWallet(masterWalletIds[i]);
+	REQUIRE(masterWalletManager->GetWallet(masterWalletIds[0]) == nullptr);
+}
+
+TEST_CASE("Host mode evicts master wallets", "[MasterWalletManager]") {
+	std::string phrasePassword = "phrasePassword";
+	std::string payPassword = "payPassword";
+	std::vector<std::string> masterWalletIds = {"HostModeWallet1", "HostModeWallet2", "HostModeWallet3"};
+
+	boost::scoped_ptr<TestMasterWalletManager> masterWalletManager(new TestMasterWalletManager());
+	masterWalletManager->EnableHostMode(2, 0);
+
+	for (size_t i = 0; i < masterWalletIds.size(); ++i) {
+		std::string mnemonic = MasterWallet::GenerateMnemonic("english", "Data");
+		REQUIRE(masterWalletManager->CreateMasterWallet(masterWalletIds[i], mnemonic, phrasePassword,
+														payPassword) != nullptr);
+		masterWalletManager->ReleaseWallet(masterWalletIds[i]);
+	}
+
+	nlohmann::json usage = masterWalletManager->GetHostUsage();
+	REQUIRE(usage["Loaded"] == 2);
+	REQUIRE(usage["Evicted"] == 1);
+	REQUIRE(usage["Wallets"].size() == 2);
+	REQUIRE(usage["Wallets"][0]["MemoryBytes"] > 0);
+	REQUIRE(usage["Wallets"][0]["Leases"] == 0);
+	std::vector<IMasterWallet *> loaded = masterWalletManager->GetAllMasterWallets();
+	REQUIRE(loaded.size() == 2);
+	for (size_t i = 0; i < loaded.size(); ++i)
+		masterWalletManager->ReleaseWallet(loaded[i]->GetId());
+	REQUIRE(masterWalletManager->GetAllMasterWalletIds().size() == 3);
+
+	SECTION("Evicted wallet is loaded again when touched") {
+		IMasterWallet *masterWallet = masterWalletManager->GetWallet(masterWalletIds[0]);
+		REQUIRE(masterWallet != nullptr);
+		REQUIRE(masterWallet->GetId() == masterWalletIds[0]);
+		REQUIRE(masterWallet->GetAllSubWallets().size() == 1);
+		masterWalletManager->ReleaseWallet(masterWalletIds[0]);
+
+		usage = masterWalletManager->GetHostUsage();
+		REQUIRE(usage["Loaded"] == 2);
+		REQUIRE(usage["Evicted"] == 2);
+	}
+
+	SECTION("Idle wallets are evicted") {
+		masterWalletManager->EnableHostMode(0, 1);
+		boost::this_thread::sleep(boost::posix_time::milliseconds(2100));
+		REQUIRE(masterWalletManager->EvictIdleWallets() == 2);
+		REQUIRE(masterWalletManager->GetHostUsage()["Loaded"] == 0);
+		REQUIRE(masterWalletManager->GetWallet(masterWalletIds[2]) != nullptr);
+		masterWalletManager->ReleaseWallet(masterWalletIds[2]);
+	}
+
+	SECTION("Leased wallets are not evicted") {
+		IMasterWallet *leased = masterWalletManager->GetWallet(masterWalletIds[1]);
+		REQUIRE(leased != nullptr);
+		masterWalletManager->EnableHostMode(0, 1);
+		boost::this_thread::sleep(boost::posix_time::milliseconds(2100));
+		REQUIRE(masterWalletManager->EvictIdleWallets() == 1);
+		REQUIRE(masterWalletManager->GetHostUsage()["Loaded"] == 1);
+		REQUIRE(leased->GetId() == masterWalletIds[1]);
+		REQUIRE(leased->GetAllSubWallets().size() == 1);
+
+		masterWalletManager->ReleaseWallet(masterWalletIds[1]);
+		REQUIRE(masterWalletManager->EvictIdleWallets() == 1);
+		REQUIRE(masterWalletManager->GetHostUsage()["Loaded"] == 0);
+	}
+
+	SECTION("Leased wallets are not evicted from another thread") {
+		masterWalletManager->EnableHostMode(1, 0);
+		std::atomic<int> broken(0);
+		boost::thread_group hosts;
+		for (size_t t = 0; t < masterWalletIds.size(); ++t) {
+			hosts.create_thread([&masterWalletManager, &masterWalletIds, &broken, t]() {
+				for (size_t i = 0; i < 20; ++i) {
+					const std::string &id = masterWalletIds[(t + i) % masterWalletIds.size()];
+					IMasterWallet *masterWallet = masterWalletManager->GetWallet(id);
+					if (masterWallet == nullptr || masterWallet->GetId() != id ||
+						masterWallet->GetAllSubWallets().size() != 1)
+						broken++;
+					masterWalletManager->ReleaseWallet(id);
+				}
+			});
+		}
+		hosts.join_all();
+		REQUIRE(broken == 0);
 
+		masterWalletManager->EvictIdleWallets();
+		REQUIRE(masterWalletManager->GetHostUsage()["Loaded"] == 1);
+	}
 
+	SECTION("Wallets with callbacks are not evicted") {
+		NullSubWalletCallback callback;
+		IMasterWallet *masterWallet = masterWalletManager->GetWallet(masterWalletIds[2]);
+		REQUIRE(masterWallet != nullptr);
+		ISubWallet *subWallet = masterWallet->GetAllSubWallets()[0];
+		subWallet->AddCallback(&callback);
+		masterWalletManager->ReleaseWallet(masterWalletIds[2]);
+
+		masterWalletManager->EnableHostMode(0, 1);
+		boost::this_thread::sleep(boost::posix_time::milliseconds(2100));
+		REQUIRE(masterWalletManager->EvictIdleWallets() == 1);
+		usage = masterWalletManager->GetHostUsage();
+		REQUIRE(usage["Loaded"] == 1);
+		REQUIRE(usage["Wallets"][0]["HasCallbacks"] == true);
+
+		subWallet->RemoveCallback(&callback);
+		REQUIRE(masterWalletManager->EvictIdleWallets() == 1);
+	}
+
+	for (size_t i = 0; i < masterWalletIds.size(); ++i)
+		masterWalletManager->DestroyWallet(masterWalletIds[i]);
+	REQUIRE(masterWalletManager->GetAllMasterWalletIds().empty());
+}
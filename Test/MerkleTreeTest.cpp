@@ -0,0 +1,152 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include "catch.hpp"
+#include "BRCrypto.h"
+#include "BRMerkleBlock.h"
+#include "MerkleTree.h"
+#include "TestHelper.h"
+
+using namespace Elastos::ElaWallet;
+
+namespace {
+
+	size_t treeWidth(size_t txCount, int height) {
+		return (txCount + (size_t(1) << height) - 1) >> height;
+	}
+
+	UInt256 calcHash(const std::vector<UInt256> &txHashes, int height, size_t pos) {
+		if (height == 0)
+			return txHashes[pos];
+
+		UInt256 hashes[2], md;
+		hashes[0] = calcHash(txHashes, height - 1, pos * 2);
+		if (pos * 2 + 1 < treeWidth(txHashes.size(), height - 1))
+			hashes[1] = calcHash(txHashes, height - 1, pos * 2 + 1);
+		else
+			hashes[1] = hashes[0];
+		BRSHA256_2(&md, hashes, sizeof(hashes));
+		return md;
+	}
+
+	// builds a partial merkle tree the way full nodes do for merkleblock messages
+	void traverseAndBuild(const std::vector<UInt256> &txHashes, const std::vector<bool> &matches, int height,
+						  size_t pos, std::vector<bool> &bits, std::vector<UInt256> &hashes) {
+		bool parentOfMatch = false;
+		for (size_t p = pos << height; p < ((pos + 1) << height) && p < txHashes.size(); ++p)
+			parentOfMatch |= matches[p];
+
+		bits.push_back(parentOfMatch);
+		if (height == 0 || !parentOfMatch) {
+			hashes.push_back(calcHash(txHashes, height, pos));
+		} else {
+			traverseAndBuild(txHashes, matches, height - 1, pos * 2, bits, hashes);
+			if (pos * 2 + 1 < treeWidth(txHashes.size(), height - 1))
+				traverseAndBuild(txHashes, matches, height - 1, pos * 2 + 1, bits, hashes);
+		}
+	}
+
+	BRMerkleBlock *createPartialTree(uint32_t totalTx, const std::vector<UInt256> &hashes,
+									 const std::vector<uint8_t> &flags) {
+		BRMerkleBlock *block = BRMerkleBlockNew(nullptr);
+		block->totalTx = totalTx;
+		BRMerkleBlockSetTxHashes(block, hashes.data(), hashes.size(), flags.data(), flags.size());
+		return block;
+	}
+
+	UInt256 recursiveRoot(const BRMerkleBlock *block) {
+		size_t hashIdx = 0, flagIdx = 0;
+		return MerkleTree::PartialRootRecursive(&hashIdx, &flagIdx, 0, *block);
+	}
+
+}
+
+TEST_CASE("Full merkle tree", "[MerkleTree]") {
+	SECTION("empty and single leaf") {
+		std::vector<UInt256> leaves;
+		UInt256 zero = UINT256_ZERO, root = MerkleTree::Root(leaves);
+		REQUIRE(UInt256Eq(&root, &zero));
+
+		leaves.push_back(getRandUInt256());
+		root = MerkleTree::Root(leaves);
+		REQUIRE(UInt256Eq(&root, &leaves[0]));
+	}
+
+	SECTION("matches the recursive definition") {
+		for (size_t count = 1; count < 70; ++count) {
+			std::vector<UInt256> leaves(count);
+			for (size_t i = 0; i < count; ++i)
+				leaves[i] = getRandUInt256();
+
+			int height = 0;
+			while (treeWidth(count, height) > 1) height++;
+
+			UInt256 expect = calcHash(leaves, height, 0), root = MerkleTree::Root(leaves);
+			REQUIRE(UInt256Eq(&root, &expect));
+		}
+	}
+}
+
+TEST_CASE("Partial merkle tree", "[MerkleTree]") {
+	srand(time(nullptr));
+
+	SECTION("well formed trees give the block merkle root") {
+		for (int round = 0; round < 300; ++round) {
+			size_t count = 1 + rand() % 300;
+			std::vector<UInt256> txHashes(count);
+			std::vector<bool> matches(count);
+			for (size_t i = 0; i < count; ++i) {
+				txHashes[i] = getRandUInt256();
+				matches[i] = rand() % 8 == 0;
+			}
+
+			int height = 0;
+			while (treeWidth(count, height) > 1) height++;
+
+			std::vector<bool> bits;
+			std::vector<UInt256> hashes;
+			traverseAndBuild(txHashes, matches, height, 0, bits, hashes);
+
+			std::vector<uint8_t> flags((bits.size() + 7) / 8, 0);
+			for (size_t i = 0; i < bits.size(); ++i)
+				flags[i / 8] |= bits[i] << (i % 8);
+
+			BRMerkleBlock *block = createPartialTree((uint32_t)count, hashes, flags);
+			UInt256 expect = MerkleTree::Root(txHashes);
+			UInt256 reference = recursiveRoot(block), root = MerkleTree::PartialRoot(*block);
+
+			REQUIRE(UInt256Eq(&reference, &expect));
+			REQUIRE(UInt256Eq(&root, &expect));
+			BRMerkleBlockFree(nullptr, block);
+		}
+	}
+
+	SECTION("fuzz against the recursive walk") {
+		for (int round = 0; round < 3000; ++round) {
+			uint32_t totalTx = (uint32_t)(rand() % 5 == 0 ? rand() : rand() % 64);
+			std::vector<UInt256> hashes(rand() % 40);
+			std::vector<uint8_t> flags(rand() % 12);
+
+			for (size_t i = 0; i < hashes.size(); ++i) {
+				int kind = rand() % 10;
+				if (kind == 0 && i > 0)
+					hashes[i] = hashes[i - 1]; // duplicate siblings (CVE-2012-2459)
+				else if (kind == 1)
+					hashes[i] = UINT256_ZERO;
+				else
+					hashes[i] = getRandUInt256();
+			}
+			for (size_t i = 0; i < flags.size(); ++i)
+				flags[i] = (uint8_t)rand();
+
+			BRMerkleBlock *block = createPartialTree(totalTx, hashes, flags);
+			UInt256 reference = recursiveRoot(block), root = MerkleTree::PartialRoot(*block);
+
+			REQUIRE(UInt256Eq(&root, &reference));
+			BRMerkleBlockFree(nullptr, block);
+		}
+	}
+}
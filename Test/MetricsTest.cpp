@@ -0,0 +1,123 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <boost/thread.hpp>
+
+#include "catch.hpp"
+#include "BRMetrics.h"
+#include "Metrics.h"
+
+using namespace Elastos::ElaWallet;
+
+static bool contains(const std::string &text, const std::string &line) {
+	return text.find(line + "\n") != std::string::npos;
+}
+
+TEST_CASE("Metric histogram", "[Metrics]") {
+	double bounds[] = {1, 0.1, 10};
+	MetricHistogram histogram(std::vector<double>(bounds, bounds + 3));
+
+	REQUIRE(histogram.GetBounds()[0] == 0.1);
+	histogram.Observe(0.05);
+	histogram.Observe(0.1);
+	histogram.Observe(5);
+	histogram.Observe(100);
+
+	std::vector<uint64_t> counts = histogram.GetBucketCounts();
+	REQUIRE(counts.size() == 4);
+	REQUIRE(counts[0] == 2);
+	REQUIRE(counts[1] == 0);
+	REQUIRE(counts[2] == 1);
+	REQUIRE(counts[3] == 1);
+	REQUIRE(histogram.GetCount() == 4);
+	REQUIRE(histogram.GetSum() == Approx(105.15));
+}
+
+TEST_CASE("Metrics registry", "[Metrics]") {
+	Metrics &metrics = Metrics::Instance();
+
+	SECTION("Same name and labels is the same series") {
+		MetricCounter &a = metrics.Counter("test_registry_total", "Test counter.", "kind=\"a\"");
+		REQUIRE(&a == &metrics.Counter("test_registry_total", "Test counter.", "kind=\"a\""));
+		REQUIRE(&a != &metrics.Counter("test_registry_total", "Test counter.", "kind=\"b\""));
+		REQUIRE_THROWS_AS(metrics.Histogram("test_registry_total", "", Metrics::LatencyBuckets()), std::logic_error);
+	}
+
+	SECTION("Counters from many threads") {
+		MetricCounter &counter = metrics.Counter("test_threads_total", "Test counter.");
+		boost::thread_group threads;
+		for (int i = 0; i < 4; ++i) {
+			threads.create_thread([&counter] {
+				for (int j = 0; j < 10000; ++j)
+					counter.Increment();
+			});
+		}
+		threads.join_all();
+		REQUIRE(counter.Value() == 40000);
+	}
+
+	SECTION("Prometheus text") {
+		metrics.Counter("test_messages_total", "Test messages.", "type=\"tx\"").Increment(3);
+		double bounds[] = {0.5, 1};
+		MetricHistogram &latency = metrics.Histogram("test_latency_seconds", "Test latency.",
+													 std::vector<double>(bounds, bounds + 2), "op=\"step\"");
+		latency.Observe(0.25);
+		latency.Observe(2);
+		BRMetricAdd(BRMetricBytesReceived, 42);
+		BRMetricSet(BRMetricFalsePositiveRate, 0.0005);
+
+		std::string text = metrics.RenderPrometheus();
+		REQUIRE(contains(text, "# HELP test_messages_total Test messages."));
+		REQUIRE(contains(text, "# TYPE test_messages_total counter"));
+		REQUIRE(contains(text, "test_messages_total{type=\"tx\"} 3"));
+		REQUIRE(contains(text, "# TYPE test_latency_seconds histogram"));
+		REQUIRE(contains(text, "test_latency_seconds_bucket{op=\"step\",le=\"0.5\"} 1"));
+		REQUIRE(contains(text, "test_latency_seconds_bucket{op=\"step\",le=\"1\"} 1"));
+		REQUIRE(contains(text, "test_latency_seconds_bucket{op=\"step\",le=\"+Inf\"} 2"));
+		REQUIRE(contains(text, "test_latency_seconds_sum{op=\"step\"} 2.25"));
+		REQUIRE(contains(text, "test_latency_seconds_count{op=\"step\"} 2"));
+		REQUIRE(contains(text, "spv_peer_received_bytes_total 42"));
+		REQUIRE(contains(text, "spv_bloom_false_positive_rate 0.0005"));
+
+		boost::filesystem::path path = boost::filesystem::temp_directory_path() / "spvsdk_metrics.prom";
+		REQUIRE(metrics.DumpToFile(path));
+		std::ifstream in(path.string());
+		std::stringstream dumped;
+		dumped << in.rdbuf();
+		REQUIRE(contains(dumped.str(), "test_messages_total{type=\"tx\"} 3"));
+		REQUIRE(!boost::filesystem::exists(path.string() + ".tmp"));
+		boost::filesystem::remove(path);
+	}
+}
+
+TEST_CASE("Core block rate", "[Metrics]") {
+	uint64_t received = BRMetricGet(BRMetricBlocksReceived);
+	for (int i = 0; i < 10; ++i)
+		BRMetricBlockReceived();
+	boost::this_thread::sleep(boost::posix_time::milliseconds(1100));
+	BRMetricBlockReceived();
+
+	REQUIRE(BRMetricGet(BRMetricBlocksReceived) == received + 11);
+	REQUIRE(BRMetricGaugeGet(BRMetricBlocksPerSecond) > 5);
+	REQUIRE(BRMetricGaugeGet(BRMetricBlocksPerSecond) < 11);
+}
+
+TEST_CASE("Metric counter benchmark", "[.benchmark]") {
+	MetricCounter &counter = Metrics::Instance().Counter("test_benchmark_total", "Benchmark counter.");
+	MetricHistogram &latency = Metrics::Instance().Histogram("test_benchmark_seconds", "Benchmark latency.",
+															 Metrics::LatencyBuckets());
+	boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+	for (int i = 0; i < 10000000; ++i) {
+		counter.Increment();
+		latency.Observe(0.001);
+	}
+	boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::universal_time() - start;
+	std::cout << "10M counter and histogram updates: " << elapsed.total_milliseconds() << " ms" << std::endl;
+}
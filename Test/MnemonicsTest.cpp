@@ -4,10 +4,16 @@
 
 #define CATCH_CONFIG_MAIN
 
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
 #include "BRBIP39Mnemonic.h"
 
 #include "catch.hpp"
 #include "KeyStore/Mnemonic.h"
+#include "KeyStore/BIP39WordList.h"
+#include "TestHelper.h"
 
 using namespace Elastos::ElaWallet;
 
@@ -59,4 +65,102 @@ TEST_CASE("Mnemonic of Spanish test", "[Spanish]") {
 	REQUIRE(mnemonic.words().size() == BIP39_WORDLIST_COUNT);
 	REQUIRE(mnemonic.words()[0] == "ábaco");
 	REQUIRE(mnemonic.words()[BIP39_WORDLIST_COUNT - 1] == "zurdo");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Built in word lists", "[BIP39WordList]") {
+	std::vector<std::string> languages = BIP39WordList::Languages();
+	REQUIRE(languages.size() == 6);
+
+	SECTION("same words as the language files") {
+		for (size_t i = 0; i < languages.size(); ++i) {
+			const BIP39WordList *list = BIP39WordList::Get(languages[i]);
+			REQUIRE(list != nullptr);
+
+			if (languages[i] != "english") {
+				std::ifstream infile(I18N_RELATIVE_PATH "mnemonic_" + languages[i] + ".txt");
+				std::string line;
+				for (uint32_t index = 0; std::getline(infile, line); ++index)
+					REQUIRE(line == list->Word(index));
+			}
+		}
+		REQUIRE(BIP39WordList::Get("klingon") == nullptr);
+	}
+
+	SECTION("every word of every list round trips") {
+		for (size_t i = 0; i < languages.size(); ++i) {
+			const BIP39WordList *list = BIP39WordList::Get(languages[i]);
+			REQUIRE(list != nullptr);
+
+			const char **words = list->Words();
+			for (uint32_t index = 0; index < BIP39_WORDLIST_COUNT; ++index) {
+				std::string word = list->Word(index);
+				REQUIRE(word == words[index]);
+				REQUIRE(list->IndexOf(word.c_str(), word.size()) == (int) index);
+				// a proper prefix of a word is not found as that word
+				REQUIRE(list->IndexOf(word.c_str(), word.size() - 1) != (int) index);
+			}
+			REQUIRE(list->IndexOf("notaword", 8) == -1);
+		}
+	}
+
+	SECTION("decoding agrees with BRBIP39Decode") {
+		srand(time(nullptr));
+		for (size_t i = 0; i < languages.size(); ++i) {
+			const BIP39WordList *list = BIP39WordList::Get(languages[i]);
+
+			for (int round = 0; round < 500; ++round) {
+				CMBlock entropy = getRandCMBlock(16 + 4 * (rand() % 5));
+				char phrase[BIP39_WORDLIST_COUNT];
+				BRBIP39Encode(phrase, sizeof(phrase), list->Words(), entropy, entropy.GetSize());
+
+				std::string str(phrase);
+				if (round % 4 == 1)
+					str[rand() % str.size()] = (char) (1 + rand() % 255);
+				else if (round % 4 == 2)
+					str = str.substr(0, str.rfind(' '));
+
+				uint8_t expect[32] = {0}, actual[32] = {0};
+				size_t expectLen = BRBIP39Decode(expect, sizeof(expect), list->Words(), str.c_str());
+				REQUIRE(list->Decode(actual, sizeof(actual), str) == expectLen);
+				REQUIRE(memcmp(actual, expect, sizeof(expect)) == 0);
+				if (round % 4 == 0)
+					REQUIRE(expectLen == entropy.GetSize());
+			}
+		}
+	}
+
+	SECTION("normalization and language detection") {
+		REQUIRE(BIP39WordList::Normalize("  Abandon\t\tABOUT\xE3\x80\x80zoo \n") == "abandon about zoo");
+		REQUIRE(BIP39WordList::DetectLanguage("abandon about zoo") == "english");
+		REQUIRE(BIP39WordList::DetectLanguage("的 歇") == "chinese");
+		REQUIRE(BIP39WordList::DetectLanguage("abandon 的").empty());
+	}
+}
+
+TEST_CASE("Bulk mnemonic import", "[.benchmark]") {
+	const size_t count = 10000;
+	const BIP39WordList *list = BIP39WordList::Get("english");
+	std::vector<std::string> phrases;
+
+	for (size_t i = 0; i < count; ++i) {
+		CMBlock entropy = getRandCMBlock(16);
+		char phrase[BIP39_WORDLIST_COUNT];
+		BRBIP39Encode(phrase, sizeof(phrase), list->Words(), entropy, entropy.GetSize());
+		phrases.push_back(phrase);
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	size_t valid = 0;
+	for (size_t i = 0; i < count; ++i)
+		valid += BRBIP39PhraseIsValid(list->Words(), phrases[i].c_str());
+	std::chrono::duration<double> linear = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < count; ++i)
+		valid += list->PhraseIsValid(BIP39WordList::Normalize(phrases[i]));
+	std::chrono::duration<double> hashed = std::chrono::steady_clock::now() - start;
+
+	REQUIRE(valid == 2 * count);
+	std::cout << count << " phrases validated, linear search " << linear.count() * 1000 << " ms, hash index "
+			  << hashed.count() * 1000 << " ms" << std::endl;
+}
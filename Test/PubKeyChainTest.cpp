@@ -0,0 +1,92 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <catch.hpp>
+
+#include "BRBIP32Sequence.h"
+#include "MasterPubKey.h"
+#include "PubKeyChain.h"
+#include "Utils.h"
+
+using namespace Elastos::ElaWallet;
+
+static BRMasterPubKey testMasterPubKey() {
+	BRMasterPubKey mpk = BR_MASTER_PUBKEY_NONE;
+	CMBlock pubKey = Utils::decodeHex("02fb50388f29498d0a93ad25ec4c34037b9d3cc3cca4787eb6fedabe2b3003eac8");
+	memcpy(mpk.pubKey, pubKey, sizeof(mpk.pubKey));
+	for (size_t i = 0; i < sizeof(mpk.chainCode); ++i)
+		mpk.chainCode.u8[i] = (uint8_t) (i * 7 + 1);
+	return mpk;
+}
+
+TEST_CASE("PubKeyChain derives known addresses", "[PubKeyChain]") {
+	BRMasterPubKey mpk = testMasterPubKey();
+
+	PubKeyChain external(mpk, SEQUENCE_EXTERNAL_CHAIN);
+	REQUIRE(external.IsValid());
+	REQUIRE(Utils::encodeHex(external.DerivePubKeys(0, 1)[0]) ==
+			"02568454450f496b932e5e312212ac35abc702f24b42cd0be5f2afcef7f653bc34");
+	REQUIRE(external.DeriveAddresses(0, 1)[0] == "EMNGYgJcUBHQpDBqQAbHaxhq1h1PsYovNX");
+	REQUIRE(external.DeriveAddresses(5, 1)[0] == "EfZXSZTu8ENcemhq6xADL26oHNowpJBxHs");
+	REQUIRE(external.DeriveAddresses(1500, 1)[0] == "EcPKdpihEkqq43ye5A5hhPSkX4kZiRzxfv");
+
+	PubKeyChain internal(mpk, SEQUENCE_INTERNAL_CHAIN);
+	REQUIRE(internal.IsValid());
+	REQUIRE(Utils::encodeHex(internal.DerivePubKeys(0, 1)[0]) ==
+			"02326a312d236332c6ee722f3a556355d058f044a0d1bf8df48c28a8c51fc01069");
+	REQUIRE(internal.DeriveAddresses(0, 1)[0] == "EHNAuWS8cKHrWdsTRzFsoivCH8YBBv72de");
+	REQUIRE(internal.DeriveAddresses(5, 1)[0] == "Ebjk92nZ8jvyuse1HUdGyfAsW6FSSCWnsP");
+	REQUIRE(internal.DeriveAddresses(1500, 1)[0] == "ETmmX9zTNKT7GQGHDRfjPa6KnBRpddYFHx");
+}
+
+TEST_CASE("PubKeyChain batches match single derivations", "[PubKeyChain]") {
+	BRMasterPubKey mpk = testMasterPubKey();
+	PubKeyChain chain(mpk, SEQUENCE_EXTERNAL_CHAIN);
+
+	// more than one batch, the second one partial
+	size_t count = PUBKEY_CHAIN_BATCH_SIZE + 100;
+	std::vector<CMBlock> pubKeys = chain.DerivePubKeys(3, count);
+	std::vector<std::string> addresses = chain.DeriveAddresses(3, count);
+	REQUIRE(pubKeys.size() == count);
+	REQUIRE(addresses.size() == count);
+
+	for (size_t i = 0; i < count; i += 97) {
+		std::vector<CMBlock> single = chain.DerivePubKeys((uint32_t) (3 + i), 1);
+		REQUIRE(single.size() == 1);
+		REQUIRE(single[0].GetSize() == 33);
+		REQUIRE(0 == memcmp(single[0], pubKeys[i], 33));
+		REQUIRE(chain.DeriveAddresses((uint32_t) (3 + i), 1)[0] == addresses[i]);
+	}
+
+	REQUIRE(chain.DerivePubKeys(0, 0).empty());
+	REQUIRE(chain.DerivePubKeys(BIP32_HARD, 1).empty());
+}
+
+TEST_CASE("PubKeyChain rejects an invalid master public key", "[PubKeyChain]") {
+	BRMasterPubKey mpk = testMasterPubKey();
+	mpk.pubKey[0] = 0x05;
+
+	PubKeyChain chain(mpk, SEQUENCE_EXTERNAL_CHAIN);
+	REQUIRE(!chain.IsValid());
+	REQUIRE(chain.DerivePubKeys(0, 10).empty());
+	REQUIRE(chain.DeriveAddresses(0, 10).empty());
+}
+
+TEST_CASE("PubKeyChain agrees with MasterPubKey::BIP32PubKey", "[PubKeyChain]") {
+	BRMasterPubKey mpk = testMasterPubKey();
+
+	for (uint32_t chain = SEQUENCE_EXTERNAL_CHAIN; chain <= SEQUENCE_INTERNAL_CHAIN; ++chain) {
+		PubKeyChain keyChain(mpk, chain);
+		std::vector<CMBlock> pubKeys = keyChain.DerivePubKeys(0, 20);
+		REQUIRE(pubKeys.size() == 20);
+
+		for (uint32_t i = 0; i < pubKeys.size(); ++i) {
+			uint8_t pubKey[33];
+			REQUIRE(MasterPubKey::BIP32PubKey(pubKey, sizeof(pubKey), mpk, chain, i) == sizeof(pubKey));
+			REQUIRE(0 == memcmp(pubKey, pubKeys[i], sizeof(pubKey)));
+		}
+	}
+}
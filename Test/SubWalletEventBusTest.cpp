@@ -0,0 +1,227 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <boost/thread.hpp>
+
+#include "catch.hpp"
+#include "SubWalletEventBus.h"
+
+using namespace Elastos::ElaWallet;
+
+class RecordingCallback : public ISubWalletCallback {
+public:
+	virtual void OnTransactionStatusChanged(const std::string &txid, const std::string &status,
+											const nlohmann::json &desc, uint32_t confirms) {
+		boost::mutex::scoped_lock lock(_lock);
+		events.push_back(status + ":" + txid + ":" + std::to_string(confirms));
+	}
+
+	virtual void OnBalanceChanged(uint64_t balance) {
+		boost::mutex::scoped_lock lock(_lock);
+		events.push_back("balance:" + std::to_string(balance));
+	}
+
+	virtual void OnBlockSyncStarted() {
+		boost::mutex::scoped_lock lock(_lock);
+		events.push_back("started");
+	}
+
+	virtual void OnBlockHeightIncreased(uint32_t currentBlockHeight, double progress) {
+		boost::mutex::scoped_lock lock(_lock);
+		events.push_back("height:" + std::to_string(currentBlockHeight));
+	}
+
+	virtual void OnBlockSyncStopped() {
+		boost::mutex::scoped_lock lock(_lock);
+		events.push_back("stopped");
+	}
+
+	virtual void OnDestroyWallet() {
+		boost::mutex::scoped_lock lock(_lock);
+		events.push_back("destroyed");
+	}
+
+	std::vector<std::string> Events() {
+		boost::mutex::scoped_lock lock(_lock);
+		return events;
+	}
+
+private:
+	boost::mutex _lock;
+	std::vector<std::string> events;
+};
+
+// Blocks in OnBlockSyncStarted() until released
+class BlockingCallback : public RecordingCallback {
+public:
+	BlockingCallback() : _entered(false), _released(false) {}
+
+	virtual void OnBlockSyncStarted() {
+		boost::mutex::scoped_lock lock(_waitLock);
+		_entered = true;
+		_cond.notify_all();
+		while (!_released)
+			_cond.wait(lock);
+		lock.unlock();
+		RecordingCallback::OnBlockSyncStarted();
+	}
+
+	void WaitEntered() {
+		boost::mutex::scoped_lock lock(_waitLock);
+		while (!_entered)
+			_cond.wait(lock);
+	}
+
+	void Release() {
+		boost::mutex::scoped_lock lock(_waitLock);
+		_released = true;
+		_cond.notify_all();
+	}
+
+private:
+	boost::mutex _waitLock;
+	boost::condition_variable _cond;
+	bool _entered;
+	bool _released;
+};
+
+// Unsubscribes itself on the first transaction status
+class SelfRemovingCallback : public RecordingCallback {
+public:
+	explicit SelfRemovingCallback(SubWalletEventBus &bus) : _bus(bus) {}
+
+	virtual void OnTransactionStatusChanged(const std::string &txid, const std::string &status,
+											const nlohmann::json &desc, uint32_t confirms) {
+		RecordingCallback::OnTransactionStatusChanged(txid, status, desc, confirms);
+		_bus.Unsubscribe(this);
+	}
+
+private:
+	SubWalletEventBus &_bus;
+};
+
+static void publishSync(SubWalletEventBus &bus) {
+	bus.BlockSyncStarted();
+	bus.TransactionStatusChanged("tx1", "Added", nlohmann::json(), 0);
+	for (uint32_t height = 100; height < 110; ++height) {
+		bus.TransactionStatusChanged("tx1", "Updated", nlohmann::json(), height - 99);
+		bus.BalanceChanged(height);
+		bus.BlockHeightIncreased(height, 0.1);
+	}
+	bus.TransactionStatusChanged("tx2", "Deleted", nlohmann::json(), 0);
+}
+
+TEST_CASE("Sub wallet event bus", "[SubWalletEventBus]") {
+	SubWalletEventBus bus;
+	RecordingCallback immediate, batched;
+
+	SECTION("Immediate subscribers see every event") {
+		bus.Subscribe(&immediate);
+		publishSync(bus);
+		bus.BlockSyncStopped();
+
+		std::vector<std::string> events = immediate.Events();
+		REQUIRE(events.size() == 1 + 1 + 10 * 3 + 1 + 1);
+		REQUIRE(events.front() == "started");
+		REQUIRE(events[1] == "Added:tx1:0");
+		REQUIRE(events[2] == "Updated:tx1:1");
+		REQUIRE(events.back() == "stopped");
+	}
+
+	SECTION("Batched subscribers get coalesced events") {
+		bus.Subscribe(&batched, 200, 60000);
+		publishSync(bus);
+
+		std::vector<std::string> events = batched.Events();
+		REQUIRE(events.size() == 2);
+		REQUIRE(events[0] == "started");
+		REQUIRE(events[1] == "height:100");
+
+		boost::this_thread::sleep(boost::posix_time::milliseconds(500));
+		events = batched.Events();
+		REQUIRE(events.size() == 6);
+		REQUIRE(events[2] == "Added:tx1:0");
+		REQUIRE(events[3] == "Updated:tx1:10");
+		REQUIRE(events[4] == "Deleted:tx2:0");
+		REQUIRE(events[5] == "balance:109");
+
+		bus.BlockSyncStopped();
+		events = batched.Events();
+		REQUIRE(events.size() == 8);
+		REQUIRE(events[6] == "height:109");
+		REQUIRE(events[7] == "stopped");
+	}
+
+	SECTION("Mixed subscribers") {
+		bus.Subscribe(&immediate);
+		bus.Subscribe(&batched, 60000, 60000);
+		publishSync(bus);
+		REQUIRE(immediate.Events().size() == 1 + 1 + 10 * 3 + 1);
+		REQUIRE(batched.Events().size() == 2);
+
+		bus.Unsubscribe(&batched);
+		bus.DestroyWallet();
+		REQUIRE(immediate.Events().back() == "destroyed");
+		REQUIRE(batched.Events().size() == 2);
+
+		REQUIRE(bus.HasSubscribers());
+		bus.Unsubscribe(&immediate);
+		REQUIRE_FALSE(bus.HasSubscribers());
+	}
+
+	SECTION("Unsubscribe waits for a delivery in flight") {
+		BlockingCallback blocking;
+		bus.Subscribe(&blocking);
+
+		boost::thread publisher([&bus]() { bus.BlockSyncStarted(); });
+		blocking.WaitEntered();
+
+		bool unsubscribed = false;
+		boost::mutex unsubscribedLock;
+		boost::thread unsubscriber([&]() {
+			bus.Unsubscribe(&blocking);
+			boost::mutex::scoped_lock lock(unsubscribedLock);
+			unsubscribed = true;
+		});
+
+		boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+		{
+			boost::mutex::scoped_lock lock(unsubscribedLock);
+			REQUIRE(!unsubscribed);
+		}
+
+		blocking.Release();
+		unsubscriber.join();
+		publisher.join();
+		REQUIRE(unsubscribed);
+		REQUIRE(blocking.Events().size() == 1);
+
+		publishSync(bus);
+		bus.BlockSyncStopped();
+		REQUIRE(blocking.Events().size() == 1);
+	}
+
+	SECTION("Callback unsubscribes itself") {
+		SelfRemovingCallback immediateSelf(bus), batchedSelf(bus);
+		bus.Subscribe(&immediateSelf);
+		bus.Subscribe(&batchedSelf, 60000, 60000);
+
+		publishSync(bus);
+		bus.BlockSyncStopped();
+
+		std::vector<std::string> events = immediateSelf.Events();
+		REQUIRE(events.size() == 2);
+		REQUIRE(events[0] == "started");
+		REQUIRE(events[1] == "Added:tx1:0");
+
+		// the forced flush stops after the first status of the batch
+		events = batchedSelf.Events();
+		REQUIRE(events.size() == 3);
+		REQUIRE(events[0] == "started");
+		REQUIRE(events[1] == "height:100");
+		REQUIRE(events[2] == "Added:tx1:0");
+	}
+}
@@ -160,12 +160,32 @@ TEST_CASE("Sub wallet basic", "[SubWallet]") {
 		std::vector<std::string> addresses2 = j2["Addresses"].get<std::vector<std::string>>();
 		REQUIRE(addresses.size() == addresses2.size());
 	}
+	SECTION("Address paging") {
+		nlohmann::json j = subWallet->GetAllAddress(2, 3);
+		std::vector<std::string> addresses = j["Addresses"].get<std::vector<std::string>>();
+		REQUIRE(addresses.size() == 3);
+		for (int i = 0; i < addresses.size(); ++i) {
+			REQUIRE(addresses[i] == DefaultAddress[i + 2]);
+		}
+		REQUIRE(subWallet->GetAllAddressString(2, 3) == j.dump());
+
+		j = subWallet->GetAllAddress(DefaultAddress.size() - 1, INT_MAX);
+		REQUIRE(j["Addresses"].size() == 1);
+		REQUIRE(subWallet->GetAllAddressString(DefaultAddress.size() - 1, INT_MAX) == j.dump());
+
+		j = subWallet->GetAllAddress(DefaultAddress.size() + 1, 5);
+		REQUIRE(j["Addresses"].empty());
+		REQUIRE(subWallet->GetAllAddressString(DefaultAddress.size() + 1, 5) == j.dump());
+
+		REQUIRE(subWallet->GetAllAddressString(0, INT_MAX) == subWallet->GetAllAddress(0, INT_MAX).dump());
+	}
 	SECTION("Balance related") {
 		REQUIRE(subWallet->GetBalance() == 0);
 
 		nlohmann::json balanceInfo = subWallet->GetBalanceInfo();
 		std::vector<nlohmann::json> balanceList = balanceInfo["Balances"];
 		REQUIRE(balanceList.empty());
+		REQUIRE(subWallet->GetBalanceInfoString() == balanceInfo.dump());
 
 		std::string newAddress = subWallet->CreateAddress();
 		REQUIRE(!newAddress.empty());
@@ -244,6 +264,16 @@ TEST_CASE("Sub wallet send transaction", "SubWallet") {
 		REQUIRE(result["Fee"].get<uint64_t>() == BASIC_UINT);
 	}
 
+	SECTION("Stream json the same as dump") {
+		REQUIRE(subWallet->GetBalanceInfoString() == subWallet->GetBalanceInfo().dump());
+
+		REQUIRE(subWallet->GetAllTransactionString(0, INT_MAX, "") ==
+				subWallet->GetAllTransaction(0, INT_MAX, "").dump());
+		REQUIRE(subWallet->GetAllTransactionString(1, 1, "") == subWallet->GetAllTransaction(1, 1, "").dump());
+		REQUIRE(subWallet->GetAllTransactionString(0, INT_MAX, DefaultAddress[0]) ==
+				subWallet->GetAllTransaction(0, INT_MAX, DefaultAddress[0]).dump());
+	}
+
 	SECTION("send raw transaction") {
 
 	}
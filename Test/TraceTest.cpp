@@ -0,0 +1,97 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <fstream>
+#include <boost/filesystem.hpp>
+#include <nlohmann/json.hpp>
+
+#include "catch.hpp"
+#include "BRTrace.h"
+#include "Trace.h"
+
+using namespace Elastos::ElaWallet;
+
+static nlohmann::json readTrace(const boost::filesystem::path &path) {
+	std::ifstream in(path.string());
+	nlohmann::json j;
+	in >> j;
+	return j;
+}
+
+static std::vector<nlohmann::json> spans(const nlohmann::json &trace) {
+	std::vector<nlohmann::json> result;
+	for (nlohmann::json::const_iterator it = trace["traceEvents"].begin(); it != trace["traceEvents"].end(); ++it) {
+		if ((*it)["ph"] == "X")
+			result.push_back(*it);
+	}
+	return result;
+}
+
+TEST_CASE("Trace spans", "[Trace]") {
+	boost::filesystem::path path = boost::filesystem::temp_directory_path() / "spvsdk_trace_test.json";
+	boost::filesystem::remove(path);
+
+	SECTION("Spans are not recorded while tracing is off") {
+		REQUIRE(!Trace::IsRecording());
+		REQUIRE(BRTraceBegin() == 0);
+		{
+			TraceSpan span("db", "off");
+			REQUIRE(!span.IsRecording());
+			span.SetArg("wallet", "id");
+		}
+
+		Trace::Start();
+		REQUIRE(Trace::Stop(path));
+		nlohmann::json trace = readTrace(path);
+		REQUIRE(spans(trace).empty());
+		REQUIRE(trace["otherData"]["droppedEvents"] == 0);
+	}
+
+	SECTION("Sdk and core spans are written as a chrome trace") {
+		Trace::Start();
+		REQUIRE(Trace::IsRecording());
+		{
+			TraceSpan outer("wallet", "outer");
+			outer.SetArg("wallet", "master/ELA");
+			TraceSpan inner("db", "inner \"quoted\"");
+		}
+		uint64_t start = BRTraceBegin();
+		REQUIRE(start != 0);
+		BRTraceEnd("peer", "_peerRelayedBlock", "peer", "127.0.0.1:20866", start);
+		REQUIRE(Trace::Stop(path));
+		REQUIRE(!Trace::IsRecording());
+
+		std::vector<nlohmann::json> events = spans(readTrace(path));
+		REQUIRE(events.size() == 3);
+		// spans are recorded when they end
+		REQUIRE(events[0]["name"] == "inner \"quoted\"");
+		REQUIRE(events[0]["cat"] == "db");
+		REQUIRE(events[1]["name"] == "outer");
+		REQUIRE(events[1]["args"]["wallet"] == "master/ELA");
+		REQUIRE(events[1]["ts"].get<uint64_t>() <= events[0]["ts"].get<uint64_t>());
+		REQUIRE(events[1]["dur"].get<uint64_t>() >= events[0]["dur"].get<uint64_t>());
+		REQUIRE(events[2]["cat"] == "peer");
+		REQUIRE(events[2]["args"]["peer"] == "127.0.0.1:20866");
+		REQUIRE(events[0]["tid"] == events[2]["tid"]);
+	}
+
+	SECTION("Spans over the limit are dropped") {
+		Trace::Start(2);
+		for (int i = 0; i < 5; ++i)
+			TraceSpan span("wallet", "span");
+		REQUIRE(Trace::Stop(path));
+
+		nlohmann::json trace = readTrace(path);
+		REQUIRE(spans(trace).size() == 2);
+		REQUIRE(trace["otherData"]["droppedEvents"] == 3);
+	}
+
+	SECTION("Wallet id of a database path") {
+		REQUIRE(Trace::WalletIdFromDbPath("/data/spv/master1/ELA.db") == "master1/ELA");
+	}
+
+	boost::filesystem::remove(path);
+}
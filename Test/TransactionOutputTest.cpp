@@ -46,6 +46,7 @@ TEST_CASE("TransactionOutput test", "[TransactionOutput]") {
 		transactionOutput.setAddress(content);
 		std::string address = transactionOutput.getAddress();
 		REQUIRE(address == content);
+		REQUIRE(Utils::UInt168ToAddress(transactionOutput.getProgramHash()) == content);
 	}
 
 	SECTION("Serialize and deserialize test", "") {
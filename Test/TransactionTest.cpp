@@ -16,9 +16,34 @@
 #include "Utils.h"
 #include "Log.h"
 #include "TestHelper.h"
+#include "JsonWriter.h"
+#include "AddressRegisteringWallet.h"
 
 using namespace Elastos::ElaWallet;
 
+class TestListener : public Wallet::Listener {
+public:
+	virtual void balanceChanged(uint64_t balance) {}
+
+	virtual void onTxAdded(const TransactionPtr &transaction) {}
+
+	virtual void onTxUpdated(const std::string &hash, uint32_t blockHeight, uint32_t timeStamp) {}
+
+	virtual void onTxDeleted(const std::string &hash, bool notifyUser, bool recommendRescan) {}
+};
+
+static TransactionOutput *createWalletOutput(const std::string &address, uint64_t amount) {
+	UInt168 programHash = UINT168_ZERO;
+	Utils::UInt168FromAddress(programHash, address);
+
+	TransactionOutput *output = new TransactionOutput();
+	output->setAddress(address);
+	output->setAmount(amount);
+	output->setProgramHash(programHash);
+	output->setAssetId(UINT256_ZERO);
+	return output;
+}
+
 static ELATransaction *createELATransaction() {
 	ELATransaction *tx = ELATransactionNew();
 
@@ -229,6 +254,134 @@ TEST_CASE("Convert to and from json", "[Transaction]") {
 	}
 }
 
+TEST_CASE("Stream json the same as dump", "[Transaction]") {
+	srand(time(nullptr));
+
+	SECTION("transfer asset transaction") {
+		ELATransaction *ela = createELATransaction();
+		ela->Remark = "remark \"quoted\"\tand\\slashed\x01\xe4\xb8\xad";
+		Transaction tx(ela);
+		ela->raw.txHash = tx.getHash();
+
+		std::string out;
+		JsonWriter writer(out);
+		tx.writeJson(writer);
+		REQUIRE(out == tx.toJson().dump());
+	}
+
+	SECTION("coin base transaction") {
+		ELATransaction *ela = createELATransaction();
+		ela->Remark.clear();
+		ela->type = ELATransaction::CoinBase;
+		delete ela->payload;
+		CMBlock coinBaseData = getRandCMBlock(40);
+		ela->payload = new PayloadCoinBase(coinBaseData);
+		Transaction tx(ela);
+		ela->raw.txHash = tx.getHash();
+
+		std::string out;
+		JsonWriter writer(out);
+		writer.BeginArray();
+		tx.writeJson(writer);
+		tx.writeJson(writer);
+		writer.EndArray();
+
+		nlohmann::json j = nlohmann::json::array();
+		j.push_back(tx.toJson());
+		j.push_back(tx.toJson());
+		REQUIRE(out == j.dump());
+	}
+
+	SECTION("scalars and strings") {
+		nlohmann::json j;
+		j["a"] = std::string("\b\f\n\r\x1f\x7f/\"\\");
+		j["b"] = INT64_MIN;
+		j["c"] = UINT64_MAX;
+		j["d"] = false;
+		j["e"] = nlohmann::json();
+		j["f"] = nlohmann::json::array();
+		j["g"] = std::string("\xc3\xa9t\xc3\xa9");
+
+		std::string out;
+		JsonWriter writer(out);
+		writer.BeginObject()
+			.Key("a").String(j["a"].get<std::string>())
+			.Key("b").Int(INT64_MIN)
+			.Key("c").UInt(UINT64_MAX)
+			.Key("d").Bool(false)
+			.Key("e").Null()
+			.Key("f").BeginArray().EndArray()
+			.Key("g").String("\xc3\xa9t\xc3\xa9")
+			.EndObject();
+		REQUIRE(out == j.dump());
+
+		std::string invalid;
+		JsonWriter invalidWriter(invalid);
+		REQUIRE_THROWS(invalidWriter.String("\xff"));
+	}
+}
+
+TEST_CASE("Stream wallet json the same as dump", "[Transaction]") {
+	const std::string address = "EZuWALdKM92U89NYAN5DDP5ynqMuyqG5i3";
+	const std::string otherAddress = "EgSMqA8v4RJYyHareuXcFULKFjx2jNK9Zs";
+
+	boost::shared_ptr<Wallet::Listener> listener(new TestListener);
+	boost::shared_ptr<Wallet> wallet(new AddressRegisteringWallet(listener, std::vector<std::string>(1, address)));
+
+	// the wallet owns the raw transactions once registered
+	ELATransaction *incoming = ELATransactionNew();
+	incoming->type = ELATransaction::CoinBase;
+	incoming->raw.blockHeight = 1;
+	incoming->outputs.push_back(createWalletOutput(address, 150));
+	incoming->programs.push_back(new Program(getRandCMBlock(10), getRandCMBlock(10)));
+	incoming->Remark = "first \"income\"";
+	TransactionPtr incomingTx(new Transaction(incoming, false));
+	incoming->raw.txHash = incomingTx->getHash();
+	REQUIRE(wallet->registerTransaction(incomingTx));
+	wallet->RegisterRemark(incomingTx);
+
+	ELATransaction *spending = ELATransactionNew();
+	spending->type = ELATransaction::TransferAsset;
+	delete spending->payload;
+	spending->payload = ELAPayloadNew(spending->type);
+	BRTransactionAddInput(&spending->raw, incoming->raw.txHash, 0, 150, nullptr, 0, nullptr, 0, TXIN_SEQUENCE);
+	spending->outputs.push_back(createWalletOutput(otherAddress, 100));
+	spending->outputs.push_back(createWalletOutput(address, 40));
+	spending->programs.push_back(new Program(getRandCMBlock(10), getRandCMBlock(10)));
+	TransactionPtr spendingTx(new Transaction(spending, false));
+	spending->raw.txHash = spendingTx->getHash();
+	REQUIRE(wallet->registerTransaction(spendingTx));
+
+	SECTION("transactions with summary") {
+		const TransactionPtr txs[] = {incomingTx, spendingTx};
+		for (size_t i = 0; i < ARRAY_SIZE(txs); ++i) {
+			for (uint32_t blockHeight = 1; blockHeight < 10; blockHeight += 4) {
+				nlohmann::json j = txs[i]->toJson();
+				txs[i]->generateExtraTransactionInfo(j, wallet, blockHeight);
+
+				std::string out;
+				JsonWriter writer(out);
+				txs[i]->writeJson(writer, wallet, blockHeight);
+				REQUIRE(out == j.dump());
+
+				std::string summary;
+				JsonWriter summaryWriter(summary);
+				txs[i]->writeSummaryJson(summaryWriter, wallet, blockHeight);
+				REQUIRE(summary == j["Summary"].dump());
+			}
+		}
+	}
+
+	SECTION("balance info") {
+		nlohmann::json balanceInfo = wallet->GetBalanceInfo();
+		REQUIRE(balanceInfo["Balances"].size() == 1);
+		REQUIRE(wallet->GetBalanceInfoString() == balanceInfo.dump());
+
+		boost::shared_ptr<Wallet> empty(new AddressRegisteringWallet(listener, std::vector<std::string>()));
+		REQUIRE(empty->GetBalanceInfoString() == empty->GetBalanceInfo().dump());
+	}
+}
+
 TEST_CASE("public function test", "[Transaction]") {
 	srand(time(nullptr));
 
@@ -308,3 +461,63 @@ TEST_CASE("public function test", "[Transaction]") {
 
 	}
 }
+
+TEST_CASE("Pooled transaction allocation", "[Transaction]") {
+
+	SECTION("freed transaction memory is reused") {
+		ELATransaction *tx = createELATransaction();
+		void *addr = tx;
+		ELATransactionFree(tx);
+
+		tx = ELATransactionNew();
+		REQUIRE((void *)tx == addr);
+		REQUIRE(tx->raw.version == TX_VERSION);
+		REQUIRE(tx->raw.blockHeight == TX_UNCONFIRMED);
+		REQUIRE(tx->raw.inCount == 0);
+		REQUIRE(tx->raw.outputs == nullptr);
+		REQUIRE(tx->outputs.empty());
+		REQUIRE(tx->attributes.empty());
+		REQUIRE(tx->programs.empty());
+		REQUIRE(tx->Remark.empty());
+		ELATransactionFree(tx);
+	}
+
+	SECTION("reserve for bulk load") {
+		ObjectPool<Program> &pool = ObjectPool<Program>::Instance();
+		pool.Reserve(1000);
+		size_t capacity = pool.Capacity();
+		REQUIRE(pool.Available() >= 1000);
+
+		std::vector<Program *> programs;
+		for (size_t i = 0; i < 1000; ++i)
+			programs.push_back(new Program(getRandCMBlock(25), getRandCMBlock(25)));
+		REQUIRE(pool.Capacity() == capacity);
+
+		for (size_t i = 0; i < programs.size(); ++i)
+			delete programs[i];
+		REQUIRE(pool.Available() >= 1000);
+	}
+
+	SECTION("trim after bulk load") {
+		ObjectPool<Program> &pool = ObjectPool<Program>::Instance();
+		pool.Trim();
+		pool.Reserve(2000);
+		size_t reserved = pool.Capacity();
+
+		std::vector<Program *> programs;
+		for (size_t i = 0; i < 300; ++i)
+			programs.push_back(new Program(getRandCMBlock(25), getRandCMBlock(25)));
+		Program copy(*programs.back());
+
+		size_t released = pool.Trim();
+		REQUIRE(released >= 1000);
+		REQUIRE(pool.Capacity() == reserved - released);
+		REQUIRE(programs.back()->getCode().GetSize() == copy.getCode().GetSize());
+		REQUIRE(0 == memcmp(programs.back()->getCode(), copy.getCode(), copy.getCode().GetSize()));
+
+		for (size_t i = 0; i < programs.size(); ++i)
+			delete programs[i];
+		REQUIRE(pool.Trim() >= 300);
+		REQUIRE(pool.Capacity() < reserved - released);
+	}
+}
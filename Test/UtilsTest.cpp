@@ -4,8 +4,11 @@
 
 #define CATCH_CONFIG_MAIN
 
+#include <vector>
+#include <algorithm>
 #include "catch.hpp"
 
+#include "BRHex.h"
 #include "CMemBlock.h"
 #include "Utils.h"
 #include "WalletTool.h"
@@ -212,6 +215,85 @@ TEST_CASE("uint128 string", "[Utils]") {
 	REQUIRE(1 == UInt128Eq(&u128Recov, &u128));
 }
 
+TEST_CASE("hex encoding", "[Utils]") {
+	SECTION("matches bytewise encoding at every length and order") {
+		for (size_t len = 0; len < 100; ++len) {
+			std::vector<uint8_t> data(len + 1);
+			for (size_t i = 0; i < len; ++i)
+				data[i] = Utils::getRandomByte();
+
+			for (int reverse = 0; reverse < 2; ++reverse) {
+				std::string expected;
+				for (size_t i = 0; i < len; ++i) {
+					uint8_t b = data[reverse ? len - 1 - i : i];
+					expected += (char) _hexc(b >> 4);
+					expected += (char) _hexc(b);
+				}
+
+				char hex[2 * 100 + 1];
+				REQUIRE(BRHexEncode(hex, sizeof(hex), &data[0], len, reverse) == 2 * len + 1);
+				REQUIRE(std::string(hex) == expected);
+
+				std::string upper = expected;
+				std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+				std::vector<uint8_t> decoded(len + 1);
+				REQUIRE(BRHexDecode(&decoded[0], len, upper.c_str(), upper.size(), reverse));
+				REQUIRE(0 == memcmp(&decoded[0], &data[0], len));
+				REQUIRE(BRHexEq(upper.c_str(), upper.size(), &data[0], len, reverse));
+
+				if (len > 0) {
+					std::string other = expected;
+					char &c = other[(len * 7) % other.size()];
+					c = (c == '0') ? '1' : '0';
+					REQUIRE(!BRHexEq(other.c_str(), other.size(), &data[0], len, reverse));
+					other = expected;
+					other[len] = 'g';
+					REQUIRE(!BRHexDecode(&decoded[0], len, other.c_str(), other.size(), reverse));
+					REQUIRE(!BRHexEq(other.c_str(), other.size(), &data[0], len, reverse));
+				}
+			}
+		}
+	}
+
+	SECTION("rejects odd lengths and short buffers") {
+		uint8_t data[4];
+		REQUIRE(!BRHexDecode(data, sizeof(data), "abc", 3, 0));
+		REQUIRE(!BRHexDecode(data, 1, "abcd", 4, 0));
+		REQUIRE(!BRHexEq("abc", 3, data, 2, 0));
+		REQUIRE(BRHexEncode(nullptr, 0, data, sizeof(data), 0) == 9);
+		char hex[8];
+		REQUIRE(BRHexEncode(hex, sizeof(hex), data, sizeof(data), 0) == 0);
+	}
+
+	SECTION("UInt256 strings") {
+		std::string txid = "0a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728ff";
+		UInt256 u256 = Utils::UInt256FromString(txid, true);
+		REQUIRE(u256.u8[0] == 0xff);
+		REQUIRE(u256.u8[31] == 0x0a);
+		REQUIRE(Utils::UInt256ToString(u256, true) == txid);
+
+		std::string upper = txid;
+		std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+		REQUIRE(Utils::UInt256EqualsString(u256, upper, true));
+		REQUIRE(!Utils::UInt256EqualsString(u256, txid));
+		REQUIRE(!Utils::UInt256EqualsString(u256, txid.substr(2), true));
+
+		txid[5] = 'x';
+		UInt256 invalid = Utils::UInt256FromString(txid, true);
+		REQUIRE(UInt256IsZero(&invalid));
+	}
+
+	SECTION("Utils wrappers") {
+		uint8_t bytes[] = {0x00, 0x01, 0x7f, 0x80, 0xfe, 0xff};
+		REQUIRE(Utils::encodeHex(bytes, sizeof(bytes)) == "00017f80feff");
+		CMBlock decoded = Utils::decodeHex("00017F80FEFF");
+		REQUIRE(decoded.GetSize() == sizeof(bytes));
+		REQUIRE(0 == memcmp(decoded, bytes, sizeof(bytes)));
+		REQUIRE(Utils::decodeHex("").GetSize() == 0);
+		REQUIRE_THROWS(Utils::decodeHex("abc"));
+	}
+}
+
 TEST_CASE("mem string", "[Utils]") {
 	CMBlock block;
 	CMBlock mbRand256 = WalletTool::GenerateSeed256();
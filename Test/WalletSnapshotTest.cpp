@@ -0,0 +1,193 @@
+// Copyright (c) 2012-2018 The Elastos Open Source Project
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#define CATCH_CONFIG_MAIN
+
+#include <catch.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "BRBIP39Mnemonic.h"
+#include "BRArray.h"
+
+#include "Utils.h"
+#include "SingleAddressWallet.h"
+#include "WalletSnapshot.h"
+
+using namespace Elastos::ElaWallet;
+
+class TestListener : public Wallet::Listener {
+public:
+	virtual void balanceChanged(uint64_t balance) {
+	}
+
+	virtual void onTxAdded(const TransactionPtr &transaction) {
+	}
+
+	virtual void onTxUpdated(const std::string &hash, uint32_t blockHeight, uint32_t timeStamp) {
+	}
+
+	virtual void onTxDeleted(const std::string &hash, bool notifyUser, bool recommendRescan) {
+	}
+};
+
+static MasterPubKeyPtr createDummyPublicKey(const std::string &phrase) {
+	UInt512 seed;
+	BRBIP39DeriveKey(seed.u8, phrase.c_str(), "");
+
+	UInt256 chainCode = UINT256_ZERO;
+	Key key;
+	key.deriveKeyAndChain(chainCode, &seed, sizeof(seed), 3, 44, 0, 0);
+	return MasterPubKeyPtr(new MasterPubKey(*key.getRaw(), chainCode));
+}
+
+static MasterPubKeyPtr createDummyPublicKey() {
+	return createDummyPublicKey(
+		"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about");
+}
+
+static boost::shared_ptr<Wallet> createWallet(const SharedWrapperList<Transaction, BRTransaction *> &transactions,
+											  const MasterPubKeyPtr &masterPubKey,
+											  const WalletSnapshotPtr &snapshot = WalletSnapshotPtr()) {
+	return boost::shared_ptr<Wallet>(new SingleAddressWallet(transactions, masterPubKey,
+															 boost::shared_ptr<Wallet::Listener>(new TestListener),
+															 snapshot));
+}
+
+struct Payment {
+	uint64_t Amount;
+	uint32_t Nonce;
+	uint32_t BlockHeight;
+};
+
+// signed transactions paying to address, a new list for every wallet as the wallet owns its transactions
+static SharedWrapperList<Transaction, BRTransaction *> createPayments(const std::string &address,
+																	 const std::vector<Payment> &payments) {
+	SharedWrapperList<Transaction, BRTransaction *> transactions;
+	for (size_t i = 0; i < payments.size(); ++i) {
+		ELATransaction *tx = ELATransactionNew();
+		TransactionOutput *output = new TransactionOutput();
+		output->setAmount(payments[i].Amount);
+		output->setAddress(address);
+		output->setAssetId(Key::getSystemAssetId());
+		tx->outputs.push_back(output);
+		tx->raw.lockTime = payments[i].Nonce;
+		tx->raw.blockHeight = payments[i].BlockHeight;
+		tx->raw.timestamp = 1536000000 + payments[i].Nonce;
+		tx->programs.push_back(new Program(CMBlock(35), CMBlock(65)));
+		tx->Remark = "payment " + std::to_string(payments[i].Nonce);
+
+		TransactionPtr transaction(new Transaction(tx, false));
+		transaction->getHash();
+		transactions.push_back(transaction);
+	}
+	return transactions;
+}
+
+static std::string walletAddress(const MasterPubKeyPtr &masterPubKey) {
+	SharedWrapperList<Transaction, BRTransaction *> none;
+	return createWallet(none, masterPubKey)->getAllAddresses()[0];
+}
+
+static void checkSameState(const boost::shared_ptr<Wallet> &restored, const boost::shared_ptr<Wallet> &rebuilt) {
+	BRWallet *a = restored->getRaw(), *b = rebuilt->getRaw();
+
+	REQUIRE(a->balance == b->balance);
+	REQUIRE(a->totalSent == b->totalSent);
+	REQUIRE(a->totalReceived == b->totalReceived);
+	REQUIRE(array_count(a->transactions) == array_count(b->transactions));
+	for (size_t i = 0; i < array_count(a->transactions); ++i) {
+		REQUIRE(UInt256Eq(&a->transactions[i]->txHash, &b->transactions[i]->txHash));
+		REQUIRE(a->balanceHist[i] == b->balanceHist[i]);
+	}
+	REQUIRE(array_count(a->utxos) == array_count(b->utxos));
+	for (size_t i = 0; i < array_count(a->utxos); ++i) {
+		REQUIRE(UInt256Eq(&a->utxos[i].hash, &b->utxos[i].hash));
+		REQUIRE(a->utxos[i].n == b->utxos[i].n);
+	}
+	REQUIRE(restored->getAllAddresses() == rebuilt->getAllAddresses());
+}
+
+TEST_CASE("WalletSnapshot restores the state of a wallet", "[WalletSnapshot]") {
+	boost::filesystem::path path = boost::filesystem::temp_directory_path() / "WalletSnapshotTest.snapshot";
+	boost::filesystem::remove(path);
+
+	MasterPubKeyPtr masterPubKey = createDummyPublicKey();
+	std::string address = walletAddress(masterPubKey);
+
+	std::vector<Payment> payments;
+	for (uint32_t i = 0; i < 20; ++i)
+		payments.push_back({100000000 + i, i, 100 + i});
+
+	SECTION("missing snapshot") {
+		REQUIRE(WalletSnapshot::Read(path) == nullptr);
+	}
+
+	SECTION("same transactions") {
+		boost::shared_ptr<Wallet> wallet = createWallet(createPayments(address, payments), masterPubKey);
+		REQUIRE(wallet->WriteSnapshot(UINT256_ZERO, path));
+
+		WalletSnapshotPtr snapshot = WalletSnapshot::Read(path);
+		REQUIRE(snapshot != nullptr);
+		REQUIRE(snapshot->GetTransactionCount() == payments.size());
+
+		SharedWrapperList<Transaction, BRTransaction *> transactions = createPayments(address, payments);
+		boost::shared_ptr<Wallet> restored = createWallet(transactions, masterPubKey, snapshot);
+		checkSameState(restored, wallet);
+		REQUIRE(restored->GetRemark(Utils::UInt256ToString(transactions[3]->getHash())) == "payment 3");
+	}
+
+	SECTION("transactions received after the snapshot") {
+		boost::shared_ptr<Wallet> wallet = createWallet(createPayments(address, payments), masterPubKey);
+		REQUIRE(wallet->WriteSnapshot(UINT256_ZERO, path));
+
+		payments.push_back({5000, 100, 200});
+		payments.push_back({6000, 101, TX_UNCONFIRMED});
+		SharedWrapperList<Transaction, BRTransaction *> transactions = createPayments(address, payments);
+		boost::shared_ptr<Wallet> restored = createWallet(transactions, masterPubKey, WalletSnapshot::Read(path));
+		boost::shared_ptr<Wallet> rebuilt = createWallet(createPayments(address, payments), masterPubKey);
+		checkSameState(restored, rebuilt);
+		REQUIRE(restored->GetRemark(Utils::UInt256ToString(transactions[21]->getHash())) == "payment 101");
+	}
+
+	SECTION("transaction confirmed after the snapshot") {
+		payments[19].BlockHeight = TX_UNCONFIRMED;
+		boost::shared_ptr<Wallet> wallet = createWallet(createPayments(address, payments), masterPubKey);
+		REQUIRE(wallet->WriteSnapshot(UINT256_ZERO, path));
+
+		payments[19].BlockHeight = 150;
+		boost::shared_ptr<Wallet> restored = createWallet(createPayments(address, payments), masterPubKey,
+														  WalletSnapshot::Read(path));
+		boost::shared_ptr<Wallet> rebuilt = createWallet(createPayments(address, payments), masterPubKey);
+		checkSameState(restored, rebuilt);
+	}
+
+	SECTION("another master public key") {
+		boost::shared_ptr<Wallet> wallet = createWallet(createPayments(address, payments), masterPubKey);
+		REQUIRE(wallet->WriteSnapshot(UINT256_ZERO, path));
+
+		MasterPubKeyPtr other = createDummyPublicKey(
+			"zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo wrong");
+		SharedWrapperList<Transaction, BRTransaction *> none;
+		boost::shared_ptr<Wallet> restored = createWallet(none, other, WalletSnapshot::Read(path));
+		REQUIRE(restored->getBalance() == 0);
+		REQUIRE(restored->getAllAddresses() != wallet->getAllAddresses());
+	}
+
+	SECTION("damaged snapshot") {
+		boost::shared_ptr<Wallet> wallet = createWallet(createPayments(address, payments), masterPubKey);
+		REQUIRE(wallet->WriteSnapshot(UINT256_ZERO, path));
+
+		{
+			boost::filesystem::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+			file.seekg(20);
+			char byte = (char) file.get();
+			file.seekp(20);
+			file.put((char) (byte ^ 1));
+		}
+		REQUIRE(WalletSnapshot::Read(path) == nullptr);
+	}
+
+	boost::filesystem::remove(path);
+}
@@ -3,12 +3,156 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #define CATCH_CONFIG_MAIN
+#include <fstream>
+#include <boost/filesystem.hpp>
+#include <nlohmann/json.hpp>
+
 #include "catch.hpp"
 #include "Wallet.h"
+#include "AddressRegisteringWallet.h"
+#include "ELATransaction.h"
+#include "SDK/Transaction/TransactionOutput.h"
+#include "Utils.h"
+#include "Trace.h"
+#include "TestHelper.h"
 
 using namespace Elastos::ElaWallet;
 
+class TestListener : public Wallet::Listener {
+public:
+	virtual void balanceChanged(uint64_t balance) {}
+
+	virtual void onTxAdded(const TransactionPtr &transaction) {}
+
+	virtual void onTxUpdated(const std::string &hash, uint32_t blockHeight, uint32_t timeStamp) {}
+
+	virtual void onTxDeleted(const std::string &hash, bool notifyUser, bool recommendRescan) {}
+};
+
+static TransactionOutput *createOutput(const std::string &address, uint64_t amount) {
+	UInt168 programHash = UINT168_ZERO;
+	Utils::UInt168FromAddress(programHash, address);
+
+	TransactionOutput *output = new TransactionOutput();
+	output->setAddress(address);
+	output->setAmount(amount);
+	output->setProgramHash(programHash);
+	output->setAssetId(UINT256_ZERO);
+	return output;
+}
+
 TEST_CASE( "Wallet test", "[Wallet]" )
 {
 
 }
+
+TEST_CASE("Transaction amounts and addresses", "[Wallet]") {
+	const std::string address = "EZuWALdKM92U89NYAN5DDP5ynqMuyqG5i3";
+	const std::string otherAddress = "EgSMqA8v4RJYyHareuXcFULKFjx2jNK9Zs";
+	const std::string thirdAddress = "ERbn5LLwuhA3v7kpYBV7cH4vh99uhGZgtR";
+
+	boost::shared_ptr<Wallet::Listener> listener(new TestListener);
+	boost::shared_ptr<Wallet> wallet(new AddressRegisteringWallet(listener, std::vector<std::string>(1, address)));
+
+	// the wallet owns the raw transactions once registered
+	ELATransaction *incoming = ELATransactionNew();
+	incoming->type = ELATransaction::CoinBase;
+	incoming->raw.blockHeight = 1;
+	incoming->outputs.push_back(createOutput(address, 150));
+	incoming->outputs.push_back(createOutput(thirdAddress, 50));
+	incoming->programs.push_back(new Program(getRandCMBlock(10), getRandCMBlock(10)));
+	TransactionPtr incomingTx(new Transaction(incoming, false));
+	incoming->raw.txHash = incomingTx->getHash();
+	REQUIRE(wallet->registerTransaction(incomingTx));
+
+	ELATransaction *spending = ELATransactionNew();
+	spending->type = ELATransaction::TransferAsset;
+	delete spending->payload;
+	spending->payload = ELAPayloadNew(spending->type);
+	BRTransactionAddInput(&spending->raw, incoming->raw.txHash, 0, 150, nullptr, 0, nullptr, 0, TXIN_SEQUENCE);
+	spending->outputs.push_back(createOutput(otherAddress, 100));
+	spending->outputs.push_back(createOutput(address, 40));
+	spending->programs.push_back(new Program(getRandCMBlock(10), getRandCMBlock(10)));
+	TransactionPtr spendingTx(new Transaction(spending, false));
+	spending->raw.txHash = spendingTx->getHash();
+	REQUIRE(wallet->registerTransaction(spendingTx));
+
+	// spends an output of the incoming transaction that is not the wallet's
+	ELATransaction *received = ELATransactionNew();
+	received->type = ELATransaction::TransferAsset;
+	delete received->payload;
+	received->payload = ELAPayloadNew(received->type);
+	BRTransactionAddInput(&received->raw, incoming->raw.txHash, 1, 50, nullptr, 0, nullptr, 0, TXIN_SEQUENCE);
+	received->outputs.push_back(createOutput(address, 45));
+	received->programs.push_back(new Program(getRandCMBlock(10), getRandCMBlock(10)));
+	TransactionPtr receivedTx(new Transaction(received, false));
+	received->raw.txHash = receivedTx->getHash();
+	REQUIRE(wallet->registerTransaction(receivedTx));
+
+	SECTION("incoming") {
+		REQUIRE(wallet->getTransactionAmountSent(incomingTx) == 0);
+		REQUIRE(wallet->getTransactionAmountReceived(incomingTx) == 150);
+		REQUIRE(wallet->getTransactionAmount(incomingTx) == 150);
+		REQUIRE(wallet->getTransactionAddress(incomingTx) == "");
+	}
+
+	SECTION("spending") {
+		REQUIRE(wallet->getTransactionAmountSent(spendingTx) == 150);
+		REQUIRE(wallet->getTransactionAmountReceived(spendingTx) == 40);
+		REQUIRE(wallet->getTransactionFee(spendingTx) == 10);
+		REQUIRE(wallet->getTransactionAmount(spendingTx) == (uint64_t) -120);
+		REQUIRE(wallet->getTransactionAddress(spendingTx) == otherAddress);
+	}
+
+	SECTION("received from another address") {
+		REQUIRE(wallet->getTransactionAmountSent(receivedTx) == 0);
+		REQUIRE(wallet->getTransactionAmountReceived(receivedTx) == 45);
+		REQUIRE(wallet->getTransactionAmount(receivedTx) == 45);
+		REQUIRE(wallet->getTransactionAddress(receivedTx) == thirdAddress);
+	}
+
+	SECTION("remove a transaction sent by the wallet") {
+		REQUIRE(BRWalletAmountSentByTx(wallet->getRaw(), spendingTx->getRaw()) == 150);
+		REQUIRE(BRWalletAmountReceivedFromTx(wallet->getRaw(), spendingTx->getRaw()) == 40);
+
+		REQUIRE(BRWalletTransactions(wallet->getRaw(), nullptr, 0) == 3);
+		wallet->removeTransaction(spendingTx->getHash());
+		REQUIRE(BRWalletTransactions(wallet->getRaw(), nullptr, 0) == 2);
+	}
+}
+
+TEST_CASE("Wallet id on trace spans", "[Wallet]") {
+	const std::string address = "EZuWALdKM92U89NYAN5DDP5ynqMuyqG5i3";
+	boost::filesystem::path path = boost::filesystem::temp_directory_path() / "spvsdk_wallet_trace_test.json";
+
+	boost::shared_ptr<Wallet::Listener> listener(new TestListener);
+	boost::shared_ptr<Wallet> wallet(new AddressRegisteringWallet(listener, std::vector<std::string>(1, address)));
+	wallet->setWalletId("master/ELA");
+
+	ELATransaction *incoming = ELATransactionNew();
+	incoming->type = ELATransaction::CoinBase;
+	incoming->raw.blockHeight = 1;
+	incoming->outputs.push_back(createOutput(address, 150));
+	incoming->programs.push_back(new Program(getRandCMBlock(10), getRandCMBlock(10)));
+	TransactionPtr incomingTx(new Transaction(incoming, false));
+	incoming->raw.txHash = incomingTx->getHash();
+
+	Trace::Start();
+	REQUIRE(wallet->registerTransaction(incomingTx));
+	REQUIRE(Trace::Stop(path));
+
+	std::ifstream in(path.string());
+	nlohmann::json trace;
+	in >> trace;
+
+	size_t found = 0;
+	for (nlohmann::json::const_iterator it = trace["traceEvents"].begin(); it != trace["traceEvents"].end(); ++it) {
+		if ((*it)["ph"] == "X" && (*it)["name"] == "Wallet::registerTransaction") {
+			REQUIRE((*it)["args"]["wallet"] == "master/ELA");
+			REQUIRE((*it)["args"]["tx"] == Utils::UInt256ToString(incomingTx->getHash()));
+			found++;
+		}
+	}
+	REQUIRE(found == 1);
+	boost::filesystem::remove(path);
+}